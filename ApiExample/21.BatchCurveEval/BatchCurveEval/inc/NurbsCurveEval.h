@@ -0,0 +1,93 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+#pragma once
+
+/* ZW3D API includes */
+#include "zwapi_util.h"
+#include "zwapi_math_data.h"
+#include "zwapi_curve_data.h"
+
+/* Application includes */
+#include <vector>
+
+/*******************************************************************/
+/* Constant definitions */
+#define NURBS_EVAL_MAX_DEGREE 15                          /* highest supported degree */
+#define NURBS_EVAL_MAX_ORDER (NURBS_EVAL_MAX_DEGREE + 1)  /* highest supported order */
+#define NURBS_EVAL_MAX_LEVEL 3                            /* highest derivative level (svxEvalCurv) */
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: instruction set used by the blending kernel */
+enum NurbsEvalKernel
+{
+    NurbsEval_Scalar = 0,  /* portable C++ */
+    NurbsEval_Avx2 = 1,    /* x64 AVX2 + FMA, selected at run time */
+    NurbsEval_Neon = 2,    /* AArch64 NEON */
+};
+
+/*
+DESCRIPTION:
+   Host-independent batch evaluator of a NURBS curve.
+
+   The knot vector and control points are copied out of the host structure
+once by Init(), the control points are packed as homogeneous (wx,wy,wz,w)
+quadruples (w=1 for non-rational curves), and every evaluation blends one
+knot span of them with the basis function derivatives. One homogeneous point
+is exactly one AVX2 register (or two NEON registers), so the blend of the
+(degree+1) control points for all requested derivative levels is done with
+fused multiply-adds.
+
+   Parameters are taken in the knot space of the curve, i.e. the same "t"
+accepted by cvxCrvEval2() / ZwCurveDifferentiate() inside the limits given
+by cvxCrvParam(). The knot span found for one parameter is used as the
+starting guess for the next one, so sorted parameter lists never fall back
+to the binary search.
+
+   The evaluator is immutable after Init() and may be shared by threads.
+*/
+class NurbsCurveEvaluator
+{
+public:
+    NurbsCurveEvaluator();
+
+    int Init(const svxParameters &knots, const svxControlPoints &points);
+    int Init(const szwNurbsParameter &knots, const szwNurbsControlPoint &points);
+    int Init(const svxCurve &curve);
+
+    int Evaluate(double t, int level, svxEvalCurv *eval) const;
+    int Evaluate(int count, const double *t, int level, svxEvalCurv *evals) const;
+    int EvaluatePoints(int count, const double *t, svxPoint *points) const;
+
+    int IsValid(void) const { return m_degree > 0; }
+    int Degree(void) const { return m_degree; }
+    int Dimension(void) const { return m_dimension; }
+    int IsRational(void) const { return m_rational; }
+    svxLimit Domain(void) const;
+    NurbsEvalKernel Kernel(void) const { return m_kernel; }
+
+private:
+    int Setup(int closed, int degree, int numKnots, const double *knots, int rational,
+        int dimension, int numPoints, const double *coordinates);
+    void EvaluateSpan(int span, double t, int level, svxEvalCurv *eval) const;
+
+    int m_degree;                  /* degree of curve, 0 if not initialized */
+    int m_closed;                  /* 1 if the parameter wraps around the domain */
+    int m_rational;                /* 1 if weights are not all 1 */
+    int m_dimension;               /* spatial dimension (2 or 3) */
+    int m_numPoints;               /* number of control points */
+    svxLimit m_domain;             /* valid parameter range of the curve */
+    std::vector<double> m_knots;   /* clamped knot vector (numPoints + degree + 1) */
+    std::vector<double> m_points;  /* homogeneous control points, 4 doubles each */
+    NurbsEvalKernel m_kernel;      /* blending kernel selected for this cpu */
+};
+
+/* Function declaration */
+int NurbsKnotVectorMake(int degree, int numPoints, int numKnots, const double *knots, std::vector<double> &full);
+int NurbsSpanFind(const double *knots, int degree, int numPoints, double t, int hint);
+void NurbsBasisDerivatives(const double *knots, int degree, int span, double t, int level, double *ders);
+double NurbsParameterClamp(double t, svxLimit domain, int closed);
+NurbsEvalKernel NurbsEvalKernelDetect(void);
+const char *NurbsEvalKernelName(NurbsEvalKernel kernel);
@@ -0,0 +1,316 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* ZW3D API includes */
+#include "zwapi_curve.h"
+#include "zwapi_entity.h"
+#include "zwapi_math_nurbscurve.h"
+#include "zwapi_userinput.h"
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+#include "..\inc\BatchCurveEvalPr.h"
+#include "..\inc\NurbsCurveEval.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define MESSAGE_SIZE 256
+#define CHECK_SAMPLES 257          /* samples per curve of the accuracy check */
+#define CHECK_TOLERANCE 1.0e-9     /* required agreement with cvxCrvEval2() */
+#define BENCH_DEFAULT_SAMPLES 100000
+
+/*******************************************************************/
+/* Function declarations */
+static int BatchCurveEvalCheck(void);
+static int BatchCurveEvalBench(void);
+static int CurveEvaluatorLoad(const szwEntityHandle &curve, NurbsCurveEvaluator *evaluator, szwLimit *range);
+static void ParameterListMake(szwLimit range, int count, std::vector<double> &t);
+static double EvalDifference(const svxEvalCurv &a, const svxEvalCurv &b, int level);
+
+/*******************************************************************/
+/* Function definition */
+int RegisterBatchCurveEval
+(
+void
+)
+/*
+DESCRIPTION:
+   Register the commands of the batch curve evaluator.
+*/
+{
+    /* Compare the batch evaluator with cvxCrvEval2() by entering "~BatchCurveEvalCheck" */
+    ZwCommandFunctionLoad("BatchCurveEvalCheck", (void *)BatchCurveEvalCheck, ZW_LICENSE_CODE_GENERAL);
+
+    /* Time the batch evaluator against the per-call API by entering "~BatchCurveEvalBench" */
+    ZwCommandFunctionLoad("BatchCurveEvalBench", (void *)BatchCurveEvalBench, ZW_LICENSE_CODE_GENERAL);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int UnloadBatchCurveEval
+(
+void
+)
+/*
+DESCRIPTION:
+   Unload the commands of the batch curve evaluator.
+*/
+{
+    ZwCommandFunctionUnload("BatchCurveEvalCheck");
+    ZwCommandFunctionUnload("BatchCurveEvalBench");
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int CurveEvaluatorLoad
+(
+const szwEntityHandle &curve,     /* I: curve or edge */
+NurbsCurveEvaluator *evaluator,   /* O: evaluator of the curve */
+szwLimit *range                   /* O: parameter range of the curve */
+)
+/*
+DESCRIPTION:
+   Get the NURBS data of a curve or edge from the host and load it into
+an evaluator.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    szwCurve data{};
+    if (ZwCurveNURBSDataGet(curve, 1, &data))
+        return 1;
+
+    int ret = evaluator->Init(data.parameter, data.controlPoint);
+    ZwCurveFree(&data);
+    if (ret)
+        return 1;
+
+    if (ZwCurveTParameterRangeGet(curve, range))
+        *range = evaluator->Domain();
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void ParameterListMake
+(
+szwLimit range,          /* I: parameter range */
+int count,               /* I: number of parameters */
+std::vector<double> &t   /* O: uniformly spaced parameters, ends included */
+)
+/*
+DESCRIPTION:
+   Sample a parameter range uniformly.
+*/
+{
+    t.resize(count);
+    const double step = count > 1 ? (range.max - range.min) / (count - 1) : 0.0;
+    for (int i = 0; i < count; i++)
+        t[i] = range.min + step * i;
+    if (count > 1)
+        t[count - 1] = range.max;
+}
+
+/*******************************************************************/
+/* Function definition */
+double EvalDifference
+(
+const svxEvalCurv &a,   /* I: result 1 */
+const svxEvalCurv &b,   /* I: result 2 */
+int level               /* I: level to compare (0~3) */
+)
+/*
+DESCRIPTION:
+   Difference of one level of two evaluations. Points are compared in
+absolute terms, derivatives relative to their magnitude once it exceeds 1.
+*/
+{
+    const svxPoint *pa = &a.pnt, *pb = &b.pnt;
+    switch (level)
+    {
+        case 1: pa = &a.deriv_1; pb = &b.deriv_1; break;
+        case 2: pa = &a.deriv_2; pb = &b.deriv_2; break;
+        case 3: pa = &a.deriv_3; pb = &b.deriv_3; break;
+        default: break;
+    }
+
+    const double dx = pa->x - pb->x, dy = pa->y - pb->y, dz = pa->z - pb->z;
+    const double diff = sqrt(dx * dx + dy * dy + dz * dz);
+    if (level == 0)
+        return diff;
+
+    const double size = sqrt(pb->x * pb->x + pb->y * pb->y + pb->z * pb->z);
+    return size > 1.0 ? diff / size : diff;
+}
+
+/*******************************************************************/
+/* Function definition */
+int BatchCurveEvalCheck
+(
+void
+)
+/*
+DESCRIPTION:
+   Evaluate the picked curves and edges with the batch evaluator and with
+cvxCrvEval2() at the same parameters, and report the largest difference
+per derivative level.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    int count = 0;
+    szwEntityHandle *curves = nullptr;
+    if (ZwEntityListGetByPick("Select curves or edges to check", ZW_INPUT_EDGE_OR_CURVE, 0, &count, &curves))
+        return 1;
+
+    char message[MESSAGE_SIZE];
+    int failed = 0;
+    std::vector<double> t;
+    std::vector<svxEvalCurv> batch(CHECK_SAMPLES);
+
+    for (int i = 0; i < count; i++)
+    {
+        int idCurve = 0;
+        ZwEntityIdGet(1, &curves[i], &idCurve);
+
+        NurbsCurveEvaluator evaluator;
+        szwLimit range{};
+        if (CurveEvaluatorLoad(curves[i], &evaluator, &range))
+        {
+            sprintf_s(message, MESSAGE_SIZE, "Curve %d: NURBS data is not supported.", idCurve);
+            cvxMsgDisp(message);
+            failed++;
+            continue;
+        }
+
+        ParameterListMake(range, CHECK_SAMPLES, t);
+        evaluator.Evaluate(CHECK_SAMPLES, t.data(), NURBS_EVAL_MAX_LEVEL, batch.data());
+
+        double maxDiff[NURBS_EVAL_MAX_LEVEL + 1] = {};
+        for (int j = 0; j < CHECK_SAMPLES; j++)
+        {
+            svxEvalCurv host{};
+            if (cvxCrvEval2(idCurve, t[j], NURBS_EVAL_MAX_LEVEL, &host))
+                continue;
+            for (int level = 0; level <= NURBS_EVAL_MAX_LEVEL; level++)
+            {
+                const double diff = EvalDifference(batch[j], host, level);
+                if (diff > maxDiff[level])
+                    maxDiff[level] = diff;
+            }
+        }
+
+        int pass = 1;
+        for (int level = 0; level <= NURBS_EVAL_MAX_LEVEL; level++)
+        {
+            if (maxDiff[level] > CHECK_TOLERANCE)
+                pass = 0;
+        }
+        failed += pass ? 0 : 1;
+
+        sprintf_s(message, MESSAGE_SIZE, "Curve %d (degree %d%s): max diff P %.2e, C' %.2e, C'' %.2e, C''' %.2e %s",
+            idCurve, evaluator.Degree(), evaluator.IsRational() ? ", rational" : "",
+            maxDiff[0], maxDiff[1], maxDiff[2], maxDiff[3], pass ? "OK" : "FAILED");
+        cvxMsgDisp(message);
+    }
+
+    sprintf_s(message, MESSAGE_SIZE, "%d of %d curves agree with cvxCrvEval2() within %.0e.",
+        count - failed, count, CHECK_TOLERANCE);
+    cvxMsgDisp(message);
+
+    ZwEntityHandleListFree(count, &curves);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int BatchCurveEvalBench
+(
+void
+)
+/*
+DESCRIPTION:
+   Time the evaluation of one curve at N parameters through
+cvxCrvEval2(), ZwCurveDifferentiate() and the batch evaluator.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    szwEntityHandle curve{};
+    if (ZwEntityGetByPick("Select curve or edge to benchmark", ZW_INPUT_EDGE_OR_CURVE, 0, &curve))
+        return 1;
+
+    double number = BENCH_DEFAULT_SAMPLES;
+    if (cvxGetNumber("Number of parameters (default 100000)", &number) || number < 2.0)
+        number = BENCH_DEFAULT_SAMPLES;
+    const int count = (int)number;
+
+    char message[MESSAGE_SIZE];
+    NurbsCurveEvaluator evaluator;
+    szwLimit range{};
+    if (CurveEvaluatorLoad(curve, &evaluator, &range))
+    {
+        cvxMsgDisp("NURBS data of the curve is not supported.");
+        ZwEntityHandleFree(&curve);
+        return 1;
+    }
+
+    int idCurve = 0;
+    ZwEntityIdGet(1, &curve, &idCurve);
+
+    std::vector<double> t;
+    ParameterListMake(range, count, t);
+    std::vector<svxEvalCurv> host(count), batch(count);
+
+    for (int level = 0; level <= NURBS_EVAL_MAX_LEVEL; level++)
+    {
+        /* per-call legacy API */
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < count; i++)
+            cvxCrvEval2(idCurve, t[i], level, &host[i]);
+        const double timeLegacy = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        /* per-call handle based API */
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < count; i++)
+        {
+            szwCurveDerivative derivative{};
+            ZwCurveDifferentiate(curve, t[i], level, &derivative, nullptr);
+        }
+        const double timeHandle = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        /* batch evaluator */
+        start = std::chrono::steady_clock::now();
+        evaluator.Evaluate(count, t.data(), level, batch.data());
+        const double timeBatch = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        double maxDiff = 0.0;
+        for (int i = 0; i < count; i++)
+        {
+            for (int k = 0; k <= level; k++)
+            {
+                const double diff = EvalDifference(batch[i], host[i], k);
+                if (diff > maxDiff)
+                    maxDiff = diff;
+            }
+        }
+
+        sprintf_s(message, MESSAGE_SIZE,
+            "Level %d, %d params: cvxCrvEval2 %.1f ns, ZwCurveDifferentiate %.1f ns, batch (%s) %.1f ns per call, speedup %.1fx, max diff %.2e",
+            level, count, timeLegacy * 1.0e9 / count, timeHandle * 1.0e9 / count,
+            NurbsEvalKernelName(evaluator.Kernel()), timeBatch * 1.0e9 / count,
+            timeBatch > 0.0 ? timeLegacy / timeBatch : 0.0, maxDiff);
+        cvxMsgDisp(message);
+    }
+
+    ZwEntityHandleFree(&curve);
+    return 0;
+}
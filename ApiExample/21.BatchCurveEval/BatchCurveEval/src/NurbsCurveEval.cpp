@@ -0,0 +1,819 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* Application includes */
+#include <math.h>
+#include <string.h>
+#include "..\inc\NurbsCurveEval.h"
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define NURBS_EVAL_X64 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#elif defined(_M_ARM64) || defined(__aarch64__)
+#define NURBS_EVAL_ARM64 1
+#include <arm_neon.h>
+#endif
+
+/* MSVC accepts AVX2 intrinsics in any function, gcc/clang need the target attribute */
+#if defined(NURBS_EVAL_X64) && (defined(__GNUC__) || defined(__clang__))
+#define NURBS_EVAL_AVX2_TARGET __attribute__((target("avx2,fma")))
+#else
+#define NURBS_EVAL_AVX2_TARGET
+#endif
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: blends "order" homogeneous control points for derivative levels 0..levels */
+typedef void (*NurbsBlendFunction)(int order, int levels, const double *ders, const double *points, double *out);
+
+/*******************************************************************/
+/* Function declarations */
+static void BlendScalar(int order, int levels, const double *ders, const double *points, double *out);
+#if defined(NURBS_EVAL_X64)
+static void BlendAvx2(int order, int levels, const double *ders, const double *points, double *out);
+#endif
+#if defined(NURBS_EVAL_ARM64)
+static void BlendNeon(int order, int levels, const double *ders, const double *points, double *out);
+#endif
+static NurbsBlendFunction BlendFunctionGet(NurbsEvalKernel kernel);
+static void HomogeneousToEval(const double *hw, int level, int rational, svxEvalCurv *eval);
+
+/*******************************************************************/
+/* Function definition */
+NurbsEvalKernel NurbsEvalKernelDetect
+(
+void
+)
+/*
+DESCRIPTION:
+   Select the fastest blending kernel supported by the running cpu. The
+result is computed once and cached.
+*/
+{
+    static const NurbsEvalKernel kernel = []()
+    {
+#if defined(NURBS_EVAL_X64)
+#if defined(_MSC_VER)
+        int info[4] = {};
+        __cpuid(info, 0);
+        if (info[0] < 7)
+            return NurbsEval_Scalar;
+        __cpuid(info, 1);
+        const int hasFma = (info[2] >> 12) & 1;
+        const int hasOsxsave = (info[2] >> 27) & 1;
+        const int hasAvx = (info[2] >> 28) & 1;
+        if (!hasFma || !hasOsxsave || !hasAvx)
+            return NurbsEval_Scalar;
+        if ((_xgetbv(0) & 0x6) != 0x6)
+            return NurbsEval_Scalar;
+        __cpuidex(info, 7, 0);
+        if ((info[1] >> 5) & 1)
+            return NurbsEval_Avx2;
+        return NurbsEval_Scalar;
+#else
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+            return NurbsEval_Avx2;
+        return NurbsEval_Scalar;
+#endif
+#elif defined(NURBS_EVAL_ARM64)
+        return NurbsEval_Neon;
+#else
+        return NurbsEval_Scalar;
+#endif
+    }();
+    return kernel;
+}
+
+/*******************************************************************/
+/* Function definition */
+const char *NurbsEvalKernelName
+(
+NurbsEvalKernel kernel /* I: blending kernel */
+)
+/*
+DESCRIPTION:
+   Readable name of a blending kernel, for reports.
+*/
+{
+    switch (kernel)
+    {
+        case NurbsEval_Avx2: return "AVX2";
+        case NurbsEval_Neon: return "NEON";
+        default: return "scalar";
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+int NurbsKnotVectorMake
+(
+int degree,                  /* I: degree */
+int numPoints,               /* I: number of control points */
+int numKnots,                /* I: number of knots */
+const double *knots,         /* I: knot values */
+std::vector<double> &full    /* O: full knot vector (numPoints + degree + 1 values) */
+)
+/*
+DESCRIPTION:
+   Copy a knot vector. Both the full form (numPoints + degree + 1 values)
+and the abbreviated form without the outer end knots (numPoints + degree - 1
+values) are accepted; the latter is completed by repeating the end knots.
+
+   Return 1 if the knot vector is invalid, else 0.
+*/
+{
+    full.clear();
+    if (knots == nullptr || degree < 1 || numPoints < degree + 1)
+        return 1;
+
+    const int fullKnots = numPoints + degree + 1;
+    if (numKnots == fullKnots)
+    {
+        full.assign(knots, knots + numKnots);
+    }
+    else if (numKnots == fullKnots - 2)
+    {
+        full.reserve(fullKnots);
+        full.push_back(knots[0]);
+        full.insert(full.end(), knots, knots + numKnots);
+        full.push_back(knots[numKnots - 1]);
+    }
+    else
+    {
+        return 1;
+    }
+
+    for (int i = 1; i < fullKnots; i++)
+    {
+        if (full[i] < full[i - 1])
+            return 1;
+    }
+    if (!(full[numPoints] > full[degree]))
+        return 1;
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int NurbsSpanFind
+(
+const double *u,   /* I: full knot vector */
+int degree,        /* I: degree */
+int numPoints,     /* I: number of control points */
+double t,          /* I: parameter value inside the domain */
+int hint           /* I: span of the previous parameter, or -1 */
+)
+/*
+DESCRIPTION:
+   Find the knot span index "i" with knots[i] <= t < knots[i+1]. The span
+found for the previous parameter and its successor are tried first, so a
+sorted parameter list costs one or two compares per value.
+*/
+{
+    const int n = numPoints - 1;
+
+    if (t >= u[n + 1])
+        return n;
+    if (t <= u[degree])
+        return degree;
+
+    if (hint >= degree && hint <= n)
+    {
+        if (u[hint] <= t && t < u[hint + 1])
+            return hint;
+        if (hint < n && u[hint + 1] <= t && t < u[hint + 2])
+            return hint + 1;
+    }
+
+    int low = degree, high = n + 1;
+    int mid = (low + high) / 2;
+    while (t < u[mid] || t >= u[mid + 1])
+    {
+        if (t < u[mid])
+            high = mid;
+        else
+            low = mid;
+        mid = (low + high) / 2;
+    }
+    return mid;
+}
+
+/*******************************************************************/
+/* Function definition */
+void NurbsBasisDerivatives
+(
+const double *u,   /* I: full knot vector */
+int degree,        /* I: degree */
+int span,          /* I: knot span index */
+double t,          /* I: parameter value */
+int level,         /* I: highest derivative level (0~3) */
+double *ders       /* O: ders[k * NURBS_EVAL_MAX_ORDER + j], k = 0..level, j = 0..degree */
+)
+/*
+DESCRIPTION:
+   Non-zero basis functions and their derivatives on a knot span
+(The NURBS Book, algorithms A2.2 and A2.3). Derivatives above the degree
+are zero.
+*/
+{
+    const int p = degree;
+    double left[NURBS_EVAL_MAX_ORDER], right[NURBS_EVAL_MAX_ORDER];
+
+    if (level == 0)
+    {
+        double *n = ders;
+        n[0] = 1.0;
+        for (int j = 1; j <= p; j++)
+        {
+            left[j] = t - u[span + 1 - j];
+            right[j] = u[span + j] - t;
+            double saved = 0.0;
+            for (int r = 0; r < j; r++)
+            {
+                const double temp = n[r] / (right[r + 1] + left[j - r]);
+                n[r] = saved + right[r + 1] * temp;
+                saved = left[j - r] * temp;
+            }
+            n[j] = saved;
+        }
+        return;
+    }
+
+    double ndu[NURBS_EVAL_MAX_ORDER][NURBS_EVAL_MAX_ORDER];
+    double a[2][NURBS_EVAL_MAX_ORDER];
+    const int levelNonZero = level < p ? level : p;
+
+    ndu[0][0] = 1.0;
+    for (int j = 1; j <= p; j++)
+    {
+        left[j] = t - u[span + 1 - j];
+        right[j] = u[span + j] - t;
+        double saved = 0.0;
+        for (int r = 0; r < j; r++)
+        {
+            ndu[j][r] = right[r + 1] + left[j - r];
+            const double temp = ndu[r][j - 1] / ndu[j][r];
+            ndu[r][j] = saved + right[r + 1] * temp;
+            saved = left[j - r] * temp;
+        }
+        ndu[j][j] = saved;
+    }
+
+    for (int j = 0; j <= p; j++)
+        ders[j] = ndu[j][p];
+
+    for (int r = 0; r <= p; r++)
+    {
+        int s1 = 0, s2 = 1;
+        a[0][0] = 1.0;
+        for (int k = 1; k <= levelNonZero; k++)
+        {
+            double d = 0.0;
+            const int rk = r - k, pk = p - k;
+            if (r >= k)
+            {
+                a[s2][0] = a[s1][0] / ndu[pk + 1][rk];
+                d = a[s2][0] * ndu[rk][pk];
+            }
+            const int j1 = rk >= -1 ? 1 : -rk;
+            const int j2 = (r - 1 <= pk) ? k - 1 : p - r;
+            for (int j = j1; j <= j2; j++)
+            {
+                a[s2][j] = (a[s1][j] - a[s1][j - 1]) / ndu[pk + 1][rk + j];
+                d += a[s2][j] * ndu[rk + j][pk];
+            }
+            if (r <= pk)
+            {
+                a[s2][k] = -a[s1][k - 1] / ndu[pk + 1][r];
+                d += a[s2][k] * ndu[r][pk];
+            }
+            ders[k * NURBS_EVAL_MAX_ORDER + r] = d;
+            const int swap = s1;
+            s1 = s2;
+            s2 = swap;
+        }
+    }
+
+    double factor = p;
+    for (int k = 1; k <= levelNonZero; k++)
+    {
+        for (int j = 0; j <= p; j++)
+            ders[k * NURBS_EVAL_MAX_ORDER + j] *= factor;
+        factor *= (p - k);
+    }
+    for (int k = levelNonZero + 1; k <= level; k++)
+    {
+        for (int j = 0; j <= p; j++)
+            ders[k * NURBS_EVAL_MAX_ORDER + j] = 0.0;
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+NurbsCurveEvaluator::NurbsCurveEvaluator()
+    : m_degree(0), m_closed(0), m_rational(0), m_dimension(0), m_numPoints(0),
+      m_domain(), m_kernel(NurbsEval_Scalar)
+/*
+DESCRIPTION:
+   Create an empty evaluator, Init() must be called before evaluating.
+*/
+{
+}
+
+/*******************************************************************/
+/* Function definition */
+int NurbsCurveEvaluator::Init
+(
+const svxParameters &knots,     /* I: knot data (svxCurve::T) */
+const svxControlPoints &points  /* I: control point data (svxCurve::P) */
+)
+/*
+DESCRIPTION:
+   Copy the NURBS data of a curve into the evaluator.
+
+   Return 1 if the curve data is not supported, else 0.
+*/
+{
+    return Setup(knots.closed, knots.degree, knots.num_knots, knots.knots,
+        points.rat, points.dim, points.num_cp, points.coord);
+}
+
+/*******************************************************************/
+/* Function definition */
+int NurbsCurveEvaluator::Init
+(
+const szwNurbsParameter &knots,     /* I: knot data (szwCurve::parameter) */
+const szwNurbsControlPoint &points  /* I: control point data (szwCurve::controlPoint) */
+)
+/*
+DESCRIPTION:
+   Copy the NURBS data of a curve returned by ZwCurveNURBSDataGet() into
+the evaluator.
+
+   Return 1 if the curve data is not supported, else 0.
+*/
+{
+    return Setup(knots.closed, knots.degree, knots.numberKnots, knots.knots,
+        points.rational, points.numberCoordinate, points.numberControlPoint, points.controlPointCoordinate);
+}
+
+/*******************************************************************/
+/* Function definition */
+int NurbsCurveEvaluator::Init
+(
+const svxCurve &curve  /* I: curve data with NURBS representation */
+)
+/*
+DESCRIPTION:
+   Copy the NURBS data of a curve returned by cvxPartInqCurve() with
+"Nurb" = 1 into the evaluator.
+
+   Return 1 if the curve data is not supported, else 0.
+*/
+{
+    if (curve.Type != VX_CRV_NURB && (curve.T.knots == nullptr || curve.P.coord == nullptr))
+        return 1;
+    return Init(curve.T, curve.P);
+}
+
+/*******************************************************************/
+/* Function definition */
+int NurbsCurveEvaluator::Setup
+(
+int closed,                 /* I: 1 if closed curve */
+int degree,                 /* I: degree of curve */
+int numKnots,               /* I: number of knots */
+const double *knots,        /* I: knot values */
+int rational,               /* I: 1 if control points are weighted */
+int dimension,              /* I: number of coordinates per control point (incl. weight) */
+int numPoints,              /* I: number of control points */
+const double *coordinates   /* I: control point coordinates */
+)
+/*
+DESCRIPTION:
+   Validate and copy curve data.
+
+   Return 1 if the data is invalid or not supported, else 0.
+*/
+{
+    m_degree = 0;
+    m_knots.clear();
+    m_points.clear();
+
+    rational = rational ? 1 : 0;
+    const int spatial = dimension - rational;
+    if (degree < 1 || degree > NURBS_EVAL_MAX_DEGREE || spatial < 1 || spatial > 3)
+        return 1;
+    if (knots == nullptr || coordinates == nullptr || numPoints < degree + 1)
+        return 1;
+
+    /* knot vector */
+    if (NurbsKnotVectorMake(degree, numPoints, numKnots, knots, m_knots))
+        return 1;
+
+    m_domain.min = m_knots[degree];
+    m_domain.max = m_knots[numPoints];
+
+    /* homogeneous control points */
+    int weighted = 0;
+    m_points.assign((size_t)numPoints * 4, 0.0);
+    for (int i = 0; i < numPoints; i++)
+    {
+        const double *src = coordinates + (size_t)i * dimension;
+        double *dst = &m_points[(size_t)i * 4];
+        for (int j = 0; j < spatial; j++)
+            dst[j] = src[j];
+        dst[3] = rational ? src[spatial] : 1.0;
+        if (dst[3] <= 0.0)
+            return 1;
+        if (dst[3] != 1.0)
+            weighted = 1;
+    }
+
+    m_closed = closed ? 1 : 0;
+    m_rational = weighted;
+    m_dimension = spatial;
+    m_numPoints = numPoints;
+    m_kernel = NurbsEvalKernelDetect();
+    m_degree = degree;
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+svxLimit NurbsCurveEvaluator::Domain
+(
+void
+) const
+/*
+DESCRIPTION:
+   Parameter range of the curve.
+*/
+{
+    return m_domain;
+}
+
+/*******************************************************************/
+/* Function definition */
+double NurbsParameterClamp
+(
+double t,          /* I: parameter value */
+svxLimit domain,   /* I: parameter range */
+int closed         /* I: 1 if the parameter wraps around */
+)
+/*
+DESCRIPTION:
+   Bring a parameter value into a parameter range. Closed curves and
+surface directions wrap around, open ones are clamped at their ends.
+*/
+{
+    if (t >= domain.min && t <= domain.max)
+        return t;
+
+    if (closed)
+    {
+        const double period = domain.max - domain.min;
+        double offset = fmod(t - domain.min, period);
+        if (offset < 0.0)
+            offset += period;
+        return domain.min + offset;
+    }
+
+    return t < domain.min ? domain.min : domain.max;
+}
+
+/*******************************************************************/
+/* Function definition */
+void NurbsCurveEvaluator::EvaluateSpan
+(
+int span,           /* I: knot span index */
+double t,           /* I: parameter value */
+int level,          /* I: level of evaluation (0~3) */
+svxEvalCurv *eval   /* O: point and derivatives */
+) const
+/*
+DESCRIPTION:
+   Evaluate the curve on a known knot span.
+*/
+{
+    double ders[(NURBS_EVAL_MAX_LEVEL + 1) * NURBS_EVAL_MAX_ORDER];
+    double hw[(NURBS_EVAL_MAX_LEVEL + 1) * 4];
+
+    NurbsBasisDerivatives(m_knots.data(), m_degree, span, t, level, ders);
+    BlendFunctionGet(m_kernel)(m_degree + 1, level, ders, &m_points[(size_t)(span - m_degree) * 4], hw);
+    HomogeneousToEval(hw, level, m_rational, eval);
+}
+
+/*******************************************************************/
+/* Function definition */
+int NurbsCurveEvaluator::Evaluate
+(
+double t,          /* I: parameter value */
+int level,         /* I: level of evaluation (0~3) */
+svxEvalCurv *eval  /* O: point and derivatives */
+) const
+/*
+DESCRIPTION:
+   Evaluate one parameter, same output as cvxCrvEval2().
+
+   Return 1 if the evaluator is not initialized or the input is invalid, else 0.
+*/
+{
+    if (!IsValid() || eval == nullptr || level < 0 || level > NURBS_EVAL_MAX_LEVEL)
+        return 1;
+
+    const double u = NurbsParameterClamp(t, m_domain, m_closed);
+    EvaluateSpan(NurbsSpanFind(m_knots.data(), m_degree, m_numPoints, u, -1), u, level, eval);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int NurbsCurveEvaluator::Evaluate
+(
+int count,           /* I: number of parameters */
+const double *t,     /* I: parameter values */
+int level,           /* I: level of evaluation (0~3) */
+svxEvalCurv *evals   /* O: point and derivatives per parameter */
+) const
+/*
+DESCRIPTION:
+   Evaluate a list of parameters. The list does not need to be sorted,
+but sorted (or locally coherent) lists reuse the previous knot span.
+
+   Return 1 if the evaluator is not initialized or the input is invalid, else 0.
+*/
+{
+    if (!IsValid() || level < 0 || level > NURBS_EVAL_MAX_LEVEL)
+        return 1;
+    if (count <= 0)
+        return 0;
+    if (t == nullptr || evals == nullptr)
+        return 1;
+
+    int span = -1;
+    for (int i = 0; i < count; i++)
+    {
+        const double u = NurbsParameterClamp(t[i], m_domain, m_closed);
+        span = NurbsSpanFind(m_knots.data(), m_degree, m_numPoints, u, span);
+        EvaluateSpan(span, u, level, &evals[i]);
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int NurbsCurveEvaluator::EvaluatePoints
+(
+int count,          /* I: number of parameters */
+const double *t,    /* I: parameter values */
+svxPoint *points    /* O: point per parameter */
+) const
+/*
+DESCRIPTION:
+   Level 0 evaluation of a list of parameters directly into a point list.
+
+   Return 1 if the evaluator is not initialized or the input is invalid, else 0.
+*/
+{
+    if (!IsValid())
+        return 1;
+    if (count <= 0)
+        return 0;
+    if (t == nullptr || points == nullptr)
+        return 1;
+
+    const NurbsBlendFunction blend = BlendFunctionGet(m_kernel);
+    double n[NURBS_EVAL_MAX_ORDER];
+    double hw[4];
+    int span = -1;
+    for (int i = 0; i < count; i++)
+    {
+        const double u = NurbsParameterClamp(t[i], m_domain, m_closed);
+        span = NurbsSpanFind(m_knots.data(), m_degree, m_numPoints, u, span);
+        NurbsBasisDerivatives(m_knots.data(), m_degree, span, u, 0, n);
+        blend(m_degree + 1, 0, n, &m_points[(size_t)(span - m_degree) * 4], hw);
+        const double inv = m_rational ? 1.0 / hw[3] : 1.0;
+        points[i].x = hw[0] * inv;
+        points[i].y = hw[1] * inv;
+        points[i].z = hw[2] * inv;
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void HomogeneousToEval
+(
+const double *hw,   /* I: homogeneous derivatives, 4 doubles per level */
+int level,          /* I: level of evaluation (0~3) */
+int rational,       /* I: 1 if weights must be divided out */
+svxEvalCurv *eval   /* O: point and derivatives */
+)
+/*
+DESCRIPTION:
+   Convert derivatives of the homogeneous curve into derivatives of the
+projected curve (The NURBS Book, algorithm A4.2).
+*/
+{
+    double c[NURBS_EVAL_MAX_LEVEL + 1][3] = {};
+
+    if (!rational)
+    {
+        for (int k = 0; k <= level; k++)
+        {
+            c[k][0] = hw[k * 4 + 0];
+            c[k][1] = hw[k * 4 + 1];
+            c[k][2] = hw[k * 4 + 2];
+        }
+    }
+    else
+    {
+        static const double binomial[NURBS_EVAL_MAX_LEVEL + 1][NURBS_EVAL_MAX_LEVEL + 1] =
+        {
+            { 1.0, 0.0, 0.0, 0.0 },
+            { 1.0, 1.0, 0.0, 0.0 },
+            { 1.0, 2.0, 1.0, 0.0 },
+            { 1.0, 3.0, 3.0, 1.0 },
+        };
+        const double invW = 1.0 / hw[3];
+        for (int k = 0; k <= level; k++)
+        {
+            for (int d = 0; d < 3; d++)
+            {
+                double v = hw[k * 4 + d];
+                for (int i = 1; i <= k; i++)
+                    v -= binomial[k][i] * hw[i * 4 + 3] * c[k - i][d];
+                c[k][d] = v * invW;
+            }
+        }
+    }
+
+    eval->level = level;
+    eval->pnt.x = c[0][0];     eval->pnt.y = c[0][1];     eval->pnt.z = c[0][2];
+    eval->deriv_1.x = c[1][0]; eval->deriv_1.y = c[1][1]; eval->deriv_1.z = c[1][2];
+    eval->deriv_2.x = c[2][0]; eval->deriv_2.y = c[2][1]; eval->deriv_2.z = c[2][2];
+    eval->deriv_3.x = c[3][0]; eval->deriv_3.y = c[3][1]; eval->deriv_3.z = c[3][2];
+}
+
+/*******************************************************************/
+/* Function definition */
+NurbsBlendFunction BlendFunctionGet
+(
+NurbsEvalKernel kernel  /* I: blending kernel */
+)
+/*
+DESCRIPTION:
+   Map a kernel id onto its function.
+*/
+{
+#if defined(NURBS_EVAL_X64)
+    if (kernel == NurbsEval_Avx2)
+        return BlendAvx2;
+#endif
+#if defined(NURBS_EVAL_ARM64)
+    if (kernel == NurbsEval_Neon)
+        return BlendNeon;
+#endif
+    return BlendScalar;
+}
+
+/*******************************************************************/
+/* Function definition */
+void BlendScalar
+(
+int order,              /* I: number of control points on the span (degree + 1) */
+int levels,             /* I: highest derivative level */
+const double *ders,     /* I: basis derivatives, NURBS_EVAL_MAX_ORDER per level */
+const double *points,   /* I: first homogeneous control point of the span */
+double *out             /* O: homogeneous derivatives, 4 doubles per level */
+)
+/*
+DESCRIPTION:
+   Portable blending kernel.
+*/
+{
+    for (int k = 0; k <= levels; k++)
+    {
+        const double *n = ders + k * NURBS_EVAL_MAX_ORDER;
+        double x = 0.0, y = 0.0, z = 0.0, w = 0.0;
+        for (int j = 0; j < order; j++)
+        {
+            const double *p = points + j * 4;
+            x += n[j] * p[0];
+            y += n[j] * p[1];
+            z += n[j] * p[2];
+            w += n[j] * p[3];
+        }
+        out[k * 4 + 0] = x;
+        out[k * 4 + 1] = y;
+        out[k * 4 + 2] = z;
+        out[k * 4 + 3] = w;
+    }
+}
+
+#if defined(NURBS_EVAL_X64)
+/*******************************************************************/
+/* Function definition */
+NURBS_EVAL_AVX2_TARGET void BlendAvx2
+(
+int order,              /* I: number of control points on the span (degree + 1) */
+int levels,             /* I: highest derivative level */
+const double *ders,     /* I: basis derivatives, NURBS_EVAL_MAX_ORDER per level */
+const double *points,   /* I: first homogeneous control point of the span */
+double *out             /* O: homogeneous derivatives, 4 doubles per level */
+)
+/*
+DESCRIPTION:
+   AVX2 blending kernel: one (wx,wy,wz,w) control point per register, each
+control point is loaded once and accumulated into every requested level.
+*/
+{
+    __m256d acc0 = _mm256_setzero_pd();
+    __m256d acc1 = _mm256_setzero_pd();
+    __m256d acc2 = _mm256_setzero_pd();
+    __m256d acc3 = _mm256_setzero_pd();
+
+    switch (levels)
+    {
+        case 0:
+            for (int j = 0; j < order; j++)
+                acc0 = _mm256_fmadd_pd(_mm256_set1_pd(ders[j]), _mm256_loadu_pd(points + j * 4), acc0);
+            break;
+        case 1:
+            for (int j = 0; j < order; j++)
+            {
+                const __m256d p = _mm256_loadu_pd(points + j * 4);
+                acc0 = _mm256_fmadd_pd(_mm256_set1_pd(ders[j]), p, acc0);
+                acc1 = _mm256_fmadd_pd(_mm256_set1_pd(ders[NURBS_EVAL_MAX_ORDER + j]), p, acc1);
+            }
+            break;
+        case 2:
+            for (int j = 0; j < order; j++)
+            {
+                const __m256d p = _mm256_loadu_pd(points + j * 4);
+                acc0 = _mm256_fmadd_pd(_mm256_set1_pd(ders[j]), p, acc0);
+                acc1 = _mm256_fmadd_pd(_mm256_set1_pd(ders[NURBS_EVAL_MAX_ORDER + j]), p, acc1);
+                acc2 = _mm256_fmadd_pd(_mm256_set1_pd(ders[2 * NURBS_EVAL_MAX_ORDER + j]), p, acc2);
+            }
+            break;
+        default:
+            for (int j = 0; j < order; j++)
+            {
+                const __m256d p = _mm256_loadu_pd(points + j * 4);
+                acc0 = _mm256_fmadd_pd(_mm256_set1_pd(ders[j]), p, acc0);
+                acc1 = _mm256_fmadd_pd(_mm256_set1_pd(ders[NURBS_EVAL_MAX_ORDER + j]), p, acc1);
+                acc2 = _mm256_fmadd_pd(_mm256_set1_pd(ders[2 * NURBS_EVAL_MAX_ORDER + j]), p, acc2);
+                acc3 = _mm256_fmadd_pd(_mm256_set1_pd(ders[3 * NURBS_EVAL_MAX_ORDER + j]), p, acc3);
+            }
+            break;
+    }
+
+    _mm256_storeu_pd(out, acc0);
+    if (levels >= 1)
+        _mm256_storeu_pd(out + 4, acc1);
+    if (levels >= 2)
+        _mm256_storeu_pd(out + 8, acc2);
+    if (levels >= 3)
+        _mm256_storeu_pd(out + 12, acc3);
+}
+#endif
+
+#if defined(NURBS_EVAL_ARM64)
+/*******************************************************************/
+/* Function definition */
+void BlendNeon
+(
+int order,              /* I: number of control points on the span (degree + 1) */
+int levels,             /* I: highest derivative level */
+const double *ders,     /* I: basis derivatives, NURBS_EVAL_MAX_ORDER per level */
+const double *points,   /* I: first homogeneous control point of the span */
+double *out             /* O: homogeneous derivatives, 4 doubles per level */
+)
+/*
+DESCRIPTION:
+   NEON blending kernel: one control point is two (wx,wy) (wz,w) registers.
+*/
+{
+    for (int k = 0; k <= levels; k++)
+    {
+        const double *n = ders + k * NURBS_EVAL_MAX_ORDER;
+        float64x2_t xy = vdupq_n_f64(0.0);
+        float64x2_t zw = vdupq_n_f64(0.0);
+        for (int j = 0; j < order; j++)
+        {
+            const float64x2_t b = vdupq_n_f64(n[j]);
+            xy = vfmaq_f64(xy, b, vld1q_f64(points + j * 4));
+            zw = vfmaq_f64(zw, b, vld1q_f64(points + j * 4 + 2));
+        }
+        vst1q_f64(out + k * 4, xy);
+        vst1q_f64(out + k * 4 + 2, zw);
+    }
+}
+#endif
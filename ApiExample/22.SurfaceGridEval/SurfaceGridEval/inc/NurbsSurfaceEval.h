@@ -0,0 +1,94 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+#pragma once
+
+/* ZW3D API includes */
+#include "zwapi_util.h"
+#include "zwapi_brep_data.h"
+
+/* Application includes */
+#include <vector>
+#include "NurbsCurveEval.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define SURFACE_EVAL_L2_BYTES (256 * 1024)  /* default cache budget of the tiled grid mode */
+
+/*******************************************************************/
+/* Data type definitions */
+/*
+DESCRIPTION:
+   Structure-of-arrays output of the surface evaluator. Sample "k" of a
+grid of numU x numV parameters is k = iv * numU + iu (rows of constant V).
+*/
+struct SurfaceSamples
+{
+    int count;                       /* number of samples */
+    std::vector<double> x, y, z;     /* point on surface */
+    std::vector<double> nx, ny, nz;  /* unit normal (outward, as cvxSrfEval), 0 at degenerate points */
+    std::vector<double> ux, uy, uz;  /* first partial derivative w/r u */
+    std::vector<double> vx, vy, vz;  /* first partial derivative w/r v */
+
+    SurfaceSamples() : count(0) {}
+    void Resize(int number);
+};
+
+/*
+DESCRIPTION:
+   Host-independent batch evaluator of a tensor-product NURBS surface
+(svxSurface / szwSurface, control points ordered with U varying fastest).
+
+   Grids are evaluated row by row: the V basis functions of a row contract
+the control net into one homogeneous control polygon (and its V
+derivative) once, and the U basis functions of every column, computed once
+for the whole grid, blend that polygon. The column blend processes four
+columns per AVX2 instruction (two with NEON), gathering the polygon points
+of each column's knot span.
+
+   For very large grids the columns are split into tiles whose U basis
+tables fit into the given cache budget; every tile sweeps all rows, so the
+basis tables and the contracted polygon stay resident in L2.
+
+   Normals follow cvxSrfEval(): the natural normal Su x Sv is reversed when
+the surface's "OutNormal" flag is 0.
+*/
+class NurbsSurfaceEvaluator
+{
+public:
+    NurbsSurfaceEvaluator();
+
+    int Init(const svxSurface &surface);
+    int Init(const szwSurface &surface);
+
+    int EvaluateGrid(int numU, const double *u, int numV, const double *v, SurfaceSamples *out) const;
+    int EvaluateGridTiled(int numU, const double *u, int numV, const double *v, int cacheBytes,
+        SurfaceSamples *out) const;
+    int EvaluateList(int count, const double *u, const double *v, SurfaceSamples *out) const;
+    int Evaluate(double u, double v, svxPoint *point, svxVector *normal, svxVector *uTangent,
+        svxVector *vTangent) const;
+
+    int IsValid(void) const { return m_degreeU > 0; }
+    svxLimit DomainU(void) const { return m_domainU; }
+    svxLimit DomainV(void) const { return m_domainV; }
+    int TileColumns(int cacheBytes) const;
+    NurbsEvalKernel Kernel(void) const { return m_kernel; }
+
+private:
+    int Setup(int outNormal, int closedU, int degreeU, int numKnotsU, const double *knotsU,
+        int closedV, int degreeV, int numKnotsV, const double *knotsV,
+        int rational, int dimension, int numPoints, const double *coordinates);
+    void EvaluateColumns(int c0, int c1, int numU, const double *u, int numV, const double *v,
+        SurfaceSamples *out) const;
+
+    int m_degreeU, m_degreeV;        /* degrees, 0 if not initialized */
+    int m_numU, m_numV;              /* control points in U and V */
+    int m_closedU, m_closedV;        /* 1 if the parameter wraps around */
+    int m_flipNormal;                /* 1 if the natural normal points inward */
+    svxLimit m_domainU, m_domainV;   /* parameter ranges */
+    std::vector<double> m_knotsU;    /* full knot vector in U */
+    std::vector<double> m_knotsV;    /* full knot vector in V */
+    std::vector<double> m_points;    /* homogeneous control points, 4 doubles each, U fastest */
+    NurbsEvalKernel m_kernel;        /* column kernel selected for this cpu */
+};
@@ -0,0 +1,14 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+#pragma once
+
+/* ZW3D API includes */
+#include "zwapi_command.h"
+#include "zwapi_memory.h"
+#include "zwapi_message.h"
+
+/* Function declaration */
+int RegisterSurfaceGridEval(void);
+int UnloadSurfaceGridEval(void);
@@ -0,0 +1,751 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* Application includes */
+#include <limits.h>
+#include <math.h>
+#include "..\inc\NurbsSurfaceEval.h"
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define SURFACE_EVAL_X64 1
+#include <immintrin.h>
+#elif defined(_M_ARM64) || defined(__aarch64__)
+#define SURFACE_EVAL_ARM64 1
+#include <arm_neon.h>
+#endif
+
+/* MSVC accepts AVX2 intrinsics in any function, gcc/clang need the target attribute */
+#if defined(SURFACE_EVAL_X64) && (defined(__GNUC__) || defined(__clang__))
+#define SURFACE_EVAL_AVX2_TARGET __attribute__((target("avx2,fma")))
+#else
+#define SURFACE_EVAL_AVX2_TARGET
+#endif
+
+/*******************************************************************/
+/* Constant definitions */
+#define SURFACE_NORMAL_MIN 1.0e-30   /* |Su x Sv| below this is a degenerate point */
+#define SURFACE_OUT_ARRAYS 12        /* x,y,z, nx,ny,nz, ux,uy,uz, vx,vy,vz */
+
+/*******************************************************************/
+/* Data type definitions */
+/*
+DESCRIPTION:
+   Input of the column kernel for one row of one tile.
+*/
+struct SurfaceColumnBlock
+{
+    int count;            /* number of columns */
+    int order;            /* U order (degree + 1) */
+    const int *span;      /* per column: index of the first polygon point in "q" */
+    const double *n;      /* U basis, n[a * stride + column] */
+    const double *dn;     /* U basis derivative, same layout */
+    int stride;           /* row length of "n" and "dn" */
+    const double *q;      /* polygon of the row, q[component * width + i], components S(xyzw), dS/dv(xyzw) */
+    int width;            /* number of polygon points */
+    double sign;          /* 1, or -1 to reverse the normal */
+    double *out[SURFACE_OUT_ARRAYS];  /* output arrays positioned at the first column */
+};
+
+typedef void (*SurfaceColumnFunction)(const SurfaceColumnBlock &block);
+
+/*******************************************************************/
+/* Function declarations */
+static void ColumnsScalar(const SurfaceColumnBlock &block);
+#if defined(SURFACE_EVAL_X64)
+static void ColumnsAvx2(const SurfaceColumnBlock &block);
+#endif
+#if defined(SURFACE_EVAL_ARM64)
+static void ColumnsNeon(const SurfaceColumnBlock &block);
+#endif
+static void SampleStore(const double s[4], const double su[4], const double sv[4], double sign,
+    double *const out[SURFACE_OUT_ARRAYS], int k);
+
+/*******************************************************************/
+/* Function definition */
+void SurfaceSamples::Resize
+(
+int number  /* I: number of samples */
+)
+/*
+DESCRIPTION:
+   Size all output arrays for "number" samples.
+*/
+{
+    count = number;
+    std::vector<double> *arrays[SURFACE_OUT_ARRAYS] = { &x, &y, &z, &nx, &ny, &nz, &ux, &uy, &uz, &vx, &vy, &vz };
+    for (int i = 0; i < SURFACE_OUT_ARRAYS; i++)
+        arrays[i]->resize(number);
+}
+
+/*******************************************************************/
+/* Function definition */
+NurbsSurfaceEvaluator::NurbsSurfaceEvaluator()
+    : m_degreeU(0), m_degreeV(0), m_numU(0), m_numV(0), m_closedU(0), m_closedV(0),
+      m_flipNormal(0), m_domainU(), m_domainV(), m_kernel(NurbsEval_Scalar)
+/*
+DESCRIPTION:
+   Create an empty evaluator, Init() must be called before evaluating.
+*/
+{
+}
+
+/*******************************************************************/
+/* Function definition */
+int NurbsSurfaceEvaluator::Init
+(
+const svxSurface &surface  /* I: surface data (cvxPartInqFaceSrf) */
+)
+/*
+DESCRIPTION:
+   Copy the NURBS data of a surface into the evaluator.
+
+   Return 1 if the surface data is not supported, else 0.
+*/
+{
+    return Setup(surface.OutNormal,
+        surface.U.closed, surface.U.degree, surface.U.num_knots, surface.U.knots,
+        surface.V.closed, surface.V.degree, surface.V.num_knots, surface.V.knots,
+        surface.P.rat, surface.P.dim, surface.P.num_cp, surface.P.coord);
+}
+
+/*******************************************************************/
+/* Function definition */
+int NurbsSurfaceEvaluator::Init
+(
+const szwSurface &surface  /* I: surface data (ZwFaceSurfaceDataGet) */
+)
+/*
+DESCRIPTION:
+   Copy the NURBS data of a surface into the evaluator.
+
+   Return 1 if the surface data is not supported, else 0.
+*/
+{
+    return Setup(surface.outNormal,
+        surface.U.closed, surface.U.degree, surface.U.numberKnots, surface.U.knots,
+        surface.V.closed, surface.V.degree, surface.V.numberKnots, surface.V.knots,
+        surface.P.rational, surface.P.numberCoordinate, surface.P.numberControlPoint,
+        surface.P.controlPointCoordinate);
+}
+
+/*******************************************************************/
+/* Function definition */
+int NurbsSurfaceEvaluator::Setup
+(
+int outNormal,              /* I: 1 if natural normal points outward */
+int closedU,                /* I: 1 if closed in U */
+int degreeU,                /* I: degree in U */
+int numKnotsU,              /* I: number of knots in U */
+const double *knotsU,       /* I: knots in U */
+int closedV,                /* I: 1 if closed in V */
+int degreeV,                /* I: degree in V */
+int numKnotsV,              /* I: number of knots in V */
+const double *knotsV,       /* I: knots in V */
+int rational,               /* I: 1 if control points are weighted */
+int dimension,              /* I: number of coordinates per control point (incl. weight) */
+int numPoints,              /* I: number of control points */
+const double *coordinates   /* I: control point coordinates */
+)
+/*
+DESCRIPTION:
+   Validate and copy surface data. The number of control points in each
+direction follows from the number of knots and the degree.
+
+   Return 1 if the data is invalid or not supported, else 0.
+*/
+{
+    m_degreeU = 0;
+    m_points.clear();
+
+    rational = rational ? 1 : 0;
+    const int spatial = dimension - rational;
+    if (spatial != 3 || coordinates == nullptr)
+        return 1;
+    if (degreeU < 1 || degreeU > NURBS_EVAL_MAX_DEGREE || degreeV < 1 || degreeV > NURBS_EVAL_MAX_DEGREE)
+        return 1;
+
+    /* the knot count is n + p + 1 (full) or n + p - 1 (abbreviated) */
+    int numU = numKnotsU - degreeU - 1, numV = numKnotsV - degreeV - 1;
+    if (numU < 1 || numV < 1 || (long long)numU * numV != numPoints)
+    {
+        numU += 2;
+        numV += 2;
+    }
+    if (numU < 1 || numV < 1 || (long long)numU * numV != numPoints)
+        return 1;
+
+    if (NurbsKnotVectorMake(degreeU, numU, numKnotsU, knotsU, m_knotsU) ||
+        NurbsKnotVectorMake(degreeV, numV, numKnotsV, knotsV, m_knotsV))
+        return 1;
+
+    m_points.assign((size_t)numPoints * 4, 0.0);
+    for (int i = 0; i < numPoints; i++)
+    {
+        const double *src = coordinates + (size_t)i * dimension;
+        double *dst = &m_points[(size_t)i * 4];
+        dst[0] = src[0];
+        dst[1] = src[1];
+        dst[2] = src[2];
+        dst[3] = rational ? src[3] : 1.0;
+        if (dst[3] <= 0.0)
+        {
+            m_points.clear();
+            return 1;
+        }
+    }
+
+    m_numU = numU;
+    m_numV = numV;
+    m_closedU = closedU ? 1 : 0;
+    m_closedV = closedV ? 1 : 0;
+    m_flipNormal = outNormal ? 0 : 1;
+    m_domainU.min = m_knotsU[degreeU];
+    m_domainU.max = m_knotsU[numU];
+    m_domainV.min = m_knotsV[degreeV];
+    m_domainV.max = m_knotsV[numV];
+    m_degreeV = degreeV;
+    m_kernel = NurbsEvalKernelDetect();
+    m_degreeU = degreeU;
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int NurbsSurfaceEvaluator::TileColumns
+(
+int cacheBytes  /* I: cache budget in bytes */
+) const
+/*
+DESCRIPTION:
+   Number of grid columns per tile such that the U basis tables and the
+contracted control polygon of a tile use about half of "cacheBytes" (the
+other half is left to the output rows being written).
+*/
+{
+    if (cacheBytes <= 0)
+        cacheBytes = SURFACE_EVAL_L2_BYTES;
+
+    const int polygonBytes = m_numU * 8 * (int)sizeof(double);
+    const int columnBytes = 2 * (m_degreeU + 1) * (int)sizeof(double) + (int)sizeof(int);
+    int columns = (cacheBytes / 2 - polygonBytes) / columnBytes;
+    if (columns < 64)
+        columns = 64;
+    return columns & ~3;
+}
+
+/*******************************************************************/
+/* Function definition */
+int NurbsSurfaceEvaluator::EvaluateGrid
+(
+int numU,             /* I: number of U parameters (columns) */
+const double *u,      /* I: U parameters */
+int numV,             /* I: number of V parameters (rows) */
+const double *v,      /* I: V parameters */
+SurfaceSamples *out   /* O: numU * numV samples, rows of constant V */
+) const
+/*
+DESCRIPTION:
+   Evaluate a full UV grid in one sweep.
+
+   Return 1 if the evaluator is not initialized, the input is invalid or
+the grid has more than INT_MAX samples, else 0.
+*/
+{
+    if (!IsValid() || out == nullptr || numU < 0 || numV < 0 || (long long)numU * numV > INT_MAX)
+        return 1;
+    if ((numU > 0 && u == nullptr) || (numV > 0 && v == nullptr))
+        return 1;
+
+    out->Resize(numU * numV);
+    if (numU > 0 && numV > 0)
+        EvaluateColumns(0, numU, numU, u, numV, v, out);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int NurbsSurfaceEvaluator::EvaluateGridTiled
+(
+int numU,             /* I: number of U parameters (columns) */
+const double *u,      /* I: U parameters */
+int numV,             /* I: number of V parameters (rows) */
+const double *v,      /* I: V parameters */
+int cacheBytes,       /* I: cache budget per tile (0 = SURFACE_EVAL_L2_BYTES) */
+SurfaceSamples *out   /* O: numU * numV samples, rows of constant V */
+) const
+/*
+DESCRIPTION:
+   Evaluate a full UV grid tile by tile. Same result as EvaluateGrid().
+
+   Return 1 if the evaluator is not initialized, the input is invalid or
+the grid has more than INT_MAX samples, else 0.
+*/
+{
+    if (!IsValid() || out == nullptr || numU < 0 || numV < 0 || (long long)numU * numV > INT_MAX)
+        return 1;
+    if ((numU > 0 && u == nullptr) || (numV > 0 && v == nullptr))
+        return 1;
+
+    out->Resize(numU * numV);
+    if (numU == 0 || numV == 0)
+        return 0;
+
+    const int tile = TileColumns(cacheBytes);
+    for (int c0 = 0; c0 < numU; c0 += tile)
+    {
+        const int c1 = c0 + tile < numU ? c0 + tile : numU;
+        EvaluateColumns(c0, c1, numU, u, numV, v, out);
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void NurbsSurfaceEvaluator::EvaluateColumns
+(
+int c0,               /* I: first column of the tile */
+int c1,               /* I: end of the tile (exclusive) */
+int numU,             /* I: number of U parameters (grid row length) */
+const double *u,      /* I: U parameters */
+int numV,             /* I: number of V parameters */
+const double *v,      /* I: V parameters */
+SurfaceSamples *out   /* O: samples */
+) const
+/*
+DESCRIPTION:
+   Evaluate columns c0..c1-1 of every row of the grid.
+*/
+{
+    const int p = m_degreeU, q = m_degreeV;
+    const int columns = c1 - c0;
+    double ders[(NURBS_EVAL_MAX_LEVEL + 1) * NURBS_EVAL_MAX_ORDER];
+
+    /* U basis of the tile, transposed so that consecutive columns are adjacent */
+    std::vector<int> span(columns);
+    std::vector<double> n((size_t)(p + 1) * columns), dn((size_t)(p + 1) * columns);
+    int spanMin = m_numU, spanMax = 0, hint = -1;
+    for (int c = 0; c < columns; c++)
+    {
+        const double t = NurbsParameterClamp(u[c0 + c], m_domainU, m_closedU);
+        hint = NurbsSpanFind(m_knotsU.data(), p, m_numU, t, hint);
+        NurbsBasisDerivatives(m_knotsU.data(), p, hint, t, 1, ders);
+        for (int a = 0; a <= p; a++)
+        {
+            n[(size_t)a * columns + c] = ders[a];
+            dn[(size_t)a * columns + c] = ders[NURBS_EVAL_MAX_ORDER + a];
+        }
+        span[c] = hint;
+        spanMin = hint < spanMin ? hint : spanMin;
+        spanMax = hint > spanMax ? hint : spanMax;
+    }
+
+    /* only the control point columns used by the tile are contracted */
+    const int first = spanMin - p;
+    const int width = spanMax - first + 1;
+    for (int c = 0; c < columns; c++)
+        span[c] -= spanMin;
+    std::vector<double> polygon((size_t)8 * width);
+
+    SurfaceColumnBlock block;
+    block.count = columns;
+    block.order = p + 1;
+    block.span = span.data();
+    block.n = n.data();
+    block.dn = dn.data();
+    block.stride = columns;
+    block.q = polygon.data();
+    block.width = width;
+    block.sign = m_flipNormal ? -1.0 : 1.0;
+
+    SurfaceColumnFunction kernel = ColumnsScalar;
+#if defined(SURFACE_EVAL_X64)
+    if (m_kernel == NurbsEval_Avx2)
+        kernel = ColumnsAvx2;
+#endif
+#if defined(SURFACE_EVAL_ARM64)
+    if (m_kernel == NurbsEval_Neon)
+        kernel = ColumnsNeon;
+#endif
+
+    double *arrays[SURFACE_OUT_ARRAYS] = { out->x.data(), out->y.data(), out->z.data(),
+        out->nx.data(), out->ny.data(), out->nz.data(), out->ux.data(), out->uy.data(), out->uz.data(),
+        out->vx.data(), out->vy.data(), out->vz.data() };
+
+    hint = -1;
+    for (int r = 0; r < numV; r++)
+    {
+        /* contract the control net with the V basis of the row */
+        const double t = NurbsParameterClamp(v[r], m_domainV, m_closedV);
+        hint = NurbsSpanFind(m_knotsV.data(), q, m_numV, t, hint);
+        NurbsBasisDerivatives(m_knotsV.data(), q, hint, t, 1, ders);
+
+        double *qs = polygon.data();
+        for (int i = 0; i < 8 * width; i++)
+            qs[i] = 0.0;
+        for (int b = 0; b <= q; b++)
+        {
+            const double nv = ders[b], dnv = ders[NURBS_EVAL_MAX_ORDER + b];
+            const double *row = &m_points[((size_t)(hint - q + b) * m_numU + first) * 4];
+            for (int i = 0; i < width; i++)
+            {
+                const double *cp = row + (size_t)i * 4;
+                for (int k = 0; k < 4; k++)
+                {
+                    qs[k * width + i] += nv * cp[k];
+                    qs[(4 + k) * width + i] += dnv * cp[k];
+                }
+            }
+        }
+
+        /* blend the polygon for every column of the tile */
+        const size_t offset = (size_t)r * numU + c0;
+        for (int k = 0; k < SURFACE_OUT_ARRAYS; k++)
+            block.out[k] = arrays[k] + offset;
+        kernel(block);
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+int NurbsSurfaceEvaluator::EvaluateList
+(
+int count,            /* I: number of samples */
+const double *u,      /* I: U parameter per sample */
+const double *v,      /* I: V parameter per sample */
+SurfaceSamples *out   /* O: samples */
+) const
+/*
+DESCRIPTION:
+   Evaluate an arbitrary list of UV pairs. The knot spans of the previous
+pair are used as the search hints.
+
+   Return 1 if the evaluator is not initialized or the input is invalid, else 0.
+*/
+{
+    if (!IsValid() || out == nullptr || count < 0)
+        return 1;
+    if (count > 0 && (u == nullptr || v == nullptr))
+        return 1;
+
+    out->Resize(count);
+    double *arrays[SURFACE_OUT_ARRAYS] = { out->x.data(), out->y.data(), out->z.data(),
+        out->nx.data(), out->ny.data(), out->nz.data(), out->ux.data(), out->uy.data(), out->uz.data(),
+        out->vx.data(), out->vy.data(), out->vz.data() };
+
+    const int p = m_degreeU, q = m_degreeV;
+    const double sign = m_flipNormal ? -1.0 : 1.0;
+    double du[(NURBS_EVAL_MAX_LEVEL + 1) * NURBS_EVAL_MAX_ORDER];
+    double dv[(NURBS_EVAL_MAX_LEVEL + 1) * NURBS_EVAL_MAX_ORDER];
+    int hintU = -1, hintV = -1;
+
+    for (int k = 0; k < count; k++)
+    {
+        const double s = NurbsParameterClamp(u[k], m_domainU, m_closedU);
+        const double t = NurbsParameterClamp(v[k], m_domainV, m_closedV);
+        hintU = NurbsSpanFind(m_knotsU.data(), p, m_numU, s, hintU);
+        hintV = NurbsSpanFind(m_knotsV.data(), q, m_numV, t, hintV);
+        NurbsBasisDerivatives(m_knotsU.data(), p, hintU, s, 1, du);
+        NurbsBasisDerivatives(m_knotsV.data(), q, hintV, t, 1, dv);
+
+        double sw[4] = {}, suw[4] = {}, svw[4] = {};
+        for (int b = 0; b <= q; b++)
+        {
+            const double *row = &m_points[((size_t)(hintV - q + b) * m_numU + hintU - p) * 4];
+            double r[4] = {}, ru[4] = {};
+            for (int a = 0; a <= p; a++)
+            {
+                const double *cp = row + (size_t)a * 4;
+                for (int c = 0; c < 4; c++)
+                {
+                    r[c] += du[a] * cp[c];
+                    ru[c] += du[NURBS_EVAL_MAX_ORDER + a] * cp[c];
+                }
+            }
+            for (int c = 0; c < 4; c++)
+            {
+                sw[c] += dv[b] * r[c];
+                suw[c] += dv[b] * ru[c];
+                svw[c] += dv[NURBS_EVAL_MAX_ORDER + b] * r[c];
+            }
+        }
+        SampleStore(sw, suw, svw, sign, arrays, k);
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int NurbsSurfaceEvaluator::Evaluate
+(
+double u,              /* I: U parameter */
+double v,              /* I: V parameter */
+svxPoint *point,       /* O: point on surface (NULL to ignore) */
+svxVector *normal,     /* O: outward unit normal (NULL to ignore) */
+svxVector *uTangent,   /* O: partial derivative w/r u (NULL to ignore) */
+svxVector *vTangent    /* O: partial derivative w/r v (NULL to ignore) */
+) const
+/*
+DESCRIPTION:
+   Evaluate one UV pair, same arguments as cvxSrfEval().
+
+   Return 1 if the evaluator is not initialized, else 0.
+*/
+{
+    SurfaceSamples sample;
+    if (EvaluateList(1, &u, &v, &sample))
+        return 1;
+
+    if (point)
+    {
+        point->x = sample.x[0]; point->y = sample.y[0]; point->z = sample.z[0];
+    }
+    if (normal)
+    {
+        normal->x = sample.nx[0]; normal->y = sample.ny[0]; normal->z = sample.nz[0];
+    }
+    if (uTangent)
+    {
+        uTangent->x = sample.ux[0]; uTangent->y = sample.uy[0]; uTangent->z = sample.uz[0];
+    }
+    if (vTangent)
+    {
+        vTangent->x = sample.vx[0]; vTangent->y = sample.vy[0]; vTangent->z = sample.vz[0];
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void SampleStore
+(
+const double s[4],    /* I: homogeneous point */
+const double su[4],   /* I: homogeneous derivative w/r u */
+const double sv[4],   /* I: homogeneous derivative w/r v */
+double sign,          /* I: 1, or -1 to reverse the normal */
+double *const out[SURFACE_OUT_ARRAYS],  /* O: output arrays */
+int k                 /* I: index of sample */
+)
+/*
+DESCRIPTION:
+   Project one homogeneous sample and store point, normal and tangents.
+*/
+{
+    const double iw = 1.0 / s[3];
+    const double px = s[0] * iw, py = s[1] * iw, pz = s[2] * iw;
+    const double ux = (su[0] - su[3] * px) * iw, uy = (su[1] - su[3] * py) * iw, uz = (su[2] - su[3] * pz) * iw;
+    const double vx = (sv[0] - sv[3] * px) * iw, vy = (sv[1] - sv[3] * py) * iw, vz = (sv[2] - sv[3] * pz) * iw;
+    const double nx = uy * vz - uz * vy, ny = uz * vx - ux * vz, nz = ux * vy - uy * vx;
+    const double len = sqrt(nx * nx + ny * ny + nz * nz);
+    const double scale = len > SURFACE_NORMAL_MIN ? sign / len : 0.0;
+
+    out[0][k] = px;  out[1][k] = py;  out[2][k] = pz;
+    out[3][k] = nx * scale; out[4][k] = ny * scale; out[5][k] = nz * scale;
+    out[6][k] = ux;  out[7][k] = uy;  out[8][k] = uz;
+    out[9][k] = vx;  out[10][k] = vy; out[11][k] = vz;
+}
+
+/*******************************************************************/
+/* Function definition */
+void ColumnsScalar
+(
+const SurfaceColumnBlock &block  /* I/O: one row of one tile */
+)
+/*
+DESCRIPTION:
+   Portable column kernel.
+*/
+{
+    const int width = block.width;
+    for (int c = 0; c < block.count; c++)
+    {
+        double s[4] = {}, su[4] = {}, sv[4] = {};
+        for (int a = 0; a < block.order; a++)
+        {
+            const int i = block.span[c] + a;
+            const double n = block.n[a * block.stride + c], dn = block.dn[a * block.stride + c];
+            for (int k = 0; k < 4; k++)
+            {
+                const double qk = block.q[k * width + i];
+                s[k] += n * qk;
+                su[k] += dn * qk;
+                sv[k] += n * block.q[(4 + k) * width + i];
+            }
+        }
+        SampleStore(s, su, sv, block.sign, block.out, c);
+    }
+}
+
+#if defined(SURFACE_EVAL_X64)
+/*******************************************************************/
+/* Function definition */
+SURFACE_EVAL_AVX2_TARGET void ColumnsAvx2
+(
+const SurfaceColumnBlock &block  /* I/O: one row of one tile */
+)
+/*
+DESCRIPTION:
+   AVX2 column kernel: four columns per register, the polygon points of
+each column's knot span are gathered.
+*/
+{
+    const int width = block.width;
+    const double *q = block.q;
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d one = _mm256_set1_pd(1.0);
+    const __m256d sign = _mm256_set1_pd(block.sign);
+    const __m256d tiny = _mm256_set1_pd(SURFACE_NORMAL_MIN);
+
+    int c = 0;
+    for (; c + 4 <= block.count; c += 4)
+    {
+        const __m128i base = _mm_loadu_si128((const __m128i *)(block.span + c));
+        __m256d sx = zero, sy = zero, sz = zero, sw = zero;
+        __m256d ux = zero, uy = zero, uz = zero, uw = zero;
+        __m256d vx = zero, vy = zero, vz = zero, vw = zero;
+
+        for (int a = 0; a < block.order; a++)
+        {
+            const __m128i idx = _mm_add_epi32(base, _mm_set1_epi32(a));
+            const __m256d n = _mm256_loadu_pd(block.n + a * block.stride + c);
+            const __m256d dn = _mm256_loadu_pd(block.dn + a * block.stride + c);
+
+            __m256d g = _mm256_i32gather_pd(q, idx, 8);
+            sx = _mm256_fmadd_pd(n, g, sx);
+            ux = _mm256_fmadd_pd(dn, g, ux);
+            g = _mm256_i32gather_pd(q + width, idx, 8);
+            sy = _mm256_fmadd_pd(n, g, sy);
+            uy = _mm256_fmadd_pd(dn, g, uy);
+            g = _mm256_i32gather_pd(q + 2 * width, idx, 8);
+            sz = _mm256_fmadd_pd(n, g, sz);
+            uz = _mm256_fmadd_pd(dn, g, uz);
+            g = _mm256_i32gather_pd(q + 3 * width, idx, 8);
+            sw = _mm256_fmadd_pd(n, g, sw);
+            uw = _mm256_fmadd_pd(dn, g, uw);
+
+            vx = _mm256_fmadd_pd(n, _mm256_i32gather_pd(q + 4 * width, idx, 8), vx);
+            vy = _mm256_fmadd_pd(n, _mm256_i32gather_pd(q + 5 * width, idx, 8), vy);
+            vz = _mm256_fmadd_pd(n, _mm256_i32gather_pd(q + 6 * width, idx, 8), vz);
+            vw = _mm256_fmadd_pd(n, _mm256_i32gather_pd(q + 7 * width, idx, 8), vw);
+        }
+
+        /* project: P = S/w, Pu = (Su - wu P)/w, Pv = (Sv - wv P)/w */
+        const __m256d iw = _mm256_div_pd(one, sw);
+        const __m256d px = _mm256_mul_pd(sx, iw), py = _mm256_mul_pd(sy, iw), pz = _mm256_mul_pd(sz, iw);
+        ux = _mm256_mul_pd(_mm256_fnmadd_pd(uw, px, ux), iw);
+        uy = _mm256_mul_pd(_mm256_fnmadd_pd(uw, py, uy), iw);
+        uz = _mm256_mul_pd(_mm256_fnmadd_pd(uw, pz, uz), iw);
+        vx = _mm256_mul_pd(_mm256_fnmadd_pd(vw, px, vx), iw);
+        vy = _mm256_mul_pd(_mm256_fnmadd_pd(vw, py, vy), iw);
+        vz = _mm256_mul_pd(_mm256_fnmadd_pd(vw, pz, vz), iw);
+
+        /* normal = Pu x Pv, unit length */
+        __m256d nx = _mm256_fmsub_pd(uy, vz, _mm256_mul_pd(uz, vy));
+        __m256d ny = _mm256_fmsub_pd(uz, vx, _mm256_mul_pd(ux, vz));
+        __m256d nz = _mm256_fmsub_pd(ux, vy, _mm256_mul_pd(uy, vx));
+        const __m256d len = _mm256_sqrt_pd(_mm256_fmadd_pd(nx, nx, _mm256_fmadd_pd(ny, ny, _mm256_mul_pd(nz, nz))));
+        const __m256d valid = _mm256_cmp_pd(len, tiny, _CMP_GT_OQ);
+        const __m256d scale = _mm256_and_pd(valid, _mm256_div_pd(sign, _mm256_max_pd(len, tiny)));
+        nx = _mm256_mul_pd(nx, scale);
+        ny = _mm256_mul_pd(ny, scale);
+        nz = _mm256_mul_pd(nz, scale);
+
+        _mm256_storeu_pd(block.out[0] + c, px);
+        _mm256_storeu_pd(block.out[1] + c, py);
+        _mm256_storeu_pd(block.out[2] + c, pz);
+        _mm256_storeu_pd(block.out[3] + c, nx);
+        _mm256_storeu_pd(block.out[4] + c, ny);
+        _mm256_storeu_pd(block.out[5] + c, nz);
+        _mm256_storeu_pd(block.out[6] + c, ux);
+        _mm256_storeu_pd(block.out[7] + c, uy);
+        _mm256_storeu_pd(block.out[8] + c, uz);
+        _mm256_storeu_pd(block.out[9] + c, vx);
+        _mm256_storeu_pd(block.out[10] + c, vy);
+        _mm256_storeu_pd(block.out[11] + c, vz);
+    }
+
+    /* remaining columns */
+    if (c < block.count)
+    {
+        SurfaceColumnBlock tail = block;
+        tail.count = block.count - c;
+        tail.span = block.span + c;
+        tail.n = block.n + c;
+        tail.dn = block.dn + c;
+        for (int k = 0; k < SURFACE_OUT_ARRAYS; k++)
+            tail.out[k] = block.out[k] + c;
+        ColumnsScalar(tail);
+    }
+}
+#endif
+
+#if defined(SURFACE_EVAL_ARM64)
+/*******************************************************************/
+/* Function definition */
+void ColumnsNeon
+(
+const SurfaceColumnBlock &block  /* I/O: one row of one tile */
+)
+/*
+DESCRIPTION:
+   NEON column kernel: two columns per register.
+*/
+{
+    const int width = block.width;
+    const double *q = block.q;
+
+    int c = 0;
+    for (; c + 2 <= block.count; c += 2)
+    {
+        const int i0 = block.span[c], i1 = block.span[c + 1];
+        float64x2_t s[4], su[4], sv[4];
+        for (int k = 0; k < 4; k++)
+        {
+            s[k] = vdupq_n_f64(0.0);
+            su[k] = vdupq_n_f64(0.0);
+            sv[k] = vdupq_n_f64(0.0);
+        }
+
+        for (int a = 0; a < block.order; a++)
+        {
+            const float64x2_t n = vld1q_f64(block.n + a * block.stride + c);
+            const float64x2_t dn = vld1q_f64(block.dn + a * block.stride + c);
+            for (int k = 0; k < 4; k++)
+            {
+                const double *qk = q + k * width;
+                const double *dqk = q + (4 + k) * width;
+                const float64x2_t g = vcombine_f64(vld1_f64(qk + i0 + a), vld1_f64(qk + i1 + a));
+                const float64x2_t dg = vcombine_f64(vld1_f64(dqk + i0 + a), vld1_f64(dqk + i1 + a));
+                s[k] = vfmaq_f64(s[k], n, g);
+                su[k] = vfmaq_f64(su[k], dn, g);
+                sv[k] = vfmaq_f64(sv[k], n, dg);
+            }
+        }
+
+        for (int lane = 0; lane < 2; lane++)
+        {
+            double hs[4], hu[4], hv[4];
+            for (int k = 0; k < 4; k++)
+            {
+                hs[k] = lane ? vgetq_lane_f64(s[k], 1) : vgetq_lane_f64(s[k], 0);
+                hu[k] = lane ? vgetq_lane_f64(su[k], 1) : vgetq_lane_f64(su[k], 0);
+                hv[k] = lane ? vgetq_lane_f64(sv[k], 1) : vgetq_lane_f64(sv[k], 0);
+            }
+            SampleStore(hs, hu, hv, block.sign, block.out, c + lane);
+        }
+    }
+
+    if (c < block.count)
+    {
+        SurfaceColumnBlock tail = block;
+        tail.count = block.count - c;
+        tail.span = block.span + c;
+        tail.n = block.n + c;
+        tail.dn = block.dn + c;
+        for (int k = 0; k < SURFACE_OUT_ARRAYS; k++)
+            tail.out[k] = block.out[k] + c;
+        ColumnsScalar(tail);
+    }
+}
+#endif
@@ -0,0 +1,345 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* ZW3D API includes */
+#include "zwapi_brep_face.h"
+#include "zwapi_entity.h"
+#include "zwapi_math_nurbssurface.h"
+#include "zwapi_userinput.h"
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+#include "..\inc\SurfaceGridEvalPr.h"
+#include "..\inc\NurbsSurfaceEval.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define MESSAGE_SIZE 256
+#define CHECK_GRID 33              /* grid size per direction of the accuracy check */
+#define CHECK_TOLERANCE 1.0e-9     /* required agreement of points with cvxSrfEval() */
+#define CHECK_ANGLE 1.0e-7         /* required agreement of normals and tangents (radians) */
+#define BENCH_DEFAULT_GRID 1000
+
+/*******************************************************************/
+/* Function declarations */
+static int SurfaceGridEvalCheck(void);
+static int SurfaceGridEvalBench(void);
+static int SurfaceEvaluatorLoad(int idFace, NurbsSurfaceEvaluator *evaluator, svxSurface *surface,
+    svxLimit *rangeU, svxLimit *rangeV);
+static void ParameterListMake(svxLimit range, int count, std::vector<double> &t);
+static double DirectionAngle(double ax, double ay, double az, const svxVector &b);
+
+/*******************************************************************/
+/* Function definition */
+int RegisterSurfaceGridEval
+(
+void
+)
+/*
+DESCRIPTION:
+   Register the commands of the surface grid evaluator.
+*/
+{
+    /* Compare the grid evaluator with cvxSrfEval() by entering "~SurfaceGridEvalCheck" */
+    ZwCommandFunctionLoad("SurfaceGridEvalCheck", (void *)SurfaceGridEvalCheck, ZW_LICENSE_CODE_GENERAL);
+
+    /* Time the grid evaluator against the per-call API by entering "~SurfaceGridEvalBench" */
+    ZwCommandFunctionLoad("SurfaceGridEvalBench", (void *)SurfaceGridEvalBench, ZW_LICENSE_CODE_GENERAL);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int UnloadSurfaceGridEval
+(
+void
+)
+/*
+DESCRIPTION:
+   Unload the commands of the surface grid evaluator.
+*/
+{
+    ZwCommandFunctionUnload("SurfaceGridEvalCheck");
+    ZwCommandFunctionUnload("SurfaceGridEvalBench");
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int SurfaceEvaluatorLoad
+(
+int idFace,                       /* I: face id */
+NurbsSurfaceEvaluator *evaluator, /* O: evaluator of the face's surface */
+svxSurface *surface,              /* O: surface data, free with cvxSurfaceFree() */
+svxLimit *rangeU,                 /* O: U range of the face */
+svxLimit *rangeV                  /* O: V range of the face */
+)
+/*
+DESCRIPTION:
+   Get the NURBS surface of a face from the host and load it into an
+evaluator. The surface data is kept for cvxSrfEval().
+
+   Return 1 if function fails, else 0.
+*/
+{
+    if (cvxPartInqFaceSrf(idFace, surface))
+        return 1;
+
+    if (evaluator->Init(*surface))
+    {
+        cvxSurfaceFree(surface);
+        return 1;
+    }
+
+    if (cvxFaceParam(idFace, rangeU, rangeV))
+    {
+        *rangeU = evaluator->DomainU();
+        *rangeV = evaluator->DomainV();
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void ParameterListMake
+(
+svxLimit range,          /* I: parameter range */
+int count,               /* I: number of parameters */
+std::vector<double> &t   /* O: uniformly spaced parameters, ends included */
+)
+/*
+DESCRIPTION:
+   Sample a parameter range uniformly.
+*/
+{
+    t.resize(count);
+    const double step = count > 1 ? (range.max - range.min) / (count - 1) : 0.0;
+    for (int i = 0; i < count; i++)
+        t[i] = range.min + step * i;
+    if (count > 1)
+        t[count - 1] = range.max;
+}
+
+/*******************************************************************/
+/* Function definition */
+double DirectionAngle
+(
+double ax,             /* I: direction 1, x */
+double ay,             /* I: direction 1, y */
+double az,             /* I: direction 1, z */
+const svxVector &b     /* I: direction 2 */
+)
+/*
+DESCRIPTION:
+   Angle between two directions of any length (cvxSrfEval() may return
+unit tangents). Returns 0 if both are zero and pi if only one is.
+*/
+{
+    const double la = sqrt(ax * ax + ay * ay + az * az);
+    const double lb = sqrt(b.x * b.x + b.y * b.y + b.z * b.z);
+    if (la == 0.0 || lb == 0.0)
+        return la == lb ? 0.0 : 3.14159265358979323846;
+
+    const double cx = ay * b.z - az * b.y, cy = az * b.x - ax * b.z, cz = ax * b.y - ay * b.x;
+    const double dot = ax * b.x + ay * b.y + az * b.z;
+    return atan2(sqrt(cx * cx + cy * cy + cz * cz), dot);
+}
+
+/*******************************************************************/
+/* Function definition */
+int SurfaceGridEvalCheck
+(
+void
+)
+/*
+DESCRIPTION:
+   Evaluate a grid on the picked faces with the grid evaluator and with
+cvxSrfEval() at the same parameters, and report the largest differences of
+points, normals and tangent directions.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    int count = 0;
+    szwEntityHandle *faces = nullptr;
+    if (ZwEntityListGetByPick("Select faces to check", ZW_INPUT_FACE, 0, &count, &faces))
+        return 1;
+
+    char message[MESSAGE_SIZE];
+    int failed = 0;
+    std::vector<double> u, v;
+    SurfaceSamples grid;
+
+    for (int i = 0; i < count; i++)
+    {
+        int idFace = 0;
+        ZwEntityIdGet(1, &faces[i], &idFace);
+
+        NurbsSurfaceEvaluator evaluator;
+        svxSurface surface{};
+        svxLimit rangeU{}, rangeV{};
+        if (SurfaceEvaluatorLoad(idFace, &evaluator, &surface, &rangeU, &rangeV))
+        {
+            sprintf_s(message, MESSAGE_SIZE, "Face %d: NURBS data is not supported.", idFace);
+            cvxMsgDisp(message);
+            failed++;
+            continue;
+        }
+
+        ParameterListMake(rangeU, CHECK_GRID, u);
+        ParameterListMake(rangeV, CHECK_GRID, v);
+        evaluator.EvaluateGrid(CHECK_GRID, u.data(), CHECK_GRID, v.data(), &grid);
+
+        double maxPoint = 0.0, maxNormal = 0.0, maxTangent = 0.0;
+        for (int iv = 0; iv < CHECK_GRID; iv++)
+        {
+            for (int iu = 0; iu < CHECK_GRID; iu++)
+            {
+                svxPoint point{};
+                svxVector normal{}, uTangent{}, vTangent{};
+                if (cvxSrfEval(&surface, u[iu], v[iv], &point, &normal, &uTangent, &vTangent))
+                    continue;
+
+                const int k = iv * CHECK_GRID + iu;
+                const double dx = grid.x[k] - point.x, dy = grid.y[k] - point.y, dz = grid.z[k] - point.z;
+                const double diff = sqrt(dx * dx + dy * dy + dz * dz);
+                maxPoint = diff > maxPoint ? diff : maxPoint;
+
+                /* degenerate points (poles) have no defined normal */
+                if (grid.nx[k] != 0.0 || grid.ny[k] != 0.0 || grid.nz[k] != 0.0)
+                {
+                    const double angle = DirectionAngle(grid.nx[k], grid.ny[k], grid.nz[k], normal);
+                    maxNormal = angle > maxNormal ? angle : maxNormal;
+                }
+
+                double angle = DirectionAngle(grid.ux[k], grid.uy[k], grid.uz[k], uTangent);
+                maxTangent = angle > maxTangent ? angle : maxTangent;
+                angle = DirectionAngle(grid.vx[k], grid.vy[k], grid.vz[k], vTangent);
+                maxTangent = angle > maxTangent ? angle : maxTangent;
+            }
+        }
+        cvxSurfaceFree(&surface);
+
+        const int pass = maxPoint <= CHECK_TOLERANCE && maxNormal <= CHECK_ANGLE && maxTangent <= CHECK_ANGLE;
+        failed += pass ? 0 : 1;
+
+        sprintf_s(message, MESSAGE_SIZE, "Face %d: max diff point %.2e, normal %.2e rad, tangent %.2e rad %s",
+            idFace, maxPoint, maxNormal, maxTangent, pass ? "OK" : "FAILED");
+        cvxMsgDisp(message);
+    }
+
+    sprintf_s(message, MESSAGE_SIZE, "%d of %d faces agree with cvxSrfEval() on a %dx%d grid.",
+        count - failed, count, CHECK_GRID, CHECK_GRID);
+    cvxMsgDisp(message);
+
+    ZwEntityHandleListFree(count, &faces);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int SurfaceGridEvalBench
+(
+void
+)
+/*
+DESCRIPTION:
+   Time the evaluation of an N x N grid on one face through cvxSrfEval(),
+the grid evaluator in one sweep, the tiled grid evaluator and the list
+evaluator.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    szwEntityHandle face{};
+    if (ZwEntityGetByPick("Select face to benchmark", ZW_INPUT_FACE, 0, &face))
+        return 1;
+
+    double number = BENCH_DEFAULT_GRID;
+    if (cvxGetNumber("Grid size per direction (default 1000)", &number) || number < 2.0)
+        number = BENCH_DEFAULT_GRID;
+    const int size = (int)number;
+    const int count = size * size;
+
+    int idFace = 0;
+    ZwEntityIdGet(1, &face, &idFace);
+    ZwEntityHandleFree(&face);
+
+    char message[MESSAGE_SIZE];
+    NurbsSurfaceEvaluator evaluator;
+    svxSurface surface{};
+    svxLimit rangeU{}, rangeV{};
+    if (SurfaceEvaluatorLoad(idFace, &evaluator, &surface, &rangeU, &rangeV))
+    {
+        cvxMsgDisp("NURBS data of the face is not supported.");
+        return 1;
+    }
+
+    std::vector<double> u, v;
+    ParameterListMake(rangeU, size, u);
+    ParameterListMake(rangeV, size, v);
+
+    /* per-call API */
+    std::vector<svxPoint> points(count);
+    std::vector<svxVector> normals(count), uTangents(count), vTangents(count);
+    auto start = std::chrono::steady_clock::now();
+    for (int iv = 0; iv < size; iv++)
+    {
+        for (int iu = 0; iu < size; iu++)
+        {
+            const int k = iv * size + iu;
+            cvxSrfEval(&surface, u[iu], v[iv], &points[k], &normals[k], &uTangents[k], &vTangents[k]);
+        }
+    }
+    const double timeHost = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    cvxSurfaceFree(&surface);
+
+    /* grid in one sweep */
+    SurfaceSamples samples;
+    start = std::chrono::steady_clock::now();
+    evaluator.EvaluateGrid(size, u.data(), size, v.data(), &samples);
+    const double timeGrid = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    /* grid in cache-sized tiles */
+    start = std::chrono::steady_clock::now();
+    evaluator.EvaluateGridTiled(size, u.data(), size, v.data(), 0, &samples);
+    const double timeTiled = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    /* arbitrary list of the same pairs */
+    std::vector<double> listU(count), listV(count);
+    for (int k = 0; k < count; k++)
+    {
+        listU[k] = u[k % size];
+        listV[k] = v[k / size];
+    }
+    SurfaceSamples list;
+    start = std::chrono::steady_clock::now();
+    evaluator.EvaluateList(count, listU.data(), listV.data(), &list);
+    const double timeList = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    double maxDiff = 0.0;
+    for (int k = 0; k < count; k++)
+    {
+        const double dx = samples.x[k] - points[k].x, dy = samples.y[k] - points[k].y, dz = samples.z[k] - points[k].z;
+        const double diff = sqrt(dx * dx + dy * dy + dz * dz);
+        maxDiff = diff > maxDiff ? diff : maxDiff;
+    }
+
+    sprintf_s(message, MESSAGE_SIZE, "Face %d, %dx%d grid, %s kernel, %d columns per tile, max point diff %.2e",
+        idFace, size, size, NurbsEvalKernelName(evaluator.Kernel()), evaluator.TileColumns(0), maxDiff);
+    cvxMsgDisp(message);
+    sprintf_s(message, MESSAGE_SIZE,
+        "cvxSrfEval %.1f ns, grid %.1f ns (%.1fx), tiled grid %.1f ns (%.1fx), list %.1f ns (%.1fx) per point",
+        timeHost * 1.0e9 / count,
+        timeGrid * 1.0e9 / count, timeGrid > 0.0 ? timeHost / timeGrid : 0.0,
+        timeTiled * 1.0e9 / count, timeTiled > 0.0 ? timeHost / timeTiled : 0.0,
+        timeList * 1.0e9 / count, timeList > 0.0 ? timeHost / timeList : 0.0);
+    cvxMsgDisp(message);
+    return 0;
+}
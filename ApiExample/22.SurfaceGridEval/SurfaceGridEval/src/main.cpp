@@ -0,0 +1,21 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+#include "..\inc\SurfaceGridEvalPr.h"
+
+// Dynamic library entry function, called when the dll is loaded
+// The function name must be dll name + "Init"
+int SurfaceGridEvalInit()
+{
+    RegisterSurfaceGridEval();
+    return 0;
+}
+
+// Dynamic library entry function, called when the dll is unloaded
+// The function name must be dll name + "Exit"
+int SurfaceGridEvalExit()
+{
+    UnloadSurfaceGridEval();
+    return 0;
+}
@@ -0,0 +1,154 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+#pragma once
+
+/* ZW3D API includes */
+#include "zwapi_util.h"
+#include "zwapi_brep_data.h"
+
+/* Application includes */
+#include <stdint.h>
+#include <vector>
+
+/*******************************************************************/
+/* Constant definitions */
+#define FACET_MESH_TOLERANCE 1.0e-5       /* default weld distance */
+#define FACET_MESH_CREASE_ANGLE 30.0      /* default crease angle in degrees */
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: storage of vertex positions in a packed mesh */
+enum FacetMeshPositionFormat
+{
+    FacetMeshPosition_Float32 = 0,      /* 3 x float, 12 bytes */
+    FacetMeshPosition_Float16 = 1,      /* 3 x half float relative to the box center, 6 bytes */
+    FacetMeshPosition_Quantized16 = 2,  /* 3 x 16 bit fraction of the bounding box, 6 bytes */
+};
+
+/* DESCRIPTION: storage of vertex normals in a packed mesh */
+enum FacetMeshNormalFormat
+{
+    FacetMeshNormal_None = 0,     /* no normals */
+    FacetMeshNormal_Float32 = 1,  /* 3 x float, 12 bytes */
+    FacetMeshNormal_Oct16 = 2,    /* octahedral, 2 x 8 bit */
+    FacetMeshNormal_Oct32 = 3,    /* octahedral, 2 x 16 bit */
+};
+
+/*
+DESCRIPTION:
+   Shared-vertex triangle mesh. Vertices that lie on a crease (normals of
+the adjacent triangles differ by more than the crease angle) are split, all
+split vertices of one welded point share "pointIndex".
+*/
+struct IndexedMesh
+{
+    std::vector<float> positions;        /* x,y,z per vertex */
+    std::vector<float> normals;          /* x,y,z per vertex, empty if normals were dropped */
+    std::vector<uint32_t> pointIndex;    /* welded point of each vertex */
+    std::vector<uint32_t> indices;       /* 3 vertices per triangle, same orientation as the facets */
+    std::vector<int> faceFirst;          /* first triangle of each input face, last entry = triangle count */
+
+    int VertexCount(void) const { return (int)(positions.size() / 3); }
+    int TriangleCount(void) const { return (int)(indices.size() / 3); }
+    int FaceCount(void) const { return faceFirst.empty() ? 0 : (int)faceFirst.size() - 1; }
+    size_t Bytes(void) const;
+};
+
+/*
+DESCRIPTION:
+   GPU-ready byte buffers of an indexed mesh. Indices are 16 bit if the
+mesh has at most 65536 vertices, else 32 bit.
+*/
+struct PackedMesh
+{
+    FacetMeshPositionFormat positionFormat;
+    FacetMeshNormalFormat normalFormat;
+    int vertexCount;
+    int triangleCount;
+    int positionBytes;                     /* bytes per vertex in "positions" */
+    int normalBytes;                       /* bytes per vertex in "normals" */
+    int indexBytes;                        /* 2 or 4 */
+    float origin[3];                       /* decoded position = origin + stored * scale */
+    float scale[3];
+    std::vector<unsigned char> positions;
+    std::vector<unsigned char> normals;
+    std::vector<unsigned char> indices;
+
+    PackedMesh();
+    size_t Bytes(void) const { return positions.size() + normals.size() + indices.size(); }
+};
+
+/*
+DESCRIPTION:
+   Merges the triangle strips of any number of faces (szwFacets from
+ZwFaceListFacetsGet() / ZwFaceFacetsGet(), or svxFacets) into one indexed
+triangle mesh.
+
+   Strip vertices are welded through a spatial hash with cells of twice
+the tolerance: a vertex only has to look at the 8 cells nearest to it, so
+points on shared face boundaries are found in constant time whatever the
+tessellation order. A welded point keeps several vertices if the facet
+normals meeting there differ by more than the crease angle, so sharp edges
+stay sharp while smooth face boundaries are shaded continuously. Facet
+blocks without normals get area-weighted triangle normals.
+
+   Triangles that collapse when their vertices are welded are dropped.
+*/
+class FacetMeshWelder
+{
+public:
+    FacetMeshWelder(double tolerance = FACET_MESH_TOLERANCE, double creaseAngle = FACET_MESH_CREASE_ANGLE,
+        int keepNormals = 1);
+
+    int AddFacets(const szwFacets &facets);
+    int AddFacets(const svxFacets &facets);
+    void Finish(IndexedMesh *mesh);
+
+    int InputVertexCount(void) const { return m_inputVertices; }
+    int InputTriangleCount(void) const { return m_inputTriangles; }
+    int PointCount(void) const { return (int)m_pointHead.size(); }
+
+private:
+    struct CellEntry
+    {
+        int64_t x, y, z;   /* cell coordinates */
+        int head;          /* first point in the cell, -1 if the slot is free */
+    };
+
+    int AddStrips(int numStrips, const int *strips, int numVertex, const svxPointf *vertex,
+        const svxPointf *normal);
+    int PointWeld(const svxPointf &p);
+    int VertexWeld(int point, const float normal[3]);
+    CellEntry *CellFind(int64_t x, int64_t y, int64_t z, int insert);
+    void CellTableGrow(void);
+
+    double m_tolerance;                   /* weld distance */
+    double m_cellSize;                    /* 2 * m_tolerance */
+    float m_creaseCos;                    /* cosine of the crease angle */
+    int m_keepNormals;                    /* 0 to weld by position only */
+    int m_inputVertices, m_inputTriangles;
+
+    std::vector<CellEntry> m_cells;       /* open addressing, size is a power of 2 */
+    int m_cellsUsed;
+    std::vector<float> m_points;          /* x,y,z per welded point */
+    std::vector<int> m_pointNext;         /* next point in the same cell */
+    std::vector<int> m_pointHead;         /* first vertex of each point */
+    std::vector<int> m_vertexPoint;       /* point of each vertex */
+    std::vector<int> m_vertexNext;        /* next vertex of the same point */
+    std::vector<float> m_vertexNormal;    /* first normal of each vertex (crease test) */
+    std::vector<float> m_normalSum;       /* sum of normals welded into each vertex */
+    std::vector<uint32_t> m_indices;
+    std::vector<int> m_faceFirst;
+};
+
+/* Function declaration */
+int PackedMeshMake(const IndexedMesh &mesh, FacetMeshPositionFormat positionFormat,
+    FacetMeshNormalFormat normalFormat, PackedMesh *packed);
+void PackedMeshPosition(const PackedMesh &packed, int vertex, float position[3]);
+void PackedMeshNormal(const PackedMesh &packed, int vertex, float normal[3]);
+uint32_t PackedMeshIndex(const PackedMesh &packed, int corner);
+int IndexedMeshOpenEdges(const IndexedMesh &mesh);
+uint16_t FacetMeshHalfFromFloat(float value);
+float FacetMeshHalfToFloat(uint16_t half);
@@ -0,0 +1,898 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* Application includes */
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+#include "..\inc\FacetMesh.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define CELL_TABLE_MIN 1024                 /* initial size of the spatial hash */
+#define DEGREE_TO_RADIAN 0.017453292519943295
+
+/*******************************************************************/
+/* Function declarations */
+static uint64_t CellHash(int64_t x, int64_t y, int64_t z);
+static int StripsCheck(int numStrips, const int *strips, int numVertex);
+static void NormalsMake(int numStrips, const int *strips, int numVertex, const svxPointf *vertex,
+    std::vector<float> &normals);
+static void OctEncode(const float normal[3], int bits, uint32_t *u, uint32_t *v);
+static void OctDecode(uint32_t u, uint32_t v, int bits, float normal[3]);
+
+/*******************************************************************/
+/* Function definition */
+size_t IndexedMesh::Bytes
+(
+void
+) const
+/*
+DESCRIPTION:
+   Memory of the render data (positions, normals and indices) in bytes.
+*/
+{
+    return (positions.size() + normals.size()) * sizeof(float) + indices.size() * sizeof(uint32_t);
+}
+
+/*******************************************************************/
+/* Function definition */
+PackedMesh::PackedMesh()
+    : positionFormat(FacetMeshPosition_Float32), normalFormat(FacetMeshNormal_None), vertexCount(0),
+      triangleCount(0), positionBytes(0), normalBytes(0), indexBytes(0), origin(), scale()
+/*
+DESCRIPTION:
+   Create an empty packed mesh.
+*/
+{
+}
+
+/*******************************************************************/
+/* Function definition */
+FacetMeshWelder::FacetMeshWelder
+(
+double tolerance,     /* I: weld distance (> 0) */
+double creaseAngle,   /* I: largest angle in degrees between normals of one vertex */
+int keepNormals       /* I: 1 to output normals, 0 to weld by position only */
+)
+/*
+DESCRIPTION:
+   Create an empty welder.
+*/
+    : m_inputVertices(0), m_inputTriangles(0), m_cellsUsed(0)
+{
+    m_tolerance = tolerance > 0.0 ? tolerance : FACET_MESH_TOLERANCE;
+    m_cellSize = 2.0 * m_tolerance;
+    m_creaseCos = (float)cos(creaseAngle * DEGREE_TO_RADIAN);
+    m_keepNormals = keepNormals ? 1 : 0;
+
+    CellEntry empty = { 0, 0, 0, -1 };
+    m_cells.assign(CELL_TABLE_MIN, empty);
+}
+
+/*******************************************************************/
+/* Function definition */
+int FacetMeshWelder::AddFacets
+(
+const szwFacets &facets  /* I: facets of one face */
+)
+/*
+DESCRIPTION:
+   Add the triangle strips of one face.
+
+   Return 1 if the facet data is invalid, else 0.
+*/
+{
+    return AddStrips(facets.numberTriangleStrip, facets.triangleStrip, facets.numberVertex,
+        facets.vertex, facets.normal);
+}
+
+/*******************************************************************/
+/* Function definition */
+int FacetMeshWelder::AddFacets
+(
+const svxFacets &facets  /* I: facets of one face or block */
+)
+/*
+DESCRIPTION:
+   Add the triangle strips of one face or facet block.
+
+   Return 1 if the facet data is invalid, else 0.
+*/
+{
+    return AddStrips(facets.numTriStrip, facets.TriStrip, facets.numVertex, facets.Vertex, facets.Normal);
+}
+
+/*******************************************************************/
+/* Function definition */
+int FacetMeshWelder::AddStrips
+(
+int numStrips,              /* I: number of strips */
+const int *strips,          /* I: count-prefixed strip list */
+int numVertex,              /* I: number of vertices */
+const svxPointf *vertex,    /* I: vertex coordinates */
+const svxPointf *normal     /* I: vertex normals (NULL if none) */
+)
+/*
+DESCRIPTION:
+   Weld the vertices of one strip list and append its triangles.
+
+   Return 1 if the strip list is invalid, else 0.
+*/
+{
+    if (numVertex < 0 || (numVertex > 0 && vertex == nullptr))
+        return 1;
+    if (StripsCheck(numStrips, strips, numVertex))
+        return 1;
+
+    std::vector<float> generated;
+    if (m_keepNormals && normal == nullptr)
+        NormalsMake(numStrips, strips, numVertex, vertex, generated);
+
+    /* local vertex -> welded vertex */
+    std::vector<int> map(numVertex);
+    for (int i = 0; i < numVertex; i++)
+    {
+        const int point = PointWeld(vertex[i]);
+        float n[3] = { 0.0f, 0.0f, 0.0f };
+        if (m_keepNormals)
+        {
+            if (normal)
+            {
+                n[0] = normal[i].x; n[1] = normal[i].y; n[2] = normal[i].z;
+            }
+            else
+            {
+                n[0] = generated[i * 3]; n[1] = generated[i * 3 + 1]; n[2] = generated[i * 3 + 2];
+            }
+        }
+        map[i] = VertexWeld(point, n);
+    }
+
+    m_faceFirst.push_back((int)(m_indices.size() / 3));
+    const int *s = strips;
+    for (int k = 0; k < numStrips; k++)
+    {
+        const int n = *s++;
+        for (int j = 0; j + 2 < n; j++)
+        {
+            /* every second triangle of a strip is reversed */
+            const int a = map[s[(j & 1) ? j + 1 : j]];
+            const int b = map[s[(j & 1) ? j : j + 1]];
+            const int c = map[s[j + 2]];
+            m_inputTriangles++;
+
+            const int pa = m_vertexPoint[a], pb = m_vertexPoint[b], pc = m_vertexPoint[c];
+            if (pa == pb || pb == pc || pc == pa)
+                continue;
+            m_indices.push_back((uint32_t)a);
+            m_indices.push_back((uint32_t)b);
+            m_indices.push_back((uint32_t)c);
+        }
+        s += n;
+    }
+    m_inputVertices += numVertex;
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int FacetMeshWelder::PointWeld
+(
+const svxPointf &p  /* I: vertex position */
+)
+/*
+DESCRIPTION:
+   Find the welded point closest to "p" within the tolerance, or create a
+new point.
+
+   The cells are twice the tolerance wide, so every point within the
+tolerance of "p" lies in the cell of "p" or in the neighbouring cell on the
+side of the nearer cell boundary, per axis: 8 cells in total.
+
+   Return the index of the point.
+*/
+{
+    const double f[3] = { p.x / m_cellSize, p.y / m_cellSize, p.z / m_cellSize };
+    int64_t cell[3], side[3];
+    for (int k = 0; k < 3; k++)
+    {
+        const double c = floor(f[k]);
+        cell[k] = (int64_t)c;
+        side[k] = f[k] - c < 0.5 ? cell[k] - 1 : cell[k] + 1;
+    }
+
+    int best = -1;
+    double bestDist = m_tolerance * m_tolerance;
+    for (int i = 0; i < 8; i++)
+    {
+        CellEntry *entry = CellFind((i & 1) ? side[0] : cell[0], (i & 2) ? side[1] : cell[1],
+            (i & 4) ? side[2] : cell[2], 0);
+        if (entry == nullptr)
+            continue;
+        for (int j = entry->head; j >= 0; j = m_pointNext[j])
+        {
+            const double dx = m_points[j * 3] - (double)p.x;
+            const double dy = m_points[j * 3 + 1] - (double)p.y;
+            const double dz = m_points[j * 3 + 2] - (double)p.z;
+            const double dist = dx * dx + dy * dy + dz * dz;
+            if (dist <= bestDist)
+            {
+                best = j;
+                bestDist = dist;
+            }
+        }
+    }
+    if (best >= 0)
+        return best;
+
+    const int point = (int)m_pointHead.size();
+    m_points.push_back(p.x);
+    m_points.push_back(p.y);
+    m_points.push_back(p.z);
+    m_pointHead.push_back(-1);
+
+    CellEntry *entry = CellFind(cell[0], cell[1], cell[2], 1);
+    m_pointNext.push_back(entry->head);
+    entry->head = point;
+    return point;
+}
+
+/*******************************************************************/
+/* Function definition */
+int FacetMeshWelder::VertexWeld
+(
+int point,              /* I: welded point */
+const float normal[3]   /* I: facet normal at the point */
+)
+/*
+DESCRIPTION:
+   Find the vertex of a point whose normal is within the crease angle of
+"normal", or create a new vertex.
+
+   Return the index of the vertex.
+*/
+{
+    for (int v = m_pointHead[point]; v >= 0; v = m_vertexNext[v])
+    {
+        if (!m_keepNormals)
+            return v;
+
+        const float *n = &m_vertexNormal[v * 3];
+        if (n[0] * normal[0] + n[1] * normal[1] + n[2] * normal[2] >= m_creaseCos)
+        {
+            m_normalSum[v * 3] += normal[0];
+            m_normalSum[v * 3 + 1] += normal[1];
+            m_normalSum[v * 3 + 2] += normal[2];
+            return v;
+        }
+    }
+
+    const int v = (int)m_vertexPoint.size();
+    m_vertexPoint.push_back(point);
+    m_vertexNext.push_back(m_pointHead[point]);
+    m_pointHead[point] = v;
+    if (m_keepNormals)
+    {
+        m_vertexNormal.insert(m_vertexNormal.end(), normal, normal + 3);
+        m_normalSum.insert(m_normalSum.end(), normal, normal + 3);
+    }
+    return v;
+}
+
+/*******************************************************************/
+/* Function definition */
+FacetMeshWelder::CellEntry *FacetMeshWelder::CellFind
+(
+int64_t x,   /* I: cell coordinate */
+int64_t y,   /* I: cell coordinate */
+int64_t z,   /* I: cell coordinate */
+int insert   /* I: 1 to create the cell if it does not exist */
+)
+/*
+DESCRIPTION:
+   Look up a cell of the spatial hash (linear probing).
+
+   Return the cell, or NULL if it does not exist and "insert" is 0.
+*/
+{
+    if (insert && (m_cellsUsed + 1) * 2 > (int)m_cells.size())
+        CellTableGrow();
+
+    const size_t mask = m_cells.size() - 1;
+    for (size_t i = (size_t)CellHash(x, y, z) & mask;; i = (i + 1) & mask)
+    {
+        CellEntry &entry = m_cells[i];
+        if (entry.head < 0)
+        {
+            if (!insert)
+                return nullptr;
+            entry.x = x;
+            entry.y = y;
+            entry.z = z;
+            m_cellsUsed++;
+            return &entry;
+        }
+        if (entry.x == x && entry.y == y && entry.z == z)
+            return &entry;
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+void FacetMeshWelder::CellTableGrow
+(
+void
+)
+/*
+DESCRIPTION:
+   Double the size of the spatial hash and re-insert all cells.
+*/
+{
+    std::vector<CellEntry> old;
+    old.swap(m_cells);
+    CellEntry empty = { 0, 0, 0, -1 };
+    m_cells.assign(old.size() * 2, empty);
+
+    const size_t mask = m_cells.size() - 1;
+    for (const CellEntry &entry : old)
+    {
+        if (entry.head < 0)
+            continue;
+        size_t i = (size_t)CellHash(entry.x, entry.y, entry.z) & mask;
+        while (m_cells[i].head >= 0)
+            i = (i + 1) & mask;
+        m_cells[i] = entry;
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+void FacetMeshWelder::Finish
+(
+IndexedMesh *mesh   /* O: welded mesh */
+)
+/*
+DESCRIPTION:
+   Output the mesh of all facets added so far and reset the welder.
+*/
+{
+    const int count = (int)m_vertexPoint.size();
+    mesh->positions.resize((size_t)count * 3);
+    mesh->pointIndex.resize(count);
+    for (int v = 0; v < count; v++)
+    {
+        const int point = m_vertexPoint[v];
+        mesh->pointIndex[v] = (uint32_t)point;
+        memcpy(&mesh->positions[(size_t)v * 3], &m_points[(size_t)point * 3], 3 * sizeof(float));
+    }
+
+    mesh->normals.clear();
+    if (m_keepNormals)
+    {
+        mesh->normals.resize((size_t)count * 3);
+        for (int v = 0; v < count; v++)
+        {
+            const float *sum = &m_normalSum[(size_t)v * 3];
+            const float len = sqrtf(sum[0] * sum[0] + sum[1] * sum[1] + sum[2] * sum[2]);
+            const float *n = len > 0.0f ? sum : &m_vertexNormal[(size_t)v * 3];
+            const float scale = len > 0.0f ? 1.0f / len : 1.0f;
+            for (int k = 0; k < 3; k++)
+                mesh->normals[(size_t)v * 3 + k] = n[k] * scale;
+        }
+    }
+
+    mesh->indices.swap(m_indices);
+    mesh->faceFirst.swap(m_faceFirst);
+    mesh->faceFirst.push_back((int)(mesh->indices.size() / 3));
+
+    /* reset */
+    CellEntry empty = { 0, 0, 0, -1 };
+    m_cells.assign(CELL_TABLE_MIN, empty);
+    m_cellsUsed = 0;
+    m_inputVertices = m_inputTriangles = 0;
+    m_points.clear();
+    m_pointNext.clear();
+    m_pointHead.clear();
+    m_vertexPoint.clear();
+    m_vertexNext.clear();
+    m_vertexNormal.clear();
+    m_normalSum.clear();
+    m_indices.clear();
+    m_faceFirst.clear();
+}
+
+/*******************************************************************/
+/* Function definition */
+uint64_t CellHash
+(
+int64_t x,   /* I: cell coordinate */
+int64_t y,   /* I: cell coordinate */
+int64_t z    /* I: cell coordinate */
+)
+/*
+DESCRIPTION:
+   Hash of a cell (large primes, then the splitmix64 finalizer).
+*/
+{
+    uint64_t h = (uint64_t)x * 0x9E3779B97F4A7C15ull ^ (uint64_t)y * 0xC2B2AE3D27D4EB4Full ^
+        (uint64_t)z * 0x165667B19E3779F9ull;
+    h ^= h >> 30;
+    h *= 0xBF58476D1CE4E5B9ull;
+    h ^= h >> 27;
+    h *= 0x94D049BB133111EBull;
+    return h ^ (h >> 31);
+}
+
+/*******************************************************************/
+/* Function definition */
+int StripsCheck
+(
+int numStrips,       /* I: number of strips */
+const int *strips,   /* I: count-prefixed strip list */
+int numVertex        /* I: number of vertices */
+)
+/*
+DESCRIPTION:
+   Check the counts and vertex indices of a strip list.
+
+   Return 1 if the list is invalid, else 0.
+*/
+{
+    if (numStrips < 0 || (numStrips > 0 && strips == nullptr))
+        return 1;
+
+    const int *s = strips;
+    for (int k = 0; k < numStrips; k++)
+    {
+        const int n = *s++;
+        if (n < 0)
+            return 1;
+        for (int j = 0; j < n; j++)
+        {
+            if (s[j] < 0 || s[j] >= numVertex)
+                return 1;
+        }
+        s += n;
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void NormalsMake
+(
+int numStrips,                /* I: number of strips */
+const int *strips,            /* I: count-prefixed strip list */
+int numVertex,                /* I: number of vertices */
+const svxPointf *vertex,      /* I: vertex coordinates */
+std::vector<float> &normals   /* O: unit normal per vertex */
+)
+/*
+DESCRIPTION:
+   Area-weighted vertex normals of a strip list without normals.
+*/
+{
+    normals.assign((size_t)numVertex * 3, 0.0f);
+    const int *s = strips;
+    for (int k = 0; k < numStrips; k++)
+    {
+        const int n = *s++;
+        for (int j = 0; j + 2 < n; j++)
+        {
+            const int a = s[(j & 1) ? j + 1 : j], b = s[(j & 1) ? j : j + 1], c = s[j + 2];
+            const float ux = vertex[b].x - vertex[a].x, uy = vertex[b].y - vertex[a].y, uz = vertex[b].z - vertex[a].z;
+            const float vx = vertex[c].x - vertex[a].x, vy = vertex[c].y - vertex[a].y, vz = vertex[c].z - vertex[a].z;
+            const float cross[3] = { uy * vz - uz * vy, uz * vx - ux * vz, ux * vy - uy * vx };
+            for (int i = 0; i < 3; i++)
+            {
+                normals[(size_t)a * 3 + i] += cross[i];
+                normals[(size_t)b * 3 + i] += cross[i];
+                normals[(size_t)c * 3 + i] += cross[i];
+            }
+        }
+        s += n;
+    }
+
+    for (int i = 0; i < numVertex; i++)
+    {
+        float *n = &normals[(size_t)i * 3];
+        const float len = sqrtf(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+        if (len > 0.0f)
+        {
+            n[0] /= len; n[1] /= len; n[2] /= len;
+        }
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+int PackedMeshMake
+(
+const IndexedMesh &mesh,                /* I: indexed mesh */
+FacetMeshPositionFormat positionFormat, /* I: storage of positions */
+FacetMeshNormalFormat normalFormat,     /* I: storage of normals */
+PackedMesh *packed                      /* O: packed mesh */
+)
+/*
+DESCRIPTION:
+   Pack an indexed mesh into byte buffers.
+
+   Return 1 if normals are requested but the mesh has none, else 0.
+*/
+{
+    const int count = mesh.VertexCount();
+    if (normalFormat != FacetMeshNormal_None && (int)mesh.normals.size() != count * 3)
+        return 1;
+
+    packed->positionFormat = positionFormat;
+    packed->normalFormat = normalFormat;
+    packed->vertexCount = count;
+    packed->triangleCount = mesh.TriangleCount();
+
+    /* bounding box */
+    float low[3] = { 0.0f, 0.0f, 0.0f }, high[3] = { 0.0f, 0.0f, 0.0f };
+    for (int v = 0; v < count; v++)
+    {
+        for (int k = 0; k < 3; k++)
+        {
+            const float c = mesh.positions[(size_t)v * 3 + k];
+            low[k] = (v == 0 || c < low[k]) ? c : low[k];
+            high[k] = (v == 0 || c > high[k]) ? c : high[k];
+        }
+    }
+
+    /* positions */
+    switch (positionFormat)
+    {
+        case FacetMeshPosition_Float16:
+            packed->positionBytes = 3 * (int)sizeof(uint16_t);
+            for (int k = 0; k < 3; k++)
+            {
+                packed->origin[k] = 0.5f * (low[k] + high[k]);
+                packed->scale[k] = 1.0f;
+            }
+            break;
+        case FacetMeshPosition_Quantized16:
+            packed->positionBytes = 3 * (int)sizeof(uint16_t);
+            for (int k = 0; k < 3; k++)
+            {
+                packed->origin[k] = low[k];
+                packed->scale[k] = (high[k] - low[k]) / 65535.0f;
+            }
+            break;
+        default:
+            packed->positionBytes = 3 * (int)sizeof(float);
+            for (int k = 0; k < 3; k++)
+            {
+                packed->origin[k] = 0.0f;
+                packed->scale[k] = 1.0f;
+            }
+            break;
+    }
+
+    packed->positions.resize((size_t)count * packed->positionBytes);
+    unsigned char *dst = packed->positions.data();
+    for (int v = 0; v < count; v++, dst += packed->positionBytes)
+    {
+        const float *p = &mesh.positions[(size_t)v * 3];
+        if (positionFormat == FacetMeshPosition_Float32)
+        {
+            memcpy(dst, p, 3 * sizeof(float));
+            continue;
+        }
+
+        uint16_t q[3];
+        for (int k = 0; k < 3; k++)
+        {
+            if (positionFormat == FacetMeshPosition_Float16)
+            {
+                q[k] = FacetMeshHalfFromFloat(p[k] - packed->origin[k]);
+            }
+            else
+            {
+                const float f = packed->scale[k] > 0.0f ? (p[k] - packed->origin[k]) / packed->scale[k] : 0.0f;
+                q[k] = (uint16_t)(f <= 0.0f ? 0 : f >= 65535.0f ? 65535 : (int)(f + 0.5f));
+            }
+        }
+        memcpy(dst, q, sizeof(q));
+    }
+
+    /* normals */
+    packed->normalBytes = normalFormat == FacetMeshNormal_Float32 ? 3 * (int)sizeof(float) :
+        normalFormat == FacetMeshNormal_Oct16 ? 2 : normalFormat == FacetMeshNormal_Oct32 ? 4 : 0;
+    packed->normals.resize((size_t)count * packed->normalBytes);
+    dst = packed->normals.data();
+    for (int v = 0; v < count && packed->normalBytes > 0; v++, dst += packed->normalBytes)
+    {
+        const float *n = &mesh.normals[(size_t)v * 3];
+        uint32_t u = 0, w = 0;
+        if (normalFormat == FacetMeshNormal_Float32)
+        {
+            memcpy(dst, n, 3 * sizeof(float));
+        }
+        else if (normalFormat == FacetMeshNormal_Oct16)
+        {
+            OctEncode(n, 8, &u, &w);
+            dst[0] = (unsigned char)u;
+            dst[1] = (unsigned char)w;
+        }
+        else
+        {
+            OctEncode(n, 16, &u, &w);
+            const uint16_t q[2] = { (uint16_t)u, (uint16_t)w };
+            memcpy(dst, q, sizeof(q));
+        }
+    }
+
+    /* indices */
+    packed->indexBytes = count <= 65536 ? 2 : 4;
+    packed->indices.resize(mesh.indices.size() * packed->indexBytes);
+    if (packed->indexBytes == 4)
+    {
+        if (!mesh.indices.empty())
+            memcpy(packed->indices.data(), mesh.indices.data(), packed->indices.size());
+    }
+    else
+    {
+        uint16_t *index = (uint16_t *)packed->indices.data();
+        for (size_t i = 0; i < mesh.indices.size(); i++)
+            index[i] = (uint16_t)mesh.indices[i];
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void PackedMeshPosition
+(
+const PackedMesh &packed,  /* I: packed mesh */
+int vertex,                /* I: vertex index */
+float position[3]          /* O: decoded position */
+)
+/*
+DESCRIPTION:
+   Decode the position of one vertex.
+*/
+{
+    const unsigned char *src = packed.positions.data() + (size_t)vertex * packed.positionBytes;
+    if (packed.positionFormat == FacetMeshPosition_Float32)
+    {
+        memcpy(position, src, 3 * sizeof(float));
+        return;
+    }
+
+    uint16_t q[3];
+    memcpy(q, src, sizeof(q));
+    for (int k = 0; k < 3; k++)
+    {
+        if (packed.positionFormat == FacetMeshPosition_Float16)
+            position[k] = packed.origin[k] + FacetMeshHalfToFloat(q[k]);
+        else
+            position[k] = packed.origin[k] + q[k] * packed.scale[k];
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+void PackedMeshNormal
+(
+const PackedMesh &packed,  /* I: packed mesh */
+int vertex,                /* I: vertex index */
+float normal[3]            /* O: decoded unit normal, 0 if the mesh has none */
+)
+/*
+DESCRIPTION:
+   Decode the normal of one vertex.
+*/
+{
+    const unsigned char *src = packed.normals.data() + (size_t)vertex * packed.normalBytes;
+    switch (packed.normalFormat)
+    {
+        case FacetMeshNormal_Float32:
+            memcpy(normal, src, 3 * sizeof(float));
+            break;
+        case FacetMeshNormal_Oct16:
+            OctDecode(src[0], src[1], 8, normal);
+            break;
+        case FacetMeshNormal_Oct32:
+        {
+            uint16_t q[2];
+            memcpy(q, src, sizeof(q));
+            OctDecode(q[0], q[1], 16, normal);
+            break;
+        }
+        default:
+            normal[0] = normal[1] = normal[2] = 0.0f;
+            break;
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+uint32_t PackedMeshIndex
+(
+const PackedMesh &packed,  /* I: packed mesh */
+int corner                 /* I: 3 * triangle + corner */
+)
+/*
+DESCRIPTION:
+   Read one entry of the index buffer.
+*/
+{
+    if (packed.indexBytes == 2)
+    {
+        uint16_t index;
+        memcpy(&index, packed.indices.data() + (size_t)corner * 2, sizeof(index));
+        return index;
+    }
+
+    uint32_t index;
+    memcpy(&index, packed.indices.data() + (size_t)corner * 4, sizeof(index));
+    return index;
+}
+
+/*******************************************************************/
+/* Function definition */
+int IndexedMeshOpenEdges
+(
+const IndexedMesh &mesh  /* I: indexed mesh */
+)
+/*
+DESCRIPTION:
+   Count the edges used by exactly one triangle, compared by welded point
+so that crease splits do not count. A closed solid welded correctly has
+none.
+*/
+{
+    std::vector<uint64_t> edges;
+    edges.reserve(mesh.indices.size());
+    for (size_t i = 0; i < mesh.indices.size(); i += 3)
+    {
+        for (int k = 0; k < 3; k++)
+        {
+            uint64_t a = mesh.pointIndex[mesh.indices[i + k]];
+            uint64_t b = mesh.pointIndex[mesh.indices[i + (k + 1) % 3]];
+            if (a > b)
+                std::swap(a, b);
+            edges.push_back(a << 32 | b);
+        }
+    }
+    std::sort(edges.begin(), edges.end());
+
+    int open = 0;
+    for (size_t i = 0; i < edges.size();)
+    {
+        size_t j = i + 1;
+        while (j < edges.size() && edges[j] == edges[i])
+            j++;
+        open += j - i == 1 ? 1 : 0;
+        i = j;
+    }
+    return open;
+}
+
+/*******************************************************************/
+/* Function definition */
+uint16_t FacetMeshHalfFromFloat
+(
+float value  /* I: single precision value */
+)
+/*
+DESCRIPTION:
+   Convert to IEEE half precision, rounding to nearest even. Values
+beyond the half range become infinity.
+*/
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    const uint32_t sign = (bits >> 16) & 0x8000u;
+    uint32_t magnitude = bits & 0x7FFFFFFFu;
+
+    if (magnitude >= 0x7F800000u)   /* infinity, NaN */
+        return (uint16_t)(sign | 0x7C00u | (magnitude > 0x7F800000u ? 0x200u : 0u));
+    if (magnitude >= 0x477FF000u)   /* rounds to >= 65536 */
+        return (uint16_t)(sign | 0x7C00u);
+
+    if (magnitude < 0x38800000u)    /* below 2^-14: subnormal half */
+    {
+        float f;
+        memcpy(&f, &magnitude, sizeof(f));
+        return (uint16_t)(sign | (uint32_t)lrintf(f * 16777216.0f));
+    }
+
+    /* rebias the exponent, round the 13 dropped mantissa bits to even */
+    magnitude += 0xC8000FFFu + ((magnitude >> 13) & 1u);
+    return (uint16_t)(sign | (magnitude >> 13));
+}
+
+/*******************************************************************/
+/* Function definition */
+float FacetMeshHalfToFloat
+(
+uint16_t half  /* I: half precision value */
+)
+/*
+DESCRIPTION:
+   Convert IEEE half precision to single precision (exact).
+*/
+{
+    const uint32_t sign = (uint32_t)(half & 0x8000u) << 16;
+    const uint32_t exponent = (half >> 10) & 0x1Fu;
+    const uint32_t mantissa = half & 0x3FFu;
+
+    if (exponent == 0)
+    {
+        const float f = mantissa * (1.0f / 16777216.0f);
+        return sign ? -f : f;
+    }
+
+    const uint32_t bits = exponent == 31 ? (sign | 0x7F800000u | (mantissa << 13)) :
+        (sign | ((exponent + 112) << 23) | (mantissa << 13));
+    float f;
+    memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+/*******************************************************************/
+/* Function definition */
+void OctEncode
+(
+const float normal[3],   /* I: unit normal */
+int bits,                /* I: bits per component */
+uint32_t *u,             /* O: first component */
+uint32_t *v              /* O: second component */
+)
+/*
+DESCRIPTION:
+   Octahedral encoding: project the unit sphere onto the octahedron
+|x|+|y|+|z|=1 and unfold the lower half over the corners of the square.
+*/
+{
+    const float sum = fabsf(normal[0]) + fabsf(normal[1]) + fabsf(normal[2]);
+    float x = sum > 0.0f ? normal[0] / sum : 0.0f;
+    float y = sum > 0.0f ? normal[1] / sum : 0.0f;
+    if (sum > 0.0f && normal[2] < 0.0f)
+    {
+        const float ox = x;
+        x = (1.0f - fabsf(y)) * (ox >= 0.0f ? 1.0f : -1.0f);
+        y = (1.0f - fabsf(ox)) * (y >= 0.0f ? 1.0f : -1.0f);
+    }
+
+    const float range = (float)((1u << bits) - 1);
+    *u = (uint32_t)lrintf((x * 0.5f + 0.5f) * range);
+    *v = (uint32_t)lrintf((y * 0.5f + 0.5f) * range);
+}
+
+/*******************************************************************/
+/* Function definition */
+void OctDecode
+(
+uint32_t u,        /* I: first component */
+uint32_t v,        /* I: second component */
+int bits,          /* I: bits per component */
+float normal[3]    /* O: unit normal */
+)
+/*
+DESCRIPTION:
+   Inverse of OctEncode().
+*/
+{
+    const float range = (float)((1u << bits) - 1);
+    float x = u / range * 2.0f - 1.0f;
+    float y = v / range * 2.0f - 1.0f;
+    const float z = 1.0f - fabsf(x) - fabsf(y);
+    if (z < 0.0f)
+    {
+        const float ox = x;
+        x = (1.0f - fabsf(y)) * (ox >= 0.0f ? 1.0f : -1.0f);
+        y = (1.0f - fabsf(ox)) * (y >= 0.0f ? 1.0f : -1.0f);
+    }
+
+    const float len = sqrtf(x * x + y * y + z * z);
+    normal[0] = x / len;
+    normal[1] = y / len;
+    normal[2] = z / len;
+}
@@ -0,0 +1,263 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* ZW3D API includes */
+#include "zwapi_entity.h"
+#include "zwapi_face.h"
+#include "zwapi_shape.h"
+#include "zwapi_userinput.h"
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+#include "..\inc\FacetMeshWeldPr.h"
+#include "..\inc\FacetMesh.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define MESSAGE_SIZE 256
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: totals over all picked shapes */
+struct WeldTotals
+{
+    int faces;
+    int inputVertices;
+    int inputTriangles;
+    int points;
+    int vertices;
+    int triangles;
+    int openEdges;
+    size_t facetBytes;     /* strip lists, vertices and normals as returned by the host */
+    size_t soupBytes;      /* svxTriangle list of cvxPartFacetsConvertToSTL() */
+    size_t indexedBytes;   /* float positions and normals, 32 bit indices */
+    size_t packedBytes[3]; /* see PackFormats */
+    double packedError[3]; /* largest position error */
+    double normalError[3]; /* largest normal angle in degrees */
+    double weldTime;
+};
+
+/*******************************************************************/
+/* Function declarations */
+static int FacetMeshWeld(void);
+static int ShapeMeshMake(const szwEntityHandle &shape, FacetMeshWelder *welder, IndexedMesh *mesh,
+    WeldTotals *totals);
+static void PackedMeshCompare(const IndexedMesh &mesh, const PackedMesh &packed, double *position,
+    double *normal);
+
+/* DESCRIPTION: packed formats compared by the command */
+static const FacetMeshPositionFormat PackPositions[3] =
+    { FacetMeshPosition_Float32, FacetMeshPosition_Float16, FacetMeshPosition_Quantized16 };
+static const FacetMeshNormalFormat PackNormals[3] =
+    { FacetMeshNormal_Oct32, FacetMeshNormal_Oct16, FacetMeshNormal_Oct32 };
+static const char *PackNames[3] = { "float32 + oct32", "float16 + oct16", "quantized16 + oct32" };
+
+/*******************************************************************/
+/* Function definition */
+int RegisterFacetMeshWeld
+(
+void
+)
+/*
+DESCRIPTION:
+   Register the commands of the facet mesh welder.
+*/
+{
+    /* Weld the facets of the picked shapes into indexed meshes by entering "~FacetMeshWeld" */
+    ZwCommandFunctionLoad("FacetMeshWeld", (void *)FacetMeshWeld, ZW_LICENSE_CODE_GENERAL);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int UnloadFacetMeshWeld
+(
+void
+)
+/*
+DESCRIPTION:
+   Unload the commands of the facet mesh welder.
+*/
+{
+    ZwCommandFunctionUnload("FacetMeshWeld");
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int ShapeMeshMake
+(
+const szwEntityHandle &shape,  /* I: shape */
+FacetMeshWelder *welder,       /* I: welder */
+IndexedMesh *mesh,             /* O: welded mesh of the shape */
+WeldTotals *totals             /* I/O: statistics */
+)
+/*
+DESCRIPTION:
+   Get the facets of all faces of a shape with ZwFaceListFacetsGet() and
+weld them into one indexed mesh.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    int countFace = 0;
+    szwEntityHandle *faces = nullptr;
+    if (ZwShapeFaceListGet(shape, &countFace, &faces) || countFace <= 0)
+        return 1;
+
+    szwRefineFacetsOfMultiFace refine{};
+    refine.countFace = countFace;
+    refine.faceHandle = faces;
+    refine.type = ZW_FACETS_TOLORANCE_PIXEL;
+    refine.edgeTolorance = 1.0;
+    refine.facetTolorance = 1.0;
+    refine.angleTolorance = 5.0;
+    refine.surfaceTolorance = 1.0;
+
+    int countFacets = 0;
+    szwFacets *facets = nullptr;
+    ezwErrors ret = ZwFaceListFacetsGet(refine, &countFacets, &facets);
+    ZwEntityHandleListFree(countFace, &faces);
+    if (ret)
+        return 1;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < countFacets; i++)
+        welder->AddFacets(facets[i]);
+    const int inputVertices = welder->InputVertexCount();
+    const int inputTriangles = welder->InputTriangleCount();
+    const int points = welder->PointCount();
+    welder->Finish(mesh);
+    totals->weldTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    for (int i = 0; i < countFacets; i++)
+    {
+        int strips = 0;
+        for (int k = 0, j = 0; k < facets[i].numberTriangleStrip; k++)
+        {
+            strips += facets[i].triangleStrip[j] + 1;
+            j += facets[i].triangleStrip[j] + 1;
+        }
+        totals->facetBytes += strips * sizeof(int) +
+            facets[i].numberVertex * sizeof(szwPointf) * (facets[i].normal ? 2 : 1);
+        ZwFaceFacetsDataFree(&facets[i]);
+    }
+    ZwMemoryFree((void **)&facets);
+
+    totals->faces += countFacets;
+    totals->inputVertices += inputVertices;
+    totals->inputTriangles += inputTriangles;
+    totals->points += points;
+    totals->vertices += mesh->VertexCount();
+    totals->triangles += mesh->TriangleCount();
+    totals->openEdges += IndexedMeshOpenEdges(*mesh);
+    totals->soupBytes += inputTriangles * sizeof(svxTriangle);
+    totals->indexedBytes += mesh->Bytes();
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void PackedMeshCompare
+(
+const IndexedMesh &mesh,    /* I: indexed mesh */
+const PackedMesh &packed,   /* I: packed copy of the mesh */
+double *position,           /* I/O: largest position error */
+double *normal              /* I/O: largest normal angle in degrees */
+)
+/*
+DESCRIPTION:
+   Decode a packed mesh and measure the error against the original.
+*/
+{
+    for (int v = 0; v < packed.vertexCount; v++)
+    {
+        float p[3], n[3];
+        PackedMeshPosition(packed, v, p);
+        PackedMeshNormal(packed, v, n);
+
+        const float *q = &mesh.positions[(size_t)v * 3];
+        const double dist = sqrt((double)(p[0] - q[0]) * (p[0] - q[0]) + (double)(p[1] - q[1]) * (p[1] - q[1]) +
+            (double)(p[2] - q[2]) * (p[2] - q[2]));
+        *position = dist > *position ? dist : *position;
+
+        const float *m = &mesh.normals[(size_t)v * 3];
+        double dot = (double)n[0] * m[0] + (double)n[1] * m[1] + (double)n[2] * m[2];
+        dot = dot > 1.0 ? 1.0 : dot < -1.0 ? -1.0 : dot;
+        const double angle = acos(dot) * 57.29577951308232;
+        *normal = angle > *normal ? angle : *normal;
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+int FacetMeshWeld
+(
+void
+)
+/*
+DESCRIPTION:
+   Weld the display facets of the picked shapes into one indexed mesh per
+shape and report the memory of the strip lists, of the triangle soup of
+cvxPartFacetsConvertToSTL(), of the indexed mesh and of its packed forms.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    int count = 0;
+    szwEntityHandle *shapes = nullptr;
+    if (ZwEntityListGetByPick("Select shapes to weld", ZW_INPUT_SHAPE, 0, &count, &shapes))
+        return 1;
+
+    double tolerance = FACET_MESH_TOLERANCE;
+    if (cvxGetNumber("Weld tolerance (default 1e-5)", &tolerance) || tolerance <= 0.0)
+        tolerance = FACET_MESH_TOLERANCE;
+
+    WeldTotals totals{};
+    FacetMeshWelder welder(tolerance);
+    IndexedMesh mesh;
+    PackedMesh packed;
+    char message[MESSAGE_SIZE];
+
+    for (int i = 0; i < count; i++)
+    {
+        if (ShapeMeshMake(shapes[i], &welder, &mesh, &totals))
+        {
+            cvxMsgDisp("Facets of a shape could not be read.");
+            continue;
+        }
+
+        for (int k = 0; k < 3; k++)
+        {
+            PackedMeshMake(mesh, PackPositions[k], PackNormals[k], &packed);
+            totals.packedBytes[k] += packed.Bytes();
+            PackedMeshCompare(mesh, packed, &totals.packedError[k], &totals.normalError[k]);
+        }
+    }
+    ZwEntityHandleListFree(count, &shapes);
+
+    sprintf_s(message, MESSAGE_SIZE, "%d shapes, %d faces: %d strip vertices, %d triangles -> %d points, %d vertices, %d triangles, %d open edges, weld %.1f ms",
+        count, totals.faces, totals.inputVertices, totals.inputTriangles, totals.points, totals.vertices,
+        totals.triangles, totals.openEdges, totals.weldTime * 1.0e3);
+    cvxMsgDisp(message);
+
+    sprintf_s(message, MESSAGE_SIZE, "Memory: facet strips %.2f MB, STL triangle soup %.2f MB, indexed mesh %.2f MB",
+        totals.facetBytes / 1048576.0, totals.soupBytes / 1048576.0, totals.indexedBytes / 1048576.0);
+    cvxMsgDisp(message);
+
+    for (int k = 0; k < 3; k++)
+    {
+        sprintf_s(message, MESSAGE_SIZE, "Packed %s: %.2f MB (%.1f%% of soup), max position error %.2e, max normal error %.3f deg",
+            PackNames[k], totals.packedBytes[k] / 1048576.0,
+            totals.soupBytes ? 100.0 * totals.packedBytes[k] / totals.soupBytes : 0.0,
+            totals.packedError[k], totals.normalError[k]);
+        cvxMsgDisp(message);
+    }
+    return 0;
+}
@@ -0,0 +1,126 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+#pragma once
+
+/* ZW3D API includes */
+#include "zwapi_util.h"
+#include "zwapi_brep_data.h"
+
+/* Application includes */
+#include <stdio.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+/*******************************************************************/
+/* Constant definitions */
+#define MESH_STREAM_BUFFER_BYTES (1024 * 1024)  /* default size of each output buffer */
+#define MESH_STREAM_RECORD_BYTES 512            /* largest single record written at once */
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: output file format */
+enum MeshStreamFormat
+{
+    MeshStream_BinaryStl = 0,  /* 50 bytes per triangle, count patched on Close() */
+    MeshStream_AsciiStl = 1,   /* "solid ... endsolid" */
+    MeshStream_3mf = 2,        /* 3MF package, single mesh object, stored (uncompressed) zip entries */
+};
+
+/*
+DESCRIPTION:
+   Buffered output file with a fixed buffer. Records are formatted in place
+with Reserve()/Commit(), the buffer is written to disk when a record does
+not fit. A running CRC-32 of the committed bytes can be kept for zip
+entries.
+*/
+class MeshStreamFile
+{
+public:
+    MeshStreamFile();
+    ~MeshStreamFile();
+
+    int Open(const char *path, size_t bufferBytes);
+    int Close(void);
+    int Write(const void *data, size_t bytes);
+    char *Reserve(size_t bytes);
+    void Commit(size_t bytes);
+    int Patch(uint64_t offset, const void *data, size_t bytes);
+    int Flush(void);
+
+    int IsOpen(void) const { return m_file != nullptr; }
+    int Failed(void) const { return m_failed; }
+    uint64_t Offset(void) const { return m_offset; }
+    size_t Capacity(void) const { return m_buffer.size(); }
+    void CrcStart(void) { m_crc = 0xFFFFFFFFu; m_crcOn = 1; }
+    uint32_t CrcStop(void) { m_crcOn = 0; return ~m_crc; }
+
+private:
+    FILE *m_file;
+    std::vector<char> m_buffer;
+    size_t m_used;          /* bytes in the buffer */
+    uint64_t m_offset;      /* logical end of file */
+    uint32_t m_crc;         /* running CRC-32 (inverted) */
+    int m_crcOn;            /* 1 while the CRC is kept */
+    int m_failed;           /* 1 after any i/o error */
+};
+
+/*
+DESCRIPTION:
+   Streaming mesh writer: facets are converted and written face by face as
+they arrive, so memory use is bounded by the output buffers whatever the
+size of the part.
+
+   Binary STL writes a zero triangle count first and patches it when the
+file is closed. 3MF needs all vertices of a mesh before its triangles, so
+triangles are spooled to a temporary file beside the output (with its own
+buffer) and appended to the model part on Close(); the zip local headers
+are patched in place, so no data descriptors are needed.
+*/
+class MeshStreamWriter
+{
+public:
+    MeshStreamWriter(size_t bufferBytes = MESH_STREAM_BUFFER_BYTES);
+    ~MeshStreamWriter();
+
+    int Open(const char *path, MeshStreamFormat format, const char *name);
+    int AddFacets(const szwFacets &facets);
+    int AddFacets(const svxFacets &facets);
+    int AddTriangles(int count, const svxTriangle *triangles);
+    int Close(void);
+
+    uint64_t TriangleCount(void) const { return m_triangles; }
+    uint64_t BytesWritten(void) const { return m_bytes; }
+    size_t BufferBytes(void) const { return m_file.Capacity() + m_spool.Capacity(); }
+
+private:
+    struct ZipEntry
+    {
+        std::string name;
+        uint64_t offset;   /* local header */
+        uint64_t size;
+        uint32_t crc;
+    };
+
+    int AddStrips(int numStrips, const int *strips, int numVertex, const svxPointf *vertex);
+    int TriangleWrite(const float *a, const float *b, const float *c);
+    int VertexWrite(const float *p);
+    int IndexWrite(uint64_t a, uint64_t b, uint64_t c);
+    int ZipEntryBegin(const char *name);
+    int ZipEntryEnd(void);
+    int ZipEntryText(const char *name, const char *text);
+    int ZipDirectoryWrite(void);
+    void Discard(void);
+
+    MeshStreamFile m_file;             /* output */
+    MeshStreamFile m_spool;            /* 3MF triangles */
+    std::string m_path, m_spoolPath, m_name;
+    MeshStreamFormat m_format;
+    size_t m_bufferBytes;
+    uint64_t m_triangles;              /* triangles written */
+    uint64_t m_vertices;               /* 3MF vertices written */
+    uint64_t m_bytes;                  /* size of the finished file */
+    std::vector<ZipEntry> m_entries;
+};
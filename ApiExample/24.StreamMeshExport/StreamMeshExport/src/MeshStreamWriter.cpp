@@ -0,0 +1,978 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* Application includes */
+#include <math.h>
+#include <string.h>
+#include <charconv>
+#include "..\inc\MeshStreamWriter.h"
+
+#if defined(_MSC_VER)
+#define MESH_STREAM_SEEK _fseeki64
+#else
+#define MESH_STREAM_SEEK fseeko
+#endif
+
+/*******************************************************************/
+/* Constant definitions */
+#define STL_HEADER_BYTES 80
+#define STL_TRIANGLE_BYTES 50
+#define STL_TRIANGLE_LIMIT 0xFFFFFFFFull   /* largest triangle count of the 32-bit field of binary STL */
+#define ZIP_LOCAL_HEADER_BYTES 30
+#define ZIP_CENTRAL_HEADER_BYTES 46
+#define ZIP_END_BYTES 22
+#define ZIP_DOS_DATE 0x0021            /* 1980-01-01, entries carry no real time */
+#define ZIP_LIMIT 0xFFFFFFFFull        /* largest size or offset without zip64 */
+
+/*******************************************************************/
+/* Data definitions */
+static const char ContentTypes3mf[] =
+    "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+    "<Types xmlns=\"http://schemas.openxmlformats.org/package/2006/content-types\">"
+    "<Default Extension=\"rels\" ContentType=\"application/vnd.openxmlformats-package.relationships+xml\"/>"
+    "<Default Extension=\"model\" ContentType=\"application/vnd.ms-package.3dmanufacturing-3dmodel+xml\"/>"
+    "</Types>\n";
+
+static const char Relationships3mf[] =
+    "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+    "<Relationships xmlns=\"http://schemas.openxmlformats.org/package/2006/relationships\">"
+    "<Relationship Target=\"/3D/3dmodel.model\" Id=\"rel0\" "
+    "Type=\"http://schemas.microsoft.com/3dmanufacturing/2013/01/3dmodel\"/>"
+    "</Relationships>\n";
+
+/*******************************************************************/
+/* Function declarations */
+static const uint32_t *CrcTable(void);
+static uint32_t CrcUpdate(uint32_t crc, const unsigned char *data, size_t bytes);
+static char *TextPut(char *p, const char *text);
+static char *FloatPut(char *p, float value);
+static char *IndexPut(char *p, uint64_t value);
+static void Put16(unsigned char *p, uint32_t value);
+static void Put32(unsigned char *p, uint32_t value);
+static void TriangleNormal(const float *a, const float *b, const float *c, float normal[3]);
+
+/*******************************************************************/
+/* Function definition */
+MeshStreamFile::MeshStreamFile()
+    : m_file(nullptr), m_used(0), m_offset(0), m_crc(0xFFFFFFFFu), m_crcOn(0), m_failed(0)
+/*
+DESCRIPTION:
+   Create a closed file.
+*/
+{
+}
+
+/*******************************************************************/
+/* Function definition */
+MeshStreamFile::~MeshStreamFile()
+/*
+DESCRIPTION:
+   Write the buffer and close the file.
+*/
+{
+    Close();
+}
+
+/*******************************************************************/
+/* Function definition */
+int MeshStreamFile::Open
+(
+const char *path,     /* I: file path, created or truncated */
+size_t bufferBytes    /* I: buffer size (>= MESH_STREAM_RECORD_BYTES) */
+)
+/*
+DESCRIPTION:
+   Create a file for writing.
+
+   Return 1 if the file cannot be created, else 0.
+*/
+{
+    Close();
+    if (fopen_s(&m_file, path, "wb") || m_file == nullptr)
+    {
+        m_file = nullptr;
+        return 1;
+    }
+
+    m_buffer.resize(bufferBytes < MESH_STREAM_RECORD_BYTES ? MESH_STREAM_RECORD_BYTES : bufferBytes);
+    m_used = 0;
+    m_offset = 0;
+    m_crcOn = 0;
+    m_failed = 0;
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int MeshStreamFile::Close
+(
+void
+)
+/*
+DESCRIPTION:
+   Write the buffer, close the file and release the buffer.
+
+   Return 1 if any write failed, else 0.
+*/
+{
+    if (m_file)
+    {
+        Flush();
+        if (fclose(m_file))
+            m_failed = 1;
+        m_file = nullptr;
+    }
+    std::vector<char>().swap(m_buffer);
+    m_used = 0;
+    return m_failed;
+}
+
+/*******************************************************************/
+/* Function definition */
+int MeshStreamFile::Flush
+(
+void
+)
+/*
+DESCRIPTION:
+   Write the buffer to disk.
+
+   Return 1 if any write failed, else 0.
+*/
+{
+    if (m_file && m_used > 0 && fwrite(m_buffer.data(), 1, m_used, m_file) != m_used)
+        m_failed = 1;
+    m_used = 0;
+    return m_failed;
+}
+
+/*******************************************************************/
+/* Function definition */
+int MeshStreamFile::Write
+(
+const void *data,   /* I: bytes to write */
+size_t bytes        /* I: number of bytes */
+)
+/*
+DESCRIPTION:
+   Append bytes. Blocks larger than the buffer bypass it.
+
+   Return 1 if any write failed, else 0.
+*/
+{
+    if (m_file == nullptr)
+        return 1;
+
+    if (m_crcOn)
+        m_crc = CrcUpdate(m_crc, (const unsigned char *)data, bytes);
+    m_offset += bytes;
+
+    if (bytes > m_buffer.size() - m_used)
+        Flush();
+    if (bytes > m_buffer.size())
+    {
+        if (fwrite(data, 1, bytes, m_file) != bytes)
+            m_failed = 1;
+        return m_failed;
+    }
+
+    memcpy(m_buffer.data() + m_used, data, bytes);
+    m_used += bytes;
+    return m_failed;
+}
+
+/*******************************************************************/
+/* Function definition */
+char *MeshStreamFile::Reserve
+(
+size_t bytes   /* I: space needed (<= buffer size) */
+)
+/*
+DESCRIPTION:
+   Make room for a record of at most "bytes" bytes in the buffer. The
+record is formatted at the returned address and added with Commit().
+*/
+{
+    if (bytes > m_buffer.size() - m_used)
+        Flush();
+    return m_buffer.data() + m_used;
+}
+
+/*******************************************************************/
+/* Function definition */
+void MeshStreamFile::Commit
+(
+size_t bytes   /* I: bytes formatted after Reserve() */
+)
+/*
+DESCRIPTION:
+   Add a record formatted in the buffer.
+*/
+{
+    if (m_crcOn)
+        m_crc = CrcUpdate(m_crc, (const unsigned char *)m_buffer.data() + m_used, bytes);
+    m_used += bytes;
+    m_offset += bytes;
+}
+
+/*******************************************************************/
+/* Function definition */
+int MeshStreamFile::Patch
+(
+uint64_t offset,    /* I: file offset of data already written */
+const void *data,   /* I: new bytes */
+size_t bytes        /* I: number of bytes */
+)
+/*
+DESCRIPTION:
+   Overwrite bytes written earlier (counts and sizes known only at the end).
+The CRC is not affected.
+
+   Return 1 if any write failed, else 0.
+*/
+{
+    if (m_file == nullptr || offset + bytes > m_offset)
+        return 1;
+
+    Flush();
+    if (MESH_STREAM_SEEK(m_file, (long long)offset, SEEK_SET) ||
+        fwrite(data, 1, bytes, m_file) != bytes ||
+        MESH_STREAM_SEEK(m_file, 0, SEEK_END))
+        m_failed = 1;
+    return m_failed;
+}
+
+/*******************************************************************/
+/* Function definition */
+MeshStreamWriter::MeshStreamWriter
+(
+size_t bufferBytes   /* I: size of each output buffer */
+)
+/*
+DESCRIPTION:
+   Create a writer, Open() must be called before adding facets.
+*/
+    : m_format(MeshStream_BinaryStl), m_bufferBytes(bufferBytes), m_triangles(0), m_vertices(0), m_bytes(0)
+{
+}
+
+/*******************************************************************/
+/* Function definition */
+MeshStreamWriter::~MeshStreamWriter()
+/*
+DESCRIPTION:
+   Close the files of an unfinished export.
+*/
+{
+    Discard();
+}
+
+/*******************************************************************/
+/* Function definition */
+int MeshStreamWriter::Open
+(
+const char *path,          /* I: output file */
+MeshStreamFormat format,   /* I: file format */
+const char *name           /* I: name of the solid / 3MF title */
+)
+/*
+DESCRIPTION:
+   Create the output file and write the file header.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    Discard();
+    m_format = format;
+    m_path = path;
+    m_name = name ? name : "";
+    m_triangles = m_vertices = m_bytes = 0;
+    m_entries.clear();
+
+    if (m_file.Open(path, m_bufferBytes))
+        return 1;
+
+    if (format == MeshStream_BinaryStl)
+    {
+        char header[STL_HEADER_BYTES + 4] = {};
+        snprintf(header, STL_HEADER_BYTES, "ZW3D binary STL %s", m_name.c_str());
+        m_file.Write(header, sizeof(header));
+    }
+    else if (format == MeshStream_AsciiStl)
+    {
+        /* the solid name is a single token */
+        for (char &c : m_name)
+        {
+            if ((unsigned char)c <= ' ')
+                c = '_';
+        }
+        m_file.Write("solid ", 6);
+        m_file.Write(m_name.data(), m_name.size());
+        m_file.Write("\n", 1);
+    }
+    else
+    {
+        m_spoolPath = m_path + ".triangles.tmp";
+        if (m_spool.Open(m_spoolPath.c_str(), m_bufferBytes))
+        {
+            Discard();
+            return 1;
+        }
+
+        std::string title;
+        for (char c : m_name)
+        {
+            switch (c)
+            {
+                case '&': title += "&amp;"; break;
+                case '<': title += "&lt;"; break;
+                case '>': title += "&gt;"; break;
+                case '"': title += "&quot;"; break;
+                default: title += c; break;
+            }
+        }
+
+        if (ZipEntryText("[Content_Types].xml", ContentTypes3mf) || ZipEntryText("_rels/.rels", Relationships3mf) ||
+            ZipEntryBegin("3D/3dmodel.model"))
+        {
+            Discard();
+            return 1;
+        }
+        const std::string header = std::string("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+            "<model unit=\"millimeter\" xml:lang=\"en-US\" "
+            "xmlns=\"http://schemas.microsoft.com/3dmanufacturing/core/2015/02\">\n"
+            "<metadata name=\"Title\">") + title + "</metadata>\n"
+            "<resources>\n<object id=\"1\" type=\"model\">\n<mesh>\n<vertices>\n";
+        m_file.Write(header.data(), header.size());
+    }
+
+    if (m_file.Failed())
+    {
+        Discard();
+        return 1;
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int MeshStreamWriter::AddFacets
+(
+const szwFacets &facets  /* I: facets of one face */
+)
+/*
+DESCRIPTION:
+   Write the triangle strips of one face.
+
+   Return 1 if the facets are invalid or a write failed, else 0.
+*/
+{
+    return AddStrips(facets.numberTriangleStrip, facets.triangleStrip, facets.numberVertex, facets.vertex);
+}
+
+/*******************************************************************/
+/* Function definition */
+int MeshStreamWriter::AddFacets
+(
+const svxFacets &facets  /* I: facets of one face or block */
+)
+/*
+DESCRIPTION:
+   Write the triangle strips of one face or facet block.
+
+   Return 1 if the facets are invalid or a write failed, else 0.
+*/
+{
+    return AddStrips(facets.numTriStrip, facets.TriStrip, facets.numVertex, facets.Vertex);
+}
+
+/*******************************************************************/
+/* Function definition */
+int MeshStreamWriter::AddStrips
+(
+int numStrips,              /* I: number of strips */
+const int *strips,          /* I: count-prefixed strip list */
+int numVertex,              /* I: number of vertices */
+const svxPointf *vertex     /* I: vertex coordinates */
+)
+/*
+DESCRIPTION:
+   Write the triangles of a strip list. Triangles with a repeated vertex
+are skipped (3MF does not allow them).
+
+   Return 1 if the strip list is invalid or a write failed, else 0.
+*/
+{
+    if (!m_file.IsOpen() || numStrips < 0 || numVertex < 0)
+        return 1;
+    if ((numStrips > 0 && strips == nullptr) || (numVertex > 0 && vertex == nullptr))
+        return 1;
+
+    /* validate first, nothing is written for a bad list */
+    const int *s = strips;
+    for (int k = 0; k < numStrips; k++)
+    {
+        const int n = *s++;
+        if (n < 0)
+            return 1;
+        for (int j = 0; j < n; j++)
+        {
+            if (s[j] < 0 || s[j] >= numVertex)
+                return 1;
+        }
+        s += n;
+    }
+
+    const uint64_t base = m_vertices;
+    if (m_format == MeshStream_3mf)
+    {
+        for (int i = 0; i < numVertex; i++)
+            VertexWrite(&vertex[i].x);
+    }
+
+    s = strips;
+    for (int k = 0; k < numStrips; k++)
+    {
+        const int n = *s++;
+        for (int j = 0; j + 2 < n; j++)
+        {
+            /* every second triangle of a strip is reversed */
+            const int a = s[(j & 1) ? j + 1 : j], b = s[(j & 1) ? j : j + 1], c = s[j + 2];
+            if (a == b || b == c || c == a)
+                continue;
+            if (m_format == MeshStream_3mf)
+                IndexWrite(base + a, base + b, base + c);
+            else
+                TriangleWrite(&vertex[a].x, &vertex[b].x, &vertex[c].x);
+        }
+        s += n;
+    }
+    return m_file.Failed() || m_spool.Failed();
+}
+
+/*******************************************************************/
+/* Function definition */
+int MeshStreamWriter::AddTriangles
+(
+int count,                        /* I: number of triangles */
+const svxTriangle *triangles      /* I: triangles (svxSTL::facets) */
+)
+/*
+DESCRIPTION:
+   Write a triangle list. 3MF gets three vertices per triangle.
+
+   Return 1 if a write failed, else 0.
+*/
+{
+    if (!m_file.IsOpen() || count < 0 || (count > 0 && triangles == nullptr))
+        return 1;
+
+    for (int i = 0; i < count; i++)
+    {
+        float p[3][3];
+        for (int k = 0; k < 3; k++)
+        {
+            p[k][0] = (float)triangles[i].Pnt[k].x;
+            p[k][1] = (float)triangles[i].Pnt[k].y;
+            p[k][2] = (float)triangles[i].Pnt[k].z;
+        }
+
+        if (m_format == MeshStream_3mf)
+        {
+            const uint64_t base = m_vertices;
+            VertexWrite(p[0]);
+            VertexWrite(p[1]);
+            VertexWrite(p[2]);
+            IndexWrite(base, base + 1, base + 2);
+        }
+        else
+        {
+            TriangleWrite(p[0], p[1], p[2]);
+        }
+    }
+    return m_file.Failed() || m_spool.Failed();
+}
+
+/*******************************************************************/
+/* Function definition */
+int MeshStreamWriter::TriangleWrite
+(
+const float *a,   /* I: vertex 1 (x,y,z) */
+const float *b,   /* I: vertex 2 */
+const float *c    /* I: vertex 3 */
+)
+/*
+DESCRIPTION:
+   Write one STL facet.
+*/
+{
+    float normal[3];
+    TriangleNormal(a, b, c, normal);
+    m_triangles++;
+
+    if (m_format == MeshStream_BinaryStl)
+    {
+        char *p = m_file.Reserve(STL_TRIANGLE_BYTES);
+        memcpy(p, normal, 12);
+        memcpy(p + 12, a, 12);
+        memcpy(p + 24, b, 12);
+        memcpy(p + 36, c, 12);
+        p[48] = p[49] = 0;
+        m_file.Commit(STL_TRIANGLE_BYTES);
+        return 0;
+    }
+
+    char *start = m_file.Reserve(MESH_STREAM_RECORD_BYTES);
+    char *p = TextPut(start, "facet normal ");
+    p = FloatPut(p, normal[0]); *p++ = ' ';
+    p = FloatPut(p, normal[1]); *p++ = ' ';
+    p = FloatPut(p, normal[2]);
+    p = TextPut(p, "\n  outer loop\n");
+    const float *v[3] = { a, b, c };
+    for (int k = 0; k < 3; k++)
+    {
+        p = TextPut(p, "    vertex ");
+        p = FloatPut(p, v[k][0]); *p++ = ' ';
+        p = FloatPut(p, v[k][1]); *p++ = ' ';
+        p = FloatPut(p, v[k][2]); *p++ = '\n';
+    }
+    p = TextPut(p, "  endloop\nendfacet\n");
+    m_file.Commit(p - start);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int MeshStreamWriter::VertexWrite
+(
+const float *v   /* I: vertex (x,y,z) */
+)
+/*
+DESCRIPTION:
+   Write one 3MF vertex to the model part.
+*/
+{
+    char *start = m_file.Reserve(MESH_STREAM_RECORD_BYTES);
+    char *p = TextPut(start, "<vertex x=\"");
+    p = FloatPut(p, v[0]);
+    p = TextPut(p, "\" y=\"");
+    p = FloatPut(p, v[1]);
+    p = TextPut(p, "\" z=\"");
+    p = FloatPut(p, v[2]);
+    p = TextPut(p, "\"/>\n");
+    m_file.Commit(p - start);
+    m_vertices++;
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int MeshStreamWriter::IndexWrite
+(
+uint64_t a,   /* I: vertex 1 */
+uint64_t b,   /* I: vertex 2 */
+uint64_t c    /* I: vertex 3 */
+)
+/*
+DESCRIPTION:
+   Write one 3MF triangle to the spool file.
+*/
+{
+    char *start = m_spool.Reserve(MESH_STREAM_RECORD_BYTES);
+    char *p = TextPut(start, "<triangle v1=\"");
+    p = IndexPut(p, a);
+    p = TextPut(p, "\" v2=\"");
+    p = IndexPut(p, b);
+    p = TextPut(p, "\" v3=\"");
+    p = IndexPut(p, c);
+    p = TextPut(p, "\"/>\n");
+    m_spool.Commit(p - start);
+    m_triangles++;
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int MeshStreamWriter::Close
+(
+void
+)
+/*
+DESCRIPTION:
+   Finish the file: patch the STL triangle count, or append the spooled
+3MF triangles and write the zip directory.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    if (!m_file.IsOpen())
+        return 1;
+
+    int ret = 0;
+    if (m_format == MeshStream_BinaryStl)
+    {
+        if (m_triangles > STL_TRIANGLE_LIMIT)
+            ret = 1;
+        unsigned char count[4];
+        Put32(count, (uint32_t)m_triangles);
+        ret |= m_file.Patch(STL_HEADER_BYTES, count, sizeof(count));
+    }
+    else if (m_format == MeshStream_AsciiStl)
+    {
+        m_file.Write("endsolid ", 9);
+        m_file.Write(m_name.data(), m_name.size());
+        m_file.Write("\n", 1);
+    }
+    else
+    {
+        static const char middle[] = "</vertices>\n<triangles>\n";
+        static const char trailer[] = "</triangles>\n</mesh>\n</object>\n</resources>\n"
+            "<build>\n<item objectid=\"1\"/>\n</build>\n</model>\n";
+        m_file.Write(middle, sizeof(middle) - 1);
+
+        /* copy the spooled triangles through the output buffer */
+        ret |= m_spool.Close();
+        FILE *spool = nullptr;
+        if (ret == 0 && fopen_s(&spool, m_spoolPath.c_str(), "rb") == 0 && spool)
+        {
+            for (;;)
+            {
+                char *p = m_file.Reserve(m_file.Capacity());
+                const size_t bytes = fread(p, 1, m_file.Capacity(), spool);
+                if (bytes == 0)
+                    break;
+                m_file.Commit(bytes);
+            }
+            ret |= ferror(spool) ? 1 : 0;
+            fclose(spool);
+        }
+        else
+        {
+            ret = 1;
+        }
+        remove(m_spoolPath.c_str());
+
+        m_file.Write(trailer, sizeof(trailer) - 1);
+        ret |= ZipEntryEnd();
+        ret |= ZipDirectoryWrite();
+    }
+
+    m_bytes = m_file.Offset();
+    ret |= m_file.Close();
+    return ret;
+}
+
+/*******************************************************************/
+/* Function definition */
+void MeshStreamWriter::Discard
+(
+void
+)
+/*
+DESCRIPTION:
+   Close the files of an unfinished export and remove the spool file.
+*/
+{
+    if (m_spool.IsOpen())
+    {
+        m_spool.Close();
+        remove(m_spoolPath.c_str());
+    }
+    m_file.Close();
+}
+
+/*******************************************************************/
+/* Function definition */
+int MeshStreamWriter::ZipEntryBegin
+(
+const char *name   /* I: name of the part in the package */
+)
+/*
+DESCRIPTION:
+   Start a stored zip entry. The CRC and sizes are patched by ZipEntryEnd().
+
+   Return 1 if the write failed, else 0.
+*/
+{
+    ZipEntry entry;
+    entry.name = name;
+    entry.offset = m_file.Offset();
+    entry.size = 0;
+    entry.crc = 0;
+    m_entries.push_back(entry);
+
+    unsigned char header[ZIP_LOCAL_HEADER_BYTES] = {};
+    Put32(header, 0x04034B50u);                  /* signature */
+    Put16(header + 4, 20);                       /* version needed */
+    Put16(header + 12, ZIP_DOS_DATE);            /* method 0 (stored), time 0, date */
+    Put16(header + 26, (uint32_t)entry.name.size());
+    m_file.Write(header, sizeof(header));
+    m_file.Write(entry.name.data(), entry.name.size());
+    m_file.CrcStart();
+    return m_file.Failed();
+}
+
+/*******************************************************************/
+/* Function definition */
+int MeshStreamWriter::ZipEntryEnd
+(
+void
+)
+/*
+DESCRIPTION:
+   Finish the current zip entry and patch its local header.
+
+   Return 1 if the entry is too large or the write failed, else 0.
+*/
+{
+    ZipEntry &entry = m_entries.back();
+    entry.crc = m_file.CrcStop();
+    entry.size = m_file.Offset() - entry.offset - ZIP_LOCAL_HEADER_BYTES - entry.name.size();
+    if (entry.size > ZIP_LIMIT)
+        return 1;
+
+    unsigned char sizes[12];
+    Put32(sizes, entry.crc);
+    Put32(sizes + 4, (uint32_t)entry.size);
+    Put32(sizes + 8, (uint32_t)entry.size);
+    return m_file.Patch(entry.offset + 14, sizes, sizeof(sizes));
+}
+
+/*******************************************************************/
+/* Function definition */
+int MeshStreamWriter::ZipEntryText
+(
+const char *name,   /* I: name of the part in the package */
+const char *text    /* I: content */
+)
+/*
+DESCRIPTION:
+   Write a complete small zip entry.
+
+   Return 1 if the write failed, else 0.
+*/
+{
+    if (ZipEntryBegin(name))
+        return 1;
+    m_file.Write(text, strlen(text));
+    return ZipEntryEnd();
+}
+
+/*******************************************************************/
+/* Function definition */
+int MeshStreamWriter::ZipDirectoryWrite
+(
+void
+)
+/*
+DESCRIPTION:
+   Write the central directory and the end record of the package.
+
+   Return 1 if the package is too large or the write failed, else 0.
+*/
+{
+    const uint64_t start = m_file.Offset();
+    for (const ZipEntry &entry : m_entries)
+    {
+        if (entry.offset > ZIP_LIMIT)
+            return 1;
+
+        unsigned char header[ZIP_CENTRAL_HEADER_BYTES] = {};
+        Put32(header, 0x02014B50u);               /* signature */
+        Put16(header + 4, 20);                    /* version made by */
+        Put16(header + 6, 20);                    /* version needed */
+        Put16(header + 14, ZIP_DOS_DATE);
+        Put32(header + 16, entry.crc);
+        Put32(header + 20, (uint32_t)entry.size);
+        Put32(header + 24, (uint32_t)entry.size);
+        Put16(header + 28, (uint32_t)entry.name.size());
+        Put32(header + 42, (uint32_t)entry.offset);
+        m_file.Write(header, sizeof(header));
+        m_file.Write(entry.name.data(), entry.name.size());
+    }
+
+    const uint64_t size = m_file.Offset() - start;
+    if (start > ZIP_LIMIT)
+        return 1;
+
+    unsigned char end[ZIP_END_BYTES] = {};
+    Put32(end, 0x06054B50u);
+    Put16(end + 8, (uint32_t)m_entries.size());
+    Put16(end + 10, (uint32_t)m_entries.size());
+    Put32(end + 12, (uint32_t)size);
+    Put32(end + 16, (uint32_t)start);
+    m_file.Write(end, sizeof(end));
+    return m_file.Failed();
+}
+
+/*******************************************************************/
+/* Function definition */
+const uint32_t *CrcTable
+(
+void
+)
+/*
+DESCRIPTION:
+   Tables of the slicing-by-8 CRC-32 (zip polynomial 0xEDB88320).
+*/
+{
+    static const std::vector<uint32_t> table = []()
+    {
+        std::vector<uint32_t> t(8 * 256);
+        for (uint32_t i = 0; i < 256; i++)
+        {
+            uint32_t c = i;
+            for (int k = 0; k < 8; k++)
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            t[i] = c;
+        }
+        for (uint32_t i = 0; i < 256; i++)
+        {
+            for (int k = 1; k < 8; k++)
+                t[k * 256 + i] = (t[(k - 1) * 256 + i] >> 8) ^ t[t[(k - 1) * 256 + i] & 0xFF];
+        }
+        return t;
+    }();
+    return table.data();
+}
+
+/*******************************************************************/
+/* Function definition */
+uint32_t CrcUpdate
+(
+uint32_t crc,                 /* I: running CRC (inverted) */
+const unsigned char *data,    /* I: bytes */
+size_t bytes                  /* I: number of bytes */
+)
+/*
+DESCRIPTION:
+   Add bytes to a running CRC-32, eight bytes per step.
+*/
+{
+    const uint32_t *t = CrcTable();
+    while (bytes >= 8)
+    {
+        uint32_t lo, hi;
+        memcpy(&lo, data, 4);
+        memcpy(&hi, data + 4, 4);
+        lo ^= crc;
+        crc = t[7 * 256 + (lo & 0xFF)] ^ t[6 * 256 + ((lo >> 8) & 0xFF)] ^
+            t[5 * 256 + ((lo >> 16) & 0xFF)] ^ t[4 * 256 + (lo >> 24)] ^
+            t[3 * 256 + (hi & 0xFF)] ^ t[2 * 256 + ((hi >> 8) & 0xFF)] ^
+            t[1 * 256 + ((hi >> 16) & 0xFF)] ^ t[hi >> 24];
+        data += 8;
+        bytes -= 8;
+    }
+    while (bytes-- > 0)
+        crc = t[(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+    return crc;
+}
+
+/*******************************************************************/
+/* Function definition */
+char *TextPut
+(
+char *p,            /* I: output position */
+const char *text    /* I: text */
+)
+/*
+DESCRIPTION:
+   Copy text without the terminator, return the end.
+*/
+{
+    while (*text)
+        *p++ = *text++;
+    return p;
+}
+
+/*******************************************************************/
+/* Function definition */
+char *FloatPut
+(
+char *p,        /* I: output position */
+float value     /* I: value */
+)
+/*
+DESCRIPTION:
+   Shortest text that reads back as the same float, return the end.
+*/
+{
+    return std::to_chars(p, p + 32, value).ptr;
+}
+
+/*******************************************************************/
+/* Function definition */
+char *IndexPut
+(
+char *p,          /* I: output position */
+uint64_t value    /* I: value */
+)
+/*
+DESCRIPTION:
+   Decimal text of an index, return the end.
+*/
+{
+    return std::to_chars(p, p + 24, value).ptr;
+}
+
+/*******************************************************************/
+/* Function definition */
+void Put16
+(
+unsigned char *p,   /* O: 2 bytes */
+uint32_t value      /* I: value */
+)
+/*
+DESCRIPTION:
+   Store 16 bits little-endian.
+*/
+{
+    p[0] = (unsigned char)value;
+    p[1] = (unsigned char)(value >> 8);
+}
+
+/*******************************************************************/
+/* Function definition */
+void Put32
+(
+unsigned char *p,   /* O: 4 bytes */
+uint32_t value      /* I: value */
+)
+/*
+DESCRIPTION:
+   Store 32 bits little-endian.
+*/
+{
+    p[0] = (unsigned char)value;
+    p[1] = (unsigned char)(value >> 8);
+    p[2] = (unsigned char)(value >> 16);
+    p[3] = (unsigned char)(value >> 24);
+}
+
+/*******************************************************************/
+/* Function definition */
+void TriangleNormal
+(
+const float *a,    /* I: vertex 1 */
+const float *b,    /* I: vertex 2 */
+const float *c,    /* I: vertex 3 */
+float normal[3]    /* O: unit normal, 0 if degenerate */
+)
+/*
+DESCRIPTION:
+   Unit normal of a counter-clockwise triangle.
+*/
+{
+    const float ux = b[0] - a[0], uy = b[1] - a[1], uz = b[2] - a[2];
+    const float vx = c[0] - a[0], vy = c[1] - a[1], vz = c[2] - a[2];
+    normal[0] = uy * vz - uz * vy;
+    normal[1] = uz * vx - ux * vz;
+    normal[2] = ux * vy - uy * vx;
+    const float len = sqrtf(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+    const float scale = len > 0.0f ? 1.0f / len : 0.0f;
+    normal[0] *= scale;
+    normal[1] *= scale;
+    normal[2] *= scale;
+}
@@ -0,0 +1,387 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* ZW3D API includes */
+#include "zwapi_entity.h"
+#include "zwapi_face.h"
+#include "zwapi_part_facets.h"
+#include "zwapi_shape.h"
+#include "zwapi_userinput.h"
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "..\inc\StreamMeshExportPr.h"
+#include "..\inc\MeshStreamWriter.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define MESSAGE_SIZE 256
+#define PATH_SIZE 512
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: result of one export run */
+struct ExportRun
+{
+    uint64_t triangles;
+    uint64_t fileBytes;
+    size_t peakBytes;     /* largest memory held by the export (buffers + facet data) */
+    double seconds;
+    int failed;
+};
+
+/*******************************************************************/
+/* Function declarations */
+static int StreamMeshExport(void);
+static int StreamMeshExportBench(void);
+static int FaceListGet(int countShape, const szwEntityHandle *shapes, std::vector<szwEntityHandle> &faces,
+    std::vector<szwEntityHandle *> &lists, std::vector<int> &counts);
+static void FaceListFree(std::vector<szwEntityHandle *> &lists, std::vector<int> &counts);
+static void RefineDefault(szwRefineFacets *refine);
+static size_t FacetBytes(int numStrips, const int *strips, int numVertex, int normals);
+static ExportRun StreamRun(const std::vector<szwEntityHandle> &faces, const char *path, MeshStreamFormat format);
+static ExportRun SvxStlRun(const std::vector<szwEntityHandle> &faces, const char *path);
+
+/* DESCRIPTION: file name suffix and label of each format */
+static const char *FormatSuffix[3] = { ".stl", "_ascii.stl", ".3mf" };
+static const char *FormatName[3] = { "binary STL", "ASCII STL", "3MF" };
+
+/*******************************************************************/
+/* Function definition */
+int RegisterStreamMeshExport
+(
+void
+)
+/*
+DESCRIPTION:
+   Register the commands of the streaming mesh export.
+*/
+{
+    /* Export the facets of shapes to STL or 3MF by entering "~StreamMeshExport" */
+    ZwCommandFunctionLoad("StreamMeshExport", (void *)StreamMeshExport, ZW_LICENSE_CODE_GENERAL);
+
+    /* Compare the streaming export with the svxSTL path by entering "~StreamMeshExportBench" */
+    ZwCommandFunctionLoad("StreamMeshExportBench", (void *)StreamMeshExportBench, ZW_LICENSE_CODE_GENERAL);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int UnloadStreamMeshExport
+(
+void
+)
+/*
+DESCRIPTION:
+   Unload the commands of the streaming mesh export.
+*/
+{
+    ZwCommandFunctionUnload("StreamMeshExport");
+    ZwCommandFunctionUnload("StreamMeshExportBench");
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int FaceListGet
+(
+int countShape,                          /* I: number of shapes */
+const szwEntityHandle *shapes,           /* I: shapes */
+std::vector<szwEntityHandle> &faces,     /* O: faces of all shapes */
+std::vector<szwEntityHandle *> &lists,   /* O: face lists to free with FaceListFree() */
+std::vector<int> &counts                 /* O: size of each list */
+)
+/*
+DESCRIPTION:
+   Collect the faces of the picked shapes.
+
+   Return 1 if no face was found, else 0.
+*/
+{
+    for (int i = 0; i < countShape; i++)
+    {
+        int count = 0;
+        szwEntityHandle *list = nullptr;
+        if (ZwShapeFaceListGet(shapes[i], &count, &list))
+            continue;
+        faces.insert(faces.end(), list, list + count);
+        lists.push_back(list);
+        counts.push_back(count);
+    }
+    return faces.empty() ? 1 : 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void FaceListFree
+(
+std::vector<szwEntityHandle *> &lists,   /* I/O: face lists of FaceListGet() */
+std::vector<int> &counts                 /* I/O: size of each list */
+)
+/*
+DESCRIPTION:
+   Free the face lists of FaceListGet().
+*/
+{
+    for (size_t i = 0; i < lists.size(); i++)
+        ZwEntityHandleListFree(counts[i], &lists[i]);
+    lists.clear();
+    counts.clear();
+}
+
+/*******************************************************************/
+/* Function definition */
+void RefineDefault
+(
+szwRefineFacets *refine   /* O: default display tolerances */
+)
+/*
+DESCRIPTION:
+   Set the default facet tolerances of ZwFaceFacetsGet().
+*/
+{
+    refine->type = ZW_FACETS_TOLORANCE_PIXEL;
+    refine->edgeTolorance = 1.0;
+    refine->facetTolorance = 1.0;
+    refine->angleTolorance = 5.0;
+    refine->surfaceTolorance = 1.0;
+}
+
+/*******************************************************************/
+/* Function definition */
+size_t FacetBytes
+(
+int numStrips,       /* I: number of strips */
+const int *strips,   /* I: count-prefixed strip list */
+int numVertex,       /* I: number of vertices */
+int normals          /* I: 1 if the facets have normals */
+)
+/*
+DESCRIPTION:
+   Memory of the strip list and vertex data of one face.
+*/
+{
+    size_t ints = 0;
+    for (int k = 0, j = 0; k < numStrips; k++)
+    {
+        ints += strips[j] + 1;
+        j += strips[j] + 1;
+    }
+    return ints * sizeof(int) + (size_t)numVertex * sizeof(svxPointf) * (normals ? 2 : 1);
+}
+
+/*******************************************************************/
+/* Function definition */
+ExportRun StreamRun
+(
+const std::vector<szwEntityHandle> &faces,   /* I: faces to export */
+const char *path,                            /* I: output file */
+MeshStreamFormat format                      /* I: file format */
+)
+/*
+DESCRIPTION:
+   Export faces with the streaming writer, one ZwFaceFacetsGet() at a time.
+*/
+{
+    ExportRun run{};
+    auto start = std::chrono::steady_clock::now();
+
+    MeshStreamWriter writer;
+    if (writer.Open(path, format, "ZW3D"))
+    {
+        run.failed = 1;
+        return run;
+    }
+
+    size_t largestFace = 0;
+    for (const szwEntityHandle &face : faces)
+    {
+        szwRefineFacets refine{};
+        refine.faceHandle = face;
+        RefineDefault(&refine);
+
+        szwFacets facets{};
+        if (ZwFaceFacetsGet(refine, &facets))
+            continue;
+
+        const size_t bytes = FacetBytes(facets.numberTriangleStrip, facets.triangleStrip, facets.numberVertex,
+            facets.normal != nullptr);
+        largestFace = bytes > largestFace ? bytes : largestFace;
+        run.failed |= writer.AddFacets(facets);
+        ZwFaceFacetsDataFree(&facets);
+    }
+
+    run.peakBytes = writer.BufferBytes() + largestFace;
+    run.failed |= writer.Close();
+    run.triangles = writer.TriangleCount();
+    run.fileBytes = writer.BytesWritten();
+    run.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return run;
+}
+
+/*******************************************************************/
+/* Function definition */
+ExportRun SvxStlRun
+(
+const std::vector<szwEntityHandle> &faces,   /* I: faces to export */
+const char *path                             /* I: output file */
+)
+/*
+DESCRIPTION:
+   Export faces the way the svxSTL based add-ons do: convert every face
+with cvxPartFacetsConvertToSTL(), collect all triangles in memory, then
+write the binary STL file.
+*/
+{
+    ExportRun run{};
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<svxTriangle> triangles;
+    size_t largestFace = 0;
+    for (const szwEntityHandle &face : faces)
+    {
+        int idFace = 0;
+        ZwEntityIdGet(1, &face, &idFace);
+
+        svxFacets facets{};
+        if (cvxPartInqFaceFacets2(idFace, &facets))
+            continue;
+
+        svxSTL stl{};
+        if (cvxPartFacetsConvertToSTL(&facets, &stl) == ZW_API_NO_ERROR)
+        {
+            const size_t bytes = FacetBytes(facets.numTriStrip, facets.TriStrip, facets.numVertex,
+                facets.Normal != nullptr) + stl.nFacet * sizeof(svxTriangle);
+            largestFace = bytes > largestFace ? bytes : largestFace;
+            triangles.insert(triangles.end(), stl.facets, stl.facets + stl.nFacet);
+            cvxStlFree(&stl);
+        }
+        cvxFacetsFree(&facets);
+    }
+
+    MeshStreamWriter writer;
+    run.failed = writer.Open(path, MeshStream_BinaryStl, "ZW3D");
+    if (!run.failed)
+        run.failed |= writer.AddTriangles((int)triangles.size(), triangles.data());
+
+    run.peakBytes = triangles.capacity() * sizeof(svxTriangle) + largestFace + writer.BufferBytes();
+    run.failed |= writer.Close();
+    run.triangles = writer.TriangleCount();
+    run.fileBytes = writer.BytesWritten();
+    run.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return run;
+}
+
+/*******************************************************************/
+/* Function definition */
+int StreamMeshExport
+(
+void
+)
+/*
+DESCRIPTION:
+   Export the display facets of the picked shapes to a binary STL, ASCII
+STL or 3MF file, face by face.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    int count = 0;
+    szwEntityHandle *shapes = nullptr;
+    if (ZwEntityListGetByPick("Select shapes to export", ZW_INPUT_SHAPE, 0, &count, &shapes))
+        return 1;
+
+    double number = 0.0;
+    if (cvxGetNumber("Format (0 binary STL, 1 ASCII STL, 2 3MF)", &number) || number < 0.0 || number > 2.0)
+        number = 0.0;
+    const MeshStreamFormat format = (MeshStreamFormat)(int)number;
+
+    char path[PATH_SIZE] = "";
+    cvxGetFileByLongPath(0, "Export mesh", "", format == MeshStream_3mf ? "3MF File (*.3mf)|*.3mf|" :
+        "STL File (*.stl)|*.stl|", path, PATH_SIZE);
+
+    std::vector<szwEntityHandle> faces;
+    std::vector<szwEntityHandle *> lists;
+    std::vector<int> counts;
+    if (path[0] == '\0' || FaceListGet(count, shapes, faces, lists, counts))
+    {
+        ZwEntityHandleListFree(count, &shapes);
+        return 1;
+    }
+
+    const ExportRun run = StreamRun(faces, path, format);
+    FaceListFree(lists, counts);
+    ZwEntityHandleListFree(count, &shapes);
+
+    char message[MESSAGE_SIZE];
+    sprintf_s(message, MESSAGE_SIZE, "%s %s: %llu triangles, %.2f MB in %.2f s, buffers and face data %.2f MB",
+        FormatName[format], run.failed ? "FAILED" : "written", (unsigned long long)run.triangles,
+        run.fileBytes / 1048576.0, run.seconds, run.peakBytes / 1048576.0);
+    cvxMsgDisp(message);
+    return run.failed;
+}
+
+/*******************************************************************/
+/* Function definition */
+int StreamMeshExportBench
+(
+void
+)
+/*
+DESCRIPTION:
+   Export the picked shapes through the svxSTL path and through the
+streaming writer in all three formats, and report throughput and the
+largest memory held by each export.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    int count = 0;
+    szwEntityHandle *shapes = nullptr;
+    if (ZwEntityListGetByPick("Select shapes to benchmark", ZW_INPUT_SHAPE, 0, &count, &shapes))
+        return 1;
+
+    char path[PATH_SIZE] = "";
+    cvxGetFileByLongPath(0, "Base name of the benchmark files", "", "STL File (*.stl)|*.stl|", path, PATH_SIZE);
+
+    std::vector<szwEntityHandle> faces;
+    std::vector<szwEntityHandle *> lists;
+    std::vector<int> counts;
+    if (path[0] == '\0' || FaceListGet(count, shapes, faces, lists, counts))
+    {
+        ZwEntityHandleListFree(count, &shapes);
+        return 1;
+    }
+
+    std::string base = path;
+    if (base.size() > 4 && base.compare(base.size() - 4, 4, ".stl") == 0)
+        base.erase(base.size() - 4);
+
+    char message[MESSAGE_SIZE];
+    ExportRun run = SvxStlRun(faces, (base + "_svxstl.stl").c_str());
+    sprintf_s(message, MESSAGE_SIZE, "svxSTL path (binary STL): %llu triangles, %.2f s, %.0f triangles/s, peak %.2f MB%s",
+        (unsigned long long)run.triangles, run.seconds, run.seconds > 0.0 ? run.triangles / run.seconds : 0.0,
+        run.peakBytes / 1048576.0, run.failed ? ", FAILED" : "");
+    cvxMsgDisp(message);
+
+    for (int k = 0; k < 3; k++)
+    {
+        run = StreamRun(faces, (base + "_stream" + FormatSuffix[k]).c_str(), (MeshStreamFormat)k);
+        sprintf_s(message, MESSAGE_SIZE, "Streaming %s: %llu triangles, %.2f MB, %.2f s, %.0f triangles/s, peak %.2f MB%s",
+            FormatName[k], (unsigned long long)run.triangles, run.fileBytes / 1048576.0, run.seconds,
+            run.seconds > 0.0 ? run.triangles / run.seconds : 0.0, run.peakBytes / 1048576.0,
+            run.failed ? ", FAILED" : "");
+        cvxMsgDisp(message);
+    }
+
+    FaceListFree(lists, counts);
+    ZwEntityHandleListFree(count, &shapes);
+    return 0;
+}
@@ -0,0 +1,21 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+#include "..\inc\StreamMeshExportPr.h"
+
+// Dynamic library entry function, called when the dll is loaded
+// The function name must be dll name + "Init"
+int StreamMeshExportInit()
+{
+    RegisterStreamMeshExport();
+    return 0;
+}
+
+// Dynamic library entry function, called when the dll is unloaded
+// The function name must be dll name + "Exit"
+int StreamMeshExportExit()
+{
+    UnloadStreamMeshExport();
+    return 0;
+}
@@ -0,0 +1,121 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+#pragma once
+
+/* ZW3D API includes */
+#include "zwapi_util.h"
+#include "zwapi_brep_data.h"
+
+/* Application includes */
+#include <vector>
+
+/*******************************************************************/
+/* Constant definitions */
+#define TRIANGLE_BVH_LEAF_SIZE 4     /* nodes this small are not split */
+#define TRIANGLE_BVH_BINS 16         /* SAH bins per axis */
+#define TRIANGLE_BVH_PACKET 4        /* rays per packet */
+#define TRIANGLE_BVH_STACK 64        /* traversal stack depth */
+#define TRIANGLE_BVH_NO_HIT (-1)
+
+/*******************************************************************/
+/* Data type definitions */
+/*
+DESCRIPTION:
+   32 byte node of the flattened tree. Nodes are stored depth first: the
+left child of an inner node follows it, "first" is the right child.
+"count" is the number of triangles of a leaf, or -1 - split axis of an
+inner node.
+*/
+struct TriangleBvhNode
+{
+    float low[3];
+    int first;      /* leaf: first triangle, inner: right child */
+    float high[3];
+    int count;      /* leaf: > 0, inner: -1 - axis */
+};
+
+/* DESCRIPTION: closest hit of one ray */
+struct TriangleBvhHit
+{
+    double t;         /* distance from the ray start (unit direction) */
+    svxPoint point;   /* hit point */
+    int face;         /* face tag of the triangle, TRIANGLE_BVH_NO_HIT if none */
+    int triangle;     /* triangle index in the tree */
+    int refined;      /* 1 if the point comes from the refine callback */
+};
+
+/* DESCRIPTION: closest triangle to one point */
+struct TriangleBvhNearest
+{
+    double distance;  /* distance from the point */
+    svxPoint point;   /* closest point on the triangles */
+    int face;         /* face tag of the triangle, TRIANGLE_BVH_NO_HIT if none within the limit */
+    int triangle;     /* triangle index in the tree */
+};
+
+/*
+DESCRIPTION:
+   Exact intersection of a ray with one face, called with the face tag of
+a facet hit. Return 0 and the point on the true surface, or 1 to keep the
+facet hit.
+*/
+typedef int (*TriangleBvhRefine)(void *data, int face, const svxAxis *ray, svxPoint *point);
+
+/*
+DESCRIPTION:
+   Bounding volume hierarchy over the triangles of face facets, built
+once with a binned surface area heuristic and queried any number of
+times.
+
+   Each triangle keeps a face tag (the index of the face it came from in
+the caller's list), so hits can be mapped back to face handles and
+refined against the host surface.
+
+   Rays are traced one at a time or in packets of four: a packet walks
+the tree together, each node box and each leaf triangle being tested
+against the four rays with one SSE (x64) or NEON (ARM64) instruction
+stream, which pays off for coherent rays such as view grids and probe
+paths. Closest() finds the closest point of the triangles to a point,
+visiting the nearest box first.
+
+   The tree is immutable after Build() and may be shared by threads.
+*/
+class TriangleBvh
+{
+public:
+    TriangleBvh();
+
+    int AddFacets(const szwFacets &facets, int face);
+    int AddFacets(const svxFacets &facets, int face);
+    int AddTriangle(const float *a, const float *b, const float *c, int face);
+    int Build(void);
+    void Clear(void);
+
+    int Intersect(const svxAxis &ray, double length, TriangleBvhHit *hit) const;
+    int IntersectPacket(int count, const svxAxis *rays, double length, TriangleBvhHit *hits) const;
+    int IntersectList(int count, const svxAxis *rays, double length, TriangleBvhRefine refine, void *data,
+        TriangleBvhHit *hits) const;
+    int Closest(const svxPoint &point, double limit, TriangleBvhNearest *nearest) const;
+
+    int IsBuilt(void) const { return !m_nodes.empty(); }
+    int NodeCount(void) const { return (int)m_nodes.size(); }
+    int TriangleCount(void) const { return (int)m_faces.size(); }
+    int Depth(void) const { return m_depth; }
+    const TriangleBvhNode *Nodes(void) const { return m_nodes.data(); }
+    void Triangle(int index, float a[3], float b[3], float c[3]) const;
+    int TriangleFace(int index) const { return m_faces[index]; }
+    svxBndBox Bounds(void) const;
+
+private:
+    int NodeBuild(int node, int first, int count, std::vector<int> &order, const std::vector<float> &centers,
+        const std::vector<float> &boxes, int depth);
+
+    std::vector<TriangleBvhNode> m_nodes;
+    std::vector<float> m_input;         /* a,b,c per triangle as added */
+    std::vector<float> m_triangles;     /* v0, e1 = v1 - v0, e2 = v2 - v0 per triangle, tree order */
+    std::vector<int> m_inputFaces;      /* face tag per added triangle */
+    std::vector<int> m_faces;           /* face tag per triangle, tree order */
+    int m_depth;
+};
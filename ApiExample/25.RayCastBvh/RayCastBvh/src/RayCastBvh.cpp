@@ -0,0 +1,545 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* ZW3D API includes */
+#include "zwapi_entity.h"
+#include "zwapi_face.h"
+#include "zwapi_intersection.h"
+#include "zwapi_math_insect.h"
+#include "zwapi_shape.h"
+#include "zwapi_userinput.h"
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <math.h>
+#include <chrono>
+#include <random>
+#include <vector>
+#include "..\inc\RayCastBvhPr.h"
+#include "..\inc\TriangleBvh.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define MESSAGE_SIZE 256
+#define CHECK_RAYS 1000        /* default number of random rays of ~RayCastBvhCheck */
+#define BENCH_GRID 256         /* default view grid of ~RayCastBvhBench */
+#define BENCH_API_RAYS 2000    /* rays timed with ZwRayShapeIntersect() in the benchmark */
+
+/*******************************************************************/
+/* Data type definitions */
+/*
+DESCRIPTION:
+   Faces of the picked shapes and the tree built from their facets. The
+face tag of a triangle is its face's index in "faces".
+*/
+struct RayScene
+{
+    std::vector<szwEntityHandle> faces;
+    std::vector<int> ids;                     /* face ids for cvxIsectRayFace() */
+    std::vector<szwEntityHandle *> lists;     /* face lists of ZwShapeFaceListGet() */
+    std::vector<int> counts;
+    TriangleBvh bvh;
+    double buildTime;                         /* facets and tree, seconds */
+};
+
+/*******************************************************************/
+/* Function declarations */
+static int RayCastBvhCheck(void);
+static int RayCastBvhBench(void);
+static int SceneBuild(int countShape, const szwEntityHandle *shapes, RayScene *scene);
+static void SceneFree(RayScene *scene);
+static int FaceRefine(void *data, int face, const svxAxis *ray, svxPoint *point);
+static int HitToIntersection(const RayScene &scene, const TriangleBvhHit &hit, szwIntersectionPoint *point);
+static int ApiClosestHit(int countShape, const szwEntityHandle *shapes, const svxAxis &ray, svxPoint *point,
+    int *idFace);
+static void RandomRays(const svxBndBox &box, int count, std::vector<svxAxis> &rays);
+static void ViewRays(const svxBndBox &box, int grid, std::vector<svxAxis> &rays);
+
+/*******************************************************************/
+/* Function definition */
+int RegisterRayCastBvh
+(
+void
+)
+/*
+DESCRIPTION:
+   Register the commands of the BVH ray casting example.
+*/
+{
+    /* Compare BVH hits with ZwRayShapeIntersect() by entering "~RayCastBvhCheck" */
+    ZwCommandFunctionLoad("RayCastBvhCheck", (void *)RayCastBvhCheck, ZW_LICENSE_CODE_GENERAL);
+
+    /* Time BVH ray casting against ZwRayShapeIntersect() by entering "~RayCastBvhBench" */
+    ZwCommandFunctionLoad("RayCastBvhBench", (void *)RayCastBvhBench, ZW_LICENSE_CODE_GENERAL);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int UnloadRayCastBvh
+(
+void
+)
+/*
+DESCRIPTION:
+   Unload the commands of the BVH ray casting example.
+*/
+{
+    ZwCommandFunctionUnload("RayCastBvhCheck");
+    ZwCommandFunctionUnload("RayCastBvhBench");
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int SceneBuild
+(
+int countShape,                  /* I: number of shapes */
+const szwEntityHandle *shapes,   /* I: shapes */
+RayScene *scene                  /* O: faces and tree, free with SceneFree() */
+)
+/*
+DESCRIPTION:
+   Get the facets of all faces of the shapes with one ZwFaceListFacetsGet()
+call and build the tree.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < countShape; i++)
+    {
+        int count = 0;
+        szwEntityHandle *list = nullptr;
+        if (ZwShapeFaceListGet(shapes[i], &count, &list))
+            continue;
+        scene->faces.insert(scene->faces.end(), list, list + count);
+        scene->lists.push_back(list);
+        scene->counts.push_back(count);
+    }
+    if (scene->faces.empty())
+        return 1;
+
+    const int countFace = (int)scene->faces.size();
+    scene->ids.resize(countFace);
+    if (ZwEntityIdGet(countFace, scene->faces.data(), scene->ids.data()))
+        return 1;
+
+    szwRefineFacetsOfMultiFace refine{};
+    refine.countFace = countFace;
+    refine.faceHandle = scene->faces.data();
+    refine.type = ZW_FACETS_TOLORANCE_PIXEL;
+    refine.edgeTolorance = 1.0;
+    refine.facetTolorance = 1.0;
+    refine.angleTolorance = 5.0;
+    refine.surfaceTolorance = 1.0;
+
+    int countFacets = 0;
+    szwFacets *facets = nullptr;
+    if (ZwFaceListFacetsGet(refine, &countFacets, &facets))
+        return 1;
+
+    for (int i = 0; i < countFacets && i < countFace; i++)
+        scene->bvh.AddFacets(facets[i], i);
+    for (int i = 0; i < countFacets; i++)
+        ZwFaceFacetsDataFree(&facets[i]);
+    ZwMemoryFree((void **)&facets);
+
+    const int err = scene->bvh.Build();
+    scene->buildTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return err;
+}
+
+/*******************************************************************/
+/* Function definition */
+void SceneFree
+(
+RayScene *scene   /* I/O: scene of SceneBuild() */
+)
+/*
+DESCRIPTION:
+   Free the face lists and the tree.
+*/
+{
+    for (size_t i = 0; i < scene->lists.size(); i++)
+        ZwEntityHandleListFree(scene->counts[i], &scene->lists[i]);
+    scene->lists.clear();
+    scene->counts.clear();
+    scene->faces.clear();
+    scene->ids.clear();
+    scene->bvh.Clear();
+}
+
+/*******************************************************************/
+/* Function definition */
+int FaceRefine
+(
+void *data,            /* I: RayScene */
+int face,              /* I: face tag of the facet hit */
+const svxAxis *ray,    /* I: ray */
+svxPoint *point        /* O: hit on the face surface */
+)
+/*
+DESCRIPTION:
+   TriangleBvhRefine callback: intersect the ray with the true surface of
+the face whose facet was hit, so the final point agrees with the host.
+
+   Return 0 if the face is hit, else 1 (the facet hit is kept).
+*/
+{
+    const RayScene *scene = (const RayScene *)data;
+    svxAxis axis = *ray;
+    return cvxIsectRayFace(scene->ids[face], VX_TRIM_ALL, &axis, point, nullptr) == ZW_API_NO_ERROR ? 0 : 1;
+}
+
+/*******************************************************************/
+/* Function definition */
+int HitToIntersection
+(
+const RayScene &scene,          /* I: scene */
+const TriangleBvhHit &hit,      /* I: hit */
+szwIntersectionPoint *point     /* O: point and face */
+)
+/*
+DESCRIPTION:
+   Convert a hit to the szwIntersectionPoint of ZwRayShapeIntersect(). The
+face handle is borrowed from the scene and must not be freed.
+
+   Return 1 if the ray missed, else 0.
+*/
+{
+    if (hit.face == TRIANGLE_BVH_NO_HIT)
+        return 1;
+
+    point->point.x = hit.point.x;
+    point->point.y = hit.point.y;
+    point->point.z = hit.point.z;
+    point->faceHandle = scene.faces[hit.face];
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int ApiClosestHit
+(
+int countShape,                  /* I: number of shapes */
+const szwEntityHandle *shapes,   /* I: shapes */
+const svxAxis &ray,              /* I: ray */
+svxPoint *point,                 /* O: closest hit */
+int *idFace                      /* O: face of the closest hit */
+)
+/*
+DESCRIPTION:
+   Closest hit in front of the ray start by ZwRayShapeIntersect().
+
+   Return 1 if the ray missed, else 0.
+*/
+{
+    szwAxis axis{};
+    axis.point.x = ray.Pnt.x;
+    axis.point.y = ray.Pnt.y;
+    axis.point.z = ray.Pnt.z;
+    axis.direction.x = ray.Dir.x;
+    axis.direction.y = ray.Dir.y;
+    axis.direction.z = ray.Dir.z;
+
+    int count = 0;
+    szwIntersectionPoint *points = nullptr;
+    if (ZwRayShapeIntersect(countShape, shapes, ZW_TRIM_ALL, axis, 0, 0.0, &count, &points))
+        return 1;
+
+    int best = -1;
+    double bestDist = 0.0;
+    for (int i = 0; i < count; i++)
+    {
+        const double dx = points[i].point.x - ray.Pnt.x;
+        const double dy = points[i].point.y - ray.Pnt.y;
+        const double dz = points[i].point.z - ray.Pnt.z;
+        const double dist = dx * dx + dy * dy + dz * dz;
+        if (best < 0 || dist < bestDist)
+        {
+            best = i;
+            bestDist = dist;
+        }
+    }
+    if (best >= 0)
+    {
+        point->x = points[best].point.x;
+        point->y = points[best].point.y;
+        point->z = points[best].point.z;
+        ZwEntityIdGet(1, &points[best].faceHandle, idFace);
+    }
+
+    for (int i = 0; i < count; i++)
+        ZwEntityHandleFree(&points[i].faceHandle);
+    ZwMemoryFree((void **)&points);
+    return best >= 0 ? 0 : 1;
+}
+
+/*******************************************************************/
+/* Function definition */
+void RandomRays
+(
+const svxBndBox &box,          /* I: scene box */
+int count,                     /* I: number of rays */
+std::vector<svxAxis> &rays     /* O: rays */
+)
+/*
+DESCRIPTION:
+   Rays from random points around the box toward random points inside it.
+The seed is fixed so runs can be compared.
+*/
+{
+    std::mt19937 random(5);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    const double low[3] = { box.X.min, box.Y.min, box.Z.min };
+    const double size[3] = { box.X.max - box.X.min, box.Y.max - box.Y.min, box.Z.max - box.Z.min };
+
+    rays.resize(count);
+    for (int i = 0; i < count; i++)
+    {
+        double from[3], to[3];
+        for (int k = 0; k < 3; k++)
+        {
+            from[k] = low[k] + size[k] * (2.0 * unit(random) - 0.5);
+            to[k] = low[k] + size[k] * unit(random);
+        }
+        rays[i].Pnt.x = from[0];
+        rays[i].Pnt.y = from[1];
+        rays[i].Pnt.z = from[2];
+        rays[i].Dir.x = to[0] - from[0];
+        rays[i].Dir.y = to[1] - from[1];
+        rays[i].Dir.z = to[2] - from[2];
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+void ViewRays
+(
+const svxBndBox &box,          /* I: scene box */
+int grid,                      /* I: rays per side */
+std::vector<svxAxis> &rays     /* O: rays, row by row */
+)
+/*
+DESCRIPTION:
+   Rays of an isometric view through a grid covering the box, like a
+line-of-sight or hidden line query. Neighbouring rays are coherent.
+*/
+{
+    const double center[3] = { 0.5 * (box.X.min + box.X.max), 0.5 * (box.Y.min + box.Y.max),
+        0.5 * (box.Z.min + box.Z.max) };
+    const double dx = box.X.max - box.X.min, dy = box.Y.max - box.Y.min, dz = box.Z.max - box.Z.min;
+    const double radius = 0.5 * sqrt(dx * dx + dy * dy + dz * dz);
+
+    /* view direction (-1,-1,-1), screen axes u and v */
+    const double s3 = 1.0 / sqrt(3.0), s2 = 1.0 / sqrt(2.0), s6 = 1.0 / sqrt(6.0);
+    const double dir[3] = { -s3, -s3, -s3 };
+    const double u[3] = { s2, -s2, 0.0 };
+    const double v[3] = { -s6, -s6, 2.0 * s6 };
+
+    rays.resize((size_t)grid * grid);
+    for (int j = 0; j < grid; j++)
+    {
+        for (int i = 0; i < grid; i++)
+        {
+            const double a = radius * (2.0 * (i + 0.5) / grid - 1.0);
+            const double b = radius * (2.0 * (j + 0.5) / grid - 1.0);
+            svxAxis &ray = rays[(size_t)j * grid + i];
+            ray.Pnt.x = center[0] - 2.0 * radius * dir[0] + a * u[0] + b * v[0];
+            ray.Pnt.y = center[1] - 2.0 * radius * dir[1] + a * u[1] + b * v[1];
+            ray.Pnt.z = center[2] - 2.0 * radius * dir[2] + a * u[2] + b * v[2];
+            ray.Dir.x = dir[0];
+            ray.Dir.y = dir[1];
+            ray.Dir.z = dir[2];
+        }
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+int RayCastBvhCheck
+(
+void
+)
+/*
+DESCRIPTION:
+   Cast random rays at the picked shapes with the tree, with and without
+exact refinement, and with ZwRayShapeIntersect(). Report how many rays
+agree on hit or miss and on the face, and the largest distance between
+the points.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    int count = 0;
+    szwEntityHandle *shapes = nullptr;
+    if (ZwEntityListGetByPick("Select shapes to intersect", ZW_INPUT_SHAPE, 0, &count, &shapes))
+        return 1;
+
+    double number = CHECK_RAYS;
+    if (cvxGetNumber("Number of rays", &number) || number < 1.0)
+        number = CHECK_RAYS;
+
+    RayScene scene{};
+    char message[MESSAGE_SIZE];
+    if (SceneBuild(count, shapes, &scene))
+    {
+        cvxMsgDisp("Failed to build the tree");
+        SceneFree(&scene);
+        ZwEntityHandleListFree(count, &shapes);
+        return 1;
+    }
+
+    std::vector<svxAxis> rays;
+    RandomRays(scene.bvh.Bounds(), (int)number, rays);
+    const int countRay = (int)rays.size();
+
+    std::vector<TriangleBvhHit> facetHits(countRay), exactHits(countRay);
+    scene.bvh.IntersectList(countRay, rays.data(), 0.0, nullptr, nullptr, facetHits.data());
+    scene.bvh.IntersectList(countRay, rays.data(), 0.0, FaceRefine, &scene, exactHits.data());
+
+    int apiHits = 0, agree[2] = {}, sameFace[2] = {};
+    double maxDist[2] = {};
+    for (int i = 0; i < countRay; i++)
+    {
+        svxPoint apiPoint{};
+        int apiFace = 0;
+        const int apiMissed = ApiClosestHit(count, shapes, rays[i], &apiPoint, &apiFace);
+        apiHits += !apiMissed;
+
+        for (int k = 0; k < 2; k++)
+        {
+            const TriangleBvhHit &hit = k ? exactHits[i] : facetHits[i];
+            szwIntersectionPoint point{};
+            const int missed = HitToIntersection(scene, hit, &point);
+            if (missed != apiMissed)
+                continue;
+            agree[k]++;
+            if (missed)
+                continue;
+
+            sameFace[k] += scene.ids[hit.face] == apiFace;
+            const double dx = point.point.x - apiPoint.x, dy = point.point.y - apiPoint.y, dz = point.point.z - apiPoint.z;
+            const double dist = sqrt(dx * dx + dy * dy + dz * dz);
+            maxDist[k] = dist > maxDist[k] ? dist : maxDist[k];
+        }
+    }
+
+    sprintf_s(message, MESSAGE_SIZE, "%d faces, %d triangles, %d rays, %d hit by ZwRayShapeIntersect()",
+        (int)scene.faces.size(), scene.bvh.TriangleCount(), countRay, apiHits);
+    cvxMsgDisp(message);
+    for (int k = 0; k < 2; k++)
+    {
+        sprintf_s(message, MESSAGE_SIZE, "%s: hit/miss agree %d/%d, same face %d/%d, largest point distance %.3g",
+            k ? "Refined hits" : "Facet hits", agree[k], countRay, sameFace[k], apiHits, maxDist[k]);
+        cvxMsgDisp(message);
+    }
+
+    SceneFree(&scene);
+    ZwEntityHandleListFree(count, &shapes);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int RayCastBvhBench
+(
+void
+)
+/*
+DESCRIPTION:
+   Cast a view grid of rays at the picked shapes and report the time per
+ray of ZwRayShapeIntersect() (on the first BENCH_API_RAYS rays), of the
+tree with single rays, with packets, and with packets plus exact
+refinement (on the same rays as ZwRayShapeIntersect()).
+
+   Return 1 if function fails, else 0.
+*/
+{
+    int count = 0;
+    szwEntityHandle *shapes = nullptr;
+    if (ZwEntityListGetByPick("Select shapes to intersect", ZW_INPUT_SHAPE, 0, &count, &shapes))
+        return 1;
+
+    double number = BENCH_GRID;
+    if (cvxGetNumber("Rays per side of the view grid", &number) || number < 1.0)
+        number = BENCH_GRID;
+
+    RayScene scene{};
+    char message[MESSAGE_SIZE];
+    if (SceneBuild(count, shapes, &scene))
+    {
+        cvxMsgDisp("Failed to build the tree");
+        SceneFree(&scene);
+        ZwEntityHandleListFree(count, &shapes);
+        return 1;
+    }
+
+    sprintf_s(message, MESSAGE_SIZE, "%d faces, %d triangles: facets and tree %.3f s, %d nodes, depth %d",
+        (int)scene.faces.size(), scene.bvh.TriangleCount(), scene.buildTime, scene.bvh.NodeCount(),
+        scene.bvh.Depth());
+    cvxMsgDisp(message);
+
+    std::vector<svxAxis> rays;
+    ViewRays(scene.bvh.Bounds(), (int)number, rays);
+    const int countRay = (int)rays.size();
+    const int countApi = countRay < BENCH_API_RAYS ? countRay : BENCH_API_RAYS;
+    std::vector<TriangleBvhHit> hits(countRay);
+
+    /* host */
+    auto start = std::chrono::steady_clock::now();
+    int apiHits = 0;
+    for (int i = 0; i < countApi; i++)
+    {
+        svxPoint point;
+        int idFace;
+        apiHits += !ApiClosestHit(count, shapes, rays[i], &point, &idFace);
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    sprintf_s(message, MESSAGE_SIZE, "ZwRayShapeIntersect(): %d rays, %d hits, %.2f us/ray", countApi, apiHits,
+        1e6 * seconds / countApi);
+    cvxMsgDisp(message);
+
+    /* single rays */
+    start = std::chrono::steady_clock::now();
+    int bvhHits = 0;
+    for (int i = 0; i < countRay; i++)
+    {
+        scene.bvh.Intersect(rays[i], 0.0, &hits[i]);
+        bvhHits += hits[i].face != TRIANGLE_BVH_NO_HIT;
+    }
+    seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    sprintf_s(message, MESSAGE_SIZE, "BVH single rays: %d rays, %d hits, %.3f us/ray", countRay, bvhHits,
+        1e6 * seconds / countRay);
+    cvxMsgDisp(message);
+
+    /* packets */
+    start = std::chrono::steady_clock::now();
+    scene.bvh.IntersectList(countRay, rays.data(), 0.0, nullptr, nullptr, hits.data());
+    seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    bvhHits = 0;
+    for (int i = 0; i < countRay; i++)
+        bvhHits += hits[i].face != TRIANGLE_BVH_NO_HIT;
+    sprintf_s(message, MESSAGE_SIZE, "BVH packets of %d: %d rays, %d hits, %.3f us/ray", TRIANGLE_BVH_PACKET,
+        countRay, bvhHits, 1e6 * seconds / countRay);
+    cvxMsgDisp(message);
+
+    /* packets and exact refinement */
+    start = std::chrono::steady_clock::now();
+    scene.bvh.IntersectList(countApi, rays.data(), 0.0, FaceRefine, &scene, hits.data());
+    seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    int refined = 0;
+    for (int i = 0; i < countApi; i++)
+        refined += hits[i].refined;
+    sprintf_s(message, MESSAGE_SIZE, "BVH packets + cvxIsectRayFace(): %d rays, %d refined, %.2f us/ray", countApi,
+        refined, 1e6 * seconds / countApi);
+    cvxMsgDisp(message);
+
+    SceneFree(&scene);
+    ZwEntityHandleListFree(count, &shapes);
+    return 0;
+}
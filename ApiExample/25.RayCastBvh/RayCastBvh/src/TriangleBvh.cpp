@@ -0,0 +1,1054 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* Application includes */
+#include <math.h>
+#include <float.h>
+#include <string.h>
+#include <algorithm>
+#include "TriangleBvh.h"
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define TRIANGLE_BVH_SSE 1
+#include <emmintrin.h>
+#elif defined(_M_ARM64) || defined(__aarch64__)
+#define TRIANGLE_BVH_NEON 1
+#include <arm_neon.h>
+#endif
+
+/*******************************************************************/
+/* Constant definitions */
+#define LEAF_MAX 16             /* a node this small becomes a leaf if no split is cheaper */
+#define TRIANGLE_FLOATS 9       /* v0, e1, e2 */
+#define DET_MIN 1.0e-12f        /* parallel ray and triangle */
+
+/*******************************************************************/
+/* Data type definitions */
+/*
+DESCRIPTION:
+   Four floats, one per ray of a packet, with the few operations the
+packet traversal needs. Comparisons return all-ones lanes.
+*/
+#if defined(TRIANGLE_BVH_SSE)
+typedef __m128 Lane4;
+static inline Lane4 Lane4Set(float a) { return _mm_set1_ps(a); }
+static inline Lane4 Lane4Load(const float *p) { return _mm_loadu_ps(p); }
+static inline void Lane4Store(float *p, Lane4 a) { _mm_storeu_ps(p, a); }
+static inline Lane4 Lane4Add(Lane4 a, Lane4 b) { return _mm_add_ps(a, b); }
+static inline Lane4 Lane4Sub(Lane4 a, Lane4 b) { return _mm_sub_ps(a, b); }
+static inline Lane4 Lane4Mul(Lane4 a, Lane4 b) { return _mm_mul_ps(a, b); }
+static inline Lane4 Lane4Div(Lane4 a, Lane4 b) { return _mm_div_ps(a, b); }
+static inline Lane4 Lane4Min(Lane4 a, Lane4 b) { return _mm_min_ps(a, b); }
+static inline Lane4 Lane4Max(Lane4 a, Lane4 b) { return _mm_max_ps(a, b); }
+static inline Lane4 Lane4Le(Lane4 a, Lane4 b) { return _mm_cmple_ps(a, b); }
+static inline Lane4 Lane4Lt(Lane4 a, Lane4 b) { return _mm_cmplt_ps(a, b); }
+static inline Lane4 Lane4And(Lane4 a, Lane4 b) { return _mm_and_ps(a, b); }
+static inline Lane4 Lane4Abs(Lane4 a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+static inline int Lane4Mask(Lane4 a) { return _mm_movemask_ps(a); }
+#elif defined(TRIANGLE_BVH_NEON)
+typedef float32x4_t Lane4;
+static inline Lane4 Lane4Set(float a) { return vdupq_n_f32(a); }
+static inline Lane4 Lane4Load(const float *p) { return vld1q_f32(p); }
+static inline void Lane4Store(float *p, Lane4 a) { vst1q_f32(p, a); }
+static inline Lane4 Lane4Add(Lane4 a, Lane4 b) { return vaddq_f32(a, b); }
+static inline Lane4 Lane4Sub(Lane4 a, Lane4 b) { return vsubq_f32(a, b); }
+static inline Lane4 Lane4Mul(Lane4 a, Lane4 b) { return vmulq_f32(a, b); }
+static inline Lane4 Lane4Div(Lane4 a, Lane4 b) { return vdivq_f32(a, b); }
+static inline Lane4 Lane4Min(Lane4 a, Lane4 b) { return vminq_f32(a, b); }
+static inline Lane4 Lane4Max(Lane4 a, Lane4 b) { return vmaxq_f32(a, b); }
+static inline Lane4 Lane4Le(Lane4 a, Lane4 b) { return vreinterpretq_f32_u32(vcleq_f32(a, b)); }
+static inline Lane4 Lane4Lt(Lane4 a, Lane4 b) { return vreinterpretq_f32_u32(vcltq_f32(a, b)); }
+static inline Lane4 Lane4And(Lane4 a, Lane4 b)
+{
+    return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b)));
+}
+static inline Lane4 Lane4Abs(Lane4 a) { return vabsq_f32(a); }
+static inline int Lane4Mask(Lane4 a)
+{
+    const uint32x4_t m = vshrq_n_u32(vreinterpretq_u32_f32(a), 31);
+    return (int)(vgetq_lane_u32(m, 0) | vgetq_lane_u32(m, 1) << 1 | vgetq_lane_u32(m, 2) << 2 |
+        vgetq_lane_u32(m, 3) << 3);
+}
+#else
+struct Lane4 { float v[4]; };
+static inline Lane4 Lane4Set(float a) { Lane4 r = { { a, a, a, a } }; return r; }
+static inline Lane4 Lane4Load(const float *p) { Lane4 r = { { p[0], p[1], p[2], p[3] } }; return r; }
+static inline void Lane4Store(float *p, Lane4 a) { memcpy(p, a.v, sizeof(a.v)); }
+#define LANE4_MAP(expr) Lane4 r; for (int i = 0; i < 4; i++) r.v[i] = (expr); return r
+static inline Lane4 Lane4Add(Lane4 a, Lane4 b) { LANE4_MAP(a.v[i] + b.v[i]); }
+static inline Lane4 Lane4Sub(Lane4 a, Lane4 b) { LANE4_MAP(a.v[i] - b.v[i]); }
+static inline Lane4 Lane4Mul(Lane4 a, Lane4 b) { LANE4_MAP(a.v[i] * b.v[i]); }
+static inline Lane4 Lane4Div(Lane4 a, Lane4 b) { LANE4_MAP(a.v[i] / b.v[i]); }
+static inline Lane4 Lane4Min(Lane4 a, Lane4 b) { LANE4_MAP(a.v[i] < b.v[i] ? a.v[i] : b.v[i]); }
+static inline Lane4 Lane4Max(Lane4 a, Lane4 b) { LANE4_MAP(a.v[i] > b.v[i] ? a.v[i] : b.v[i]); }
+static inline Lane4 Lane4Le(Lane4 a, Lane4 b) { LANE4_MAP(a.v[i] <= b.v[i] ? -1.0f : 0.0f); }
+static inline Lane4 Lane4Lt(Lane4 a, Lane4 b) { LANE4_MAP(a.v[i] < b.v[i] ? -1.0f : 0.0f); }
+static inline Lane4 Lane4And(Lane4 a, Lane4 b) { LANE4_MAP(a.v[i] != 0.0f && b.v[i] != 0.0f ? -1.0f : 0.0f); }
+static inline Lane4 Lane4Abs(Lane4 a) { LANE4_MAP(fabsf(a.v[i])); }
+static inline int Lane4Mask(Lane4 a)
+{
+    return (a.v[0] != 0.0f) | (a.v[1] != 0.0f) << 1 | (a.v[2] != 0.0f) << 2 | (a.v[3] != 0.0f) << 3;
+}
+#endif
+
+/* DESCRIPTION: four rays in structure-of-arrays form */
+struct RayPacket
+{
+    Lane4 origin[3];
+    Lane4 direction[3];
+    Lane4 inverse[3];
+};
+
+/*******************************************************************/
+/* Function declarations */
+static int RayPrepare(const svxAxis &ray, double length, float origin[3], float direction[3], float *tMax);
+static float BoxEntry(const TriangleBvhNode &node, const float origin[3], const float inverse[3], float tMax);
+static float TriangleIntersect(const float *tri, const float origin[3], const float direction[3], float tMax);
+static float BoxArea(const float low[3], const float high[3]);
+static double BoxDistance2(const TriangleBvhNode &node, const svxPoint &point);
+static double TriangleClosest(const float *tri, const svxPoint &point, svxPoint *closest);
+static void HitFinish(const svxAxis &ray, float t, int triangle, int face, TriangleBvhHit *hit);
+
+/*******************************************************************/
+/* Function definition */
+TriangleBvh::TriangleBvh()
+    : m_depth(0)
+/*
+DESCRIPTION:
+   Create an empty tree.
+*/
+{
+}
+
+/*******************************************************************/
+/* Function definition */
+void TriangleBvh::Clear
+(
+void
+)
+/*
+DESCRIPTION:
+   Remove all triangles and the tree.
+*/
+{
+    m_nodes.clear();
+    m_input.clear();
+    m_triangles.clear();
+    m_inputFaces.clear();
+    m_faces.clear();
+    m_depth = 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int TriangleBvh::AddTriangle
+(
+const float *a,   /* I: vertex 1 (x,y,z) */
+const float *b,   /* I: vertex 2 */
+const float *c,   /* I: vertex 3 */
+int face          /* I: face tag */
+)
+/*
+DESCRIPTION:
+   Add one triangle before Build().
+
+   Return 1 if the tree is already built, else 0.
+*/
+{
+    if (IsBuilt())
+        return 1;
+
+    m_input.insert(m_input.end(), a, a + 3);
+    m_input.insert(m_input.end(), b, b + 3);
+    m_input.insert(m_input.end(), c, c + 3);
+    m_inputFaces.push_back(face);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int TriangleBvh::AddFacets
+(
+const szwFacets &facets,  /* I: facets of one face */
+int face                  /* I: face tag */
+)
+/*
+DESCRIPTION:
+   Add the triangles of the strips of one face before Build().
+
+   Return 1 if the tree is built or the strip list is invalid, else 0.
+*/
+{
+    svxFacets strips{};
+    strips.numTriStrip = facets.numberTriangleStrip;
+    strips.TriStrip = facets.triangleStrip;
+    strips.numVertex = facets.numberVertex;
+    strips.Vertex = facets.vertex;
+    return AddFacets(strips, face);
+}
+
+/*******************************************************************/
+/* Function definition */
+int TriangleBvh::AddFacets
+(
+const svxFacets &facets,  /* I: facets of one face */
+int face                  /* I: face tag */
+)
+/*
+DESCRIPTION:
+   Add the triangles of the strips of one face before Build().
+
+   Return 1 if the tree is built or the strip list is invalid, else 0.
+*/
+{
+    if (IsBuilt() || facets.numTriStrip < 0 || (facets.numTriStrip > 0 && facets.TriStrip == nullptr))
+        return 1;
+
+    const int *s = facets.TriStrip;
+    for (int k = 0; k < facets.numTriStrip; k++)
+    {
+        const int n = *s++;
+        for (int j = 0; j < n; j++)
+        {
+            if (s[j] < 0 || s[j] >= facets.numVertex)
+                return 1;
+        }
+        s += n;
+    }
+
+    s = facets.TriStrip;
+    for (int k = 0; k < facets.numTriStrip; k++)
+    {
+        const int n = *s++;
+        for (int j = 0; j + 2 < n; j++)
+        {
+            const int a = s[(j & 1) ? j + 1 : j], b = s[(j & 1) ? j : j + 1], c = s[j + 2];
+            if (a != b && b != c && c != a)
+                AddTriangle(&facets.Vertex[a].x, &facets.Vertex[b].x, &facets.Vertex[c].x, face);
+        }
+        s += n;
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int TriangleBvh::Build
+(
+void
+)
+/*
+DESCRIPTION:
+   Build the tree over all triangles added so far. The added triangles are
+moved into the tree; Clear() must be called before adding new ones.
+
+   Return 1 if there are no triangles, else 0.
+*/
+{
+    const int count = (int)m_inputFaces.size();
+    if (IsBuilt() || count == 0)
+        return 1;
+
+    /* bounding box and center of each triangle */
+    std::vector<float> boxes((size_t)count * 6), centers((size_t)count * 3);
+    for (int i = 0; i < count; i++)
+    {
+        const float *v = &m_input[(size_t)i * 9];
+        for (int k = 0; k < 3; k++)
+        {
+            const float low = std::min(v[k], std::min(v[3 + k], v[6 + k]));
+            const float high = std::max(v[k], std::max(v[3 + k], v[6 + k]));
+            boxes[(size_t)i * 6 + k] = low;
+            boxes[(size_t)i * 6 + 3 + k] = high;
+            centers[(size_t)i * 3 + k] = 0.5f * (low + high);
+        }
+    }
+
+    std::vector<int> order(count);
+    for (int i = 0; i < count; i++)
+        order[i] = i;
+
+    m_nodes.reserve((size_t)count * 2);
+    m_nodes.push_back(TriangleBvhNode());
+    m_depth = NodeBuild(0, 0, count, order, centers, boxes, 1);
+    m_nodes.shrink_to_fit();
+
+    /* triangles in leaf order, edges precomputed */
+    m_triangles.resize((size_t)count * TRIANGLE_FLOATS);
+    m_faces.resize(count);
+    for (int i = 0; i < count; i++)
+    {
+        const float *v = &m_input[(size_t)order[i] * 9];
+        float *t = &m_triangles[(size_t)i * TRIANGLE_FLOATS];
+        for (int k = 0; k < 3; k++)
+        {
+            t[k] = v[k];
+            t[3 + k] = v[3 + k] - v[k];
+            t[6 + k] = v[6 + k] - v[k];
+        }
+        m_faces[i] = m_inputFaces[order[i]];
+    }
+
+    std::vector<float>().swap(m_input);
+    std::vector<int>().swap(m_inputFaces);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int TriangleBvh::NodeBuild
+(
+int node,                            /* I: node to fill */
+int first,                           /* I: first entry of "order" */
+int count,                           /* I: number of triangles */
+std::vector<int> &order,             /* I/O: triangle order */
+const std::vector<float> &centers,   /* I: triangle centers */
+const std::vector<float> &boxes,     /* I: triangle boxes */
+int depth                            /* I: depth of the node */
+)
+/*
+DESCRIPTION:
+   Fill one node and build its subtree. The split plane is chosen among
+TRIANGLE_BVH_BINS planes per axis by the surface area heuristic.
+
+   Return the depth of the subtree.
+*/
+{
+    float low[3] = { FLT_MAX, FLT_MAX, FLT_MAX }, high[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+    float centerLow[3] = { FLT_MAX, FLT_MAX, FLT_MAX }, centerHigh[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+    for (int i = first; i < first + count; i++)
+    {
+        const float *box = &boxes[(size_t)order[i] * 6];
+        const float *center = &centers[(size_t)order[i] * 3];
+        for (int k = 0; k < 3; k++)
+        {
+            low[k] = std::min(low[k], box[k]);
+            high[k] = std::max(high[k], box[3 + k]);
+            centerLow[k] = std::min(centerLow[k], center[k]);
+            centerHigh[k] = std::max(centerHigh[k], center[k]);
+        }
+    }
+    memcpy(m_nodes[node].low, low, sizeof(low));
+    memcpy(m_nodes[node].high, high, sizeof(high));
+    m_nodes[node].first = first;
+    m_nodes[node].count = count;
+
+    if (count <= TRIANGLE_BVH_LEAF_SIZE || depth >= TRIANGLE_BVH_STACK - 1)
+        return depth;
+
+    /* binned SAH over the three axes */
+    int bestAxis = -1, bestBin = 0;
+    float bestCost = FLT_MAX;
+    for (int axis = 0; axis < 3; axis++)
+    {
+        const float extent = centerHigh[axis] - centerLow[axis];
+        if (extent <= 0.0f)
+            continue;
+
+        int binCount[TRIANGLE_BVH_BINS] = {};
+        float binLow[TRIANGLE_BVH_BINS][3], binHigh[TRIANGLE_BVH_BINS][3];
+        for (int b = 0; b < TRIANGLE_BVH_BINS; b++)
+        {
+            for (int k = 0; k < 3; k++)
+            {
+                binLow[b][k] = FLT_MAX;
+                binHigh[b][k] = -FLT_MAX;
+            }
+        }
+
+        const float scale = TRIANGLE_BVH_BINS / extent;
+        for (int i = first; i < first + count; i++)
+        {
+            const int t = order[i];
+            int b = (int)((centers[(size_t)t * 3 + axis] - centerLow[axis]) * scale);
+            b = b < TRIANGLE_BVH_BINS ? b : TRIANGLE_BVH_BINS - 1;
+            binCount[b]++;
+            for (int k = 0; k < 3; k++)
+            {
+                binLow[b][k] = std::min(binLow[b][k], boxes[(size_t)t * 6 + k]);
+                binHigh[b][k] = std::max(binHigh[b][k], boxes[(size_t)t * 6 + 3 + k]);
+            }
+        }
+
+        /* sweep from the right, then from the left */
+        float rightArea[TRIANGLE_BVH_BINS];
+        int rightCount[TRIANGLE_BVH_BINS];
+        float accLow[3] = { FLT_MAX, FLT_MAX, FLT_MAX }, accHigh[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+        int acc = 0;
+        for (int b = TRIANGLE_BVH_BINS - 1; b > 0; b--)
+        {
+            acc += binCount[b];
+            for (int k = 0; k < 3; k++)
+            {
+                accLow[k] = std::min(accLow[k], binLow[b][k]);
+                accHigh[k] = std::max(accHigh[k], binHigh[b][k]);
+            }
+            rightCount[b] = acc;
+            rightArea[b] = acc ? BoxArea(accLow, accHigh) : 0.0f;
+        }
+
+        acc = 0;
+        for (int k = 0; k < 3; k++)
+        {
+            accLow[k] = FLT_MAX;
+            accHigh[k] = -FLT_MAX;
+        }
+        for (int b = 0; b < TRIANGLE_BVH_BINS - 1; b++)
+        {
+            acc += binCount[b];
+            for (int k = 0; k < 3; k++)
+            {
+                accLow[k] = std::min(accLow[k], binLow[b][k]);
+                accHigh[k] = std::max(accHigh[k], binHigh[b][k]);
+            }
+            if (acc == 0 || rightCount[b + 1] == 0)
+                continue;
+            const float cost = acc * BoxArea(accLow, accHigh) + rightCount[b + 1] * rightArea[b + 1];
+            if (cost < bestCost)
+            {
+                bestCost = cost;
+                bestAxis = axis;
+                bestBin = b;
+            }
+        }
+    }
+
+    /* all centers coincide, or a leaf is cheaper than the best split */
+    const float leafCost = count * BoxArea(low, high);
+    if (bestAxis < 0 || (count <= LEAF_MAX && bestCost >= leafCost))
+        return depth;
+
+    const float extent = centerHigh[bestAxis] - centerLow[bestAxis];
+    const float scale = TRIANGLE_BVH_BINS / extent;
+    int *mid = std::partition(order.data() + first, order.data() + first + count, [&](int t)
+    {
+        int b = (int)((centers[(size_t)t * 3 + bestAxis] - centerLow[bestAxis]) * scale);
+        b = b < TRIANGLE_BVH_BINS ? b : TRIANGLE_BVH_BINS - 1;
+        return b <= bestBin;
+    });
+    const int leftCount = (int)(mid - (order.data() + first));
+
+    const int left = (int)m_nodes.size();
+    m_nodes.push_back(TriangleBvhNode());
+    const int leftDepth = NodeBuild(left, first, leftCount, order, centers, boxes, depth + 1);
+
+    const int right = (int)m_nodes.size();
+    m_nodes.push_back(TriangleBvhNode());
+    const int rightDepth = NodeBuild(right, first + leftCount, count - leftCount, order, centers, boxes, depth + 1);
+
+    m_nodes[node].first = right;
+    m_nodes[node].count = -1 - bestAxis;
+    return std::max(leftDepth, rightDepth);
+}
+
+/*******************************************************************/
+/* Function definition */
+int TriangleBvh::Intersect
+(
+const svxAxis &ray,      /* I: ray start and direction */
+double length,           /* I: ray length (0 = unlimited) */
+TriangleBvhHit *hit      /* O: closest hit */
+) const
+/*
+DESCRIPTION:
+   Trace one ray and find the closest triangle in front of its start.
+
+   Return 1 if the tree is not built or the direction is zero, else 0
+(also when nothing is hit: hit->face is TRIANGLE_BVH_NO_HIT).
+*/
+{
+    hit->face = hit->triangle = TRIANGLE_BVH_NO_HIT;
+    hit->refined = 0;
+
+    float origin[3], direction[3], tMax;
+    if (!IsBuilt() || RayPrepare(ray, length, origin, direction, &tMax))
+        return 1;
+    const float inverse[3] = { 1.0f / direction[0], 1.0f / direction[1], 1.0f / direction[2] };
+
+    int best = -1;
+    int stack[TRIANGLE_BVH_STACK], top = 0;
+    int node = BoxEntry(m_nodes[0], origin, inverse, tMax) < FLT_MAX ? 0 : -1;
+    while (node >= 0)
+    {
+        const TriangleBvhNode &n = m_nodes[node];
+        if (n.count > 0)
+        {
+            for (int i = n.first; i < n.first + n.count; i++)
+            {
+                const float t = TriangleIntersect(&m_triangles[(size_t)i * TRIANGLE_FLOATS], origin, direction, tMax);
+                if (t < tMax)
+                {
+                    tMax = t;
+                    best = i;
+                }
+            }
+            node = top > 0 ? stack[--top] : -1;
+            continue;
+        }
+
+        /* visit the nearer child first */
+        int nearChild = node + 1, farChild = n.first;
+        if (direction[-1 - n.count] < 0.0f)
+            std::swap(nearChild, farChild);
+        const float tNear = BoxEntry(m_nodes[nearChild], origin, inverse, tMax);
+        const float tFar = BoxEntry(m_nodes[farChild], origin, inverse, tMax);
+        if (tNear < FLT_MAX)
+        {
+            if (tFar < FLT_MAX)
+                stack[top++] = farChild;
+            node = nearChild;
+        }
+        else if (tFar < FLT_MAX)
+        {
+            node = farChild;
+        }
+        else
+        {
+            node = top > 0 ? stack[--top] : -1;
+        }
+    }
+
+    if (best >= 0)
+        HitFinish(ray, tMax, best, m_faces[best], hit);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int TriangleBvh::IntersectPacket
+(
+int count,                 /* I: number of rays (1 ~ TRIANGLE_BVH_PACKET) */
+const svxAxis *rays,       /* I: rays */
+double length,             /* I: ray length (0 = unlimited) */
+TriangleBvhHit *hits       /* O: closest hit per ray */
+) const
+/*
+DESCRIPTION:
+   Trace up to four rays together. A node is entered if any ray of the
+packet hits its box closer than that ray's current hit.
+
+   Return 1 if the tree is not built or the input is invalid, else 0.
+*/
+{
+    if (!IsBuilt() || count < 1 || count > TRIANGLE_BVH_PACKET)
+        return 1;
+
+    float o[3][TRIANGLE_BVH_PACKET] = {}, d[3][TRIANGLE_BVH_PACKET] = {}, inv[3][TRIANGLE_BVH_PACKET] = {};
+    float tMax[TRIANGLE_BVH_PACKET];
+    int best[TRIANGLE_BVH_PACKET];
+    for (int r = 0; r < TRIANGLE_BVH_PACKET; r++)
+    {
+        float origin[3] = {}, direction[3] = { 1.0f, 1.0f, 1.0f };
+        tMax[r] = -1.0f;   /* unused lanes never hit */
+        best[r] = -1;
+        if (r < count)
+        {
+            hits[r].face = hits[r].triangle = TRIANGLE_BVH_NO_HIT;
+            hits[r].refined = 0;
+            if (RayPrepare(rays[r], length, origin, direction, &tMax[r]))
+            {
+                direction[0] = direction[1] = direction[2] = 1.0f;
+                tMax[r] = -1.0f;
+            }
+        }
+        for (int k = 0; k < 3; k++)
+        {
+            o[k][r] = origin[k];
+            d[k][r] = direction[k];
+            inv[k][r] = 1.0f / direction[k];
+        }
+    }
+
+    RayPacket packet;
+    for (int k = 0; k < 3; k++)
+    {
+        packet.origin[k] = Lane4Load(o[k]);
+        packet.direction[k] = Lane4Load(d[k]);
+        packet.inverse[k] = Lane4Load(inv[k]);
+    }
+    Lane4 limit = Lane4Load(tMax);
+    const Lane4 zero = Lane4Set(0.0f);
+    const Lane4 one = Lane4Set(1.0f);
+    const Lane4 detMin = Lane4Set(DET_MIN);
+
+    int stack[TRIANGLE_BVH_STACK], top = 0;
+    stack[top++] = 0;
+    while (top > 0)
+    {
+        const int node = stack[--top];
+        const TriangleBvhNode &n = m_nodes[node];
+
+        /* slab test of the four rays */
+        Lane4 enter = zero, leave = limit;
+        for (int k = 0; k < 3; k++)
+        {
+            const Lane4 t1 = Lane4Mul(Lane4Sub(Lane4Set(n.low[k]), packet.origin[k]), packet.inverse[k]);
+            const Lane4 t2 = Lane4Mul(Lane4Sub(Lane4Set(n.high[k]), packet.origin[k]), packet.inverse[k]);
+            enter = Lane4Max(enter, Lane4Min(t1, t2));
+            leave = Lane4Min(leave, Lane4Max(t1, t2));
+        }
+        if (Lane4Mask(Lane4Le(enter, leave)) == 0)
+            continue;
+
+        if (n.count < 0)
+        {
+            /* push the far child first, judged by the first ray */
+            const int axis = -1 - n.count;
+            if (d[axis][0] < 0.0f)
+            {
+                stack[top++] = node + 1;
+                stack[top++] = n.first;
+            }
+            else
+            {
+                stack[top++] = n.first;
+                stack[top++] = node + 1;
+            }
+            continue;
+        }
+
+        /* Moller-Trumbore, one triangle against four rays */
+        for (int i = n.first; i < n.first + n.count; i++)
+        {
+            const float *tri = &m_triangles[(size_t)i * TRIANGLE_FLOATS];
+            const Lane4 e1[3] = { Lane4Set(tri[3]), Lane4Set(tri[4]), Lane4Set(tri[5]) };
+            const Lane4 e2[3] = { Lane4Set(tri[6]), Lane4Set(tri[7]), Lane4Set(tri[8]) };
+            const Lane4 *dir = packet.direction;
+
+            const Lane4 p0 = Lane4Sub(Lane4Mul(dir[1], e2[2]), Lane4Mul(dir[2], e2[1]));
+            const Lane4 p1 = Lane4Sub(Lane4Mul(dir[2], e2[0]), Lane4Mul(dir[0], e2[2]));
+            const Lane4 p2 = Lane4Sub(Lane4Mul(dir[0], e2[1]), Lane4Mul(dir[1], e2[0]));
+            const Lane4 det = Lane4Add(Lane4Add(Lane4Mul(e1[0], p0), Lane4Mul(e1[1], p1)), Lane4Mul(e1[2], p2));
+            const Lane4 invDet = Lane4Div(one, det);
+
+            const Lane4 s0 = Lane4Sub(packet.origin[0], Lane4Set(tri[0]));
+            const Lane4 s1 = Lane4Sub(packet.origin[1], Lane4Set(tri[1]));
+            const Lane4 s2 = Lane4Sub(packet.origin[2], Lane4Set(tri[2]));
+            const Lane4 u = Lane4Mul(Lane4Add(Lane4Add(Lane4Mul(s0, p0), Lane4Mul(s1, p1)), Lane4Mul(s2, p2)), invDet);
+
+            const Lane4 q0 = Lane4Sub(Lane4Mul(s1, e1[2]), Lane4Mul(s2, e1[1]));
+            const Lane4 q1 = Lane4Sub(Lane4Mul(s2, e1[0]), Lane4Mul(s0, e1[2]));
+            const Lane4 q2 = Lane4Sub(Lane4Mul(s0, e1[1]), Lane4Mul(s1, e1[0]));
+            const Lane4 v = Lane4Mul(Lane4Add(Lane4Add(Lane4Mul(dir[0], q0), Lane4Mul(dir[1], q1)), Lane4Mul(dir[2], q2)), invDet);
+            const Lane4 t = Lane4Mul(Lane4Add(Lane4Add(Lane4Mul(e2[0], q0), Lane4Mul(e2[1], q1)), Lane4Mul(e2[2], q2)), invDet);
+
+            Lane4 ok = Lane4Lt(detMin, Lane4Abs(det));
+            ok = Lane4And(ok, Lane4Le(zero, u));
+            ok = Lane4And(ok, Lane4Le(zero, v));
+            ok = Lane4And(ok, Lane4Le(Lane4Add(u, v), one));
+            ok = Lane4And(ok, Lane4Lt(zero, t));
+            ok = Lane4And(ok, Lane4Lt(t, limit));
+
+            const int mask = Lane4Mask(ok);
+            if (mask == 0)
+                continue;
+
+            float tLane[TRIANGLE_BVH_PACKET];
+            Lane4Store(tLane, t);
+            for (int r = 0; r < TRIANGLE_BVH_PACKET; r++)
+            {
+                if (mask & (1 << r))
+                {
+                    tMax[r] = tLane[r];
+                    best[r] = i;
+                }
+            }
+            limit = Lane4Load(tMax);
+        }
+    }
+
+    for (int r = 0; r < count; r++)
+    {
+        if (best[r] >= 0)
+            HitFinish(rays[r], tMax[r], best[r], m_faces[best[r]], &hits[r]);
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int TriangleBvh::IntersectList
+(
+int count,                  /* I: number of rays */
+const svxAxis *rays,        /* I: rays, neighbours should be coherent */
+double length,              /* I: ray length (0 = unlimited) */
+TriangleBvhRefine refine,   /* I: exact refinement (NULL for facet hits) */
+void *data,                 /* I: data of "refine" */
+TriangleBvhHit *hits        /* O: closest hit per ray */
+) const
+/*
+DESCRIPTION:
+   Trace a list of rays in packets of four. If "refine" is given, every
+facet hit is passed to it with the face tag of the triangle, and the
+exact point it returns replaces the facet point.
+
+   Return 1 if the tree is not built or the input is invalid, else 0.
+*/
+{
+    if (!IsBuilt() || count < 0 || (count > 0 && (rays == nullptr || hits == nullptr)))
+        return 1;
+
+    for (int i = 0; i < count; i += TRIANGLE_BVH_PACKET)
+    {
+        const int n = std::min(TRIANGLE_BVH_PACKET, count - i);
+        IntersectPacket(n, rays + i, length, hits + i);
+    }
+
+    if (refine == nullptr)
+        return 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        TriangleBvhHit &hit = hits[i];
+        svxPoint point;
+        if (hit.face == TRIANGLE_BVH_NO_HIT || refine(data, hit.face, &rays[i], &point))
+            continue;
+
+        const svxVector &d = rays[i].Dir;
+        const double len = sqrt(d.x * d.x + d.y * d.y + d.z * d.z);
+        hit.point = point;
+        hit.t = ((point.x - rays[i].Pnt.x) * d.x + (point.y - rays[i].Pnt.y) * d.y +
+            (point.z - rays[i].Pnt.z) * d.z) / len;
+        hit.refined = 1;
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int TriangleBvh::Closest
+(
+const svxPoint &point,          /* I: query point */
+double limit,                   /* I: largest distance searched (0 = unlimited) */
+TriangleBvhNearest *nearest     /* O: closest point */
+) const
+/*
+DESCRIPTION:
+   Find the closest point of the triangles to a point. Nodes are visited
+nearest box first, and a node whose box is farther than the closest
+point found so far is skipped.
+
+   Return 1 if the tree is not built, else 0 (also when no triangle is
+within "limit": nearest->face is TRIANGLE_BVH_NO_HIT).
+*/
+{
+    nearest->face = nearest->triangle = TRIANGLE_BVH_NO_HIT;
+    nearest->distance = limit > 0.0 ? limit : DBL_MAX;
+    if (!IsBuilt())
+        return 1;
+
+    double best = limit > 0.0 ? limit * limit : DBL_MAX;
+    int stack[TRIANGLE_BVH_STACK], top = 0;
+    double stackDistance[TRIANGLE_BVH_STACK];
+    int node = BoxDistance2(m_nodes[0], point) <= best ? 0 : -1;
+    while (node >= 0)
+    {
+        const TriangleBvhNode &n = m_nodes[node];
+        if (n.count > 0)
+        {
+            for (int i = n.first; i < n.first + n.count; i++)
+            {
+                svxPoint closest;
+                const double d = TriangleClosest(&m_triangles[(size_t)i * TRIANGLE_FLOATS], point, &closest);
+                if (d < best)
+                {
+                    best = d;
+                    nearest->point = closest;
+                    nearest->triangle = i;
+                }
+            }
+            node = -1;
+        }
+        else
+        {
+            int nearChild = node + 1, farChild = n.first;
+            double dNear = BoxDistance2(m_nodes[nearChild], point), dFar = BoxDistance2(m_nodes[farChild], point);
+            if (dFar < dNear)
+            {
+                std::swap(nearChild, farChild);
+                std::swap(dNear, dFar);
+            }
+            if (dFar <= best)
+            {
+                stackDistance[top] = dFar;
+                stack[top++] = farChild;
+            }
+            node = dNear <= best ? nearChild : -1;
+        }
+
+        /* next node still closer than the best point */
+        while (node < 0 && top > 0)
+        {
+            top--;
+            node = stackDistance[top] <= best ? stack[top] : -1;
+        }
+    }
+
+    if (nearest->triangle >= 0)
+    {
+        nearest->distance = sqrt(best);
+        nearest->face = m_faces[nearest->triangle];
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void TriangleBvh::Triangle
+(
+int index,    /* I: triangle index in tree order */
+float a[3],   /* O: vertex 1 */
+float b[3],   /* O: vertex 2 */
+float c[3]    /* O: vertex 3 */
+) const
+/*
+DESCRIPTION:
+   Vertices of a triangle of the built tree.
+*/
+{
+    const float *t = &m_triangles[(size_t)index * TRIANGLE_FLOATS];
+    for (int k = 0; k < 3; k++)
+    {
+        a[k] = t[k];
+        b[k] = t[k] + t[3 + k];
+        c[k] = t[k] + t[6 + k];
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+svxBndBox TriangleBvh::Bounds
+(
+void
+) const
+/*
+DESCRIPTION:
+   Bounding box of all triangles (zero box if the tree is not built).
+*/
+{
+    svxBndBox box{};
+    if (IsBuilt())
+    {
+        box.X.min = m_nodes[0].low[0]; box.X.max = m_nodes[0].high[0];
+        box.Y.min = m_nodes[0].low[1]; box.Y.max = m_nodes[0].high[1];
+        box.Z.min = m_nodes[0].low[2]; box.Z.max = m_nodes[0].high[2];
+    }
+    return box;
+}
+
+/*******************************************************************/
+/* Function definition */
+int RayPrepare
+(
+const svxAxis &ray,     /* I: ray */
+double length,          /* I: ray length (0 = unlimited) */
+float origin[3],        /* O: start */
+float direction[3],     /* O: unit direction */
+float *tMax             /* O: largest distance */
+)
+/*
+DESCRIPTION:
+   Convert a ray to float with a unit direction.
+
+   Return 1 if the direction is zero, else 0.
+*/
+{
+    const double len = sqrt(ray.Dir.x * ray.Dir.x + ray.Dir.y * ray.Dir.y + ray.Dir.z * ray.Dir.z);
+    if (len <= 0.0)
+        return 1;
+
+    origin[0] = (float)ray.Pnt.x;
+    origin[1] = (float)ray.Pnt.y;
+    origin[2] = (float)ray.Pnt.z;
+    direction[0] = (float)(ray.Dir.x / len);
+    direction[1] = (float)(ray.Dir.y / len);
+    direction[2] = (float)(ray.Dir.z / len);
+    *tMax = length > 0.0 ? (float)length : FLT_MAX;
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+float BoxEntry
+(
+const TriangleBvhNode &node,  /* I: node */
+const float origin[3],        /* I: ray start */
+const float inverse[3],       /* I: 1 / direction */
+float tMax                    /* I: current closest hit */
+)
+/*
+DESCRIPTION:
+   Slab test. Return the entry distance, or FLT_MAX if the box is missed
+or lies beyond "tMax".
+*/
+{
+    float enter = 0.0f, leave = tMax;
+    for (int k = 0; k < 3; k++)
+    {
+        const float t1 = (node.low[k] - origin[k]) * inverse[k];
+        const float t2 = (node.high[k] - origin[k]) * inverse[k];
+        enter = std::max(enter, std::min(t1, t2));
+        leave = std::min(leave, std::max(t1, t2));
+    }
+    return enter <= leave ? enter : FLT_MAX;
+}
+
+/*******************************************************************/
+/* Function definition */
+float TriangleIntersect
+(
+const float *tri,           /* I: v0, e1, e2 */
+const float origin[3],      /* I: ray start */
+const float direction[3],   /* I: unit direction */
+float tMax                  /* I: current closest hit */
+)
+/*
+DESCRIPTION:
+   Moller-Trumbore ray/triangle test. Return the hit distance, or FLT_MAX
+if the triangle is missed or not closer than "tMax".
+*/
+{
+    const float *e1 = tri + 3, *e2 = tri + 6;
+    const float p[3] = { direction[1] * e2[2] - direction[2] * e2[1], direction[2] * e2[0] - direction[0] * e2[2],
+        direction[0] * e2[1] - direction[1] * e2[0] };
+    const float det = e1[0] * p[0] + e1[1] * p[1] + e1[2] * p[2];
+    if (fabsf(det) <= DET_MIN)
+        return FLT_MAX;
+
+    const float inv = 1.0f / det;
+    const float s[3] = { origin[0] - tri[0], origin[1] - tri[1], origin[2] - tri[2] };
+    const float u = (s[0] * p[0] + s[1] * p[1] + s[2] * p[2]) * inv;
+    if (u < 0.0f || u > 1.0f)
+        return FLT_MAX;
+
+    const float q[3] = { s[1] * e1[2] - s[2] * e1[1], s[2] * e1[0] - s[0] * e1[2], s[0] * e1[1] - s[1] * e1[0] };
+    const float v = (direction[0] * q[0] + direction[1] * q[1] + direction[2] * q[2]) * inv;
+    if (v < 0.0f || u + v > 1.0f)
+        return FLT_MAX;
+
+    const float t = (e2[0] * q[0] + e2[1] * q[1] + e2[2] * q[2]) * inv;
+    return t > 0.0f && t < tMax ? t : FLT_MAX;
+}
+
+/*******************************************************************/
+/* Function definition */
+float BoxArea
+(
+const float low[3],    /* I: box minimum */
+const float high[3]    /* I: box maximum */
+)
+/*
+DESCRIPTION:
+   Half the surface area of a box.
+*/
+{
+    const float x = high[0] - low[0], y = high[1] - low[1], z = high[2] - low[2];
+    return x * y + y * z + z * x;
+}
+
+/*******************************************************************/
+/* Function definition */
+double BoxDistance2
+(
+const TriangleBvhNode &node,   /* I: node */
+const svxPoint &point          /* I: point */
+)
+/*
+DESCRIPTION:
+   Squared distance from a point to the box of a node, 0 inside.
+*/
+{
+    const double p[3] = { point.x, point.y, point.z };
+    double d2 = 0.0;
+    for (int k = 0; k < 3; k++)
+    {
+        const double d = std::max(std::max((double)node.low[k] - p[k], p[k] - (double)node.high[k]), 0.0);
+        d2 += d * d;
+    }
+    return d2;
+}
+
+/*******************************************************************/
+/* Function definition */
+double TriangleClosest
+(
+const float *tri,         /* I: v0, e1, e2 */
+const svxPoint &point,    /* I: point */
+svxPoint *closest         /* O: closest point of the triangle */
+)
+/*
+DESCRIPTION:
+   Closest point of a triangle to a point, by the Voronoi region of the
+point (vertex, edge or inside), in double precision.
+
+   Return the squared distance.
+*/
+{
+    const double a[3] = { tri[0], tri[1], tri[2] };
+    const double ab[3] = { tri[3], tri[4], tri[5] }, ac[3] = { tri[6], tri[7], tri[8] };
+    const double ap[3] = { point.x - a[0], point.y - a[1], point.z - a[2] };
+    const double d1 = ab[0] * ap[0] + ab[1] * ap[1] + ab[2] * ap[2];
+    const double d2 = ac[0] * ap[0] + ac[1] * ap[1] + ac[2] * ap[2];
+    double v = 0.0, w = 0.0;   /* vertex a if d1 and d2 are not positive */
+    if (d1 > 0.0 || d2 > 0.0)
+    {
+        const double bp[3] = { ap[0] - ab[0], ap[1] - ab[1], ap[2] - ab[2] };
+        const double d3 = ab[0] * bp[0] + ab[1] * bp[1] + ab[2] * bp[2];
+        const double d4 = ac[0] * bp[0] + ac[1] * bp[1] + ac[2] * bp[2];
+        const double cp[3] = { ap[0] - ac[0], ap[1] - ac[1], ap[2] - ac[2] };
+        const double d5 = ab[0] * cp[0] + ab[1] * cp[1] + ab[2] * cp[2];
+        const double d6 = ac[0] * cp[0] + ac[1] * cp[1] + ac[2] * cp[2];
+        const double vc = d1 * d4 - d3 * d2, vb = d5 * d2 - d1 * d6, va = d3 * d6 - d5 * d4;
+        if (d3 >= 0.0 && d4 <= d3)
+            v = 1.0;                                   /* vertex b */
+        else if (d6 >= 0.0 && d5 <= d6)
+            w = 1.0;                                   /* vertex c */
+        else if (vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0)
+            v = d1 / (d1 - d3);                        /* edge ab */
+        else if (vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0)
+            w = d2 / (d2 - d6);                        /* edge ac */
+        else if (va <= 0.0 && d4 - d3 >= 0.0 && d5 - d6 >= 0.0)
+        {
+            w = (d4 - d3) / ((d4 - d3) + (d5 - d6));   /* edge bc */
+            v = 1.0 - w;
+        }
+        else
+        {
+            const double denominator = va + vb + vc;
+            v = denominator > 0.0 ? vb / denominator : 0.0;
+            w = denominator > 0.0 ? vc / denominator : 0.0;
+        }
+    }
+    closest->x = a[0] + v * ab[0] + w * ac[0];
+    closest->y = a[1] + v * ab[1] + w * ac[1];
+    closest->z = a[2] + v * ab[2] + w * ac[2];
+    const double x = point.x - closest->x, y = point.y - closest->y, z = point.z - closest->z;
+    return x * x + y * y + z * z;
+}
+
+/*******************************************************************/
+/* Function definition */
+void HitFinish
+(
+const svxAxis &ray,     /* I: ray */
+float t,                /* I: hit distance */
+int triangle,           /* I: triangle hit */
+int face,               /* I: face tag */
+TriangleBvhHit *hit     /* O: hit */
+)
+/*
+DESCRIPTION:
+   Fill a hit from its distance along the ray.
+*/
+{
+    const double len = sqrt(ray.Dir.x * ray.Dir.x + ray.Dir.y * ray.Dir.y + ray.Dir.z * ray.Dir.z);
+    hit->t = t;
+    hit->point.x = ray.Pnt.x + ray.Dir.x / len * t;
+    hit->point.y = ray.Pnt.y + ray.Dir.y / len * t;
+    hit->point.z = ray.Pnt.z + ray.Dir.z / len * t;
+    hit->face = face;
+    hit->triangle = triangle;
+    hit->refined = 0;
+}
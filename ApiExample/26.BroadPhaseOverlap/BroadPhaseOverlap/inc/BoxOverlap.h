@@ -0,0 +1,90 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+#pragma once
+
+/* ZW3D API includes */
+#include "zwapi_util.h"
+
+/* Application includes */
+#include <vector>
+
+/*******************************************************************/
+/* Constant definitions */
+#define BOX_OVERLAP_NULL (-1)
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: two overlapping boxes, by caller id, a < b */
+struct BoxOverlapPair
+{
+    int a;
+    int b;
+};
+
+/*
+DESCRIPTION:
+   Dynamic AABB tree for broad-phase overlap tests between many boxes
+(components, shapes). Each box is a leaf holding the caller's id; inner
+nodes bound their two children. Leaves are inserted next to the sibling
+that grows the tree the least, and the branches are rebalanced by
+rotations on the way up, so the tree stays shallow whatever the insertion
+order.
+
+   Leaves store the box enlarged by "margin" (the fat box). Move() only
+reinserts a leaf when its new box leaves the fat box, so components that
+move a little between two checks cost nothing. Queries and pairs always
+test the exact boxes.
+
+   Two boxes overlap if the gap between them is not larger than the
+clearance given to Pairs() or Query().
+*/
+class BoxOverlapTree
+{
+public:
+    BoxOverlapTree(double margin = 0.0);
+
+    int Insert(const svxBndBox &box, int id);
+    int Remove(int proxy);
+    int Move(int proxy, const svxBndBox &box);
+    void Clear(void);
+
+    int Query(const svxBndBox &box, double clearance, std::vector<int> &ids) const;
+    int Pairs(double clearance, std::vector<BoxOverlapPair> &pairs) const;
+
+    int Count(void) const { return m_leaves; }
+    int Height(void) const { return m_root == BOX_OVERLAP_NULL ? 0 : m_nodes[m_root].height + 1; }
+    int Id(int proxy) const { return m_nodes[proxy].id; }
+    const svxBndBox &Box(int proxy) const { return m_nodes[proxy].box; }
+
+private:
+    struct Node
+    {
+        svxBndBox fat;      /* leaf: box + margin, inner: union of the children */
+        svxBndBox box;      /* leaf: exact box */
+        int parent;         /* next free node when on the free list */
+        int child1;         /* BOX_OVERLAP_NULL for leaves */
+        int child2;
+        int height;         /* 0 for leaves, -1 for free nodes */
+        int id;
+    };
+
+    int NodeAllocate(void);
+    void NodeFree(int node);
+    void LeafInsert(int leaf);
+    void LeafRemove(int leaf);
+    int Balance(int node);
+    void Refit(int node);
+
+    std::vector<Node> m_nodes;
+    int m_root;
+    int m_free;       /* first free node */
+    int m_leaves;
+    double m_margin;
+};
+
+/*******************************************************************/
+/* Function declarations */
+int BoxOverlapTest(const svxBndBox &a, const svxBndBox &b, double clearance);
+int BoxOverlapSweep(int count, const svxBndBox *boxes, double clearance, std::vector<BoxOverlapPair> &pairs);
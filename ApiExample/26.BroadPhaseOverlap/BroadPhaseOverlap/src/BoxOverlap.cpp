@@ -0,0 +1,623 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* Application includes */
+#include <algorithm>
+#include "..\inc\BoxOverlap.h"
+
+/*******************************************************************/
+/* Function declarations */
+static svxBndBox BoxUnion(const svxBndBox &a, const svxBndBox &b);
+static svxBndBox BoxGrow(const svxBndBox &box, double margin);
+static double BoxArea(const svxBndBox &box);
+static int BoxContains(const svxBndBox &outer, const svxBndBox &inner);
+static bool PairLess(const BoxOverlapPair &p, const BoxOverlapPair &q);
+
+/*******************************************************************/
+/* Function definition */
+BoxOverlapTree::BoxOverlapTree
+(
+double margin   /* I: fat box margin for Move() */
+)
+    : m_root(BOX_OVERLAP_NULL), m_free(BOX_OVERLAP_NULL), m_leaves(0), m_margin(margin > 0.0 ? margin : 0.0)
+/*
+DESCRIPTION:
+   Create an empty tree.
+*/
+{
+}
+
+/*******************************************************************/
+/* Function definition */
+void BoxOverlapTree::Clear
+(
+void
+)
+/*
+DESCRIPTION:
+   Remove all boxes.
+*/
+{
+    m_nodes.clear();
+    m_root = m_free = BOX_OVERLAP_NULL;
+    m_leaves = 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int BoxOverlapTree::Insert
+(
+const svxBndBox &box,   /* I: box */
+int id                  /* I: caller id, reported by Query() and Pairs() */
+)
+/*
+DESCRIPTION:
+   Add a box. Return its proxy for Move() and Remove().
+*/
+{
+    const int leaf = NodeAllocate();
+    Node &node = m_nodes[leaf];
+    node.box = box;
+    node.fat = BoxGrow(box, m_margin);
+    node.id = id;
+    node.height = 0;
+    LeafInsert(leaf);
+    m_leaves++;
+    return leaf;
+}
+
+/*******************************************************************/
+/* Function definition */
+int BoxOverlapTree::Remove
+(
+int proxy   /* I: proxy of Insert() */
+)
+/*
+DESCRIPTION:
+   Remove a box.
+
+   Return 1 if the proxy is not a box of the tree, else 0.
+*/
+{
+    if (proxy < 0 || proxy >= (int)m_nodes.size() || m_nodes[proxy].height != 0)
+        return 1;
+
+    LeafRemove(proxy);
+    NodeFree(proxy);
+    m_leaves--;
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int BoxOverlapTree::Move
+(
+int proxy,              /* I: proxy of Insert() */
+const svxBndBox &box    /* I: new box */
+)
+/*
+DESCRIPTION:
+   Change the box of a leaf. The leaf is only reinserted if the new box is
+not inside its fat box.
+
+   Return 1 if the proxy is not a box of the tree, else 0.
+*/
+{
+    if (proxy < 0 || proxy >= (int)m_nodes.size() || m_nodes[proxy].height != 0)
+        return 1;
+
+    m_nodes[proxy].box = box;
+    if (BoxContains(m_nodes[proxy].fat, box))
+        return 0;
+
+    LeafRemove(proxy);
+    m_nodes[proxy].fat = BoxGrow(box, m_margin);
+    LeafInsert(proxy);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int BoxOverlapTree::Query
+(
+const svxBndBox &box,     /* I: box */
+double clearance,         /* I: largest gap counted as overlap */
+std::vector<int> &ids     /* O: ids of the boxes overlapping "box" */
+) const
+/*
+DESCRIPTION:
+   Find the boxes overlapping a box.
+
+   Return the number of boxes found.
+*/
+{
+    ids.clear();
+    if (m_root == BOX_OVERLAP_NULL)
+        return 0;
+
+    std::vector<int> stack;
+    stack.push_back(m_root);
+    while (!stack.empty())
+    {
+        const Node &node = m_nodes[stack.back()];
+        stack.pop_back();
+        if (!BoxOverlapTest(node.fat, box, clearance))
+            continue;
+
+        if (node.height == 0)
+        {
+            if (BoxOverlapTest(node.box, box, clearance))
+                ids.push_back(node.id);
+        }
+        else
+        {
+            stack.push_back(node.child1);
+            stack.push_back(node.child2);
+        }
+    }
+    return (int)ids.size();
+}
+
+/*******************************************************************/
+/* Function definition */
+int BoxOverlapTree::Pairs
+(
+double clearance,                      /* I: largest gap counted as overlap */
+std::vector<BoxOverlapPair> &pairs     /* O: overlapping pairs, sorted */
+) const
+/*
+DESCRIPTION:
+   Find all pairs of overlapping boxes: every leaf queries the tree and
+keeps the leaves after it, so each pair is reported once.
+
+   Return the number of pairs.
+*/
+{
+    pairs.clear();
+    if (m_root == BOX_OVERLAP_NULL)
+        return 0;
+
+    std::vector<int> stack;
+    for (int leaf = 0; leaf < (int)m_nodes.size(); leaf++)
+    {
+        if (m_nodes[leaf].height != 0)
+            continue;
+
+        const svxBndBox &box = m_nodes[leaf].box;
+        stack.push_back(m_root);
+        while (!stack.empty())
+        {
+            const int index = stack.back();
+            const Node &node = m_nodes[index];
+            stack.pop_back();
+            if (!BoxOverlapTest(node.fat, box, clearance))
+                continue;
+
+            if (node.height != 0)
+            {
+                stack.push_back(node.child1);
+                stack.push_back(node.child2);
+            }
+            else if (index > leaf && BoxOverlapTest(node.box, box, clearance))
+            {
+                const int id = m_nodes[leaf].id;
+                pairs.push_back({ std::min(id, node.id), std::max(id, node.id) });
+            }
+        }
+    }
+
+    std::sort(pairs.begin(), pairs.end(), PairLess);
+    return (int)pairs.size();
+}
+
+/*******************************************************************/
+/* Function definition */
+int BoxOverlapTree::NodeAllocate
+(
+void
+)
+/*
+DESCRIPTION:
+   Take a node from the free list, or add one. References to nodes are
+invalid after this call.
+*/
+{
+    int node = m_free;
+    if (node != BOX_OVERLAP_NULL)
+        m_free = m_nodes[node].parent;
+    else
+    {
+        node = (int)m_nodes.size();
+        m_nodes.push_back(Node());
+    }
+
+    Node &n = m_nodes[node];
+    n.parent = n.child1 = n.child2 = BOX_OVERLAP_NULL;
+    n.height = 0;
+    n.id = BOX_OVERLAP_NULL;
+    return node;
+}
+
+/*******************************************************************/
+/* Function definition */
+void BoxOverlapTree::NodeFree
+(
+int node   /* I: node */
+)
+/*
+DESCRIPTION:
+   Put a node on the free list.
+*/
+{
+    m_nodes[node].parent = m_free;
+    m_nodes[node].height = -1;
+    m_free = node;
+}
+
+/*******************************************************************/
+/* Function definition */
+void BoxOverlapTree::LeafInsert
+(
+int leaf   /* I: leaf with its fat box set */
+)
+/*
+DESCRIPTION:
+   Link a leaf beside the sibling of least cost: the area of the new
+parent plus the growth of all ancestors.
+*/
+{
+    if (m_root == BOX_OVERLAP_NULL)
+    {
+        m_root = leaf;
+        m_nodes[leaf].parent = BOX_OVERLAP_NULL;
+        return;
+    }
+
+    const svxBndBox leafBox = m_nodes[leaf].fat;
+    int index = m_root;
+    while (m_nodes[index].height > 0)
+    {
+        const Node &node = m_nodes[index];
+        const double area = BoxArea(node.fat);
+        const double combined = BoxArea(BoxUnion(node.fat, leafBox));
+
+        /* cost of a new parent here, and growth pushed down to the children */
+        const double cost = 2.0 * combined;
+        const double inheritance = 2.0 * (combined - area);
+
+        double childCost[2];
+        const int children[2] = { node.child1, node.child2 };
+        for (int k = 0; k < 2; k++)
+        {
+            const Node &child = m_nodes[children[k]];
+            const double grown = BoxArea(BoxUnion(child.fat, leafBox));
+            childCost[k] = (child.height == 0 ? grown : grown - BoxArea(child.fat)) + inheritance;
+        }
+
+        if (cost < childCost[0] && cost < childCost[1])
+            break;
+        index = childCost[0] < childCost[1] ? children[0] : children[1];
+    }
+
+    const int sibling = index;
+    const int oldParent = m_nodes[sibling].parent;
+    const int newParent = NodeAllocate();
+    Node &parent = m_nodes[newParent];
+    parent.parent = oldParent;
+    parent.fat = BoxUnion(leafBox, m_nodes[sibling].fat);
+    parent.height = m_nodes[sibling].height + 1;
+    parent.child1 = sibling;
+    parent.child2 = leaf;
+
+    if (oldParent == BOX_OVERLAP_NULL)
+        m_root = newParent;
+    else if (m_nodes[oldParent].child1 == sibling)
+        m_nodes[oldParent].child1 = newParent;
+    else
+        m_nodes[oldParent].child2 = newParent;
+
+    m_nodes[sibling].parent = newParent;
+    m_nodes[leaf].parent = newParent;
+    Refit(newParent);
+}
+
+/*******************************************************************/
+/* Function definition */
+void BoxOverlapTree::LeafRemove
+(
+int leaf   /* I: leaf */
+)
+/*
+DESCRIPTION:
+   Unlink a leaf; its sibling takes the place of their parent.
+*/
+{
+    if (leaf == m_root)
+    {
+        m_root = BOX_OVERLAP_NULL;
+        return;
+    }
+
+    const int parent = m_nodes[leaf].parent;
+    const int grandParent = m_nodes[parent].parent;
+    const int sibling = m_nodes[parent].child1 == leaf ? m_nodes[parent].child2 : m_nodes[parent].child1;
+
+    m_nodes[sibling].parent = grandParent;
+    NodeFree(parent);
+    if (grandParent == BOX_OVERLAP_NULL)
+    {
+        m_root = sibling;
+        return;
+    }
+
+    if (m_nodes[grandParent].child1 == parent)
+        m_nodes[grandParent].child1 = sibling;
+    else
+        m_nodes[grandParent].child2 = sibling;
+    Refit(grandParent);
+}
+
+/*******************************************************************/
+/* Function definition */
+void BoxOverlapTree::Refit
+(
+int node   /* I: first inner node to update */
+)
+/*
+DESCRIPTION:
+   Rebalance and update the boxes and heights from a node up to the root.
+*/
+{
+    while (node != BOX_OVERLAP_NULL)
+    {
+        node = Balance(node);
+        Node &n = m_nodes[node];
+        n.height = 1 + std::max(m_nodes[n.child1].height, m_nodes[n.child2].height);
+        n.fat = BoxUnion(m_nodes[n.child1].fat, m_nodes[n.child2].fat);
+        node = n.parent;
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+int BoxOverlapTree::Balance
+(
+int iA   /* I: inner node */
+)
+/*
+DESCRIPTION:
+   If the heights of the children of A differ by more than one, rotate the
+higher child C (or B) up: A takes C's lower child and C takes A's place.
+
+   Return the node now at A's place.
+*/
+{
+    Node &A = m_nodes[iA];
+    if (A.height < 2)
+        return iA;
+
+    const int iB = A.child1, iC = A.child2;
+    Node &B = m_nodes[iB];
+    Node &C = m_nodes[iC];
+    const int balance = C.height - B.height;
+    if (balance >= -1 && balance <= 1)
+        return iA;
+
+    /* the higher child goes up, the lower one stays under A */
+    const int iUp = balance > 1 ? iC : iB;
+    const int iStay = balance > 1 ? iB : iC;
+    Node &Up = m_nodes[iUp];
+    Node &Stay = m_nodes[iStay];
+    const int iF = Up.child1, iG = Up.child2;
+    Node &F = m_nodes[iF];
+    Node &G = m_nodes[iG];
+
+    Up.child1 = iA;
+    Up.parent = A.parent;
+    A.parent = iUp;
+    if (Up.parent == BOX_OVERLAP_NULL)
+        m_root = iUp;
+    else if (m_nodes[Up.parent].child1 == iA)
+        m_nodes[Up.parent].child1 = iUp;
+    else
+        m_nodes[Up.parent].child2 = iUp;
+
+    /* the higher grandchild stays with Up, the other one moves to A */
+    const int iKeep = F.height > G.height ? iF : iG;
+    const int iMove = F.height > G.height ? iG : iF;
+    Node &Keep = m_nodes[iKeep];
+    Node &Move = m_nodes[iMove];
+    Up.child2 = iKeep;
+    if (balance > 1)
+        A.child2 = iMove;
+    else
+        A.child1 = iMove;
+    Move.parent = iA;
+
+    A.fat = BoxUnion(Stay.fat, Move.fat);
+    A.height = 1 + std::max(Stay.height, Move.height);
+    Up.fat = BoxUnion(A.fat, Keep.fat);
+    Up.height = 1 + std::max(A.height, Keep.height);
+    return iUp;
+}
+
+/*******************************************************************/
+/* Function definition */
+int BoxOverlapTest
+(
+const svxBndBox &a,   /* I: first box */
+const svxBndBox &b,   /* I: second box */
+double clearance      /* I: largest gap counted as overlap */
+)
+/*
+DESCRIPTION:
+   Return 1 if the gap between two boxes is not larger than "clearance" on
+any axis, else 0.
+*/
+{
+    return a.X.min <= b.X.max + clearance && b.X.min <= a.X.max + clearance &&
+        a.Y.min <= b.Y.max + clearance && b.Y.min <= a.Y.max + clearance &&
+        a.Z.min <= b.Z.max + clearance && b.Z.min <= a.Z.max + clearance;
+}
+
+/*******************************************************************/
+/* Function definition */
+int BoxOverlapSweep
+(
+int count,                             /* I: number of boxes */
+const svxBndBox *boxes,                /* I: boxes, the id of a box is its index */
+double clearance,                      /* I: largest gap counted as overlap */
+std::vector<BoxOverlapPair> &pairs     /* O: overlapping pairs, sorted */
+)
+/*
+DESCRIPTION:
+   Sweep and prune: sort the boxes by their minimum along the axis where
+the box centers spread most, then test each box only against the boxes
+that start before it ends along that axis. Faster than the tree for a
+single check of a static set of boxes.
+
+   Return the number of pairs.
+*/
+{
+    pairs.clear();
+    if (count < 2)
+        return 0;
+
+    /* axis of largest center variance */
+    double sum[3] = {}, sum2[3] = {};
+    for (int i = 0; i < count; i++)
+    {
+        const double c[3] = { boxes[i].X.min + boxes[i].X.max, boxes[i].Y.min + boxes[i].Y.max,
+            boxes[i].Z.min + boxes[i].Z.max };
+        for (int k = 0; k < 3; k++)
+        {
+            sum[k] += c[k];
+            sum2[k] += c[k] * c[k];
+        }
+    }
+    int axis = 0;
+    double best = -1.0;
+    for (int k = 0; k < 3; k++)
+    {
+        const double variance = sum2[k] - sum[k] * sum[k] / count;
+        if (variance > best)
+        {
+            best = variance;
+            axis = k;
+        }
+    }
+
+    /* (minimum, index) sorted along the axis */
+    std::vector<std::pair<double, int>> order(count);
+    for (int i = 0; i < count; i++)
+        order[i] = std::make_pair((&boxes[i].X)[axis].min, i);
+    std::sort(order.begin(), order.end());
+
+    for (int i = 0; i < count; i++)
+    {
+        const svxBndBox &a = boxes[order[i].second];
+        const double end = (&a.X)[axis].max + clearance;
+        for (int j = i + 1; j < count && order[j].first <= end; j++)
+        {
+            const int other = order[j].second;
+            if (BoxOverlapTest(a, boxes[other], clearance))
+                pairs.push_back({ std::min(order[i].second, other), std::max(order[i].second, other) });
+        }
+    }
+
+    std::sort(pairs.begin(), pairs.end(), PairLess);
+    return (int)pairs.size();
+}
+
+/*******************************************************************/
+/* Function definition */
+svxBndBox BoxUnion
+(
+const svxBndBox &a,   /* I: first box */
+const svxBndBox &b    /* I: second box */
+)
+/*
+DESCRIPTION:
+   Smallest box containing two boxes.
+*/
+{
+    svxBndBox box;
+    box.X.min = std::min(a.X.min, b.X.min);
+    box.X.max = std::max(a.X.max, b.X.max);
+    box.Y.min = std::min(a.Y.min, b.Y.min);
+    box.Y.max = std::max(a.Y.max, b.Y.max);
+    box.Z.min = std::min(a.Z.min, b.Z.min);
+    box.Z.max = std::max(a.Z.max, b.Z.max);
+    return box;
+}
+
+/*******************************************************************/
+/* Function definition */
+svxBndBox BoxGrow
+(
+const svxBndBox &box,   /* I: box */
+double margin           /* I: margin on each side */
+)
+/*
+DESCRIPTION:
+   Box enlarged by a margin.
+*/
+{
+    svxBndBox grown = box;
+    grown.X.min -= margin;
+    grown.X.max += margin;
+    grown.Y.min -= margin;
+    grown.Y.max += margin;
+    grown.Z.min -= margin;
+    grown.Z.max += margin;
+    return grown;
+}
+
+/*******************************************************************/
+/* Function definition */
+double BoxArea
+(
+const svxBndBox &box   /* I: box */
+)
+/*
+DESCRIPTION:
+   Half the surface area of a box.
+*/
+{
+    const double x = box.X.max - box.X.min, y = box.Y.max - box.Y.min, z = box.Z.max - box.Z.min;
+    return x * y + y * z + z * x;
+}
+
+/*******************************************************************/
+/* Function definition */
+int BoxContains
+(
+const svxBndBox &outer,   /* I: outer box */
+const svxBndBox &inner    /* I: inner box */
+)
+/*
+DESCRIPTION:
+   Return 1 if "inner" lies inside "outer", else 0.
+*/
+{
+    return outer.X.min <= inner.X.min && inner.X.max <= outer.X.max &&
+        outer.Y.min <= inner.Y.min && inner.Y.max <= outer.Y.max &&
+        outer.Z.min <= inner.Z.min && inner.Z.max <= outer.Z.max;
+}
+
+/*******************************************************************/
+/* Function definition */
+bool PairLess
+(
+const BoxOverlapPair &p,   /* I: first pair */
+const BoxOverlapPair &q    /* I: second pair */
+)
+/*
+DESCRIPTION:
+   Order of pairs by first, then second id.
+*/
+{
+    return p.a < q.a || (p.a == q.a && p.b < q.b);
+}
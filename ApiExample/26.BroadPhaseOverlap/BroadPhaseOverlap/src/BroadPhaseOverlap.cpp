@@ -0,0 +1,324 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* ZW3D API includes */
+#include "zwapi_component.h"
+#include "zwapi_entity.h"
+#include "zwapi_math_insect.h"
+#include "zwapi_userinput.h"
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <chrono>
+#include <random>
+#include <vector>
+#include "..\inc\BroadPhaseOverlapPr.h"
+#include "..\inc\BoxOverlap.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define MESSAGE_SIZE 256
+#define BENCH_BOXES 10000      /* default number of boxes of ~BroadPhaseOverlapBench */
+#define BENCH_MOVED 10         /* percentage of boxes moved between two checks */
+
+/*******************************************************************/
+/* Function declarations */
+static int BroadPhaseOverlap(void);
+static int BroadPhaseOverlapBench(void);
+static int ComponentPairCheck(const szwEntityHandle &a, const szwEntityHandle &b, double *volume);
+static void RandomBoxes(int count, std::vector<svxBndBox> &boxes);
+static double Seconds(std::chrono::steady_clock::time_point start);
+
+/*******************************************************************/
+/* Function definition */
+int RegisterBroadPhaseOverlap
+(
+void
+)
+/*
+DESCRIPTION:
+   Register the commands of the broad-phase overlap example.
+*/
+{
+    /* Check interference of the candidate pairs of components by entering "~BroadPhaseOverlap" */
+    ZwCommandFunctionLoad("BroadPhaseOverlap", (void *)BroadPhaseOverlap, ZW_LICENSE_CODE_GENERAL);
+
+    /* Time the broad phase against pairwise box tests by entering "~BroadPhaseOverlapBench" */
+    ZwCommandFunctionLoad("BroadPhaseOverlapBench", (void *)BroadPhaseOverlapBench, ZW_LICENSE_CODE_GENERAL);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int UnloadBroadPhaseOverlap
+(
+void
+)
+/*
+DESCRIPTION:
+   Unload the commands of the broad-phase overlap example.
+*/
+{
+    ZwCommandFunctionUnload("BroadPhaseOverlap");
+    ZwCommandFunctionUnload("BroadPhaseOverlapBench");
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+double Seconds
+(
+std::chrono::steady_clock::time_point start   /* I: start time */
+)
+/*
+DESCRIPTION:
+   Seconds elapsed since "start".
+*/
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*******************************************************************/
+/* Function definition */
+int ComponentPairCheck
+(
+const szwEntityHandle &a,   /* I: first component */
+const szwEntityHandle &b,   /* I: second component */
+double *volume              /* O: interference volume */
+)
+/*
+DESCRIPTION:
+   Check the interference of two components, sub-assemblies as a whole.
+
+   Return 1 if they interfere, else 0.
+*/
+{
+    szwInterferenceData components[2] = { { a, 1 }, { b, 1 } };
+    szwComponentInterferenceCheckData data{};
+    data.countComponent = 2;
+    data.componentDataList = components;
+    data.ignoreHidden = 1;
+    data.ignoreSuppress = 1;
+    data.ignoreOpen = 1;
+    data.saveInterferenceGeometry = 0;
+
+    int count = 0;
+    szwComponentInterferenceResultData *results = nullptr;
+    *volume = 0.0;
+    if (ZwComponentInterferenceCheck(data, &count, &results))
+        return 0;
+
+    for (int i = 0; i < count; i++)
+        *volume += results[i].interferenceVolme;
+    ZwComponentInterferenceFree(count, &results);
+    return count > 0 ? 1 : 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void RandomBoxes
+(
+int count,                        /* I: number of boxes */
+std::vector<svxBndBox> &boxes     /* O: boxes */
+)
+/*
+DESCRIPTION:
+   Boxes like the components of a large assembly: sizes from 1 to 40 mm
+(a few up to 400 mm), spread over a cube that keeps a few overlaps per
+box. The seed is fixed so runs can be compared.
+*/
+{
+    std::mt19937 random(6);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    const double side = 25.0 * cbrt((double)count);
+
+    boxes.resize(count);
+    for (int i = 0; i < count; i++)
+    {
+        const double scale = i % 100 == 0 ? 400.0 : 40.0;
+        double low[3], size[3];
+        for (int k = 0; k < 3; k++)
+        {
+            size[k] = 1.0 + (scale - 1.0) * unit(random) * unit(random);
+            low[k] = side * unit(random);
+        }
+        boxes[i].X.min = low[0];
+        boxes[i].X.max = low[0] + size[0];
+        boxes[i].Y.min = low[1];
+        boxes[i].Y.max = low[1] + size[1];
+        boxes[i].Z.min = low[2];
+        boxes[i].Z.max = low[2] + size[2];
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+int BroadPhaseOverlap
+(
+void
+)
+/*
+DESCRIPTION:
+   Get the box of every top level component of the active assembly once,
+find the pairs of overlapping boxes and check only those pairs with
+ZwComponentInterferenceCheck().
+
+   Return 1 if function fails, else 0.
+*/
+{
+    int count = 0;
+    szwEntityHandle *components = nullptr;
+    if (ZwComponentListGet(nullptr, 1, 1, 1, 0, &count, &components) || count < 2)
+    {
+        cvxMsgDisp("The active assembly has less than two components");
+        if (components != nullptr)
+            ZwEntityHandleListFree(count, &components);
+        return 1;
+    }
+
+    double clearance = 0.0;
+    if (cvxGetNumber("Clearance (largest gap between candidate boxes)", &clearance) || clearance < 0.0)
+        clearance = 0.0;
+
+    /* boxes */
+    auto start = std::chrono::steady_clock::now();
+    std::vector<svxBndBox> boxes(count);
+    std::vector<int> index;
+    szwMatrix matrix{};
+    for (int i = 0; i < count; i++)
+    {
+        if (ZwEntityBoundingBoxGet(components[i], ZW_COORDINATE_WORLD, matrix, &boxes[index.size()]) == ZW_API_NO_ERROR)
+            index.push_back(i);
+    }
+    boxes.resize(index.size());
+    const double boxTime = Seconds(start);
+
+    /* broad phase */
+    start = std::chrono::steady_clock::now();
+    std::vector<BoxOverlapPair> pairs;
+    BoxOverlapSweep((int)boxes.size(), boxes.data(), clearance, pairs);
+    const double sweepTime = Seconds(start);
+
+    char message[MESSAGE_SIZE];
+    sprintf_s(message, MESSAGE_SIZE, "%d components, %d boxes in %.1f ms, %d candidate pairs of %.0f in %.2f ms",
+        count, (int)boxes.size(), 1e3 * boxTime, (int)pairs.size(), 0.5 * boxes.size() * (boxes.size() - 1.0),
+        1e3 * sweepTime);
+    cvxMsgDisp(message);
+
+    /* narrow phase */
+    start = std::chrono::steady_clock::now();
+    int interferences = 0;
+    double total = 0.0;
+    for (const BoxOverlapPair &pair : pairs)
+    {
+        double volume = 0.0;
+        if (ComponentPairCheck(components[index[pair.a]], components[index[pair.b]], &volume))
+        {
+            interferences++;
+            total += volume;
+        }
+    }
+    sprintf_s(message, MESSAGE_SIZE, "%d interfering pairs, total volume %.6g, interference checks %.2f s",
+        interferences, total, Seconds(start));
+    cvxMsgDisp(message);
+
+    ZwEntityHandleListFree(count, &components);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int BroadPhaseOverlapBench
+(
+void
+)
+/*
+DESCRIPTION:
+   Find the overlapping pairs of a set of random boxes with pairwise
+cvxIsectBndBoxBndBox() calls, with sweep and prune, and with the dynamic
+tree (build, then again after moving some boxes). Report the times and
+whether the pairs agree.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    double number = BENCH_BOXES;
+    if (cvxGetNumber("Number of boxes", &number) || number < 2.0)
+        number = BENCH_BOXES;
+
+    std::vector<svxBndBox> boxes;
+    RandomBoxes((int)number, boxes);
+    const int count = (int)boxes.size();
+    char message[MESSAGE_SIZE];
+
+    /* pairwise */
+    auto start = std::chrono::steady_clock::now();
+    std::vector<BoxOverlapPair> naive;
+    for (int i = 0; i < count; i++)
+    {
+        for (int j = i + 1; j < count; j++)
+        {
+            if (cvxIsectBndBoxBndBox(&boxes[i], &boxes[j]) == 1)
+                naive.push_back({ i, j });
+        }
+    }
+    sprintf_s(message, MESSAGE_SIZE, "Pairwise cvxIsectBndBoxBndBox(): %d boxes, %d pairs, %.1f ms", count,
+        (int)naive.size(), 1e3 * Seconds(start));
+    cvxMsgDisp(message);
+
+    /* sweep and prune */
+    start = std::chrono::steady_clock::now();
+    std::vector<BoxOverlapPair> pairs;
+    BoxOverlapSweep(count, boxes.data(), 0.0, pairs);
+    const double sweepTime = Seconds(start);
+    std::vector<BoxOverlapPair> reference = pairs;
+    sprintf_s(message, MESSAGE_SIZE, "Sweep and prune: %d pairs, %.2f ms", (int)pairs.size(), 1e3 * sweepTime);
+    cvxMsgDisp(message);
+
+    /* dynamic tree */
+    start = std::chrono::steady_clock::now();
+    BoxOverlapTree tree(1.0);
+    std::vector<int> proxies(count);
+    for (int i = 0; i < count; i++)
+        proxies[i] = tree.Insert(boxes[i], i);
+    const double buildTime = Seconds(start);
+    start = std::chrono::steady_clock::now();
+    tree.Pairs(0.0, pairs);
+    const double pairTime = Seconds(start);
+    int same = pairs.size() == reference.size();
+    for (size_t i = 0; same && i < pairs.size(); i++)
+        same = pairs[i].a == reference[i].a && pairs[i].b == reference[i].b;
+    sprintf_s(message, MESSAGE_SIZE, "Tree: build %.2f ms (height %d), %d pairs %.2f ms, %s sweep and prune",
+        1e3 * buildTime, tree.Height(), (int)pairs.size(), 1e3 * pairTime, same ? "same as" : "DIFFERENT from");
+    cvxMsgDisp(message);
+
+    /* move some boxes by up to 2 mm and check again */
+    std::mt19937 random(26);
+    std::uniform_real_distribution<double> offset(-2.0, 2.0);
+    for (int i = 0; i < count; i += 100 / BENCH_MOVED)
+    {
+        const double dx = offset(random), dy = offset(random), dz = offset(random);
+        boxes[i].X.min += dx;
+        boxes[i].X.max += dx;
+        boxes[i].Y.min += dy;
+        boxes[i].Y.max += dy;
+        boxes[i].Z.min += dz;
+        boxes[i].Z.max += dz;
+    }
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; i += 100 / BENCH_MOVED)
+        tree.Move(proxies[i], boxes[i]);
+    tree.Pairs(0.0, pairs);
+    const double moveTime = Seconds(start);
+    BoxOverlapSweep(count, boxes.data(), 0.0, reference);
+    same = pairs.size() == reference.size();
+    for (size_t i = 0; same && i < pairs.size(); i++)
+        same = pairs[i].a == reference[i].a && pairs[i].b == reference[i].b;
+    sprintf_s(message, MESSAGE_SIZE, "Tree after moving %d%% of the boxes: %d pairs, update and pairs %.2f ms, %s",
+        BENCH_MOVED, (int)pairs.size(), 1e3 * moveTime, same ? "correct" : "WRONG");
+    cvxMsgDisp(message);
+    return 0;
+}
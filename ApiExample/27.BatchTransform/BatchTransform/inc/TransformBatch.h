@@ -0,0 +1,64 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+#pragma once
+
+/* ZW3D API includes */
+#include "zwapi_util.h"
+#include "zwapi_brep_data.h"
+#include "zwapi_matrix_data.h"
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: what a matrix does, the cheaper kernels are used for the first kinds */
+enum TransformKind
+{
+    Transform_Identity = 0,      /* nothing, lists are copied if input and output differ */
+    Transform_Translation = 1,   /* offset only, directions and normals are unchanged */
+    Transform_Rigid = 2,         /* rotation and offset, normals use the rotation */
+    Transform_General = 3,       /* any other affine map, normals use the inverse transpose */
+};
+
+/*
+DESCRIPTION:
+   szwMatrix prepared for the batch kernels. ZW3D matrices map local to
+world, their columns are the axes (X = (xx, yx, zx)) and the offset, so
+x' = xx*x + xy*y + xz*z + xt and so on; the row "ox, oy, oz,
+scale" takes no effect and is ignored like in ZW3D. "normal" is the
+inverse transpose of the linear part (zero offset), the float copies are
+used for facet data (svxPointf).
+*/
+struct TransformMatrix
+{
+    double linear[3][4];     /* rows of the 3x3 part, then the offset */
+    double normal[3][4];     /* inverse transpose of the 3x3 part, zero offset */
+    float linearf[3][4];
+    float normalf[3][4];
+    TransformKind kind;
+    int singular;            /* 1 if normals can not be transformed */
+    int mirror;              /* 1 if the determinant is negative (triangle winding is reversed) */
+};
+
+/*******************************************************************/
+/* Function declarations */
+int TransformMatrixMake(const szwMatrix &matrix, TransformMatrix *prepared);
+void TransformMatrixMultiply(const szwMatrix &a, const szwMatrix &b, szwMatrix *result);
+void TransformMatrixChain(int count, const szwMatrix *chain, szwMatrix *result);
+
+int TransformPoints(const TransformMatrix &matrix, int count, const svxPoint *points, svxPoint *result);
+int TransformVectors(const TransformMatrix &matrix, int count, const svxVector *vectors, svxVector *result);
+int TransformNormals(const TransformMatrix &matrix, int count, const svxVector *normals, int normalize,
+    svxVector *result);
+int TransformAxes(const TransformMatrix &matrix, int count, const svxAxis *axes, svxAxis *result);
+int TransformBoxes(const TransformMatrix &matrix, int count, const svxBndBox *boxes, svxBndBox *result);
+
+int TransformPointsf(const TransformMatrix &matrix, int count, const svxPointf *points, svxPointf *result);
+int TransformNormalsf(const TransformMatrix &matrix, int count, const svxPointf *normals, int normalize,
+    svxPointf *result);
+int TransformFacets(const TransformMatrix &matrix, szwFacets *facets);
+
+int TransformPointsSoA(const TransformMatrix &matrix, int count, const double *x, const double *y,
+    const double *z, double *rx, double *ry, double *rz);
+int TransformPointsSoAf(const TransformMatrix &matrix, int count, const float *x, const float *y,
+    const float *z, float *rx, float *ry, float *rz);
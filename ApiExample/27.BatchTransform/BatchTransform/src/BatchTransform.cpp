@@ -0,0 +1,463 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* ZW3D API includes */
+#include "zwapi_boundingbox.h"
+#include "zwapi_math_matrix.h"
+#include "zwapi_matrix.h"
+#include "zwapi_point.h"
+#include "zwapi_userinput.h"
+#include "zwapi_vector.h"
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <math.h>
+#include <chrono>
+#include <random>
+#include <vector>
+#include "..\inc\BatchTransformPr.h"
+#include "..\inc\TransformBatch.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define MESSAGE_SIZE 256
+#define CHECK_COUNT 1000           /* points, vectors, axes and boxes per matrix */
+#define BENCH_POINTS 4000000       /* default number of points of ~BatchTransformBench */
+#define BENCH_LEVELS 5             /* assembly levels of the chain benchmark */
+#define BENCH_COMPONENT 4096       /* points per component of the chain benchmark */
+
+/*******************************************************************/
+/* Function declarations */
+static int BatchTransformCheck(void);
+static int BatchTransformBench(void);
+static void TestMatrices(std::vector<szwMatrix> &matrices, std::vector<const char *> &names);
+static void MatrixToSvx(const szwMatrix &matrix, svxMatrix *result);
+static double PointDistance(const svxPoint &a, const svxPoint &b);
+static double DirectionAngle(const svxVector &a, const svxVector &b);
+static void BenchReport(const char *name, int count, double seconds);
+static double Seconds(std::chrono::steady_clock::time_point start);
+
+/*******************************************************************/
+/* Function definition */
+int RegisterBatchTransform
+(
+void
+)
+/*
+DESCRIPTION:
+   Register the commands of the batch transform example.
+*/
+{
+    /* Compare the batch transforms with the ZW3D transforms by entering "~BatchTransformCheck" */
+    ZwCommandFunctionLoad("BatchTransformCheck", (void *)BatchTransformCheck, ZW_LICENSE_CODE_GENERAL);
+
+    /* Time the batch transforms against ZwPointListTransform() by entering "~BatchTransformBench" */
+    ZwCommandFunctionLoad("BatchTransformBench", (void *)BatchTransformBench, ZW_LICENSE_CODE_GENERAL);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int UnloadBatchTransform
+(
+void
+)
+/*
+DESCRIPTION:
+   Unload the commands of the batch transform example.
+*/
+{
+    ZwCommandFunctionUnload("BatchTransformCheck");
+    ZwCommandFunctionUnload("BatchTransformBench");
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void TestMatrices
+(
+std::vector<szwMatrix> &matrices,      /* O: matrices of each kind */
+std::vector<const char *> &names       /* O: their names */
+)
+/*
+DESCRIPTION:
+   Matrices of every kind made with the ZW3D matrix functions: identity,
+translation, rotation, rotation and translation, non-uniform scale,
+mirror, and a chain of all of them.
+*/
+{
+    szwMatrix matrix{};
+    ZwMatrixInit(&matrix);
+    matrices.push_back(matrix);
+    names.push_back("identity");
+
+    ZwMatrixInitByTranslation(120.0, -35.5, 8.25, &matrix);
+    matrices.push_back(matrix);
+    names.push_back("translation");
+
+    szwAxis axis{};
+    axis.point.x = 10.0;
+    axis.point.y = 20.0;
+    axis.point.z = -5.0;
+    axis.direction.x = 1.0;
+    axis.direction.y = 2.0;
+    axis.direction.z = 2.0;
+    ZwMatrixInitByRotation(37.0, axis, &matrix);
+    matrices.push_back(matrix);
+    names.push_back("rotation");
+
+    szwMatrix move{};
+    ZwMatrixInitByTranslation(-400.0, 250.0, 1000.0, &move);
+    TransformMatrixMultiply(move, matrix, &matrix);
+    matrices.push_back(matrix);
+    names.push_back("rotation + translation");
+
+    szwPoint origin{};
+    origin.x = 5.0;
+    ZwMatrixInitByPoint(origin, 2.0, 0.5, 3.0, &matrix);
+    matrices.push_back(matrix);
+    names.push_back("non-uniform scale");
+
+    szwVector normal{};
+    normal.x = 0.6;
+    normal.z = 0.8;
+    ZwMatrixReflectionMatrixCreate(origin, normal, &matrix);
+    matrices.push_back(matrix);
+    names.push_back("mirror");
+
+    const std::vector<szwMatrix> chain(matrices.begin() + 1, matrices.end());
+    TransformMatrixChain((int)chain.size(), chain.data(), &matrix);
+    matrices.push_back(matrix);
+    names.push_back("chain of the above");
+}
+
+/*******************************************************************/
+/* Function definition */
+void MatrixToSvx
+(
+const szwMatrix &matrix,   /* I: matrix */
+svxMatrix *result          /* O: same matrix for the cvx functions */
+)
+/*
+DESCRIPTION:
+   Copy a szwMatrix to a svxMatrix.
+*/
+{
+    result->identity = matrix.identity;
+    result->xx = matrix.xx; result->yx = matrix.yx; result->zx = matrix.zx; result->xt = matrix.xt;
+    result->xy = matrix.xy; result->yy = matrix.yy; result->zy = matrix.zy; result->yt = matrix.yt;
+    result->xz = matrix.xz; result->yz = matrix.yz; result->zz = matrix.zz; result->zt = matrix.zt;
+}
+
+/*******************************************************************/
+/* Function definition */
+double PointDistance
+(
+const svxPoint &a,   /* I: first point */
+const svxPoint &b    /* I: second point */
+)
+/*
+DESCRIPTION:
+   Distance between two points.
+*/
+{
+    return sqrt((a.x - b.x) * (a.x - b.x) + (a.y - b.y) * (a.y - b.y) + (a.z - b.z) * (a.z - b.z));
+}
+
+/*******************************************************************/
+/* Function definition */
+double DirectionAngle
+(
+const svxVector &a,   /* I: first vector */
+const svxVector &b    /* I: second vector */
+)
+/*
+DESCRIPTION:
+   Angle between two vectors in radians (0 if either is zero).
+*/
+{
+    const double cx = a.y * b.z - a.z * b.y, cy = a.z * b.x - a.x * b.z, cz = a.x * b.y - a.y * b.x;
+    const double dot = a.x * b.x + a.y * b.y + a.z * b.z;
+    return atan2(sqrt(cx * cx + cy * cy + cz * cz), dot);
+}
+
+/*******************************************************************/
+/* Function definition */
+double Seconds
+(
+std::chrono::steady_clock::time_point start   /* I: start time */
+)
+/*
+DESCRIPTION:
+   Seconds elapsed since "start".
+*/
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*******************************************************************/
+/* Function definition */
+void BenchReport
+(
+const char *name,     /* I: kernel */
+int count,            /* I: number of points */
+double seconds        /* I: time */
+)
+/*
+DESCRIPTION:
+   Display the throughput of one kernel.
+*/
+{
+    char message[MESSAGE_SIZE];
+    sprintf_s(message, MESSAGE_SIZE, "%-40s %8.2f ms %8.1f M points/s", name, 1e3 * seconds,
+        seconds > 0.0 ? count / seconds * 1e-6 : 0.0);
+    cvxMsgDisp(message);
+}
+
+/*******************************************************************/
+/* Function definition */
+int BatchTransformCheck
+(
+void
+)
+/*
+DESCRIPTION:
+   For matrices of every kind, transform random points, directions, axes
+and boxes with the batch kernels and with ZwPointListTransform(),
+ZwVectorTransform(), ZwAxisTransform() and ZwBoundingBoxTransform(), and
+report the largest differences. Normals are checked by staying
+perpendicular to transformed tangents.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    std::vector<szwMatrix> matrices;
+    std::vector<const char *> names;
+    TestMatrices(matrices, names);
+
+    std::mt19937 random(7);
+    std::uniform_real_distribution<double> coordinate(-500.0, 500.0);
+    std::vector<svxPoint> points(CHECK_COUNT);
+    std::vector<svxVector> tangents(CHECK_COUNT), normals(CHECK_COUNT);
+    std::vector<svxAxis> axes(CHECK_COUNT);
+    std::vector<svxBndBox> boxes(CHECK_COUNT);
+    std::vector<svxPointf> pointsf(CHECK_COUNT);
+    for (int i = 0; i < CHECK_COUNT; i++)
+    {
+        points[i] = { coordinate(random), coordinate(random), coordinate(random) };
+        tangents[i] = { coordinate(random), coordinate(random), coordinate(random) };
+        const svxVector other = { coordinate(random), coordinate(random), coordinate(random) };
+        normals[i] = { tangents[i].y * other.z - tangents[i].z * other.y, tangents[i].z * other.x - tangents[i].x * other.z,
+            tangents[i].x * other.y - tangents[i].y * other.x };
+        axes[i].Pnt = points[i];
+        axes[i].Dir = tangents[i];
+        const double size = fabs(coordinate(random)) * 0.1;
+        boxes[i].X.min = points[i].x - size; boxes[i].X.max = points[i].x + 2.0 * size;
+        boxes[i].Y.min = points[i].y - 0.5 * size; boxes[i].Y.max = points[i].y + size;
+        boxes[i].Z.min = points[i].z; boxes[i].Z.max = points[i].z + 3.0 * size;
+        pointsf[i] = { (float)points[i].x, (float)points[i].y, (float)points[i].z };
+    }
+
+    char message[MESSAGE_SIZE];
+    for (size_t m = 0; m < matrices.size(); m++)
+    {
+        TransformMatrix matrix;
+        TransformMatrixMake(matrices[m], &matrix);
+
+        /* points, in double and float */
+        std::vector<svxPoint> batch(CHECK_COUNT), host = points;
+        std::vector<svxPointf> batchf(CHECK_COUNT);
+        TransformPoints(matrix, CHECK_COUNT, points.data(), batch.data());
+        TransformPointsf(matrix, CHECK_COUNT, pointsf.data(), batchf.data());
+        ZwPointListTransform(matrices[m], CHECK_COUNT, host.data());
+        double pointError = 0.0, floatError = 0.0;
+        for (int i = 0; i < CHECK_COUNT; i++)
+        {
+            const svxPoint p = { batchf[i].x, batchf[i].y, batchf[i].z };
+            pointError = fmax(pointError, PointDistance(batch[i], host[i]));
+            floatError = fmax(floatError, PointDistance(p, host[i]));
+        }
+
+        /* directions and axes */
+        std::vector<svxVector> vectors(CHECK_COUNT);
+        std::vector<svxAxis> axesOut(CHECK_COUNT);
+        TransformVectors(matrix, CHECK_COUNT, tangents.data(), vectors.data());
+        TransformAxes(matrix, CHECK_COUNT, axes.data(), axesOut.data());
+        double vectorAngle = 0.0, axisError = 0.0;
+        for (int i = 0; i < CHECK_COUNT; i++)
+        {
+            svxVector v = tangents[i];
+            ZwVectorTransform(matrices[m], &v);
+            vectorAngle = fmax(vectorAngle, DirectionAngle(vectors[i], v));
+
+            szwAxis a{};
+            a.point = axes[i].Pnt;
+            a.direction = axes[i].Dir;
+            ZwAxisTransform(matrices[m], &a);
+            axisError = fmax(axisError, PointDistance(axesOut[i].Pnt, a.point));
+            axisError = fmax(axisError, DirectionAngle(axesOut[i].Dir, a.direction));
+        }
+
+        /* normals stay perpendicular to the transformed tangents */
+        std::vector<svxVector> normalsOut(CHECK_COUNT);
+        TransformNormals(matrix, CHECK_COUNT, normals.data(), 1, normalsOut.data());
+        double normalError = 0.0;
+        for (int i = 0; i < CHECK_COUNT; i++)
+            normalError = fmax(normalError, fabs(DirectionAngle(normalsOut[i], vectors[i]) - 2.0 * atan(1.0)));
+
+        /* boxes */
+        std::vector<svxBndBox> boxesOut(CHECK_COUNT);
+        TransformBoxes(matrix, CHECK_COUNT, boxes.data(), boxesOut.data());
+        double boxError = 0.0;
+        for (int i = 0; i < CHECK_COUNT; i++)
+        {
+            szwBoundingBox b = boxes[i];
+            ZwBoundingBoxTransform(matrices[m], &b);
+            const double *p = &boxesOut[i].X.min, *q = &b.X.min;
+            for (int k = 0; k < 6; k++)
+                boxError = fmax(boxError, fabs(p[k] - q[k]));
+        }
+
+        sprintf_s(message, MESSAGE_SIZE, "%s (kind %d%s): point %.2g, float point %.2g, direction %.2g rad, "
+            "axis %.2g, normal %.2g rad, box %.2g", names[m], (int)matrix.kind, matrix.mirror ? ", mirror" : "",
+            pointError, floatError, vectorAngle, axisError, normalError, boxError);
+        cvxMsgDisp(message);
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int BatchTransformBench
+(
+void
+)
+/*
+DESCRIPTION:
+   Time ZwPointListTransform(), cvxPntTransformList(), a plain loop and
+the batch kernels on the same points, then the flattening of a deep
+assembly: every component transformed level by level, or once with the
+composed chain.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    double number = BENCH_POINTS;
+    if (cvxGetNumber("Number of points", &number) || number < BENCH_COMPONENT)
+        number = BENCH_POINTS;
+    const int count = (int)number;
+
+    std::vector<szwMatrix> matrices;
+    std::vector<const char *> names;
+    TestMatrices(matrices, names);
+    const szwMatrix &rigid = matrices[3];
+    TransformMatrix matrix, scale;
+    TransformMatrixMake(rigid, &matrix);
+    TransformMatrixMake(matrices[4], &scale);
+
+    std::mt19937 random(7);
+    std::uniform_real_distribution<double> coordinate(-500.0, 500.0);
+    std::vector<svxPoint> source(count), points(count);
+    std::vector<svxPointf> sourcef(count), pointsf(count);
+    std::vector<double> x(count), y(count), z(count);
+    std::vector<float> xf(count), yf(count), zf(count);
+    for (int i = 0; i < count; i++)
+    {
+        source[i] = { coordinate(random), coordinate(random), coordinate(random) };
+        sourcef[i] = { (float)source[i].x, (float)source[i].y, (float)source[i].z };
+        x[i] = source[i].x;
+        y[i] = source[i].y;
+        z[i] = source[i].z;
+        xf[i] = sourcef[i].x;
+        yf[i] = sourcef[i].y;
+        zf[i] = sourcef[i].z;
+    }
+
+    /* host functions and a plain loop */
+    points = source;
+    auto start = std::chrono::steady_clock::now();
+    ZwPointListTransform(rigid, count, points.data());
+    BenchReport("ZwPointListTransform()", count, Seconds(start));
+
+    svxMatrix svx;
+    MatrixToSvx(rigid, &svx);
+    points = source;
+    start = std::chrono::steady_clock::now();
+    cvxPntTransformList(&svx, count, points.data());
+    BenchReport("cvxPntTransformList()", count, Seconds(start));
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; i++)
+    {
+        const svxPoint &p = source[i];
+        points[i].x = rigid.xx * p.x + rigid.xy * p.y + rigid.xz * p.z + rigid.xt;
+        points[i].y = rigid.yx * p.x + rigid.yy * p.y + rigid.yz * p.z + rigid.yt;
+        points[i].z = rigid.zx * p.x + rigid.zy * p.y + rigid.zz * p.z + rigid.zt;
+    }
+    BenchReport("Plain loop, svxPoint", count, Seconds(start));
+
+    /* batch kernels */
+    start = std::chrono::steady_clock::now();
+    TransformPoints(matrix, count, source.data(), points.data());
+    BenchReport("TransformPoints(), svxPoint", count, Seconds(start));
+
+    start = std::chrono::steady_clock::now();
+    TransformPointsf(matrix, count, sourcef.data(), pointsf.data());
+    BenchReport("TransformPointsf(), svxPointf", count, Seconds(start));
+
+    start = std::chrono::steady_clock::now();
+    TransformNormalsf(scale, count, sourcef.data(), 1, pointsf.data());
+    BenchReport("TransformNormalsf(), scale + normalize", count, Seconds(start));
+
+    start = std::chrono::steady_clock::now();
+    TransformPointsSoA(matrix, count, x.data(), y.data(), z.data(), x.data(), y.data(), z.data());
+    BenchReport("TransformPointsSoA(), double", count, Seconds(start));
+
+    start = std::chrono::steady_clock::now();
+    TransformPointsSoAf(matrix, count, xf.data(), yf.data(), zf.data(), xf.data(), yf.data(), zf.data());
+    BenchReport("TransformPointsSoAf(), float", count, Seconds(start));
+
+    /* assembly flattening: components BENCH_LEVELS deep, level by level or with the composed chain */
+    std::vector<szwMatrix> chain(BENCH_LEVELS);
+    for (int level = 0; level < BENCH_LEVELS; level++)
+        chain[level] = matrices[1 + level % 4];
+
+    pointsf = sourcef;
+    start = std::chrono::steady_clock::now();
+    for (int first = 0; first + BENCH_COMPONENT <= count; first += BENCH_COMPONENT)
+    {
+        for (int level = BENCH_LEVELS - 1; level >= 0; level--)
+        {
+            TransformMatrix levelMatrix;
+            TransformMatrixMake(chain[level], &levelMatrix);
+            TransformPointsf(levelMatrix, BENCH_COMPONENT, &pointsf[first], &pointsf[first]);
+        }
+    }
+    BenchReport("Flattening, level by level", count, Seconds(start));
+
+    std::vector<svxPointf> composed = sourcef;
+    start = std::chrono::steady_clock::now();
+    for (int first = 0; first + BENCH_COMPONENT <= count; first += BENCH_COMPONENT)
+    {
+        szwMatrix world;
+        TransformMatrix worldMatrix;
+        TransformMatrixChain(BENCH_LEVELS, chain.data(), &world);
+        TransformMatrixMake(world, &worldMatrix);
+        TransformPointsf(worldMatrix, BENCH_COMPONENT, &composed[first], &composed[first]);
+    }
+    BenchReport("Flattening, composed chain", count, Seconds(start));
+
+    double difference = 0.0;
+    for (int i = 0; i < count; i++)
+    {
+        const svxPoint a = { pointsf[i].x, pointsf[i].y, pointsf[i].z }, b = { composed[i].x, composed[i].y, composed[i].z };
+        difference = fmax(difference, PointDistance(a, b));
+    }
+    char message[MESSAGE_SIZE];
+    sprintf_s(message, MESSAGE_SIZE, "Largest difference between level by level and composed: %.3g", difference);
+    cvxMsgDisp(message);
+    return 0;
+}
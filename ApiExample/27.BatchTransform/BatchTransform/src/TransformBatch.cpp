@@ -0,0 +1,1026 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* ZW3D API includes */
+#include "zwapi_memory.h"
+
+/*******************************************************************/
+/* Application includes */
+#include <limits.h>
+#include <math.h>
+#include <float.h>
+#include <string.h>
+#include <vector>
+#include "TransformBatch.h"
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define TRANSFORM_SSE 1
+#include <emmintrin.h>
+#elif defined(_M_ARM64) || defined(__aarch64__)
+#define TRANSFORM_NEON 1
+#include <arm_neon.h>
+#endif
+
+/*******************************************************************/
+/* Constant definitions */
+#define RIGID_TOLERANCE 1.0e-12     /* orthonormality of a rigid rotation */
+
+/*******************************************************************/
+/* Data type definitions */
+/*
+DESCRIPTION:
+   Four floats (F4) and two doubles (D2) with the operations the kernels
+need. Load3()/Store3() move 4 (or 2) xyz triples between AoS memory and
+one register per coordinate.
+*/
+#if defined(TRANSFORM_SSE)
+typedef __m128 F4;
+typedef __m128d D2;
+static inline F4 F4Set(float a) { return _mm_set1_ps(a); }
+static inline F4 F4Add(F4 a, F4 b) { return _mm_add_ps(a, b); }
+static inline F4 F4Mul(F4 a, F4 b) { return _mm_mul_ps(a, b); }
+static inline void F4Unit(F4 *a, F4 *b, F4 *c)
+{
+    const F4 inverse = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(_mm_max_ps(_mm_add_ps(_mm_add_ps(
+        _mm_mul_ps(*a, *a), _mm_mul_ps(*b, *b)), _mm_mul_ps(*c, *c)), _mm_set1_ps(FLT_MIN))));
+    *a = _mm_mul_ps(*a, inverse);
+    *b = _mm_mul_ps(*b, inverse);
+    *c = _mm_mul_ps(*c, inverse);
+}
+static inline F4 F4Load(const float *p) { return _mm_loadu_ps(p); }
+static inline void F4Store(float *p, F4 a) { _mm_storeu_ps(p, a); }
+static inline void F4Load3(const float *p, F4 *x, F4 *y, F4 *z)
+{
+    const F4 a = _mm_loadu_ps(p), b = _mm_loadu_ps(p + 4), c = _mm_loadu_ps(p + 8);
+    const F4 bc = _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 0, 3, 2));
+    *x = _mm_shuffle_ps(a, bc, _MM_SHUFFLE(3, 0, 3, 0));
+    *y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)),
+        _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+    *z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)),
+        _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+}
+static inline void F4Store3(float *p, F4 x, F4 y, F4 z)
+{
+    const F4 a = _mm_shuffle_ps(_mm_unpacklo_ps(x, y), _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)),
+        _MM_SHUFFLE(2, 0, 1, 0));
+    const F4 b = _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm_unpackhi_ps(x, y),
+        _MM_SHUFFLE(1, 0, 2, 0));
+    const F4 c = _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)),
+        _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+    _mm_storeu_ps(p, a);
+    _mm_storeu_ps(p + 4, b);
+    _mm_storeu_ps(p + 8, c);
+}
+static inline D2 D2Set(double a) { return _mm_set1_pd(a); }
+static inline D2 D2Add(D2 a, D2 b) { return _mm_add_pd(a, b); }
+static inline D2 D2Mul(D2 a, D2 b) { return _mm_mul_pd(a, b); }
+static inline void D2Unit(D2 *a, D2 *b, D2 *c)
+{
+    const D2 len = _mm_sqrt_pd(_mm_max_pd(_mm_add_pd(_mm_add_pd(_mm_mul_pd(*a, *a), _mm_mul_pd(*b, *b)),
+        _mm_mul_pd(*c, *c)), _mm_set1_pd(DBL_MIN)));
+    *a = _mm_div_pd(*a, len);
+    *b = _mm_div_pd(*b, len);
+    *c = _mm_div_pd(*c, len);
+}
+static inline D2 D2Load(const double *p) { return _mm_loadu_pd(p); }
+static inline void D2Store(double *p, D2 a) { _mm_storeu_pd(p, a); }
+static inline void D2Load3(const double *p, D2 *x, D2 *y, D2 *z)
+{
+    const D2 a = _mm_loadu_pd(p), b = _mm_loadu_pd(p + 2), c = _mm_loadu_pd(p + 4);
+    *x = _mm_shuffle_pd(a, b, _MM_SHUFFLE2(1, 0));
+    *y = _mm_shuffle_pd(a, c, _MM_SHUFFLE2(0, 1));
+    *z = _mm_shuffle_pd(b, c, _MM_SHUFFLE2(1, 0));
+}
+static inline void D2Store3(double *p, D2 x, D2 y, D2 z)
+{
+    _mm_storeu_pd(p, _mm_unpacklo_pd(x, y));
+    _mm_storeu_pd(p + 2, _mm_shuffle_pd(z, x, _MM_SHUFFLE2(1, 0)));
+    _mm_storeu_pd(p + 4, _mm_unpackhi_pd(y, z));
+}
+#elif defined(TRANSFORM_NEON)
+typedef float32x4_t F4;
+typedef float64x2_t D2;
+static inline F4 F4Set(float a) { return vdupq_n_f32(a); }
+static inline F4 F4Add(F4 a, F4 b) { return vaddq_f32(a, b); }
+static inline F4 F4Mul(F4 a, F4 b) { return vmulq_f32(a, b); }
+static inline void F4Unit(F4 *a, F4 *b, F4 *c)
+{
+    const F4 inverse = vdivq_f32(vdupq_n_f32(1.0f), vsqrtq_f32(vmaxq_f32(vaddq_f32(vaddq_f32(
+        vmulq_f32(*a, *a), vmulq_f32(*b, *b)), vmulq_f32(*c, *c)), vdupq_n_f32(FLT_MIN))));
+    *a = vmulq_f32(*a, inverse);
+    *b = vmulq_f32(*b, inverse);
+    *c = vmulq_f32(*c, inverse);
+}
+static inline F4 F4Load(const float *p) { return vld1q_f32(p); }
+static inline void F4Store(float *p, F4 a) { vst1q_f32(p, a); }
+static inline void F4Load3(const float *p, F4 *x, F4 *y, F4 *z)
+{
+    const float32x4x3_t v = vld3q_f32(p);
+    *x = v.val[0];
+    *y = v.val[1];
+    *z = v.val[2];
+}
+static inline void F4Store3(float *p, F4 x, F4 y, F4 z)
+{
+    float32x4x3_t v;
+    v.val[0] = x;
+    v.val[1] = y;
+    v.val[2] = z;
+    vst3q_f32(p, v);
+}
+static inline D2 D2Set(double a) { return vdupq_n_f64(a); }
+static inline D2 D2Add(D2 a, D2 b) { return vaddq_f64(a, b); }
+static inline D2 D2Mul(D2 a, D2 b) { return vmulq_f64(a, b); }
+static inline void D2Unit(D2 *a, D2 *b, D2 *c)
+{
+    const D2 len = vsqrtq_f64(vmaxq_f64(vaddq_f64(vaddq_f64(vmulq_f64(*a, *a), vmulq_f64(*b, *b)),
+        vmulq_f64(*c, *c)), vdupq_n_f64(DBL_MIN)));
+    *a = vdivq_f64(*a, len);
+    *b = vdivq_f64(*b, len);
+    *c = vdivq_f64(*c, len);
+}
+static inline D2 D2Load(const double *p) { return vld1q_f64(p); }
+static inline void D2Store(double *p, D2 a) { vst1q_f64(p, a); }
+static inline void D2Load3(const double *p, D2 *x, D2 *y, D2 *z)
+{
+    const float64x2x3_t v = vld3q_f64(p);
+    *x = v.val[0];
+    *y = v.val[1];
+    *z = v.val[2];
+}
+static inline void D2Store3(double *p, D2 x, D2 y, D2 z)
+{
+    float64x2x3_t v;
+    v.val[0] = x;
+    v.val[1] = y;
+    v.val[2] = z;
+    vst3q_f64(p, v);
+}
+#else
+struct F4 { float v[4]; };
+struct D2 { double v[2]; };
+static inline F4 F4Set(float a) { F4 r = { { a, a, a, a } }; return r; }
+static inline F4 F4Add(F4 a, F4 b) { for (int i = 0; i < 4; i++) a.v[i] += b.v[i]; return a; }
+static inline F4 F4Mul(F4 a, F4 b) { for (int i = 0; i < 4; i++) a.v[i] *= b.v[i]; return a; }
+static inline void F4Unit(F4 *a, F4 *b, F4 *c)
+{
+    for (int i = 0; i < 4; i++)
+    {
+        const float l2 = a->v[i] * a->v[i] + b->v[i] * b->v[i] + c->v[i] * c->v[i];
+        const float inverse = 1.0f / sqrtf(l2 > FLT_MIN ? l2 : FLT_MIN);
+        a->v[i] *= inverse;
+        b->v[i] *= inverse;
+        c->v[i] *= inverse;
+    }
+}
+static inline F4 F4Load(const float *p) { F4 r; memcpy(r.v, p, sizeof(r.v)); return r; }
+static inline void F4Store(float *p, F4 a) { memcpy(p, a.v, sizeof(a.v)); }
+static inline void F4Load3(const float *p, F4 *x, F4 *y, F4 *z)
+{
+    for (int i = 0; i < 4; i++)
+    {
+        x->v[i] = p[3 * i];
+        y->v[i] = p[3 * i + 1];
+        z->v[i] = p[3 * i + 2];
+    }
+}
+static inline void F4Store3(float *p, F4 x, F4 y, F4 z)
+{
+    for (int i = 0; i < 4; i++)
+    {
+        p[3 * i] = x.v[i];
+        p[3 * i + 1] = y.v[i];
+        p[3 * i + 2] = z.v[i];
+    }
+}
+static inline D2 D2Set(double a) { D2 r = { { a, a } }; return r; }
+static inline D2 D2Add(D2 a, D2 b) { for (int i = 0; i < 2; i++) a.v[i] += b.v[i]; return a; }
+static inline D2 D2Mul(D2 a, D2 b) { for (int i = 0; i < 2; i++) a.v[i] *= b.v[i]; return a; }
+static inline void D2Unit(D2 *a, D2 *b, D2 *c)
+{
+    for (int i = 0; i < 2; i++)
+    {
+        const double l2 = a->v[i] * a->v[i] + b->v[i] * b->v[i] + c->v[i] * c->v[i];
+        const double len = sqrt(l2 > DBL_MIN ? l2 : DBL_MIN);
+        a->v[i] /= len;
+        b->v[i] /= len;
+        c->v[i] /= len;
+    }
+}
+static inline D2 D2Load(const double *p) { D2 r = { { p[0], p[1] } }; return r; }
+static inline void D2Store(double *p, D2 a) { p[0] = a.v[0]; p[1] = a.v[1]; }
+static inline void D2Load3(const double *p, D2 *x, D2 *y, D2 *z)
+{
+    for (int i = 0; i < 2; i++)
+    {
+        x->v[i] = p[3 * i];
+        y->v[i] = p[3 * i + 1];
+        z->v[i] = p[3 * i + 2];
+    }
+}
+static inline void D2Store3(double *p, D2 x, D2 y, D2 z)
+{
+    for (int i = 0; i < 2; i++)
+    {
+        p[3 * i] = x.v[i];
+        p[3 * i + 1] = y.v[i];
+        p[3 * i + 2] = z.v[i];
+    }
+}
+#endif
+
+/*******************************************************************/
+/* Function declarations */
+static void KernelAos(const double rows[3][4], int translate, int normalize, int count, const double *in,
+    double *out);
+static void KernelAosf(const float rows[3][4], int translate, int normalize, int count, const float *in,
+    float *out);
+static void OffsetAos(const double rows[3][4], int count, const double *in, double *out);
+static void OffsetAosf(const float rows[3][4], int count, const float *in, float *out);
+static void MatrixRows(const szwMatrix &matrix, double rows[3][4]);
+static int StripsReverse(int count, const int *strips, int *size, std::vector<int> &reversed);
+
+/*******************************************************************/
+/* Function definition */
+int TransformMatrixMake
+(
+const szwMatrix &matrix,      /* I: ZW3D matrix */
+TransformMatrix *prepared     /* O: matrix for the kernels */
+)
+/*
+DESCRIPTION:
+   Classify a matrix and compute the inverse transpose for normals. The
+identity flag of the matrix is trusted (see ZwMatrixIdentityFlagRefresh()).
+
+   Return 1 if the 3x3 part is singular (normals can not be transformed),
+else 0.
+*/
+{
+    TransformMatrix &p = *prepared;
+    memset(&p, 0, sizeof(p));
+
+    if (matrix.identity)
+    {
+        for (int i = 0; i < 3; i++)
+            p.linear[i][i] = p.normal[i][i] = 1.0;
+    }
+    else
+        MatrixRows(matrix, p.linear);
+
+    const double (*m)[4] = p.linear;
+    const double cof[3][3] =
+    {
+        { m[1][1] * m[2][2] - m[1][2] * m[2][1], m[1][2] * m[2][0] - m[1][0] * m[2][2], m[1][0] * m[2][1] - m[1][1] * m[2][0] },
+        { m[0][2] * m[2][1] - m[0][1] * m[2][2], m[0][0] * m[2][2] - m[0][2] * m[2][0], m[0][1] * m[2][0] - m[0][0] * m[2][1] },
+        { m[0][1] * m[1][2] - m[0][2] * m[1][1], m[0][2] * m[1][0] - m[0][0] * m[1][2], m[0][0] * m[1][1] - m[0][1] * m[1][0] },
+    };
+    const double det = m[0][0] * cof[0][0] + m[0][1] * cof[0][1] + m[0][2] * cof[0][2];
+    p.singular = fabs(det) < DBL_MIN;
+    p.mirror = det < 0.0;
+
+    /* kind: the 3x3 part is the identity, or orthonormal with positive determinant */
+    int unit = 1, orthonormal = det > 0.0;
+    for (int i = 0; i < 3; i++)
+    {
+        for (int j = 0; j < 3; j++)
+        {
+            double dot = 0.0;
+            for (int k = 0; k < 3; k++)
+                dot += m[k][i] * m[k][j];
+            orthonormal &= fabs(dot - (i == j ? 1.0 : 0.0)) <= RIGID_TOLERANCE;
+            unit &= m[i][j] == (i == j ? 1.0 : 0.0);
+        }
+    }
+    if (matrix.identity || (unit && m[0][3] == 0.0 && m[1][3] == 0.0 && m[2][3] == 0.0))
+        p.kind = Transform_Identity;
+    else if (unit)
+        p.kind = Transform_Translation;
+    else if (orthonormal)
+        p.kind = Transform_Rigid;
+    else
+        p.kind = Transform_General;
+
+    for (int i = 0; i < 3; i++)
+    {
+        for (int j = 0; j < 3; j++)
+        {
+            if (p.kind != Transform_General)
+                p.normal[i][j] = m[i][j];
+            else if (!p.singular)
+                p.normal[i][j] = cof[i][j] / det;
+        }
+        for (int j = 0; j < 4; j++)
+        {
+            p.linearf[i][j] = (float)p.linear[i][j];
+            p.normalf[i][j] = (float)p.normal[i][j];
+        }
+    }
+    return p.singular;
+}
+
+/*******************************************************************/
+/* Function definition */
+void TransformMatrixMultiply
+(
+const szwMatrix &a,    /* I: outer matrix */
+const szwMatrix &b,    /* I: inner matrix, applied first */
+szwMatrix *result      /* O: a * b, may be "a" or "b" */
+)
+/*
+DESCRIPTION:
+   Compose two matrices: result(p) = a(b(p)). Identity matrices are
+skipped.
+*/
+{
+    if (a.identity || b.identity)
+    {
+        *result = a.identity ? b : a;
+        return;
+    }
+
+    double ra[3][4], rb[3][4], r[3][4];
+    MatrixRows(a, ra);
+    MatrixRows(b, rb);
+    for (int i = 0; i < 3; i++)
+    {
+        for (int j = 0; j < 4; j++)
+        {
+            r[i][j] = ra[i][0] * rb[0][j] + ra[i][1] * rb[1][j] + ra[i][2] * rb[2][j];
+            if (j == 3)
+                r[i][j] += ra[i][3];
+        }
+    }
+
+    szwMatrix &c = *result;
+    c.identity = 0;
+    c.xx = r[0][0]; c.xy = r[0][1]; c.xz = r[0][2]; c.xt = r[0][3];
+    c.yx = r[1][0]; c.yy = r[1][1]; c.yz = r[1][2]; c.yt = r[1][3];
+    c.zx = r[2][0]; c.zy = r[2][1]; c.zz = r[2][2]; c.zt = r[2][3];
+    c.ox = c.oy = c.oz = 0.0;
+    c.scale = 1.0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void TransformMatrixChain
+(
+int count,                  /* I: number of matrices */
+const szwMatrix *chain,     /* I: matrices, outermost first (top assembly ... component) */
+szwMatrix *result           /* O: chain[0] * chain[1] * ... */
+)
+/*
+DESCRIPTION:
+   Compose the matrices of a component path into one matrix, so the
+points of the component are transformed once instead of once per level.
+*/
+{
+    szwMatrix c{};
+    c.identity = 1;
+    c.xx = c.yy = c.zz = c.scale = 1.0;
+    for (int i = count - 1; i >= 0; i--)
+        TransformMatrixMultiply(chain[i], c, &c);
+    *result = c;
+}
+
+/*******************************************************************/
+/* Function definition */
+int TransformPoints
+(
+const TransformMatrix &matrix,   /* I: matrix */
+int count,                       /* I: number of points */
+const svxPoint *points,          /* I: points */
+svxPoint *result                 /* O: transformed points, may be "points" */
+)
+/*
+DESCRIPTION:
+   Transform a list of points.
+
+   Return 1 if the input is invalid, else 0.
+*/
+{
+    if (count < 0 || (count > 0 && (points == nullptr || result == nullptr)))
+        return 1;
+
+    if (matrix.kind == Transform_Identity)
+    {
+        if (result != points)
+            memmove(result, points, (size_t)count * sizeof(svxPoint));
+    }
+    else if (matrix.kind == Transform_Translation)
+        OffsetAos(matrix.linear, count, &points->x, &result->x);
+    else
+        KernelAos(matrix.linear, 1, 0, count, &points->x, &result->x);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int TransformVectors
+(
+const TransformMatrix &matrix,   /* I: matrix */
+int count,                       /* I: number of vectors */
+const svxVector *vectors,        /* I: directions or offsets */
+svxVector *result                /* O: transformed vectors, may be "vectors" */
+)
+/*
+DESCRIPTION:
+   Transform a list of directions (the offset of the matrix is ignored).
+
+   Return 1 if the input is invalid, else 0.
+*/
+{
+    if (count < 0 || (count > 0 && (vectors == nullptr || result == nullptr)))
+        return 1;
+
+    if (matrix.kind <= Transform_Translation)
+    {
+        if (result != vectors)
+            memmove(result, vectors, (size_t)count * sizeof(svxVector));
+    }
+    else
+        KernelAos(matrix.linear, 0, 0, count, &vectors->x, &result->x);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int TransformNormals
+(
+const TransformMatrix &matrix,   /* I: matrix */
+int count,                       /* I: number of normals */
+const svxVector *normals,        /* I: normals */
+int normalize,                   /* I: 1 to rescale to unit length after a scaling matrix */
+svxVector *result                /* O: transformed normals, may be "normals" */
+)
+/*
+DESCRIPTION:
+   Transform a list of surface normals with the inverse transpose, so they
+stay perpendicular to transformed surfaces under non-uniform scaling.
+Identity, translation and rigid matrices keep the length, so "normalize"
+only applies to general matrices.
+
+   Return 1 if the input is invalid or the matrix is singular, else 0.
+*/
+{
+    if (count < 0 || (count > 0 && (normals == nullptr || result == nullptr)) || matrix.singular)
+        return 1;
+
+    if (matrix.kind <= Transform_Translation)
+    {
+        if (result != normals)
+            memmove(result, normals, (size_t)count * sizeof(svxVector));
+    }
+    else
+        KernelAos(matrix.normal, 0, normalize && matrix.kind == Transform_General, count, &normals->x, &result->x);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int TransformAxes
+(
+const TransformMatrix &matrix,   /* I: matrix */
+int count,                       /* I: number of axes */
+const svxAxis *axes,             /* I: axes */
+svxAxis *result                  /* O: transformed axes, may be "axes" */
+)
+/*
+DESCRIPTION:
+   Transform a list of axes: the point as a point, the direction as a
+direction (like cvxAxisTransform(), the length is kept as transformed).
+
+   Return 1 if the input is invalid, else 0.
+*/
+{
+    if (count < 0 || (count > 0 && (axes == nullptr || result == nullptr)))
+        return 1;
+
+    if (matrix.kind == Transform_Identity)
+    {
+        if (result != axes)
+            memmove(result, axes, (size_t)count * sizeof(svxAxis));
+        return 0;
+    }
+
+    const double (*m)[4] = matrix.linear;
+    for (int i = 0; i < count; i++)
+    {
+        const svxAxis a = axes[i];
+        svxAxis &r = result[i];
+        r.Pnt.x = m[0][0] * a.Pnt.x + m[0][1] * a.Pnt.y + m[0][2] * a.Pnt.z + m[0][3];
+        r.Pnt.y = m[1][0] * a.Pnt.x + m[1][1] * a.Pnt.y + m[1][2] * a.Pnt.z + m[1][3];
+        r.Pnt.z = m[2][0] * a.Pnt.x + m[2][1] * a.Pnt.y + m[2][2] * a.Pnt.z + m[2][3];
+        r.Dir.x = m[0][0] * a.Dir.x + m[0][1] * a.Dir.y + m[0][2] * a.Dir.z;
+        r.Dir.y = m[1][0] * a.Dir.x + m[1][1] * a.Dir.y + m[1][2] * a.Dir.z;
+        r.Dir.z = m[2][0] * a.Dir.x + m[2][1] * a.Dir.y + m[2][2] * a.Dir.z;
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int TransformBoxes
+(
+const TransformMatrix &matrix,   /* I: matrix */
+int count,                       /* I: number of boxes */
+const svxBndBox *boxes,          /* I: boxes */
+svxBndBox *result                /* O: boxes of the transformed boxes, may be "boxes" */
+)
+/*
+DESCRIPTION:
+   Axis aligned box of each transformed box, from its center and half
+sizes: the new half size along axis i is the sum of |m[i][j]| times the
+old half size along j. Same box as transforming the eight corners.
+
+   Return 1 if the input is invalid, else 0.
+*/
+{
+    if (count < 0 || (count > 0 && (boxes == nullptr || result == nullptr)))
+        return 1;
+
+    if (matrix.kind == Transform_Identity)
+    {
+        if (result != boxes)
+            memmove(result, boxes, (size_t)count * sizeof(svxBndBox));
+        return 0;
+    }
+
+    const double (*m)[4] = matrix.linear;
+    for (int i = 0; i < count; i++)
+    {
+        const svxLimit *in = &boxes[i].X;
+        const double c[3] = { 0.5 * (in[0].min + in[0].max), 0.5 * (in[1].min + in[1].max), 0.5 * (in[2].min + in[2].max) };
+        const double h[3] = { 0.5 * (in[0].max - in[0].min), 0.5 * (in[1].max - in[1].min), 0.5 * (in[2].max - in[2].min) };
+        svxLimit *out = &result[i].X;
+        for (int k = 0; k < 3; k++)
+        {
+            const double center = m[k][0] * c[0] + m[k][1] * c[1] + m[k][2] * c[2] + m[k][3];
+            const double half = fabs(m[k][0]) * h[0] + fabs(m[k][1]) * h[1] + fabs(m[k][2]) * h[2];
+            out[k].min = center - half;
+            out[k].max = center + half;
+        }
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int TransformPointsf
+(
+const TransformMatrix &matrix,   /* I: matrix */
+int count,                       /* I: number of points */
+const svxPointf *points,         /* I: points (facet vertices) */
+svxPointf *result                /* O: transformed points, may be "points" */
+)
+/*
+DESCRIPTION:
+   Transform a list of float points in single precision.
+
+   Return 1 if the input is invalid, else 0.
+*/
+{
+    if (count < 0 || (count > 0 && (points == nullptr || result == nullptr)))
+        return 1;
+
+    if (matrix.kind == Transform_Identity)
+    {
+        if (result != points)
+            memmove(result, points, (size_t)count * sizeof(svxPointf));
+    }
+    else if (matrix.kind == Transform_Translation)
+        OffsetAosf(matrix.linearf, count, &points->x, &result->x);
+    else
+        KernelAosf(matrix.linearf, 1, 0, count, &points->x, &result->x);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int TransformNormalsf
+(
+const TransformMatrix &matrix,   /* I: matrix */
+int count,                       /* I: number of normals */
+const svxPointf *normals,        /* I: normals (facet normals) */
+int normalize,                   /* I: 1 to rescale to unit length after a scaling matrix */
+svxPointf *result                /* O: transformed normals, may be "normals" */
+)
+/*
+DESCRIPTION:
+   Float version of TransformNormals().
+
+   Return 1 if the input is invalid or the matrix is singular, else 0.
+*/
+{
+    if (count < 0 || (count > 0 && (normals == nullptr || result == nullptr)) || matrix.singular)
+        return 1;
+
+    if (matrix.kind <= Transform_Translation)
+    {
+        if (result != normals)
+            memmove(result, normals, (size_t)count * sizeof(svxPointf));
+    }
+    else
+        KernelAosf(matrix.normalf, 0, normalize && matrix.kind == Transform_General, count, &normals->x, &result->x);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int TransformFacets
+(
+const TransformMatrix &matrix,   /* I: matrix */
+szwFacets *facets                /* I/O: facets of a face */
+)
+/*
+DESCRIPTION:
+   Transform the vertices and normals of facets in place. A mirror matrix
+(matrix.mirror) reverses the winding of the triangles, so the strips are
+reversed too (see StripsReverse()); the strip list may then grow, and is
+resized with ZwMemoryResize() as the list of ZwFaceFacetsGet().
+
+   Return 1 if the facets are invalid, the matrix is singular and there
+are normals, or the strip list can not grow (the facets are unchanged),
+else 0.
+*/
+{
+    if (facets == nullptr || facets->numberVertex < 0 || facets->numberTriangleStrip < 0 ||
+        (facets->numberVertex > 0 && facets->vertex == nullptr) ||
+        (facets->numberTriangleStrip > 0 && facets->triangleStrip == nullptr) ||
+        (facets->normal != nullptr && matrix.singular))
+        return 1;
+
+    /* reversed strips first, nothing is changed if they can not be stored */
+    std::vector<int> reversed;
+    if (matrix.mirror)
+    {
+        int size;
+        if (StripsReverse(facets->numberTriangleStrip, facets->triangleStrip, &size, reversed))
+            return 1;
+        if (reversed.size() > (size_t)size &&
+            ZwMemoryResize((int)(reversed.size() * sizeof(int)), (void **)&facets->triangleStrip) != ZW_API_NO_ERROR)
+            return 1;
+    }
+
+    TransformPointsf(matrix, facets->numberVertex, facets->vertex, facets->vertex);
+    if (facets->normal != nullptr)
+        TransformNormalsf(matrix, facets->numberVertex, facets->normal, 1, facets->normal);
+    if (!reversed.empty())
+        memcpy(facets->triangleStrip, reversed.data(), reversed.size() * sizeof(int));
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int TransformPointsSoA
+(
+const TransformMatrix &matrix,   /* I: matrix */
+int count,                       /* I: number of points */
+const double *x,                 /* I: x coordinates */
+const double *y,                 /* I: y coordinates */
+const double *z,                 /* I: z coordinates */
+double *rx,                      /* O: transformed x, may be "x" */
+double *ry,                      /* O: transformed y, may be "y" */
+double *rz                       /* O: transformed z, may be "z" */
+)
+/*
+DESCRIPTION:
+   Transform points stored as separate coordinate arrays.
+
+   Return 1 if the input is invalid, else 0.
+*/
+{
+    if (count < 0 || (count > 0 && (!x || !y || !z || !rx || !ry || !rz)))
+        return 1;
+
+    const double (*m)[4] = matrix.linear;
+    if (matrix.kind <= Transform_Translation)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            rx[i] = x[i] + m[0][3];
+            ry[i] = y[i] + m[1][3];
+            rz[i] = z[i] + m[2][3];
+        }
+        return 0;
+    }
+
+    int i = 0;
+    D2 r[3][4];
+    for (int k = 0; k < 3; k++)
+    {
+        for (int j = 0; j < 4; j++)
+            r[k][j] = D2Set(m[k][j]);
+    }
+    for (; i + 2 <= count; i += 2)
+    {
+        const D2 px = D2Load(x + i), py = D2Load(y + i), pz = D2Load(z + i);
+        D2Store(rx + i, D2Add(D2Add(D2Mul(r[0][0], px), D2Mul(r[0][1], py)), D2Add(D2Mul(r[0][2], pz), r[0][3])));
+        D2Store(ry + i, D2Add(D2Add(D2Mul(r[1][0], px), D2Mul(r[1][1], py)), D2Add(D2Mul(r[1][2], pz), r[1][3])));
+        D2Store(rz + i, D2Add(D2Add(D2Mul(r[2][0], px), D2Mul(r[2][1], py)), D2Add(D2Mul(r[2][2], pz), r[2][3])));
+    }
+    for (; i < count; i++)
+    {
+        const double px = x[i], py = y[i], pz = z[i];
+        rx[i] = m[0][0] * px + m[0][1] * py + (m[0][2] * pz + m[0][3]);
+        ry[i] = m[1][0] * px + m[1][1] * py + (m[1][2] * pz + m[1][3]);
+        rz[i] = m[2][0] * px + m[2][1] * py + (m[2][2] * pz + m[2][3]);
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int TransformPointsSoAf
+(
+const TransformMatrix &matrix,   /* I: matrix */
+int count,                       /* I: number of points */
+const float *x,                  /* I: x coordinates */
+const float *y,                  /* I: y coordinates */
+const float *z,                  /* I: z coordinates */
+float *rx,                       /* O: transformed x, may be "x" */
+float *ry,                       /* O: transformed y, may be "y" */
+float *rz                        /* O: transformed z, may be "z" */
+)
+/*
+DESCRIPTION:
+   Float version of TransformPointsSoA().
+
+   Return 1 if the input is invalid, else 0.
+*/
+{
+    if (count < 0 || (count > 0 && (!x || !y || !z || !rx || !ry || !rz)))
+        return 1;
+
+    const float (*m)[4] = matrix.linearf;
+    if (matrix.kind <= Transform_Translation)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            rx[i] = x[i] + m[0][3];
+            ry[i] = y[i] + m[1][3];
+            rz[i] = z[i] + m[2][3];
+        }
+        return 0;
+    }
+
+    int i = 0;
+    F4 r[3][4];
+    for (int k = 0; k < 3; k++)
+    {
+        for (int j = 0; j < 4; j++)
+            r[k][j] = F4Set(m[k][j]);
+    }
+    for (; i + 4 <= count; i += 4)
+    {
+        const F4 px = F4Load(x + i), py = F4Load(y + i), pz = F4Load(z + i);
+        F4Store(rx + i, F4Add(F4Add(F4Mul(r[0][0], px), F4Mul(r[0][1], py)), F4Add(F4Mul(r[0][2], pz), r[0][3])));
+        F4Store(ry + i, F4Add(F4Add(F4Mul(r[1][0], px), F4Mul(r[1][1], py)), F4Add(F4Mul(r[1][2], pz), r[1][3])));
+        F4Store(rz + i, F4Add(F4Add(F4Mul(r[2][0], px), F4Mul(r[2][1], py)), F4Add(F4Mul(r[2][2], pz), r[2][3])));
+    }
+    for (; i < count; i++)
+    {
+        const float px = x[i], py = y[i], pz = z[i];
+        rx[i] = m[0][0] * px + m[0][1] * py + (m[0][2] * pz + m[0][3]);
+        ry[i] = m[1][0] * px + m[1][1] * py + (m[1][2] * pz + m[1][3]);
+        rz[i] = m[2][0] * px + m[2][1] * py + (m[2][2] * pz + m[2][3]);
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void KernelAos
+(
+const double rows[3][4],   /* I: matrix rows */
+int translate,             /* I: 1 to add the offset column */
+int normalize,             /* I: 1 to rescale the results to unit length */
+int count,                 /* I: number of triples */
+const double *in,          /* I: xyz triples */
+double *out                /* O: transformed triples, may be "in" */
+)
+/*
+DESCRIPTION:
+   Transform xyz triples two at a time: the two triples are loaded into
+one register per coordinate, transformed, and stored back interleaved.
+The tail uses the same operation order, so results do not depend on the
+position in the list.
+*/
+{
+    const double t[3] = { translate ? rows[0][3] : 0.0, translate ? rows[1][3] : 0.0, translate ? rows[2][3] : 0.0 };
+    D2 r[3][4];
+    for (int k = 0; k < 3; k++)
+    {
+        for (int j = 0; j < 3; j++)
+            r[k][j] = D2Set(rows[k][j]);
+        r[k][3] = D2Set(t[k]);
+    }
+
+    int i = 0;
+    for (; i + 2 <= count; i += 2)
+    {
+        D2 x, y, z;
+        D2Load3(in + 3 * i, &x, &y, &z);
+        D2 ox = D2Add(D2Add(D2Mul(r[0][0], x), D2Mul(r[0][1], y)), D2Add(D2Mul(r[0][2], z), r[0][3]));
+        D2 oy = D2Add(D2Add(D2Mul(r[1][0], x), D2Mul(r[1][1], y)), D2Add(D2Mul(r[1][2], z), r[1][3]));
+        D2 oz = D2Add(D2Add(D2Mul(r[2][0], x), D2Mul(r[2][1], y)), D2Add(D2Mul(r[2][2], z), r[2][3]));
+        if (normalize)
+            D2Unit(&ox, &oy, &oz);
+        D2Store3(out + 3 * i, ox, oy, oz);
+    }
+    for (; i < count; i++)
+    {
+        const double x = in[3 * i], y = in[3 * i + 1], z = in[3 * i + 2];
+        double o[3];
+        for (int k = 0; k < 3; k++)
+            o[k] = rows[k][0] * x + rows[k][1] * y + (rows[k][2] * z + t[k]);
+        if (normalize)
+        {
+            const double l2 = o[0] * o[0] + o[1] * o[1] + o[2] * o[2];
+            const double len = sqrt(l2 > DBL_MIN ? l2 : DBL_MIN);
+            for (int k = 0; k < 3; k++)
+                o[k] /= len;
+        }
+        memcpy(out + 3 * i, o, sizeof(o));
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+void KernelAosf
+(
+const float rows[3][4],    /* I: matrix rows */
+int translate,             /* I: 1 to add the offset column */
+int normalize,             /* I: 1 to rescale the results to unit length */
+int count,                 /* I: number of triples */
+const float *in,           /* I: xyz triples */
+float *out                 /* O: transformed triples, may be "in" */
+)
+/*
+DESCRIPTION:
+   Float version of KernelAos(), four triples at a time.
+*/
+{
+    const float t[3] = { translate ? rows[0][3] : 0.0f, translate ? rows[1][3] : 0.0f, translate ? rows[2][3] : 0.0f };
+    F4 r[3][4];
+    for (int k = 0; k < 3; k++)
+    {
+        for (int j = 0; j < 3; j++)
+            r[k][j] = F4Set(rows[k][j]);
+        r[k][3] = F4Set(t[k]);
+    }
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        F4 x, y, z;
+        F4Load3(in + 3 * i, &x, &y, &z);
+        F4 ox = F4Add(F4Add(F4Mul(r[0][0], x), F4Mul(r[0][1], y)), F4Add(F4Mul(r[0][2], z), r[0][3]));
+        F4 oy = F4Add(F4Add(F4Mul(r[1][0], x), F4Mul(r[1][1], y)), F4Add(F4Mul(r[1][2], z), r[1][3]));
+        F4 oz = F4Add(F4Add(F4Mul(r[2][0], x), F4Mul(r[2][1], y)), F4Add(F4Mul(r[2][2], z), r[2][3]));
+        if (normalize)
+            F4Unit(&ox, &oy, &oz);
+        F4Store3(out + 3 * i, ox, oy, oz);
+    }
+    for (; i < count; i++)
+    {
+        const float x = in[3 * i], y = in[3 * i + 1], z = in[3 * i + 2];
+        float o[3];
+        for (int k = 0; k < 3; k++)
+            o[k] = rows[k][0] * x + rows[k][1] * y + (rows[k][2] * z + t[k]);
+        if (normalize)
+        {
+            const float l2 = o[0] * o[0] + o[1] * o[1] + o[2] * o[2];
+            const float inverse = 1.0f / sqrtf(l2 > FLT_MIN ? l2 : FLT_MIN);
+            for (int k = 0; k < 3; k++)
+                o[k] *= inverse;
+        }
+        memcpy(out + 3 * i, o, sizeof(o));
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+void OffsetAos
+(
+const double rows[3][4],   /* I: matrix rows, only the offset is used */
+int count,                 /* I: number of triples */
+const double *in,          /* I: xyz triples */
+double *out                /* O: moved triples, may be "in" */
+)
+/*
+DESCRIPTION:
+   Add the offset of a translation matrix to xyz triples.
+*/
+{
+    const double t[3] = { rows[0][3], rows[1][3], rows[2][3] };
+    for (int i = 0; i < count; i++)
+    {
+        out[3 * i] = in[3 * i] + t[0];
+        out[3 * i + 1] = in[3 * i + 1] + t[1];
+        out[3 * i + 2] = in[3 * i + 2] + t[2];
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+void OffsetAosf
+(
+const float rows[3][4],    /* I: matrix rows, only the offset is used */
+int count,                 /* I: number of triples */
+const float *in,           /* I: xyz triples */
+float *out                 /* O: moved triples, may be "in" */
+)
+/*
+DESCRIPTION:
+   Float version of OffsetAos().
+*/
+{
+    const float t[3] = { rows[0][3], rows[1][3], rows[2][3] };
+    for (int i = 0; i < count; i++)
+    {
+        out[3 * i] = in[3 * i] + t[0];
+        out[3 * i + 1] = in[3 * i + 1] + t[1];
+        out[3 * i + 2] = in[3 * i + 2] + t[2];
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+void MatrixRows
+(
+const szwMatrix &matrix,   /* I: ZW3D matrix */
+double rows[3][4]          /* O: rows of the 3x4 part */
+)
+/*
+DESCRIPTION:
+   Rows of a ZW3D matrix. Its columns are the axes, X = (xx, yx, zx), so
+row 0 is (xx, xy, xz, xt).
+*/
+{
+    rows[0][0] = matrix.xx; rows[0][1] = matrix.xy; rows[0][2] = matrix.xz; rows[0][3] = matrix.xt;
+    rows[1][0] = matrix.yx; rows[1][1] = matrix.yy; rows[1][2] = matrix.yz; rows[1][3] = matrix.yt;
+    rows[2][0] = matrix.zx; rows[2][1] = matrix.zy; rows[2][2] = matrix.zz; rows[2][3] = matrix.zt;
+}
+
+/*******************************************************************/
+/* Function definition */
+int StripsReverse
+(
+int count,                    /* I: number of strips */
+const int *strips,            /* I: strips, "n, index 1, ..., index n" each */
+int *size,                    /* O: number of integers of "strips" */
+std::vector<int> &reversed    /* O: strips with the winding reversed */
+)
+/*
+DESCRIPTION:
+   Reverse the winding of triangle strips. As every second triangle of a
+strip is read reversed, a strip of odd length reversed end to end gives
+its triangles reversed, but one of even length gives them unchanged: it
+starts with its first vertex repeated instead (one degenerate triangle
+more), which shifts the triangles by one. Strips of less than 3 vertices
+are copied.
+
+   Return 1 if a strip length is negative or the list is too long, else 0.
+*/
+{
+    reversed.clear();
+    *size = 0;
+    long long total = 0, grown = 0;
+    for (int k = 0, i = 0; k < count; k++)
+    {
+        const int n = strips[i];
+        if (n < 0)
+            return 1;
+        total += n + 1;
+        grown += n + 1 + (n >= 3 && n % 2 == 0);
+        i += n + 1;
+    }
+    if (grown * (long long)sizeof(int) > INT_MAX)
+        return 1;
+    *size = (int)total;
+
+    reversed.reserve((size_t)grown);
+    for (int k = 0, i = 0; k < count; k++)
+    {
+        const int n = strips[i];
+        const int *s = strips + i + 1;
+        if (n < 3)
+            reversed.insert(reversed.end(), strips + i, s + n);
+        else if (n % 2 == 1)
+        {
+            reversed.push_back(n);
+            for (int j = n - 1; j >= 0; j--)
+                reversed.push_back(s[j]);
+        }
+        else
+        {
+            reversed.push_back(n + 1);
+            reversed.push_back(s[0]);
+            reversed.insert(reversed.end(), s, s + n);
+        }
+        i += n + 1;
+    }
+    return 0;
+}
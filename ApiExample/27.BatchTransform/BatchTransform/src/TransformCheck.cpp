@@ -0,0 +1,392 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* ZW3D API includes */
+#include "zwapi_memory.h"
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+#include <random>
+#include <vector>
+#include "TransformBatch.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define CHECK_TOLERANCE 1.0e-12      /* largest difference of the double kernels */
+#define CHECK_TOLERANCEF 1.0e-4      /* largest difference of the float kernels */
+#define CHECK_POINTS 1001            /* random points, odd to run the tails of the kernels */
+
+/*******************************************************************/
+/* Function declarations */
+static szwMatrix RotationZ(double angle, double x, double y, double z);
+static void Reference(const szwMatrix &matrix, const svxPoint &p, svxPoint *result);
+static double Distance(const svxPoint &a, const svxPoint &b);
+static double VectorDistance(const svxVector &a, const svxVector &b);
+static int Report(const char *name, double error, double tolerance);
+static int AxisCheck(void);
+static int ChainCheck(void);
+static int GeneralCheck(std::mt19937 &random);
+static int MirrorCheck(void);
+
+/*******************************************************************/
+/* Function definition */
+ezwErrors ZwMemoryResize
+(
+int numBytes,           /* I: new number of bytes */
+void **memoryPointer    /* I/O: memory */
+)
+/*
+DESCRIPTION:
+   Stand-in of the host allocator for TransformFacets(): realloc(), the
+memory is kept if it fails.
+*/
+{
+    if (memoryPointer == nullptr || numBytes <= 0)
+        return ZW_API_INVALID_INPUT;
+    void *resized = realloc(*memoryPointer, (size_t)numBytes);
+    if (resized == nullptr)
+        return ZW_API_MEMORY_ERROR;
+    *memoryPointer = resized;
+    return ZW_API_NO_ERROR;
+}
+
+/*******************************************************************/
+/* Function definition */
+szwMatrix RotationZ
+(
+double angle,   /* I: angle about Z, radians */
+double x,       /* I: origin x */
+double y,       /* I: origin y */
+double z        /* I: origin z */
+)
+/*
+DESCRIPTION:
+   Frame rotated about Z at an origin, built from the header layout: the
+columns are the axes, X = (xx, yx, zx), and the offset.
+*/
+{
+    szwMatrix matrix{};
+    matrix.xx = cos(angle); matrix.xy = -sin(angle); matrix.xz = 0.0; matrix.xt = x;
+    matrix.yx = sin(angle); matrix.yy = cos(angle); matrix.yz = 0.0; matrix.yt = y;
+    matrix.zx = 0.0; matrix.zy = 0.0; matrix.zz = 1.0; matrix.zt = z;
+    matrix.scale = 1.0;
+    return matrix;
+}
+
+/*******************************************************************/
+/* Function definition */
+void Reference
+(
+const szwMatrix &matrix,   /* I: matrix */
+const svxPoint &p,         /* I: point */
+svxPoint *result           /* O: transformed point */
+)
+/*
+DESCRIPTION:
+   Transform a point by the axes of the matrix, p.x X + p.y Y + p.z Z + t.
+*/
+{
+    result->x = matrix.xx * p.x + matrix.xy * p.y + matrix.xz * p.z + matrix.xt;
+    result->y = matrix.yx * p.x + matrix.yy * p.y + matrix.yz * p.z + matrix.yt;
+    result->z = matrix.zx * p.x + matrix.zy * p.y + matrix.zz * p.z + matrix.zt;
+}
+
+/*******************************************************************/
+/* Function definition */
+double Distance
+(
+const svxPoint &a,   /* I: first point */
+const svxPoint &b    /* I: second point */
+)
+/*
+DESCRIPTION:
+   Distance between two points.
+*/
+{
+    return sqrt((a.x - b.x) * (a.x - b.x) + (a.y - b.y) * (a.y - b.y) + (a.z - b.z) * (a.z - b.z));
+}
+
+/*******************************************************************/
+/* Function definition */
+double VectorDistance
+(
+const svxVector &a,   /* I: first vector */
+const svxVector &b    /* I: second vector */
+)
+/*
+DESCRIPTION:
+   Length of the difference of two vectors.
+*/
+{
+    return sqrt((a.x - b.x) * (a.x - b.x) + (a.y - b.y) * (a.y - b.y) + (a.z - b.z) * (a.z - b.z));
+}
+
+/*******************************************************************/
+/* Function definition */
+int Report
+(
+const char *name,    /* I: name of the check */
+double error,        /* I: largest error */
+double tolerance     /* I: largest error allowed */
+)
+/*
+DESCRIPTION:
+   Print the result of a check.
+
+   Return 1 if the error is above the tolerance (or not a number), else 0.
+*/
+{
+    const int failed = !(error <= tolerance);
+    printf("%-52s %9.2g %s\n", name, error, failed ? "FAILED" : "passed");
+    return failed;
+}
+
+/*******************************************************************/
+/* Function definition */
+int AxisCheck
+(
+void
+)
+/*
+DESCRIPTION:
+   A rotation about Z must map (1, 0, 0) to the origin plus its X axis
+(xx, yx, zx), and (0, 1, 0) to the origin plus its Y axis, with every
+kernel.
+
+   Return the number of failed checks.
+*/
+{
+    const szwMatrix matrix = RotationZ(0.5, 10.0, -4.0, 2.0);
+    TransformMatrix prepared;
+    TransformMatrixMake(matrix, &prepared);
+    const svxPoint origin = { matrix.xt, matrix.yt, matrix.zt };
+    const svxPoint unit[2] = { { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 } };
+    const svxPoint expected[2] = { { origin.x + matrix.xx, origin.y + matrix.yx, origin.z + matrix.zx },
+        { origin.x + matrix.xy, origin.y + matrix.yy, origin.z + matrix.zy } };
+    const svxVector unitVector[2] = { { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 } };
+    const svxVector axis[2] = { { matrix.xx, matrix.yx, matrix.zx }, { matrix.xy, matrix.yy, matrix.zy } };
+
+    double pointError = 0.0, vectorError = 0.0, normalError = 0.0, floatError = 0.0, soaError = 0.0;
+    double boxError = 0.0, axisError = 0.0;
+    svxPoint points[2];
+    TransformPoints(prepared, 2, unit, points);
+    svxVector vectors[2], normals[2];
+    TransformVectors(prepared, 2, unitVector, vectors);
+    TransformNormals(prepared, 2, unitVector, 1, normals);
+    const svxPointf unitf[2] = { { 1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f } };
+    svxPointf pointsf[2];
+    TransformPointsf(prepared, 2, unitf, pointsf);
+    double x[2] = { 1.0, 0.0 }, y[2] = { 0.0, 1.0 }, z[2] = { 0.0, 0.0 };
+    TransformPointsSoA(prepared, 2, x, y, z, x, y, z);
+    for (int k = 0; k < 2; k++)
+    {
+        pointError = fmax(pointError, Distance(points[k], expected[k]));
+        vectorError = fmax(vectorError, VectorDistance(vectors[k], axis[k]));
+        normalError = fmax(normalError, VectorDistance(normals[k], axis[k]));
+        const svxPoint pf = { pointsf[k].x, pointsf[k].y, pointsf[k].z };
+        floatError = fmax(floatError, Distance(pf, expected[k]));
+        const svxPoint soa = { x[k], y[k], z[k] };
+        soaError = fmax(soaError, Distance(soa, expected[k]));
+    }
+
+    /* a box around (1, 0, 0) only, an axis from (1, 0, 0) along X */
+    svxBndBox box = { { 1.0, 1.0 }, { 0.0, 0.0 }, { 0.0, 0.0 } }, boxOut;
+    TransformBoxes(prepared, 1, &box, &boxOut);
+    const svxPoint low = { boxOut.X.min, boxOut.Y.min, boxOut.Z.min };
+    const svxPoint high = { boxOut.X.max, boxOut.Y.max, boxOut.Z.max };
+    boxError = fmax(Distance(low, expected[0]), Distance(high, expected[0]));
+    const svxAxis line = { unit[0], unitVector[0] };
+    svxAxis lineOut;
+    TransformAxes(prepared, 1, &line, &lineOut);
+    axisError = fmax(Distance(lineOut.Pnt, expected[0]), VectorDistance(lineOut.Dir, axis[0]));
+
+    int failures = 0;
+    failures += Report("rotation about Z: points to origin + axes", pointError, CHECK_TOLERANCE);
+    failures += Report("rotation about Z: vectors to axes", vectorError, CHECK_TOLERANCE);
+    failures += Report("rotation about Z: normals to axes", normalError, CHECK_TOLERANCE);
+    failures += Report("rotation about Z: float points", floatError, CHECK_TOLERANCEF);
+    failures += Report("rotation about Z: SoA points", soaError, CHECK_TOLERANCE);
+    failures += Report("rotation about Z: box", boxError, CHECK_TOLERANCE);
+    failures += Report("rotation about Z: axis", axisError, CHECK_TOLERANCE);
+    return failures;
+}
+
+/*******************************************************************/
+/* Function definition */
+int ChainCheck
+(
+void
+)
+/*
+DESCRIPTION:
+   The product of two frames must transform as the outer frame applied to
+the inner one, and two rotations about Z must add their angles.
+
+   Return the number of failed checks.
+*/
+{
+    const szwMatrix outer = RotationZ(0.3, 5.0, 1.0, -2.0), inner = RotationZ(0.9, -3.0, 7.0, 4.0);
+    szwMatrix product;
+    TransformMatrixMultiply(outer, inner, &product);
+    TransformMatrix prepared;
+    TransformMatrixMake(product, &prepared);
+
+    const svxPoint p = { 1.5, -2.0, 0.75 };
+    svxPoint step, expected, result;
+    Reference(inner, p, &step);
+    Reference(outer, step, &expected);
+    TransformPoints(prepared, 1, &p, &result);
+    const double angleError = fabs(atan2(product.yx, product.xx) - 1.2);
+    return Report("product of frames: outer(inner(p))", Distance(result, expected), CHECK_TOLERANCE) +
+        Report("product of frames: angles about Z add", angleError, CHECK_TOLERANCE);
+}
+
+/*******************************************************************/
+/* Function definition */
+int GeneralCheck
+(
+std::mt19937 &random   /* I/O: random numbers */
+)
+/*
+DESCRIPTION:
+   A general matrix without symmetry: the kernels must agree with the
+transform by the axes, and the normals must stay perpendicular to the
+transformed tangents.
+
+   Return the number of failed checks.
+*/
+{
+    szwMatrix matrix{};
+    matrix.xx = 1.2; matrix.xy = 0.4; matrix.xz = -0.3; matrix.xt = 7.0;
+    matrix.yx = -0.7; matrix.yy = 0.9; matrix.yz = 0.2; matrix.yt = -1.0;
+    matrix.zx = 0.1; matrix.zy = -0.5; matrix.zz = 1.6; matrix.zt = 3.0;
+    matrix.scale = 1.0;
+    TransformMatrix prepared;
+    TransformMatrixMake(matrix, &prepared);
+
+    std::uniform_real_distribution<double> coordinate(-100.0, 100.0);
+    std::vector<svxPoint> points(CHECK_POINTS), result(CHECK_POINTS);
+    std::vector<svxPointf> pointsf(CHECK_POINTS), resultf(CHECK_POINTS);
+    std::vector<svxVector> tangents(CHECK_POINTS), normals(CHECK_POINTS);
+    for (int i = 0; i < CHECK_POINTS; i++)
+    {
+        points[i] = { coordinate(random), coordinate(random), coordinate(random) };
+        pointsf[i] = { (float)points[i].x, (float)points[i].y, (float)points[i].z };
+        /* a tangent and a normal perpendicular to it */
+        tangents[i] = { coordinate(random), coordinate(random), 0.0 };
+        normals[i] = { -tangents[i].y, tangents[i].x, coordinate(random) };
+    }
+    TransformPoints(prepared, CHECK_POINTS, points.data(), result.data());
+    TransformPointsf(prepared, CHECK_POINTS, pointsf.data(), resultf.data());
+    std::vector<svxVector> tangentsOut(CHECK_POINTS), normalsOut(CHECK_POINTS);
+    TransformVectors(prepared, CHECK_POINTS, tangents.data(), tangentsOut.data());
+    TransformNormals(prepared, CHECK_POINTS, normals.data(), 1, normalsOut.data());
+
+    double pointError = 0.0, floatError = 0.0, normalError = 0.0;
+    for (int i = 0; i < CHECK_POINTS; i++)
+    {
+        svxPoint expected;
+        Reference(matrix, points[i], &expected);
+        pointError = fmax(pointError, Distance(result[i], expected) / (1.0 + Distance(expected, svxPoint{})));
+        const svxPoint pf = { resultf[i].x, resultf[i].y, resultf[i].z };
+        floatError = fmax(floatError, Distance(pf, expected) / (1.0 + Distance(expected, svxPoint{})));
+        const svxVector &t = tangentsOut[i], &n = normalsOut[i];
+        const double length = sqrt(t.x * t.x + t.y * t.y + t.z * t.z);
+        normalError = fmax(normalError, fabs(t.x * n.x + t.y * n.y + t.z * n.z) / length);
+    }
+    return Report("general matrix: points by the axes (relative)", pointError, CHECK_TOLERANCE) +
+        Report("general matrix: float points (relative)", floatError, CHECK_TOLERANCEF) +
+        Report("general matrix: normals perpendicular to tangents", normalError, CHECK_TOLERANCE);
+}
+
+/*******************************************************************/
+/* Function definition */
+int MirrorCheck
+(
+void
+)
+/*
+DESCRIPTION:
+   Facets of strips of 3 to 8 vertices on the plane z = 0 mirrored in x:
+every triangle must keep an upward normal, after the vertices are
+mirrored and the strips reversed.
+
+   Return the number of failed checks.
+*/
+{
+    std::vector<szwPointf> vertices;
+    std::vector<int> list;
+    int strips = 0;
+    for (int n = 3; n <= 8; n++, strips++)
+    {
+        list.push_back(n);
+        for (int j = 0; j < n; j++)
+        {
+            list.push_back((int)vertices.size());
+            const szwPointf p = { (float)(j % 2), (float)(j / 2 + 5 * strips), 0.0f };
+            vertices.push_back(p);
+        }
+    }
+    szwFacets facets{};
+    facets.numberTriangleStrip = strips;
+    facets.triangleStrip = (int *)malloc(list.size() * sizeof(int));
+    memcpy(facets.triangleStrip, list.data(), list.size() * sizeof(int));
+    facets.numberVertex = (int)vertices.size();
+    facets.vertex = vertices.data();
+
+    szwMatrix matrix{};
+    matrix.xx = -1.0;
+    matrix.yy = matrix.zz = matrix.scale = 1.0;
+    TransformMatrix prepared;
+    TransformMatrixMake(matrix, &prepared);
+
+    /* the z of the normal of each triangle, read as in ZwFaceFacetsGet() */
+    int failures = TransformFacets(prepared, &facets), up = 0, down = 0;
+    const int *s = facets.triangleStrip;
+    for (int k = 0; k < facets.numberTriangleStrip && !failures; k++)
+    {
+        const int n = *s++;
+        for (int j = 0; j + 2 < n; j++)
+        {
+            const szwPointf &a = vertices[s[(j & 1) ? j + 1 : j]], &b = vertices[s[(j & 1) ? j : j + 1]];
+            const szwPointf &c = vertices[s[j + 2]];
+            const double nz = (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+            up += nz > 0.0;
+            down += nz < 0.0;
+        }
+        s += n;
+    }
+    free(facets.triangleStrip);
+    printf("%-52s %4d up %4d down %s\n", "mirrored facets: triangle normals", up, down,
+        failures || down ? "FAILED" : "passed");
+    return failures || down ? 1 : 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int main
+(
+void
+)
+/*
+DESCRIPTION:
+   Check the batch transforms against frames built from the layout of
+the header (axes in the columns).
+
+   Return 1 if a check fails, else 0.
+*/
+{
+    std::mt19937 random(27);
+    int failures = AxisCheck();
+    failures += ChainCheck();
+    failures += GeneralCheck(random);
+    failures += MirrorCheck();
+    printf("checks: %s\n", failures ? "FAILED" : "passed");
+    return failures ? 1 : 0;
+}
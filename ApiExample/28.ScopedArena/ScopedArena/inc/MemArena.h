@@ -0,0 +1,119 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+#pragma once
+
+/* Application includes */
+#include <vector>
+
+/*******************************************************************/
+/* Constant definitions */
+#define MEM_ARENA_BLOCK (64 * 1024)   /* default block size in bytes */
+#define MEM_ARENA_ALIGN 16            /* alignment of Alloc() */
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: counters of an arena, or of a scope (difference since its start) */
+struct MemArenaStats
+{
+    int allocations;            /* Alloc() calls */
+    long long allocatedBytes;   /* bytes asked to Alloc() */
+    int adopted;                /* lists of the ZW3D functions adopted */
+    long long adoptedBytes;     /* their size as given to Adopt() */
+    int blocks;                 /* blocks taken with cvxMemAlloc() */
+    int frees;                  /* cvxMemFree() calls */
+    long long peakBytes;        /* most bytes in use at a time, allocated and adopted */
+};
+
+/* DESCRIPTION: position of an arena, see MemArena::Position() */
+struct MemArenaMark
+{
+    int block;                  /* current block */
+    int offset;                 /* bytes used in the current block */
+    int adopted;                /* number of adopted lists */
+    long long inUse;            /* bytes in use */
+    MemArenaStats stats;        /* counters at the position */
+};
+
+/*
+DESCRIPTION:
+   Arena for the many small lists of a topology walk. Two kinds of memory
+are released together:
+
+   - Alloc() hands out aligned pieces of large blocks taken with
+cvxMemAlloc(). A piece is never freed on its own; rewinding the arena
+makes the pieces reusable without giving the blocks back, so a walk that
+allocates thousands of small arrays takes only a few blocks once.
+   - Adopt() takes ownership of a list returned by a ZW3D function (for
+example cvxPartInqShapeFaces()), which must be released with cvxMemFree().
+The list is freed when the arena is rewound past it, so no path of the
+caller has to free it.
+
+   Rewind() goes back to a Position(); MemArenaScope does it at the end of
+a C++ scope. Positions must be rewound in reverse order, like scopes are
+nested. Position() also restarts the peak counter, so the peak of a scope
+can be told from the peak of the whole arena. Release() rewinds
+everything, Trim() gives the unused blocks back. The arena is not
+thread-safe.
+*/
+class MemArena
+{
+public:
+    MemArena(int blockSize = MEM_ARENA_BLOCK);
+    ~MemArena();
+
+    void *Alloc(int bytes);
+    template <class T> T *Alloc(int count) { return (T *)Alloc(count * (int)sizeof(T)); }
+    void *Adopt(void *list, long long bytes);
+    template <class T> T *Adopt(T *list, int count) { return (T *)Adopt((void *)list, (long long)count * sizeof(T)); }
+
+    MemArenaMark Position(void);
+    void Rewind(const MemArenaMark &mark);
+    void Release(void);
+    void Trim(void);
+
+    const MemArenaStats &Stats(void) const { return m_stats; }
+    long long InUse(void) const { return m_inUse; }
+    long long Reserved(void) const;
+
+private:
+    MemArena(const MemArena &);
+    MemArena &operator=(const MemArena &);
+
+    struct Block
+    {
+        char *memory;
+        int size;
+    };
+
+    std::vector<Block> m_blocks;
+    std::vector<void *> m_adopted;
+    int m_block;          /* current block, -1 before the first Alloc() */
+    int m_offset;         /* bytes used in the current block */
+    int m_blockSize;
+    long long m_inUse;
+    MemArenaStats m_stats;
+};
+
+/*
+DESCRIPTION:
+   Rewind an arena at the end of a C++ scope: everything allocated or
+adopted inside the scope is released when the scope is left, on every
+return path. Stats() gives the counters of the scope so far.
+*/
+class MemArenaScope
+{
+public:
+    MemArenaScope(MemArena &arena) : m_arena(arena), m_mark(arena.Position()) {}
+    ~MemArenaScope() { m_arena.Rewind(m_mark); }
+
+    MemArenaStats Stats(void) const;
+
+private:
+    MemArenaScope(const MemArenaScope &);
+    MemArenaScope &operator=(const MemArenaScope &);
+
+    MemArena &m_arena;
+    MemArenaMark m_mark;
+};
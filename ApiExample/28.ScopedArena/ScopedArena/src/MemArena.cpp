@@ -0,0 +1,240 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* ZW3D API includes */
+#include "zwapi_memory.h"
+
+/*******************************************************************/
+/* Application includes */
+#include <string.h>
+#include "..\inc\MemArena.h"
+
+/*******************************************************************/
+/* Function definition */
+MemArena::MemArena
+(
+int blockSize   /* I: size of the blocks taken with cvxMemAlloc() */
+)
+    : m_block(-1), m_offset(0), m_blockSize(blockSize > 1024 ? blockSize : 1024), m_inUse(0)
+/*
+DESCRIPTION:
+   Create an empty arena. No memory is taken before the first Alloc().
+*/
+{
+    memset(&m_stats, 0, sizeof(m_stats));
+}
+
+/*******************************************************************/
+/* Function definition */
+MemArena::~MemArena
+(
+)
+/*
+DESCRIPTION:
+   Free the adopted lists and the blocks.
+*/
+{
+    Release();
+    Trim();
+}
+
+/*******************************************************************/
+/* Function definition */
+void *MemArena::Alloc
+(
+int bytes   /* I: size in bytes */
+)
+/*
+DESCRIPTION:
+   Allocate "bytes" bytes aligned to MEM_ARENA_ALIGN. The memory is not
+initialized and stays valid until the arena is rewound past it.
+
+   Return nullptr if the size is negative or cvxMemAlloc() fails.
+*/
+{
+    if (bytes < 0)
+        return nullptr;
+
+    int offset = (m_offset + MEM_ARENA_ALIGN - 1) & ~(MEM_ARENA_ALIGN - 1);
+    if (m_block < 0 || offset + bytes > m_blocks[m_block].size)
+    {
+        /* next unused block, or a new one in front of the unused blocks if it is too small */
+        const int next = m_block + 1;
+        if (next >= (int)m_blocks.size() || m_blocks[next].size < bytes)
+        {
+            Block block;
+            block.size = bytes > m_blockSize ? bytes : m_blockSize;
+            block.memory = nullptr;
+            if (cvxMemAlloc(block.size, (void **)&block.memory) || block.memory == nullptr)
+                return nullptr;
+            m_blocks.insert(m_blocks.begin() + next, block);
+            m_stats.blocks++;
+        }
+        m_block = next;
+        offset = 0;
+    }
+
+    void *memory = m_blocks[m_block].memory + offset;
+    m_offset = offset + bytes;
+    m_inUse += bytes;
+    m_stats.allocations++;
+    m_stats.allocatedBytes += bytes;
+    if (m_inUse > m_stats.peakBytes)
+        m_stats.peakBytes = m_inUse;
+    return memory;
+}
+
+/*******************************************************************/
+/* Function definition */
+void *MemArena::Adopt
+(
+void *list,        /* I: list allocated by a ZW3D function, or nullptr */
+long long bytes    /* I: its size in bytes, for the counters only */
+)
+/*
+DESCRIPTION:
+   Take ownership of a list that must be released with cvxMemFree(). It is
+freed when the arena is rewound past this call.
+
+   Return "list".
+*/
+{
+    if (list == nullptr)
+        return nullptr;
+
+    m_adopted.push_back(list);
+    m_inUse += bytes;
+    m_stats.adopted++;
+    m_stats.adoptedBytes += bytes;
+    if (m_inUse > m_stats.peakBytes)
+        m_stats.peakBytes = m_inUse;
+    return list;
+}
+
+/*******************************************************************/
+/* Function definition */
+MemArenaMark MemArena::Position
+(
+void
+)
+/*
+DESCRIPTION:
+   Current position for Rewind(). The peak counter restarts from the bytes
+in use, Rewind() restores the larger of the two peaks.
+*/
+{
+    MemArenaMark mark;
+    mark.block = m_block;
+    mark.offset = m_offset;
+    mark.adopted = (int)m_adopted.size();
+    mark.inUse = m_inUse;
+    mark.stats = m_stats;
+    m_stats.peakBytes = m_inUse;
+    return mark;
+}
+
+/*******************************************************************/
+/* Function definition */
+void MemArena::Rewind
+(
+const MemArenaMark &mark   /* I: position of Position() */
+)
+/*
+DESCRIPTION:
+   Free the lists adopted after "mark", newest first, and make the memory
+allocated after "mark" reusable. The blocks are kept.
+*/
+{
+    for (int i = (int)m_adopted.size() - 1; i >= mark.adopted; i--)
+    {
+        cvxMemFree(&m_adopted[i]);
+        m_stats.frees++;
+    }
+    if ((int)m_adopted.size() > mark.adopted)
+        m_adopted.resize(mark.adopted);
+
+    m_block = mark.block;
+    m_offset = mark.offset;
+    m_inUse = mark.inUse;
+    if (mark.stats.peakBytes > m_stats.peakBytes)
+        m_stats.peakBytes = mark.stats.peakBytes;
+}
+
+/*******************************************************************/
+/* Function definition */
+void MemArena::Release
+(
+void
+)
+/*
+DESCRIPTION:
+   Free all adopted lists and make all blocks reusable.
+*/
+{
+    MemArenaMark start;
+    memset(&start, 0, sizeof(start));
+    start.block = -1;
+    start.stats.peakBytes = m_stats.peakBytes;
+    Rewind(start);
+}
+
+/*******************************************************************/
+/* Function definition */
+void MemArena::Trim
+(
+void
+)
+/*
+DESCRIPTION:
+   Give the blocks after the current one back with cvxMemFree().
+*/
+{
+    for (int i = (int)m_blocks.size() - 1; i > m_block; i--)
+    {
+        cvxMemFree((void **)&m_blocks[i].memory);
+        m_stats.frees++;
+    }
+    m_blocks.resize(m_block + 1);
+}
+
+/*******************************************************************/
+/* Function definition */
+long long MemArena::Reserved
+(
+void
+) const
+/*
+DESCRIPTION:
+   Size of all blocks in bytes.
+*/
+{
+    long long bytes = 0;
+    for (const Block &block : m_blocks)
+        bytes += block.size;
+    return bytes;
+}
+
+/*******************************************************************/
+/* Function definition */
+MemArenaStats MemArenaScope::Stats
+(
+void
+) const
+/*
+DESCRIPTION:
+   Counters of the arena since the start of the scope.
+*/
+{
+    const MemArenaStats &now = m_arena.Stats();
+    MemArenaStats stats;
+    stats.allocations = now.allocations - m_mark.stats.allocations;
+    stats.allocatedBytes = now.allocatedBytes - m_mark.stats.allocatedBytes;
+    stats.adopted = now.adopted - m_mark.stats.adopted;
+    stats.adoptedBytes = now.adoptedBytes - m_mark.stats.adoptedBytes;
+    stats.blocks = now.blocks - m_mark.stats.blocks;
+    stats.frees = now.frees - m_mark.stats.frees;
+    stats.peakBytes = now.peakBytes - m_mark.inUse;
+    return stats;
+}
@@ -0,0 +1,527 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* ZW3D API includes */
+#include "zwapi_brep_shape.h"   /* first, its include guard is the one of zwapi_shape.h */
+#include "zwapi_brep_edge.h"
+#include "zwapi_brep_face.h"
+#include "zwapi_brep_loop.h"
+#include "zwapi_userinput.h"
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include "..\inc\ScopedArenaPr.h"
+#include "..\inc\MemArena.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define MESSAGE_SIZE 256
+#define BENCH_PASSES 20          /* default number of walks of ~ScopedArenaBench */
+#define REPORT_SHAPES 20         /* shapes reported one by one by ~ScopedArena */
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: what a topology walk has found, to compare the walks */
+struct WalkCounts
+{
+    int shapes;
+    int faces;
+    int loops;
+    int edges;           /* edges of the faces, seam edges once */
+    int links;           /* faces of those edges */
+    int hostCalls;       /* cvxMemAlloc(), cvxMemResize() and cvxMemFree() calls of the walk itself */
+    long long checksum;  /* sum of the ids found */
+};
+
+/* DESCRIPTION: one memory request of a walk, replayed by ~ScopedArenaBench */
+struct WalkTrace
+{
+    int kind;            /* WALK_LIST, WALK_ARRAY or WALK_FACE_END */
+    int bytes;
+};
+
+enum
+{
+    WALK_LIST = 0,       /* list returned by a ZW3D function */
+    WALK_ARRAY = 1,      /* array of the walk itself */
+    WALK_FACE_END = 2,   /* everything of the face is released */
+};
+
+/*******************************************************************/
+/* Function declarations */
+static int ScopedArena(void);
+static int ScopedArenaBench(void);
+static int TopoWalkPlain(WalkCounts *counts);
+static int TopoWalkArena(MemArena &arena, int report, std::vector<WalkTrace> *trace, WalkCounts *counts);
+static int EdgesUnique(int count, int *edges);
+static double TraceReplayPlain(const std::vector<WalkTrace> &trace, int passes);
+static double TraceReplayArena(MemArena &arena, const std::vector<WalkTrace> &trace, int passes);
+static double Seconds(std::chrono::steady_clock::time_point start);
+
+/*******************************************************************/
+/* Function definition */
+int RegisterScopedArena
+(
+void
+)
+/*
+DESCRIPTION:
+   Register the commands of the scoped arena example.
+*/
+{
+    /* Walk the topology of the active part with the arena by entering "~ScopedArena" */
+    ZwCommandFunctionLoad("ScopedArena", (void *)ScopedArena, ZW_LICENSE_CODE_GENERAL);
+
+    /* Time the walk with and without the arena by entering "~ScopedArenaBench" */
+    ZwCommandFunctionLoad("ScopedArenaBench", (void *)ScopedArenaBench, ZW_LICENSE_CODE_GENERAL);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int UnloadScopedArena
+(
+void
+)
+/*
+DESCRIPTION:
+   Unload the commands of the scoped arena example.
+*/
+{
+    ZwCommandFunctionUnload("ScopedArena");
+    ZwCommandFunctionUnload("ScopedArenaBench");
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+double Seconds
+(
+std::chrono::steady_clock::time_point start   /* I: start time */
+)
+/*
+DESCRIPTION:
+   Seconds elapsed since "start".
+*/
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*******************************************************************/
+/* Function definition */
+int EdgesUnique
+(
+int count,    /* I: number of edges */
+int *edges    /* I/O: edges, sorted and without duplicates on output */
+)
+/*
+DESCRIPTION:
+   Sort the edges of a face and remove the duplicates (a cylinder face has
+its seam edge twice in its loop).
+
+   Return the number of edges left.
+*/
+{
+    std::sort(edges, edges + count);
+    return (int)(std::unique(edges, edges + count) - edges);
+}
+
+/*******************************************************************/
+/* Function definition */
+int TopoWalkPlain
+(
+WalkCounts *counts   /* O: what was found */
+)
+/*
+DESCRIPTION:
+   Walk shapes, faces, loops, edges and the faces of the edges of the
+active part like TopoInquiry does: every list is freed with cvxMemFree()
+as soon as it is not needed, on every return path, and the edges of a
+face are gathered in an array grown with cvxMemResize().
+
+   Return 1 if function fails, else 0.
+*/
+{
+    int iRet = 0, shapeCount = 0, faceCount = 0, loopCount = 0, edgeCount = 0, linkCount = 0, total = 0;
+    int *shapes = nullptr, *faces = nullptr, *loops = nullptr, *edges = nullptr, *links = nullptr, *gathered = nullptr;
+
+    memset(counts, 0, sizeof(*counts));
+    iRet = cvxPartInqShapes(nullptr, nullptr, &shapeCount, &shapes);
+    if (iRet) goto CLEAN;
+    counts->shapes = shapeCount;
+
+    for (int s = 0; s < shapeCount; s++)
+    {
+        iRet = cvxPartInqShapeFaces(shapes[s], &faceCount, &faces);
+        if (iRet) goto CLEAN;
+        counts->faces += faceCount;
+
+        for (int f = 0; f < faceCount; f++)
+        {
+            iRet = cvxPartInqFaceLoops(faces[f], 1, &loopCount, &loops);
+            if (iRet) goto CLEAN;
+            counts->loops += loopCount;
+
+            /* gather the edges of all loops */
+            total = 0;
+            for (int l = 0; l < loopCount; l++)
+            {
+                iRet = cvxPartInqLoopEdges(loops[l], &edgeCount, &edges);
+                if (iRet) goto CLEAN;
+                if (edgeCount > 0)
+                {
+                    iRet = cvxMemResize((total + edgeCount) * (int)sizeof(int), (void **)&gathered);
+                    counts->hostCalls++;
+                    if (iRet) goto CLEAN;
+                    memcpy(gathered + total, edges, edgeCount * sizeof(int));
+                    total += edgeCount;
+                }
+                cvxMemFree((void **)&edges);
+                counts->hostCalls++;
+            }
+            cvxMemFree((void **)&loops);
+            counts->hostCalls++;
+
+            /* faces of each edge */
+            total = EdgesUnique(total, gathered);
+            counts->edges += total;
+            for (int e = 0; e < total; e++)
+            {
+                iRet = cvxPartInqEdgeFaces(gathered[e], &linkCount, &links);
+                if (iRet) goto CLEAN;
+                counts->links += linkCount;
+                for (int k = 0; k < linkCount; k++)
+                    counts->checksum += links[k];
+                counts->checksum += gathered[e];
+                cvxMemFree((void **)&links);
+                counts->hostCalls++;
+            }
+            cvxMemFree((void **)&gathered);
+            counts->hostCalls++;
+        }
+        cvxMemFree((void **)&faces);
+        counts->hostCalls++;
+    }
+
+CLEAN:
+    /* Free memory of the lists. */
+    cvxMemFree((void **)&shapes);
+    cvxMemFree((void **)&faces);
+    cvxMemFree((void **)&loops);
+    cvxMemFree((void **)&edges);
+    cvxMemFree((void **)&links);
+    cvxMemFree((void **)&gathered);
+    return iRet ? 1 : 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int TopoWalkArena
+(
+MemArena &arena,                  /* I: arena */
+int report,                       /* I: 1 to display the counters of the first shapes */
+std::vector<WalkTrace> *trace,    /* O: memory requests of the walk, or nullptr */
+WalkCounts *counts                /* O: what was found */
+)
+/*
+DESCRIPTION:
+   Same walk as TopoWalkPlain() with the arena: each shape, face and edge
+is a scope, every list is adopted and released when its scope is left,
+and the loop lists stay valid until the edges of the face are gathered
+into one array of the arena.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    MemArenaScope walkScope(arena);
+    int shapeCount = 0, *shapes = nullptr;
+    char message[MESSAGE_SIZE];
+
+    memset(counts, 0, sizeof(*counts));
+    if (cvxPartInqShapes(nullptr, nullptr, &shapeCount, &shapes))
+        return 1;
+    arena.Adopt(shapes, shapeCount);
+    counts->shapes = shapeCount;
+    if (trace != nullptr)
+        trace->push_back({ WALK_LIST, shapeCount * (int)sizeof(int) });
+
+    for (int s = 0; s < shapeCount; s++)
+    {
+        MemArenaScope shapeScope(arena);
+        int faceCount = 0, *faces = nullptr;
+        if (cvxPartInqShapeFaces(shapes[s], &faceCount, &faces))
+            return 1;
+        arena.Adopt(faces, faceCount);
+        counts->faces += faceCount;
+        if (trace != nullptr)
+            trace->push_back({ WALK_LIST, faceCount * (int)sizeof(int) });
+
+        for (int f = 0; f < faceCount; f++)
+        {
+            MemArenaScope faceScope(arena);
+            int loopCount = 0, *loops = nullptr;
+            if (cvxPartInqFaceLoops(faces[f], 1, &loopCount, &loops))
+                return 1;
+            arena.Adopt(loops, loopCount);
+            counts->loops += loopCount;
+            if (trace != nullptr)
+                trace->push_back({ WALK_LIST, loopCount * (int)sizeof(int) });
+
+            /* edge lists of all loops, gathered once their total is known */
+            int **edges = arena.Alloc<int *>(loopCount), *edgeCounts = arena.Alloc<int>(loopCount), total = 0;
+            if (edges == nullptr || edgeCounts == nullptr)
+                return 1;
+            for (int l = 0; l < loopCount; l++)
+            {
+                if (cvxPartInqLoopEdges(loops[l], &edgeCounts[l], &edges[l]))
+                    return 1;
+                arena.Adopt(edges[l], edgeCounts[l]);
+                total += edgeCounts[l];
+                if (trace != nullptr)
+                    trace->push_back({ WALK_LIST, edgeCounts[l] * (int)sizeof(int) });
+            }
+            int *gathered = arena.Alloc<int>(total);
+            if (gathered == nullptr)
+                return 1;
+            if (trace != nullptr)
+                trace->push_back({ WALK_ARRAY, total * (int)sizeof(int) });
+            for (int l = 0, offset = 0; l < loopCount; offset += edgeCounts[l], l++)
+                memcpy(gathered + offset, edges[l], edgeCounts[l] * sizeof(int));
+
+            /* faces of each edge */
+            total = EdgesUnique(total, gathered);
+            counts->edges += total;
+            for (int e = 0; e < total; e++)
+            {
+                MemArenaScope edgeScope(arena);
+                int linkCount = 0, *links = nullptr;
+                if (cvxPartInqEdgeFaces(gathered[e], &linkCount, &links))
+                    return 1;
+                arena.Adopt(links, linkCount);
+                counts->links += linkCount;
+                if (trace != nullptr)
+                    trace->push_back({ WALK_LIST, linkCount * (int)sizeof(int) });
+                for (int k = 0; k < linkCount; k++)
+                    counts->checksum += links[k];
+                counts->checksum += gathered[e];
+            }
+            if (trace != nullptr)
+                trace->push_back({ WALK_FACE_END, 0 });
+        }
+
+        if (report && s < REPORT_SHAPES)
+        {
+            const MemArenaStats stats = shapeScope.Stats();
+            sprintf_s(message, MESSAGE_SIZE, "Shape %d: %d faces, %d lists (%lld bytes), %d arrays (%lld bytes), "
+                "peak %lld bytes, %d new blocks, %d frees", shapes[s], faceCount, stats.adopted, stats.adoptedBytes,
+                stats.allocations, stats.allocatedBytes, stats.peakBytes, stats.blocks, stats.frees);
+            cvxMsgDisp(message);
+        }
+    }
+
+    if (report)
+    {
+        const MemArenaStats stats = walkScope.Stats();
+        sprintf_s(message, MESSAGE_SIZE, "Part: %d lists (%lld bytes), %d arrays (%lld bytes), peak %lld bytes, "
+            "%d blocks (%lld bytes reserved)", stats.adopted, stats.adoptedBytes, stats.allocations,
+            stats.allocatedBytes, stats.peakBytes, arena.Stats().blocks, arena.Reserved());
+        cvxMsgDisp(message);
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+double TraceReplayPlain
+(
+const std::vector<WalkTrace> &trace,   /* I: memory requests of a walk */
+int passes                             /* I: number of replays */
+)
+/*
+DESCRIPTION:
+   Replay the memory requests of a walk with one cvxMemAlloc() and one
+cvxMemFree() per list and array, without the ZW3D inquiries.
+
+   Return the time in seconds.
+*/
+{
+    std::vector<void *> live;
+    live.reserve(trace.size());
+    const auto start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < passes; pass++)
+    {
+        for (const WalkTrace &request : trace)
+        {
+            void *memory = nullptr;
+            if (request.kind != WALK_FACE_END)
+            {
+                if (cvxMemAlloc(request.bytes > 0 ? request.bytes : 1, &memory) == 0)
+                {
+                    *(char *)memory = 0;
+                    live.push_back(memory);
+                }
+                continue;
+            }
+            for (size_t i = live.size(); i > 0; i--)
+                cvxMemFree(&live[i - 1]);
+            live.clear();
+        }
+        for (size_t i = live.size(); i > 0; i--)
+            cvxMemFree(&live[i - 1]);
+        live.clear();
+    }
+    return Seconds(start);
+}
+
+/*******************************************************************/
+/* Function definition */
+double TraceReplayArena
+(
+MemArena &arena,                       /* I: arena */
+const std::vector<WalkTrace> &trace,   /* I: memory requests of a walk */
+int passes                             /* I: number of replays */
+)
+/*
+DESCRIPTION:
+   Replay the memory requests of a walk with the arena: the lists still
+come from cvxMemAlloc() like the ones of the ZW3D functions and are
+adopted, the arrays come from the arena blocks, and everything of a face
+is released by one rewind.
+
+   Return the time in seconds.
+*/
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < passes; pass++)
+    {
+        MemArenaScope passScope(arena);
+        MemArenaMark face = arena.Position();
+        for (const WalkTrace &request : trace)
+        {
+            if (request.kind == WALK_LIST)
+            {
+                void *memory = nullptr;
+                if (cvxMemAlloc(request.bytes > 0 ? request.bytes : 1, &memory) == 0)
+                {
+                    *(char *)memory = 0;
+                    arena.Adopt(memory, (long long)request.bytes);
+                }
+            }
+            else if (request.kind == WALK_ARRAY)
+            {
+                char *memory = (char *)arena.Alloc(request.bytes);
+                if (memory != nullptr && request.bytes > 0)
+                    *memory = 0;
+            }
+            else
+            {
+                arena.Rewind(face);
+                face = arena.Position();
+            }
+        }
+    }
+    return Seconds(start);
+}
+
+/*******************************************************************/
+/* Function definition */
+int ScopedArena
+(
+void
+)
+/*
+DESCRIPTION:
+   Walk the topology of the active part with the arena and display the
+counters of each shape scope and of the whole walk.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    MemArena arena;
+    WalkCounts counts;
+    if (TopoWalkArena(arena, 1, nullptr, &counts))
+    {
+        cvxMsgDisp("Fail to walk the topology of the active part.");
+        return 1;
+    }
+
+    char message[MESSAGE_SIZE];
+    sprintf_s(message, MESSAGE_SIZE, "%d shapes, %d faces, %d loops, %d edges, %d edge faces; "
+        "%d lists freed by the arena, %lld bytes in use after the walk", counts.shapes, counts.faces, counts.loops,
+        counts.edges, counts.links, arena.Stats().frees, arena.InUse());
+    cvxMsgDisp(message);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int ScopedArenaBench
+(
+void
+)
+/*
+DESCRIPTION:
+   Walk the topology of the active part several times without and with
+the arena, then replay the memory requests of the walk alone, without
+the ZW3D inquiries, to show the memory cost on its own.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    double number = BENCH_PASSES;
+    if (cvxGetNumber("Number of passes", &number) || number < 1.0)
+        number = BENCH_PASSES;
+    const int passes = (int)number;
+
+    /* walks */
+    WalkCounts plain, arenaCounts;
+    auto start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < passes; pass++)
+    {
+        if (TopoWalkPlain(&plain))
+        {
+            cvxMsgDisp("Fail to walk the topology of the active part.");
+            return 1;
+        }
+    }
+    const double plainTime = Seconds(start);
+
+    MemArena arena;
+    start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < passes; pass++)
+    {
+        if (TopoWalkArena(arena, 0, nullptr, &arenaCounts))
+            return 1;
+    }
+    const double arenaTime = Seconds(start);
+    const MemArenaStats stats = arena.Stats();
+
+    char message[MESSAGE_SIZE];
+    sprintf_s(message, MESSAGE_SIZE, "%d shapes, %d faces, %d edges, %d edge faces, walks %s", plain.shapes,
+        plain.faces, plain.edges, plain.links, plain.checksum == arenaCounts.checksum &&
+        plain.links == arenaCounts.links ? "agree" : "DIFFER");
+    cvxMsgDisp(message);
+    sprintf_s(message, MESSAGE_SIZE, "Plain walk: %.2f ms per pass, %d memory calls of its own per pass",
+        1e3 * plainTime / passes, plain.hostCalls);
+    cvxMsgDisp(message);
+    sprintf_s(message, MESSAGE_SIZE, "Arena walk: %.2f ms per pass, %d blocks for all %d passes, %d arrays per pass",
+        1e3 * arenaTime / passes, stats.blocks, passes, stats.allocations / passes);
+    cvxMsgDisp(message);
+
+    /* memory requests alone */
+    std::vector<WalkTrace> trace;
+    TopoWalkArena(arena, 0, &trace, &arenaCounts);
+    const double replayPlain = TraceReplayPlain(trace, passes);
+    const double replayArena = TraceReplayArena(arena, trace, passes);
+    sprintf_s(message, MESSAGE_SIZE, "Replay of %d memory requests: cvxMemAlloc/cvxMemFree %.3f ms, arena %.3f ms "
+        "per pass", (int)trace.size(), 1e3 * replayPlain / passes, 1e3 * replayArena / passes);
+    cvxMsgDisp(message);
+    return 0;
+}
@@ -0,0 +1,139 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+#pragma once
+
+/* Application includes */
+#include <unordered_map>
+#include <vector>
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: list of ids answered by TopoGraph, valid until the next Build() or Clear() */
+struct TopoList
+{
+    int count;
+    const int *ids;
+};
+
+/* DESCRIPTION: face of a part, as read from ZW3D */
+struct TopoGraphFace
+{
+    int id;
+    int shape;       /* id of the shape */
+};
+
+/* DESCRIPTION: loop of a face */
+struct TopoGraphLoop
+{
+    int id;
+    int face;        /* id of the face */
+    int inner;       /* 1 for inner loops */
+};
+
+/* DESCRIPTION: pre-edge (use of an edge by a loop) */
+struct TopoGraphPreEdge
+{
+    int id;
+    int loop;        /* id of the loop */
+    int edge;        /* id of the edge */
+    int sense;       /* 1 if the loop runs along the edge, -1 against it */
+};
+
+/*
+DESCRIPTION:
+   Topology of a part as read from ZW3D, one record per entity. The
+pre-edges of a loop must be together and in loop order.
+*/
+struct TopoGraphInput
+{
+    std::vector<int> shapes;
+    std::vector<TopoGraphFace> faces;
+    std::vector<TopoGraphLoop> loops;
+    std::vector<TopoGraphPreEdge> preEdges;
+};
+
+/*
+DESCRIPTION:
+   B-rep adjacency of a part in compressed rows (CSR): for each entity the
+start of its row in one array of ids, so every adjacency query is two
+array reads after the id lookup, and the whole graph is a few flat
+arrays.
+
+   Edges, edge faces and edge pre-edges are derived from the pre-edges,
+so they cost no host call. ZW3D does not give vertex ids; vertices are
+numbered here (0 to VertexCount() - 1) by joining the edge ends where
+two consecutive pre-edges of a loop meet, which finds every vertex of a
+manifold or sheet body without reading any point.
+
+   Queries of unknown ids answer an empty list, -1 or 0.
+*/
+class TopoGraph
+{
+public:
+    TopoGraph();
+
+    int Build(const TopoGraphInput &input);
+    void Clear(void);
+
+    int ShapeCount(void) const { return (int)m_shapeIds.size(); }
+    int FaceCount(void) const { return (int)m_faceIds.size(); }
+    int LoopCount(void) const { return (int)m_loopIds.size(); }
+    int EdgeCount(void) const { return (int)m_edgeIds.size(); }
+    int PreEdgeCount(void) const { return (int)m_preEdgeIds.size(); }
+    int VertexCount(void) const { return m_vertexEdges.Rows(); }
+    long long Bytes(void) const;
+
+    TopoList Shapes(void) const { return { ShapeCount(), m_shapeIds.data() }; }
+    TopoList Faces(void) const { return { FaceCount(), m_faceIds.data() }; }
+    TopoList Edges(void) const { return { EdgeCount(), m_edgeIds.data() }; }
+
+    TopoList ShapeFaces(int idShape) const;
+    TopoList FaceLoops(int idFace) const;
+    TopoList FaceEdges(int idFace) const;
+    TopoList FaceNeighbors(int idFace) const;
+    TopoList LoopEdges(int idLoop) const;
+    TopoList LoopPreEdges(int idLoop) const;
+    TopoList EdgeFaces(int idEdge) const;
+    TopoList EdgePreEdges(int idEdge) const;
+    TopoList VertexEdges(int vertex) const;
+
+    int FaceShape(int idFace) const;
+    int LoopFace(int idLoop) const;
+    int LoopInner(int idLoop) const;
+    int EdgeVertex(int idEdge, int end) const;
+    int PreEdgeEdge(int idPreEdge) const;
+    int PreEdgeLoop(int idPreEdge) const;
+    int PreEdgeSense(int idPreEdge) const;
+
+private:
+    /* rows of ids: row r is items[start[r]] to items[start[r + 1] - 1] */
+    struct Csr
+    {
+        std::vector<int> start;
+        std::vector<int> items;
+
+        void Build(int rows, const std::vector<int> &row, const std::vector<int> &item);
+        void Unique(void);
+        int Rows(void) const { return start.empty() ? 0 : (int)start.size() - 1; }
+        TopoList Row(int r) const;
+        long long Bytes(void) const { return (long long)(start.capacity() + items.capacity()) * sizeof(int); }
+    };
+
+    static int Find(const std::unordered_map<int, int> &index, int id);
+
+    std::vector<int> m_shapeIds, m_faceIds, m_loopIds, m_edgeIds, m_preEdgeIds;
+    std::unordered_map<int, int> m_shapeIndex, m_faceIndex, m_loopIndex, m_edgeIndex, m_preEdgeIndex;
+
+    std::vector<int> m_faceShape;         /* per face, shape id */
+    std::vector<int> m_loopFace;          /* per loop, face id */
+    std::vector<char> m_loopInner;
+    std::vector<int> m_preEdgeLoop;       /* per pre-edge, loop id */
+    std::vector<int> m_preEdgeEdge;       /* per pre-edge, edge id */
+    std::vector<char> m_preEdgeSense;
+    std::vector<int> m_edgeVertex;        /* per edge, start and end vertex */
+
+    Csr m_shapeFaces, m_faceLoops, m_faceEdges, m_faceNeighbors;
+    Csr m_loopEdges, m_loopPreEdges, m_edgeFaces, m_edgePreEdges, m_vertexEdges;
+};
@@ -0,0 +1,571 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* Application includes */
+#include <cstddef>
+#include "..\inc\TopoGraph.h"
+
+/*******************************************************************/
+/* Function declarations */
+static int EndRoot(std::vector<int> &parent, int end);
+
+/*******************************************************************/
+/* Function definition */
+TopoGraph::TopoGraph
+(
+)
+/*
+DESCRIPTION:
+   Create an empty graph.
+*/
+{
+}
+
+/*******************************************************************/
+/* Function definition */
+void TopoGraph::Clear
+(
+void
+)
+/*
+DESCRIPTION:
+   Remove everything.
+*/
+{
+    *this = TopoGraph();
+}
+
+/*******************************************************************/
+/* Function definition */
+void TopoGraph::Csr::Build
+(
+int rows,                        /* I: number of rows */
+const std::vector<int> &row,     /* I: row of each item */
+const std::vector<int> &item     /* I: items */
+)
+/*
+DESCRIPTION:
+   Fill the rows by counting; the items of a row keep their input order.
+*/
+{
+    start.assign(rows + 1, 0);
+    for (int r : row)
+        start[r + 1]++;
+    for (int r = 0; r < rows; r++)
+        start[r + 1] += start[r];
+
+    std::vector<int> next(start.begin(), start.end() - 1);
+    items.resize(item.size());
+    for (size_t i = 0; i < item.size(); i++)
+        items[next[row[i]]++] = item[i];
+}
+
+/*******************************************************************/
+/* Function definition */
+void TopoGraph::Csr::Unique
+(
+void
+)
+/*
+DESCRIPTION:
+   Remove the repeated items of each row, keeping the first one. Rows are
+short (faces of an edge, edges of a face), a linear scan is enough.
+*/
+{
+    int write = 0;
+    for (int r = 0; r < Rows(); r++)
+    {
+        const int first = write, end = start[r + 1];
+        for (int i = start[r]; i < end; i++)
+        {
+            int k = first;
+            while (k < write && items[k] != items[i])
+                k++;
+            if (k == write)
+                items[write++] = items[i];
+        }
+        start[r] = first;
+    }
+    if (Rows() > 0)
+        start[Rows()] = write;
+    items.resize(write);
+}
+
+/*******************************************************************/
+/* Function definition */
+TopoList TopoGraph::Csr::Row
+(
+int r   /* I: row, or -1 */
+) const
+/*
+DESCRIPTION:
+   Items of a row, empty for -1.
+*/
+{
+    if (r < 0 || r >= Rows())
+        return { 0, nullptr };
+    return { start[r + 1] - start[r], items.data() + start[r] };
+}
+
+/*******************************************************************/
+/* Function definition */
+int TopoGraph::Find
+(
+const std::unordered_map<int, int> &index,   /* I: index of a kind of entity */
+int id                                       /* I: ZW3D id */
+)
+/*
+DESCRIPTION:
+   Return the position of an id, or -1 if it is unknown.
+*/
+{
+    const auto found = index.find(id);
+    return found == index.end() ? -1 : found->second;
+}
+
+/*******************************************************************/
+/* Function definition */
+int EndRoot
+(
+std::vector<int> &parent,   /* I/O: union-find forest of the edge ends */
+int end                     /* I: edge end, 2 * edge + 0 or 1 */
+)
+/*
+DESCRIPTION:
+   Root of an edge end, halving the path on the way.
+*/
+{
+    while (parent[end] != end)
+    {
+        parent[end] = parent[parent[end]];
+        end = parent[end];
+    }
+    return end;
+}
+
+/*******************************************************************/
+/* Function definition */
+int TopoGraph::Build
+(
+const TopoGraphInput &input   /* I: topology read from ZW3D */
+)
+/*
+DESCRIPTION:
+   Build the graph. Repeated ids are taken once.
+
+   Return 1 if an entity refers to an unknown owner (the graph is then
+empty), else 0.
+*/
+{
+    Clear();
+
+    /* entities and their owners */
+    for (int id : input.shapes)
+    {
+        if (m_shapeIndex.emplace(id, (int)m_shapeIds.size()).second)
+            m_shapeIds.push_back(id);
+    }
+    for (const TopoGraphFace &face : input.faces)
+    {
+        if (Find(m_shapeIndex, face.shape) < 0)
+            goto FAIL;
+        if (m_faceIndex.emplace(face.id, (int)m_faceIds.size()).second)
+        {
+            m_faceIds.push_back(face.id);
+            m_faceShape.push_back(face.shape);
+        }
+    }
+    for (const TopoGraphLoop &loop : input.loops)
+    {
+        if (Find(m_faceIndex, loop.face) < 0)
+            goto FAIL;
+        if (m_loopIndex.emplace(loop.id, (int)m_loopIds.size()).second)
+        {
+            m_loopIds.push_back(loop.id);
+            m_loopFace.push_back(loop.face);
+            m_loopInner.push_back(loop.inner ? 1 : 0);
+        }
+    }
+    for (const TopoGraphPreEdge &preEdge : input.preEdges)
+    {
+        if (Find(m_loopIndex, preEdge.loop) < 0)
+            goto FAIL;
+        if (m_preEdgeIndex.emplace(preEdge.id, (int)m_preEdgeIds.size()).second)
+        {
+            m_preEdgeIds.push_back(preEdge.id);
+            m_preEdgeLoop.push_back(preEdge.loop);
+            m_preEdgeEdge.push_back(preEdge.edge);
+            m_preEdgeSense.push_back(preEdge.sense < 0 ? -1 : 1);
+        }
+        if (m_edgeIndex.emplace(preEdge.edge, (int)m_edgeIds.size()).second)
+            m_edgeIds.push_back(preEdge.edge);
+    }
+
+    {
+        std::vector<int> row, item;
+
+        /* shape faces */
+        for (int f = 0; f < FaceCount(); f++)
+        {
+            row.push_back(Find(m_shapeIndex, m_faceShape[f]));
+            item.push_back(m_faceIds[f]);
+        }
+        m_shapeFaces.Build(ShapeCount(), row, item);
+
+        /* face loops, the outer loop first */
+        row.clear();
+        item.clear();
+        for (int inner = 0; inner < 2; inner++)
+        {
+            for (int l = 0; l < LoopCount(); l++)
+            {
+                if (m_loopInner[l] == inner)
+                {
+                    row.push_back(Find(m_faceIndex, m_loopFace[l]));
+                    item.push_back(m_loopIds[l]);
+                }
+            }
+        }
+        m_faceLoops.Build(FaceCount(), row, item);
+
+        /* loop pre-edges and edges in loop order, edge pre-edges */
+        row.clear();
+        for (int p = 0; p < PreEdgeCount(); p++)
+            row.push_back(Find(m_loopIndex, m_preEdgeLoop[p]));
+        m_loopPreEdges.Build(LoopCount(), row, m_preEdgeIds);
+        m_loopEdges.Build(LoopCount(), row, m_preEdgeEdge);
+        row.clear();
+        for (int p = 0; p < PreEdgeCount(); p++)
+            row.push_back(Find(m_edgeIndex, m_preEdgeEdge[p]));
+        m_edgePreEdges.Build(EdgeCount(), row, m_preEdgeIds);
+
+        /* edge faces and face edges */
+        item.clear();
+        for (int p = 0; p < PreEdgeCount(); p++)
+            item.push_back(m_loopFace[Find(m_loopIndex, m_preEdgeLoop[p])]);
+        m_edgeFaces.Build(EdgeCount(), row, item);
+        m_edgeFaces.Unique();
+        row.clear();
+        for (int p = 0; p < PreEdgeCount(); p++)
+            row.push_back(Find(m_faceIndex, item[p]));
+        m_faceEdges.Build(FaceCount(), row, m_preEdgeEdge);
+        m_faceEdges.Unique();
+
+        /* face neighbors through their edges */
+        row.clear();
+        item.clear();
+        for (int f = 0; f < FaceCount(); f++)
+        {
+            const TopoList edges = m_faceEdges.Row(f);
+            for (int e = 0; e < edges.count; e++)
+            {
+                const TopoList faces = m_edgeFaces.Row(Find(m_edgeIndex, edges.ids[e]));
+                for (int k = 0; k < faces.count; k++)
+                {
+                    if (faces.ids[k] != m_faceIds[f])
+                    {
+                        row.push_back(f);
+                        item.push_back(faces.ids[k]);
+                    }
+                }
+            }
+        }
+        m_faceNeighbors.Build(FaceCount(), row, item);
+        m_faceNeighbors.Unique();
+
+        /* vertices: the end of each pre-edge is the start of the next one in its loop */
+        std::vector<int> parent(2 * EdgeCount());
+        for (size_t i = 0; i < parent.size(); i++)
+            parent[i] = (int)i;
+        for (int l = 0; l < LoopCount(); l++)
+        {
+            const TopoList preEdges = m_loopPreEdges.Row(l);
+            for (int i = 0; i < preEdges.count; i++)
+            {
+                const int p = m_preEdgeIndex[preEdges.ids[i]], q = m_preEdgeIndex[preEdges.ids[(i + 1) % preEdges.count]];
+                const int pEnd = 2 * Find(m_edgeIndex, m_preEdgeEdge[p]) + (m_preEdgeSense[p] > 0 ? 1 : 0);
+                const int qStart = 2 * Find(m_edgeIndex, m_preEdgeEdge[q]) + (m_preEdgeSense[q] > 0 ? 0 : 1);
+                parent[EndRoot(parent, pEnd)] = EndRoot(parent, qStart);
+            }
+        }
+        std::vector<int> vertex(parent.size(), -1);
+        int vertexCount = 0;
+        m_edgeVertex.resize(parent.size());
+        row.clear();
+        item.clear();
+        for (size_t end = 0; end < parent.size(); end++)
+        {
+            const int root = EndRoot(parent, (int)end);
+            if (vertex[root] < 0)
+                vertex[root] = vertexCount++;
+            m_edgeVertex[end] = vertex[root];
+            row.push_back(vertex[root]);
+            item.push_back(m_edgeIds[end / 2]);
+        }
+        m_vertexEdges.Build(vertexCount, row, item);
+        m_vertexEdges.Unique();
+    }
+    return 0;
+
+FAIL:
+    Clear();
+    return 1;
+}
+
+/*******************************************************************/
+/* Function definition */
+long long TopoGraph::Bytes
+(
+void
+) const
+/*
+DESCRIPTION:
+   Approximate memory of the graph in bytes, the id indexes included.
+*/
+{
+    const long long ids = (long long)(m_shapeIds.capacity() + m_faceIds.capacity() + m_loopIds.capacity() +
+        m_edgeIds.capacity() + m_preEdgeIds.capacity() + m_faceShape.capacity() + m_loopFace.capacity() +
+        m_preEdgeLoop.capacity() + m_preEdgeEdge.capacity() + m_edgeVertex.capacity()) * sizeof(int) +
+        m_loopInner.capacity() + m_preEdgeSense.capacity();
+    const long long index = (long long)(m_shapeIndex.size() + m_faceIndex.size() + m_loopIndex.size() +
+        m_edgeIndex.size() + m_preEdgeIndex.size()) * (2 * sizeof(int) + 2 * sizeof(void *));
+    return ids + index + m_shapeFaces.Bytes() + m_faceLoops.Bytes() + m_faceEdges.Bytes() +
+        m_faceNeighbors.Bytes() + m_loopEdges.Bytes() + m_loopPreEdges.Bytes() + m_edgeFaces.Bytes() +
+        m_edgePreEdges.Bytes() + m_vertexEdges.Bytes();
+}
+
+/*******************************************************************/
+/* Function definition */
+TopoList TopoGraph::ShapeFaces
+(
+int idShape   /* I: shape id */
+) const
+/*
+DESCRIPTION:
+   Faces of a shape.
+*/
+{
+    return m_shapeFaces.Row(Find(m_shapeIndex, idShape));
+}
+
+/*******************************************************************/
+/* Function definition */
+TopoList TopoGraph::FaceLoops
+(
+int idFace   /* I: face id */
+) const
+/*
+DESCRIPTION:
+   Loops of a face, the outer loop first.
+*/
+{
+    return m_faceLoops.Row(Find(m_faceIndex, idFace));
+}
+
+/*******************************************************************/
+/* Function definition */
+TopoList TopoGraph::FaceEdges
+(
+int idFace   /* I: face id */
+) const
+/*
+DESCRIPTION:
+   Edges of a face, seam edges once.
+*/
+{
+    return m_faceEdges.Row(Find(m_faceIndex, idFace));
+}
+
+/*******************************************************************/
+/* Function definition */
+TopoList TopoGraph::FaceNeighbors
+(
+int idFace   /* I: face id */
+) const
+/*
+DESCRIPTION:
+   Other faces sharing an edge with a face.
+*/
+{
+    return m_faceNeighbors.Row(Find(m_faceIndex, idFace));
+}
+
+/*******************************************************************/
+/* Function definition */
+TopoList TopoGraph::LoopEdges
+(
+int idLoop   /* I: loop id */
+) const
+/*
+DESCRIPTION:
+   Edges of a loop in loop order, seam edges twice like
+cvxPartInqLoopEdges().
+*/
+{
+    return m_loopEdges.Row(Find(m_loopIndex, idLoop));
+}
+
+/*******************************************************************/
+/* Function definition */
+TopoList TopoGraph::LoopPreEdges
+(
+int idLoop   /* I: loop id */
+) const
+/*
+DESCRIPTION:
+   Pre-edges of a loop in loop order.
+*/
+{
+    return m_loopPreEdges.Row(Find(m_loopIndex, idLoop));
+}
+
+/*******************************************************************/
+/* Function definition */
+TopoList TopoGraph::EdgeFaces
+(
+int idEdge   /* I: edge id */
+) const
+/*
+DESCRIPTION:
+   Faces of an edge, each once.
+*/
+{
+    return m_edgeFaces.Row(Find(m_edgeIndex, idEdge));
+}
+
+/*******************************************************************/
+/* Function definition */
+TopoList TopoGraph::EdgePreEdges
+(
+int idEdge   /* I: edge id */
+) const
+/*
+DESCRIPTION:
+   Pre-edges of an edge.
+*/
+{
+    return m_edgePreEdges.Row(Find(m_edgeIndex, idEdge));
+}
+
+/*******************************************************************/
+/* Function definition */
+TopoList TopoGraph::VertexEdges
+(
+int vertex   /* I: vertex of EdgeVertex() */
+) const
+/*
+DESCRIPTION:
+   Edges meeting at a vertex, each once.
+*/
+{
+    return m_vertexEdges.Row(vertex);
+}
+
+/*******************************************************************/
+/* Function definition */
+int TopoGraph::FaceShape
+(
+int idFace   /* I: face id */
+) const
+/*
+DESCRIPTION:
+   Return the shape of a face, or -1.
+*/
+{
+    const int f = Find(m_faceIndex, idFace);
+    return f < 0 ? -1 : m_faceShape[f];
+}
+
+/*******************************************************************/
+/* Function definition */
+int TopoGraph::LoopFace
+(
+int idLoop   /* I: loop id */
+) const
+/*
+DESCRIPTION:
+   Return the face of a loop, or -1.
+*/
+{
+    const int l = Find(m_loopIndex, idLoop);
+    return l < 0 ? -1 : m_loopFace[l];
+}
+
+/*******************************************************************/
+/* Function definition */
+int TopoGraph::LoopInner
+(
+int idLoop   /* I: loop id */
+) const
+/*
+DESCRIPTION:
+   Return 1 for an inner loop, else 0.
+*/
+{
+    const int l = Find(m_loopIndex, idLoop);
+    return l < 0 ? 0 : m_loopInner[l];
+}
+
+/*******************************************************************/
+/* Function definition */
+int TopoGraph::EdgeVertex
+(
+int idEdge,   /* I: edge id */
+int end       /* I: 0 for the start vertex, 1 for the end vertex */
+) const
+/*
+DESCRIPTION:
+   Return the vertex at an end of an edge, or -1.
+*/
+{
+    const int e = Find(m_edgeIndex, idEdge);
+    return e < 0 ? -1 : m_edgeVertex[2 * e + (end ? 1 : 0)];
+}
+
+/*******************************************************************/
+/* Function definition */
+int TopoGraph::PreEdgeEdge
+(
+int idPreEdge   /* I: pre-edge id */
+) const
+/*
+DESCRIPTION:
+   Return the edge of a pre-edge, or -1.
+*/
+{
+    const int p = Find(m_preEdgeIndex, idPreEdge);
+    return p < 0 ? -1 : m_preEdgeEdge[p];
+}
+
+/*******************************************************************/
+/* Function definition */
+int TopoGraph::PreEdgeLoop
+(
+int idPreEdge   /* I: pre-edge id */
+) const
+/*
+DESCRIPTION:
+   Return the loop of a pre-edge, or -1.
+*/
+{
+    const int p = Find(m_preEdgeIndex, idPreEdge);
+    return p < 0 ? -1 : m_preEdgeLoop[p];
+}
+
+/*******************************************************************/
+/* Function definition */
+int TopoGraph::PreEdgeSense
+(
+int idPreEdge   /* I: pre-edge id */
+) const
+/*
+DESCRIPTION:
+   Return 1 if the loop runs along the edge of a pre-edge, -1 against it,
+0 if the pre-edge is unknown.
+*/
+{
+    const int p = Find(m_preEdgeIndex, idPreEdge);
+    return p < 0 ? 0 : m_preEdgeSense[p];
+}
@@ -0,0 +1,549 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* ZW3D API includes */
+#include "zwapi_brep_shape.h"   /* first, its include guard is the one of zwapi_shape.h */
+#include "zwapi_brep_edge.h"
+#include "zwapi_brep_face.h"
+#include "zwapi_brep_loop.h"
+#include "zwapi_brep_preedge.h"
+#include "zwapi_brep_vertex.h"
+#include "zwapi_file.h"
+#include "zwapi_root.h"
+#include "zwapi_userinput.h"
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <unordered_map>
+#include <vector>
+#include "..\inc\TopoSnapshotPr.h"
+#include "..\inc\TopoGraph.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define MESSAGE_SIZE 256
+#define BENCH_PASSES 10          /* default number of walks of ~TopoSnapshotBench */
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: what the snapshot was taken of, compared before it is reused */
+struct SnapshotKey
+{
+    vxLongPath file;
+    vxRootName root;
+    int faces;
+    unsigned long long checksum;   /* of the shape and face ids */
+};
+
+/*******************************************************************/
+/* Global variable declarations */
+TopoGraph g_snapshot;            /* snapshot of the active part */
+SnapshotKey g_snapshotKey;       /* what it was taken of */
+int g_snapshotValid = 0;         /* 1 if g_snapshot may be reused once g_snapshotKey is checked */
+
+/*******************************************************************/
+/* Function declarations */
+static int TopoSnapshot(void);
+static int TopoSnapshotCheck(void);
+static int TopoSnapshotBench(void);
+static const TopoGraph *SnapshotGet(int *reused, int *calls, double *seconds);
+static int SnapshotCapture(TopoGraphInput *input, int *calls);
+static int SnapshotKeyGet(SnapshotKey *key, int *calls);
+static int SnapshotKeySame(const SnapshotKey &a, const SnapshotKey &b);
+static int SameSet(int count1, const int *list1, int count2, const int *list2);
+static double Seconds(std::chrono::steady_clock::time_point start);
+
+/*******************************************************************/
+/* Function definition */
+int RegisterTopoSnapshot
+(
+void
+)
+/*
+DESCRIPTION:
+   Register the commands of the topology snapshot example.
+*/
+{
+    /* Take or reuse the snapshot of the active part by entering "~TopoSnapshot" */
+    ZwCommandFunctionLoad("TopoSnapshot", (void *)TopoSnapshot, ZW_LICENSE_CODE_GENERAL);
+
+    /* Compare the snapshot with the ZW3D inquiries by entering "~TopoSnapshotCheck" */
+    ZwCommandFunctionLoad("TopoSnapshotCheck", (void *)TopoSnapshotCheck, ZW_LICENSE_CODE_GENERAL);
+
+    /* Time topology walks with and without the snapshot by entering "~TopoSnapshotBench" */
+    ZwCommandFunctionLoad("TopoSnapshotBench", (void *)TopoSnapshotBench, ZW_LICENSE_CODE_GENERAL);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int UnloadTopoSnapshot
+(
+void
+)
+/*
+DESCRIPTION:
+   Unload the commands of the topology snapshot example.
+*/
+{
+    ZwCommandFunctionUnload("TopoSnapshot");
+    ZwCommandFunctionUnload("TopoSnapshotCheck");
+    ZwCommandFunctionUnload("TopoSnapshotBench");
+    g_snapshot.Clear();
+    g_snapshotValid = 0;
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+double Seconds
+(
+std::chrono::steady_clock::time_point start   /* I: start time */
+)
+/*
+DESCRIPTION:
+   Seconds elapsed since "start".
+*/
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*******************************************************************/
+/* Function definition */
+int SameSet
+(
+int count1,           /* I: number of ids of the first list */
+const int *list1,     /* I: first list */
+int count2,           /* I: number of ids of the second list */
+const int *list2      /* I: second list */
+)
+/*
+DESCRIPTION:
+   Return 1 if two lists hold the same ids, repeats ignored, else 0.
+*/
+{
+    std::vector<int> a(list1, list1 + count1), b(list2, list2 + count2);
+    std::sort(a.begin(), a.end());
+    std::sort(b.begin(), b.end());
+    a.erase(std::unique(a.begin(), a.end()), a.end());
+    b.erase(std::unique(b.begin(), b.end()), b.end());
+    return a == b ? 1 : 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int SnapshotKeyGet
+(
+SnapshotKey *key,   /* O: active file, part and checksum of its shape and face ids */
+int *calls          /* I/O: number of ZW3D calls */
+)
+/*
+DESCRIPTION:
+   Read what identifies the topology of the active part cheaply: one call
+for the shapes and one per shape for its faces.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    int shapeCount = 0, *shapes = nullptr;
+    memset(key, 0, sizeof(*key));
+    cvxFileInqActive(key->file, sizeof(key->file));
+    cvxRootInqActive(key->root, sizeof(key->root));
+    (*calls) += 3;
+    if (cvxPartInqShapes(nullptr, nullptr, &shapeCount, &shapes))
+        return 1;
+
+    key->checksum = 1469598103934665603ULL;
+    for (int s = 0; s < shapeCount; s++)
+    {
+        int faceCount = 0, *faces = nullptr;
+        (*calls)++;
+        if (cvxPartInqShapeFaces(shapes[s], &faceCount, &faces))
+        {
+            cvxMemFree((void **)&shapes);
+            return 1;
+        }
+        key->checksum = (key->checksum ^ (unsigned)shapes[s]) * 1099511628211ULL;
+        for (int f = 0; f < faceCount; f++)
+            key->checksum = (key->checksum ^ (unsigned)faces[f]) * 1099511628211ULL;
+        key->faces += faceCount;
+        cvxMemFree((void **)&faces);
+    }
+    cvxMemFree((void **)&shapes);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int SnapshotKeySame
+(
+const SnapshotKey &a,   /* I: first key */
+const SnapshotKey &b    /* I: second key */
+)
+/*
+DESCRIPTION:
+   Return 1 if two keys are the same, else 0.
+*/
+{
+    return strcmp(a.file, b.file) == 0 && strcmp(a.root, b.root) == 0 && a.faces == b.faces &&
+        a.checksum == b.checksum ? 1 : 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int SnapshotCapture
+(
+TopoGraphInput *input,   /* O: topology of the active part */
+int *calls               /* I/O: number of ZW3D calls */
+)
+/*
+DESCRIPTION:
+   Read shapes, faces, loops (with cvxPartInqLoopInner()) and pre-edges
+(with cvxPartInqPreEdgeInfo()) of the active part. Edges and vertices
+are derived from the pre-edges by TopoGraph, so they cost no call.
+
+   TopoGraph needs the pre-edges of a loop in loop order, which the list
+of cvxPartInqLoopPreEdges() does not promise: they are chained from the
+first one by svxPreEdge::idNext, and any left out by a broken chain
+follow in list order.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    int iRet = 0, shapeCount = 0, faceCount = 0, loopCount = 0, preEdgeCount = 0;
+    int *shapes = nullptr, *faces = nullptr, *loops = nullptr, *preEdges = nullptr;
+
+    *input = TopoGraphInput();
+    (*calls)++;
+    iRet = cvxPartInqShapes(nullptr, nullptr, &shapeCount, &shapes);
+    if (iRet) goto CLEAN;
+
+    for (int s = 0; s < shapeCount; s++)
+    {
+        input->shapes.push_back(shapes[s]);
+        (*calls)++;
+        iRet = cvxPartInqShapeFaces(shapes[s], &faceCount, &faces);
+        if (iRet) goto CLEAN;
+
+        for (int f = 0; f < faceCount; f++)
+        {
+            input->faces.push_back({ faces[f], shapes[s] });
+            (*calls)++;
+            iRet = cvxPartInqFaceLoops(faces[f], 1, &loopCount, &loops);
+            if (iRet) goto CLEAN;
+
+            for (int l = 0; l < loopCount; l++)
+            {
+                int inner = 0;
+                (*calls) += 2;
+                iRet = cvxPartInqLoopInner(loops[l], &inner);
+                if (iRet) goto CLEAN;
+                input->loops.push_back({ loops[l], faces[f], inner });
+                iRet = cvxPartInqLoopPreEdges(loops[l], &preEdgeCount, &preEdges);
+                if (iRet) goto CLEAN;
+
+                std::vector<svxPreEdge> infos(preEdgeCount);
+                std::unordered_map<int, int> index;
+                for (int p = 0; p < preEdgeCount; p++)
+                {
+                    (*calls)++;
+                    iRet = cvxPartInqPreEdgeInfo(preEdges[p], &infos[p]);
+                    if (iRet) goto CLEAN;
+                    index[preEdges[p]] = p;
+                }
+
+                std::vector<char> taken(preEdgeCount, 0);
+                for (int k = 0, p = 0, rest = 0; k < preEdgeCount; k++)
+                {
+                    if (p < 0 || taken[p])
+                    {
+                        while (taken[rest])
+                            rest++;
+                        p = rest;
+                    }
+                    taken[p] = 1;
+                    const svxPreEdge &info = infos[p];
+                    input->preEdges.push_back({ preEdges[p], loops[l], info.idEdge, info.EdgeDir * info.LoopDir });
+                    const auto next = index.find(info.idNext);
+                    p = next != index.end() ? next->second : -1;
+                }
+                cvxMemFree((void **)&preEdges);
+            }
+            cvxMemFree((void **)&loops);
+        }
+        cvxMemFree((void **)&faces);
+    }
+
+CLEAN:
+    /* Free memory of the lists. */
+    cvxMemFree((void **)&shapes);
+    cvxMemFree((void **)&faces);
+    cvxMemFree((void **)&loops);
+    cvxMemFree((void **)&preEdges);
+    return iRet ? 1 : 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+const TopoGraph *SnapshotGet
+(
+int *reused,       /* O: 1 if the cached snapshot was still valid */
+int *calls,        /* O: number of ZW3D calls */
+double *seconds    /* O: time to check and, if needed, take the snapshot */
+)
+/*
+DESCRIPTION:
+   Snapshot of the active part, taken again only when needed. The cached
+snapshot is reused if the part has not been modified since its last
+regeneration (cvxRootInqModSinceRegen()) and its file, name, shape ids
+and face ids are those it was taken of; the ids catch a regeneration
+that happened since the snapshot. A snapshot taken while the part has
+changes not regenerated yet is not cached.
+
+   Return nullptr if function fails.
+*/
+{
+    const auto start = std::chrono::steady_clock::now();
+    int modified = 1;
+    SnapshotKey key;
+    *reused = 0;
+    *calls = 1;
+    if (cvxRootInqModSinceRegen(&modified) || SnapshotKeyGet(&key, calls))
+    {
+        g_snapshotValid = 0;
+        return nullptr;
+    }
+
+    if (g_snapshotValid && !modified && SnapshotKeySame(key, g_snapshotKey))
+    {
+        *reused = 1;
+        *seconds = Seconds(start);
+        return &g_snapshot;
+    }
+
+    TopoGraphInput input;
+    if (SnapshotCapture(&input, calls) || g_snapshot.Build(input))
+    {
+        g_snapshotValid = 0;
+        return nullptr;
+    }
+    g_snapshotKey = key;
+    g_snapshotValid = !modified;
+    *seconds = Seconds(start);
+    return &g_snapshot;
+}
+
+/*******************************************************************/
+/* Function definition */
+int TopoSnapshot
+(
+void
+)
+/*
+DESCRIPTION:
+   Take the snapshot of the active part, or reuse it if it is still
+valid, and display its size. The Euler-Poincare sum V - E + F - R (R
+the inner loops) is 2 for each closed shape without holes through it.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    int reused = 0, calls = 0;
+    double seconds = 0.0;
+    const TopoGraph *graph = SnapshotGet(&reused, &calls, &seconds);
+    if (graph == nullptr)
+    {
+        cvxMsgDisp("Fail to take the topology snapshot of the active part.");
+        return 1;
+    }
+
+    int inner = 0;
+    const TopoList faces = graph->Faces();
+    for (int f = 0; f < faces.count; f++)
+        inner += graph->FaceLoops(faces.ids[f]).count - 1;
+
+    char message[MESSAGE_SIZE];
+    sprintf_s(message, MESSAGE_SIZE, "Snapshot of %s %s in %.2f ms with %d ZW3D calls (%.1f KB)", g_snapshotKey.root,
+        reused ? "reused" : "taken", 1e3 * seconds, calls, graph->Bytes() / 1024.0);
+    cvxMsgDisp(message);
+    sprintf_s(message, MESSAGE_SIZE, "%d shapes, %d faces, %d loops, %d edges, %d pre-edges, %d vertices, "
+        "V - E + F - R = %d", graph->ShapeCount(), graph->FaceCount(), graph->LoopCount(), graph->EdgeCount(),
+        graph->PreEdgeCount(), graph->VertexCount(),
+        graph->VertexCount() - graph->EdgeCount() + graph->FaceCount() - inner);
+    cvxMsgDisp(message);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int TopoSnapshotCheck
+(
+void
+)
+/*
+DESCRIPTION:
+   Compare every answer of the snapshot with the ZW3D inquiry: loops of
+each face, inner flags, edges of each loop, faces of each edge and the
+edges at both ends of each edge (cvxPartInqVertexEdges()), and display
+the number of differences.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    int reused = 0, calls = 0;
+    double seconds = 0.0;
+    const TopoGraph *graph = SnapshotGet(&reused, &calls, &seconds);
+    if (graph == nullptr)
+    {
+        cvxMsgDisp("Fail to take the topology snapshot of the active part.");
+        return 1;
+    }
+
+    int loopDiff = 0, innerDiff = 0, loopEdgeDiff = 0, edgeFaceDiff = 0, vertexDiff = 0, count = 0, *list = nullptr;
+    const TopoList faces = graph->Faces();
+    for (int f = 0; f < faces.count; f++)
+    {
+        const TopoList loops = graph->FaceLoops(faces.ids[f]);
+        if (cvxPartInqFaceLoops(faces.ids[f], 1, &count, &list) == 0)
+            loopDiff += !SameSet(count, list, loops.count, loops.ids);
+        cvxMemFree((void **)&list);
+
+        for (int l = 0; l < loops.count; l++)
+        {
+            int inner = 0;
+            if (cvxPartInqLoopInner(loops.ids[l], &inner) == 0)
+                innerDiff += inner != graph->LoopInner(loops.ids[l]);
+
+            const TopoList edges = graph->LoopEdges(loops.ids[l]);
+            if (cvxPartInqLoopEdges(loops.ids[l], &count, &list) == 0)
+                loopEdgeDiff += !SameSet(count, list, edges.count, edges.ids);
+            cvxMemFree((void **)&list);
+        }
+    }
+
+    const TopoList edges = graph->Edges();
+    for (int e = 0; e < edges.count; e++)
+    {
+        const TopoList edgeFaces = graph->EdgeFaces(edges.ids[e]);
+        if (cvxPartInqEdgeFaces(edges.ids[e], &count, &list) == 0)
+            edgeFaceDiff += !SameSet(count, list, edgeFaces.count, edgeFaces.ids);
+        cvxMemFree((void **)&list);
+
+        for (int end = 0; end < 2; end++)
+        {
+            const TopoList vertexEdges = graph->VertexEdges(graph->EdgeVertex(edges.ids[e], end));
+            if (cvxPartInqVertexEdges(edges.ids[e], end, &count, &list) == 0)
+                vertexDiff += !SameSet(count, list, vertexEdges.count, vertexEdges.ids);
+            cvxMemFree((void **)&list);
+        }
+    }
+
+    char message[MESSAGE_SIZE];
+    sprintf_s(message, MESSAGE_SIZE, "Differences: face loops %d, inner flags %d, loop edges %d, edge faces %d, "
+        "vertex edges %d (of %d faces, %d loops, %d edges)", loopDiff, innerDiff, loopEdgeDiff, edgeFaceDiff,
+        vertexDiff, graph->FaceCount(), graph->LoopCount(), graph->EdgeCount());
+    cvxMsgDisp(message);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int TopoSnapshotBench
+(
+void
+)
+/*
+DESCRIPTION:
+   Walk faces, loops, edges and the faces of each edge (the neighbors of
+every face) several times with the ZW3D inquiries and with the snapshot,
+and display the times, the time of one snapshot and of one validity
+check.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    double number = BENCH_PASSES;
+    if (cvxGetNumber("Number of passes", &number) || number < 1.0)
+        number = BENCH_PASSES;
+    const int passes = (int)number;
+
+    /* snapshot taken, then checked */
+    g_snapshotValid = 0;
+    int reused = 0, calls = 0, checkCalls = 0;
+    double takeTime = 0.0, checkTime = 0.0;
+    const TopoGraph *graph = SnapshotGet(&reused, &calls, &takeTime);
+    if (graph == nullptr || SnapshotGet(&reused, &checkCalls, &checkTime) == nullptr)
+    {
+        cvxMsgDisp("Fail to take the topology snapshot of the active part.");
+        return 1;
+    }
+
+    /* walk with the inquiries */
+    long long hostSum = 0, graphSum = 0;
+    const TopoList faces = graph->Faces();
+    auto start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < passes; pass++)
+    {
+        for (int f = 0; f < faces.count; f++)
+        {
+            int loopCount = 0, *loops = nullptr;
+            if (cvxPartInqFaceLoops(faces.ids[f], 1, &loopCount, &loops))
+                continue;
+            for (int l = 0; l < loopCount; l++)
+            {
+                int edgeCount = 0, *edges = nullptr;
+                if (cvxPartInqLoopEdges(loops[l], &edgeCount, &edges))
+                    continue;
+                for (int e = 0; e < edgeCount; e++)
+                {
+                    int faceCount = 0, *edgeFaces = nullptr;
+                    if (cvxPartInqEdgeFaces(edges[e], &faceCount, &edgeFaces))
+                        continue;
+                    for (int k = 0; k < faceCount; k++)
+                        hostSum += edgeFaces[k];
+                    cvxMemFree((void **)&edgeFaces);
+                }
+                cvxMemFree((void **)&edges);
+            }
+            cvxMemFree((void **)&loops);
+        }
+    }
+    const double hostTime = Seconds(start);
+
+    /* walk with the snapshot */
+    start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < passes; pass++)
+    {
+        for (int f = 0; f < faces.count; f++)
+        {
+            const TopoList loops = graph->FaceLoops(faces.ids[f]);
+            for (int l = 0; l < loops.count; l++)
+            {
+                const TopoList edges = graph->LoopEdges(loops.ids[l]);
+                for (int e = 0; e < edges.count; e++)
+                {
+                    const TopoList edgeFaces = graph->EdgeFaces(edges.ids[e]);
+                    for (int k = 0; k < edgeFaces.count; k++)
+                        graphSum += edgeFaces.ids[k];
+                }
+            }
+        }
+    }
+    const double graphTime = Seconds(start);
+
+    char message[MESSAGE_SIZE];
+    sprintf_s(message, MESSAGE_SIZE, "Snapshot: taken in %.2f ms (%d calls), checked in %.3f ms (%d calls)",
+        1e3 * takeTime, calls, 1e3 * checkTime, checkCalls);
+    cvxMsgDisp(message);
+    sprintf_s(message, MESSAGE_SIZE, "Walk of %d faces: ZW3D inquiries %.3f ms, snapshot %.3f ms per pass, %s",
+        faces.count, 1e3 * hostTime / passes, 1e3 * graphTime / passes,
+        hostSum == graphSum ? "same faces found" : "found faces DIFFER");
+    cvxMsgDisp(message);
+    return 0;
+}
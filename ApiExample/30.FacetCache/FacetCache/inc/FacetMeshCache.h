@@ -0,0 +1,92 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+#pragma once
+
+/* ZW3D API includes */
+#include "zwapi_util.h"
+#include "zwapi_brep_data.h"
+
+/* Application includes */
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*******************************************************************/
+/* Constant definitions */
+#define FACET_CACHE_VERSION 1      /* version of the cache file */
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: mesh of one face, same layout as szwFacets */
+struct FacetCacheMesh
+{
+    int stripCount;
+    std::vector<int> strips;         /* "count, index, index, ..." for each strip */
+    std::vector<float> vertices;     /* x, y, z of each vertex */
+    std::vector<float> normals;      /* x, y, z of each vertex, empty if the face had none */
+
+    void View(szwFacets *facets) const;
+    int TriangleCount(void) const;
+    long long Bytes(void) const;
+};
+
+/* DESCRIPTION: counters since the last StatsReset() */
+struct FacetCacheStats
+{
+    int hits;          /* Find() answered a mesh */
+    int misses;        /* face not in the cache */
+    int stale;         /* face in the cache with another stamp */
+    int stored;        /* Store() calls */
+    int pruned;        /* entries removed by Prune() */
+};
+
+/*
+DESCRIPTION:
+   Cache of face meshes. A mesh is found by the unique id of its face
+(ZwEntityUniqueIdGet(), which does not change between sessions) and the
+tessellation settings, and is answered only if the stamp given by the
+caller is the one it was stored with. The stamp stands for everything
+that changes the mesh (the caller hashes what it can read cheaply); the
+cache only compares it. Only the settings used by the tolerance type
+are part of the key, so the same request always finds the same entry.
+
+   Save() writes the cache in a compact file: variable-length integers,
+strip indices as differences, vertices as floats, normals in 4 bytes
+(octahedral, about 1e-4 radian), and a checksum. Load() takes the file
+only if the checksum, the version and the owner (file and part name)
+match, since unique ids are unique within one part only.
+*/
+class FacetMeshCache
+{
+public:
+    FacetMeshCache();
+
+    const FacetCacheMesh *Find(const std::string &uid, const szwRefineFacets &refine, uint64_t stamp);
+    int Store(const std::string &uid, const szwRefineFacets &refine, uint64_t stamp, const szwFacets &facets);
+    int Prune(void);
+    void Clear(void);
+
+    int Save(const char *path, const char *owner) const;
+    int Load(const char *path, const char *owner);
+
+    int Count(void) const { return (int)m_entries.size(); }
+    long long Bytes(void) const;
+    const FacetCacheStats &Stats(void) const { return m_stats; }
+    void StatsReset(void);
+
+private:
+    struct Entry
+    {
+        uint64_t stamp;
+        int used;                /* found or stored since the last Prune() */
+        FacetCacheMesh mesh;
+    };
+
+    static std::string Key(const std::string &uid, const szwRefineFacets &refine);
+
+    std::unordered_map<std::string, Entry> m_entries;
+    FacetCacheStats m_stats;
+};
@@ -0,0 +1,662 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* ZW3D API includes */
+#include "zwapi_entity.h"
+#include "zwapi_face.h"
+#include "zwapi_file.h"
+#include "zwapi_part_history.h"
+#include "zwapi_root.h"
+#include "zwapi_shape.h"
+#include "zwapi_userinput.h"
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "..\inc\FacetCachePr.h"
+#include "..\inc\FacetMeshCache.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define MESSAGE_SIZE 256
+#define PATH_SIZE 512
+#define CACHE_SUFFIX ".zfc"      /* cache file beside the exported file */
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: result of one tessellation of all faces */
+struct CacheRun
+{
+    int faces;
+    int tessellated;       /* faces given to ZwFaceFacetsGet() */
+    int failed;            /* faces without facets */
+    long long triangles;
+    double stampSeconds;   /* unique ids and stamps */
+    double facetSeconds;   /* ZwFaceFacetsGet() and Store() */
+    double seconds;        /* whole run, STL writing included */
+};
+
+/*******************************************************************/
+/* Global variable declarations */
+FacetMeshCache g_cache;          /* meshes of the part last exported */
+std::string g_cacheOwner;        /* file and part of g_cache, empty if none */
+
+/*******************************************************************/
+/* Function declarations */
+static int FacetCacheExport(void);
+static int FacetCacheBench(void);
+static int RefineGet(szwRefineFacets *refine);
+static int OwnerGet(std::string &owner);
+static int FaceListGet(std::vector<szwEntityHandle> &faces, std::vector<szwEntityHandle *> &lists,
+    std::vector<int> &counts);
+static void FaceListFree(std::vector<szwEntityHandle *> &lists, std::vector<int> &counts);
+static int FaceUidGet(szwEntityHandle face, std::string &uid);
+static uint64_t FaceStamp(szwEntityHandle face);
+static void StampAdd(uint64_t *hash, const void *data, size_t bytes);
+static CacheRun CacheTessellate(const std::vector<szwEntityHandle> &faces, const szwRefineFacets &refine,
+    int cacheable, FILE *stl);
+static long long StlStrips(FILE *stl, const szwFacets &facets);
+static double Seconds(std::chrono::steady_clock::time_point start);
+
+/*******************************************************************/
+/* Function definition */
+int RegisterFacetCache
+(
+void
+)
+/*
+DESCRIPTION:
+   Register the commands of the facet cache example.
+*/
+{
+    /* Export the active part to binary STL through the facet cache by entering "~FacetCacheExport" */
+    ZwCommandFunctionLoad("FacetCacheExport", (void *)FacetCacheExport, ZW_LICENSE_CODE_GENERAL);
+
+    /* Time tessellation without, with and from the saved cache by entering "~FacetCacheBench" */
+    ZwCommandFunctionLoad("FacetCacheBench", (void *)FacetCacheBench, ZW_LICENSE_CODE_GENERAL);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int UnloadFacetCache
+(
+void
+)
+/*
+DESCRIPTION:
+   Unload the commands of the facet cache example.
+*/
+{
+    ZwCommandFunctionUnload("FacetCacheExport");
+    ZwCommandFunctionUnload("FacetCacheBench");
+    g_cache.Clear();
+    g_cacheOwner.clear();
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+double Seconds
+(
+std::chrono::steady_clock::time_point start   /* I: start time */
+)
+/*
+DESCRIPTION:
+   Seconds elapsed since "start".
+*/
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*******************************************************************/
+/* Function definition */
+int RefineGet
+(
+szwRefineFacets *refine   /* O: tessellation settings */
+)
+/*
+DESCRIPTION:
+   Ask for the tolerance type and its tolerance; the other settings keep
+the display defaults.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    memset(refine, 0, sizeof(*refine));
+    refine->type = ZW_FACETS_TOLORANCE_PIXEL;
+    refine->edgeTolorance = 1.0;
+    refine->facetTolorance = 1.0;
+    refine->angleTolorance = 5.0;
+    refine->surfaceTolorance = 1.0;
+
+    double number = 0.0;
+    if (cvxGetNumber("Tolerance type (0 pixel, 1 distance, 2 angle)", &number) || number < 0.0 || number > 2.0)
+        number = 0.0;
+    refine->type = (ezwRefineFacetsToleranceType)(int)number;
+
+    if (refine->type == ZW_FACETS_TOLORANCE_DISTANCE)
+    {
+        number = 0.05;
+        if (cvxGetNumber("Distance tolerance", &number) == ZW_API_NO_ERROR && number > 0.0)
+            refine->edgeTolorance = refine->facetTolorance = number;
+        else
+            refine->edgeTolorance = refine->facetTolorance = 0.05;
+    }
+    else if (refine->type == ZW_FACETS_TOLORANCE_ANGLE)
+    {
+        number = 5.0;
+        if (cvxGetNumber("Angle tolerance (degree)", &number) == ZW_API_NO_ERROR && number > 0.0)
+            refine->angleTolorance = number;
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int OwnerGet
+(
+std::string &owner   /* O: "file|part" of the active part */
+)
+/*
+DESCRIPTION:
+   Name of the active file and part, the owner of the cache file.
+
+   Return 1 if no part is active, else 0.
+*/
+{
+    vxLongPath file = "";
+    vxRootName root = "";
+    cvxFileInqActive(file, sizeof(file));
+    cvxRootInqActive(root, sizeof(root));
+    owner = std::string(file) + "|" + root;
+    return root[0] == '\0' ? 1 : 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int FaceListGet
+(
+std::vector<szwEntityHandle> &faces,     /* O: faces of all shapes */
+std::vector<szwEntityHandle *> &lists,   /* O: lists to free with FaceListFree() */
+std::vector<int> &counts                 /* O: size of each list */
+)
+/*
+DESCRIPTION:
+   Collect the faces of all shapes of the active part.
+
+   Return 1 if no face was found, else 0.
+*/
+{
+    int countShape = 0;
+    szwEntityHandle *shapes = nullptr;
+    if (ZwShapeListGet(&countShape, &shapes))
+        return 1;
+    lists.push_back(shapes);
+    counts.push_back(countShape);
+
+    for (int i = 0; i < countShape; i++)
+    {
+        int count = 0;
+        szwEntityHandle *list = nullptr;
+        if (ZwShapeFaceListGet(shapes[i], &count, &list))
+            continue;
+        faces.insert(faces.end(), list, list + count);
+        lists.push_back(list);
+        counts.push_back(count);
+    }
+    return faces.empty() ? 1 : 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void FaceListFree
+(
+std::vector<szwEntityHandle *> &lists,   /* I/O: lists of FaceListGet() */
+std::vector<int> &counts                 /* I/O: size of each list */
+)
+/*
+DESCRIPTION:
+   Free the lists of FaceListGet().
+*/
+{
+    for (size_t i = 0; i < lists.size(); i++)
+        ZwEntityHandleListFree(counts[i], &lists[i]);
+    lists.clear();
+    counts.clear();
+}
+
+/*******************************************************************/
+/* Function definition */
+int FaceUidGet
+(
+szwEntityHandle face,   /* I: face */
+std::string &uid        /* O: unique id bytes */
+)
+/*
+DESCRIPTION:
+   Unique id of a face, which does not change when the part is saved and
+opened again (the int ids of ZwEntityIdGet() do).
+
+   Return 1 if function fails, else 0.
+*/
+{
+    szwEntityIdentifier id{};
+    if (ZwEntityUniqueIdGet(face, &id) || id.innerData == nullptr)
+        return 1;
+    uid.assign(id.innerData, id.dataLen > 0 ? (size_t)id.dataLen : 0);
+    uid.append((const char *)&id.idType, sizeof(id.idType));
+    ZwMemoryFree((void **)&id.innerData);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void StampAdd
+(
+uint64_t *hash,      /* I/O: FNV-1a hash */
+const void *data,    /* I: bytes */
+size_t bytes         /* I: number of bytes */
+)
+/*
+DESCRIPTION:
+   Add bytes to a stamp.
+*/
+{
+    const unsigned char *p = (const unsigned char *)data;
+    for (size_t i = 0; i < bytes; i++)
+        *hash = (*hash ^ p[i]) * 1099511628211ULL;
+}
+
+/*******************************************************************/
+/* Function definition */
+uint64_t FaceStamp
+(
+szwEntityHandle face   /* I: face */
+)
+/*
+DESCRIPTION:
+   Stamp of what shapes the mesh of a face, read without tessellating:
+the box of the face, the number and boxes of its edges (so a moved or
+trimmed boundary is seen), and the unique id and regeneration status of
+the feature that made it. A change of the surface inside an unchanged
+boundary and box is not seen; ~FacetCacheBench compares the cache with
+fresh facets to check a model.
+
+   Return 0 if the face cannot be read, never a valid stamp.
+*/
+{
+    uint64_t hash = 14695981039346656037ULL;
+    szwMatrix matrix{};
+    szwBoundingBox box{};
+    if (ZwEntityBoundingBoxGet(face, ZW_COORDINATE_WORLD, matrix, &box))
+        return 0;
+    StampAdd(&hash, &box, sizeof(box));
+
+    int countEdge = 0;
+    szwEntityHandle *edges = nullptr;
+    if (ZwFaceEdgeListGet(face, &countEdge, &edges) == ZW_API_NO_ERROR)
+    {
+        StampAdd(&hash, &countEdge, sizeof(countEdge));
+        for (int i = 0; i < countEdge; i++)
+        {
+            if (ZwEntityBoundingBoxGet(edges[i], ZW_COORDINATE_WORLD, matrix, &box) == ZW_API_NO_ERROR)
+                StampAdd(&hash, &box, sizeof(box));
+        }
+        ZwEntityHandleListFree(countEdge, &edges);
+    }
+
+    szwEntityHandle feature{};
+    if (ZwEntityParentFeatureGet(face, &feature) == ZW_API_NO_ERROR)
+    {
+        std::string uid;
+        if (!FaceUidGet(feature, uid))
+            StampAdd(&hash, uid.data(), uid.size());
+        int idFeature = 0;
+        evxFtrRegenStatus status = VX_FTR_REGEN_DEFAULT;
+        if (ZwEntityIdGet(1, &feature, &idFeature) == ZW_API_NO_ERROR &&
+            cvxPartInqFtrRegenStatus(idFeature, &status) == ZW_API_NO_ERROR)
+            StampAdd(&hash, &status, sizeof(status));
+        ZwEntityHandleFree(&feature);
+    }
+    return hash != 0 ? hash : 1;
+}
+
+/*******************************************************************/
+/* Function definition */
+long long StlStrips
+(
+FILE *stl,                 /* I: binary STL file, nullptr to count only */
+const szwFacets &facets    /* I: facets of one face */
+)
+/*
+DESCRIPTION:
+   Write the triangles of the strips of one face as binary STL records
+(normal left zero, readers compute it from the vertex order).
+
+   Return the number of triangles written.
+*/
+{
+    long long triangles = 0;
+    const int *s = facets.triangleStrip;
+    const float *vertex = (const float *)facets.vertex;
+    for (int k = 0; k < facets.numberTriangleStrip; k++)
+    {
+        const int n = *s++;
+        for (int j = 0; j + 2 < n; j++)
+        {
+            /* every second triangle of a strip is reversed */
+            const int a = s[(j & 1) ? j + 1 : j], b = s[(j & 1) ? j : j + 1], c = s[j + 2];
+            if (a == b || b == c || c == a || a < 0 || b < 0 || c < 0 || a >= facets.numberVertex ||
+                b >= facets.numberVertex || c >= facets.numberVertex)
+                continue;
+            if (stl != nullptr)
+            {
+                float record[12] = { 0.0f };
+                memcpy(record + 3, vertex + 3 * a, 3 * sizeof(float));
+                memcpy(record + 6, vertex + 3 * b, 3 * sizeof(float));
+                memcpy(record + 9, vertex + 3 * c, 3 * sizeof(float));
+                const unsigned short attribute = 0;
+                fwrite(record, sizeof(record), 1, stl);
+                fwrite(&attribute, sizeof(attribute), 1, stl);
+            }
+            triangles++;
+        }
+        s += n;
+    }
+    return triangles;
+}
+
+/*******************************************************************/
+/* Function definition */
+CacheRun CacheTessellate
+(
+const std::vector<szwEntityHandle> &faces,   /* I: faces */
+const szwRefineFacets &refine,               /* I: tessellation settings */
+int cacheable,                               /* I: 1 to store new meshes in g_cache */
+FILE *stl                                    /* I: binary STL file, nullptr for none */
+)
+/*
+DESCRIPTION:
+   Get the mesh of every face from g_cache, or from ZwFaceFacetsGet() if
+the face is not cached or its stamp changed.
+*/
+{
+    CacheRun run{};
+    const auto start = std::chrono::steady_clock::now();
+    run.faces = (int)faces.size();
+
+    for (const szwEntityHandle &face : faces)
+    {
+        auto step = std::chrono::steady_clock::now();
+        std::string uid;
+        const int hasUid = FaceUidGet(face, uid) ? 0 : 1;
+        const uint64_t stamp = hasUid ? FaceStamp(face) : 0;
+        run.stampSeconds += Seconds(step);
+
+        const FacetCacheMesh *mesh = stamp != 0 ? g_cache.Find(uid, refine, stamp) : nullptr;
+        if (mesh != nullptr)
+        {
+            szwFacets view;
+            mesh->View(&view);
+            run.triangles += StlStrips(stl, view);
+            continue;
+        }
+
+        step = std::chrono::steady_clock::now();
+        szwRefineFacets request = refine;
+        request.faceHandle = face;
+        szwFacets facets{};
+        run.tessellated++;
+        if (ZwFaceFacetsGet(request, &facets))
+        {
+            run.failed++;
+            continue;
+        }
+        if (cacheable && stamp != 0)
+            g_cache.Store(uid, refine, stamp, facets);
+        run.facetSeconds += Seconds(step);
+        run.triangles += StlStrips(stl, facets);
+        ZwFaceFacetsDataFree(&facets);
+    }
+    run.seconds = Seconds(start);
+    return run;
+}
+
+/*******************************************************************/
+/* Function definition */
+int FacetCacheExport
+(
+void
+)
+/*
+DESCRIPTION:
+   Export the active part to a binary STL file, taking the mesh of every
+unchanged face from the cache. The cache is read from "<file>.zfc" when
+the part was not the last one exported in this session, and written back
+after the export without the meshes of faces that no longer exist.
+
+   Meshes read while the part has modifications not regenerated yet are
+used but not cached, since their faces may still change.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    std::string owner;
+    if (OwnerGet(owner))
+    {
+        cvxMsgDisp("No active part");
+        return 1;
+    }
+    szwRefineFacets refine;
+    RefineGet(&refine);
+
+    char path[PATH_SIZE] = "";
+    cvxGetFileByLongPath(0, "Export STL", "", "STL File (*.stl)|*.stl|", path, PATH_SIZE);
+    if (path[0] == '\0')
+        return 1;
+    const std::string cachePath = std::string(path) + CACHE_SUFFIX;
+
+    std::vector<szwEntityHandle> faces;
+    std::vector<szwEntityHandle *> lists;
+    std::vector<int> counts;
+    if (FaceListGet(faces, lists, counts))
+    {
+        FaceListFree(lists, counts);
+        cvxMsgDisp("No face in the active part");
+        return 1;
+    }
+
+    char message[MESSAGE_SIZE];
+    auto start = std::chrono::steady_clock::now();
+    if (owner != g_cacheOwner)
+    {
+        g_cache.Clear();
+        g_cacheOwner = owner;
+        const int loaded = g_cache.Load(cachePath.c_str(), owner.c_str()) ? 0 : 1;
+        sprintf_s(message, MESSAGE_SIZE, "Cache file %s: %d meshes in %.3f s", loaded ? "read" : "not used",
+            g_cache.Count(), Seconds(start));
+        cvxMsgDisp(message);
+    }
+
+    int modified = 1;
+    cvxRootInqModSinceRegen(&modified);
+
+    FILE *stl = nullptr;
+    if (fopen_s(&stl, path, "wb") || stl == nullptr)
+    {
+        FaceListFree(lists, counts);
+        return 1;
+    }
+    char header[80] = "ZW3D facet cache export";
+    unsigned int triangleCount = 0;
+    fwrite(header, sizeof(header), 1, stl);
+    fwrite(&triangleCount, sizeof(triangleCount), 1, stl);
+
+    g_cache.StatsReset();
+    const CacheRun run = CacheTessellate(faces, refine, !modified, stl);
+    FaceListFree(lists, counts);
+
+    /* the triangle count of the header is known now */
+    triangleCount = (unsigned int)run.triangles;
+    fseek(stl, sizeof(header), SEEK_SET);
+    fwrite(&triangleCount, sizeof(triangleCount), 1, stl);
+    const int failed = ferror(stl) || fclose(stl);
+
+    const int pruned = g_cache.Prune();
+    start = std::chrono::steady_clock::now();
+    const int saveFailed = g_cache.Save(cachePath.c_str(), owner.c_str());
+    const double saveSeconds = Seconds(start);
+
+    const FacetCacheStats &stats = g_cache.Stats();
+    sprintf_s(message, MESSAGE_SIZE, "%d faces: %d cached, %d new, %d changed, %d failed%s", run.faces, stats.hits,
+        stats.misses, stats.stale, run.failed, modified ? " (part not regenerated, nothing cached)" : "");
+    cvxMsgDisp(message);
+    sprintf_s(message, MESSAGE_SIZE, "%lld triangles %s in %.3f s (stamps %.3f s, tessellation %.3f s)",
+        run.triangles, failed ? "NOT written" : "written", run.seconds, run.stampSeconds, run.facetSeconds);
+    cvxMsgDisp(message);
+    sprintf_s(message, MESSAGE_SIZE, "Cache: %d meshes, %.2f MB in memory, %d removed, file %s in %.3f s",
+        g_cache.Count(), g_cache.Bytes() / 1048576.0, pruned, saveFailed ? "NOT saved" : "saved", saveSeconds);
+    cvxMsgDisp(message);
+    return failed || saveFailed;
+}
+
+/*******************************************************************/
+/* Function definition */
+int FacetCacheBench
+(
+void
+)
+/*
+DESCRIPTION:
+   Tessellate all faces of the active part three times: with an empty
+cache (every face tessellated), with the cache in memory, and with the
+cache saved, cleared and read back as a new session would. Then compare
+every cached mesh with fresh facets of ZwFaceFacetsGet() (vertices and
+normals as read from the file).
+
+   The cache of ~FacetCacheExport is cleared.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    std::string owner;
+    if (OwnerGet(owner))
+    {
+        cvxMsgDisp("No active part");
+        return 1;
+    }
+    szwRefineFacets refine;
+    RefineGet(&refine);
+
+    char path[PATH_SIZE] = "";
+    cvxGetFileByLongPath(0, "Cache file of the benchmark", "", "Facet Cache (*.zfc)|*.zfc|", path, PATH_SIZE);
+    if (path[0] == '\0')
+        return 1;
+
+    std::vector<szwEntityHandle> faces;
+    std::vector<szwEntityHandle *> lists;
+    std::vector<int> counts;
+    if (FaceListGet(faces, lists, counts))
+    {
+        FaceListFree(lists, counts);
+        cvxMsgDisp("No face in the active part");
+        return 1;
+    }
+
+    char message[MESSAGE_SIZE];
+    g_cache.Clear();
+    g_cacheOwner = owner;
+    const CacheRun cold = CacheTessellate(faces, refine, 1, nullptr);
+    const CacheRun warm = CacheTessellate(faces, refine, 1, nullptr);
+
+    auto start = std::chrono::steady_clock::now();
+    int failed = g_cache.Save(path, owner.c_str());
+    const double saveSeconds = Seconds(start);
+    FILE *file = nullptr;
+    long long fileBytes = 0;
+    if (!fopen_s(&file, path, "rb") && file != nullptr)
+    {
+        fseek(file, 0, SEEK_END);
+        fileBytes = ftell(file);
+        fclose(file);
+    }
+    const long long memoryBytes = g_cache.Bytes();
+
+    g_cache.Clear();
+    start = std::chrono::steady_clock::now();
+    failed |= g_cache.Load(path, owner.c_str());
+    const double loadSeconds = Seconds(start);
+    const CacheRun disk = CacheTessellate(faces, refine, 1, nullptr);
+
+    sprintf_s(message, MESSAGE_SIZE, "%d faces, %lld triangles", cold.faces, cold.triangles);
+    cvxMsgDisp(message);
+    sprintf_s(message, MESSAGE_SIZE, "Empty cache: %.3f s (stamps %.3f s, tessellation %.3f s)",
+        cold.seconds, cold.stampSeconds, cold.facetSeconds);
+    cvxMsgDisp(message);
+    sprintf_s(message, MESSAGE_SIZE, "Cache in memory: %.3f s, %d faces tessellated, %.1fx faster",
+        warm.seconds, warm.tessellated, warm.seconds > 0.0 ? cold.seconds / warm.seconds : 0.0);
+    cvxMsgDisp(message);
+    sprintf_s(message, MESSAGE_SIZE, "Cache file: save %.3f s, read %.3f s, %.3f s, %d faces tessellated, %.1fx faster",
+        saveSeconds, loadSeconds, disk.seconds, disk.tessellated,
+        disk.seconds + loadSeconds > 0.0 ? cold.seconds / (disk.seconds + loadSeconds) : 0.0);
+    cvxMsgDisp(message);
+    sprintf_s(message, MESSAGE_SIZE, "Cache size: %.2f MB in memory, %.2f MB on disk%s",
+        memoryBytes / 1048576.0, fileBytes / 1048576.0, failed ? ", save or read FAILED" : "");
+    cvxMsgDisp(message);
+
+    /* compare the meshes read from the file with fresh facets */
+    int compared = 0, different = 0;
+    double vertexError = 0.0, normalError = 0.0;
+    for (const szwEntityHandle &face : faces)
+    {
+        std::string uid;
+        const uint64_t stamp = FaceUidGet(face, uid) ? 0 : FaceStamp(face);
+        const FacetCacheMesh *mesh = stamp != 0 ? g_cache.Find(uid, refine, stamp) : nullptr;
+        szwRefineFacets request = refine;
+        request.faceHandle = face;
+        szwFacets facets{};
+        if (mesh == nullptr || ZwFaceFacetsGet(request, &facets))
+            continue;
+
+        szwFacets view;
+        mesh->View(&view);
+        compared++;
+        if (view.numberVertex != facets.numberVertex || view.numberTriangleStrip != facets.numberTriangleStrip ||
+            StlStrips(nullptr, view) != StlStrips(nullptr, facets))
+        {
+            different++;
+            ZwFaceFacetsDataFree(&facets);
+            continue;
+        }
+        for (int v = 0; v < facets.numberVertex; v++)
+        {
+            const float *p = &view.vertex[v].x, *q = &facets.vertex[v].x;
+            for (int k = 0; k < 3; k++)
+                vertexError = fabs(p[k] - q[k]) > vertexError ? fabs(p[k] - q[k]) : vertexError;
+            if (view.normal != nullptr && facets.normal != nullptr)
+            {
+                /* angle from the cross and dot products, acos() of a float dot product is not precise enough */
+                const double m[3] = { view.normal[v].x, view.normal[v].y, view.normal[v].z };
+                const double n[3] = { facets.normal[v].x, facets.normal[v].y, facets.normal[v].z };
+                const double cx = m[1] * n[2] - m[2] * n[1], cy = m[2] * n[0] - m[0] * n[2], cz = m[0] * n[1] - m[1] * n[0];
+                const double angle = atan2(sqrt(cx * cx + cy * cy + cz * cz), m[0] * n[0] + m[1] * n[1] + m[2] * n[2]);
+                normalError = angle > normalError ? angle : normalError;
+            }
+        }
+        ZwFaceFacetsDataFree(&facets);
+    }
+    FaceListFree(lists, counts);
+
+    sprintf_s(message, MESSAGE_SIZE, "Check: %d meshes compared, %d different, vertex error %g, normal error %g rad",
+        compared, different, vertexError, normalError);
+    cvxMsgDisp(message);
+    return failed || different;
+}
@@ -0,0 +1,641 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "..\inc\FacetMeshCache.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define FACET_CACHE_MAGIC "ZWFC"
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: reading position in a loaded file, every read checks the end */
+struct CacheReader
+{
+    const unsigned char *data;
+    size_t size;
+    size_t offset;
+    int failed;
+};
+
+/*******************************************************************/
+/* Function declarations */
+static uint64_t Fnv1a(const void *data, size_t bytes);
+static void PutVarint(std::string &out, uint64_t value);
+static void PutBytes(std::string &out, const void *data, size_t bytes);
+static uint64_t GetVarint(CacheReader &in);
+static void GetBytes(CacheReader &in, void *data, size_t bytes);
+static void NormalEncode(const float *normal, int16_t *code);
+static void NormalDecode(const int16_t *code, float *normal);
+
+/*******************************************************************/
+/* Function definition */
+void FacetCacheMesh::View
+(
+szwFacets *facets   /* O: facets pointing into the mesh, not to be freed */
+) const
+/*
+DESCRIPTION:
+   Fill a szwFacets with pointers to the cached mesh, for code written for
+ZwFaceFacetsGet(). The pointers stay valid until the cache is changed.
+*/
+{
+    memset(facets, 0, sizeof(*facets));
+    facets->numberTriangleStrip = stripCount;
+    facets->triangleStrip = (int *)strips.data();
+    facets->numberVertex = (int)(vertices.size() / 3);
+    facets->vertex = (szwPointf *)vertices.data();
+    facets->normal = normals.empty() ? nullptr : (szwPointf *)normals.data();
+}
+
+/*******************************************************************/
+/* Function definition */
+int FacetCacheMesh::TriangleCount
+(
+void
+) const
+/*
+DESCRIPTION:
+   Number of triangles of all strips.
+*/
+{
+    int triangles = 0;
+    for (int s = 0, i = 0; s < stripCount && i < (int)strips.size(); s++)
+    {
+        triangles += strips[i] > 2 ? strips[i] - 2 : 0;
+        i += strips[i] + 1;
+    }
+    return triangles;
+}
+
+/*******************************************************************/
+/* Function definition */
+long long FacetCacheMesh::Bytes
+(
+void
+) const
+/*
+DESCRIPTION:
+   Memory of the mesh data in bytes.
+*/
+{
+    return (long long)(strips.size() * sizeof(int) + (vertices.size() + normals.size()) * sizeof(float));
+}
+
+/*******************************************************************/
+/* Function definition */
+FacetMeshCache::FacetMeshCache
+(
+)
+/*
+DESCRIPTION:
+   Create an empty cache.
+*/
+{
+    StatsReset();
+}
+
+/*******************************************************************/
+/* Function definition */
+void FacetMeshCache::StatsReset
+(
+void
+)
+/*
+DESCRIPTION:
+   Reset the counters.
+*/
+{
+    memset(&m_stats, 0, sizeof(m_stats));
+}
+
+/*******************************************************************/
+/* Function definition */
+void FacetMeshCache::Clear
+(
+void
+)
+/*
+DESCRIPTION:
+   Remove all meshes.
+*/
+{
+    m_entries.clear();
+}
+
+/*******************************************************************/
+/* Function definition */
+std::string FacetMeshCache::Key
+(
+const std::string &uid,          /* I: unique id of the face */
+const szwRefineFacets &refine    /* I: tessellation settings, the face is ignored */
+)
+/*
+DESCRIPTION:
+   Key of a mesh: the unique id, the tolerance type and the two settings
+used by that type.
+*/
+{
+    double values[2] = { 0.0, 0.0 };
+    if (refine.type == ZW_FACETS_TOLORANCE_DISTANCE)
+    {
+        values[0] = refine.edgeTolorance;
+        values[1] = refine.facetTolorance;
+    }
+    else if (refine.type == ZW_FACETS_TOLORANCE_ANGLE)
+    {
+        values[0] = refine.edgeTolorance;
+        values[1] = refine.angleTolorance;
+    }
+    else
+        values[0] = refine.surfaceTolorance;
+
+    std::string key(uid);
+    key.push_back((char)refine.type);
+    key.append((const char *)values, sizeof(values));
+    return key;
+}
+
+/*******************************************************************/
+/* Function definition */
+const FacetCacheMesh *FacetMeshCache::Find
+(
+const std::string &uid,          /* I: unique id of the face */
+const szwRefineFacets &refine,   /* I: tessellation settings */
+uint64_t stamp                   /* I: stamp of the face now */
+)
+/*
+DESCRIPTION:
+   Mesh of a face if it was stored with the same settings and stamp.
+
+   Return nullptr if the face must be tessellated again.
+*/
+{
+    const auto found = m_entries.find(Key(uid, refine));
+    if (found == m_entries.end())
+    {
+        m_stats.misses++;
+        return nullptr;
+    }
+    found->second.used = 1;
+    if (found->second.stamp != stamp)
+    {
+        m_stats.stale++;
+        return nullptr;
+    }
+    m_stats.hits++;
+    return &found->second.mesh;
+}
+
+/*******************************************************************/
+/* Function definition */
+int FacetMeshCache::Store
+(
+const std::string &uid,          /* I: unique id of the face */
+const szwRefineFacets &refine,   /* I: tessellation settings */
+uint64_t stamp,                  /* I: stamp of the face */
+const szwFacets &facets          /* I: facets of ZwFaceFacetsGet() */
+)
+/*
+DESCRIPTION:
+   Copy the facets of a face into the cache, replacing an older mesh.
+
+   Return 1 if the facets are invalid, else 0.
+*/
+{
+    if (facets.numberVertex < 0 || facets.numberTriangleStrip < 0 ||
+        (facets.numberVertex > 0 && facets.vertex == nullptr) ||
+        (facets.numberTriangleStrip > 0 && facets.triangleStrip == nullptr))
+        return 1;
+
+    /* length of the count-prefixed strip list */
+    size_t ints = 0;
+    for (int s = 0; s < facets.numberTriangleStrip; s++)
+    {
+        const int count = facets.triangleStrip[ints];
+        if (count < 0)
+            return 1;
+        ints += (size_t)count + 1;
+    }
+
+    Entry &entry = m_entries[Key(uid, refine)];
+    entry.stamp = stamp;
+    entry.used = 1;
+    entry.mesh.stripCount = facets.numberTriangleStrip;
+    entry.mesh.strips.assign(facets.triangleStrip, facets.triangleStrip + ints);
+    const float *vertex = (const float *)facets.vertex, *normal = (const float *)facets.normal;
+    entry.mesh.vertices.assign(vertex, vertex + 3 * (size_t)facets.numberVertex);
+    if (normal != nullptr)
+        entry.mesh.normals.assign(normal, normal + 3 * (size_t)facets.numberVertex);
+    else
+        entry.mesh.normals.clear();
+    m_stats.stored++;
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int FacetMeshCache::Prune
+(
+void
+)
+/*
+DESCRIPTION:
+   Remove the meshes not found or stored since the last Prune() (faces
+deleted, or settings no longer used), and start a new round.
+
+   Return the number of meshes removed.
+*/
+{
+    int removed = 0;
+    for (auto entry = m_entries.begin(); entry != m_entries.end();)
+    {
+        if (!entry->second.used)
+        {
+            entry = m_entries.erase(entry);
+            removed++;
+        }
+        else
+        {
+            entry->second.used = 0;
+            ++entry;
+        }
+    }
+    m_stats.pruned += removed;
+    return removed;
+}
+
+/*******************************************************************/
+/* Function definition */
+long long FacetMeshCache::Bytes
+(
+void
+) const
+/*
+DESCRIPTION:
+   Memory of the cached meshes and keys in bytes.
+*/
+{
+    long long bytes = 0;
+    for (const auto &entry : m_entries)
+        bytes += entry.first.size() + sizeof(Entry) + entry.second.mesh.Bytes();
+    return bytes;
+}
+
+/*******************************************************************/
+/* Function definition */
+uint64_t Fnv1a
+(
+const void *data,   /* I: bytes */
+size_t bytes        /* I: number of bytes */
+)
+/*
+DESCRIPTION:
+   64-bit FNV-1a hash, the checksum of the cache file.
+*/
+{
+    const unsigned char *p = (const unsigned char *)data;
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < bytes; i++)
+        hash = (hash ^ p[i]) * 1099511628211ULL;
+    return hash;
+}
+
+/*******************************************************************/
+/* Function definition */
+void PutVarint
+(
+std::string &out,   /* I/O: file data */
+uint64_t value      /* I: value */
+)
+/*
+DESCRIPTION:
+   Append a value 7 bits per byte, low bits first; values below 128 take
+one byte.
+*/
+{
+    while (value >= 0x80)
+    {
+        out.push_back((char)(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back((char)value);
+}
+
+/*******************************************************************/
+/* Function definition */
+void PutBytes
+(
+std::string &out,    /* I/O: file data */
+const void *data,    /* I: bytes */
+size_t bytes         /* I: number of bytes */
+)
+/*
+DESCRIPTION:
+   Append raw bytes (numbers in the byte order of the computer, little
+endian on x64 and ARM64).
+*/
+{
+    out.append((const char *)data, bytes);
+}
+
+/*******************************************************************/
+/* Function definition */
+uint64_t GetVarint
+(
+CacheReader &in   /* I/O: file data */
+)
+/*
+DESCRIPTION:
+   Read a value of PutVarint(), 0 and "failed" set at the end of the data.
+*/
+{
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7)
+    {
+        if (in.offset >= in.size)
+            break;
+        const unsigned char byte = in.data[in.offset++];
+        value |= (uint64_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80))
+            return value;
+    }
+    in.failed = 1;
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void GetBytes
+(
+CacheReader &in,   /* I/O: file data */
+void *data,        /* O: bytes */
+size_t bytes       /* I: number of bytes */
+)
+/*
+DESCRIPTION:
+   Read raw bytes, zeros and "failed" set at the end of the data.
+*/
+{
+    if (in.failed || bytes > in.size - in.offset)
+    {
+        in.failed = 1;
+        memset(data, 0, bytes);
+        return;
+    }
+    memcpy(data, in.data + in.offset, bytes);
+    in.offset += bytes;
+}
+
+/*******************************************************************/
+/* Function definition */
+void NormalEncode
+(
+const float *normal,   /* I: unit normal */
+int16_t *code          /* O: two 16-bit values */
+)
+/*
+DESCRIPTION:
+   Octahedral encoding: the unit sphere is projected on the octahedron
+|x| + |y| + |z| = 1, whose lower half is folded over the upper half,
+then x and y are quantized.
+*/
+{
+    const float length = fabsf(normal[0]) + fabsf(normal[1]) + fabsf(normal[2]);
+    float x = length > 0.0f ? normal[0] / length : 0.0f, y = length > 0.0f ? normal[1] / length : 0.0f;
+    if (length > 0.0f && normal[2] < 0.0f)
+    {
+        const float fx = (1.0f - fabsf(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+        const float fy = (1.0f - fabsf(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+        x = fx;
+        y = fy;
+    }
+    code[0] = (int16_t)lrintf(x * 32767.0f);
+    code[1] = (int16_t)lrintf(y * 32767.0f);
+}
+
+/*******************************************************************/
+/* Function definition */
+void NormalDecode
+(
+const int16_t *code,   /* I: two 16-bit values of NormalEncode() */
+float *normal          /* O: unit normal */
+)
+/*
+DESCRIPTION:
+   Inverse of NormalEncode().
+*/
+{
+    float x = code[0] / 32767.0f, y = code[1] / 32767.0f;
+    const float z = 1.0f - fabsf(x) - fabsf(y);
+    if (z < 0.0f)
+    {
+        const float fx = (1.0f - fabsf(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+        const float fy = (1.0f - fabsf(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+        x = fx;
+        y = fy;
+    }
+    const float length = sqrtf(x * x + y * y + z * z);
+    normal[0] = length > 0.0f ? x / length : 0.0f;
+    normal[1] = length > 0.0f ? y / length : 0.0f;
+    normal[2] = length > 0.0f ? z / length : 1.0f;
+}
+
+/*******************************************************************/
+/* Function definition */
+int FacetMeshCache::Save
+(
+const char *path,    /* I: cache file */
+const char *owner    /* I: file and part the faces belong to */
+) const
+/*
+DESCRIPTION:
+   Write the cache to a file: a temporary file beside it first, renamed
+over the old file once complete, so a failed write keeps the old cache.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    std::string out;
+    PutBytes(out, FACET_CACHE_MAGIC, 4);
+    PutVarint(out, FACET_CACHE_VERSION);
+    PutVarint(out, strlen(owner));
+    PutBytes(out, owner, strlen(owner));
+    PutVarint(out, m_entries.size());
+
+    for (const auto &entry : m_entries)
+    {
+        const FacetCacheMesh &mesh = entry.second.mesh;
+        PutVarint(out, entry.first.size());
+        PutBytes(out, entry.first.data(), entry.first.size());
+        PutBytes(out, &entry.second.stamp, sizeof(uint64_t));
+
+        /* strips: counts as they are, indices as the zigzag difference to the previous index */
+        PutVarint(out, (uint64_t)mesh.stripCount);
+        PutVarint(out, mesh.strips.size());
+        int previous = 0;
+        for (size_t i = 0; i < mesh.strips.size();)
+        {
+            const int count = mesh.strips[i++];
+            PutVarint(out, (uint64_t)count);
+            for (int k = 0; k < count && i < mesh.strips.size(); k++, i++)
+            {
+                const int delta = (int)((uint32_t)mesh.strips[i] - (uint32_t)previous);
+                PutVarint(out, (uint64_t)(((uint32_t)delta << 1) ^ (uint32_t)(delta >> 31)));
+                previous = mesh.strips[i];
+            }
+        }
+
+        const size_t vertexCount = mesh.vertices.size() / 3;
+        PutVarint(out, vertexCount);
+        out.push_back(mesh.normals.empty() ? 0 : 1);
+        PutBytes(out, mesh.vertices.data(), mesh.vertices.size() * sizeof(float));
+        for (size_t v = 0; v < vertexCount && !mesh.normals.empty(); v++)
+        {
+            int16_t code[2];
+            NormalEncode(&mesh.normals[3 * v], code);
+            PutBytes(out, code, sizeof(code));
+        }
+    }
+    const uint64_t checksum = Fnv1a(out.data(), out.size());
+    PutBytes(out, &checksum, sizeof(checksum));
+
+    const std::string temporary = std::string(path) + ".tmp";
+    FILE *file = nullptr;
+    if (fopen_s(&file, temporary.c_str(), "wb") || file == nullptr)
+        return 1;
+    const int written = fwrite(out.data(), 1, out.size(), file) == out.size();
+    if (fclose(file) || !written)
+    {
+        remove(temporary.c_str());
+        return 1;
+    }
+    remove(path);
+    return rename(temporary.c_str(), path) ? 1 : 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int FacetMeshCache::Load
+(
+const char *path,    /* I: cache file */
+const char *owner    /* I: file and part the faces must belong to */
+)
+/*
+DESCRIPTION:
+   Replace the cache by the meshes of a file of Save(). The file is read
+whole and checked before anything is replaced: beside the checksum, the
+strip counts must add up to the stored indices and every index must be a
+stored vertex, as the meshes are handed to the caller as they are.
+
+   Return 1 if the file is missing, damaged, of another version or of
+another owner (the cache is then unchanged), else 0.
+*/
+{
+    FILE *file = nullptr;
+    if (fopen_s(&file, path, "rb") || file == nullptr)
+        return 1;
+    std::vector<unsigned char> data;
+    unsigned char buffer[65536];
+    size_t bytes = 0;
+    while ((bytes = fread(buffer, 1, sizeof(buffer), file)) > 0)
+        data.insert(data.end(), buffer, buffer + bytes);
+    fclose(file);
+
+    uint64_t checksum = 0;
+    if (data.size() < 4 + sizeof(checksum) || memcmp(data.data(), FACET_CACHE_MAGIC, 4))
+        return 1;
+    memcpy(&checksum, data.data() + data.size() - sizeof(checksum), sizeof(checksum));
+    if (checksum != Fnv1a(data.data(), data.size() - sizeof(checksum)))
+        return 1;
+
+    CacheReader in = { data.data(), data.size() - sizeof(checksum), 4, 0 };
+    if (GetVarint(in) != FACET_CACHE_VERSION)
+        return 1;
+    const uint64_t ownerSize = GetVarint(in);
+    if (in.failed || ownerSize != strlen(owner) || ownerSize > in.size - in.offset ||
+        memcmp(in.data + in.offset, owner, (size_t)ownerSize))
+        return 1;
+    in.offset += (size_t)ownerSize;
+
+    std::unordered_map<std::string, Entry> entries;
+    const uint64_t entryCount = GetVarint(in);
+    for (uint64_t e = 0; e < entryCount && !in.failed; e++)
+    {
+        /* every size is checked against the bytes left before anything is allocated */
+        const uint64_t keySize = GetVarint(in);
+        if (keySize > in.size - in.offset)
+            break;
+        std::string key((const char *)in.data + in.offset, (size_t)keySize);
+        in.offset += (size_t)keySize;
+
+        Entry entry;
+        GetBytes(in, &entry.stamp, sizeof(uint64_t));
+        entry.used = 0;
+        FacetCacheMesh &mesh = entry.mesh;
+        const uint64_t stripCount = GetVarint(in);
+        const uint64_t ints = GetVarint(in);
+        if (in.failed || ints > in.size - in.offset || stripCount > ints)
+            break;
+        mesh.stripCount = (int)stripCount;
+        mesh.strips.resize((size_t)ints);
+
+        /* the counts must add up to the stored ints, the indices are checked once the vertex count is read */
+        int previous = 0, lowest = 0, highest = -1;
+        uint64_t strips = 0;
+        for (size_t i = 0; i < mesh.strips.size() && !in.failed; strips++)
+        {
+            const uint64_t count = GetVarint(in);
+            if (count > mesh.strips.size() - i - 1)
+            {
+                in.failed = 1;
+                break;
+            }
+            mesh.strips[i++] = (int)count;
+            for (uint64_t k = 0; k < count; k++, i++)
+            {
+                const uint32_t zigzag = (uint32_t)GetVarint(in);
+                previous = (int)((uint32_t)previous + ((zigzag >> 1) ^ (0u - (zigzag & 1))));
+                mesh.strips[i] = previous;
+                lowest = previous < lowest ? previous : lowest;
+                highest = previous > highest ? previous : highest;
+            }
+        }
+        if (in.failed || strips != stripCount)
+            break;
+
+        const uint64_t vertexCount = GetVarint(in);
+        unsigned char hasNormals = 0;
+        GetBytes(in, &hasNormals, 1);
+        const uint64_t vertexBytes = vertexCount * 3 * sizeof(float);
+        if (in.failed || vertexCount > in.size || vertexBytes > in.size - in.offset || lowest < 0 ||
+            (highest >= 0 && (uint64_t)highest >= vertexCount))
+            break;
+        mesh.vertices.resize((size_t)vertexCount * 3);
+        GetBytes(in, mesh.vertices.data(), (size_t)vertexBytes);
+        if (hasNormals)
+        {
+            if (vertexCount * 4 > in.size - in.offset)
+                break;
+            mesh.normals.resize((size_t)vertexCount * 3);
+            for (size_t v = 0; v < vertexCount; v++)
+            {
+                int16_t code[2];
+                GetBytes(in, code, sizeof(code));
+                NormalDecode(code, &mesh.normals[3 * v]);
+            }
+        }
+        entries[key] = std::move(entry);
+    }
+    if (in.failed || entries.size() != entryCount || in.offset != in.size)
+        return 1;
+
+    m_entries.swap(entries);
+    return 0;
+}
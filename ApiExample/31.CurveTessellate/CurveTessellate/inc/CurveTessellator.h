@@ -0,0 +1,106 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+#pragma once
+
+/* ZW3D API includes */
+#include "zwapi_util.h"
+
+/* Application includes */
+#include <vector>
+#include "NurbsCurveEval.h"
+#include "WorkPool.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define CURVE_TESS_MAX_DEPTH 24          /* halvings of a parameter interval at most */
+#define CURVE_TESS_MAX_ANGLE 1.5707963267948966   /* largest arc step (radian), also for loose tolerances */
+#define CURVE_TESS_GRAIN 16              /* curves taken at a time by a pool worker */
+#define CURVE_TESS_SAFETY 0.9            /* NURBS pieces are accepted within this part of the chord tolerance */
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: tolerances of ZwCurveTessellationPointListGet() */
+struct CurveTessTolerance
+{
+    double chord;      /* largest distance between the curve and a segment */
+    double length;     /* largest segment length, 0 for no limit */
+};
+
+/*
+DESCRIPTION:
+   Polylines of all curves in one buffer: the points of curve i are
+points[offsets[i]] to points[offsets[i + 1] - 1]. A curve that could not
+be tessellated has no point.
+*/
+struct CurvePolylines
+{
+    std::vector<svxPoint> points;
+    std::vector<int> offsets;        /* curve count + 1 entries */
+
+    int Count(void) const { return offsets.empty() ? 0 : (int)offsets.size() - 1; }
+    int PointCount(int curve) const { return offsets[curve + 1] - offsets[curve]; }
+    const svxPoint *Points(int curve) const { return points.data() + offsets[curve]; }
+};
+
+/*
+DESCRIPTION:
+   Host-independent tessellator of curve data read once with
+cvxPartInqCurve(): lines, arcs and circles from their analytic data,
+NURBS curves with the batch evaluator (NurbsCurveEval.h). The curves can
+then be tessellated any number of times, with any tolerances, without a
+host call.
+
+   Lines are cut evenly to respect the length tolerance. Arcs get the
+even angle step whose sagitta R (1 - cos(step / 2)) is within the chord
+tolerance. A NURBS curve is cut at its knots, each knot span into
+"degree" pieces so no inflection is missed, and every piece is halved
+until the curve points at 1/4, 1/2 and 3/4 of it are within 0.9 of the
+chord tolerance of its segment (the sampled distance can be a little
+below the largest one) and the segment is within the length tolerance.
+
+   Tessellate() runs the curves on a WorkPool: each worker writes its
+polylines into its own buffer, then they are copied into one buffer in
+curve order. The tessellator is immutable after Add() and may be shared
+by threads.
+*/
+class CurveTessellator
+{
+public:
+    CurveTessellator();
+
+    int Add(const svxCurve &curve);
+    void Clear(void);
+    int Count(void) const { return (int)m_curves.size(); }
+
+    int Tessellate(const CurveTessTolerance &tolerance, WorkPool *pool, CurvePolylines *polylines) const;
+    int TessellateCurve(int curve, const CurveTessTolerance &tolerance, std::vector<svxPoint> &points) const;
+
+private:
+    /* curve data in world space */
+    struct Curve
+    {
+        evxCurveType type;
+        svxPoint start, end;          /* line */
+        svxPoint center;              /* arc and circle */
+        svxVector xAxis, yAxis;       /* arc plane, angle 0 on xAxis */
+        double radius;
+        double angle;                 /* start angle (radian) */
+        double sweep;                 /* swept angle (radian), 2 pi for circles */
+        int nurbs;                    /* index in m_nurbs, -1 if none */
+        std::vector<double> breaks;   /* distinct knots inside the domain, ends included */
+    };
+
+    static void TaskRun(void *data, int begin, int end, int worker);
+    void LineTessellate(const Curve &curve, const CurveTessTolerance &tolerance, std::vector<svxPoint> &points) const;
+    void ArcTessellate(const Curve &curve, const CurveTessTolerance &tolerance, std::vector<svxPoint> &points) const;
+    void NurbsTessellate(const Curve &curve, const CurveTessTolerance &tolerance, std::vector<svxPoint> &points) const;
+
+    std::vector<Curve> m_curves;
+    std::vector<NurbsCurveEvaluator> m_nurbs;
+};
+
+/* Function declaration */
+double CurveTessSegmentDistance(const svxPoint &point, const svxPoint &a, const svxPoint &b);
+double CurveTessPolylineDistance(const svxPoint &point, int count, const svxPoint *polyline);
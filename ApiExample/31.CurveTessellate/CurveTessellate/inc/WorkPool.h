@@ -0,0 +1,96 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+#pragma once
+
+/* Application includes */
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*******************************************************************/
+/* Constant definitions */
+#define WORK_POOL_MAX_THREADS 64     /* more workers than this are not started */
+
+/*******************************************************************/
+/* Data type definitions */
+/*
+DESCRIPTION:
+   Work of one range of items [begin, end), run by worker "worker" (0 is
+the thread that called Run(), so per-worker buffers can be indexed with
+it). The task must not call Run() of the same pool.
+*/
+typedef void (*WorkPoolTask)(void *data, int begin, int end, int worker);
+
+/* DESCRIPTION: counters of the last Run() */
+struct WorkPoolStats
+{
+    int chunks;        /* ranges given to the task */
+    int steals;        /* ranges taken from another worker */
+    int workers;       /* workers that ran at least one range */
+};
+
+/*
+DESCRIPTION:
+   Pool of threads running a loop over items whose cost varies, such as
+curves of different types or faces of different sizes.
+
+   Run() gives each worker an equal part of the items. A worker takes
+"grain" items at a time from the front of its part; a worker whose part
+is done steals the back half of what is left of another worker's part,
+so expensive items are shared without a central queue and each worker
+mostly walks neighbouring items.
+
+   The threads are started once and wait between runs; one pool can be
+kept by an add-on for all its commands. Run() is not reentrant: calls
+from several threads must be serialized by the caller.
+*/
+class WorkPool
+{
+public:
+    explicit WorkPool(int threads = 0);
+    ~WorkPool();
+
+    void Run(int count, int grain, WorkPoolTask task, void *data);
+
+    int ThreadCount(void) const { return (int)m_threads.size() + 1; }
+    const WorkPoolStats &Stats(void) const { return m_stats; }
+
+private:
+    WorkPool(const WorkPool &);
+    WorkPool &operator=(const WorkPool &);
+
+    /* remaining items of one worker, on its own cache line */
+    struct alignas(64) Slot
+    {
+        std::mutex lock;
+        int begin;
+        int end;
+        int chunks;
+        int steals;
+    };
+
+    void ThreadMain(int worker);
+    void Work(int worker);
+    int Take(int worker, int *begin, int *end);
+    int Steal(int worker);
+
+    std::vector<std::thread> m_threads;
+    std::vector<Slot> m_slots;
+
+    std::mutex m_lock;
+    std::condition_variable m_start;     /* signaled when a run begins or the pool stops */
+    std::condition_variable m_done;      /* signaled when the last thread leaves a run */
+    long long m_generation;              /* number of runs started */
+    int m_running;                       /* threads still in the current run */
+    int m_stop;
+
+    std::atomic<int> m_pending;          /* items not done yet in the current run */
+    int m_grain;
+    WorkPoolTask m_task;
+    void *m_data;
+    WorkPoolStats m_stats;
+};
@@ -0,0 +1,352 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* ZW3D API includes */
+#include "zwapi_curve.h"
+#include "zwapi_entity.h"
+#include "zwapi_part_objs.h"
+#include "zwapi_userinput.h"
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+#include "..\inc\CurveTessellatePr.h"
+#include "..\inc\CurveTessellator.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define MESSAGE_SIZE 256
+#define BENCH_DEFAULT_EXPORTS 10     /* tessellations of every curve in ~CurveTessellateBench */
+
+/*******************************************************************/
+/* Function declarations */
+static int CurveTessellateCheck(void);
+static int CurveTessellateBench(void);
+static int ToleranceGet(CurveTessTolerance *tolerance);
+static int CurvesLoad(int count, const szwEntityHandle *curves, CurveTessellator *tessellator,
+    std::vector<int> &index, int *calls);
+static int HostTessellate(const szwEntityHandle &curve, const CurveTessTolerance &tolerance,
+    std::vector<svxPoint> &points);
+static double Seconds(std::chrono::steady_clock::time_point start);
+
+/*******************************************************************/
+/* Function definition */
+int RegisterCurveTessellate
+(
+void
+)
+/*
+DESCRIPTION:
+   Register the commands of the curve tessellation example.
+*/
+{
+    /* Compare the local tessellation with ZwCurveTessellationPointListGet() by entering "~CurveTessellateCheck" */
+    ZwCommandFunctionLoad("CurveTessellateCheck", (void *)CurveTessellateCheck, ZW_LICENSE_CODE_GENERAL);
+
+    /* Time repeated tessellations of many curves by entering "~CurveTessellateBench" */
+    ZwCommandFunctionLoad("CurveTessellateBench", (void *)CurveTessellateBench, ZW_LICENSE_CODE_GENERAL);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int UnloadCurveTessellate
+(
+void
+)
+/*
+DESCRIPTION:
+   Unload the commands of the curve tessellation example.
+*/
+{
+    ZwCommandFunctionUnload("CurveTessellateCheck");
+    ZwCommandFunctionUnload("CurveTessellateBench");
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+double Seconds
+(
+std::chrono::steady_clock::time_point start   /* I: start time */
+)
+/*
+DESCRIPTION:
+   Seconds elapsed since "start".
+*/
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*******************************************************************/
+/* Function definition */
+int ToleranceGet
+(
+CurveTessTolerance *tolerance   /* O: chord and length tolerances */
+)
+/*
+DESCRIPTION:
+   Ask for the chord height and segment length tolerances.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    double number = 0.01;
+    if (cvxGetNumber("Chord height tolerance", &number) || !(number > 0.0))
+        number = 0.01;
+    tolerance->chord = number;
+
+    number = 0.0;
+    if (cvxGetNumber("Segment length tolerance (0 for none)", &number) || number < 0.0)
+        number = 0.0;
+    tolerance->length = number;
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int CurvesLoad
+(
+int count,                         /* I: number of curves */
+const szwEntityHandle *curves,     /* I: curves or edges */
+CurveTessellator *tessellator,     /* O: tessellator holding the curves read */
+std::vector<int> &index,           /* O: per curve, index in the tessellator or -1 */
+int *calls                         /* O: number of host calls */
+)
+/*
+DESCRIPTION:
+   Read the data of the curves into a tessellator, with one call for all
+ids and two per curve.
+
+   Return 1 if no curve was read, else 0.
+*/
+{
+    std::vector<int> ids(count);
+    index.assign(count, -1);
+    *calls = 1;
+    if (ZwEntityIdGet(count, curves, ids.data()))
+        return 1;
+
+    int loaded = 0;
+    for (int i = 0; i < count; i++)
+    {
+        svxCurve curve{};
+        (*calls)++;
+        if (cvxPartInqCurve(ids[i], 0, &curve))
+            continue;
+        index[i] = tessellator->Add(curve);
+        loaded += index[i] >= 0 ? 1 : 0;
+        cvxCurveFree(&curve);
+        (*calls)++;
+    }
+    return loaded > 0 ? 0 : 1;
+}
+
+/*******************************************************************/
+/* Function definition */
+int HostTessellate
+(
+const szwEntityHandle &curve,            /* I: curve or edge */
+const CurveTessTolerance &tolerance,     /* I: tolerances */
+std::vector<svxPoint> &points            /* O: points of the host */
+)
+/*
+DESCRIPTION:
+   Tessellate one curve with ZwCurveTessellationPointListGet().
+
+   Return 1 if function fails, else 0.
+*/
+{
+    int count = 0;
+    szwPoint *list = nullptr;
+    points.clear();
+    if (ZwCurveTessellationPointListGet(curve, tolerance.chord, tolerance.length, &count, &list))
+        return 1;
+    points.assign((svxPoint *)list, (svxPoint *)list + count);
+    ZwMemoryFree((void **)&list);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int CurveTessellateCheck
+(
+void
+)
+/*
+DESCRIPTION:
+   Tessellate the picked curves locally and with the host, and report
+the largest distance from the points of each to the polyline of the
+other, and the longest local segment. Both are within the chord
+tolerance of the same curve, so they must agree within twice of it.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    int count = 0;
+    szwEntityHandle *curves = nullptr;
+    if (ZwEntityListGetByPick("Select curves or edges to check", ZW_INPUT_EDGE_OR_CURVE, 0, &count, &curves))
+        return 1;
+    CurveTessTolerance tolerance;
+    ToleranceGet(&tolerance);
+
+    CurveTessellator tessellator;
+    std::vector<int> index;
+    int calls = 0;
+    CurvePolylines polylines;
+    if (CurvesLoad(count, curves, &tessellator, index, &calls) ||
+        tessellator.Tessellate(tolerance, nullptr, &polylines))
+    {
+        ZwEntityHandleListFree(count, &curves);
+        cvxMsgDisp("No supported curve");
+        return 1;
+    }
+
+    int checked = 0, failed = 0, localPoints = 0, hostPoints = 0;
+    double localToHost = 0.0, hostToLocal = 0.0, longest = 0.0;
+    std::vector<svxPoint> host;
+    for (int i = 0; i < count; i++)
+    {
+        if (index[i] < 0 || HostTessellate(curves[i], tolerance, host) || host.empty())
+            continue;
+        const int n = polylines.PointCount(index[i]);
+        const svxPoint *local = polylines.Points(index[i]);
+        double curveError = 0.0;
+        for (int k = 0; k < n; k++)
+        {
+            const double d = CurveTessPolylineDistance(local[k], (int)host.size(), host.data());
+            curveError = d > curveError ? d : curveError;
+            localToHost = d > localToHost ? d : localToHost;
+            if (k > 0)
+            {
+                const double dx = local[k].x - local[k - 1].x, dy = local[k].y - local[k - 1].y;
+                const double dz = local[k].z - local[k - 1].z, length = sqrt(dx * dx + dy * dy + dz * dz);
+                longest = length > longest ? length : longest;
+            }
+        }
+        for (const svxPoint &point : host)
+        {
+            const double d = CurveTessPolylineDistance(point, n, local);
+            curveError = d > curveError ? d : curveError;
+            hostToLocal = d > hostToLocal ? d : hostToLocal;
+        }
+        checked++;
+        localPoints += n;
+        hostPoints += (int)host.size();
+        failed += curveError > 2.0 * tolerance.chord + 1.0e-9 ? 1 : 0;
+    }
+    ZwEntityHandleListFree(count, &curves);
+
+    char message[MESSAGE_SIZE];
+    sprintf_s(message, MESSAGE_SIZE, "%d curves checked, %d not supported, %d outside twice the chord tolerance",
+        checked, count - tessellator.Count(), failed);
+    cvxMsgDisp(message);
+    sprintf_s(message, MESSAGE_SIZE, "Points: %d local, %d host; distance local to host %g, host to local %g",
+        localPoints, hostPoints, localToHost, hostToLocal);
+    cvxMsgDisp(message);
+    sprintf_s(message, MESSAGE_SIZE, "Longest local segment %g (length tolerance %g)", longest, tolerance.length);
+    cvxMsgDisp(message);
+    return failed ? 1 : 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int CurveTessellateBench
+(
+void
+)
+/*
+DESCRIPTION:
+   Tessellate the picked curves a number of times, as several exporters
+or exports of the same sheet would: with one host call per curve and
+export, and with the curve data read once and tessellated locally on one
+thread and on the pool. The exports use tolerances from 1 to 1/2 of the
+one entered, so no result can be reused.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    int count = 0;
+    szwEntityHandle *curves = nullptr;
+    if (ZwEntityListGetByPick("Select curves or edges to benchmark", ZW_INPUT_EDGE_OR_CURVE, 0, &count, &curves))
+        return 1;
+    CurveTessTolerance tolerance;
+    ToleranceGet(&tolerance);
+    double number = BENCH_DEFAULT_EXPORTS;
+    if (cvxGetNumber("Number of exports", &number) || number < 1.0)
+        number = BENCH_DEFAULT_EXPORTS;
+    const int exports = (int)number;
+
+    /* host: one tessellation call and one free per curve and export */
+    auto start = std::chrono::steady_clock::now();
+    long long hostPoints = 0, hostCalls = 0;
+    for (int e = 0; e < exports; e++)
+    {
+        const double scale = 1.0 - 0.5 * e / exports;
+        for (int i = 0; i < count; i++)
+        {
+            int n = 0;
+            szwPoint *list = nullptr;
+            hostCalls++;
+            if (ZwCurveTessellationPointListGet(curves[i], tolerance.chord * scale, tolerance.length * scale, &n, &list))
+                continue;
+            hostPoints += n;
+            ZwMemoryFree((void **)&list);
+            hostCalls++;
+        }
+    }
+    const double hostTime = Seconds(start);
+
+    /* local: read once, tessellate each export */
+    start = std::chrono::steady_clock::now();
+    CurveTessellator tessellator;
+    std::vector<int> index;
+    int calls = 0;
+    const int loadFailed = CurvesLoad(count, curves, &tessellator, index, &calls);
+    const double loadTime = Seconds(start);
+    ZwEntityHandleListFree(count, &curves);
+    if (loadFailed)
+    {
+        cvxMsgDisp("No supported curve");
+        return 1;
+    }
+
+    WorkPool pool;
+    CurvePolylines polylines;
+    double serialTime = 0.0, poolTime = 0.0;
+    long long localPoints = 0;
+    int steals = 0;
+    for (int e = 0; e < exports; e++)
+    {
+        const double scale = 1.0 - 0.5 * e / exports;
+        const CurveTessTolerance step = { tolerance.chord * scale, tolerance.length * scale };
+        start = std::chrono::steady_clock::now();
+        tessellator.Tessellate(step, nullptr, &polylines);
+        serialTime += Seconds(start);
+
+        start = std::chrono::steady_clock::now();
+        tessellator.Tessellate(step, &pool, &polylines);
+        poolTime += Seconds(start);
+        localPoints += (long long)polylines.points.size();
+        steals += pool.Stats().steals;
+    }
+
+    char message[MESSAGE_SIZE];
+    sprintf_s(message, MESSAGE_SIZE, "%d curves (%d supported), %d exports", count, tessellator.Count(), exports);
+    cvxMsgDisp(message);
+    sprintf_s(message, MESSAGE_SIZE, "Host: %.3f s, %lld calls, %lld points", hostTime, hostCalls, hostPoints);
+    cvxMsgDisp(message);
+    sprintf_s(message, MESSAGE_SIZE, "Local: read %.3f s with %d calls (%.1fx fewer), %lld points",
+        loadTime, calls, calls > 0 ? (double)hostCalls / calls : 0.0, localPoints);
+    cvxMsgDisp(message);
+    sprintf_s(message, MESSAGE_SIZE, "Local tessellation: 1 thread %.3f s, %d threads %.3f s (%d steals), total %.1fx faster",
+        serialTime, pool.ThreadCount(), poolTime, steals,
+        loadTime + poolTime > 0.0 ? hostTime / (loadTime + poolTime) : 0.0);
+    cvxMsgDisp(message);
+    return 0;
+}
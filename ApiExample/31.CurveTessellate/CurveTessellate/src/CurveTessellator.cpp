@@ -0,0 +1,485 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* Application includes */
+#include <string.h>
+#include <math.h>
+#include "..\inc\CurveTessellator.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define CURVE_TESS_PI 3.14159265358979323846
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: data of the two passes of Tessellate() */
+struct CurveTessRun
+{
+    const CurveTessellator *tessellator;
+    const CurveTessTolerance *tolerance;
+    std::vector<std::vector<svxPoint>> *buffers;   /* one per worker */
+    std::vector<int> *worker;                      /* per curve, worker that tessellated it */
+    std::vector<int> *start;                       /* per curve, first point in that worker's buffer */
+    CurvePolylines *polylines;
+};
+
+/* DESCRIPTION: halving step of a NURBS piece */
+struct CurveTessPiece
+{
+    double t0, t1;
+    svxPoint p0, p1;
+    int depth;
+};
+
+/*******************************************************************/
+/* Function declarations */
+static void CopyRun(void *data, int begin, int end, int worker);
+
+/*******************************************************************/
+/* Function definition */
+double CurveTessSegmentDistance
+(
+const svxPoint &point,   /* I: point */
+const svxPoint &a,       /* I: segment start */
+const svxPoint &b        /* I: segment end */
+)
+/*
+DESCRIPTION:
+   Distance from a point to a segment.
+*/
+{
+    const double d[3] = { b.x - a.x, b.y - a.y, b.z - a.z };
+    const double v[3] = { point.x - a.x, point.y - a.y, point.z - a.z };
+    const double dd = d[0] * d[0] + d[1] * d[1] + d[2] * d[2];
+    double s = dd > 0.0 ? (v[0] * d[0] + v[1] * d[1] + v[2] * d[2]) / dd : 0.0;
+    s = s < 0.0 ? 0.0 : (s > 1.0 ? 1.0 : s);
+    const double e[3] = { v[0] - s * d[0], v[1] - s * d[1], v[2] - s * d[2] };
+    return sqrt(e[0] * e[0] + e[1] * e[1] + e[2] * e[2]);
+}
+
+/*******************************************************************/
+/* Function definition */
+double CurveTessPolylineDistance
+(
+const svxPoint &point,      /* I: point */
+int count,                  /* I: number of polyline points, at least 1 */
+const svxPoint *polyline    /* I: polyline points */
+)
+/*
+DESCRIPTION:
+   Distance from a point to a polyline.
+*/
+{
+    if (count == 1)
+        return CurveTessSegmentDistance(point, polyline[0], polyline[0]);
+    double best = HUGE_VAL;
+    for (int i = 0; i + 1 < count; i++)
+    {
+        const double d = CurveTessSegmentDistance(point, polyline[i], polyline[i + 1]);
+        best = d < best ? d : best;
+    }
+    return best;
+}
+
+/*******************************************************************/
+/* Function definition */
+CurveTessellator::CurveTessellator
+(
+)
+/*
+DESCRIPTION:
+   Create an empty tessellator.
+*/
+{
+}
+
+/*******************************************************************/
+/* Function definition */
+void CurveTessellator::Clear
+(
+void
+)
+/*
+DESCRIPTION:
+   Remove all curves.
+*/
+{
+    m_curves.clear();
+    m_nurbs.clear();
+}
+
+/*******************************************************************/
+/* Function definition */
+int CurveTessellator::Add
+(
+const svxCurve &curve   /* I: curve data of cvxPartInqCurve() */
+)
+/*
+DESCRIPTION:
+   Copy the data of a curve. Arcs and circles with a frame have their
+center at the frame origin and lie in its XY plane; without a frame
+(identity) they are 2D curves centered at P1. Angles are in degrees.
+
+   Return the index of the curve, or -1 if the curve type or its data is
+not supported.
+*/
+{
+    Curve item;
+    item.type = curve.Type;
+    item.start = curve.P1;
+    item.end = curve.P2;
+    item.center = curve.P1;
+    item.xAxis.x = 1.0;
+    item.xAxis.y = item.xAxis.z = 0.0;
+    item.yAxis.y = 1.0;
+    item.yAxis.x = item.yAxis.z = 0.0;
+    item.radius = curve.R;
+    item.angle = curve.A1 * CURVE_TESS_PI / 180.0;
+    item.sweep = 0.0;
+    item.nurbs = -1;
+
+    switch (curve.Type)
+    {
+    case VX_CRV_LINE:
+        break;
+
+    case VX_CRV_ARC:
+    case VX_CRV_CIRCLE:
+        if (!(curve.R > 0.0))
+            return -1;
+        if (!curve.Frame.identity)
+        {
+            item.center.x = curve.Frame.xt;
+            item.center.y = curve.Frame.yt;
+            item.center.z = curve.Frame.zt;
+            item.xAxis.x = curve.Frame.xx;
+            item.xAxis.y = curve.Frame.yx;
+            item.xAxis.z = curve.Frame.zx;
+            item.yAxis.x = curve.Frame.xy;
+            item.yAxis.y = curve.Frame.yy;
+            item.yAxis.z = curve.Frame.zy;
+        }
+        if (curve.Type == VX_CRV_CIRCLE)
+            item.sweep = 2.0 * CURVE_TESS_PI;
+        else
+        {
+            double sweep = curve.A2 - curve.A1;
+            while (sweep <= 0.0)
+                sweep += 360.0;
+            item.sweep = (sweep > 360.0 ? 360.0 : sweep) * CURVE_TESS_PI / 180.0;
+        }
+        break;
+
+    case VX_CRV_NURB:
+    {
+        NurbsCurveEvaluator evaluator;
+        if (evaluator.Init(curve))
+            return -1;
+        const svxLimit domain = evaluator.Domain();
+        item.breaks.push_back(domain.min);
+        for (int i = 0; i < curve.T.num_knots; i++)
+        {
+            const double knot = curve.T.knots[i];
+            if (knot > item.breaks.back() && knot < domain.max)
+                item.breaks.push_back(knot);
+        }
+        item.breaks.push_back(domain.max);
+        item.nurbs = (int)m_nurbs.size();
+        m_nurbs.push_back(evaluator);
+        break;
+    }
+
+    default:
+        return -1;
+    }
+
+    m_curves.push_back(item);
+    return (int)m_curves.size() - 1;
+}
+
+/*******************************************************************/
+/* Function definition */
+void CurveTessellator::LineTessellate
+(
+const Curve &curve,                       /* I: line */
+const CurveTessTolerance &tolerance,      /* I: tolerances */
+std::vector<svxPoint> &points             /* I/O: points are added */
+) const
+/*
+DESCRIPTION:
+   Cut a line into even segments within the length tolerance.
+*/
+{
+    const double d[3] = { curve.end.x - curve.start.x, curve.end.y - curve.start.y, curve.end.z - curve.start.z };
+    const double length = sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+    const int segments = tolerance.length > 0.0 && length > tolerance.length ?
+        (int)ceil(length / tolerance.length) : 1;
+
+    points.push_back(curve.start);
+    for (int i = 1; i < segments; i++)
+    {
+        const double s = (double)i / segments;
+        svxPoint p = { curve.start.x + s * d[0], curve.start.y + s * d[1], curve.start.z + s * d[2] };
+        points.push_back(p);
+    }
+    points.push_back(curve.end);
+}
+
+/*******************************************************************/
+/* Function definition */
+void CurveTessellator::ArcTessellate
+(
+const Curve &curve,                       /* I: arc or circle */
+const CurveTessTolerance &tolerance,      /* I: tolerances */
+std::vector<svxPoint> &points             /* I/O: points are added */
+) const
+/*
+DESCRIPTION:
+   Cut an arc into even angle steps within the chord and length
+tolerances.
+*/
+{
+    double step = CURVE_TESS_MAX_ANGLE;
+    if (tolerance.chord > 0.0 && tolerance.chord < curve.radius)
+    {
+        const double chordStep = 2.0 * acos(1.0 - tolerance.chord / curve.radius);
+        step = chordStep < step ? chordStep : step;
+    }
+    if (tolerance.length > 0.0)
+    {
+        /* chord length 2 R sin(step / 2) within the length tolerance */
+        const double half = tolerance.length / (2.0 * curve.radius);
+        const double lengthStep = half < 1.0 ? 2.0 * asin(half) : CURVE_TESS_PI;
+        step = lengthStep < step ? lengthStep : step;
+    }
+    int segments = (int)ceil(curve.sweep / step - 1.0e-9);
+    segments = segments < 1 ? 1 : segments;
+    if (curve.type == VX_CRV_CIRCLE && segments < 3)
+        segments = 3;
+
+    const size_t first = points.size();
+    for (int i = 0; i <= segments; i++)
+    {
+        const double a = curve.angle + curve.sweep * i / segments;
+        const double c = curve.radius * cos(a), s = curve.radius * sin(a);
+        svxPoint p = { curve.center.x + c * curve.xAxis.x + s * curve.yAxis.x,
+            curve.center.y + c * curve.xAxis.y + s * curve.yAxis.y,
+            curve.center.z + c * curve.xAxis.z + s * curve.yAxis.z };
+        points.push_back(p);
+    }
+    if (curve.type == VX_CRV_CIRCLE)
+        points.back() = points[first];
+}
+
+/*******************************************************************/
+/* Function definition */
+void CurveTessellator::NurbsTessellate
+(
+const Curve &curve,                       /* I: NURBS curve */
+const CurveTessTolerance &tolerance,      /* I: tolerances */
+std::vector<svxPoint> &points             /* I/O: points are added */
+) const
+/*
+DESCRIPTION:
+   Cut a NURBS curve at its knots, each knot span into "degree" pieces,
+and halve the pieces until they are within the tolerances.
+*/
+{
+    const NurbsCurveEvaluator &evaluator = m_nurbs[curve.nurbs];
+    const int pieces = evaluator.Degree() > 1 ? evaluator.Degree() : 1;
+    const double chord = tolerance.chord > 0.0 ? CURVE_TESS_SAFETY * tolerance.chord : HUGE_VAL;
+    const double length2 = tolerance.length > 0.0 ? tolerance.length * tolerance.length : HUGE_VAL;
+
+    svxPoint p0;
+    evaluator.EvaluatePoints(1, &curve.breaks[0], &p0);
+    points.push_back(p0);
+
+    std::vector<CurveTessPiece> stack;
+    for (size_t k = 0; k + 1 < curve.breaks.size(); k++)
+    {
+        const double k0 = curve.breaks[k], k1 = curve.breaks[k + 1];
+        for (int j = 0; j < pieces; j++)
+        {
+            CurveTessPiece piece;
+            piece.t0 = k0 + (k1 - k0) * j / pieces;
+            piece.t1 = j + 1 == pieces ? k1 : k0 + (k1 - k0) * (j + 1) / pieces;
+            piece.p0 = points.back();
+            evaluator.EvaluatePoints(1, &piece.t1, &piece.p1);
+            piece.depth = 0;
+            stack.push_back(piece);
+
+            while (!stack.empty())
+            {
+                const CurveTessPiece top = stack.back();
+                stack.pop_back();
+
+                const double dt = top.t1 - top.t0;
+                const double t[3] = { top.t0 + 0.25 * dt, top.t0 + 0.5 * dt, top.t0 + 0.75 * dt };
+                svxPoint q[3];
+                evaluator.EvaluatePoints(3, t, q);
+                const double dx = top.p1.x - top.p0.x, dy = top.p1.y - top.p0.y, dz = top.p1.z - top.p0.z;
+                double error = 0.0;
+                for (int i = 0; i < 3; i++)
+                {
+                    const double e = CurveTessSegmentDistance(q[i], top.p0, top.p1);
+                    error = e > error ? e : error;
+                }
+
+                if (top.depth >= CURVE_TESS_MAX_DEPTH ||
+                    (error <= chord && dx * dx + dy * dy + dz * dz <= length2))
+                {
+                    points.push_back(top.p1);
+                    continue;
+                }
+
+                /* right half first, so the left half is done next */
+                CurveTessPiece half;
+                half.depth = top.depth + 1;
+                half.t0 = t[1];
+                half.t1 = top.t1;
+                half.p0 = q[1];
+                half.p1 = top.p1;
+                stack.push_back(half);
+                half.t0 = top.t0;
+                half.t1 = t[1];
+                half.p0 = top.p0;
+                half.p1 = q[1];
+                stack.push_back(half);
+            }
+        }
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+int CurveTessellator::TessellateCurve
+(
+int curve,                                /* I: index of the curve */
+const CurveTessTolerance &tolerance,      /* I: tolerances */
+std::vector<svxPoint> &points             /* O: polyline */
+) const
+/*
+DESCRIPTION:
+   Tessellate one curve.
+
+   Return 1 if the index is invalid, else 0.
+*/
+{
+    points.clear();
+    if (curve < 0 || curve >= Count())
+        return 1;
+
+    const Curve &item = m_curves[curve];
+    if (item.type == VX_CRV_LINE)
+        LineTessellate(item, tolerance, points);
+    else if (item.type == VX_CRV_NURB)
+        NurbsTessellate(item, tolerance, points);
+    else
+        ArcTessellate(item, tolerance, points);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void CurveTessellator::TaskRun
+(
+void *data,    /* I: CurveTessRun */
+int begin,     /* I: first curve */
+int end,       /* I: end of the range */
+int worker     /* I: worker */
+)
+/*
+DESCRIPTION:
+   First pass of Tessellate(): tessellate curves into the worker's
+buffer.
+*/
+{
+    CurveTessRun *run = (CurveTessRun *)data;
+    const CurveTessellator *self = run->tessellator;
+    std::vector<svxPoint> &buffer = (*run->buffers)[worker];
+    for (int i = begin; i < end; i++)
+    {
+        const Curve &item = self->m_curves[i];
+        (*run->worker)[i] = worker;
+        (*run->start)[i] = (int)buffer.size();
+        if (item.type == VX_CRV_LINE)
+            self->LineTessellate(item, *run->tolerance, buffer);
+        else if (item.type == VX_CRV_NURB)
+            self->NurbsTessellate(item, *run->tolerance, buffer);
+        else
+            self->ArcTessellate(item, *run->tolerance, buffer);
+        run->polylines->offsets[i + 1] = (int)buffer.size() - (*run->start)[i];
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+void CopyRun
+(
+void *data,    /* I: CurveTessRun */
+int begin,     /* I: first curve */
+int end,       /* I: end of the range */
+int /* worker */ /* I: unused */
+)
+/*
+DESCRIPTION:
+   Second pass of Tessellate(): copy polylines into the output buffer.
+*/
+{
+    CurveTessRun *run = (CurveTessRun *)data;
+    CurvePolylines *polylines = run->polylines;
+    for (int i = begin; i < end; i++)
+    {
+        const std::vector<svxPoint> &buffer = (*run->buffers)[(*run->worker)[i]];
+        const int count = polylines->offsets[i + 1] - polylines->offsets[i];
+        if (count > 0)
+            memcpy(&polylines->points[polylines->offsets[i]], &buffer[(*run->start)[i]], count * sizeof(svxPoint));
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+int CurveTessellator::Tessellate
+(
+const CurveTessTolerance &tolerance,   /* I: tolerances */
+WorkPool *pool,                        /* I: pool running the curves, nullptr for this thread only */
+CurvePolylines *polylines              /* O: polylines of all curves */
+) const
+/*
+DESCRIPTION:
+   Tessellate all curves into one buffer. The polyline of a curve starts
+and ends at the curve ends, a circle is closed.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    if (polylines == nullptr || !(tolerance.chord > 0.0) || tolerance.length < 0.0)
+        return 1;
+
+    const int count = Count();
+    const int workers = pool != nullptr ? pool->ThreadCount() : 1;
+    std::vector<std::vector<svxPoint>> buffers(workers);
+    std::vector<int> worker(count), start(count);
+    CurveTessRun run = { this, &tolerance, &buffers, &worker, &start, polylines };
+    polylines->offsets.assign((size_t)count + 1, 0);
+
+    if (pool != nullptr)
+        pool->Run(count, CURVE_TESS_GRAIN, TaskRun, &run);
+    else
+        TaskRun(&run, 0, count, 0);
+
+    /* point counts to offsets */
+    std::vector<int> &offsets = polylines->offsets;
+    offsets[0] = 0;
+    for (int i = 0; i < count; i++)
+        offsets[i + 1] += offsets[i];
+
+    polylines->points.resize(offsets[count]);
+    if (pool != nullptr)
+        pool->Run(count, 4 * CURVE_TESS_GRAIN, CopyRun, &run);
+    else
+        CopyRun(&run, 0, count, 0);
+    return 0;
+}
@@ -0,0 +1,242 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* Application includes */
+#include <string.h>
+#include "WorkPool.h"
+
+/*******************************************************************/
+/* Function definition */
+WorkPool::WorkPool
+(
+int threads   /* I: number of workers, caller included, 0 for one per hardware thread */
+)
+/*
+DESCRIPTION:
+   Start the worker threads of the pool.
+*/
+: m_generation(0), m_running(0), m_stop(0), m_pending(0), m_grain(1), m_task(nullptr), m_data(nullptr)
+{
+    if (threads <= 0)
+        threads = (int)std::thread::hardware_concurrency();
+    if (threads < 1)
+        threads = 1;
+    if (threads > WORK_POOL_MAX_THREADS)
+        threads = WORK_POOL_MAX_THREADS;
+
+    memset(&m_stats, 0, sizeof(m_stats));
+    m_slots = std::vector<Slot>(threads);
+    for (Slot &slot : m_slots)
+        slot.begin = slot.end = slot.chunks = slot.steals = 0;
+    for (int i = 1; i < threads; i++)
+        m_threads.emplace_back(&WorkPool::ThreadMain, this, i);
+}
+
+/*******************************************************************/
+/* Function definition */
+WorkPool::~WorkPool
+(
+)
+/*
+DESCRIPTION:
+   Stop and join the worker threads.
+*/
+{
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        m_stop = 1;
+    }
+    m_start.notify_all();
+    for (std::thread &thread : m_threads)
+        thread.join();
+}
+
+/*******************************************************************/
+/* Function definition */
+void WorkPool::Run
+(
+int count,           /* I: number of items */
+int grain,           /* I: items taken at a time, at least 1 */
+WorkPoolTask task,   /* I: work of a range of items */
+void *data           /* I: data given to the task */
+)
+/*
+DESCRIPTION:
+   Run a task over items 0 to count - 1 on all workers and return when
+every item is done. The calling thread works as worker 0.
+*/
+{
+    memset(&m_stats, 0, sizeof(m_stats));
+    if (count <= 0 || task == nullptr)
+        return;
+    grain = grain < 1 ? 1 : grain;
+
+    /* one worker, or not enough items to share: no thread is woken */
+    const int workers = ThreadCount();
+    if (workers == 1 || count <= grain)
+    {
+        task(data, 0, count, 0);
+        m_stats.chunks = m_stats.workers = 1;
+        return;
+    }
+
+    for (int w = 0; w < workers; w++)
+    {
+        Slot &slot = m_slots[w];
+        std::lock_guard<std::mutex> guard(slot.lock);
+        slot.begin = (int)((long long)count * w / workers);
+        slot.end = (int)((long long)count * (w + 1) / workers);
+        slot.chunks = slot.steals = 0;
+    }
+    m_grain = grain;
+    m_task = task;
+    m_data = data;
+    m_pending.store(count);
+
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        m_generation++;
+        m_running = (int)m_threads.size();
+    }
+    m_start.notify_all();
+
+    Work(0);
+
+    std::unique_lock<std::mutex> guard(m_lock);
+    m_done.wait(guard, [this] { return m_running == 0; });
+    for (const Slot &slot : m_slots)
+    {
+        m_stats.chunks += slot.chunks;
+        m_stats.steals += slot.steals;
+        m_stats.workers += slot.chunks > 0 ? 1 : 0;
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+void WorkPool::ThreadMain
+(
+int worker   /* I: index of the worker */
+)
+/*
+DESCRIPTION:
+   Loop of a worker thread: wait for a run, work, report the end.
+*/
+{
+    long long seen = 0;
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> guard(m_lock);
+            m_start.wait(guard, [this, seen] { return m_stop || m_generation != seen; });
+            if (m_stop)
+                return;
+            seen = m_generation;
+        }
+
+        Work(worker);
+
+        std::lock_guard<std::mutex> guard(m_lock);
+        if (--m_running == 0)
+            m_done.notify_all();
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+void WorkPool::Work
+(
+int worker   /* I: index of the worker */
+)
+/*
+DESCRIPTION:
+   Run ranges of the worker's part, then of stolen parts, until no item
+is left in the run.
+*/
+{
+    for (;;)
+    {
+        int begin = 0, end = 0;
+        if (Take(worker, &begin, &end))
+        {
+            m_task(m_data, begin, end, worker);
+            m_slots[worker].chunks++;
+            m_pending.fetch_sub(end - begin);
+            continue;
+        }
+        if (Steal(worker))
+            continue;
+
+        /* nothing to take: the last ranges are being run by other workers */
+        if (m_pending.load() == 0)
+            return;
+        std::this_thread::yield();
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+int WorkPool::Take
+(
+int worker,   /* I: index of the worker */
+int *begin,   /* O: first item */
+int *end      /* O: end of the range */
+)
+/*
+DESCRIPTION:
+   Take "grain" items from the front of the worker's part.
+
+   Return 1 if items were taken, else 0.
+*/
+{
+    Slot &slot = m_slots[worker];
+    std::lock_guard<std::mutex> guard(slot.lock);
+    if (slot.begin >= slot.end)
+        return 0;
+    *begin = slot.begin;
+    *end = slot.end - slot.begin > m_grain ? slot.begin + m_grain : slot.end;
+    slot.begin = *end;
+    return 1;
+}
+
+/*******************************************************************/
+/* Function definition */
+int WorkPool::Steal
+(
+int worker   /* I: index of the worker, its part is empty */
+)
+/*
+DESCRIPTION:
+   Move the back half of another worker's part (all of it if no more
+than "grain" items are left) to the worker's part. The other workers are
+visited in turn from the next one, so thieves spread over the victims.
+
+   Return 1 if items were stolen, else 0.
+*/
+{
+    const int workers = ThreadCount();
+    for (int k = 1; k < workers; k++)
+    {
+        Slot &victim = m_slots[(worker + k) % workers];
+        int begin = 0, end = 0;
+        {
+            std::lock_guard<std::mutex> guard(victim.lock);
+            const int left = victim.end - victim.begin;
+            if (left <= 0)
+                continue;
+            end = victim.end;
+            begin = left > m_grain ? victim.end - left / 2 : victim.begin;
+            victim.end = begin;
+        }
+
+        Slot &slot = m_slots[worker];
+        std::lock_guard<std::mutex> guard(slot.lock);
+        slot.begin = begin;
+        slot.end = end;
+        slot.steals++;
+        return 1;
+    }
+    return 0;
+}
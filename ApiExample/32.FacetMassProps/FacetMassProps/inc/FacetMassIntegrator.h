@@ -0,0 +1,115 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+#pragma once
+
+/* ZW3D API includes */
+#include "zwapi_util.h"
+#include "zwapi_brep_data.h"
+
+/* Application includes */
+#include <vector>
+#include "WorkPool.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define FACET_MASS_BLOCK 2048        /* triangles per work item and partial sum */
+#define FACET_MASS_TERMS 11          /* integrals summed per triangle */
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: summation kernel */
+enum FacetMassKernel
+{
+    FacetMass_Scalar = 0,  /* one triangle at a time, compensated */
+    FacetMass_Simd = 1,    /* four triangles per AVX2 instruction, else two per SSE2 or NEON, compensated */
+    FacetMass_Plain = 2,   /* one triangle at a time, not compensated (for comparison) */
+};
+
+/*
+DESCRIPTION:
+   Volume integrals of one shape, relative to its reference point.
+*/
+struct FacetMassSums
+{
+    svxPoint reference;      /* point the coordinates are taken from */
+    double area;
+    double volume;
+    double first[3];         /* integral of x, y, z */
+    double second[6];        /* integral of xx, yy, zz, xy, yz, zx */
+    int triangles;
+};
+
+/*
+DESCRIPTION:
+   Mass properties of closed facet meshes by the divergence theorem:
+every triangle forms a tetrahedron with the reference point of its shape,
+and the signed volume, first and second moments of these tetrahedra sum
+to those of the solid. The integrals depend only on the mesh, so any
+number of densities costs one integration.
+
+   The triangles of all shapes are kept as floats relative to the center
+of their shape's box (so the second moments do not lose digits to the
+distance from the origin), and summed in doubles. Blocks of
+FACET_MASS_BLOCK triangles are the work items of the pool; each block is
+summed with Kahan compensation (with the SIMD kernel, four triangles per
+instruction on a cpu with AVX2, chosen at run time by
+NurbsEvalKernelDetect() of 21.BatchCurveEval, else two with SSE2 or
+NEON), then the blocks of a shape are added in order with compensation
+too, so the result does not depend on the number of threads. The
+compensation needs strict floating point (not /fp:fast).
+
+   MassProp() fills the svxMassProp layout: Im holds Ixx, Iyy, Izz, Ixy,
+Iyz, Izx of the inertia tensor at the centroid (products of inertia
+negative, -integral of xy dm), Ip the principal moments in increasing
+order with their axes in Axis (right-handed), Rad the radii of gyration.
+A mesh with inward normals (negative volume) is taken as if reversed.
+*/
+class FacetMassIntegrator
+{
+public:
+    FacetMassIntegrator();
+
+    int AddShape(int count, const szwFacets *facets);
+    void Clear(void);
+    int ShapeCount(void) const { return (int)m_shapes.size(); }
+    int TriangleCount(void) const { return (int)m_x[0].size(); }
+
+    int Integrate(WorkPool *pool, FacetMassKernel kernel);
+    const FacetMassSums &Sums(int shape) const { return m_shapes[shape].sums; }
+    int MassProp(int shape, double density, svxMassProp *prop) const;
+    const char *SimdName(void) const;
+
+private:
+    struct Shape
+    {
+        int first;                 /* first triangle */
+        int end;                   /* end of its triangles */
+        int firstBlock;            /* first block */
+        FacetMassSums sums;
+    };
+
+    /* compensated sums of one block, FACET_MASS_TERMS of each */
+    struct Block
+    {
+        int first;
+        int end;
+        double sum[FACET_MASS_TERMS];
+        double error[FACET_MASS_TERMS];
+    };
+
+    static void BlockRun(void *data, int begin, int end, int worker);
+    void BlockScalar(Block &block, int compensated) const;
+    void BlockSimd(Block &block) const;
+    void BlockAvx2(Block &block) const;
+
+    std::vector<float> m_x[3], m_y[3], m_z[3];   /* corner k of each triangle */
+    std::vector<Shape> m_shapes;
+    std::vector<Block> m_blocks;
+    FacetMassKernel m_kernel;                    /* kernel of the running Integrate() */
+    int m_avx2;                                  /* 1 if the SIMD kernel runs on AVX2 */
+};
+
+/* Function declaration */
+int FacetMassPrincipal(const double *tensor, double *moments, svxVector *axes);
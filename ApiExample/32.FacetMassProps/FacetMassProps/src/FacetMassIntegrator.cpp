@@ -0,0 +1,668 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* Application includes */
+#include <math.h>
+#include <float.h>
+#include <string.h>
+#include "..\inc\FacetMassIntegrator.h"
+#include "NurbsCurveEval.h"
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define FACET_MASS_SSE 1
+#include <immintrin.h>
+#elif defined(_M_ARM64) || defined(__aarch64__)
+#define FACET_MASS_NEON 1
+#include <arm_neon.h>
+#endif
+
+/* MSVC accepts AVX2 intrinsics in any function, gcc/clang need the target attribute */
+#if defined(FACET_MASS_SSE) && (defined(__GNUC__) || defined(__clang__))
+#define FACET_MASS_AVX2_TARGET __attribute__((target("avx2")))
+#else
+#define FACET_MASS_AVX2_TARGET
+#endif
+
+/*******************************************************************/
+/* Constant definitions */
+#define JACOBI_SWEEPS 50             /* sweeps of the eigen solver at most */
+
+/*******************************************************************/
+/* Data type definitions */
+/*
+DESCRIPTION:
+   Two doubles (D2) with the operations of the SIMD kernel. Load2() takes
+two floats and widens them.
+*/
+#if defined(FACET_MASS_SSE)
+typedef __m128d D2;
+static inline D2 D2Zero(void) { return _mm_setzero_pd(); }
+static inline D2 D2Load2(const float *p) { return _mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64((const __m128i *)p))); }
+static inline D2 D2Add(D2 a, D2 b) { return _mm_add_pd(a, b); }
+static inline D2 D2Sub(D2 a, D2 b) { return _mm_sub_pd(a, b); }
+static inline D2 D2Mul(D2 a, D2 b) { return _mm_mul_pd(a, b); }
+static inline D2 D2Sqrt(D2 a) { return _mm_sqrt_pd(a); }
+static inline void D2Store(double *p, D2 a) { _mm_storeu_pd(p, a); }
+#elif defined(FACET_MASS_NEON)
+typedef float64x2_t D2;
+static inline D2 D2Zero(void) { return vdupq_n_f64(0.0); }
+static inline D2 D2Load2(const float *p) { return vcvt_f64_f32(vld1_f32(p)); }
+static inline D2 D2Add(D2 a, D2 b) { return vaddq_f64(a, b); }
+static inline D2 D2Sub(D2 a, D2 b) { return vsubq_f64(a, b); }
+static inline D2 D2Mul(D2 a, D2 b) { return vmulq_f64(a, b); }
+static inline D2 D2Sqrt(D2 a) { return vsqrtq_f64(a); }
+static inline void D2Store(double *p, D2 a) { vst1q_f64(p, a); }
+#endif
+
+/*
+DESCRIPTION:
+   Four doubles (D4) of the AVX2 kernel, in functions compiled for AVX2
+and only called on a cpu having it. Load4() takes four floats and widens
+them.
+*/
+#if defined(FACET_MASS_SSE)
+typedef __m256d D4;
+FACET_MASS_AVX2_TARGET static inline D4 D4Zero(void) { return _mm256_setzero_pd(); }
+FACET_MASS_AVX2_TARGET static inline D4 D4Load4(const float *p) { return _mm256_cvtps_pd(_mm_loadu_ps(p)); }
+FACET_MASS_AVX2_TARGET static inline D4 D4Add(D4 a, D4 b) { return _mm256_add_pd(a, b); }
+FACET_MASS_AVX2_TARGET static inline D4 D4Sub(D4 a, D4 b) { return _mm256_sub_pd(a, b); }
+FACET_MASS_AVX2_TARGET static inline D4 D4Mul(D4 a, D4 b) { return _mm256_mul_pd(a, b); }
+FACET_MASS_AVX2_TARGET static inline D4 D4Sqrt(D4 a) { return _mm256_sqrt_pd(a); }
+FACET_MASS_AVX2_TARGET static inline void D4Store(double *p, D4 a) { _mm256_storeu_pd(p, a); }
+#endif
+
+/*******************************************************************/
+/* Function declarations */
+static inline void KahanAdd(double *sum, double *error, double value);
+
+/*******************************************************************/
+/* Function definition */
+inline void KahanAdd
+(
+double *sum,     /* I/O: running sum */
+double *error,   /* I/O: low-order part lost by the sum (subtracted) */
+double value     /* I: value to add */
+)
+/*
+DESCRIPTION:
+   Compensated (Kahan) addition; the exact total is sum - error.
+*/
+{
+    const double y = value - *error;
+    const double t = *sum + y;
+    *error = (t - *sum) - y;
+    *sum = t;
+}
+
+/*******************************************************************/
+/* Function definition */
+FacetMassIntegrator::FacetMassIntegrator
+(
+)
+/*
+DESCRIPTION:
+   Create an empty integrator.
+*/
+: m_kernel(FacetMass_Simd), m_avx2(NurbsEvalKernelDetect() == NurbsEval_Avx2)
+{
+}
+
+/*******************************************************************/
+/* Function definition */
+void FacetMassIntegrator::Clear
+(
+void
+)
+/*
+DESCRIPTION:
+   Remove all shapes.
+*/
+{
+    for (int k = 0; k < 3; k++)
+    {
+        m_x[k].clear();
+        m_y[k].clear();
+        m_z[k].clear();
+    }
+    m_shapes.clear();
+    m_blocks.clear();
+}
+
+/*******************************************************************/
+/* Function definition */
+int FacetMassIntegrator::AddShape
+(
+int count,                  /* I: number of faces */
+const szwFacets *facets     /* I: facets of the faces of one closed shape */
+)
+/*
+DESCRIPTION:
+   Copy the triangles of the faces of a shape. Strips are read as in
+ZwFaceFacetsGet(): every second triangle of a strip is reversed, so all
+triangles keep the orientation of the face. Triangles with a repeated or
+invalid vertex are skipped.
+
+   Return the index of the shape, or -1 if the facets are invalid.
+*/
+{
+    if (count < 0 || (count > 0 && facets == nullptr))
+        return -1;
+
+    /* box center of all vertices, the reference point */
+    double low[3] = { DBL_MAX, DBL_MAX, DBL_MAX }, high[3] = { -DBL_MAX, -DBL_MAX, -DBL_MAX };
+    for (int f = 0; f < count; f++)
+    {
+        if (facets[f].numberVertex > 0 && facets[f].vertex == nullptr)
+            return -1;
+        for (int v = 0; v < facets[f].numberVertex; v++)
+        {
+            const float *p = &facets[f].vertex[v].x;
+            for (int k = 0; k < 3; k++)
+            {
+                low[k] = p[k] < low[k] ? p[k] : low[k];
+                high[k] = p[k] > high[k] ? p[k] : high[k];
+            }
+        }
+    }
+    Shape shape;
+    memset(&shape.sums, 0, sizeof(shape.sums));
+    if (low[0] <= high[0])
+    {
+        shape.sums.reference.x = 0.5 * (low[0] + high[0]);
+        shape.sums.reference.y = 0.5 * (low[1] + high[1]);
+        shape.sums.reference.z = 0.5 * (low[2] + high[2]);
+    }
+    const double *reference = &shape.sums.reference.x;
+    shape.first = TriangleCount();
+
+    for (int f = 0; f < count; f++)
+    {
+        const szwFacets &face = facets[f];
+        const int *s = face.triangleStrip;
+        if (face.numberTriangleStrip > 0 && s == nullptr)
+            continue;
+        for (int k = 0; k < face.numberTriangleStrip; k++)
+        {
+            const int n = *s++;
+            for (int j = 0; j + 2 < n; j++)
+            {
+                const int corner[3] = { s[(j & 1) ? j + 1 : j], s[(j & 1) ? j : j + 1], s[j + 2] };
+                if (corner[0] == corner[1] || corner[1] == corner[2] || corner[2] == corner[0] ||
+                    corner[0] < 0 || corner[1] < 0 || corner[2] < 0 || corner[0] >= face.numberVertex ||
+                    corner[1] >= face.numberVertex || corner[2] >= face.numberVertex)
+                    continue;
+                for (int c = 0; c < 3; c++)
+                {
+                    const szwPointf &p = face.vertex[corner[c]];
+                    m_x[c].push_back((float)(p.x - reference[0]));
+                    m_y[c].push_back((float)(p.y - reference[1]));
+                    m_z[c].push_back((float)(p.z - reference[2]));
+                }
+            }
+            s += n > 0 ? n : 0;
+        }
+    }
+    shape.end = TriangleCount();
+    shape.sums.triangles = shape.end - shape.first;
+
+    /* blocks never span two shapes */
+    shape.firstBlock = (int)m_blocks.size();
+    for (int first = shape.first; first < shape.end; first += FACET_MASS_BLOCK)
+    {
+        Block block;
+        memset(&block, 0, sizeof(block));
+        block.first = first;
+        block.end = shape.end - first > FACET_MASS_BLOCK ? first + FACET_MASS_BLOCK : shape.end;
+        m_blocks.push_back(block);
+    }
+    m_shapes.push_back(shape);
+    return (int)m_shapes.size() - 1;
+}
+
+/*******************************************************************/
+/* Function definition */
+void FacetMassIntegrator::BlockScalar
+(
+Block &block,      /* I/O: block, its sums are set */
+int compensated    /* I: 1 for Kahan summation */
+) const
+/*
+DESCRIPTION:
+   Sum the integrals of the triangles of a block one at a time. For a
+triangle (a, b, c) and the reference point o, with v6 = a . (b x c) six
+times the signed volume of the tetrahedron and s = a + b + c:
+   volume        v6 / 6
+   integral x    v6 sx / 24
+   integral xx   v6 (sx sx + ax ax + bx bx + cx cx) / 120
+   integral xy   v6 (sx sy + ax ay + bx by + cx cy) / 120
+The divisions are done once per shape; this sums |(b - a) x (c - a)|,
+v6, v6 s, v6 (s s + a a + b b + c c) for the 6 products.
+*/
+{
+    memset(block.sum, 0, sizeof(block.sum));
+    memset(block.error, 0, sizeof(block.error));
+    for (int i = block.first; i < block.end; i++)
+    {
+        const double ax = m_x[0][i], ay = m_y[0][i], az = m_z[0][i];
+        const double bx = m_x[1][i], by = m_y[1][i], bz = m_z[1][i];
+        const double cx = m_x[2][i], cy = m_y[2][i], cz = m_z[2][i];
+
+        const double ux = bx - ax, uy = by - ay, uz = bz - az, wx = cx - ax, wy = cy - ay, wz = cz - az;
+        const double nx = uy * wz - uz * wy, ny = uz * wx - ux * wz, nz = ux * wy - uy * wx;
+        const double v6 = ax * (by * cz - bz * cy) + ay * (bz * cx - bx * cz) + az * (bx * cy - by * cx);
+        const double sx = ax + bx + cx, sy = ay + by + cy, sz = az + bz + cz;
+
+        double term[FACET_MASS_TERMS];
+        term[0] = sqrt(nx * nx + ny * ny + nz * nz);
+        term[1] = v6;
+        term[2] = v6 * sx;
+        term[3] = v6 * sy;
+        term[4] = v6 * sz;
+        term[5] = v6 * (sx * sx + ax * ax + bx * bx + cx * cx);
+        term[6] = v6 * (sy * sy + ay * ay + by * by + cy * cy);
+        term[7] = v6 * (sz * sz + az * az + bz * bz + cz * cz);
+        term[8] = v6 * (sx * sy + ax * ay + bx * by + cx * cy);
+        term[9] = v6 * (sy * sz + ay * az + by * bz + cy * cz);
+        term[10] = v6 * (sz * sx + az * ax + bz * bx + cz * cx);
+
+        if (compensated)
+        {
+            for (int k = 0; k < FACET_MASS_TERMS; k++)
+                KahanAdd(&block.sum[k], &block.error[k], term[k]);
+        }
+        else
+        {
+            for (int k = 0; k < FACET_MASS_TERMS; k++)
+                block.sum[k] += term[k];
+        }
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+void FacetMassIntegrator::BlockSimd
+(
+Block &block   /* I/O: block, its sums are set */
+) const
+/*
+DESCRIPTION:
+   BlockScalar() for two triangles at a time, each lane keeping its own
+compensated sums; the lanes and an odd last triangle are added at the
+end.
+*/
+{
+#if defined(FACET_MASS_SSE) || defined(FACET_MASS_NEON)
+    D2 sum[FACET_MASS_TERMS], error[FACET_MASS_TERMS];
+    for (int k = 0; k < FACET_MASS_TERMS; k++)
+        sum[k] = error[k] = D2Zero();
+
+    int i = block.first;
+    for (; i + 1 < block.end; i += 2)
+    {
+        const D2 ax = D2Load2(&m_x[0][i]), ay = D2Load2(&m_y[0][i]), az = D2Load2(&m_z[0][i]);
+        const D2 bx = D2Load2(&m_x[1][i]), by = D2Load2(&m_y[1][i]), bz = D2Load2(&m_z[1][i]);
+        const D2 cx = D2Load2(&m_x[2][i]), cy = D2Load2(&m_y[2][i]), cz = D2Load2(&m_z[2][i]);
+
+        const D2 ux = D2Sub(bx, ax), uy = D2Sub(by, ay), uz = D2Sub(bz, az);
+        const D2 wx = D2Sub(cx, ax), wy = D2Sub(cy, ay), wz = D2Sub(cz, az);
+        const D2 nx = D2Sub(D2Mul(uy, wz), D2Mul(uz, wy));
+        const D2 ny = D2Sub(D2Mul(uz, wx), D2Mul(ux, wz));
+        const D2 nz = D2Sub(D2Mul(ux, wy), D2Mul(uy, wx));
+        const D2 v6 = D2Add(D2Add(D2Mul(ax, D2Sub(D2Mul(by, cz), D2Mul(bz, cy))),
+            D2Mul(ay, D2Sub(D2Mul(bz, cx), D2Mul(bx, cz)))), D2Mul(az, D2Sub(D2Mul(bx, cy), D2Mul(by, cx))));
+        const D2 sx = D2Add(D2Add(ax, bx), cx), sy = D2Add(D2Add(ay, by), cy), sz = D2Add(D2Add(az, bz), cz);
+
+        D2 term[FACET_MASS_TERMS];
+        term[0] = D2Sqrt(D2Add(D2Add(D2Mul(nx, nx), D2Mul(ny, ny)), D2Mul(nz, nz)));
+        term[1] = v6;
+        term[2] = D2Mul(v6, sx);
+        term[3] = D2Mul(v6, sy);
+        term[4] = D2Mul(v6, sz);
+        term[5] = D2Mul(v6, D2Add(D2Add(D2Mul(sx, sx), D2Mul(ax, ax)), D2Add(D2Mul(bx, bx), D2Mul(cx, cx))));
+        term[6] = D2Mul(v6, D2Add(D2Add(D2Mul(sy, sy), D2Mul(ay, ay)), D2Add(D2Mul(by, by), D2Mul(cy, cy))));
+        term[7] = D2Mul(v6, D2Add(D2Add(D2Mul(sz, sz), D2Mul(az, az)), D2Add(D2Mul(bz, bz), D2Mul(cz, cz))));
+        term[8] = D2Mul(v6, D2Add(D2Add(D2Mul(sx, sy), D2Mul(ax, ay)), D2Add(D2Mul(bx, by), D2Mul(cx, cy))));
+        term[9] = D2Mul(v6, D2Add(D2Add(D2Mul(sy, sz), D2Mul(ay, az)), D2Add(D2Mul(by, bz), D2Mul(cy, cz))));
+        term[10] = D2Mul(v6, D2Add(D2Add(D2Mul(sz, sx), D2Mul(az, ax)), D2Add(D2Mul(bz, bx), D2Mul(cz, cx))));
+
+        for (int k = 0; k < FACET_MASS_TERMS; k++)
+        {
+            const D2 y = D2Sub(term[k], error[k]);
+            const D2 t = D2Add(sum[k], y);
+            error[k] = D2Sub(D2Sub(t, sum[k]), y);
+            sum[k] = t;
+        }
+    }
+
+    /* the odd triangle, then the two lanes */
+    Block last = block;
+    last.first = i;
+    BlockScalar(last, 1);
+    for (int k = 0; k < FACET_MASS_TERMS; k++)
+    {
+        double s[2], e[2];
+        D2Store(s, sum[k]);
+        D2Store(e, error[k]);
+        block.sum[k] = last.sum[k];
+        block.error[k] = last.error[k];
+        KahanAdd(&block.sum[k], &block.error[k], s[0] - e[0]);
+        KahanAdd(&block.sum[k], &block.error[k], s[1] - e[1]);
+    }
+#else
+    BlockScalar(block, 1);
+#endif
+}
+
+/*******************************************************************/
+/* Function definition */
+FACET_MASS_AVX2_TARGET void FacetMassIntegrator::BlockAvx2
+(
+Block &block   /* I/O: block, its sums are set */
+) const
+/*
+DESCRIPTION:
+   BlockSimd() for four triangles at a time, on a cpu with AVX2 only; the
+lanes and the last triangles are added at the end.
+*/
+{
+#if defined(FACET_MASS_SSE)
+    D4 sum[FACET_MASS_TERMS], error[FACET_MASS_TERMS];
+    for (int k = 0; k < FACET_MASS_TERMS; k++)
+        sum[k] = error[k] = D4Zero();
+
+    int i = block.first;
+    for (; i + 3 < block.end; i += 4)
+    {
+        const D4 ax = D4Load4(&m_x[0][i]), ay = D4Load4(&m_y[0][i]), az = D4Load4(&m_z[0][i]);
+        const D4 bx = D4Load4(&m_x[1][i]), by = D4Load4(&m_y[1][i]), bz = D4Load4(&m_z[1][i]);
+        const D4 cx = D4Load4(&m_x[2][i]), cy = D4Load4(&m_y[2][i]), cz = D4Load4(&m_z[2][i]);
+
+        const D4 ux = D4Sub(bx, ax), uy = D4Sub(by, ay), uz = D4Sub(bz, az);
+        const D4 wx = D4Sub(cx, ax), wy = D4Sub(cy, ay), wz = D4Sub(cz, az);
+        const D4 nx = D4Sub(D4Mul(uy, wz), D4Mul(uz, wy));
+        const D4 ny = D4Sub(D4Mul(uz, wx), D4Mul(ux, wz));
+        const D4 nz = D4Sub(D4Mul(ux, wy), D4Mul(uy, wx));
+        const D4 v6 = D4Add(D4Add(D4Mul(ax, D4Sub(D4Mul(by, cz), D4Mul(bz, cy))),
+            D4Mul(ay, D4Sub(D4Mul(bz, cx), D4Mul(bx, cz)))), D4Mul(az, D4Sub(D4Mul(bx, cy), D4Mul(by, cx))));
+        const D4 sx = D4Add(D4Add(ax, bx), cx), sy = D4Add(D4Add(ay, by), cy), sz = D4Add(D4Add(az, bz), cz);
+
+        D4 term[FACET_MASS_TERMS];
+        term[0] = D4Sqrt(D4Add(D4Add(D4Mul(nx, nx), D4Mul(ny, ny)), D4Mul(nz, nz)));
+        term[1] = v6;
+        term[2] = D4Mul(v6, sx);
+        term[3] = D4Mul(v6, sy);
+        term[4] = D4Mul(v6, sz);
+        term[5] = D4Mul(v6, D4Add(D4Add(D4Mul(sx, sx), D4Mul(ax, ax)), D4Add(D4Mul(bx, bx), D4Mul(cx, cx))));
+        term[6] = D4Mul(v6, D4Add(D4Add(D4Mul(sy, sy), D4Mul(ay, ay)), D4Add(D4Mul(by, by), D4Mul(cy, cy))));
+        term[7] = D4Mul(v6, D4Add(D4Add(D4Mul(sz, sz), D4Mul(az, az)), D4Add(D4Mul(bz, bz), D4Mul(cz, cz))));
+        term[8] = D4Mul(v6, D4Add(D4Add(D4Mul(sx, sy), D4Mul(ax, ay)), D4Add(D4Mul(bx, by), D4Mul(cx, cy))));
+        term[9] = D4Mul(v6, D4Add(D4Add(D4Mul(sy, sz), D4Mul(ay, az)), D4Add(D4Mul(by, bz), D4Mul(cy, cz))));
+        term[10] = D4Mul(v6, D4Add(D4Add(D4Mul(sz, sx), D4Mul(az, ax)), D4Add(D4Mul(bz, bx), D4Mul(cz, cx))));
+
+        for (int k = 0; k < FACET_MASS_TERMS; k++)
+        {
+            const D4 y = D4Sub(term[k], error[k]);
+            const D4 t = D4Add(sum[k], y);
+            error[k] = D4Sub(D4Sub(t, sum[k]), y);
+            sum[k] = t;
+        }
+    }
+
+    /* the last triangles, then the four lanes */
+    Block last = block;
+    last.first = i;
+    BlockScalar(last, 1);
+    for (int k = 0; k < FACET_MASS_TERMS; k++)
+    {
+        double s[4], e[4];
+        D4Store(s, sum[k]);
+        D4Store(e, error[k]);
+        block.sum[k] = last.sum[k];
+        block.error[k] = last.error[k];
+        for (int lane = 0; lane < 4; lane++)
+            KahanAdd(&block.sum[k], &block.error[k], s[lane] - e[lane]);
+    }
+#else
+    BlockSimd(block);
+#endif
+}
+
+/*******************************************************************/
+/* Function definition */
+void FacetMassIntegrator::BlockRun
+(
+void *data,    /* I: integrator */
+int begin,     /* I: first block */
+int end,       /* I: end of the range */
+int /* worker */ /* I: unused */
+)
+/*
+DESCRIPTION:
+   Sum a range of blocks with the kernel of the running Integrate().
+*/
+{
+    FacetMassIntegrator *self = (FacetMassIntegrator *)data;
+    for (int b = begin; b < end; b++)
+    {
+        Block &block = self->m_blocks[b];
+        if (self->m_kernel == FacetMass_Simd && self->m_avx2)
+            self->BlockAvx2(block);
+        else if (self->m_kernel == FacetMass_Simd)
+            self->BlockSimd(block);
+        else
+            self->BlockScalar(block, self->m_kernel == FacetMass_Scalar);
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+int FacetMassIntegrator::Integrate
+(
+WorkPool *pool,            /* I: pool running the blocks, nullptr for this thread only */
+FacetMassKernel kernel     /* I: summation kernel */
+)
+/*
+DESCRIPTION:
+   Compute the integrals of all shapes.
+
+   Return 1 if there is no triangle, else 0.
+*/
+{
+    if (m_blocks.empty())
+        return 1;
+
+    m_kernel = kernel;
+    if (pool != nullptr)
+        pool->Run((int)m_blocks.size(), 1, BlockRun, this);
+    else
+        BlockRun(this, 0, (int)m_blocks.size(), 0);
+
+    for (size_t s = 0; s < m_shapes.size(); s++)
+    {
+        Shape &shape = m_shapes[s];
+        double total[FACET_MASS_TERMS] = { 0.0 }, error[FACET_MASS_TERMS] = { 0.0 };
+        const int lastBlock = s + 1 < m_shapes.size() ? m_shapes[s + 1].firstBlock : (int)m_blocks.size();
+        for (int b = shape.firstBlock; b < lastBlock; b++)
+        {
+            for (int k = 0; k < FACET_MASS_TERMS; k++)
+                KahanAdd(&total[k], &error[k], m_blocks[b].sum[k] - m_blocks[b].error[k]);
+        }
+        for (int k = 0; k < FACET_MASS_TERMS; k++)
+            total[k] -= error[k];
+
+        /* inward normals give a negative volume: take the mesh reversed */
+        const double sign = total[1] < 0.0 ? -1.0 : 1.0;
+        FacetMassSums &sums = shape.sums;
+        sums.area = 0.5 * total[0];
+        sums.volume = sign * total[1] / 6.0;
+        for (int k = 0; k < 3; k++)
+        {
+            sums.first[k] = sign * total[2 + k] / 24.0;
+            sums.second[k] = sign * total[5 + k] / 120.0;
+            sums.second[3 + k] = sign * total[8 + k] / 120.0;
+        }
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int FacetMassIntegrator::MassProp
+(
+int shape,             /* I: index of the shape */
+double density,        /* I: density, in the unit of cvxPartInqShapeMass() */
+svxMassProp *prop      /* O: mass properties */
+) const
+/*
+DESCRIPTION:
+   Mass properties of a shape after Integrate(), in the layout of
+cvxPartInqShapeMass().
+
+   Return 1 if the shape has no volume (only Area is set), else 0.
+*/
+{
+    memset(prop, 0, sizeof(*prop));
+    if (shape < 0 || shape >= ShapeCount())
+        return 1;
+    const FacetMassSums &sums = m_shapes[shape].sums;
+    prop->Density = density;
+    prop->Area = sums.area;
+    prop->Volume = sums.volume;
+    prop->Mass = density * sums.volume;
+    if (!(sums.volume > 0.0))
+        return 1;
+
+    /* centroid relative to the reference point, then second moments at the centroid */
+    const double c[3] = { sums.first[0] / sums.volume, sums.first[1] / sums.volume, sums.first[2] / sums.volume };
+    prop->Center.x = sums.reference.x + c[0];
+    prop->Center.y = sums.reference.y + c[1];
+    prop->Center.z = sums.reference.z + c[2];
+    const double xx = sums.second[0] - sums.volume * c[0] * c[0];
+    const double yy = sums.second[1] - sums.volume * c[1] * c[1];
+    const double zz = sums.second[2] - sums.volume * c[2] * c[2];
+    const double xy = sums.second[3] - sums.volume * c[0] * c[1];
+    const double yz = sums.second[4] - sums.volume * c[1] * c[2];
+    const double zx = sums.second[5] - sums.volume * c[2] * c[0];
+
+    prop->Im[0] = density * (yy + zz);
+    prop->Im[1] = density * (zz + xx);
+    prop->Im[2] = density * (xx + yy);
+    prop->Im[3] = -density * xy;
+    prop->Im[4] = -density * yz;
+    prop->Im[5] = -density * zx;
+
+    FacetMassPrincipal(prop->Im, prop->Ip, prop->Axis);
+    for (int k = 0; k < 3; k++)
+        prop->Rad[k] = prop->Mass > 0.0 && prop->Ip[k] > 0.0 ? sqrt(prop->Ip[k] / prop->Mass) : 0.0;
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+const char *FacetMassIntegrator::SimdName
+(
+void
+) const
+/*
+DESCRIPTION:
+   Instruction set of the SIMD kernel on this cpu, for reports.
+*/
+{
+#if defined(FACET_MASS_SSE)
+    return m_avx2 ? "AVX2" : "SSE2";
+#elif defined(FACET_MASS_NEON)
+    return "NEON";
+#else
+    return "scalar";
+#endif
+}
+
+/*******************************************************************/
+/* Function definition */
+int FacetMassPrincipal
+(
+const double *tensor,   /* I: Ixx, Iyy, Izz, Ixy, Iyz, Izx */
+double *moments,        /* O: principal moments, increasing */
+svxVector *axes         /* O: principal axes, right-handed */
+)
+/*
+DESCRIPTION:
+   Eigenvalues and eigenvectors of the symmetric inertia tensor by
+cyclic Jacobi rotations.
+
+   Return 1 if the rotations did not converge, else 0.
+*/
+{
+    double a[3][3] = { { tensor[0], tensor[3], tensor[5] }, { tensor[3], tensor[1], tensor[4] },
+        { tensor[5], tensor[4], tensor[2] } };
+    double v[3][3] = { { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 }, { 0.0, 0.0, 1.0 } };
+    const double scale = fabs(a[0][0]) + fabs(a[1][1]) + fabs(a[2][2]);
+
+    int converged = 0;
+    for (int sweep = 0; sweep < JACOBI_SWEEPS && !converged; sweep++)
+    {
+        const double off = fabs(a[0][1]) + fabs(a[1][2]) + fabs(a[0][2]);
+        if (off <= 1.0e-15 * scale || off == 0.0)
+        {
+            converged = 1;
+            break;
+        }
+        for (int p = 0; p < 2; p++)
+        {
+            for (int q = p + 1; q < 3; q++)
+            {
+                if (a[p][q] == 0.0)
+                    continue;
+                const double theta = (a[q][q] - a[p][p]) / (2.0 * a[p][q]);
+                const double t = (theta >= 0.0 ? 1.0 : -1.0) / (fabs(theta) + sqrt(theta * theta + 1.0));
+                const double c = 1.0 / sqrt(t * t + 1.0), s = t * c;
+                for (int k = 0; k < 3; k++)
+                {
+                    const double akp = a[k][p], akq = a[k][q];
+                    a[k][p] = c * akp - s * akq;
+                    a[k][q] = s * akp + c * akq;
+                }
+                for (int k = 0; k < 3; k++)
+                {
+                    const double apk = a[p][k], aqk = a[q][k];
+                    a[p][k] = c * apk - s * aqk;
+                    a[q][k] = s * apk + c * aqk;
+                }
+                for (int k = 0; k < 3; k++)
+                {
+                    const double vkp = v[k][p], vkq = v[k][q];
+                    v[k][p] = c * vkp - s * vkq;
+                    v[k][q] = s * vkp + c * vkq;
+                }
+            }
+        }
+    }
+
+    /* increasing order, eigenvectors are the columns of v */
+    int order[3] = { 0, 1, 2 };
+    for (int i = 0; i < 2; i++)
+    {
+        for (int j = i + 1; j < 3; j++)
+        {
+            if (a[order[j]][order[j]] < a[order[i]][order[i]])
+            {
+                const int swap = order[i];
+                order[i] = order[j];
+                order[j] = swap;
+            }
+        }
+    }
+    for (int i = 0; i < 3; i++)
+    {
+        moments[i] = a[order[i]][order[i]];
+        axes[i].x = v[0][order[i]];
+        axes[i].y = v[1][order[i]];
+        axes[i].z = v[2][order[i]];
+    }
+    axes[2].x = axes[0].y * axes[1].z - axes[0].z * axes[1].y;
+    axes[2].y = axes[0].z * axes[1].x - axes[0].x * axes[1].z;
+    axes[2].z = axes[0].x * axes[1].y - axes[0].y * axes[1].x;
+    return converged ? 0 : 1;
+}
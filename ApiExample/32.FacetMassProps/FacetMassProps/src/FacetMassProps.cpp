@@ -0,0 +1,414 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* ZW3D API includes */
+#include "zwapi_brep_shape.h"
+#include "zwapi_entity.h"
+#include "zwapi_face.h"
+#include "zwapi_shape.h"
+#include "zwapi_userinput.h"
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+#include "..\inc\FacetMassPropsPr.h"
+#include "..\inc\FacetMassIntegrator.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define MESSAGE_SIZE 256
+#define BENCH_DEFAULT_CONFIGS 100    /* densities of ~FacetMassBench */
+
+/*******************************************************************/
+/* Function declarations */
+static int FacetMassCheck(void);
+static int FacetMassBench(void);
+static int RefineGet(szwRefineFacets *refine);
+static int ShapesLoad(int count, const szwEntityHandle *shapes, const szwRefineFacets &refine,
+    FacetMassIntegrator *integrator, std::vector<int> &index);
+static double Deviation(double value, double exact, double scale);
+static double Seconds(std::chrono::steady_clock::time_point start);
+
+/*******************************************************************/
+/* Function definition */
+int RegisterFacetMassProps
+(
+void
+)
+/*
+DESCRIPTION:
+   Register the commands of the facet mass properties example.
+*/
+{
+    /* Compare the facet mass properties with cvxPartInqShapeMass() by entering "~FacetMassCheck" */
+    ZwCommandFunctionLoad("FacetMassCheck", (void *)FacetMassCheck, ZW_LICENSE_CODE_GENERAL);
+
+    /* Time mass properties for many densities by entering "~FacetMassBench" */
+    ZwCommandFunctionLoad("FacetMassBench", (void *)FacetMassBench, ZW_LICENSE_CODE_GENERAL);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int UnloadFacetMassProps
+(
+void
+)
+/*
+DESCRIPTION:
+   Unload the commands of the facet mass properties example.
+*/
+{
+    ZwCommandFunctionUnload("FacetMassCheck");
+    ZwCommandFunctionUnload("FacetMassBench");
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+double Seconds
+(
+std::chrono::steady_clock::time_point start   /* I: start time */
+)
+/*
+DESCRIPTION:
+   Seconds elapsed since "start".
+*/
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*******************************************************************/
+/* Function definition */
+int RefineGet
+(
+szwRefineFacets *refine   /* O: facet settings */
+)
+/*
+DESCRIPTION:
+   Ask for the distance tolerance of the facets; the other settings keep
+their defaults.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    memset(refine, 0, sizeof(*refine));
+    refine->type = ZW_FACETS_TOLORANCE_DISTANCE;
+    refine->angleTolorance = 5.0;
+    refine->surfaceTolorance = 1.0;
+
+    double number = 0.05;
+    if (cvxGetNumber("Facet distance tolerance", &number) || !(number > 0.0))
+        number = 0.05;
+    refine->edgeTolorance = refine->facetTolorance = number;
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int ShapesLoad
+(
+int count,                          /* I: number of shapes */
+const szwEntityHandle *shapes,      /* I: shapes */
+const szwRefineFacets &refine,      /* I: facet settings */
+FacetMassIntegrator *integrator,    /* O: integrator holding the facets */
+std::vector<int> &index             /* O: per shape, index in the integrator or -1 */
+)
+/*
+DESCRIPTION:
+   Get the facets of all faces of every shape and add them to an
+integrator, one shape each. A shape with a face that could not be
+faceted is left out, its mesh would not be closed.
+
+   Return 1 if no shape was added, else 0.
+*/
+{
+    index.assign(count, -1);
+    int added = 0;
+    std::vector<szwFacets> facets;
+    for (int i = 0; i < count; i++)
+    {
+        int countFace = 0;
+        szwEntityHandle *faces = nullptr;
+        if (ZwShapeFaceListGet(shapes[i], &countFace, &faces))
+            continue;
+
+        int failed = 0;
+        facets.assign(countFace, szwFacets{});
+        for (int f = 0; f < countFace && !failed; f++)
+        {
+            szwRefineFacets request = refine;
+            request.faceHandle = faces[f];
+            failed = ZwFaceFacetsGet(request, &facets[f]) ? 1 : 0;
+        }
+        if (!failed)
+        {
+            index[i] = integrator->AddShape(countFace, facets.data());
+            added += index[i] >= 0 ? 1 : 0;
+        }
+        for (szwFacets &face : facets)
+            ZwFaceFacetsDataFree(&face);
+        ZwEntityHandleListFree(countFace, &faces);
+    }
+    return added > 0 ? 0 : 1;
+}
+
+/*******************************************************************/
+/* Function definition */
+double Deviation
+(
+double value,    /* I: value from the facets */
+double exact,    /* I: value of the host */
+double scale     /* I: size the difference is compared to, 0 for |exact| */
+)
+/*
+DESCRIPTION:
+   Relative deviation of a value, in percent.
+*/
+{
+    const double size = scale > 0.0 ? scale : fabs(exact);
+    return size > 0.0 ? 100.0 * fabs(value - exact) / size : 0.0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int FacetMassCheck
+(
+void
+)
+/*
+DESCRIPTION:
+   Compute the mass properties of the picked shapes from their facets and
+with cvxPartInqShapeMass(), and report the deviation of each value, so
+the facet tolerance can be chosen for the accuracy needed. The facets use
+the density of the host (its mass over its volume). The center is
+compared to the size of the shape (cube root of its volume), the tensor
+to its largest principal moment; the principal moments and radii do not
+depend on the convention of the tensor.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    int count = 0;
+    szwEntityHandle *shapes = nullptr;
+    if (ZwEntityListGetByPick("Select shapes to check", ZW_INPUT_SHAPE, 0, &count, &shapes))
+        return 1;
+    szwRefineFacets refine;
+    RefineGet(&refine);
+    std::vector<int> ids(count);
+    if (ZwEntityIdGet(count, shapes, ids.data()))
+    {
+        ZwEntityHandleListFree(count, &shapes);
+        return 1;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    FacetMassIntegrator integrator;
+    std::vector<int> index;
+    const int loadFailed = ShapesLoad(count, shapes, refine, &integrator, index);
+    ZwEntityHandleListFree(count, &shapes);
+    const double facetTime = Seconds(start);
+    if (loadFailed)
+    {
+        cvxMsgDisp("No shape could be faceted");
+        return 1;
+    }
+
+    start = std::chrono::steady_clock::now();
+    WorkPool pool;
+    integrator.Integrate(&pool, FacetMass_Simd);
+    const double integrateTime = Seconds(start);
+
+    char message[MESSAGE_SIZE];
+    double hostTime = 0.0, worst = 0.0;
+    for (int i = 0; i < count; i++)
+    {
+        if (index[i] < 0)
+            continue;
+        svxMassProp exact, local;
+        start = std::chrono::steady_clock::now();
+        const int hostFailed = cvxPartInqShapeMass(ids[i], 0.0, &exact) ? 1 : 0;
+        hostTime += Seconds(start);
+        if (hostFailed || !(exact.Volume > 0.0))
+            continue;
+        if (integrator.MassProp(index[i], exact.Mass / exact.Volume, &local))
+            continue;
+
+        /* the principal moments are compared in increasing order, whatever the order of the host */
+        double ip[3] = { exact.Ip[0], exact.Ip[1], exact.Ip[2] };
+        for (int a = 0; a < 2; a++)
+        {
+            for (int b = a + 1; b < 3; b++)
+            {
+                if (ip[b] < ip[a])
+                {
+                    const double swap = ip[a];
+                    ip[a] = ip[b];
+                    ip[b] = swap;
+                }
+            }
+        }
+        const double size = cbrt(exact.Volume), moment = ip[2];
+        double center = 0.0, principal = 0.0, radius = 0.0, tensor = 0.0;
+        const double *c = &local.Center.x, *e = &exact.Center.x;
+        for (int k = 0; k < 3; k++)
+        {
+            const double dc = Deviation(c[k], e[k], size);
+            const double dp = Deviation(local.Ip[k], ip[k], moment);
+            const double dr = Deviation(local.Rad[k], moment > 0.0 && exact.Mass > 0.0 ?
+                sqrt(ip[k] / exact.Mass) : 0.0, 0.0);
+            center = dc > center ? dc : center;
+            principal = dp > principal ? dp : principal;
+            radius = dr > radius ? dr : radius;
+        }
+        for (int k = 0; k < 6; k++)
+        {
+            const double dt = Deviation(local.Im[k], exact.Im[k], moment);
+            tensor = dt > tensor ? dt : tensor;
+        }
+        const double area = Deviation(local.Area, exact.Area, 0.0), volume = Deviation(local.Volume, exact.Volume, 0.0);
+        worst = area > worst ? area : worst;
+        worst = volume > worst ? volume : worst;
+        worst = principal > worst ? principal : worst;
+
+        sprintf_s(message, MESSAGE_SIZE, "Shape %d (%d triangles): deviation %% area %.3g, volume %.3g, center %.3g, "
+            "Ip %.3g, Rad %.3g, Im %.3g", ids[i], integrator.Sums(index[i]).triangles, area, volume, center,
+            principal, radius, tensor);
+        cvxMsgDisp(message);
+    }
+
+    sprintf_s(message, MESSAGE_SIZE, "%d of %d shapes faceted, %d triangles; largest deviation %.3g %%",
+        integrator.ShapeCount(), count, integrator.TriangleCount(), worst);
+    cvxMsgDisp(message);
+    sprintf_s(message, MESSAGE_SIZE, "Host %.3f s; facets %.3f s, integration %.4f s on %d threads",
+        hostTime, facetTime, integrateTime, pool.ThreadCount());
+    cvxMsgDisp(message);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int FacetMassBench
+(
+void
+)
+/*
+DESCRIPTION:
+   Compute the mass properties of the picked shapes for a number of
+densities, as a what-if study over material configurations would: with
+cvxPartInqShapeMass() for each shape and density, and with the facets
+integrated once and MassProp() for each. The integration is timed with
+each kernel on one thread and with the SIMD kernel on the pool; the
+volume of the kernel without compensation shows how much the
+compensation changes.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    int count = 0;
+    szwEntityHandle *shapes = nullptr;
+    if (ZwEntityListGetByPick("Select shapes to benchmark", ZW_INPUT_SHAPE, 0, &count, &shapes))
+        return 1;
+    szwRefineFacets refine;
+    RefineGet(&refine);
+    double number = BENCH_DEFAULT_CONFIGS;
+    if (cvxGetNumber("Number of densities", &number) || number < 1.0)
+        number = BENCH_DEFAULT_CONFIGS;
+    const int configs = (int)number;
+    std::vector<int> ids(count);
+    if (ZwEntityIdGet(count, shapes, ids.data()))
+    {
+        ZwEntityHandleListFree(count, &shapes);
+        return 1;
+    }
+
+    /* host: one call per shape and density, from the default density to twice of it */
+    std::vector<double> density(count, 0.0);
+    svxMassProp prop;
+    auto start = std::chrono::steady_clock::now();
+    int hostCalls = 0;
+    for (int c = 0; c < configs; c++)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            hostCalls++;
+            if (cvxPartInqShapeMass(ids[i], density[i] * (1.0 + (double)c / configs), &prop))
+                continue;
+            if (c == 0 && prop.Volume > 0.0)
+                density[i] = prop.Mass / prop.Volume;
+        }
+    }
+    const double hostTime = Seconds(start);
+
+    /* local: facets once, one integration, then every density */
+    start = std::chrono::steady_clock::now();
+    FacetMassIntegrator integrator;
+    std::vector<int> index;
+    const int loadFailed = ShapesLoad(count, shapes, refine, &integrator, index);
+    ZwEntityHandleListFree(count, &shapes);
+    const double facetTime = Seconds(start);
+    if (loadFailed)
+    {
+        cvxMsgDisp("No shape could be faceted");
+        return 1;
+    }
+
+    const FacetMassKernel kernels[3] = { FacetMass_Plain, FacetMass_Scalar, FacetMass_Simd };
+    double kernelTime[3] = { 0.0 }, plainVolume = 0.0, volume = 0.0;
+    for (int k = 0; k < 3; k++)
+    {
+        start = std::chrono::steady_clock::now();
+        integrator.Integrate(nullptr, kernels[k]);
+        kernelTime[k] = Seconds(start);
+        if (kernels[k] == FacetMass_Plain)
+            plainVolume = integrator.Sums(0).volume;
+    }
+    const double serialVolume = integrator.Sums(0).volume;
+
+    WorkPool pool;
+    start = std::chrono::steady_clock::now();
+    integrator.Integrate(&pool, FacetMass_Simd);
+    const double poolTime = Seconds(start);
+    volume = integrator.Sums(0).volume;
+
+    start = std::chrono::steady_clock::now();
+    int localCalls = 0;
+    for (int c = 0; c < configs; c++)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            if (index[i] < 0)
+                continue;
+            integrator.MassProp(index[i], density[i] * (1.0 + (double)c / configs), &prop);
+            localCalls++;
+        }
+    }
+    const double propTime = Seconds(start);
+    const double localTime = facetTime + poolTime + propTime;
+    const double triangles = integrator.TriangleCount();
+
+    char message[MESSAGE_SIZE];
+    sprintf_s(message, MESSAGE_SIZE, "%d shapes (%d faceted, %d triangles), %d densities",
+        count, integrator.ShapeCount(), integrator.TriangleCount(), configs);
+    cvxMsgDisp(message);
+    sprintf_s(message, MESSAGE_SIZE, "Host: %.3f s for %d calls", hostTime, hostCalls);
+    cvxMsgDisp(message);
+    sprintf_s(message, MESSAGE_SIZE, "Local: facets %.3f s, integration %.4f s, %d mass properties %.4f s, total %.1fx faster",
+        facetTime, poolTime, localCalls, propTime, localTime > 0.0 ? hostTime / localTime : 0.0);
+    cvxMsgDisp(message);
+    sprintf_s(message, MESSAGE_SIZE, "Triangles/s: plain %.3g, compensated %.3g, SIMD (%s) %.3g, SIMD on %d threads %.3g",
+        kernelTime[0] > 0.0 ? triangles / kernelTime[0] : 0.0, kernelTime[1] > 0.0 ? triangles / kernelTime[1] : 0.0,
+        integrator.SimdName(), kernelTime[2] > 0.0 ? triangles / kernelTime[2] : 0.0, pool.ThreadCount(),
+        poolTime > 0.0 ? triangles / poolTime : 0.0);
+    cvxMsgDisp(message);
+    sprintf_s(message, MESSAGE_SIZE, "First shape volume: compensated %.17g (%s on the pool), plain differs by %.3g",
+        volume, volume == serialVolume ? "same" : "NOT same", plainVolume - volume);
+    cvxMsgDisp(message);
+    return 0;
+}
@@ -0,0 +1,50 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+#pragma once
+
+/* ZW3D API includes */
+#include "zwapi_util.h"
+
+/* Application includes */
+#include <vector>
+
+/*******************************************************************/
+/* Constant definitions */
+#define POINT_KD_MAX_NEAREST 16      /* largest k of Nearest() */
+
+/*******************************************************************/
+/* Data type definitions */
+/*
+DESCRIPTION:
+   Balanced k-d tree over a point set, for k-nearest queries.
+
+   The tree is implicit: Build() reorders a copy of the points so that
+the median of every range [first, end) on its widest axis is at its
+middle, the lower half before it and the upper half after. No node is
+stored besides the split axis of each middle point. Nearest() returns
+the index of the points as given to Build().
+
+   The tree is immutable after Build() and may be shared by threads.
+*/
+class PointKdTree
+{
+public:
+    PointKdTree();
+
+    int Build(int count, const svxPoint *points);
+    void Clear(void);
+    int Count(void) const { return (int)m_points.size(); }
+
+    int Nearest(const svxPoint &point, int k, int *items, double *distances) const;
+
+private:
+    void RangeBuild(int first, int end);
+    void RangeSearch(int first, int end, const double *point, int k, int *found, int *items,
+        double *squares) const;
+
+    std::vector<svxPoint> m_points;   /* points, tree order */
+    std::vector<int> m_items;         /* index given to Build() per point */
+    std::vector<char> m_axis;         /* split axis of each range middle */
+};
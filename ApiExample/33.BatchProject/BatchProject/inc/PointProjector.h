@@ -0,0 +1,141 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+#pragma once
+
+/* ZW3D API includes */
+#include "zwapi_util.h"
+
+/* Application includes */
+#include <vector>
+#include "NurbsCurveEval.h"
+#include "NurbsSurfaceEval.h"
+#include "PointKdTree.h"
+#include "WorkPool.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define PROJECT_MAX_GRID 64          /* seed samples of a surface in U and V, at most */
+#define PROJECT_MAX_SAMPLES 4096     /* seed samples of a curve, at most */
+#define PROJECT_MAX_ITERATIONS 32    /* Newton steps per seed */
+#define PROJECT_MAX_SEEDS 8          /* seeds per query, at most */
+#define PROJECT_GRAIN 64             /* queries taken at a time by a pool worker */
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: settings of a projection */
+struct ProjectOptions
+{
+    double tolerance;    /* Newton stops when the foot point moves less (mm) */
+    int seeds;           /* nearest samples refined per query, the closest result is kept */
+};
+
+/* DESCRIPTION: status of a projection */
+enum ProjectStatus
+{
+    Project_Converged = 0,   /* the step left within the domain moves the foot point less than the tolerance */
+    Project_Iterated = 1,    /* PROJECT_MAX_ITERATIONS reached or no step gets closer, the best point is returned */
+    Project_Failed = 2,      /* invalid target or evaluation error */
+};
+
+/* DESCRIPTION: result of one query */
+struct ProjectResult
+{
+    svxPoint point;      /* foot point on the target */
+    svxVector normal;    /* surface: unit normal as cvxFaceEval(); curve: unit vector to the query, 0 on it */
+    double u, v;         /* surface: U, V; curve: parameter in u (see PointProjector), v = 0 */
+    double distance;     /* distance of the query to the foot point */
+    int target;          /* target of the foot point */
+    int iterations;      /* Newton steps of the kept seed */
+    ProjectStatus status;
+};
+
+/*
+DESCRIPTION:
+   Batch projection of points onto surfaces and curves read once with
+cvxPartInqFaceSrf() and cvxPartInqCurve(), without a host call per point.
+
+   Every target is sampled when it is added: a UV grid of surfaces (the
+knot spans times the order in U and V, up to PROJECT_MAX_GRID each) and
+the knot spans of NURBS curves, and the samples are put into a k-d tree.
+A query starts from the nearest samples of its target (options.seeds of
+them, so a point near two lobes of a surface finds the right one) and
+refines each with Newton iterations on the distance (the second
+derivatives of surfaces by differences of their tangents), with step
+halving when the distance grows. Parameters are kept in the
+domain, or wrapped on closed directions. Lines, arcs and circles are
+projected exactly.
+
+   As cvxFacePntProj(), surfaces are the untrimmed NURBS of the faces.
+Curve parameters are those of svxCurve: the knot parameter of NURBS
+curves, the length ratio 0 to 1 of lines and the angle (degree) of arcs
+and circles.
+
+   Project() runs the queries on a WorkPool, each worker with its own
+evaluation buffer. A query with target -1 is projected onto every target
+and the closest result is kept. The projector is immutable after the
+targets are added and may be shared by threads.
+*/
+class PointProjector
+{
+public:
+    PointProjector();
+
+    int AddSurface(const svxSurface &surface);
+    int AddCurve(const svxCurve &curve);
+    void Clear(void);
+    int Count(void) const { return (int)m_targets.size(); }
+    int IsSurface(int target) const { return m_targets[target].surface >= 0; }
+    int SampleCount(int target) const { return m_targets[target].tree.Count(); }
+
+    int Evaluate(int target, double u, double v, svxPoint *point, svxVector *normal) const;
+    int Domain(int target, svxLimit *u, svxLimit *v) const;
+
+    int Project(int count, const svxPoint *points, const int *targets, const ProjectOptions &options,
+        WorkPool *pool, ProjectResult *results) const;
+    int ProjectPoint(const svxPoint &point, int target, const ProjectOptions &options,
+        ProjectResult *result) const;
+
+private:
+    struct Target
+    {
+        evxCurveType type;            /* curve type, VX_CRV_NURB for surfaces */
+        int surface;                  /* index in m_surfaces, -1 for curves */
+        int curve;                    /* index in m_curves, -1 for surfaces and analytic curves */
+        int closedU, closedV;         /* 1 if the parameter wraps around */
+        svxLimit domainU, domainV;
+        svxPoint start, end;          /* line */
+        svxPoint center;              /* arc and circle */
+        svxVector xAxis, yAxis;       /* arc plane, angle 0 on xAxis */
+        double radius;
+        double angle, sweep;          /* start and swept angle (degree) */
+        std::vector<double> u, v;     /* parameters of the samples (grid of surfaces: k = iv * size(u) + iu) */
+        PointKdTree tree;             /* samples */
+    };
+
+    /* data of a running Project() */
+    struct Batch
+    {
+        const PointProjector *self;
+        const svxPoint *points;
+        const int *targets;
+        const ProjectOptions *options;
+        ProjectResult *results;
+        std::vector<SurfaceSamples> scratch;   /* one per worker */
+    };
+
+    static void TaskRun(void *data, int begin, int end, int worker);
+    void Query(const svxPoint &point, int target, const ProjectOptions &options, SurfaceSamples &scratch,
+        ProjectResult *result) const;
+    void SurfaceNewton(const Target &target, const svxPoint &point, double u, double v, double tolerance,
+        SurfaceSamples &scratch, ProjectResult *result) const;
+    void CurveNewton(const Target &target, const svxPoint &point, double t, double tolerance,
+        ProjectResult *result) const;
+    void AnalyticProject(const Target &target, const svxPoint &point, ProjectResult *result) const;
+    int CurvePoint(const Target &target, double t, svxPoint *point, svxVector *tangent) const;
+
+    std::vector<Target> m_targets;
+    std::vector<NurbsSurfaceEvaluator> m_surfaces;
+    std::vector<NurbsCurveEvaluator> m_curves;
+};
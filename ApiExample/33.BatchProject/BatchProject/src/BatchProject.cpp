@@ -0,0 +1,366 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* ZW3D API includes */
+#include "zwapi_brep_face.h"
+#include "zwapi_curve.h"
+#include "zwapi_entity.h"
+#include "zwapi_math_nurbscurve.h"
+#include "zwapi_part_objs.h"
+#include "zwapi_userinput.h"
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <math.h>
+#include <chrono>
+#include <random>
+#include <vector>
+#include "..\inc\BatchProjectPr.h"
+#include "..\inc\PointProjector.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define MESSAGE_SIZE 256
+#define DEFAULT_POINTS 10000         /* default number of queries */
+#define DEFAULT_OFFSET 0.5           /* default largest distance of the queries to their target */
+#define DEFAULT_SEEDS 2              /* default seeds per query */
+#define PROJECT_TOLERANCE 1.0e-7     /* foot point move that ends the Newton iterations (mm) */
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: queries of a comparison and their host results */
+struct ProjectRun
+{
+    std::vector<int> ids;             /* entity id per target */
+    std::vector<svxPoint> points;     /* query points */
+    std::vector<int> targets;         /* target per query */
+    std::vector<svxPoint> hostPoints; /* foot points of the host */
+    int hostFailed;
+    double hostTime;
+};
+
+/*******************************************************************/
+/* Function declarations */
+static int BatchProjectFace(void);
+static int BatchProjectCurve(void);
+static int TargetsLoad(int faces, const char *prompt, PointProjector *projector, ProjectRun *run);
+static void QueriesMake(const PointProjector &projector, int count, double offset, ProjectRun *run);
+static void HostProject(int faces, ProjectRun *run);
+static int CompareRun(int faces);
+static double Seconds(std::chrono::steady_clock::time_point start);
+
+/*******************************************************************/
+/* Function definition */
+int RegisterBatchProject
+(
+void
+)
+/*
+DESCRIPTION:
+   Register the commands of the batch projection example.
+*/
+{
+    /* Compare and time batch projection onto faces with cvxFacePntProj() by entering "~BatchProjectFace" */
+    ZwCommandFunctionLoad("BatchProjectFace", (void *)BatchProjectFace, ZW_LICENSE_CODE_GENERAL);
+
+    /* Compare and time batch projection onto curves with cvxCrvPntProj() by entering "~BatchProjectCurve" */
+    ZwCommandFunctionLoad("BatchProjectCurve", (void *)BatchProjectCurve, ZW_LICENSE_CODE_GENERAL);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int UnloadBatchProject
+(
+void
+)
+/*
+DESCRIPTION:
+   Unload the commands of the batch projection example.
+*/
+{
+    ZwCommandFunctionUnload("BatchProjectFace");
+    ZwCommandFunctionUnload("BatchProjectCurve");
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+double Seconds
+(
+std::chrono::steady_clock::time_point start   /* I: start time */
+)
+/*
+DESCRIPTION:
+   Seconds elapsed since "start".
+*/
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*******************************************************************/
+/* Function definition */
+int TargetsLoad
+(
+int faces,                     /* I: 1 for faces, 0 for curves */
+const char *prompt,            /* I: pick prompt */
+PointProjector *projector,     /* O: projector holding the targets */
+ProjectRun *run                /* O: entity id per target */
+)
+/*
+DESCRIPTION:
+   Pick faces (or curves) and add their surface (or curve) data to a
+projector.
+
+   Return 1 if no target was added, else 0.
+*/
+{
+    int count = 0;
+    szwEntityHandle *entities = nullptr;
+    if (ZwEntityListGetByPick(prompt, faces ? ZW_INPUT_FACE : ZW_INPUT_EDGE_OR_CURVE, 0, &count, &entities))
+        return 1;
+    std::vector<int> ids(count);
+    const int idFailed = ZwEntityIdGet(count, entities, ids.data()) ? 1 : 0;
+    ZwEntityHandleListFree(count, &entities);
+    if (idFailed)
+        return 1;
+
+    for (int i = 0; i < count; i++)
+    {
+        int added = -1;
+        if (faces)
+        {
+            svxSurface surface{};
+            if (cvxPartInqFaceSrf(ids[i], &surface))
+                continue;
+            added = projector->AddSurface(surface);
+            cvxSurfaceFree(&surface);
+        }
+        else
+        {
+            svxCurve curve{};
+            if (cvxPartInqCurve(ids[i], 0, &curve))
+                continue;
+            added = projector->AddCurve(curve);
+            cvxCurveFree(&curve);
+        }
+        if (added >= 0)
+            run->ids.push_back(ids[i]);
+    }
+    return run->ids.empty() ? 1 : 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void QueriesMake
+(
+const PointProjector &projector,   /* I: targets */
+int count,                         /* I: number of queries */
+double offset,                     /* I: largest distance of a query to its target */
+ProjectRun *run                    /* O: query points and their targets */
+)
+/*
+DESCRIPTION:
+   Random queries as a measuring machine would give them: points of a
+random target at random parameters, moved by up to "offset" along the
+normal of a surface or in any direction from a curve.
+*/
+{
+    std::mt19937 random(20240601);
+    std::uniform_real_distribution<double> unit(0.0, 1.0), side(-1.0, 1.0);
+    run->points.clear();
+    run->targets.clear();
+    while ((int)run->points.size() < count)
+    {
+        const int target = (int)(unit(random) * projector.Count()) % projector.Count();
+        svxLimit u, v;
+        projector.Domain(target, &u, &v);
+        svxPoint point;
+        svxVector normal;
+        if (projector.Evaluate(target, u.min + unit(random) * (u.max - u.min), v.min + unit(random) * (v.max - v.min),
+            &point, &normal))
+            continue;
+
+        svxVector move = normal;
+        if (!projector.IsSurface(target))
+        {
+            /* any direction, the along-curve part only moves the foot point */
+            move.x = side(random);
+            move.y = side(random);
+            move.z = side(random);
+            const double length = sqrt(move.x * move.x + move.y * move.y + move.z * move.z);
+            if (!(length > 0.0))
+                continue;
+            move.x /= length;
+            move.y /= length;
+            move.z /= length;
+        }
+        const double distance = offset * side(random);
+        point.x += distance * move.x;
+        point.y += distance * move.y;
+        point.z += distance * move.z;
+        run->points.push_back(point);
+        run->targets.push_back(target);
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+void HostProject
+(
+int faces,          /* I: 1 for faces, 0 for curves */
+ProjectRun *run     /* I/O: queries, the host foot points are set */
+)
+/*
+DESCRIPTION:
+   Project every query with one host call, cvxFacePntProj() and
+cvxFaceEval() for the point and normal of faces, cvxCrvPntProj() for
+curves.
+*/
+{
+    const int count = (int)run->points.size();
+    run->hostPoints.assign(count, svxPoint{});
+    run->hostFailed = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; i++)
+    {
+        const int id = run->ids[run->targets[i]];
+        svxPoint point = run->points[i];
+        if (faces)
+        {
+            double u = 0.0, v = 0.0;
+            svxVector normal;
+            if (cvxFacePntProj(id, &point, &u, &v) || cvxFaceEval(id, u, v, &run->hostPoints[i], &normal))
+                run->hostFailed++;
+        }
+        else
+        {
+            double t = 0.0;
+            if (cvxCrvPntProj(id, &point, &t, &run->hostPoints[i]))
+                run->hostFailed++;
+        }
+    }
+    run->hostTime = Seconds(start);
+}
+
+/*******************************************************************/
+/* Function definition */
+int CompareRun
+(
+int faces   /* I: 1 for faces, 0 for curves */
+)
+/*
+DESCRIPTION:
+   Project random points near the picked targets with one host call per
+point and with the batch projector on one thread and on the pool, and
+report the times and how the foot points agree. Where the two differ,
+the distances tell which one is the closer foot point.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    PointProjector projector;
+    ProjectRun run;
+    if (TargetsLoad(faces, faces ? "Select faces to project onto" : "Select curves or edges to project onto",
+        &projector, &run))
+    {
+        cvxMsgDisp("No supported target");
+        return 1;
+    }
+    double number = DEFAULT_POINTS;
+    if (cvxGetNumber("Number of points", &number) || number < 1.0)
+        number = DEFAULT_POINTS;
+    const int count = (int)number;
+    number = DEFAULT_OFFSET;
+    if (cvxGetNumber("Largest distance of the points", &number) || number < 0.0)
+        number = DEFAULT_OFFSET;
+    const double offset = number;
+    number = DEFAULT_SEEDS;
+    if (cvxGetNumber("Seeds per point", &number) || number < 1.0)
+        number = DEFAULT_SEEDS;
+    const ProjectOptions options = { PROJECT_TOLERANCE, (int)number };
+
+    QueriesMake(projector, count, offset, &run);
+    HostProject(faces, &run);
+
+    std::vector<ProjectResult> results(count);
+    auto start = std::chrono::steady_clock::now();
+    projector.Project(count, run.points.data(), run.targets.data(), options, nullptr, results.data());
+    const double serialTime = Seconds(start);
+
+    WorkPool pool;
+    start = std::chrono::steady_clock::now();
+    const int failed = projector.Project(count, run.points.data(), run.targets.data(), options, &pool, results.data());
+    const double poolTime = Seconds(start);
+
+    /* agreement with the host */
+    int closer = 0, farther = 0, iterated = 0;
+    long long iterations = 0;
+    double footGap = 0.0, worse = 0.0;
+    for (int i = 0; i < count; i++)
+    {
+        const ProjectResult &result = results[i];
+        if (result.status == Project_Failed)
+            continue;
+        iterated += result.status == Project_Iterated ? 1 : 0;
+        iterations += result.iterations;
+        const svxPoint &host = run.hostPoints[i], &point = run.points[i];
+        const double gx = result.point.x - host.x, gy = result.point.y - host.y, gz = result.point.z - host.z;
+        const double gap = sqrt(gx * gx + gy * gy + gz * gz);
+        footGap = gap > footGap ? gap : footGap;
+        const double hx = point.x - host.x, hy = point.y - host.y, hz = point.z - host.z;
+        const double delta = result.distance - sqrt(hx * hx + hy * hy + hz * hz);
+        closer += delta < -1.0e-6 ? 1 : 0;
+        farther += delta > 1.0e-6 ? 1 : 0;
+        worse = delta > worse ? delta : worse;
+    }
+
+    char message[MESSAGE_SIZE];
+    sprintf_s(message, MESSAGE_SIZE, "%d %s, %d points within %g, %d seeds: %d failed (host %d), %d not converged",
+        projector.Count(), faces ? "surfaces" : "curves", count, offset, options.seeds, failed, run.hostFailed, iterated);
+    cvxMsgDisp(message);
+    sprintf_s(message, MESSAGE_SIZE, "Foot points: largest gap to the host %g; %d closer, %d farther (by %g at most); %.2f Newton steps",
+        footGap, closer, farther, worse, count > 0 ? (double)iterations / count : 0.0);
+    cvxMsgDisp(message);
+    sprintf_s(message, MESSAGE_SIZE, "Host %.3f s (%.3g points/s); batch: 1 thread %.3f s (%.3g points/s), %d threads %.3f s (%.1fx faster)",
+        run.hostTime, run.hostTime > 0.0 ? count / run.hostTime : 0.0, serialTime,
+        serialTime > 0.0 ? count / serialTime : 0.0, pool.ThreadCount(), poolTime,
+        poolTime > 0.0 ? run.hostTime / poolTime : 0.0);
+    cvxMsgDisp(message);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int BatchProjectFace
+(
+void
+)
+/*
+DESCRIPTION:
+   Compare batch projection onto the picked faces with cvxFacePntProj().
+
+   Return 1 if function fails, else 0.
+*/
+{
+    return CompareRun(1);
+}
+
+/*******************************************************************/
+/* Function definition */
+int BatchProjectCurve
+(
+void
+)
+/*
+DESCRIPTION:
+   Compare batch projection onto the picked curves with cvxCrvPntProj().
+
+   Return 1 if function fails, else 0.
+*/
+{
+    return CompareRun(0);
+}
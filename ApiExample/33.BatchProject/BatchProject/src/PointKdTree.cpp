@@ -0,0 +1,207 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* Application includes */
+#include <math.h>
+#include <algorithm>
+#include "..\inc\PointKdTree.h"
+
+/*******************************************************************/
+/* Function definition */
+PointKdTree::PointKdTree
+(
+)
+/*
+DESCRIPTION:
+   Create an empty tree.
+*/
+{
+}
+
+/*******************************************************************/
+/* Function definition */
+void PointKdTree::Clear
+(
+void
+)
+/*
+DESCRIPTION:
+   Remove all points.
+*/
+{
+    m_points.clear();
+    m_items.clear();
+    m_axis.clear();
+}
+
+/*******************************************************************/
+/* Function definition */
+int PointKdTree::Build
+(
+int count,                 /* I: number of points */
+const svxPoint *points     /* I: points */
+)
+/*
+DESCRIPTION:
+   Build the tree over a copy of the points.
+
+   Return 1 if there is no point, else 0.
+*/
+{
+    Clear();
+    if (count <= 0 || points == nullptr)
+        return 1;
+
+    m_points.assign(points, points + count);
+    m_items.resize(count);
+    for (int i = 0; i < count; i++)
+        m_items[i] = i;
+    m_axis.assign(count, 0);
+    RangeBuild(0, count);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void PointKdTree::RangeBuild
+(
+int first,   /* I: first point of the range */
+int end      /* I: end of the range */
+)
+/*
+DESCRIPTION:
+   Put the median of a range on its widest axis at its middle, then
+build both halves.
+*/
+{
+    while (end - first > 1)
+    {
+        double low[3] = { m_points[first].x, m_points[first].y, m_points[first].z };
+        double high[3] = { low[0], low[1], low[2] };
+        for (int i = first + 1; i < end; i++)
+        {
+            const double *p = &m_points[i].x;
+            for (int k = 0; k < 3; k++)
+            {
+                low[k] = p[k] < low[k] ? p[k] : low[k];
+                high[k] = p[k] > high[k] ? p[k] : high[k];
+            }
+        }
+        int axis = 0;
+        for (int k = 1; k < 3; k++)
+            axis = high[k] - low[k] > high[axis] - low[axis] ? k : axis;
+
+        /* order the points and their items together through an index */
+        const int middle = first + (end - first) / 2;
+        std::vector<int> order(end - first);
+        for (int i = 0; i < end - first; i++)
+            order[i] = first + i;
+        std::nth_element(order.begin(), order.begin() + (middle - first), order.end(),
+            [this, axis](int a, int b) { return (&m_points[a].x)[axis] < (&m_points[b].x)[axis]; });
+        std::vector<svxPoint> points(end - first);
+        std::vector<int> items(end - first);
+        for (int i = 0; i < end - first; i++)
+        {
+            points[i] = m_points[order[i]];
+            items[i] = m_items[order[i]];
+        }
+        std::copy(points.begin(), points.end(), m_points.begin() + first);
+        std::copy(items.begin(), items.end(), m_items.begin() + first);
+        m_axis[middle] = (char)axis;
+
+        /* the smaller half by recursion, the larger one by the loop */
+        if (middle - first < end - middle - 1)
+        {
+            RangeBuild(first, middle);
+            first = middle + 1;
+        }
+        else
+        {
+            RangeBuild(middle + 1, end);
+            end = middle;
+        }
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+int PointKdTree::Nearest
+(
+const svxPoint &point,   /* I: query point */
+int k,                   /* I: number of points wanted, at most POINT_KD_MAX_NEAREST */
+int *items,              /* O: index of the nearest points, nearest first */
+double *distances        /* O: their distances (NULL to ignore) */
+) const
+/*
+DESCRIPTION:
+   Find the k points nearest to a point.
+
+   Return the number of points found (k, or all points if fewer).
+*/
+{
+    k = k > POINT_KD_MAX_NEAREST ? POINT_KD_MAX_NEAREST : k;
+    if (k <= 0 || m_points.empty())
+        return 0;
+
+    double squares[POINT_KD_MAX_NEAREST];
+    int found = 0;
+    RangeSearch(0, Count(), &point.x, k, &found, items, squares);
+    if (distances)
+    {
+        for (int i = 0; i < found; i++)
+            distances[i] = sqrt(squares[i]);
+    }
+    return found;
+}
+
+/*******************************************************************/
+/* Function definition */
+void PointKdTree::RangeSearch
+(
+int first,              /* I: first point of the range */
+int end,                /* I: end of the range */
+const double *point,    /* I: query point */
+int k,                  /* I: number of points wanted */
+int *found,             /* I/O: number of points found so far */
+int *items,             /* I/O: points found, nearest first */
+double *squares         /* I/O: their squared distances */
+) const
+/*
+DESCRIPTION:
+   Visit the middle of a range, then the half on the side of the query
+point, then the other half if the splitting plane is nearer than the
+k-th point found.
+*/
+{
+    while (end > first)
+    {
+        const int middle = first + (end - first) / 2;
+        const double *p = &m_points[middle].x;
+        const double dx = point[0] - p[0], dy = point[1] - p[1], dz = point[2] - p[2];
+        const double square = dx * dx + dy * dy + dz * dz;
+        if (*found < k || square < squares[*found - 1])
+        {
+            /* insertion into the sorted list */
+            int i = *found < k ? (*found)++ : k - 1;
+            for (; i > 0 && squares[i - 1] > square; i--)
+            {
+                squares[i] = squares[i - 1];
+                items[i] = items[i - 1];
+            }
+            squares[i] = square;
+            items[i] = m_items[middle];
+        }
+
+        const int axis = m_axis[middle];
+        const double offset = point[axis] - p[axis];
+        const int nearFirst = offset < 0.0 ? first : middle + 1, nearEnd = offset < 0.0 ? middle : end;
+        const int farFirst = offset < 0.0 ? middle + 1 : first, farEnd = offset < 0.0 ? end : middle;
+        RangeSearch(nearFirst, nearEnd, point, k, found, items, squares);
+        if (*found == k && offset * offset >= squares[k - 1])
+            return;
+        first = farFirst;
+        end = farEnd;
+    }
+}
@@ -0,0 +1,875 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* Application includes */
+#include <math.h>
+#include <float.h>
+#include <string.h>
+#include "..\inc\PointProjector.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define PROJECT_PI 3.14159265358979323846
+#define PROJECT_HALVINGS 8           /* step halvings of a Newton step that does not get closer */
+#define PROJECT_DIFFERENCE 1.0e-6    /* parameter step of the second derivatives, part of the domain */
+
+/*******************************************************************/
+/* Function declarations */
+static double ParameterFit(double t, svxLimit domain, int closed);
+static int Breaks(const svxParameters &knots, svxLimit domain, std::vector<double> &breaks);
+static void SampleParameters(const std::vector<double> &breaks, int perSpan, int limit,
+    std::vector<double> &parameters);
+static void SampleGet(const SurfaceSamples &sample, svxPoint *point, svxVector *normal, svxVector *uTangent,
+    svxVector *vTangent);
+static double Dot(const svxVector &a, const svxVector &b);
+static double Distance(const svxPoint &a, const svxPoint &b);
+
+/*******************************************************************/
+/* Function definition */
+double ParameterFit
+(
+double t,          /* I: parameter value */
+svxLimit domain,   /* I: parameter range */
+int closed         /* I: 1 if the parameter wraps around */
+)
+/*
+DESCRIPTION:
+   Bring a parameter value into a parameter range, wrapping it on closed
+directions and clamping it on open ones.
+*/
+{
+    if (t >= domain.min && t <= domain.max)
+        return t;
+
+    if (closed && domain.max > domain.min)
+    {
+        const double period = domain.max - domain.min;
+        double offset = fmod(t - domain.min, period);
+        if (offset < 0.0)
+            offset += period;
+        return domain.min + offset;
+    }
+    return t < domain.min ? domain.min : domain.max;
+}
+
+/*******************************************************************/
+/* Function definition */
+void SampleGet
+(
+const SurfaceSamples &sample,   /* I: one sample of EvaluateList() */
+svxPoint *point,                /* O: point */
+svxVector *normal,              /* O: unit normal */
+svxVector *uTangent,            /* O: partial derivative w/r u */
+svxVector *vTangent             /* O: partial derivative w/r v */
+)
+/*
+DESCRIPTION:
+   Copy the first sample of an evaluation.
+*/
+{
+    point->x = sample.x[0]; point->y = sample.y[0]; point->z = sample.z[0];
+    normal->x = sample.nx[0]; normal->y = sample.ny[0]; normal->z = sample.nz[0];
+    uTangent->x = sample.ux[0]; uTangent->y = sample.uy[0]; uTangent->z = sample.uz[0];
+    vTangent->x = sample.vx[0]; vTangent->y = sample.vy[0]; vTangent->z = sample.vz[0];
+}
+
+/*******************************************************************/
+/* Function definition */
+double Dot
+(
+const svxVector &a,   /* I: vector */
+const svxVector &b    /* I: vector */
+)
+/*
+DESCRIPTION:
+   Dot product.
+*/
+{
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+/*******************************************************************/
+/* Function definition */
+double Distance
+(
+const svxPoint &a,   /* I: point */
+const svxPoint &b    /* I: point */
+)
+/*
+DESCRIPTION:
+   Distance between two points.
+*/
+{
+    const double dx = a.x - b.x, dy = a.y - b.y, dz = a.z - b.z;
+    return sqrt(dx * dx + dy * dy + dz * dz);
+}
+
+/*******************************************************************/
+/* Function definition */
+PointProjector::PointProjector
+(
+)
+/*
+DESCRIPTION:
+   Create a projector without target.
+*/
+{
+}
+
+/*******************************************************************/
+/* Function definition */
+void PointProjector::Clear
+(
+void
+)
+/*
+DESCRIPTION:
+   Remove all targets.
+*/
+{
+    m_targets.clear();
+    m_surfaces.clear();
+    m_curves.clear();
+}
+
+/*******************************************************************/
+/* Function definition */
+int Breaks
+(
+const svxParameters &knots,     /* I: knot data */
+svxLimit domain,                /* I: parameter range */
+std::vector<double> &breaks     /* O: distinct knots inside the range, ends included */
+)
+/*
+DESCRIPTION:
+   Cut a parameter range at its knots.
+
+   Return the number of spans.
+*/
+{
+    breaks.assign(1, domain.min);
+    for (int i = 0; i < knots.num_knots; i++)
+    {
+        const double knot = knots.knots[i];
+        if (knot > breaks.back() && knot < domain.max)
+            breaks.push_back(knot);
+    }
+    breaks.push_back(domain.max);
+    return (int)breaks.size() - 1;
+}
+
+/*******************************************************************/
+/* Function definition */
+void SampleParameters
+(
+const std::vector<double> &breaks,   /* I: span ends */
+int perSpan,                         /* I: samples per span */
+int limit,                           /* I: samples at most */
+std::vector<double> &parameters      /* O: sample parameters */
+)
+/*
+DESCRIPTION:
+   Parameters of the seed samples: "perSpan" even steps per knot span and
+the end of the range, or "limit" even steps of the whole range if that
+is more.
+*/
+{
+    const int spans = (int)breaks.size() - 1;
+    parameters.clear();
+    if (spans * perSpan + 1 > limit)
+    {
+        for (int i = 0; i < limit; i++)
+            parameters.push_back(breaks[0] + (breaks[spans] - breaks[0]) * i / (limit - 1));
+        return;
+    }
+    for (int s = 0; s < spans; s++)
+    {
+        for (int i = 0; i < perSpan; i++)
+            parameters.push_back(breaks[s] + (breaks[s + 1] - breaks[s]) * i / perSpan);
+    }
+    parameters.push_back(breaks[spans]);
+}
+
+/*******************************************************************/
+/* Function definition */
+int PointProjector::AddSurface
+(
+const svxSurface &surface   /* I: surface data of cvxPartInqFaceSrf() */
+)
+/*
+DESCRIPTION:
+   Copy a NURBS surface and sample it for the seeds.
+
+   Return the index of the target, or -1 if the surface is invalid.
+*/
+{
+    NurbsSurfaceEvaluator evaluator;
+    if (evaluator.Init(surface))
+        return -1;
+
+    Target target;
+    target.type = VX_CRV_NURB;
+    target.surface = (int)m_surfaces.size();
+    target.curve = -1;
+    target.closedU = surface.U.closed ? 1 : 0;
+    target.closedV = surface.V.closed ? 1 : 0;
+    target.domainU = evaluator.DomainU();
+    target.domainV = evaluator.DomainV();
+    target.radius = target.angle = target.sweep = 0.0;
+
+    std::vector<double> breaks;
+    Breaks(surface.U, target.domainU, breaks);
+    SampleParameters(breaks, surface.U.degree + 1, PROJECT_MAX_GRID, target.u);
+    Breaks(surface.V, target.domainV, breaks);
+    SampleParameters(breaks, surface.V.degree + 1, PROJECT_MAX_GRID, target.v);
+
+    SurfaceSamples samples;
+    if (evaluator.EvaluateGrid((int)target.u.size(), target.u.data(), (int)target.v.size(), target.v.data(), &samples))
+        return -1;
+    std::vector<svxPoint> points(samples.count);
+    for (int k = 0; k < samples.count; k++)
+    {
+        points[k].x = samples.x[k];
+        points[k].y = samples.y[k];
+        points[k].z = samples.z[k];
+    }
+    target.tree.Build((int)points.size(), points.data());
+
+    m_surfaces.push_back(evaluator);
+    m_targets.push_back(target);
+    return (int)m_targets.size() - 1;
+}
+
+/*******************************************************************/
+/* Function definition */
+int PointProjector::AddCurve
+(
+const svxCurve &curve   /* I: curve data of cvxPartInqCurve() */
+)
+/*
+DESCRIPTION:
+   Copy a curve, and sample it for the seeds if it is a NURBS curve.
+Arcs and circles with a frame have their center at the frame origin and
+lie in its XY plane; without a frame (identity) they are centered at P1.
+
+   Return the index of the target, or -1 if the curve type or its data is
+not supported.
+*/
+{
+    Target target;
+    target.type = curve.Type;
+    target.surface = -1;
+    target.curve = -1;
+    target.closedU = target.closedV = 0;
+    target.domainV.min = target.domainV.max = 0.0;
+    target.start = curve.P1;
+    target.end = curve.P2;
+    target.center = curve.P1;
+    target.xAxis.x = 1.0;
+    target.xAxis.y = target.xAxis.z = 0.0;
+    target.yAxis.y = 1.0;
+    target.yAxis.x = target.yAxis.z = 0.0;
+    target.radius = curve.R;
+    target.angle = curve.A1;
+    target.sweep = 0.0;
+
+    switch (curve.Type)
+    {
+    case VX_CRV_LINE:
+        target.domainU.min = 0.0;
+        target.domainU.max = 1.0;
+        break;
+
+    case VX_CRV_ARC:
+    case VX_CRV_CIRCLE:
+        if (!(curve.R > 0.0))
+            return -1;
+        if (!curve.Frame.identity)
+        {
+            target.center.x = curve.Frame.xt;
+            target.center.y = curve.Frame.yt;
+            target.center.z = curve.Frame.zt;
+            target.xAxis.x = curve.Frame.xx;
+            target.xAxis.y = curve.Frame.yx;
+            target.xAxis.z = curve.Frame.zx;
+            target.yAxis.x = curve.Frame.xy;
+            target.yAxis.y = curve.Frame.yy;
+            target.yAxis.z = curve.Frame.zy;
+        }
+        if (curve.Type == VX_CRV_CIRCLE)
+        {
+            target.sweep = 360.0;
+            target.closedU = 1;
+        }
+        else
+        {
+            double sweep = curve.A2 - curve.A1;
+            while (sweep <= 0.0)
+                sweep += 360.0;
+            target.sweep = sweep > 360.0 ? 360.0 : sweep;
+        }
+        target.domainU.min = target.angle;
+        target.domainU.max = target.angle + target.sweep;
+        break;
+
+    case VX_CRV_NURB:
+    {
+        NurbsCurveEvaluator evaluator;
+        if (evaluator.Init(curve))
+            return -1;
+        target.curve = (int)m_curves.size();
+        target.closedU = curve.T.closed ? 1 : 0;
+        target.domainU = evaluator.Domain();
+
+        std::vector<double> breaks;
+        Breaks(curve.T, target.domainU, breaks);
+        SampleParameters(breaks, 2 * (evaluator.Degree() + 1), PROJECT_MAX_SAMPLES, target.u);
+        std::vector<svxPoint> points(target.u.size());
+        if (evaluator.EvaluatePoints((int)target.u.size(), target.u.data(), points.data()))
+            return -1;
+        target.tree.Build((int)points.size(), points.data());
+        m_curves.push_back(evaluator);
+        break;
+    }
+
+    default:
+        return -1;
+    }
+
+    m_targets.push_back(target);
+    return (int)m_targets.size() - 1;
+}
+
+/*******************************************************************/
+/* Function definition */
+int PointProjector::Domain
+(
+int target,     /* I: target */
+svxLimit *u,    /* O: U range, or curve parameter range */
+svxLimit *v     /* O: V range, 0 to 0 for curves */
+) const
+/*
+DESCRIPTION:
+   Parameter ranges of a target.
+
+   Return 1 if the target does not exist, else 0.
+*/
+{
+    if (target < 0 || target >= Count())
+        return 1;
+    *u = m_targets[target].domainU;
+    *v = m_targets[target].domainV;
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int PointProjector::CurvePoint
+(
+const Target &target,   /* I: curve target */
+double t,               /* I: parameter */
+svxPoint *point,        /* O: point */
+svxVector *tangent      /* O: derivative w/r t */
+) const
+/*
+DESCRIPTION:
+   Point and derivative of a curve target.
+
+   Return 1 if the evaluation fails, else 0.
+*/
+{
+    if (target.curve >= 0)
+    {
+        svxEvalCurv eval;
+        if (m_curves[target.curve].Evaluate(t, 1, &eval))
+            return 1;
+        *point = eval.pnt;
+        tangent->x = eval.deriv_1.x;
+        tangent->y = eval.deriv_1.y;
+        tangent->z = eval.deriv_1.z;
+    }
+    else if (target.type == VX_CRV_LINE)
+    {
+        point->x = target.start.x + t * (target.end.x - target.start.x);
+        point->y = target.start.y + t * (target.end.y - target.start.y);
+        point->z = target.start.z + t * (target.end.z - target.start.z);
+        tangent->x = target.end.x - target.start.x;
+        tangent->y = target.end.y - target.start.y;
+        tangent->z = target.end.z - target.start.z;
+    }
+    else
+    {
+        const double a = t * PROJECT_PI / 180.0, c = cos(a), s = sin(a);
+        point->x = target.center.x + target.radius * (c * target.xAxis.x + s * target.yAxis.x);
+        point->y = target.center.y + target.radius * (c * target.xAxis.y + s * target.yAxis.y);
+        point->z = target.center.z + target.radius * (c * target.xAxis.z + s * target.yAxis.z);
+        tangent->x = c * target.yAxis.x - s * target.xAxis.x;
+        tangent->y = c * target.yAxis.y - s * target.xAxis.y;
+        tangent->z = c * target.yAxis.z - s * target.xAxis.z;
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int PointProjector::Evaluate
+(
+int target,           /* I: target */
+double u,             /* I: U, or curve parameter */
+double v,             /* I: V, ignored for curves */
+svxPoint *point,      /* O: point */
+svxVector *normal     /* O: surface: unit normal; curve: unit tangent (NULL to ignore) */
+) const
+/*
+DESCRIPTION:
+   Point of a target at a parameter.
+
+   Return 1 if the target does not exist or the evaluation fails, else 0.
+*/
+{
+    if (target < 0 || target >= Count())
+        return 1;
+    const Target &item = m_targets[target];
+    if (item.surface >= 0)
+        return m_surfaces[item.surface].Evaluate(u, v, point, normal, nullptr, nullptr);
+
+    svxVector tangent;
+    if (CurvePoint(item, u, point, &tangent))
+        return 1;
+    if (normal)
+    {
+        const double length = sqrt(Dot(tangent, tangent));
+        normal->x = length > 0.0 ? tangent.x / length : 0.0;
+        normal->y = length > 0.0 ? tangent.y / length : 0.0;
+        normal->z = length > 0.0 ? tangent.z / length : 0.0;
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void PointProjector::SurfaceNewton
+(
+const Target &target,        /* I: surface target */
+const svxPoint &point,       /* I: query point */
+double u,                    /* I: seed U */
+double v,                    /* I: seed V */
+double tolerance,            /* I: foot point move that ends the iterations */
+SurfaceSamples &scratch,     /* I/O: evaluation buffer */
+ProjectResult *result        /* O: foot point */
+) const
+/*
+DESCRIPTION:
+   Refine a seed with Newton steps on the gradient of half the squared
+distance, (Su . (S - P), Sv . (S - P)). Its Hessian is the Gauss-Newton
+part [Su . Su, Su . Sv; Su . Sv, Sv . Sv] minus the curvature part
+[Suu . (P - S), ...], whose second derivatives come from the tangents at
+two nearby parameters (the evaluator gives first derivatives only).
+Where that Hessian is not positive definite, far on the concave side,
+the Gauss-Newton part alone is used. A step that does not get closer is
+halved, a parameter leaving the domain is clamped (or wrapped).
+
+   A parameter on an edge of an open domain whose gradient points out of
+it is held there, and the step is a 1D Newton step along the other one,
+so the foot point slides along the boundary. The foot point has
+converged when the projected gradient vanishes: when the Gauss-Newton
+step of the free parameters moves it less than the tolerance.
+*/
+{
+    const NurbsSurfaceEvaluator &surface = m_surfaces[target.surface];
+    svxPoint s;
+    svxVector n, su, sv;
+    result->status = Project_Failed;
+    result->distance = DBL_MAX;
+    if (surface.EvaluateList(1, &u, &v, &scratch))
+        return;
+    SampleGet(scratch, &s, &n, &su, &sv);
+    double distance = Distance(point, s);
+
+    int iteration = 0;
+    ProjectStatus status = Project_Iterated;
+    for (; iteration < PROJECT_MAX_ITERATIONS; iteration++)
+    {
+        const svxVector r = { point.x - s.x, point.y - s.y, point.z - s.z };
+        double a = Dot(su, su), b = Dot(su, sv), c = Dot(sv, sv);
+        const double gu = Dot(su, r), gv = Dot(sv, r);
+
+        /* active set: parameters on an edge of an open domain, the gradient pointing out of it */
+        const int heldU = !target.closedU && ((u <= target.domainU.min && gu < 0.0) || (u >= target.domainU.max && gu > 0.0));
+        const int heldV = !target.closedV && ((v <= target.domainV.min && gv < 0.0) || (v >= target.domainV.max && gv > 0.0));
+
+        /* squared foot point move of the Gauss-Newton step of the free parameters */
+        const double gaussDet = a * c - b * b;
+        double predicted = 0.0;
+        if (!heldU && !heldV && gaussDet > 1.0e-12 * a * c)
+            predicted = (c * gu * gu - 2.0 * b * gu * gv + a * gv * gv) / gaussDet;
+        else
+            predicted = (heldU || !(a > 0.0) ? 0.0 : gu * gu / a) + (heldV || !(c > 0.0) ? 0.0 : gv * gv / c);
+        if (predicted < tolerance * tolerance)
+        {
+            status = Project_Converged;
+            break;
+        }
+
+        /* curvature term of the Hessian, second derivatives by differences of the tangents */
+        const double hu = PROJECT_DIFFERENCE * (target.domainU.max - target.domainU.min);
+        const double hv = PROJECT_DIFFERENCE * (target.domainV.max - target.domainV.min);
+        const double stepU = u + hu <= target.domainU.max ? hu : -hu, stepV = v + hv <= target.domainV.max ? hv : -hv;
+        const double pu = u + stepU, pv = v + stepV;
+        svxPoint other;
+        svxVector on, ou, ov;
+        if (stepU != 0.0 && stepV != 0.0 && !surface.EvaluateList(1, &pu, &v, &scratch))
+        {
+            SampleGet(scratch, &other, &on, &ou, &ov);
+            const svxVector suu = { (ou.x - su.x) / stepU, (ou.y - su.y) / stepU, (ou.z - su.z) / stepU };
+            const svxVector suv = { (ov.x - sv.x) / stepU, (ov.y - sv.y) / stepU, (ov.z - sv.z) / stepU };
+            if (!surface.EvaluateList(1, &u, &pv, &scratch))
+            {
+                SampleGet(scratch, &other, &on, &ou, &ov);
+                const svxVector svv = { (ov.x - sv.x) / stepV, (ov.y - sv.y) / stepV, (ov.z - sv.z) / stepV };
+                const double ea = a - Dot(suu, r), eb = b - Dot(suv, r), ec = c - Dot(svv, r);
+                if (ea > 0.0 && ea * ec - eb * eb > 1.0e-12 * ea * ec)
+                {
+                    a = ea;
+                    b = eb;
+                    c = ec;
+                }
+            }
+        }
+
+        const double det = a * c - b * b;
+        double du = 0.0, dv = 0.0;
+        if (heldU || heldV)
+        {
+            /* along the boundary: the held parameter stays */
+            du = heldU || !(a > 0.0) ? 0.0 : gu / a;
+            dv = heldV || !(c > 0.0) ? 0.0 : gv / c;
+        }
+        else if (det > 1.0e-12 * a * c)
+        {
+            du = (c * gu - b * gv) / det;
+            dv = (a * gv - b * gu) / det;
+        }
+        else
+        {
+            /* degenerate point (pole): each direction alone */
+            du = a > 0.0 ? gu / a : 0.0;
+            dv = c > 0.0 ? gv / c : 0.0;
+        }
+
+        int accepted = 0;
+        double lambda = 1.0;
+        svxPoint next = s;
+        for (int h = 0; h <= PROJECT_HALVINGS && !accepted; h++, lambda *= 0.5)
+        {
+            const double nu = ParameterFit(u + lambda * du, target.domainU, target.closedU);
+            const double nv = ParameterFit(v + lambda * dv, target.domainV, target.closedV);
+            if (surface.EvaluateList(1, &nu, &nv, &scratch))
+                break;
+            svxPoint trial;
+            svxVector tn, tu, tv;
+            SampleGet(scratch, &trial, &tn, &tu, &tv);
+            const double trialDistance = Distance(point, trial);
+            if (trialDistance <= distance)
+            {
+                accepted = 1;
+                next = trial;
+                u = nu;
+                v = nv;
+                n = tn;
+                su = tu;
+                sv = tv;
+                distance = trialDistance;
+            }
+        }
+        s = next;
+        if (!accepted)
+        {
+            /* no step of the line search gets closer: rounding level, the gradient does not vanish */
+            iteration++;
+            break;
+        }
+    }
+
+    result->point = s;
+    result->normal = n;
+    result->u = u;
+    result->v = v;
+    result->distance = distance;
+    result->iterations = iteration;
+    result->status = status;
+}
+
+/*******************************************************************/
+/* Function definition */
+void PointProjector::CurveNewton
+(
+const Target &target,        /* I: NURBS curve target */
+const svxPoint &point,       /* I: query point */
+double t,                    /* I: seed parameter */
+double tolerance,            /* I: foot point move that ends the iterations */
+ProjectResult *result        /* O: foot point */
+) const
+/*
+DESCRIPTION:
+   Refine a seed with Newton steps on f(t) = C'(t) . (C(t) - P), using
+f'(t) = C' . C' + C'' . (C - P), or C' . C' alone where f' is not
+positive (far from a concave side). A step that does not get closer is
+halved, a parameter leaving the domain is clamped (or wrapped).
+*/
+{
+    const NurbsCurveEvaluator &curve = m_curves[target.curve];
+    svxEvalCurv eval;
+    result->status = Project_Failed;
+    result->distance = DBL_MAX;
+    if (curve.Evaluate(t, 2, &eval))
+        return;
+    double distance = Distance(point, eval.pnt);
+
+    int iteration = 0;
+    ProjectStatus status = Project_Iterated;
+    for (; iteration < PROJECT_MAX_ITERATIONS; iteration++)
+    {
+        const svxVector r = { eval.pnt.x - point.x, eval.pnt.y - point.y, eval.pnt.z - point.z };
+        const svxVector d1 = { eval.deriv_1.x, eval.deriv_1.y, eval.deriv_1.z };
+        const svxVector d2 = { eval.deriv_2.x, eval.deriv_2.y, eval.deriv_2.z };
+        const double speed = Dot(d1, d1), f = Dot(d1, r);
+        double fp = speed + Dot(d2, r);
+        fp = fp > 0.0 ? fp : speed;
+        if (!(fp > 0.0))
+        {
+            status = Project_Converged;
+            break;
+        }
+        const double dt = -f / fp;
+
+        int accepted = 0;
+        double lambda = 1.0;
+        svxPoint previous = eval.pnt;
+        for (int h = 0; h <= PROJECT_HALVINGS && !accepted; h++, lambda *= 0.5)
+        {
+            const double nt = ParameterFit(t + lambda * dt, target.domainU, target.closedU);
+            svxEvalCurv trial;
+            if (curve.Evaluate(nt, 2, &trial))
+                break;
+            const double trialDistance = Distance(point, trial.pnt);
+            if (trialDistance <= distance)
+            {
+                accepted = 1;
+                eval = trial;
+                t = nt;
+                distance = trialDistance;
+            }
+        }
+        if (!accepted || Distance(previous, eval.pnt) < tolerance)
+        {
+            status = Project_Converged;
+            iteration++;
+            break;
+        }
+    }
+
+    result->point = eval.pnt;
+    result->normal.x = distance > 0.0 ? (point.x - eval.pnt.x) / distance : 0.0;
+    result->normal.y = distance > 0.0 ? (point.y - eval.pnt.y) / distance : 0.0;
+    result->normal.z = distance > 0.0 ? (point.z - eval.pnt.z) / distance : 0.0;
+    result->u = t;
+    result->v = 0.0;
+    result->distance = distance;
+    result->iterations = iteration;
+    result->status = status;
+}
+
+/*******************************************************************/
+/* Function definition */
+void PointProjector::AnalyticProject
+(
+const Target &target,     /* I: line, arc or circle target */
+const svxPoint &point,    /* I: query point */
+ProjectResult *result     /* O: foot point */
+) const
+/*
+DESCRIPTION:
+   Exact projection onto a line segment, or onto an arc: the point at the
+angle of the query in the arc plane, or the nearer end when that angle is
+outside the arc.
+*/
+{
+    double t = 0.0;
+    if (target.type == VX_CRV_LINE)
+    {
+        const svxVector d = { target.end.x - target.start.x, target.end.y - target.start.y,
+            target.end.z - target.start.z };
+        const svxVector q = { point.x - target.start.x, point.y - target.start.y, point.z - target.start.z };
+        const double square = Dot(d, d);
+        t = square > 0.0 ? Dot(q, d) / square : 0.0;
+        t = t < 0.0 ? 0.0 : (t > 1.0 ? 1.0 : t);
+    }
+    else
+    {
+        const svxVector q = { point.x - target.center.x, point.y - target.center.y, point.z - target.center.z };
+        const double x = Dot(q, target.xAxis), y = Dot(q, target.yAxis);
+        const double angle = x == 0.0 && y == 0.0 ? target.angle : atan2(y, x) * 180.0 / PROJECT_PI;
+        double offset = fmod(angle - target.angle, 360.0);
+        offset += offset < 0.0 ? 360.0 : 0.0;
+        if (offset <= target.sweep)
+            t = target.angle + offset;
+        else
+            t = offset - target.sweep < 360.0 - offset ? target.angle + target.sweep : target.angle;
+    }
+
+    svxVector tangent;
+    CurvePoint(target, t, &result->point, &tangent);
+    result->distance = Distance(point, result->point);
+    result->normal.x = result->distance > 0.0 ? (point.x - result->point.x) / result->distance : 0.0;
+    result->normal.y = result->distance > 0.0 ? (point.y - result->point.y) / result->distance : 0.0;
+    result->normal.z = result->distance > 0.0 ? (point.z - result->point.z) / result->distance : 0.0;
+    result->u = t;
+    result->v = 0.0;
+    result->iterations = 0;
+    result->status = Project_Converged;
+}
+
+/*******************************************************************/
+/* Function definition */
+void PointProjector::Query
+(
+const svxPoint &point,            /* I: query point */
+int target,                       /* I: target, -1 for the closest of all */
+const ProjectOptions &options,    /* I: settings */
+SurfaceSamples &scratch,          /* I/O: evaluation buffer */
+ProjectResult *result             /* O: foot point */
+) const
+/*
+DESCRIPTION:
+   Project one point: refine the nearest samples of the target and keep
+the closest foot point.
+*/
+{
+    memset(result, 0, sizeof(*result));
+    result->distance = DBL_MAX;
+    result->status = Project_Failed;
+    result->target = -1;
+
+    const int first = target < 0 ? 0 : target, end = target < 0 ? Count() : target + 1;
+    if (target >= Count())
+        return;
+    const int seeds = options.seeds < 1 ? 1 : (options.seeds > PROJECT_MAX_SEEDS ? PROJECT_MAX_SEEDS : options.seeds);
+
+    for (int t = first; t < end; t++)
+    {
+        const Target &item = m_targets[t];
+        ProjectResult candidate;
+        if (item.surface < 0 && item.curve < 0)
+        {
+            AnalyticProject(item, point, &candidate);
+            candidate.target = t;
+            if (candidate.distance < result->distance)
+                *result = candidate;
+            continue;
+        }
+
+        int items[PROJECT_MAX_SEEDS];
+        const int found = item.tree.Nearest(point, seeds, items, nullptr);
+        for (int s = 0; s < found; s++)
+        {
+            if (item.surface >= 0)
+            {
+                const int columns = (int)item.u.size();
+                SurfaceNewton(item, point, item.u[items[s] % columns], item.v[items[s] / columns], options.tolerance,
+                    scratch, &candidate);
+            }
+            else
+                CurveNewton(item, point, item.u[items[s]], options.tolerance, &candidate);
+            candidate.target = t;
+            if (candidate.status != Project_Failed && candidate.distance < result->distance)
+                *result = candidate;
+        }
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+int PointProjector::ProjectPoint
+(
+const svxPoint &point,            /* I: query point */
+int target,                       /* I: target, -1 for the closest of all */
+const ProjectOptions &options,    /* I: settings */
+ProjectResult *result             /* O: foot point */
+) const
+/*
+DESCRIPTION:
+   Project one point onto a target.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    SurfaceSamples scratch;
+    Query(point, target, options, scratch, result);
+    return result->status == Project_Failed ? 1 : 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void PointProjector::TaskRun
+(
+void *data,    /* I: running batch */
+int begin,     /* I: first query */
+int end,       /* I: end of the range */
+int worker     /* I: worker running the range */
+)
+/*
+DESCRIPTION:
+   Project a range of queries with the buffer of the worker.
+*/
+{
+    Batch *batch = (Batch *)data;
+    SurfaceSamples &scratch = batch->scratch[worker];
+    for (int i = begin; i < end; i++)
+    {
+        batch->self->Query(batch->points[i], batch->targets ? batch->targets[i] : -1, *batch->options, scratch,
+            &batch->results[i]);
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+int PointProjector::Project
+(
+int count,                        /* I: number of queries */
+const svxPoint *points,           /* I: query points */
+const int *targets,               /* I: target per query, -1 for the closest of all (NULL: all -1) */
+const ProjectOptions &options,    /* I: settings */
+WorkPool *pool,                   /* I: pool running the queries, nullptr for this thread only */
+ProjectResult *results            /* O: foot point per query */
+) const
+/*
+DESCRIPTION:
+   Project a batch of points.
+
+   Return the number of failed queries, or -1 if there is no target or
+the input is invalid.
+*/
+{
+    if (m_targets.empty() || count < 0 || (count > 0 && (points == nullptr || results == nullptr)))
+        return -1;
+
+    Batch batch;
+    batch.self = this;
+    batch.points = points;
+    batch.targets = targets;
+    batch.options = &options;
+    batch.results = results;
+    batch.scratch.resize(pool != nullptr ? pool->ThreadCount() : 1);
+    if (pool != nullptr)
+        pool->Run(count, PROJECT_GRAIN, TaskRun, &batch);
+    else
+        TaskRun(&batch, 0, count, 0);
+
+    int failed = 0;
+    for (int i = 0; i < count; i++)
+        failed += results[i].status == Project_Failed ? 1 : 0;
+    return failed;
+}
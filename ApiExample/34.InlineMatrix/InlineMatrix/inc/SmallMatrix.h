@@ -0,0 +1,517 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+#pragma once
+
+/* ZW3D API includes */
+#include "zwapi_util.h"
+#include "zwapi_matrix_data.h"
+
+/* Application includes */
+#include <math.h>
+#include <float.h>
+#include <stddef.h>
+#include <type_traits>
+
+/*
+DESCRIPTION:
+   Header-only small matrix algebra on types with the memory layout of
+the ZW3D matrices, for loops where the by-value C calls of zwapi_matrix.h
+(ZwMatrixInvert(), ZwMatrix3Determinant(), ...) and the cvxMat*() calls
+of zwapi_math_matrix.h can not be inlined.
+
+   SmallMatrix<2> and SmallMatrix<3> are szwMatrix2 and szwMatrix3,
+SmallFrame is svxMatrix and SmallTransform is szwMatrix; the sizes are
+checked by static_assert below, and SmallFromZw() / SmallToZw() convert
+member by member.
+
+   m[i][j] is row i, column j of a matrix mapping column vectors. The
+ZW3D matrices store their axes one after the other, X = (xx, yx, zx) first,
+and those are the columns: m[0] is (xx, xy, xz, xt), x' = xx*x + xy*y +
+xz*z + xt, as in 27.BatchTransform. The conversions transpose the memory
+order, so do not cast a ZW3D matrix to these types. The row "ox, oy, oz,
+scale" of szwMatrix takes no effect in ZW3D; results have (0, 0, 0, 1)
+there. The identity flag is trusted as by ZW3D (ZwMatrixIdentityFlagRefresh()).
+
+   Multiply, transpose, determinant, inverse and point transforms are
+constexpr (C++17). Functions needing sqrt or trigonometry (normalize,
+orthonormalize, Euler angles) are inline only, as those are not constexpr
+before C++26.
+
+   Euler angles follow ezwEulerAngleSequence: the rotations are about
+the fixed axes in the order of the sequence, the first angle first, so
+ZW_EULER_RPY is R = Rz(ang3rd) * Ry(ang2nd) * Rx(ang1st). ~InlineMatrixCheck
+compares every sequence with ZwEulerAngleToMatrix() and ZwMatrixToEulerAngle().
+*/
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: N x N matrix, szwMatrix2 (N = 2) and szwMatrix3 (N = 3) */
+template <int N>
+struct SmallMatrix
+{
+    double m[N][N];
+};
+
+/* DESCRIPTION: svxMatrix */
+struct SmallFrame
+{
+    char identity;
+    double m[3][4];      /* rotation/scale part, then the offset column */
+};
+
+/* DESCRIPTION: szwMatrix */
+struct SmallTransform
+{
+    char identity;
+    double m[3][4];      /* rotation/scale part, then the offset column */
+    double origin[3];    /* ox, oy, oz, no effect */
+    double scale;        /* no effect */
+};
+
+static_assert(std::is_standard_layout<SmallMatrix<3>>::value && std::is_standard_layout<SmallTransform>::value,
+    "small matrices must be standard layout");
+static_assert(sizeof(SmallMatrix<2>) == sizeof(szwMatrix2) && offsetof(szwMatrix2, yx) == sizeof(double) &&
+    offsetof(szwMatrix2, xy) == 2 * sizeof(double), "SmallMatrix<2> must match szwMatrix2");
+static_assert(sizeof(SmallMatrix<3>) == sizeof(szwMatrix3) && offsetof(szwMatrix3, xy) == 3 * sizeof(double) &&
+    offsetof(szwMatrix3, zz) == 8 * sizeof(double), "SmallMatrix<3> must match szwMatrix3");
+static_assert(sizeof(SmallFrame) == sizeof(svxMatrix) && offsetof(SmallFrame, m) == offsetof(svxMatrix, xx) &&
+    offsetof(svxMatrix, xt) == offsetof(svxMatrix, xx) + 3 * sizeof(double) &&
+    offsetof(svxMatrix, zt) == offsetof(svxMatrix, xx) + 11 * sizeof(double), "SmallFrame must match svxMatrix");
+static_assert(sizeof(SmallTransform) == sizeof(szwMatrix) && offsetof(SmallTransform, m) == offsetof(szwMatrix, xx) &&
+    offsetof(szwMatrix, zt) == offsetof(szwMatrix, xx) + 11 * sizeof(double) &&
+    offsetof(SmallTransform, origin) == offsetof(szwMatrix, ox) &&
+    offsetof(SmallTransform, scale) == offsetof(szwMatrix, scale), "SmallTransform must match szwMatrix");
+
+/*******************************************************************/
+/* Function definition */
+constexpr SmallMatrix<2> SmallFromZw(const szwMatrix2 &a)
+{
+    return SmallMatrix<2>{ { { a.xx, a.xy }, { a.yx, a.yy } } };
+}
+
+constexpr SmallMatrix<3> SmallFromZw(const szwMatrix3 &a)
+{
+    return SmallMatrix<3>{ { { a.xx, a.xy, a.xz }, { a.yx, a.yy, a.yz }, { a.zx, a.zy, a.zz } } };
+}
+
+constexpr SmallFrame SmallFromZw(const svxMatrix &a)
+{
+    return SmallFrame{ a.identity, { { a.xx, a.xy, a.xz, a.xt }, { a.yx, a.yy, a.yz, a.yt }, { a.zx, a.zy, a.zz, a.zt } } };
+}
+
+constexpr SmallTransform SmallFromZw(const szwMatrix &a)
+{
+    return SmallTransform{ a.identity, { { a.xx, a.xy, a.xz, a.xt }, { a.yx, a.yy, a.yz, a.yt }, { a.zx, a.zy, a.zz, a.zt } },
+        { a.ox, a.oy, a.oz }, a.scale };
+}
+
+constexpr szwMatrix2 SmallToZw(const SmallMatrix<2> &a)
+{
+    return szwMatrix2{ a.m[0][0], a.m[1][0], a.m[0][1], a.m[1][1] };
+}
+
+constexpr szwMatrix3 SmallToZw(const SmallMatrix<3> &a)
+{
+    return szwMatrix3{ a.m[0][0], a.m[1][0], a.m[2][0], a.m[0][1], a.m[1][1], a.m[2][1], a.m[0][2], a.m[1][2], a.m[2][2] };
+}
+
+constexpr svxMatrix SmallToZw(const SmallFrame &a)
+{
+    return svxMatrix{ a.identity, a.m[0][0], a.m[1][0], a.m[2][0], a.m[0][3], a.m[0][1], a.m[1][1], a.m[2][1], a.m[1][3],
+        a.m[0][2], a.m[1][2], a.m[2][2], a.m[2][3] };
+}
+
+constexpr szwMatrix SmallToZw(const SmallTransform &a)
+{
+    return szwMatrix{ a.identity, a.m[0][0], a.m[1][0], a.m[2][0], a.m[0][3], a.m[0][1], a.m[1][1], a.m[2][1], a.m[1][3],
+        a.m[0][2], a.m[1][2], a.m[2][2], a.m[2][3], a.origin[0], a.origin[1], a.origin[2], a.scale };
+}
+
+/*******************************************************************/
+/* Function definition */
+/* DESCRIPTION: SmallFrame and SmallTransform are the same map */
+constexpr SmallTransform SmallTransformFrom(const SmallFrame &a)
+{
+    return SmallTransform{ a.identity, { { a.m[0][0], a.m[0][1], a.m[0][2], a.m[0][3] }, { a.m[1][0], a.m[1][1], a.m[1][2],
+        a.m[1][3] }, { a.m[2][0], a.m[2][1], a.m[2][2], a.m[2][3] } }, { 0.0, 0.0, 0.0 }, 1.0 };
+}
+
+constexpr SmallFrame SmallFrameFrom(const SmallTransform &a)
+{
+    return SmallFrame{ a.identity, { { a.m[0][0], a.m[0][1], a.m[0][2], a.m[0][3] }, { a.m[1][0], a.m[1][1], a.m[1][2],
+        a.m[1][3] }, { a.m[2][0], a.m[2][1], a.m[2][2], a.m[2][3] } } };
+}
+
+/*******************************************************************/
+/* Function definition */
+template <int N>
+constexpr SmallMatrix<N> SmallIdentity()
+{
+    SmallMatrix<N> r{};
+    for (int i = 0; i < N; i++)
+        r.m[i][i] = 1.0;
+    return r;
+}
+
+template <int N>
+constexpr SmallMatrix<N> SmallMultiply(const SmallMatrix<N> &a, const SmallMatrix<N> &b)
+{
+    SmallMatrix<N> r{};
+    for (int i = 0; i < N; i++)
+    {
+        for (int j = 0; j < N; j++)
+        {
+            double sum = 0.0;
+            for (int k = 0; k < N; k++)
+                sum += a.m[i][k] * b.m[k][j];
+            r.m[i][j] = sum;
+        }
+    }
+    return r;
+}
+
+template <int N>
+constexpr SmallMatrix<N> SmallTranspose(const SmallMatrix<N> &a)
+{
+    SmallMatrix<N> r{};
+    for (int i = 0; i < N; i++)
+    {
+        for (int j = 0; j < N; j++)
+            r.m[i][j] = a.m[j][i];
+    }
+    return r;
+}
+
+/* DESCRIPTION: same as ZwMatrix2Determinant() and ZwMatrix3Determinant() */
+template <int N>
+constexpr double SmallDeterminant(const SmallMatrix<N> &a)
+{
+    static_assert(N == 2 || N == 3, "determinant of 2x2 and 3x3 matrices");
+    if constexpr (N == 2)
+        return a.m[0][0] * a.m[1][1] - a.m[0][1] * a.m[1][0];
+    else
+        return a.m[0][0] * (a.m[1][1] * a.m[2][2] - a.m[1][2] * a.m[2][1]) -
+            a.m[0][1] * (a.m[1][0] * a.m[2][2] - a.m[1][2] * a.m[2][0]) +
+            a.m[0][2] * (a.m[1][0] * a.m[2][1] - a.m[1][1] * a.m[2][0]);
+}
+
+/*
+DESCRIPTION:
+   Inverse by the adjugate. Return 1 and a zero matrix if the matrix is
+singular, else 0.
+*/
+template <int N>
+constexpr int SmallInvert(const SmallMatrix<N> &a, SmallMatrix<N> *inverse)
+{
+    static_assert(N == 2 || N == 3, "inverse of 2x2 and 3x3 matrices");
+    const double det = SmallDeterminant(a);
+    SmallMatrix<N> r{};
+    if ((det < 0.0 ? -det : det) < DBL_MIN)
+    {
+        *inverse = r;
+        return 1;
+    }
+    if constexpr (N == 2)
+    {
+        r.m[0][0] = a.m[1][1] / det;
+        r.m[0][1] = -a.m[0][1] / det;
+        r.m[1][0] = -a.m[1][0] / det;
+        r.m[1][1] = a.m[0][0] / det;
+    }
+    else
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            const int i1 = (i + 1) % 3, i2 = (i + 2) % 3;
+            for (int j = 0; j < 3; j++)
+            {
+                const int j1 = (j + 1) % 3, j2 = (j + 2) % 3;
+                /* cofactor of (j, i), the cyclic order gives the sign */
+                r.m[i][j] = (a.m[j1][i1] * a.m[j2][i2] - a.m[j1][i2] * a.m[j2][i1]) / det;
+            }
+        }
+    }
+    *inverse = r;
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+constexpr SmallTransform SmallTransformIdentity()
+{
+    return SmallTransform{ 1, { { 1.0, 0.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0, 0.0 }, { 0.0, 0.0, 1.0, 0.0 } }, { 0.0, 0.0, 0.0 },
+        1.0 };
+}
+
+/* DESCRIPTION: 3x3 part, same as ZwMatrixRotationGet() */
+constexpr SmallMatrix<3> SmallTransformRotation(const SmallTransform &a)
+{
+    return SmallMatrix<3>{ { { a.m[0][0], a.m[0][1], a.m[0][2] }, { a.m[1][0], a.m[1][1], a.m[1][2] },
+        { a.m[2][0], a.m[2][1], a.m[2][2] } } };
+}
+
+/* DESCRIPTION: replace the 3x3 part, same as ZwMatrixRotationSet() */
+constexpr SmallTransform SmallTransformRotationSet(const SmallTransform &a, const SmallMatrix<3> &rotation)
+{
+    SmallTransform r = a;
+    for (int i = 0; i < 3; i++)
+    {
+        for (int j = 0; j < 3; j++)
+            r.m[i][j] = rotation.m[i][j];
+    }
+    r.identity = 0;
+    return r;
+}
+
+/* DESCRIPTION: a * b, the map applying b first, same as ZwMatrixCrossProduct() */
+constexpr SmallTransform SmallTransformMultiply(const SmallTransform &a, const SmallTransform &b)
+{
+    if (a.identity || b.identity)
+        return a.identity ? b : a;
+    SmallTransform r{};
+    for (int i = 0; i < 3; i++)
+    {
+        for (int j = 0; j < 4; j++)
+            r.m[i][j] = a.m[i][0] * b.m[0][j] + a.m[i][1] * b.m[1][j] + a.m[i][2] * b.m[2][j] + (j == 3 ? a.m[i][3] : 0.0);
+    }
+    r.scale = 1.0;
+    return r;
+}
+
+/* DESCRIPTION: determinant of the 3x3 part */
+constexpr double SmallTransformDeterminant(const SmallTransform &a)
+{
+    return a.identity ? 1.0 : SmallDeterminant(SmallTransformRotation(a));
+}
+
+/*
+DESCRIPTION:
+   Inverse map, same as ZwMatrixInvert(). Return 1 and a zero matrix if
+the 3x3 part is singular, else 0.
+*/
+constexpr int SmallTransformInvert(const SmallTransform &a, SmallTransform *inverse)
+{
+    if (a.identity)
+    {
+        *inverse = SmallTransformIdentity();
+        return 0;
+    }
+    SmallMatrix<3> linear{};
+    SmallTransform r{};
+    if (SmallInvert(SmallTransformRotation(a), &linear))
+    {
+        *inverse = r;
+        return 1;
+    }
+    for (int i = 0; i < 3; i++)
+    {
+        for (int j = 0; j < 3; j++)
+            r.m[i][j] = linear.m[i][j];
+        r.m[i][3] = -(linear.m[i][0] * a.m[0][3] + linear.m[i][1] * a.m[1][3] + linear.m[i][2] * a.m[2][3]);
+    }
+    r.scale = 1.0;
+    *inverse = r;
+    return 0;
+}
+
+/* DESCRIPTION: transpose of the full 4x4 matrix, same as ZwMatrixTranspose() */
+constexpr SmallTransform SmallTransformTranspose(const SmallTransform &a)
+{
+    SmallTransform r{};
+    r.identity = a.identity;
+    for (int i = 0; i < 3; i++)
+    {
+        for (int j = 0; j < 3; j++)
+            r.m[i][j] = a.m[j][i];
+        r.m[i][3] = a.origin[i];
+        r.origin[i] = a.m[i][3];
+    }
+    r.scale = a.scale;
+    return r;
+}
+
+/* DESCRIPTION: same as ZwPointTransform() */
+constexpr svxPoint SmallTransformPoint(const SmallTransform &a, const svxPoint &p)
+{
+    return a.identity ? p : svxPoint{ a.m[0][0] * p.x + a.m[0][1] * p.y + a.m[0][2] * p.z + a.m[0][3],
+        a.m[1][0] * p.x + a.m[1][1] * p.y + a.m[1][2] * p.z + a.m[1][3],
+        a.m[2][0] * p.x + a.m[2][1] * p.y + a.m[2][2] * p.z + a.m[2][3] };
+}
+
+/* DESCRIPTION: direction, the offset is not applied */
+constexpr svxVector SmallTransformVector(const SmallTransform &a, const svxVector &v)
+{
+    return a.identity ? v : svxVector{ a.m[0][0] * v.x + a.m[0][1] * v.y + a.m[0][2] * v.z,
+        a.m[1][0] * v.x + a.m[1][1] * v.y + a.m[1][2] * v.z, a.m[2][0] * v.x + a.m[2][1] * v.y + a.m[2][2] * v.z };
+}
+
+/*******************************************************************/
+/* Function definition */
+/*
+DESCRIPTION:
+   Scale the direction columns to unit length, the scale of each axis is
+removed and the angles between them are kept. Return 1 if a column has no length (it is left as is), else 0.
+*/
+inline int SmallTransformNormalize(SmallTransform *a)
+{
+    if (a->identity)
+        return 0;
+    int failed = 0;
+    for (int j = 0; j < 3; j++)
+    {
+        const double length = sqrt(a->m[0][j] * a->m[0][j] + a->m[1][j] * a->m[1][j] + a->m[2][j] * a->m[2][j]);
+        if (!(length > 0.0))
+        {
+            failed = 1;
+            continue;
+        }
+        for (int i = 0; i < 3; i++)
+            a->m[i][j] /= length;
+    }
+    return failed;
+}
+
+/*
+DESCRIPTION:
+   Make the 3x3 part a rotation (or a mirror, if its determinant is
+negative) by Gram-Schmidt: x is normalized, y made normal to x, z is
+x cross y (negated for a mirror). The offset is kept. Return 1 if x and y
+are parallel or null, else 0.
+*/
+inline int SmallTransformOrthonormalize(SmallTransform *a)
+{
+    if (a->identity)
+        return 0;
+    double x[3] = { a->m[0][0], a->m[1][0], a->m[2][0] }, y[3] = { a->m[0][1], a->m[1][1], a->m[2][1] };
+    const double mirror = SmallTransformDeterminant(*a) < 0.0 ? -1.0 : 1.0;
+    const double lx = sqrt(x[0] * x[0] + x[1] * x[1] + x[2] * x[2]);
+    if (!(lx > 0.0))
+        return 1;
+    for (int i = 0; i < 3; i++)
+        x[i] /= lx;
+    const double d = x[0] * y[0] + x[1] * y[1] + x[2] * y[2];
+    for (int i = 0; i < 3; i++)
+        y[i] -= d * x[i];
+    const double ly = sqrt(y[0] * y[0] + y[1] * y[1] + y[2] * y[2]);
+    if (!(ly > DBL_EPSILON * lx))
+        return 1;
+    for (int i = 0; i < 3; i++)
+        y[i] /= ly;
+    const double z[3] = { mirror * (x[1] * y[2] - x[2] * y[1]), mirror * (x[2] * y[0] - x[0] * y[2]),
+        mirror * (x[0] * y[1] - x[1] * y[0]) };
+    for (int i = 0; i < 3; i++)
+    {
+        a->m[i][0] = x[i];
+        a->m[i][1] = y[i];
+        a->m[i][2] = z[i];
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+/*
+DESCRIPTION:
+   Axes of an Euler sequence: the digits of ezwEulerAngleSequence, 1 for
+X to 3 for Z. Return 1 if the sequence is not valid, else 0.
+*/
+inline int SmallEulerAxes(ezwEulerAngleSequence sequence, int *first, int *second, int *third)
+{
+    *first = (int)sequence / 100 - 1;
+    *second = (int)sequence / 10 % 10 - 1;
+    *third = (int)sequence % 10 - 1;
+    return *first < 0 || *first > 2 || *second < 0 || *second > 2 || *third < 0 || *third > 2 ||
+        *first == *second || *second == *third;
+}
+
+/* DESCRIPTION: rotation about axis 0 (X), 1 (Y) or 2 (Z) */
+inline SmallMatrix<3> SmallAxisRotation(int axis, double angle)
+{
+    const double c = cos(angle), s = sin(angle);
+    const int a1 = (axis + 1) % 3, a2 = (axis + 2) % 3;
+    SmallMatrix<3> r{};
+    r.m[axis][axis] = 1.0;
+    r.m[a1][a1] = c;
+    r.m[a1][a2] = -s;
+    r.m[a2][a1] = s;
+    r.m[a2][a2] = c;
+    return r;
+}
+
+/*
+DESCRIPTION:
+   Matrix of Euler angles and an offset, same as ZwEulerAngleToMatrix().
+Return 1 if the sequence is not valid, else 0.
+*/
+inline int SmallEulerToTransform(ezwEulerAngleSequence sequence, const szwEulerMatrix &euler, SmallTransform *result)
+{
+    int i = 0, j = 0, k = 0;
+    if (SmallEulerAxes(sequence, &i, &j, &k))
+        return 1;
+    const SmallMatrix<3> r = SmallMultiply(SmallAxisRotation(k, euler.ang3rd),
+        SmallMultiply(SmallAxisRotation(j, euler.ang2nd), SmallAxisRotation(i, euler.ang1st)));
+    *result = SmallTransformRotationSet(SmallTransformIdentity(), r);
+    result->m[0][3] = euler.x;
+    result->m[1][3] = euler.y;
+    result->m[2][3] = euler.z;
+    return 0;
+}
+
+/*
+DESCRIPTION:
+   Euler angles and offset of a rotation matrix, same as
+ZwMatrixToEulerAngle(). The middle angle is in [-pi/2, pi/2] for
+Tait-Bryan sequences and [0, pi] for proper ones; at gimbal lock the
+first angle is 0. Return 1 if the sequence is not valid, else 0.
+*/
+inline int SmallTransformToEuler(ezwEulerAngleSequence sequence, const SmallTransform &a, szwEulerMatrix *euler)
+{
+    int i = 0, j = 0, k = 0;
+    if (SmallEulerAxes(sequence, &i, &j, &k))
+        return 1;
+    const SmallMatrix<3> r = a.identity ? SmallIdentity<3>() : SmallTransformRotation(a);
+    const double (*m)[3] = r.m;
+    const double lock = 1.0e-12;
+
+    if (i != k)
+    {
+        /* Tait-Bryan, R = Rk(c) Rj(b) Ri(a); s is 1 for cyclic axes (XYZ, YZX, ZXY) */
+        const double s = (j - i + 3) % 3 == 1 ? 1.0 : -1.0;
+        const double cb = sqrt(m[k][j] * m[k][j] + m[k][k] * m[k][k]);
+        euler->ang2nd = atan2(-s * m[k][i], cb);
+        if (cb > lock)
+        {
+            euler->ang1st = atan2(s * m[k][j], m[k][k]);
+            euler->ang3rd = atan2(s * m[j][i], m[i][i]);
+        }
+        else
+        {
+            euler->ang1st = 0.0;
+            euler->ang3rd = atan2(-s * m[i][j], m[j][j]);
+        }
+    }
+    else
+    {
+        /* proper, R = Ri(c) Rj(b) Ri(a), h the third axis; s is 1 if (i, j, h) is cyclic */
+        const int h = 3 - i - j;
+        const double s = (j - i + 3) % 3 == 1 ? 1.0 : -1.0;
+        const double sb = sqrt(m[i][j] * m[i][j] + m[i][h] * m[i][h]);
+        euler->ang2nd = atan2(sb, m[i][i]);
+        if (sb > lock)
+        {
+            euler->ang1st = atan2(m[i][j], s * m[i][h]);
+            euler->ang3rd = atan2(m[j][i], -s * m[h][i]);
+        }
+        else
+        {
+            euler->ang1st = 0.0;
+            euler->ang3rd = atan2(s * m[h][j], m[j][j]);
+        }
+    }
+    euler->x = a.identity ? 0.0 : a.m[0][3];
+    euler->y = a.identity ? 0.0 : a.m[1][3];
+    euler->z = a.identity ? 0.0 : a.m[2][3];
+    return 0;
+}
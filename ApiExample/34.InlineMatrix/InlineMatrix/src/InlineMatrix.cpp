@@ -0,0 +1,477 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* ZW3D API includes */
+#include "zwapi_math_matrix.h"
+#include "zwapi_matrix.h"
+#include "zwapi_userinput.h"
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <math.h>
+#include <chrono>
+#include <random>
+#include <vector>
+#include "..\inc\InlineMatrixPr.h"
+#include "..\inc\SmallMatrix.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define MESSAGE_SIZE 256
+#define CHECK_MATRICES 1000          /* random matrices compared by ~InlineMatrixCheck */
+#define DEFAULT_MATRICES 100000      /* default number of matrices of ~InlineMatrixBench */
+#define EULER_SEQUENCES 12
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: largest differences of one operation */
+struct CheckGap
+{
+    const char *name;
+    double gap;      /* largest difference of a result member */
+    int failed;      /* host calls that failed */
+};
+
+/* DESCRIPTION: times of one operation */
+struct BenchTime
+{
+    const char *name;
+    double host;     /* seconds of the host calls */
+    double inlined;  /* seconds of the inline functions */
+};
+
+/*******************************************************************/
+/* Function declarations */
+static int InlineMatrixCheck(void);
+static int InlineMatrixBench(void);
+static void MatricesMake(int count, std::vector<SmallTransform> *matrices, std::vector<szwEulerMatrix> *angles);
+static double TransformGap(const SmallTransform &a, const szwMatrix &b);
+static double Seconds(std::chrono::steady_clock::time_point start);
+
+static const ezwEulerAngleSequence s_sequences[EULER_SEQUENCES] =
+{
+    ZW_EULER_XYX, ZW_EULER_XZX, ZW_EULER_YXY, ZW_EULER_YZY, ZW_EULER_ZXZ, ZW_EULER_ZYZ,
+    ZW_EULER_RPY, ZW_EULER_RYP, ZW_EULER_PRY, ZW_EULER_PYR, ZW_EULER_YRP, ZW_EULER_YPR
+};
+
+/*******************************************************************/
+/* Function definition */
+int RegisterInlineMatrix
+(
+void
+)
+/*
+DESCRIPTION:
+   Register the commands of the inline matrix example.
+*/
+{
+    /* Compare the inline matrix functions with the ZW3D matrix calls by entering "~InlineMatrixCheck" */
+    ZwCommandFunctionLoad("InlineMatrixCheck", (void *)InlineMatrixCheck, ZW_LICENSE_CODE_GENERAL);
+
+    /* Time the inline matrix functions against the ZW3D matrix calls by entering "~InlineMatrixBench" */
+    ZwCommandFunctionLoad("InlineMatrixBench", (void *)InlineMatrixBench, ZW_LICENSE_CODE_GENERAL);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int UnloadInlineMatrix
+(
+void
+)
+/*
+DESCRIPTION:
+   Unload the commands of the inline matrix example.
+*/
+{
+    ZwCommandFunctionUnload("InlineMatrixCheck");
+    ZwCommandFunctionUnload("InlineMatrixBench");
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+double Seconds
+(
+std::chrono::steady_clock::time_point start   /* I: start time */
+)
+/*
+DESCRIPTION:
+   Seconds elapsed since "start".
+*/
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*******************************************************************/
+/* Function definition */
+void MatricesMake
+(
+int count,                                  /* I: number of matrices */
+std::vector<SmallTransform> *matrices,      /* O: random rigid motions, every third one sheared */
+std::vector<szwEulerMatrix> *angles         /* O: random Euler angles and offsets */
+)
+/*
+DESCRIPTION:
+   Random matrices as an assembly has them: rotations with offsets, some
+of them sheared so the inverse is not the transpose.
+*/
+{
+    std::mt19937 random(20240601);
+    std::uniform_real_distribution<double> angle(-3.1, 3.1), offset(-100.0, 100.0), shear(-0.3, 0.3);
+    matrices->resize(count);
+    angles->resize(count);
+    for (int i = 0; i < count; i++)
+    {
+        szwEulerMatrix &euler = (*angles)[i];
+        euler.ang1st = angle(random);
+        euler.ang2nd = angle(random);
+        euler.ang3rd = angle(random);
+        euler.x = offset(random);
+        euler.y = offset(random);
+        euler.z = offset(random);
+
+        SmallTransform &matrix = (*matrices)[i];
+        SmallEulerToTransform(ZW_EULER_RPY, euler, &matrix);
+        if (i % 3 == 2)
+        {
+            for (int r = 0; r < 3; r++)
+            {
+                for (int c = 0; c < 3; c++)
+                    matrix.m[r][c] += shear(random);
+            }
+        }
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+double TransformGap
+(
+const SmallTransform &a,   /* I: inline result */
+const szwMatrix &b         /* I: host result */
+)
+/*
+DESCRIPTION:
+   Largest difference of the rotation/scale part and the offset.
+*/
+{
+    const SmallTransform c = SmallFromZw(b);
+    const SmallTransform &x = a.identity ? SmallTransformIdentity() : a;
+    const SmallTransform &y = c.identity ? SmallTransformIdentity() : c;
+    double gap = 0.0;
+    for (int i = 0; i < 3; i++)
+    {
+        for (int j = 0; j < 4; j++)
+            gap = fabs(x.m[i][j] - y.m[i][j]) > gap ? fabs(x.m[i][j] - y.m[i][j]) : gap;
+    }
+    return gap;
+}
+
+/*******************************************************************/
+/* Function definition */
+int InlineMatrixCheck
+(
+void
+)
+/*
+DESCRIPTION:
+   Compare the inline functions of SmallMatrix.h with the host calls on
+random matrices and report the largest difference per operation, so the
+conventions assumed by the header (the product order, the transpose of
+the full 4x4 matrix, the Euler sequences) are checked against this ZW3D.
+Euler angles are compared through the matrices they give, as several
+angle triples give the same rotation.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    std::vector<SmallTransform> matrices;
+    std::vector<szwEulerMatrix> angles;
+    MatricesMake(CHECK_MATRICES, &matrices, &angles);
+
+    CheckGap gaps[] =
+    {
+        { "ZwMatrixCrossProduct", 0.0, 0 }, { "ZwMatrixInvert", 0.0, 0 }, { "ZwMatrixTranspose", 0.0, 0 },
+        { "ZwMatrix3Determinant", 0.0, 0 }, { "ZwMatrix2Determinant", 0.0, 0 }, { "ZwPointTransform", 0.0, 0 },
+        { "cvxMatMult", 0.0, 0 }, { "cvxMatInvert", 0.0, 0 }, { "ZwMatrixGetByPointAndXYAxis", 0.0, 0 }
+    };
+    for (int i = 0; i < CHECK_MATRICES; i++)
+    {
+        const SmallTransform &a = matrices[i], &b = matrices[(i + 1) % CHECK_MATRICES];
+        szwMatrix result{};
+        if (ZwMatrixCrossProduct(SmallToZw(a), SmallToZw(b), &result))
+            gaps[0].failed++;
+        else
+            gaps[0].gap = fmax(gaps[0].gap, TransformGap(SmallTransformMultiply(a, b), result));
+
+        SmallTransform inverse{};
+        SmallTransformInvert(a, &inverse);
+        if (ZwMatrixInvert(SmallToZw(a), &result))
+            gaps[1].failed++;
+        else
+            gaps[1].gap = fmax(gaps[1].gap, TransformGap(inverse, result));
+
+        if (ZwMatrixTranspose(SmallToZw(a), &result))
+            gaps[2].failed++;
+        else
+        {
+            const SmallTransform transpose = SmallTransformTranspose(a);
+            gaps[2].gap = fmax(gaps[2].gap, TransformGap(transpose, result));
+            for (int k = 0; k < 3; k++)
+                gaps[2].gap = fmax(gaps[2].gap, fabs(transpose.origin[k] - (&result.ox)[k]));
+        }
+
+        double determinant = 0.0;
+        const SmallMatrix<3> rotation = SmallTransformRotation(a);
+        if (ZwMatrix3Determinant(SmallToZw(rotation), &determinant))
+            gaps[3].failed++;
+        else
+            gaps[3].gap = fmax(gaps[3].gap, fabs(SmallDeterminant(rotation) - determinant));
+
+        const SmallMatrix<2> plane = { { { rotation.m[0][0], rotation.m[0][1] }, { rotation.m[1][0], rotation.m[1][1] } } };
+        if (ZwMatrix2Determinant(SmallToZw(plane), &determinant))
+            gaps[4].failed++;
+        else
+            gaps[4].gap = fmax(gaps[4].gap, fabs(SmallDeterminant(plane) - determinant));
+
+        svxPoint point = { a.m[1][3], a.m[2][3], a.m[0][3] };
+        const svxPoint moved = SmallTransformPoint(b, point);
+        if (ZwPointTransform(SmallToZw(b), &point))
+            gaps[5].failed++;
+        else
+            gaps[5].gap = fmax(gaps[5].gap, fmax(fabs(moved.x - point.x), fmax(fabs(moved.y - point.y), fabs(moved.z - point.z))));
+
+        svxMatrix frameA = SmallToZw(SmallFrameFrom(a)), frameB = SmallToZw(SmallFrameFrom(b)), frame{};
+        cvxMatMult(&frameA, &frameB, &frame);
+        gaps[6].gap = fmax(gaps[6].gap, TransformGap(SmallTransformMultiply(a, b), SmallToZw(SmallTransformFrom(SmallFromZw(frame)))));
+        cvxMatInvert(&frameA, &frame);
+        gaps[7].gap = fmax(gaps[7].gap, TransformGap(inverse, SmallToZw(SmallTransformFrom(SmallFromZw(frame)))));
+
+        /* the host frame of the x and y columns is the orthonormalized matrix */
+        SmallTransform orthonormal = a;
+        const szwPoint origin = { a.m[0][3], a.m[1][3], a.m[2][3] };
+        const szwVector xAxis = { a.m[0][0], a.m[1][0], a.m[2][0] }, yAxis = { a.m[0][1], a.m[1][1], a.m[2][1] };
+        if (SmallTransformDeterminant(a) > 0.0)
+        {
+            if (SmallTransformOrthonormalize(&orthonormal) || ZwMatrixGetByPointAndXYAxis(origin, xAxis, yAxis, &result))
+                gaps[8].failed++;
+            else
+                gaps[8].gap = fmax(gaps[8].gap, TransformGap(orthonormal, result));
+        }
+    }
+
+    char message[MESSAGE_SIZE];
+    for (const CheckGap &gap : gaps)
+    {
+        sprintf_s(message, MESSAGE_SIZE, "%s: largest difference %g, %d failed", gap.name, gap.gap, gap.failed);
+        cvxMsgDisp(message);
+    }
+
+    /* every Euler sequence both ways */
+    for (int s = 0; s < EULER_SEQUENCES; s++)
+    {
+        double toMatrix = 0.0, toAngles = 0.0;
+        int failed = 0;
+        for (int i = 0; i < CHECK_MATRICES; i++)
+        {
+            szwMatrix result{};
+            SmallTransform matrix{};
+            SmallEulerToTransform(s_sequences[s], angles[i], &matrix);
+            if (ZwEulerAngleToMatrix(s_sequences[s], angles[i], &result))
+            {
+                failed++;
+                continue;
+            }
+            toMatrix = fmax(toMatrix, TransformGap(matrix, result));
+
+            szwEulerMatrix euler{}, hostEuler{};
+            SmallTransform back{}, hostBack{};
+            SmallTransformToEuler(s_sequences[s], matrix, &euler);
+            if (ZwMatrixToEulerAngle(s_sequences[s], SmallToZw(matrix), &hostEuler))
+            {
+                failed++;
+                continue;
+            }
+            SmallEulerToTransform(s_sequences[s], euler, &back);
+            SmallEulerToTransform(s_sequences[s], hostEuler, &hostBack);
+            toAngles = fmax(toAngles, fmax(TransformGap(back, SmallToZw(matrix)), TransformGap(hostBack, SmallToZw(matrix))));
+        }
+        sprintf_s(message, MESSAGE_SIZE, "Euler %d: ZwEulerAngleToMatrix difference %g, angles of both sides rebuild the matrix within %g, %d failed",
+            (int)s_sequences[s], toMatrix, toAngles, failed);
+        cvxMsgDisp(message);
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int InlineMatrixBench
+(
+void
+)
+/*
+DESCRIPTION:
+   Time each operation on the same matrices with the host calls and with
+the inline functions of SmallMatrix.h, and report the nanoseconds per
+call. The results are summed into a checksum so no loop is optimized
+away.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    double number = DEFAULT_MATRICES;
+    if (cvxGetNumber("Number of matrices", &number) || number < 2.0)
+        number = DEFAULT_MATRICES;
+    const int count = (int)number;
+
+    std::vector<SmallTransform> matrices;
+    std::vector<szwEulerMatrix> angles;
+    MatricesMake(count, &matrices, &angles);
+    std::vector<szwMatrix> hosts(count);
+    std::vector<svxMatrix> frames(count);
+    for (int i = 0; i < count; i++)
+    {
+        hosts[i] = SmallToZw(matrices[i]);
+        frames[i] = SmallToZw(SmallFrameFrom(matrices[i]));
+    }
+
+    BenchTime times[] =
+    {
+        { "multiply (ZwMatrixCrossProduct)", 0.0, 0.0 }, { "multiply (cvxMatMult)", 0.0, 0.0 },
+        { "invert (ZwMatrixInvert)", 0.0, 0.0 }, { "determinant (ZwMatrix3Determinant)", 0.0, 0.0 },
+        { "transpose (ZwMatrixTranspose)", 0.0, 0.0 }, { "point (ZwPointTransform)", 0.0, 0.0 },
+        { "to Euler (ZwMatrixToEulerAngle)", 0.0, 0.0 }, { "from Euler (ZwEulerAngleToMatrix)", 0.0, 0.0 }
+    };
+    double hostSum = 0.0, inlineSum = 0.0;
+    szwMatrix result{};
+    svxMatrix frame{};
+    SmallTransform small{};
+    szwEulerMatrix euler{};
+    double determinant = 0.0;
+
+    /* host calls */
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; i++)
+    {
+        ZwMatrixCrossProduct(hosts[i], hosts[(i + 1) % count], &result);
+        hostSum += result.xt;
+    }
+    times[0].host = Seconds(start);
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; i++)
+    {
+        cvxMatMult(&frames[i], &frames[(i + 1) % count], &frame);
+        hostSum += frame.xt;
+    }
+    times[1].host = Seconds(start);
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; i++)
+    {
+        ZwMatrixInvert(hosts[i], &result);
+        hostSum += result.xt;
+    }
+    times[2].host = Seconds(start);
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; i++)
+    {
+        const szwMatrix3 rotation = { hosts[i].xx, hosts[i].yx, hosts[i].zx, hosts[i].xy, hosts[i].yy, hosts[i].zy,
+            hosts[i].xz, hosts[i].yz, hosts[i].zz };
+        ZwMatrix3Determinant(rotation, &determinant);
+        hostSum += determinant;
+    }
+    times[3].host = Seconds(start);
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; i++)
+    {
+        ZwMatrixTranspose(hosts[i], &result);
+        hostSum += result.yx;
+    }
+    times[4].host = Seconds(start);
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; i++)
+    {
+        svxPoint point = { hosts[i].yt, hosts[i].zt, hosts[i].xt };
+        ZwPointTransform(hosts[(i + 1) % count], &point);
+        hostSum += point.x;
+    }
+    times[5].host = Seconds(start);
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; i++)
+    {
+        ZwMatrixToEulerAngle(ZW_EULER_RPY, hosts[i], &euler);
+        hostSum += euler.ang1st;
+    }
+    times[6].host = Seconds(start);
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; i++)
+    {
+        ZwEulerAngleToMatrix(ZW_EULER_RPY, angles[i], &result);
+        hostSum += result.xx;
+    }
+    times[7].host = Seconds(start);
+
+    /* inline functions */
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; i++)
+        inlineSum += SmallTransformMultiply(matrices[i], matrices[(i + 1) % count]).m[0][3];
+    times[0].inlined = Seconds(start);
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; i++)
+    {
+        const SmallFrame a = SmallFromZw(frames[i]), b = SmallFromZw(frames[(i + 1) % count]);
+        frame = SmallToZw(SmallFrameFrom(SmallTransformMultiply(SmallTransformFrom(a), SmallTransformFrom(b))));
+        inlineSum += frame.xt;
+    }
+    times[1].inlined = Seconds(start);
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; i++)
+    {
+        SmallTransformInvert(matrices[i], &small);
+        inlineSum += small.m[0][3];
+    }
+    times[2].inlined = Seconds(start);
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; i++)
+        inlineSum += SmallTransformDeterminant(matrices[i]);
+    times[3].inlined = Seconds(start);
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; i++)
+        inlineSum += SmallTransformTranspose(matrices[i]).m[0][1];
+    times[4].inlined = Seconds(start);
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; i++)
+    {
+        const svxPoint point = { matrices[i].m[1][3], matrices[i].m[2][3], matrices[i].m[0][3] };
+        inlineSum += SmallTransformPoint(matrices[(i + 1) % count], point).x;
+    }
+    times[5].inlined = Seconds(start);
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; i++)
+    {
+        SmallTransformToEuler(ZW_EULER_RPY, matrices[i], &euler);
+        inlineSum += euler.ang1st;
+    }
+    times[6].inlined = Seconds(start);
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; i++)
+    {
+        SmallEulerToTransform(ZW_EULER_RPY, angles[i], &small);
+        inlineSum += small.m[0][0];
+    }
+    times[7].inlined = Seconds(start);
+
+    char message[MESSAGE_SIZE];
+    for (const BenchTime &time : times)
+    {
+        sprintf_s(message, MESSAGE_SIZE, "%s: host %.1f ns, inline %.1f ns per call (%.1fx faster)", time.name,
+            1.0e9 * time.host / count, 1.0e9 * time.inlined / count, time.inlined > 0.0 ? time.host / time.inlined : 0.0);
+        cvxMsgDisp(message);
+    }
+    sprintf_s(message, MESSAGE_SIZE, "%d matrices, checksum host %.6g, inline %.6g", count, hostSum, inlineSum);
+    cvxMsgDisp(message);
+    return 0;
+}
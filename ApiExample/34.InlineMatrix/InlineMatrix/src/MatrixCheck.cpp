@@ -0,0 +1,327 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <math.h>
+#include <random>
+#include "SmallMatrix.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define CHECK_TOLERANCE 1.0e-12      /* largest difference allowed */
+#define CHECK_POINTS 1000            /* random points per check */
+
+/* the first three members of a ZW3D matrix are its X axis, column 0 */
+static_assert(SmallFromZw(szwMatrix3{ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0 }).m[0][1] == 4.0 &&
+    SmallFromZw(szwMatrix3{ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0 }).m[1][0] == 2.0,
+    "SmallFromZw() must read the axes from the columns");
+
+/*******************************************************************/
+/* Function declarations */
+static szwMatrix General(void);
+static void Reference(const szwMatrix &matrix, const svxPoint &p, svxPoint *result);
+static double Distance(const svxPoint &a, const svxPoint &b);
+static int Report(const char *name, double error, double tolerance);
+static int RoundTripCheck(void);
+static int AxisCheck(std::mt19937 &random);
+static int ProductCheck(std::mt19937 &random);
+static int OrthonormalCheck(void);
+
+/*******************************************************************/
+/* Function definition */
+szwMatrix General
+(
+void
+)
+/*
+DESCRIPTION:
+   Matrix with no symmetry, every member differs from the others and
+from the member of the transposed position, built from the header layout:
+the columns are the axes, X = (xx, yx, zx), and the offset.
+*/
+{
+    szwMatrix matrix{};
+    matrix.xx = 1.0; matrix.xy = -4.0; matrix.xz = 7.0; matrix.xt = 10.0;
+    matrix.yx = 2.0; matrix.yy = 5.0; matrix.yz = -8.0; matrix.yt = 11.0;
+    matrix.zx = 3.0; matrix.zy = 6.0; matrix.zz = 9.5; matrix.zt = 12.0;
+    matrix.scale = 1.0;
+    return matrix;
+}
+
+/*******************************************************************/
+/* Function definition */
+void Reference
+(
+const szwMatrix &matrix,   /* I: matrix */
+const svxPoint &p,         /* I: point */
+svxPoint *result           /* O: transformed point */
+)
+/*
+DESCRIPTION:
+   Transform a point by the axes of the matrix, p.x X + p.y Y + p.z Z + t.
+*/
+{
+    result->x = matrix.xx * p.x + matrix.xy * p.y + matrix.xz * p.z + matrix.xt;
+    result->y = matrix.yx * p.x + matrix.yy * p.y + matrix.yz * p.z + matrix.yt;
+    result->z = matrix.zx * p.x + matrix.zy * p.y + matrix.zz * p.z + matrix.zt;
+}
+
+/*******************************************************************/
+/* Function definition */
+double Distance
+(
+const svxPoint &a,   /* I: first point */
+const svxPoint &b    /* I: second point */
+)
+/*
+DESCRIPTION:
+   Distance between two points.
+*/
+{
+    return sqrt((a.x - b.x) * (a.x - b.x) + (a.y - b.y) * (a.y - b.y) + (a.z - b.z) * (a.z - b.z));
+}
+
+/*******************************************************************/
+/* Function definition */
+int Report
+(
+const char *name,    /* I: name of the check */
+double error,        /* I: largest error */
+double tolerance     /* I: largest error allowed */
+)
+/*
+DESCRIPTION:
+   Print the result of a check.
+
+   Return 1 if the error is above the tolerance (or not a number), else 0.
+*/
+{
+    const int failed = !(error <= tolerance);
+    printf("%-52s %9.2g %s\n", name, error, failed ? "FAILED" : "passed");
+    return failed;
+}
+
+/*******************************************************************/
+/* Function definition */
+int RoundTripCheck
+(
+void
+)
+/*
+DESCRIPTION:
+   SmallToZw(SmallFromZw()) must give every member back, for each of the
+four types, and m[i][j] must be the member of row i, column j.
+
+   Return the number of failed checks.
+*/
+{
+    const szwMatrix matrix = General();
+    const SmallTransform small = SmallFromZw(matrix);
+    const szwMatrix back = SmallToZw(small);
+    const double *from = &matrix.xx, *to = &back.xx;
+    double transformError = 0.0;
+    for (int k = 0; k < 16; k++)
+        transformError = fmax(transformError, fabs(from[k] - to[k]));
+    if (back.identity != matrix.identity)
+        transformError = 1.0;
+
+    const svxMatrix frame = { 0, matrix.xx, matrix.yx, matrix.zx, matrix.xt, matrix.xy, matrix.yy, matrix.zy, matrix.yt,
+        matrix.xz, matrix.yz, matrix.zz, matrix.zt };
+    const svxMatrix frameBack = SmallToZw(SmallFromZw(frame));
+    double frameError = 0.0;
+    for (int k = 0; k < 12; k++)
+        frameError = fmax(frameError, fabs((&frame.xx)[k] - (&frameBack.xx)[k]));
+
+    const szwMatrix3 matrix3 = { matrix.xx, matrix.yx, matrix.zx, matrix.xy, matrix.yy, matrix.zy, matrix.xz, matrix.yz,
+        matrix.zz };
+    const szwMatrix3 back3 = SmallToZw(SmallFromZw(matrix3));
+    const szwMatrix2 matrix2 = { matrix.xx, matrix.yx, matrix.xy, matrix.yy };
+    const szwMatrix2 back2 = SmallToZw(SmallFromZw(matrix2));
+    double smallError = 0.0;
+    for (int k = 0; k < 9; k++)
+        smallError = fmax(smallError, fabs((&matrix3.xx)[k] - (&back3.xx)[k]));
+    for (int k = 0; k < 4; k++)
+        smallError = fmax(smallError, fabs((&matrix2.xx)[k] - (&back2.xx)[k]));
+
+    /* row 0 is (xx, xy, xz, xt) */
+    const double rows[3][4] = { { matrix.xx, matrix.xy, matrix.xz, matrix.xt }, { matrix.yx, matrix.yy, matrix.yz, matrix.yt },
+        { matrix.zx, matrix.zy, matrix.zz, matrix.zt } };
+    const SmallFrame smallFrame = SmallFromZw(frame);
+    const SmallMatrix<3> small3 = SmallFromZw(matrix3);
+    const SmallMatrix<2> small2 = SmallFromZw(matrix2);
+    double rowError = 0.0;
+    for (int i = 0; i < 3; i++)
+    {
+        for (int j = 0; j < 4; j++)
+        {
+            rowError = fmax(rowError, fmax(fabs(small.m[i][j] - rows[i][j]), fabs(smallFrame.m[i][j] - rows[i][j])));
+            if (j < 3)
+                rowError = fmax(rowError, fabs(small3.m[i][j] - rows[i][j]));
+            if (i < 2 && j < 2)
+                rowError = fmax(rowError, fabs(small2.m[i][j] - rows[i][j]));
+        }
+    }
+
+    int failures = Report("round trip: szwMatrix", transformError, 0.0);
+    failures += Report("round trip: svxMatrix", frameError, 0.0);
+    failures += Report("round trip: szwMatrix3 and szwMatrix2", smallError, 0.0);
+    failures += Report("round trip: m[i][j] is row i, column j", rowError, 0.0);
+    return failures;
+}
+
+/*******************************************************************/
+/* Function definition */
+int AxisCheck
+(
+std::mt19937 &random   /* I/O: random numbers */
+)
+/*
+DESCRIPTION:
+   SmallTransformPoint() of a converted matrix must map (1, 0, 0) to the
+origin plus its X axis (xx, yx, zx) and agree with the transform by the
+axes on random points, and SmallAxisRotation() about Z must give an X axis
+turned toward +Y.
+
+   Return the number of failed checks.
+*/
+{
+    const szwMatrix matrix = General();
+    const SmallTransform small = SmallFromZw(matrix);
+    const svxPoint origin = { matrix.xt, matrix.yt, matrix.zt };
+    const svxPoint xEnd = { origin.x + matrix.xx, origin.y + matrix.yx, origin.z + matrix.zx };
+    const svxPoint yEnd = { origin.x + matrix.xy, origin.y + matrix.yy, origin.z + matrix.zy };
+    const svxPoint zEnd = { origin.x + matrix.xz, origin.y + matrix.yz, origin.z + matrix.zz };
+    double axisError = fmax(Distance(SmallTransformPoint(small, svxPoint{ 1.0, 0.0, 0.0 }), xEnd),
+        Distance(SmallTransformPoint(small, svxPoint{ 0.0, 1.0, 0.0 }), yEnd));
+    axisError = fmax(axisError, Distance(SmallTransformPoint(small, svxPoint{ 0.0, 0.0, 1.0 }), zEnd));
+
+    std::uniform_real_distribution<double> unit(-1.0, 1.0);
+    double pointError = 0.0, vectorError = 0.0;
+    for (int i = 0; i < CHECK_POINTS; i++)
+    {
+        const svxPoint p = { 100.0 * unit(random), 100.0 * unit(random), 100.0 * unit(random) };
+        svxPoint expected;
+        Reference(matrix, p, &expected);
+        pointError = fmax(pointError, Distance(SmallTransformPoint(small, p), expected));
+        const svxVector v = SmallTransformVector(small, svxVector{ p.x, p.y, p.z });
+        vectorError = fmax(vectorError, Distance(svxPoint{ v.x + origin.x, v.y + origin.y, v.z + origin.z }, expected));
+    }
+
+    const double angle = 0.5;
+    const szwMatrix turn = SmallToZw(SmallTransformRotationSet(SmallTransformIdentity(), SmallAxisRotation(2, angle)));
+    const double turnError = fmax(fmax(fabs(turn.xx - cos(angle)), fabs(turn.yx - sin(angle))),
+        fmax(fabs(turn.xy + sin(angle)), fabs(turn.yy - cos(angle))));
+
+    int failures = Report("axes: (1, 0, 0) to origin + (xx, yx, zx)", axisError, CHECK_TOLERANCE);
+    failures += Report("axes: SmallTransformPoint() against the axes", pointError, CHECK_TOLERANCE * 100.0);
+    failures += Report("axes: SmallTransformVector() against the axes", vectorError, CHECK_TOLERANCE * 100.0);
+    failures += Report("axes: rotation about Z turns X toward +Y", turnError, CHECK_TOLERANCE);
+    return failures;
+}
+
+/*******************************************************************/
+/* Function definition */
+int ProductCheck
+(
+std::mt19937 &random   /* I/O: random numbers */
+)
+/*
+DESCRIPTION:
+   The product of converted matrices must map as the outer matrix applied
+to the inner one, and the inverse must map the points back.
+
+   Return the number of failed checks.
+*/
+{
+    const szwMatrix outer = General();
+    szwMatrix inner{};
+    inner.xx = 0.0; inner.xy = -1.0; inner.xz = 0.0; inner.xt = 3.0;
+    inner.yx = 0.5; inner.yy = 0.0; inner.yz = 2.0; inner.yt = -1.0;
+    inner.zx = -2.0; inner.zy = 0.25; inner.zz = 1.0; inner.zt = 4.0;
+    inner.scale = 1.0;
+    const szwMatrix product = SmallToZw(SmallTransformMultiply(SmallFromZw(outer), SmallFromZw(inner)));
+    SmallTransform inverse;
+    const int singular = SmallTransformInvert(SmallFromZw(outer), &inverse);
+    const szwMatrix back = SmallToZw(inverse);
+
+    std::uniform_real_distribution<double> unit(-1.0, 1.0);
+    double productError = 0.0, inverseError = 0.0;
+    for (int i = 0; i < CHECK_POINTS; i++)
+    {
+        const svxPoint p = { 100.0 * unit(random), 100.0 * unit(random), 100.0 * unit(random) };
+        svxPoint moved, chained, expected, returned;
+        Reference(inner, p, &moved);
+        Reference(outer, moved, &expected);
+        Reference(product, p, &chained);
+        productError = fmax(productError, Distance(chained, expected));
+        Reference(outer, p, &moved);
+        Reference(back, moved, &returned);
+        inverseError = fmax(inverseError, Distance(returned, p));
+    }
+    if (singular)
+        inverseError = 1.0;
+
+    int failures = Report("product: outer(inner(p))", productError, CHECK_TOLERANCE * 1000.0);
+    failures += Report("product: inverse(outer(p)) is p", inverseError, CHECK_TOLERANCE * 1000.0);
+    return failures;
+}
+
+/*******************************************************************/
+/* Function definition */
+int OrthonormalCheck
+(
+void
+)
+/*
+DESCRIPTION:
+   SmallTransformOrthonormalize() of a sheared, scaled frame must keep the
+direction of its X axis (xx, yx, zx) and the plane of X and Y, and the
+offset.
+
+   Return the number of failed checks.
+*/
+{
+    szwMatrix matrix{};
+    matrix.xx = 2.0; matrix.xy = 1.0; matrix.xz = 0.0; matrix.xt = 5.0;
+    matrix.yx = 1.0; matrix.yy = 3.0; matrix.yz = 0.0; matrix.yt = 6.0;
+    matrix.zx = 0.0; matrix.zy = 0.0; matrix.zz = 4.0; matrix.zt = 7.0;
+    matrix.scale = 1.0;
+    SmallTransform small = SmallFromZw(matrix);
+    const int failed = SmallTransformOrthonormalize(&small);
+    const szwMatrix result = SmallToZw(small);
+
+    const double length = sqrt(5.0);
+    double error = fmax(fmax(fabs(result.xx - 2.0 / length), fabs(result.yx - 1.0 / length)), fabs(result.zx));
+    error = fmax(error, fmax(fabs(result.xy + 1.0 / length), fabs(result.yy - 2.0 / length)));
+    error = fmax(error, fmax(fabs(result.zz - 1.0), fabs(result.xz) + fabs(result.yz) + fabs(result.zy)));
+    error = fmax(error, fabs(result.xt - 5.0) + fabs(result.yt - 6.0) + fabs(result.zt - 7.0));
+    if (failed)
+        error = 1.0;
+    return Report("orthonormalize: X axis (xx, yx, zx) kept", error, CHECK_TOLERANCE);
+}
+
+/*******************************************************************/
+/* Function definition */
+int main
+(
+void
+)
+/*
+DESCRIPTION:
+   Check the conversions and the point transforms of SmallMatrix.h against
+matrices built from the layout of the header (axes in the columns).
+
+   Return 1 if a check fails, else 0.
+*/
+{
+    std::mt19937 random(34);
+    int failures = RoundTripCheck();
+    failures += AxisCheck(random);
+    failures += ProductCheck(random);
+    failures += OrthonormalCheck();
+    printf("checks: %s\n", failures ? "FAILED" : "passed");
+    return failures ? 1 : 0;
+}
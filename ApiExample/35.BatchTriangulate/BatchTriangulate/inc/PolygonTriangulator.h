@@ -0,0 +1,146 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+#pragma once
+
+/* ZW3D API includes */
+#include "zwapi_util.h"
+
+/* Application includes */
+#include <vector>
+#include "WorkPool.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define TRIANGULATE_HASH_POINTS 80   /* polygons with more points look for ears through the z-order hash */
+#define TRIANGULATE_GRAIN 16         /* polygons taken at a time by a pool worker */
+
+/*******************************************************************/
+/* Data type definitions */
+/*
+DESCRIPTION:
+   Many planar polygons in one flat buffer. Polygon p has the rings
+polygonRings[p] to polygonRings[p + 1] - 1, the first one is its outer
+boundary and the others are its holes. Ring r has the points
+ringStarts[r] to ringStarts[r + 1] - 1, in order around the ring, either
+direction, the last point not repeating the first. The rings of a polygon
+follow each other in the buffer.
+*/
+struct PolygonSet
+{
+    int polygonCount;
+    const svxPoint *points;
+    const int *ringStarts;       /* ringCount + 1 entries */
+    const int *polygonRings;     /* polygonCount + 1 entries */
+};
+
+/*
+DESCRIPTION:
+   Ear clipping of one planar polygon with holes, with buffers kept from
+one polygon to the next.
+
+   The polygon is projected on the coordinate plane most normal to its
+Newell normal. Each hole is joined to the outer boundary by a bridge to
+the nearest visible point, then ears are cut. Polygons with more than
+TRIANGULATE_HASH_POINTS points index their vertices by the z-order
+(Morton) code of their position, so the test of an ear only visits the
+vertices whose code lies in the range of the ear's bounding box instead
+of the whole ring. Rings that do not give an ear are cleaned of
+duplicate and collinear points, then of local self-intersections, then
+split along a valid diagonal.
+
+   The indices are those of cvxPolyToTri() / ZwPointPolygonTriangulation():
+three per triangle, counted from the first point of the outer ring
+through the holes that follow it. Triangles turn the way of the outer
+ring, so their normals point along its Newell normal.
+*/
+class EarClipper
+{
+public:
+    EarClipper();
+
+    int Triangulate(const svxPoint *points, int ringCount, const int *ringStarts, int capacity, int *indices);
+
+private:
+    struct Node
+    {
+        int i;                  /* index of the point, from the first point of the polygon */
+        double x, y;            /* projected position */
+        int prev, next;         /* ring order */
+        int prevZ, nextZ;       /* z-order, -1 at the ends */
+        unsigned int z;         /* z-order code, 0 if not computed */
+        char steiner;           /* hole of one point */
+    };
+
+    int RingLink(int first, int end, int outer);
+    int NodeInsert(int i, int last);
+    void NodeRemove(int p);
+    int PointsFilter(int start, int end);
+    void EarsCut(int ear, int pass);
+    int IsEar(int ear) const;
+    int IsEarHashed(int ear) const;
+    int LocalIntersectionsCure(int start);
+    void EarcutSplit(int start);
+    int HolesEliminate(int outer, int ringCount, const int *ringStarts);
+    int HoleBridge(int hole, int outer) const;
+    int PolygonSplit(int a, int b);
+    void CurveIndex(int start);
+    int LinkedSort(int list);
+    unsigned int ZOrder(double x, double y) const;
+
+    double Area(int p, int q, int r) const;
+    int Equals(int a, int b) const;
+    int Intersects(int p1, int q1, int p2, int q2) const;
+    int IntersectsPolygon(int a, int b) const;
+    int LocallyInside(int a, int b) const;
+    int MiddleInside(int a, int b) const;
+    int ValidDiagonal(int a, int b) const;
+    int SectorContainsSector(int m, int p) const;
+    void Emit(int a, int b, int c);
+
+    const svxPoint *m_points;        /* first point of the polygon */
+    int m_axisU, m_axisV;            /* coordinates giving the projected x and y */
+    double m_signV;                  /* -1 to mirror y, so the outer ring turns counterclockwise */
+    double m_minX, m_minY, m_invSize;   /* z-order grid, m_invSize 0 without hash */
+    std::vector<Node> m_nodes;
+    std::vector<int> m_holes;
+    int *m_indices;
+    int m_count, m_capacity;
+};
+
+/*
+DESCRIPTION:
+   Triangulation of many polygons into one index buffer, replacing a
+cvxPolyToTri() call and an allocation per polygon.
+
+   IndexOffsets() gives where the indices of each polygon start in the
+output and its size: 3 * (points + 2 * holes - 2) indices per polygon,
+the most ear clipping can give. Triangulate() runs the polygons on a
+WorkPool, each worker with its own EarClipper, and writes the indices
+of polygon p from indices[indexOffsets[p]], indexCounts[p] of them, or
+-1 if the polygon can not be triangulated.
+*/
+class PolygonTriangulator
+{
+public:
+    PolygonTriangulator();
+
+    static int IndexOffsets(const PolygonSet &set, int *indexOffsets);
+    int Triangulate(const PolygonSet &set, const int *indexOffsets, WorkPool *pool, int *indices, int *indexCounts);
+
+private:
+    /* data of a running Triangulate() */
+    struct Batch
+    {
+        PolygonTriangulator *self;
+        const PolygonSet *set;
+        const int *indexOffsets;
+        int *indices;
+        int *indexCounts;
+    };
+
+    static void TaskRun(void *data, int begin, int end, int worker);
+
+    std::vector<EarClipper> m_clippers;   /* one per worker */
+};
@@ -0,0 +1,371 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* ZW3D API includes */
+#include "zwapi_point.h"
+#include "zwapi_userinput.h"
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <math.h>
+#include <chrono>
+#include <random>
+#include <vector>
+#include "..\inc\BatchTriangulatePr.h"
+#include "..\inc\PolygonTriangulator.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define MESSAGE_SIZE 256
+#define DEFAULT_POLYGONS 20000       /* default number of polygons */
+#define DEFAULT_POINTS 40            /* default points of an outer ring */
+#define DEFAULT_HOLES 2              /* default holes per polygon */
+#define MAX_HOLES 8                  /* holes that fit around the center of a polygon */
+#define HOLE_POINTS 12               /* points of a hole */
+#define TRIANGULATE_PI 3.14159265358979323846
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: polygons in the buffers of a PolygonSet */
+struct PolygonData
+{
+    std::vector<svxPoint> points;
+    std::vector<int> ringStarts;
+    std::vector<int> polygonRings;
+};
+
+/*******************************************************************/
+/* Function declarations */
+static int BatchTriangulate(void);
+static void PolygonsMake(int count, int points, int holes, PolygonData *data);
+static void OuterRings(const PolygonData &data, PolygonData *outer);
+static PolygonSet SetGet(const PolygonData &data);
+static double RingArea(const svxPoint *points, int count);
+static double TrianglesArea(const svxPoint *points, int count, const int *indices);
+static double Seconds(std::chrono::steady_clock::time_point start);
+
+/*******************************************************************/
+/* Function definition */
+int RegisterBatchTriangulate
+(
+void
+)
+/*
+DESCRIPTION:
+   Register the commands of the batch triangulation example.
+*/
+{
+    /* Compare and time batch triangulation with ZwPointPolygonTriangulation() by entering "~BatchTriangulate" */
+    ZwCommandFunctionLoad("BatchTriangulate", (void *)BatchTriangulate, ZW_LICENSE_CODE_GENERAL);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int UnloadBatchTriangulate
+(
+void
+)
+/*
+DESCRIPTION:
+   Unload the commands of the batch triangulation example.
+*/
+{
+    ZwCommandFunctionUnload("BatchTriangulate");
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+double Seconds
+(
+std::chrono::steady_clock::time_point start   /* I: start time */
+)
+/*
+DESCRIPTION:
+   Seconds elapsed since "start".
+*/
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*******************************************************************/
+/* Function definition */
+void PolygonsMake
+(
+int count,           /* I: number of polygons */
+int points,          /* I: points of an outer ring */
+int holes,           /* I: holes per polygon */
+PolygonData *data    /* O: polygons */
+)
+/*
+DESCRIPTION:
+   Random profiles as hatch and board regions have them: concave
+star-shaped outer rings in random planes, alternately clockwise and
+counterclockwise, with small round holes around their center.
+*/
+{
+    std::mt19937 random(20240601);
+    std::uniform_real_distribution<double> unit(0.0, 1.0), side(-1.0, 1.0);
+    data->points.clear();
+    data->ringStarts.assign(1, 0);
+    data->polygonRings.assign(1, 0);
+    for (int p = 0; p < count; p++)
+    {
+        /* plane: a random origin and two normal unit axes */
+        const svxPoint origin = { 1000.0 * side(random), 1000.0 * side(random), 1000.0 * side(random) };
+        svxVector x = { side(random), side(random), side(random) }, y = { side(random), side(random), side(random) };
+        double length = sqrt(x.x * x.x + x.y * x.y + x.z * x.z);
+        if (!(length > 1.0e-3))
+        {
+            x = { 1.0, 0.0, 0.0 };
+            length = 1.0;
+        }
+        x = { x.x / length, x.y / length, x.z / length };
+        const double d = x.x * y.x + x.y * y.y + x.z * y.z;
+        y = { y.x - d * x.x, y.y - d * x.y, y.z - d * x.z };
+        length = sqrt(y.x * y.x + y.y * y.y + y.z * y.z);
+        if (!(length > 1.0e-3))
+        {
+            /* x cross the coordinate axis farthest from it */
+            y = fabs(x.x) < 0.5 ? svxVector{ 0.0, x.z, -x.y } : svxVector{ -x.z, 0.0, x.x };
+            length = sqrt(y.x * y.x + y.y * y.y + y.z * y.z);
+        }
+        y = { y.x / length, y.y / length, y.z / length };
+        const double radius = 10.0 + 40.0 * unit(random), turn = p % 2 ? -1.0 : 1.0;
+
+        for (int i = 0; i < points; i++)
+        {
+            const double angle = turn * 2.0 * TRIANGULATE_PI * i / points, r = radius * (0.6 + 0.4 * unit(random));
+            const double u = r * cos(angle), v = r * sin(angle);
+            data->points.push_back({ origin.x + u * x.x + v * y.x, origin.y + u * x.y + v * y.y, origin.z + u * x.z + v * y.z });
+        }
+        data->ringStarts.push_back((int)data->points.size());
+
+        for (int h = 0; h < holes; h++)
+        {
+            const double at = 2.0 * TRIANGULATE_PI * h / holes, cu = 0.3 * radius * cos(at), cv = 0.3 * radius * sin(at);
+            for (int i = 0; i < HOLE_POINTS; i++)
+            {
+                const double angle = 2.0 * TRIANGULATE_PI * i / HOLE_POINTS;
+                const double u = cu + 0.08 * radius * cos(angle), v = cv + 0.08 * radius * sin(angle);
+                data->points.push_back({ origin.x + u * x.x + v * y.x, origin.y + u * x.y + v * y.y, origin.z + u * x.z + v * y.z });
+            }
+            data->ringStarts.push_back((int)data->points.size());
+        }
+        data->polygonRings.push_back((int)data->ringStarts.size() - 1);
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+void OuterRings
+(
+const PolygonData &data,   /* I: polygons */
+PolygonData *outer         /* O: the same polygons without holes */
+)
+/*
+DESCRIPTION:
+   Copy the outer rings of polygons, for the host triangulation that
+takes one ring.
+*/
+{
+    outer->points.clear();
+    outer->ringStarts.assign(1, 0);
+    outer->polygonRings.assign(1, 0);
+    for (size_t p = 0; p + 1 < data.polygonRings.size(); p++)
+    {
+        const int ring = data.polygonRings[p];
+        outer->points.insert(outer->points.end(), data.points.begin() + data.ringStarts[ring],
+            data.points.begin() + data.ringStarts[ring + 1]);
+        outer->ringStarts.push_back((int)outer->points.size());
+        outer->polygonRings.push_back((int)outer->ringStarts.size() - 1);
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+PolygonSet SetGet
+(
+const PolygonData &data   /* I: polygons */
+)
+/*
+DESCRIPTION:
+   Polygon set of the buffers.
+*/
+{
+    PolygonSet set;
+    set.polygonCount = (int)data.polygonRings.size() - 1;
+    set.points = data.points.data();
+    set.ringStarts = data.ringStarts.data();
+    set.polygonRings = data.polygonRings.data();
+    return set;
+}
+
+/*******************************************************************/
+/* Function definition */
+double RingArea
+(
+const svxPoint *points,   /* I: ring points */
+int count                 /* I: number of points */
+)
+/*
+DESCRIPTION:
+   Area of a planar ring, half the length of its Newell normal.
+*/
+{
+    double n[3] = { 0.0, 0.0, 0.0 };
+    for (int i = 0, j = count - 1; i < count; j = i++)
+    {
+        const svxPoint &a = points[j], &b = points[i];
+        n[0] += (a.y - b.y) * (a.z + b.z);
+        n[1] += (a.z - b.z) * (a.x + b.x);
+        n[2] += (a.x - b.x) * (a.y + b.y);
+    }
+    return 0.5 * sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+}
+
+/*******************************************************************/
+/* Function definition */
+double TrianglesArea
+(
+const svxPoint *points,   /* I: points of the polygon */
+int count,                /* I: number of indices */
+const int *indices        /* I: three indices per triangle */
+)
+/*
+DESCRIPTION:
+   Sum of the areas of the triangles.
+*/
+{
+    double area = 0.0;
+    for (int t = 0; t + 2 < count; t += 3)
+    {
+        const svxPoint &a = points[indices[t]], &b = points[indices[t + 1]], &c = points[indices[t + 2]];
+        const double ux = b.x - a.x, uy = b.y - a.y, uz = b.z - a.z, vx = c.x - a.x, vy = c.y - a.y, vz = c.z - a.z;
+        const double nx = uy * vz - uz * vy, ny = uz * vx - ux * vz, nz = ux * vy - uy * vx;
+        area += 0.5 * sqrt(nx * nx + ny * ny + nz * nz);
+    }
+    return area;
+}
+
+/*******************************************************************/
+/* Function definition */
+int BatchTriangulate
+(
+void
+)
+/*
+DESCRIPTION:
+   Triangulate random polygons with one ZwPointPolygonTriangulation()
+call per polygon and with the batch triangulator on one thread and on
+the pool, and report the times and how the triangles cover the polygons.
+The host takes one ring, so it is compared on the outer rings; the batch
+is then run again with the holes.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    double number = DEFAULT_POLYGONS;
+    if (cvxGetNumber("Number of polygons", &number) || number < 1.0)
+        number = DEFAULT_POLYGONS;
+    const int count = (int)number;
+    number = DEFAULT_POINTS;
+    if (cvxGetNumber("Points of a polygon", &number) || number < 3.0)
+        number = DEFAULT_POINTS;
+    const int points = (int)number;
+    number = DEFAULT_HOLES;
+    if (cvxGetNumber("Holes per polygon", &number) || number < 0.0)
+        number = DEFAULT_HOLES;
+    const int holes = number > MAX_HOLES ? MAX_HOLES : (int)number;
+
+    PolygonData data, outer;
+    PolygonsMake(count, points, holes, &data);
+    OuterRings(data, &outer);
+
+    /* host, one call and one allocation per polygon */
+    int hostFailed = 0, hostIndices = 0;
+    double hostGap = 0.0;
+    auto start = std::chrono::steady_clock::now();
+    for (int p = 0; p < count; p++)
+    {
+        const svxPoint *ring = outer.points.data() + outer.ringStarts[p];
+        int vertexCount = 0, *vertexList = nullptr;
+        if (ZwPointPolygonTriangulation(points, ring, &vertexCount, &vertexList) || vertexList == nullptr)
+        {
+            hostFailed++;
+            continue;
+        }
+        hostIndices += vertexCount;
+        const double area = RingArea(ring, points);
+        hostGap = fmax(hostGap, fabs(TrianglesArea(ring, vertexCount, vertexList) - area) / area);
+        ZwMemoryFree((void **)&vertexList);
+    }
+    const double hostTime = Seconds(start);
+
+    /* batch on the same rings, one thread then the pool */
+    PolygonTriangulator triangulator;
+    PolygonSet set = SetGet(outer);
+    std::vector<int> offsets(count + 1), counts(count);
+    std::vector<int> indices(PolygonTriangulator::IndexOffsets(set, offsets.data()));
+    start = std::chrono::steady_clock::now();
+    triangulator.Triangulate(set, offsets.data(), nullptr, indices.data(), counts.data());
+    const double serialTime = Seconds(start);
+
+    WorkPool pool;
+    start = std::chrono::steady_clock::now();
+    int failed = triangulator.Triangulate(set, offsets.data(), &pool, indices.data(), counts.data());
+    double poolTime = Seconds(start);
+    int batchIndices = 0;
+    double batchGap = 0.0;
+    for (int p = 0; p < count; p++)
+    {
+        if (counts[p] < 0)
+            continue;
+        const svxPoint *ring = outer.points.data() + outer.ringStarts[p];
+        const double area = RingArea(ring, points);
+        batchIndices += counts[p];
+        batchGap = fmax(batchGap, fabs(TrianglesArea(ring, counts[p], indices.data() + offsets[p]) - area) / area);
+    }
+
+    char message[MESSAGE_SIZE];
+    sprintf_s(message, MESSAGE_SIZE, "%d polygons of %d points: host %d triangles, %d failed, area error %.3g; batch %d triangles, %d failed, area error %.3g",
+        count, points, hostIndices / 3, hostFailed, hostGap, batchIndices / 3, failed, batchGap);
+    cvxMsgDisp(message);
+    sprintf_s(message, MESSAGE_SIZE, "Host %.3f s (%.3g polygons/s); batch: 1 thread %.3f s (%.3g polygons/s), %d threads %.3f s (%.1fx faster)",
+        hostTime, hostTime > 0.0 ? count / hostTime : 0.0, serialTime, serialTime > 0.0 ? count / serialTime : 0.0,
+        pool.ThreadCount(), poolTime, poolTime > 0.0 ? hostTime / poolTime : 0.0);
+    cvxMsgDisp(message);
+    if (holes == 0)
+        return 0;
+
+    /* batch with the holes, the area is the outer one less the holes */
+    set = SetGet(data);
+    offsets.assign(count + 1, 0);
+    counts.assign(count, 0);
+    indices.assign(PolygonTriangulator::IndexOffsets(set, offsets.data()), 0);
+    start = std::chrono::steady_clock::now();
+    failed = triangulator.Triangulate(set, offsets.data(), &pool, indices.data(), counts.data());
+    poolTime = Seconds(start);
+    batchIndices = 0;
+    batchGap = 0.0;
+    for (int p = 0; p < count; p++)
+    {
+        if (counts[p] < 0)
+            continue;
+        const int firstRing = data.polygonRings[p];
+        const svxPoint *first = data.points.data() + data.ringStarts[firstRing];
+        double area = RingArea(first, data.ringStarts[firstRing + 1] - data.ringStarts[firstRing]);
+        for (int r = firstRing + 1; r < data.polygonRings[p + 1]; r++)
+            area -= RingArea(data.points.data() + data.ringStarts[r], data.ringStarts[r + 1] - data.ringStarts[r]);
+        batchIndices += counts[p];
+        batchGap = fmax(batchGap, fabs(TrianglesArea(first, counts[p], indices.data() + offsets[p]) - area) / area);
+    }
+    sprintf_s(message, MESSAGE_SIZE, "With %d holes each: %d triangles, %d failed, area error %.3g, %d threads %.3f s (%.3g polygons/s)",
+        holes, batchIndices / 3, failed, batchGap, pool.ThreadCount(), poolTime, poolTime > 0.0 ? count / poolTime : 0.0);
+    cvxMsgDisp(message);
+    return 0;
+}
@@ -0,0 +1,1016 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* Application includes */
+#include <math.h>
+#include <float.h>
+#include <algorithm>
+#include "..\inc\PolygonTriangulator.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define TRIANGULATE_HASH_RANGE 32767.0    /* z-order grid cells along the larger side of the polygon */
+
+/*******************************************************************/
+/* Function declarations */
+static double Sign(double value);
+static int OnSegment(double px, double py, double qx, double qy, double rx, double ry);
+static int PointInTriangle(double ax, double ay, double bx, double by, double cx, double cy, double px, double py);
+
+/*******************************************************************/
+/* Function definition */
+double Sign
+(
+double value   /* I: value */
+)
+/*
+DESCRIPTION:
+   1, -1 or 0 as the sign of "value".
+*/
+{
+    return value > 0.0 ? 1.0 : value < 0.0 ? -1.0 : 0.0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int OnSegment
+(
+double px, double py,   /* I: segment start */
+double qx, double qy,   /* I: point collinear with the segment */
+double rx, double ry    /* I: segment end */
+)
+/*
+DESCRIPTION:
+   Return 1 if "q" is within the bounding box of segment "pr", else 0.
+*/
+{
+    return qx <= (px > rx ? px : rx) && qx >= (px < rx ? px : rx) && qy <= (py > ry ? py : ry) &&
+        qy >= (py < ry ? py : ry);
+}
+
+/*******************************************************************/
+/* Function definition */
+int PointInTriangle
+(
+double ax, double ay,   /* I: first corner */
+double bx, double by,   /* I: second corner */
+double cx, double cy,   /* I: third corner */
+double px, double py    /* I: point */
+)
+/*
+DESCRIPTION:
+   Return 1 if the point is inside the counterclockwise triangle "abc"
+or on its border, else 0.
+*/
+{
+    return (cx - px) * (ay - py) >= (ax - px) * (cy - py) && (ax - px) * (by - py) >= (bx - px) * (ay - py) &&
+        (bx - px) * (cy - py) >= (cx - px) * (by - py);
+}
+
+/*******************************************************************/
+/* Function definition */
+EarClipper::EarClipper
+(
+)
+/*
+DESCRIPTION:
+   Create a clipper with empty buffers.
+*/
+    : m_points(nullptr), m_axisU(0), m_axisV(1), m_signV(1.0), m_minX(0.0), m_minY(0.0), m_invSize(0.0),
+    m_indices(nullptr), m_count(0), m_capacity(0)
+{
+}
+
+/*******************************************************************/
+/* Function definition */
+int EarClipper::Triangulate
+(
+const svxPoint *points,   /* I: point buffer */
+int ringCount,            /* I: rings of the polygon, the outer one first */
+const int *ringStarts,    /* I: first point of each ring in "points", ringCount + 1 entries */
+int capacity,             /* I: size of "indices" */
+int *indices              /* O: three indices per triangle, from the first point of the outer ring */
+)
+/*
+DESCRIPTION:
+   Triangulate one polygon with holes.
+
+   Return the number of indices written, or -1 if the polygon has less
+than three points, no area, or more triangles than "capacity" allows.
+*/
+{
+    if (ringCount < 1 || ringStarts[1] - ringStarts[0] < 3 || indices == nullptr)
+        return -1;
+
+    /* plane of the outer ring by its Newell normal */
+    m_points = points + ringStarts[0];
+    const int outerCount = ringStarts[1] - ringStarts[0];
+    double normal[3] = { 0.0, 0.0, 0.0 };
+    for (int i = 0, j = outerCount - 1; i < outerCount; j = i++)
+    {
+        const svxPoint &a = m_points[j], &b = m_points[i];
+        normal[0] += (a.y - b.y) * (a.z + b.z);
+        normal[1] += (a.z - b.z) * (a.x + b.x);
+        normal[2] += (a.x - b.x) * (a.y + b.y);
+    }
+    int axis = fabs(normal[1]) > fabs(normal[0]) ? 1 : 0;
+    axis = fabs(normal[2]) > fabs(normal[axis]) ? 2 : axis;
+    if (!(fabs(normal[axis]) > 0.0))
+        return -1;
+    m_axisU = (axis + 1) % 3;
+    m_axisV = (axis + 2) % 3;
+    m_signV = normal[axis] < 0.0 ? -1.0 : 1.0;
+
+    m_nodes.clear();
+    m_indices = indices;
+    m_count = 0;
+    m_capacity = capacity;
+    m_invSize = 0.0;
+
+    int outer = RingLink(0, outerCount, 1);
+    if (outer < 0 || m_nodes[outer].next == m_nodes[outer].prev)
+        return m_count;
+    if (ringCount > 1)
+        outer = HolesEliminate(outer, ringCount, ringStarts);
+
+    /* z-order grid over the outer ring */
+    if (ringStarts[ringCount] - ringStarts[0] > TRIANGULATE_HASH_POINTS)
+    {
+        double maxX = -DBL_MAX, maxY = -DBL_MAX;
+        m_minX = DBL_MAX;
+        m_minY = DBL_MAX;
+        for (int i = 0; i < outerCount; i++)
+        {
+            const double x = (&m_points[i].x)[m_axisU], y = m_signV * (&m_points[i].x)[m_axisV];
+            m_minX = x < m_minX ? x : m_minX;
+            m_minY = y < m_minY ? y : m_minY;
+            maxX = x > maxX ? x : maxX;
+            maxY = y > maxY ? y : maxY;
+        }
+        const double size = maxX - m_minX > maxY - m_minY ? maxX - m_minX : maxY - m_minY;
+        m_invSize = size > 0.0 ? TRIANGULATE_HASH_RANGE / size : 0.0;
+    }
+    EarsCut(outer, 0);
+    return m_count <= m_capacity ? m_count : -1;
+}
+
+/*******************************************************************/
+/* Function definition */
+int EarClipper::NodeInsert
+(
+int i,      /* I: index of the point */
+int last    /* I: node to insert after, -1 to start a ring */
+)
+/*
+DESCRIPTION:
+   Add a node of point "i" to a ring.
+
+   Return the new node.
+*/
+{
+    Node node;
+    node.i = i;
+    node.x = (&m_points[i].x)[m_axisU];
+    node.y = m_signV * (&m_points[i].x)[m_axisV];
+    node.prevZ = node.nextZ = -1;
+    node.z = 0;
+    node.steiner = 0;
+    const int p = (int)m_nodes.size();
+    if (last < 0)
+    {
+        node.prev = node.next = p;
+        m_nodes.push_back(node);
+    }
+    else
+    {
+        node.next = m_nodes[last].next;
+        node.prev = last;
+        m_nodes.push_back(node);
+        m_nodes[m_nodes[last].next].prev = p;
+        m_nodes[last].next = p;
+    }
+    return p;
+}
+
+/*******************************************************************/
+/* Function definition */
+void EarClipper::NodeRemove
+(
+int p   /* I: node */
+)
+/*
+DESCRIPTION:
+   Unlink a node from its ring and from the z-order list.
+*/
+{
+    Node &node = m_nodes[p];
+    m_nodes[node.next].prev = node.prev;
+    m_nodes[node.prev].next = node.next;
+    if (node.prevZ >= 0)
+        m_nodes[node.prevZ].nextZ = node.nextZ;
+    if (node.nextZ >= 0)
+        m_nodes[node.nextZ].prevZ = node.prevZ;
+}
+
+/*******************************************************************/
+/* Function definition */
+int EarClipper::RingLink
+(
+int first,      /* I: first point of the ring */
+int end,        /* I: end of the ring */
+int outer       /* I: 1 to link the ring counterclockwise (outer ring), 0 clockwise (hole) */
+)
+/*
+DESCRIPTION:
+   Link the points of a ring in the wanted direction, without a last
+point repeating the first.
+
+   Return the last node, or -1 if the ring is empty.
+*/
+{
+    double area = 0.0;
+    for (int i = first, j = end - 1; i < end; j = i++)
+    {
+        const double xi = (&m_points[i].x)[m_axisU], yi = m_signV * (&m_points[i].x)[m_axisV];
+        const double xj = (&m_points[j].x)[m_axisU], yj = m_signV * (&m_points[j].x)[m_axisV];
+        area += (xj - xi) * (yi + yj);
+    }
+
+    int last = -1;
+    if ((outer != 0) == (area > 0.0))
+    {
+        for (int i = first; i < end; i++)
+            last = NodeInsert(i, last);
+    }
+    else
+    {
+        for (int i = end - 1; i >= first; i--)
+            last = NodeInsert(i, last);
+    }
+    if (last >= 0 && Equals(last, m_nodes[last].next))
+    {
+        const int next = m_nodes[last].next;
+        NodeRemove(last);
+        last = next;
+    }
+    return last;
+}
+
+/*******************************************************************/
+/* Function definition */
+int EarClipper::PointsFilter
+(
+int start,   /* I: first node */
+int end      /* I: node to stop at, -1 for "start" */
+)
+/*
+DESCRIPTION:
+   Remove duplicate and collinear points from a ring.
+
+   Return a node still in the ring.
+*/
+{
+    if (start < 0)
+        return start;
+    end = end < 0 ? start : end;
+
+    int p = start, again = 0;
+    do
+    {
+        again = 0;
+        const Node &node = m_nodes[p];
+        if (!node.steiner && (Equals(p, node.next) || Area(node.prev, p, node.next) == 0.0))
+        {
+            NodeRemove(p);
+            p = end = m_nodes[p].prev;
+            if (p == m_nodes[p].next)
+                break;
+            again = 1;
+        }
+        else
+            p = node.next;
+    } while (again || p != end);
+    return end;
+}
+
+/*******************************************************************/
+/* Function definition */
+void EarClipper::EarsCut
+(
+int ear,    /* I: node to start at */
+int pass    /* I: 0 first, 1 after filtering, 2 after curing self-intersections */
+)
+/*
+DESCRIPTION:
+   Cut ears from a ring until a triangle is left. A ring without an ear
+is filtered and tried again, then cured of local self-intersections, then
+split in two.
+*/
+{
+    if (ear < 0)
+        return;
+    if (pass == 0 && m_invSize > 0.0)
+        CurveIndex(ear);
+
+    int stop = ear;
+    while (m_nodes[ear].prev != m_nodes[ear].next)
+    {
+        const int prev = m_nodes[ear].prev, next = m_nodes[ear].next;
+        if (m_invSize > 0.0 ? IsEarHashed(ear) : IsEar(ear))
+        {
+            Emit(prev, ear, next);
+            NodeRemove(ear);
+            ear = stop = m_nodes[next].next;
+            continue;
+        }
+
+        ear = next;
+        if (ear == stop)
+        {
+            if (pass == 0)
+                EarsCut(PointsFilter(ear, -1), 1);
+            else if (pass == 1)
+                EarsCut(LocalIntersectionsCure(PointsFilter(ear, -1)), 2);
+            else
+                EarcutSplit(ear);
+            break;
+        }
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+int EarClipper::IsEar
+(
+int ear   /* I: node */
+) const
+/*
+DESCRIPTION:
+   Return 1 if the node is convex and no point of the ring is inside
+its triangle, else 0.
+*/
+{
+    const Node &a = m_nodes[m_nodes[ear].prev], &b = m_nodes[ear], &c = m_nodes[b.next];
+    if (Area(b.prev, ear, b.next) >= 0.0)
+        return 0;
+
+    const double x0 = std::min(a.x, std::min(b.x, c.x)), y0 = std::min(a.y, std::min(b.y, c.y));
+    const double x1 = std::max(a.x, std::max(b.x, c.x)), y1 = std::max(a.y, std::max(b.y, c.y));
+    for (int p = c.next; p != b.prev; p = m_nodes[p].next)
+    {
+        const Node &node = m_nodes[p];
+        if (node.x >= x0 && node.x <= x1 && node.y >= y0 && node.y <= y1 &&
+            PointInTriangle(a.x, a.y, b.x, b.y, c.x, c.y, node.x, node.y) && Area(node.prev, p, node.next) >= 0.0)
+            return 0;
+    }
+    return 1;
+}
+
+/*******************************************************************/
+/* Function definition */
+int EarClipper::IsEarHashed
+(
+int ear   /* I: node */
+) const
+/*
+DESCRIPTION:
+   Same as IsEar(), visiting only the nodes whose z-order code is in the
+range of the triangle's bounding box, from the ear both ways.
+*/
+{
+    const Node &a = m_nodes[m_nodes[ear].prev], &b = m_nodes[ear], &c = m_nodes[b.next];
+    if (Area(b.prev, ear, b.next) >= 0.0)
+        return 0;
+
+    const double x0 = std::min(a.x, std::min(b.x, c.x)), y0 = std::min(a.y, std::min(b.y, c.y));
+    const double x1 = std::max(a.x, std::max(b.x, c.x)), y1 = std::max(a.y, std::max(b.y, c.y));
+    const unsigned int minZ = ZOrder(x0, y0), maxZ = ZOrder(x1, y1);
+    auto inside = [&](int p)
+    {
+        const Node &node = m_nodes[p];
+        return node.x >= x0 && node.x <= x1 && node.y >= y0 && node.y <= y1 && p != b.prev && p != b.next &&
+            PointInTriangle(a.x, a.y, b.x, b.y, c.x, c.y, node.x, node.y) && Area(node.prev, p, node.next) >= 0.0;
+    };
+
+    int p = b.prevZ, n = b.nextZ;
+    while (p >= 0 && m_nodes[p].z >= minZ && n >= 0 && m_nodes[n].z <= maxZ)
+    {
+        if (inside(p) || inside(n))
+            return 0;
+        p = m_nodes[p].prevZ;
+        n = m_nodes[n].nextZ;
+    }
+    for (; p >= 0 && m_nodes[p].z >= minZ; p = m_nodes[p].prevZ)
+    {
+        if (inside(p))
+            return 0;
+    }
+    for (; n >= 0 && m_nodes[n].z <= maxZ; n = m_nodes[n].nextZ)
+    {
+        if (inside(n))
+            return 0;
+    }
+    return 1;
+}
+
+/*******************************************************************/
+/* Function definition */
+int EarClipper::LocalIntersectionsCure
+(
+int start   /* I: node to start at */
+)
+/*
+DESCRIPTION:
+   Cut the triangle of two crossing neighbour edges "a-p" and "p.next-b",
+as a ring drawn with a small loop has.
+
+   Return a node still in the ring.
+*/
+{
+    int p = start;
+    do
+    {
+        const int a = m_nodes[p].prev, b = m_nodes[m_nodes[p].next].next;
+        if (!Equals(a, b) && Intersects(a, p, m_nodes[p].next, b) && LocallyInside(a, b) && LocallyInside(b, a))
+        {
+            Emit(a, p, b);
+            const int next = m_nodes[p].next;
+            NodeRemove(p);
+            NodeRemove(next);
+            p = start = b;
+        }
+        p = m_nodes[p].next;
+    } while (p != start);
+    return PointsFilter(p, -1);
+}
+
+/*******************************************************************/
+/* Function definition */
+void EarClipper::EarcutSplit
+(
+int start   /* I: node to start at */
+)
+/*
+DESCRIPTION:
+   Split a ring without ears along the first valid diagonal and cut both
+parts.
+*/
+{
+    int a = start;
+    do
+    {
+        for (int b = m_nodes[m_nodes[a].next].next; b != m_nodes[a].prev; b = m_nodes[b].next)
+        {
+            if (m_nodes[a].i != m_nodes[b].i && ValidDiagonal(a, b))
+            {
+                int c = PolygonSplit(a, b);
+                a = PointsFilter(a, m_nodes[a].next);
+                c = PointsFilter(c, m_nodes[c].next);
+                EarsCut(a, 0);
+                EarsCut(c, 0);
+                return;
+            }
+        }
+        a = m_nodes[a].next;
+    } while (a != start);
+}
+
+/*******************************************************************/
+/* Function definition */
+int EarClipper::HolesEliminate
+(
+int outer,               /* I: node of the outer ring */
+int ringCount,           /* I: rings of the polygon */
+const int *ringStarts    /* I: first point of each ring */
+)
+/*
+DESCRIPTION:
+   Join every hole to the outer ring by a bridge from its leftmost point,
+holes from left to right, so one ring is left.
+
+   Return a node of the joined ring.
+*/
+{
+    m_holes.clear();
+    for (int r = 1; r < ringCount; r++)
+    {
+        const int list = RingLink(ringStarts[r] - ringStarts[0], ringStarts[r + 1] - ringStarts[0], 0);
+        if (list < 0)
+            continue;
+        if (list == m_nodes[list].next)
+            m_nodes[list].steiner = 1;
+
+        int left = list;
+        for (int p = m_nodes[list].next; p != list; p = m_nodes[p].next)
+        {
+            if (m_nodes[p].x < m_nodes[left].x || (m_nodes[p].x == m_nodes[left].x && m_nodes[p].y < m_nodes[left].y))
+                left = p;
+        }
+        m_holes.push_back(left);
+    }
+    std::sort(m_holes.begin(), m_holes.end(), [this](int a, int b) { return m_nodes[a].x < m_nodes[b].x; });
+
+    for (int hole : m_holes)
+    {
+        const int bridge = HoleBridge(hole, outer);
+        if (bridge < 0)
+            continue;
+        const int bridgeReverse = PolygonSplit(bridge, hole);
+        PointsFilter(bridgeReverse, m_nodes[bridgeReverse].next);
+        outer = PointsFilter(bridge, m_nodes[bridge].next);
+    }
+    return outer;
+}
+
+/*******************************************************************/
+/* Function definition */
+int EarClipper::HoleBridge
+(
+int hole,    /* I: leftmost node of a hole */
+int outer    /* I: node of the outer ring */
+) const
+/*
+DESCRIPTION:
+   Find the outer node to join a hole to: the nearest edge left of the
+hole point on its horizontal, then of the reflex nodes inside the
+triangle this makes, the one of the smallest angle to the horizontal.
+
+   Return the node, or -1 if there is none.
+*/
+{
+    const double hx = m_nodes[hole].x, hy = m_nodes[hole].y;
+    double qx = -DBL_MAX;
+    int m = -1, p = outer;
+    do
+    {
+        const Node &a = m_nodes[p], &b = m_nodes[a.next];
+        if (hy <= a.y && hy >= b.y && b.y != a.y)
+        {
+            const double x = a.x + (hy - a.y) * (b.x - a.x) / (b.y - a.y);
+            if (x <= hx && x > qx)
+            {
+                qx = x;
+                m = a.x < b.x ? p : a.next;
+                if (x == hx)
+                    return m;
+            }
+        }
+        p = a.next;
+    } while (p != outer);
+    if (m < 0)
+        return -1;
+
+    const int stop = m;
+    const double mx = m_nodes[m].x, my = m_nodes[m].y;
+    double tanMin = DBL_MAX;
+    p = m;
+    do
+    {
+        const Node &node = m_nodes[p];
+        if (hx >= node.x && node.x >= mx && hx != node.x &&
+            PointInTriangle(hy < my ? hx : qx, hy, mx, my, hy < my ? qx : hx, hy, node.x, node.y))
+        {
+            const double tangent = fabs(hy - node.y) / (hx - node.x);
+            if (LocallyInside(p, hole) && (tangent < tanMin || (tangent == tanMin &&
+                (node.x > m_nodes[m].x || (node.x == m_nodes[m].x && SectorContainsSector(m, p))))))
+            {
+                m = p;
+                tanMin = tangent;
+            }
+        }
+        p = node.next;
+    } while (p != stop);
+    return m;
+}
+
+/*******************************************************************/
+/* Function definition */
+int EarClipper::PolygonSplit
+(
+int a,   /* I: first end of the diagonal */
+int b    /* I: second end */
+)
+/*
+DESCRIPTION:
+   Split a ring along diagonal "a-b" (or join two rings by it), copying
+both ends.
+
+   Return the copy of "b", in the second ring.
+*/
+{
+    const int an = m_nodes[a].next, bp = m_nodes[b].prev;
+    const int a2 = NodeInsert(m_nodes[a].i, -1), b2 = NodeInsert(m_nodes[b].i, -1);
+    m_nodes[a].next = b;
+    m_nodes[b].prev = a;
+    m_nodes[a2].next = an;
+    m_nodes[an].prev = a2;
+    m_nodes[b2].next = a2;
+    m_nodes[a2].prev = b2;
+    m_nodes[bp].next = b2;
+    m_nodes[b2].prev = bp;
+    return b2;
+}
+
+/*******************************************************************/
+/* Function definition */
+void EarClipper::CurveIndex
+(
+int start   /* I: node of the ring */
+)
+/*
+DESCRIPTION:
+   Give every node its z-order code and link the nodes in code order.
+*/
+{
+    int p = start;
+    do
+    {
+        Node &node = m_nodes[p];
+        if (node.z == 0)
+            node.z = ZOrder(node.x, node.y);
+        node.prevZ = node.prev;
+        node.nextZ = node.next;
+        p = node.next;
+    } while (p != start);
+    m_nodes[m_nodes[p].prevZ].nextZ = -1;
+    m_nodes[p].prevZ = -1;
+    LinkedSort(p);
+}
+
+/*******************************************************************/
+/* Function definition */
+int EarClipper::LinkedSort
+(
+int list   /* I: first node of the z-order list */
+)
+/*
+DESCRIPTION:
+   Sort the z-order list by code, merging runs of doubling length in
+place.
+
+   Return the first node.
+*/
+{
+    int inSize = 1, merges = 0;
+    do
+    {
+        int p = list, tail = -1;
+        list = -1;
+        merges = 0;
+        while (p >= 0)
+        {
+            merges++;
+            int q = p, pSize = 0;
+            for (int i = 0; i < inSize && q >= 0; i++)
+            {
+                pSize++;
+                q = m_nodes[q].nextZ;
+            }
+            int qSize = inSize;
+            while (pSize > 0 || (qSize > 0 && q >= 0))
+            {
+                int e = -1;
+                if (pSize != 0 && (qSize == 0 || q < 0 || m_nodes[p].z <= m_nodes[q].z))
+                {
+                    e = p;
+                    p = m_nodes[p].nextZ;
+                    pSize--;
+                }
+                else
+                {
+                    e = q;
+                    q = m_nodes[q].nextZ;
+                    qSize--;
+                }
+                if (tail >= 0)
+                    m_nodes[tail].nextZ = e;
+                else
+                    list = e;
+                m_nodes[e].prevZ = tail;
+                tail = e;
+            }
+            p = q;
+        }
+        m_nodes[tail].nextZ = -1;
+        inSize *= 2;
+    } while (merges > 1);
+    return list;
+}
+
+/*******************************************************************/
+/* Function definition */
+unsigned int EarClipper::ZOrder
+(
+double x,   /* I: projected x */
+double y    /* I: projected y */
+) const
+/*
+DESCRIPTION:
+   Z-order code of a position: the bits of its 15-bit grid cell in x and
+y interleaved.
+*/
+{
+    unsigned int ix = (unsigned int)((x - m_minX) * m_invSize), iy = (unsigned int)((y - m_minY) * m_invSize);
+    ix = (ix | (ix << 8)) & 0x00FF00FF;
+    ix = (ix | (ix << 4)) & 0x0F0F0F0F;
+    ix = (ix | (ix << 2)) & 0x33333333;
+    ix = (ix | (ix << 1)) & 0x55555555;
+    iy = (iy | (iy << 8)) & 0x00FF00FF;
+    iy = (iy | (iy << 4)) & 0x0F0F0F0F;
+    iy = (iy | (iy << 2)) & 0x33333333;
+    iy = (iy | (iy << 1)) & 0x55555555;
+    return ix | (iy << 1);
+}
+
+/*******************************************************************/
+/* Function definition */
+double EarClipper::Area
+(
+int p,   /* I: first node */
+int q,   /* I: second node */
+int r    /* I: third node */
+) const
+/*
+DESCRIPTION:
+   Twice the signed area of triangle "pqr", negative if it turns
+counterclockwise.
+*/
+{
+    const Node &a = m_nodes[p], &b = m_nodes[q], &c = m_nodes[r];
+    return (b.y - a.y) * (c.x - b.x) - (b.x - a.x) * (c.y - b.y);
+}
+
+/*******************************************************************/
+/* Function definition */
+int EarClipper::Equals
+(
+int a,   /* I: first node */
+int b    /* I: second node */
+) const
+/*
+DESCRIPTION:
+   Return 1 if both nodes are at the same position, else 0.
+*/
+{
+    return m_nodes[a].x == m_nodes[b].x && m_nodes[a].y == m_nodes[b].y;
+}
+
+/*******************************************************************/
+/* Function definition */
+int EarClipper::Intersects
+(
+int p1,   /* I: first segment start */
+int q1,   /* I: first segment end */
+int p2,   /* I: second segment start */
+int q2    /* I: second segment end */
+) const
+/*
+DESCRIPTION:
+   Return 1 if the segments cross or touch, else 0.
+*/
+{
+    const double o1 = Sign(Area(p1, q1, p2)), o2 = Sign(Area(p1, q1, q2));
+    const double o3 = Sign(Area(p2, q2, p1)), o4 = Sign(Area(p2, q2, q1));
+    if (o1 != o2 && o3 != o4)
+        return 1;
+
+    const Node &a = m_nodes[p1], &b = m_nodes[q1], &c = m_nodes[p2], &d = m_nodes[q2];
+    return (o1 == 0.0 && OnSegment(a.x, a.y, c.x, c.y, b.x, b.y)) || (o2 == 0.0 && OnSegment(a.x, a.y, d.x, d.y, b.x, b.y)) ||
+        (o3 == 0.0 && OnSegment(c.x, c.y, a.x, a.y, d.x, d.y)) || (o4 == 0.0 && OnSegment(c.x, c.y, b.x, b.y, d.x, d.y));
+}
+
+/*******************************************************************/
+/* Function definition */
+int EarClipper::IntersectsPolygon
+(
+int a,   /* I: diagonal start */
+int b    /* I: diagonal end */
+) const
+/*
+DESCRIPTION:
+   Return 1 if diagonal "a-b" crosses an edge of the ring not ending at
+"a" or "b", else 0.
+*/
+{
+    const int ia = m_nodes[a].i, ib = m_nodes[b].i;
+    int p = a;
+    do
+    {
+        const Node &node = m_nodes[p], &next = m_nodes[node.next];
+        if (node.i != ia && next.i != ia && node.i != ib && next.i != ib && Intersects(p, node.next, a, b))
+            return 1;
+        p = node.next;
+    } while (p != a);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int EarClipper::LocallyInside
+(
+int a,   /* I: diagonal start */
+int b    /* I: diagonal end */
+) const
+/*
+DESCRIPTION:
+   Return 1 if diagonal "a-b" leaves "a" into the inside of the ring,
+else 0.
+*/
+{
+    const Node &node = m_nodes[a];
+    return Area(node.prev, a, node.next) < 0.0 ? Area(a, b, node.next) >= 0.0 && Area(a, node.prev, b) >= 0.0 :
+        Area(a, b, node.prev) < 0.0 || Area(a, node.next, b) < 0.0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int EarClipper::MiddleInside
+(
+int a,   /* I: diagonal start */
+int b    /* I: diagonal end */
+) const
+/*
+DESCRIPTION:
+   Return 1 if the middle of diagonal "a-b" is inside the ring, else 0.
+*/
+{
+    const double px = (m_nodes[a].x + m_nodes[b].x) / 2.0, py = (m_nodes[a].y + m_nodes[b].y) / 2.0;
+    int p = a, inside = 0;
+    do
+    {
+        const Node &node = m_nodes[p], &next = m_nodes[node.next];
+        if ((node.y > py) != (next.y > py) && next.y != node.y &&
+            px < (next.x - node.x) * (py - node.y) / (next.y - node.y) + node.x)
+            inside = !inside;
+        p = node.next;
+    } while (p != a);
+    return inside;
+}
+
+/*******************************************************************/
+/* Function definition */
+int EarClipper::ValidDiagonal
+(
+int a,   /* I: diagonal start */
+int b    /* I: diagonal end */
+) const
+/*
+DESCRIPTION:
+   Return 1 if diagonal "a-b" splits the ring into two rings without
+crossing it, else 0.
+*/
+{
+    const Node &na = m_nodes[a], &nb = m_nodes[b];
+    if (m_nodes[na.next].i == nb.i || m_nodes[na.prev].i == nb.i || IntersectsPolygon(a, b))
+        return 0;
+    return (LocallyInside(a, b) && LocallyInside(b, a) && MiddleInside(a, b) &&
+        (Area(na.prev, a, nb.prev) != 0.0 || Area(a, nb.prev, b) != 0.0)) ||
+        (Equals(a, b) && Area(na.prev, a, na.next) > 0.0 && Area(nb.prev, b, nb.next) > 0.0);
+}
+
+/*******************************************************************/
+/* Function definition */
+int EarClipper::SectorContainsSector
+(
+int m,   /* I: node */
+int p    /* I: node at the same position */
+) const
+/*
+DESCRIPTION:
+   Return 1 if the corner of the ring at "p" is inside the corner at "m",
+else 0.
+*/
+{
+    return Area(m_nodes[m].prev, m, m_nodes[p].prev) < 0.0 && Area(m_nodes[p].next, m, m_nodes[m].next) < 0.0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void EarClipper::Emit
+(
+int a,   /* I: first node */
+int b,   /* I: second node */
+int c    /* I: third node */
+)
+/*
+DESCRIPTION:
+   Write a triangle. Ears are counterclockwise in the projection, as the
+outer ring, so the triangle turns as the outer ring in space.
+*/
+{
+    if (m_count + 3 <= m_capacity)
+    {
+        m_indices[m_count] = m_nodes[a].i;
+        m_indices[m_count + 1] = m_nodes[b].i;
+        m_indices[m_count + 2] = m_nodes[c].i;
+    }
+    m_count += 3;
+}
+
+/*******************************************************************/
+/* Function definition */
+PolygonTriangulator::PolygonTriangulator
+(
+)
+/*
+DESCRIPTION:
+   Create a triangulator.
+*/
+{
+}
+
+/*******************************************************************/
+/* Function definition */
+int PolygonTriangulator::IndexOffsets
+(
+const PolygonSet &set,   /* I: polygons */
+int *indexOffsets        /* O: first index of each polygon, polygonCount + 1 entries */
+)
+/*
+DESCRIPTION:
+   Place the indices of the polygons in one output, each with room for
+the most triangles ear clipping gives it.
+
+   Return the size of the output, indexOffsets[polygonCount].
+*/
+{
+    int offset = 0;
+    for (int p = 0; p < set.polygonCount; p++)
+    {
+        indexOffsets[p] = offset;
+        const int firstRing = set.polygonRings[p], endRing = set.polygonRings[p + 1];
+        const int points = set.ringStarts[endRing] - set.ringStarts[firstRing];
+        const int triangles = points + 2 * (endRing - firstRing - 1) - 2;
+        offset += triangles > 0 ? 3 * triangles : 0;
+    }
+    indexOffsets[set.polygonCount] = offset;
+    return offset;
+}
+
+/*******************************************************************/
+/* Function definition */
+void PolygonTriangulator::TaskRun
+(
+void *data,    /* I: running batch */
+int begin,     /* I: first polygon */
+int end,       /* I: end of the range */
+int worker     /* I: worker running the range */
+)
+/*
+DESCRIPTION:
+   Triangulate a range of polygons with the clipper of the worker.
+*/
+{
+    Batch *batch = (Batch *)data;
+    const PolygonSet &set = *batch->set;
+    EarClipper &clipper = batch->self->m_clippers[worker];
+    for (int p = begin; p < end; p++)
+    {
+        const int offset = batch->indexOffsets[p];
+        batch->indexCounts[p] = clipper.Triangulate(set.points, set.polygonRings[p + 1] - set.polygonRings[p],
+            set.ringStarts + set.polygonRings[p], batch->indexOffsets[p + 1] - offset, batch->indices + offset);
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+int PolygonTriangulator::Triangulate
+(
+const PolygonSet &set,      /* I: polygons */
+const int *indexOffsets,    /* I: first index of each polygon, from IndexOffsets() */
+WorkPool *pool,             /* I: pool running the polygons, nullptr for this thread only */
+int *indices,               /* O: three indices per triangle, from the first point of each polygon */
+int *indexCounts            /* O: number of indices of each polygon, -1 if it failed */
+)
+/*
+DESCRIPTION:
+   Triangulate a batch of polygons.
+
+   Return the number of failed polygons, or -1 if the input is invalid.
+*/
+{
+    if (set.polygonCount < 0 || (set.polygonCount > 0 && (set.points == nullptr || set.ringStarts == nullptr ||
+        set.polygonRings == nullptr || indexOffsets == nullptr || indices == nullptr || indexCounts == nullptr)))
+        return -1;
+
+    Batch batch;
+    batch.self = this;
+    batch.set = &set;
+    batch.indexOffsets = indexOffsets;
+    batch.indices = indices;
+    batch.indexCounts = indexCounts;
+    const int workers = pool != nullptr ? pool->ThreadCount() : 1;
+    if ((int)m_clippers.size() < workers)
+        m_clippers.resize(workers);
+    if (pool != nullptr)
+        pool->Run(set.polygonCount, TRIANGULATE_GRAIN, TaskRun, &batch);
+    else
+        TaskRun(&batch, 0, set.polygonCount, 0);
+
+    int failed = 0;
+    for (int p = 0; p < set.polygonCount; p++)
+        failed += indexCounts[p] < 0 ? 1 : 0;
+    return failed;
+}
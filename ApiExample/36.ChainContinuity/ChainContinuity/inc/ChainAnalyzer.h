@@ -0,0 +1,186 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+#pragma once
+
+/* ZW3D API includes */
+#include "zwapi_util.h"
+#include "zwapi_curve_data.h"
+
+/* Application includes */
+#include <vector>
+#include "NurbsCurveEval.h"
+#include "WorkPool.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define CHAIN_MAX_SAMPLES 256        /* comb samples per knot span (or quarter circle), at most */
+#define CHAIN_CUSP_ANGLE 90.0        /* tangent turn between neighbour samples taken as a cusp (degree) */
+#define CHAIN_REFINE_STEPS 40        /* bisections locating an inflection or a cusp */
+#define CHAIN_STRAIGHT 1.0e-9        /* curvature (1/mm) below which a curve is taken as straight */
+#define CHAIN_GRAIN 4                /* curves taken at a time by a pool worker */
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: settings of an analysis */
+struct ChainOptions
+{
+    szwCurveContinuityToleranceList tolerance;   /* as ZwCurveContinuityGet(), see ChainJoint */
+    int samples;                                 /* comb samples per knot span, or per quarter of an arc */
+};
+
+/* DESCRIPTION: kind of a joint */
+enum ChainJointKind
+{
+    Chain_Curves = 0,    /* end of a curve and start of the next one */
+    Chain_Knot = 1,      /* interior knot of a NURBS curve breaking G2 */
+};
+
+/*
+DESCRIPTION:
+   Deviations at a joint, in chain direction. position is the gap (mm),
+tangent the angle between the tangents (degree), curvature the difference
+of the curvature vectors over the larger curvature, flow the difference
+of the derivatives of curvature along the arc length over the larger one
+(both 0 where the curve is straight). level is the continuity reached
+with the tolerances: -1 for a gap, then 0 to 3 for G0 to G3.
+*/
+struct ChainJoint
+{
+    int curve;           /* curve ending at the joint (Chain_Curves) or holding the knot (Chain_Knot) */
+    ChainJointKind kind;
+    double t;            /* parameter of the joint on "curve" */
+    double s;            /* arc length from the chain start */
+    svxPoint point;
+    double position, tangent, curvature, flow;
+    int level;
+};
+
+/* DESCRIPTION: kind of a feature found inside a curve */
+enum ChainFeatureKind
+{
+    Chain_Inflection = 0,    /* the curvature comb changes side */
+    Chain_Cusp = 1,          /* the tangent reverses or the speed is zero */
+};
+
+/* DESCRIPTION: feature inside a curve */
+struct ChainFeature
+{
+    int curve;
+    ChainFeatureKind kind;
+    double t;            /* parameter on "curve" */
+    double s;            /* arc length from the chain start */
+    svxPoint point;
+};
+
+/*
+DESCRIPTION:
+   Curvature comb of a chain in columns, samples in chain direction:
+the samples of curve i are offsets[i] to offsets[i + 1] - 1. A comb tooth
+goes from (x, y, z) to (x, y, z) - scale * curvature * (nx, ny, nz), out
+of the bend.
+*/
+struct ChainComb
+{
+    std::vector<double> t;                /* parameter on the curve */
+    std::vector<double> s;                /* arc length from the chain start */
+    std::vector<double> x, y, z;          /* point */
+    std::vector<double> nx, ny, nz;       /* unit principal normal, 0 where straight */
+    std::vector<double> curvature;        /* 1 / radius */
+    std::vector<double> flow;             /* derivative of curvature along the arc length */
+    std::vector<int> offsets;             /* curve count + 1 entries */
+
+    int Count(void) const { return (int)t.size(); }
+};
+
+/* DESCRIPTION: result of an analysis */
+struct ChainResult
+{
+    ChainComb comb;
+    std::vector<ChainJoint> joints;       /* in chain order */
+    std::vector<ChainFeature> features;   /* in chain order */
+    std::vector<char> reversed;           /* 1 if the curve runs against the chain */
+    int closed;                           /* 1 if the last curve ends at the first one */
+    double length;                        /* arc length of the chain */
+    int level;                            /* lowest level of the joints between curves, 3 if none */
+};
+
+/*
+DESCRIPTION:
+   Curvature and continuity analysis of a chain of curves read once with
+cvxPartInqCurve(), in the order of cvxPartCurveChainFind() /
+ZwCurveChainGet(): lines, arcs and circles from their analytic data,
+NURBS curves with the batch evaluator (NurbsCurveEval.h).
+
+   Analyze() turns every curve so the chain runs end to start, samples
+each curve densely ("samples" per knot span), and evaluates the first
+three derivatives of all samples of a curve at once; the curvature, the
+principal normal and the derivative of curvature along the arc length
+(the "flow" of G3) are computed from them in one branch-free loop over
+columns. Joints between curves (and interior knots of NURBS curves where
+G2 breaks) get the deviations of ZwCurveContinuityGet(). Between
+neighbour samples, a binormal that flips is an inflection and a tangent
+that turns more than CHAIN_CUSP_ANGLE is a cusp; both are located by
+bisection.
+
+   The curves run on a WorkPool, each writing its samples at their
+place in the columns. The analyzer is immutable after Add() and may be
+shared by threads.
+*/
+class ChainAnalyzer
+{
+public:
+    ChainAnalyzer();
+
+    int Add(const svxCurve &curve);
+    void Clear(void);
+    int Count(void) const { return (int)m_curves.size(); }
+
+    int Analyze(const ChainOptions &options, WorkPool *pool, ChainResult *result) const;
+    int Evaluate(int curve, double t, svxEvalCurv *eval) const;
+    svxLimit Domain(int curve) const;
+
+private:
+    /* curve data in world space */
+    struct Curve
+    {
+        evxCurveType type;
+        svxPoint start, end;          /* line */
+        svxPoint center;              /* arc and circle */
+        svxVector xAxis, yAxis;       /* arc plane, angle 0 on xAxis */
+        double radius;
+        svxLimit domain;              /* line 0 to 1, arc in degrees, NURBS knots */
+        int nurbs;                    /* index in m_nurbs, -1 if none */
+        std::vector<double> breaks;   /* distinct knots inside the domain, ends included */
+    };
+
+    /* buffers of a pool worker */
+    struct Scratch
+    {
+        std::vector<svxEvalCurv> evals;   /* derivatives of the samples of a curve */
+        std::vector<double> columns;      /* the same in columns, then the comb values */
+    };
+
+    /* data of a running Analyze() */
+    struct Batch
+    {
+        const ChainAnalyzer *self;
+        const ChainOptions *options;
+        ChainResult *result;
+        std::vector<double> lengths;                     /* arc length per curve */
+        std::vector<std::vector<ChainJoint>> knots;      /* knot joints per curve */
+        std::vector<std::vector<ChainFeature>> found;    /* features per curve */
+        std::vector<Scratch> scratch;                    /* one per worker */
+    };
+
+    static void TaskRun(void *data, int begin, int end, int worker);
+    int SampleCount(int curve, int samples) const;
+    void CurveRun(int curve, Batch *batch, Scratch &scratch) const;
+    void JointMeasure(const svxEvalCurv &before, const svxEvalCurv &after, const ChainOptions &options,
+        ChainJoint *joint) const;
+    double FeatureLocate(int curve, ChainFeatureKind kind, double t0, double t1) const;
+
+    std::vector<Curve> m_curves;
+    std::vector<NurbsCurveEvaluator> m_nurbs;
+};
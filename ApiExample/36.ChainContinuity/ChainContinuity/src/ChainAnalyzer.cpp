@@ -0,0 +1,729 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* Application includes */
+#include <math.h>
+#include <algorithm>
+#include "..\inc\ChainAnalyzer.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define CHAIN_PI 3.14159265358979323846
+#define CHAIN_KNOT_SIDE 1.0e-9       /* parameter step to either side of a knot, part of the domain */
+#define CHAIN_COLUMNS 10             /* three derivatives and the speed per sample */
+
+/*******************************************************************/
+/* Function declarations */
+static inline void CombPoint(double ax, double ay, double az, double bx, double by, double bz,
+    double cx, double cy, double cz, double *curvature, double *nx, double *ny, double *nz, double *flow,
+    double *speed);
+static void EvalFlip(svxEvalCurv *eval);
+static double Distance(const svxPoint &a, const svxPoint &b);
+
+/*******************************************************************/
+/* Function definition */
+inline void CombPoint
+(
+double ax, double ay, double az,   /* I: first derivative */
+double bx, double by, double bz,   /* I: second derivative */
+double cx, double cy, double cz,   /* I: third derivative */
+double *curvature,                 /* O: curvature */
+double *nx, double *ny, double *nz,   /* O: unit principal normal, 0 if straight */
+double *flow,                      /* O: derivative of curvature along the arc length */
+double *speed                      /* O: length of the first derivative */
+)
+/*
+DESCRIPTION:
+   Curvature values of one sample from its derivatives, without branches
+so that a loop over columns of samples vectorizes.
+
+   With a, b, c the derivatives and w = a x b: curvature k = |w| / |a|^3,
+principal normal along (a.a) b - (a.b) a, whose length is |a| |w|, and
+dk/dt = (w.(a x c)) / (|w| |a|^3) - 3 k (a.b) / |a|^2, divided by |a| to
+go from t to the arc length.
+*/
+{
+    const double wx = ay * bz - az * by, wy = az * bx - ax * bz, wz = ax * by - ay * bx;
+    const double ux = ay * cz - az * cy, uy = az * cx - ax * cz, uz = ax * cy - ay * cx;
+    const double v2 = ax * ax + ay * ay + az * az;
+    const double v = sqrt(v2);
+    const double v3 = v2 * v;
+    const double w = sqrt(wx * wx + wy * wy + wz * wz);
+    const double ab = ax * bx + ay * by + az * bz;
+    const double k = v3 > 0.0 ? w / v3 : 0.0;
+    const double length = v * w;
+    const double scale = length > 0.0 ? 1.0 / length : 0.0;
+    const double dw = w > 0.0 ? (wx * ux + wy * uy + wz * uz) / w : 0.0;
+    const double dk = v3 > 0.0 ? dw / v3 - 3.0 * k * ab / v2 : 0.0;
+
+    *curvature = k;
+    *nx = (v2 * bx - ab * ax) * scale;
+    *ny = (v2 * by - ab * ay) * scale;
+    *nz = (v2 * bz - ab * az) * scale;
+    *flow = v > 0.0 ? dk / v : 0.0;
+    *speed = v;
+}
+
+/*******************************************************************/
+/* Function definition */
+void EvalFlip
+(
+svxEvalCurv *eval   /* I/O: derivatives */
+)
+/*
+DESCRIPTION:
+   Turn the derivatives of a point to the reverse direction of the
+curve: the odd ones change sign.
+*/
+{
+    eval->deriv_1.x = -eval->deriv_1.x;
+    eval->deriv_1.y = -eval->deriv_1.y;
+    eval->deriv_1.z = -eval->deriv_1.z;
+    eval->deriv_3.x = -eval->deriv_3.x;
+    eval->deriv_3.y = -eval->deriv_3.y;
+    eval->deriv_3.z = -eval->deriv_3.z;
+}
+
+/*******************************************************************/
+/* Function definition */
+double Distance
+(
+const svxPoint &a,   /* I: point */
+const svxPoint &b    /* I: point */
+)
+/*
+DESCRIPTION:
+   Distance between two points.
+*/
+{
+    const double x = a.x - b.x, y = a.y - b.y, z = a.z - b.z;
+    return sqrt(x * x + y * y + z * z);
+}
+
+/*******************************************************************/
+/* Function definition */
+ChainAnalyzer::ChainAnalyzer
+(
+void
+)
+/*
+DESCRIPTION:
+   Empty chain.
+*/
+{
+}
+
+/*******************************************************************/
+/* Function definition */
+void ChainAnalyzer::Clear
+(
+void
+)
+/*
+DESCRIPTION:
+   Remove all curves.
+*/
+{
+    m_curves.clear();
+    m_nurbs.clear();
+}
+
+/*******************************************************************/
+/* Function definition */
+int ChainAnalyzer::Add
+(
+const svxCurve &curve   /* I: curve data of cvxPartInqCurve() */
+)
+/*
+DESCRIPTION:
+   Append a curve to the chain. Arcs and circles with a frame have their
+center at the frame origin and lie in its XY plane; without a frame
+(identity) they are 2D curves centered at P1. Their parameter is the
+angle in degrees, split in quarters of a circle at most.
+
+   Return the index of the curve, or -1 if the curve type or its data is
+not supported.
+*/
+{
+    Curve item;
+    item.type = curve.Type;
+    item.start = curve.P1;
+    item.end = curve.P2;
+    item.center = curve.P1;
+    item.xAxis.x = 1.0;
+    item.xAxis.y = item.xAxis.z = 0.0;
+    item.yAxis.y = 1.0;
+    item.yAxis.x = item.yAxis.z = 0.0;
+    item.radius = curve.R;
+    item.domain.min = 0.0;
+    item.domain.max = 1.0;
+    item.nurbs = -1;
+
+    switch (curve.Type)
+    {
+    case VX_CRV_LINE:
+        item.breaks.push_back(0.0);
+        item.breaks.push_back(1.0);
+        break;
+
+    case VX_CRV_ARC:
+    case VX_CRV_CIRCLE:
+    {
+        if (!(curve.R > 0.0))
+            return -1;
+        if (!curve.Frame.identity)
+        {
+            item.center.x = curve.Frame.xt;
+            item.center.y = curve.Frame.yt;
+            item.center.z = curve.Frame.zt;
+            item.xAxis.x = curve.Frame.xx;
+            item.xAxis.y = curve.Frame.yx;
+            item.xAxis.z = curve.Frame.zx;
+            item.yAxis.x = curve.Frame.xy;
+            item.yAxis.y = curve.Frame.yy;
+            item.yAxis.z = curve.Frame.zy;
+        }
+        double sweep = 360.0;
+        if (curve.Type == VX_CRV_ARC)
+        {
+            sweep = curve.A2 - curve.A1;
+            while (sweep <= 0.0)
+                sweep += 360.0;
+            if (sweep > 360.0)
+                sweep = 360.0;
+        }
+        item.domain.min = curve.A1;
+        item.domain.max = curve.A1 + sweep;
+        const int spans = (int)ceil(sweep / 90.0 - 1.0e-9);
+        for (int i = 0; i < spans; i++)
+            item.breaks.push_back(curve.A1 + sweep * i / spans);
+        item.breaks.push_back(item.domain.max);
+        break;
+    }
+
+    case VX_CRV_NURB:
+    {
+        NurbsCurveEvaluator evaluator;
+        if (evaluator.Init(curve))
+            return -1;
+        item.domain = evaluator.Domain();
+        item.breaks.push_back(item.domain.min);
+        for (int i = 0; i < curve.T.num_knots; i++)
+        {
+            const double knot = curve.T.knots[i];
+            if (knot > item.breaks.back() && knot < item.domain.max)
+                item.breaks.push_back(knot);
+        }
+        item.breaks.push_back(item.domain.max);
+        item.nurbs = (int)m_nurbs.size();
+        m_nurbs.push_back(evaluator);
+        break;
+    }
+
+    default:
+        return -1;
+    }
+
+    m_curves.push_back(item);
+    return (int)m_curves.size() - 1;
+}
+
+/*******************************************************************/
+/* Function definition */
+svxLimit ChainAnalyzer::Domain
+(
+int curve   /* I: index of the curve */
+) const
+/*
+DESCRIPTION:
+   Parameter range of a curve: 0 to 1 for lines, the angles in degrees
+for arcs and circles, the knot range for NURBS curves.
+*/
+{
+    return m_curves[curve].domain;
+}
+
+/*******************************************************************/
+/* Function definition */
+int ChainAnalyzer::Evaluate
+(
+int curve,            /* I: index of the curve */
+double t,             /* I: parameter in the curve direction */
+svxEvalCurv *eval     /* O: point and first three derivatives */
+) const
+/*
+DESCRIPTION:
+   Evaluate a curve with its first three derivatives.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    if (curve < 0 || curve >= Count() || eval == nullptr)
+        return 1;
+
+    const Curve &item = m_curves[curve];
+    if (item.nurbs >= 0)
+        return m_nurbs[item.nurbs].Evaluate(t, NURBS_EVAL_MAX_LEVEL, eval);
+
+    eval->level = NURBS_EVAL_MAX_LEVEL;
+    if (item.type == VX_CRV_LINE)
+    {
+        eval->deriv_1.x = item.end.x - item.start.x;
+        eval->deriv_1.y = item.end.y - item.start.y;
+        eval->deriv_1.z = item.end.z - item.start.z;
+        eval->pnt.x = item.start.x + t * eval->deriv_1.x;
+        eval->pnt.y = item.start.y + t * eval->deriv_1.y;
+        eval->pnt.z = item.start.z + t * eval->deriv_1.z;
+        eval->deriv_2.x = eval->deriv_2.y = eval->deriv_2.z = 0.0;
+        eval->deriv_3 = eval->deriv_2;
+        return 0;
+    }
+
+    /* arc in degrees: every derivative brings a factor pi / 180 */
+    const double k = CHAIN_PI / 180.0;
+    const double c = cos(t * k), s = sin(t * k);
+    const double r1 = item.radius * k, r2 = r1 * k, r3 = r2 * k;
+    eval->pnt.x = item.center.x + item.radius * (c * item.xAxis.x + s * item.yAxis.x);
+    eval->pnt.y = item.center.y + item.radius * (c * item.xAxis.y + s * item.yAxis.y);
+    eval->pnt.z = item.center.z + item.radius * (c * item.xAxis.z + s * item.yAxis.z);
+    eval->deriv_1.x = r1 * (c * item.yAxis.x - s * item.xAxis.x);
+    eval->deriv_1.y = r1 * (c * item.yAxis.y - s * item.xAxis.y);
+    eval->deriv_1.z = r1 * (c * item.yAxis.z - s * item.xAxis.z);
+    eval->deriv_2.x = -r2 * (c * item.xAxis.x + s * item.yAxis.x);
+    eval->deriv_2.y = -r2 * (c * item.xAxis.y + s * item.yAxis.y);
+    eval->deriv_2.z = -r2 * (c * item.xAxis.z + s * item.yAxis.z);
+    eval->deriv_3.x = r3 * (s * item.xAxis.x - c * item.yAxis.x);
+    eval->deriv_3.y = r3 * (s * item.xAxis.y - c * item.yAxis.y);
+    eval->deriv_3.z = r3 * (s * item.xAxis.z - c * item.yAxis.z);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int ChainAnalyzer::SampleCount
+(
+int curve,     /* I: index of the curve */
+int samples    /* I: samples per span */
+) const
+/*
+DESCRIPTION:
+   Number of comb samples of a curve: "samples" per span and the end,
+two for a line.
+*/
+{
+    const Curve &item = m_curves[curve];
+    return ((int)item.breaks.size() - 1) * (item.type == VX_CRV_LINE ? 1 : samples) + 1;
+}
+
+/*******************************************************************/
+/* Function definition */
+void ChainAnalyzer::JointMeasure
+(
+const svxEvalCurv &before,      /* I: end of the curve before the joint, chain direction */
+const svxEvalCurv &after,       /* I: start of the curve after the joint, chain direction */
+const ChainOptions &options,    /* I: settings */
+ChainJoint *joint               /* O: deviations and level, point */
+) const
+/*
+DESCRIPTION:
+   Deviations of the two sides of a joint. The tangent of a side whose
+speed is zero is taken along its second derivative, the limit of the
+tangent at a cusp. The flow deviation is taken over the larger of the
+two flows and the squared curvature, so a curvature that changes by
+less than itself per radian of turn on both sides counts as steady.
+*/
+{
+    double k[2], n[2][3], flow[2], speed[2], tangent[2][3];
+    const svxEvalCurv *side[2] = { &before, &after };
+    for (int i = 0; i < 2; i++)
+    {
+        const svxEvalCurv &e = *side[i];
+        CombPoint(e.deriv_1.x, e.deriv_1.y, e.deriv_1.z, e.deriv_2.x, e.deriv_2.y, e.deriv_2.z,
+            e.deriv_3.x, e.deriv_3.y, e.deriv_3.z, &k[i], &n[i][0], &n[i][1], &n[i][2], &flow[i], &speed[i]);
+        const svxPoint &d = speed[i] > 0.0 ? e.deriv_1 : e.deriv_2;
+        const double length = sqrt(d.x * d.x + d.y * d.y + d.z * d.z);
+        const double scale = length > 0.0 ? 1.0 / length : 0.0;
+        tangent[i][0] = d.x * scale;
+        tangent[i][1] = d.y * scale;
+        tangent[i][2] = d.z * scale;
+    }
+
+    joint->point = before.pnt;
+    joint->position = Distance(before.pnt, after.pnt);
+
+    double cosine = tangent[0][0] * tangent[1][0] + tangent[0][1] * tangent[1][1] + tangent[0][2] * tangent[1][2];
+    cosine = cosine > 1.0 ? 1.0 : (cosine < -1.0 ? -1.0 : cosine);
+    joint->tangent = acos(cosine) * 180.0 / CHAIN_PI;
+
+    const double kMax = k[0] > k[1] ? k[0] : k[1];
+    joint->curvature = 0.0;
+    if (kMax > CHAIN_STRAIGHT)
+    {
+        const double x = k[0] * n[0][0] - k[1] * n[1][0];
+        const double y = k[0] * n[0][1] - k[1] * n[1][1];
+        const double z = k[0] * n[0][2] - k[1] * n[1][2];
+        joint->curvature = sqrt(x * x + y * y + z * z) / kMax;
+    }
+
+    double scale = fabs(flow[0]) > fabs(flow[1]) ? fabs(flow[0]) : fabs(flow[1]);
+    if (scale < kMax * kMax)
+        scale = kMax * kMax;
+    joint->flow = scale > 0.0 && kMax > CHAIN_STRAIGHT ? fabs(flow[0] - flow[1]) / scale : 0.0;
+
+    if (joint->position > options.tolerance.tolerancePosition)
+        joint->level = -1;
+    else if (joint->tangent > options.tolerance.toleranceTangent)
+        joint->level = 0;
+    else if (joint->curvature > options.tolerance.toleranceCurvature)
+        joint->level = 1;
+    else if (joint->flow > options.tolerance.toleranceFlow)
+        joint->level = 2;
+    else
+        joint->level = 3;
+}
+
+/*******************************************************************/
+/* Function definition */
+double ChainAnalyzer::FeatureLocate
+(
+int curve,               /* I: index of the curve */
+ChainFeatureKind kind,   /* I: inflection or cusp */
+double t0,               /* I: parameter before the feature */
+double t1                /* I: parameter after the feature */
+) const
+/*
+DESCRIPTION:
+   Bisect between two samples down to the parameter where the binormal
+flips (inflection) or the tangent turns more than CHAIN_CUSP_ANGLE from
+its direction at t0 (cusp).
+*/
+{
+    const double cusp = cos(CHAIN_CUSP_ANGLE * CHAIN_PI / 180.0);
+    svxEvalCurv e;
+    Evaluate(curve, t0, &e);
+    const svxPoint a0 = e.deriv_1;
+    const double w0x = a0.y * e.deriv_2.z - a0.z * e.deriv_2.y;
+    const double w0y = a0.z * e.deriv_2.x - a0.x * e.deriv_2.z;
+    const double w0z = a0.x * e.deriv_2.y - a0.y * e.deriv_2.x;
+    const double v0 = sqrt(a0.x * a0.x + a0.y * a0.y + a0.z * a0.z);
+
+    for (int i = 0; i < CHAIN_REFINE_STEPS; i++)
+    {
+        const double t = 0.5 * (t0 + t1);
+        Evaluate(curve, t, &e);
+        const svxPoint &a = e.deriv_1, &b = e.deriv_2;
+        int beyond = 0;
+        if (kind == Chain_Inflection)
+        {
+            const double wx = a.y * b.z - a.z * b.y, wy = a.z * b.x - a.x * b.z, wz = a.x * b.y - a.y * b.x;
+            beyond = wx * w0x + wy * w0y + wz * w0z < 0.0;
+        }
+        else
+        {
+            const double v = sqrt(a.x * a.x + a.y * a.y + a.z * a.z);
+            beyond = a.x * a0.x + a.y * a0.y + a.z * a0.z < cusp * v * v0;
+        }
+        if (beyond)
+            t1 = t;
+        else
+            t0 = t;
+    }
+    return 0.5 * (t0 + t1);
+}
+
+/*******************************************************************/
+/* Function definition */
+void ChainAnalyzer::CurveRun
+(
+int curve,           /* I: index of the curve */
+Batch *batch,        /* I/O: running analysis, the samples of the curve are set */
+Scratch &scratch     /* I/O: buffers of the worker */
+) const
+/*
+DESCRIPTION:
+   Sample one curve into its place in the comb columns, in chain
+direction, with the arc length from its own start, and find its knot
+joints, inflections and cusps.
+*/
+{
+    const Curve &item = m_curves[curve];
+    ChainComb &comb = batch->result->comb;
+    const int reversed = batch->result->reversed[curve];
+    const int perSpan = item.type == VX_CRV_LINE ? 1 : batch->options->samples;
+    const int first = comb.offsets[curve];
+    const int count = comb.offsets[curve + 1] - first;
+
+    /* parameters, every break is a sample */
+    double *t = comb.t.data() + first;
+    const int spans = (int)item.breaks.size() - 1;
+    for (int span = 0; span < spans; span++)
+    {
+        const double t0 = item.breaks[span], step = (item.breaks[span + 1] - t0) / perSpan;
+        for (int j = 0; j < perSpan; j++)
+            t[span * perSpan + j] = t0 + j * step;
+    }
+    t[count - 1] = item.breaks.back();
+    if (reversed)
+        std::reverse(t, t + count);
+
+    /* derivatives of all samples, then in columns in chain direction */
+    scratch.evals.resize(count);
+    if (item.nurbs >= 0)
+        m_nurbs[item.nurbs].Evaluate(count, t, NURBS_EVAL_MAX_LEVEL, scratch.evals.data());
+    else
+    {
+        for (int k = 0; k < count; k++)
+            Evaluate(curve, t[k], &scratch.evals[k]);
+    }
+    scratch.columns.resize(CHAIN_COLUMNS * count);
+    double *ax = scratch.columns.data(), *ay = ax + count, *az = ay + count;
+    double *bx = az + count, *by = bx + count, *bz = by + count;
+    double *cx = bz + count, *cy = cx + count, *cz = cy + count;
+    double *v = cz + count;
+    double *x = comb.x.data() + first, *y = comb.y.data() + first, *z = comb.z.data() + first;
+    const double sign = reversed ? -1.0 : 1.0;
+    for (int k = 0; k < count; k++)
+    {
+        const svxEvalCurv &e = scratch.evals[k];
+        x[k] = e.pnt.x; y[k] = e.pnt.y; z[k] = e.pnt.z;
+        ax[k] = sign * e.deriv_1.x; ay[k] = sign * e.deriv_1.y; az[k] = sign * e.deriv_1.z;
+        bx[k] = e.deriv_2.x; by[k] = e.deriv_2.y; bz[k] = e.deriv_2.z;
+        cx[k] = sign * e.deriv_3.x; cy[k] = sign * e.deriv_3.y; cz[k] = sign * e.deriv_3.z;
+    }
+
+    /* comb values, one pass over the columns */
+    double *curvature = comb.curvature.data() + first, *f = comb.flow.data() + first;
+    double *nx = comb.nx.data() + first, *ny = comb.ny.data() + first, *nz = comb.nz.data() + first;
+    for (int k = 0; k < count; k++)
+    {
+        CombPoint(ax[k], ay[k], az[k], bx[k], by[k], bz[k], cx[k], cy[k], cz[k], &curvature[k], &nx[k], &ny[k], &nz[k],
+            &f[k], &v[k]);
+    }
+
+    /* arc length by the trapezoid rule on the speed */
+    double *s = comb.s.data() + first;
+    s[0] = 0.0;
+    for (int k = 1; k < count; k++)
+        s[k] = s[k - 1] + 0.5 * (v[k - 1] + v[k]) * fabs(t[k] - t[k - 1]);
+    batch->lengths[curve] = s[count - 1];
+
+    /* inflections and cusps between neighbour samples, skipping straight or still ones */
+    std::vector<ChainFeature> &found = batch->found[curve];
+    found.clear();
+    const double cusp = cos(CHAIN_CUSP_ANGLE * CHAIN_PI / 180.0);
+    int lastBend = -1, lastMove = -1;
+    for (int k = 0; k < count; k++)
+    {
+        int from = -1;
+        ChainFeatureKind kind = Chain_Cusp;
+        if (v[k] > 0.0)
+        {
+            if (lastMove >= 0 &&
+                ax[k] * ax[lastMove] + ay[k] * ay[lastMove] + az[k] * az[lastMove] < cusp * v[k] * v[lastMove])
+                from = lastMove;
+            lastMove = k;
+        }
+        if (from < 0 && curvature[k] > CHAIN_STRAIGHT)
+        {
+            if (lastBend >= 0)
+            {
+                const int i = lastBend;
+                const double wx = ay[k] * bz[k] - az[k] * by[k], wy = az[k] * bx[k] - ax[k] * bz[k],
+                    wz = ax[k] * by[k] - ay[k] * bx[k];
+                const double ux = ay[i] * bz[i] - az[i] * by[i], uy = az[i] * bx[i] - ax[i] * bz[i],
+                    uz = ax[i] * by[i] - ay[i] * bx[i];
+                if (wx * ux + wy * uy + wz * uz < 0.0)
+                {
+                    from = i;
+                    kind = Chain_Inflection;
+                }
+            }
+        }
+        if (curvature[k] > CHAIN_STRAIGHT)
+            lastBend = k;
+        if (from < 0)
+            continue;
+
+        ChainFeature feature;
+        feature.curve = curve;
+        feature.kind = kind;
+        feature.t = FeatureLocate(curve, kind, t[from], t[k]);
+        feature.s = s[from] + (s[k] - s[from]) * (feature.t - t[from]) / (t[k] - t[from]);
+        svxEvalCurv e;
+        Evaluate(curve, feature.t, &e);
+        feature.point = e.pnt;
+        found.push_back(feature);
+    }
+
+    /* interior knots breaking G2 */
+    std::vector<ChainJoint> &knots = batch->knots[curve];
+    knots.clear();
+    if (item.nurbs < 0)
+        return;
+    const double side = CHAIN_KNOT_SIDE * (item.domain.max - item.domain.min);
+    for (int j = 1; j < spans; j++)
+    {
+        const double knot = item.breaks[j];
+        svxEvalCurv before, after;
+        Evaluate(curve, knot - side, &before);
+        Evaluate(curve, knot + side, &after);
+        if (reversed)
+        {
+            std::swap(before, after);
+            EvalFlip(&before);
+            EvalFlip(&after);
+        }
+        ChainJoint joint;
+        JointMeasure(before, after, *batch->options, &joint);
+        if (joint.level >= 2)
+            continue;
+        joint.curve = curve;
+        joint.kind = Chain_Knot;
+        joint.t = knot;
+        joint.s = s[reversed ? count - 1 - j * perSpan : j * perSpan];
+        knots.push_back(joint);
+    }
+    if (reversed)
+        std::reverse(knots.begin(), knots.end());
+}
+
+/*******************************************************************/
+/* Function definition */
+void ChainAnalyzer::TaskRun
+(
+void *data,    /* I: running analysis */
+int begin,     /* I: first curve */
+int end,       /* I: end of the range */
+int worker     /* I: worker running the range */
+)
+/*
+DESCRIPTION:
+   Sample a range of curves with the buffers of the worker.
+*/
+{
+    Batch *batch = (Batch *)data;
+    for (int i = begin; i < end; i++)
+        batch->self->CurveRun(i, batch, batch->scratch[worker]);
+}
+
+/*******************************************************************/
+/* Function definition */
+int ChainAnalyzer::Analyze
+(
+const ChainOptions &options,   /* I: settings */
+WorkPool *pool,                /* I: pool running the curves, nullptr for this thread only */
+ChainResult *result            /* O: comb, joints and features */
+) const
+/*
+DESCRIPTION:
+   Analyze the chain. The first curve runs toward the end it shares with
+the second one, and every other curve starts at its end nearest to the
+end of the one before. The chain is closed when its end is within the
+position tolerance of its start; then the last joint is between the last
+and the first curve.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    const int count = Count();
+    if (count == 0 || result == nullptr || options.samples < 1 || options.samples > CHAIN_MAX_SAMPLES)
+        return 1;
+
+    /* turn the curves along the chain */
+    std::vector<svxPoint> starts(count), ends(count);
+    for (int i = 0; i < count; i++)
+    {
+        svxEvalCurv e;
+        Evaluate(i, m_curves[i].domain.min, &e);
+        starts[i] = e.pnt;
+        Evaluate(i, m_curves[i].domain.max, &e);
+        ends[i] = e.pnt;
+    }
+    result->reversed.assign(count, 0);
+    if (count > 1)
+    {
+        const double toNext = std::min(Distance(ends[0], starts[1]), Distance(ends[0], ends[1]));
+        const double fromNext = std::min(Distance(starts[0], starts[1]), Distance(starts[0], ends[1]));
+        result->reversed[0] = fromNext < toNext ? 1 : 0;
+    }
+    for (int i = 1; i < count; i++)
+    {
+        const svxPoint &last = result->reversed[i - 1] ? starts[i - 1] : ends[i - 1];
+        result->reversed[i] = Distance(ends[i], last) < Distance(starts[i], last) ? 1 : 0;
+    }
+    const svxPoint &chainStart = result->reversed[0] ? ends[0] : starts[0];
+    const svxPoint &chainEnd = result->reversed[count - 1] ? starts[count - 1] : ends[count - 1];
+    result->closed = Distance(chainStart, chainEnd) <= options.tolerance.tolerancePosition ? 1 : 0;
+
+    /* place of every curve in the columns */
+    ChainComb &comb = result->comb;
+    comb.offsets.resize(count + 1);
+    comb.offsets[0] = 0;
+    for (int i = 0; i < count; i++)
+        comb.offsets[i + 1] = comb.offsets[i] + SampleCount(i, options.samples);
+    const int samples = comb.offsets[count];
+    std::vector<double> *columns[] = { &comb.t, &comb.s, &comb.x, &comb.y, &comb.z, &comb.nx, &comb.ny, &comb.nz,
+        &comb.curvature, &comb.flow };
+    for (std::vector<double> *column : columns)
+        column->resize(samples);
+
+    Batch batch;
+    batch.self = this;
+    batch.options = &options;
+    batch.result = result;
+    batch.lengths.assign(count, 0.0);
+    batch.knots.resize(count);
+    batch.found.resize(count);
+    batch.scratch.resize(pool != nullptr ? pool->ThreadCount() : 1);
+    if (pool != nullptr)
+        pool->Run(count, CHAIN_GRAIN, TaskRun, &batch);
+    else
+        TaskRun(&batch, 0, count, 0);
+
+    /* arc length from the chain start, joints and features in chain order */
+    result->joints.clear();
+    result->features.clear();
+    result->level = 3;
+    double length = 0.0;
+    for (int i = 0; i < count; i++)
+    {
+        for (int k = comb.offsets[i]; k < comb.offsets[i + 1]; k++)
+            comb.s[k] += length;
+        for (ChainJoint &joint : batch.knots[i])
+        {
+            joint.s += length;
+            result->joints.push_back(joint);
+        }
+        for (ChainFeature &feature : batch.found[i])
+        {
+            feature.s += length;
+            result->features.push_back(feature);
+        }
+        length += batch.lengths[i];
+
+        if (i + 1 == count && !result->closed)
+            break;
+        const int next = (i + 1) % count;
+        const svxLimit &domain = m_curves[i].domain, &nextDomain = m_curves[next].domain;
+        svxEvalCurv before, after;
+        ChainJoint joint;
+        joint.curve = i;
+        joint.kind = Chain_Curves;
+        joint.t = result->reversed[i] ? domain.min : domain.max;
+        joint.s = length;
+        Evaluate(i, joint.t, &before);
+        Evaluate(next, result->reversed[next] ? nextDomain.max : nextDomain.min, &after);
+        if (result->reversed[i])
+            EvalFlip(&before);
+        if (result->reversed[next])
+            EvalFlip(&after);
+        JointMeasure(before, after, options, &joint);
+        result->joints.push_back(joint);
+        if (joint.level < result->level)
+            result->level = joint.level;
+    }
+    result->length = length;
+    return 0;
+}
@@ -0,0 +1,406 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* ZW3D API includes */
+#include "zwapi_curve.h"
+#include "zwapi_entity.h"
+#include "zwapi_part_objs.h"
+#include "zwapi_userinput.h"
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+#include "..\inc\ChainContinuityPr.h"
+#include "..\inc\ChainAnalyzer.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define MESSAGE_SIZE 256
+#define DEFAULT_SAMPLES 32           /* default comb samples per knot span */
+#define REPORT_LINES 20              /* joints and features listed at most */
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: picked chain */
+struct ChainRun
+{
+    int count;                       /* curves in the chain */
+    szwEntityHandle *curves;         /* handles in chain order */
+    std::vector<int> ids;            /* entity id per curve */
+    std::vector<char> nurbs;         /* 1 if the curve data is a NURBS curve */
+    double loadTime;
+};
+
+/*******************************************************************/
+/* Function declarations */
+static int ChainContinuity(void);
+static int ChainLoad(ChainAnalyzer *analyzer, ChainRun *run);
+static int ResultsSame(const ChainResult &a, const ChainResult &b);
+static void ChainReport(const ChainResult &result);
+static void HostContinuity(const ChainRun &run, const ChainOptions &options, const ChainResult &result);
+static void HostCurvature(const ChainRun &run, const ChainAnalyzer &analyzer, const ChainResult &result);
+static double Seconds(std::chrono::steady_clock::time_point start);
+
+/*******************************************************************/
+/* Function definition */
+int RegisterChainContinuity
+(
+void
+)
+/*
+DESCRIPTION:
+   Register the commands of the chain continuity example.
+*/
+{
+    /* Analyze the curvature and continuity of a curve chain by entering "~ChainContinuity" */
+    ZwCommandFunctionLoad("ChainContinuity", (void *)ChainContinuity, ZW_LICENSE_CODE_GENERAL);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int UnloadChainContinuity
+(
+void
+)
+/*
+DESCRIPTION:
+   Unload the commands of the chain continuity example.
+*/
+{
+    ZwCommandFunctionUnload("ChainContinuity");
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+double Seconds
+(
+std::chrono::steady_clock::time_point start   /* I: start time */
+)
+/*
+DESCRIPTION:
+   Seconds elapsed since "start".
+*/
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*******************************************************************/
+/* Function definition */
+int ChainLoad
+(
+ChainAnalyzer *analyzer,   /* O: analyzer holding the chain */
+ChainRun *run              /* O: handles and ids of the chain */
+)
+/*
+DESCRIPTION:
+   Pick seed curves, find their chain with ZwCurveChainGet() and add the
+curve data of every curve of the chain, in chain order. The handles are
+kept in "run" and freed by the caller with ZwEntityHandleListFree().
+
+   Return 1 if function fails, else 0.
+*/
+{
+    int seedCount = 0;
+    szwEntityHandle *seeds = nullptr;
+    run->count = 0;
+    run->curves = nullptr;
+    if (ZwEntityListGetByPick("Select the seed curve of the chain", ZW_INPUT_EDGE_OR_CURVE, 0, &seedCount, &seeds))
+        return 1;
+
+    auto start = std::chrono::steady_clock::now();
+    const int chainFailed = ZwCurveChainGet(seedCount, seeds, ZW_CURVE_TANGENT_EDGE, &run->count, &run->curves) ||
+        run->count < 1 ? 1 : 0;
+    ZwEntityHandleListFree(seedCount, &seeds);
+    if (chainFailed)
+    {
+        cvxMsgDisp("No chain found");
+        return 1;
+    }
+
+    run->ids.assign(run->count, 0);
+    run->nurbs.assign(run->count, 0);
+    if (ZwEntityIdGet(run->count, run->curves, run->ids.data()))
+        return 1;
+    for (int i = 0; i < run->count; i++)
+    {
+        svxCurve curve{};
+        if (cvxPartInqCurve(run->ids[i], 0, &curve))
+            return 1;
+        run->nurbs[i] = curve.Type == VX_CRV_NURB ? 1 : 0;
+        const int added = analyzer->Add(curve);
+        cvxCurveFree(&curve);
+        if (added < 0)
+        {
+            char message[MESSAGE_SIZE];
+            sprintf_s(message, MESSAGE_SIZE, "Curve %d of the chain is not supported", i + 1);
+            cvxMsgDisp(message);
+            return 1;
+        }
+    }
+    run->loadTime = Seconds(start);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int ResultsSame
+(
+const ChainResult &a,   /* I: result */
+const ChainResult &b    /* I: result */
+)
+/*
+DESCRIPTION:
+   Check that two analyses of the same chain give the same comb, joints
+and features.
+
+   Return 1 if they are the same, else 0.
+*/
+{
+    if (a.comb.offsets != b.comb.offsets || a.comb.t != b.comb.t || a.comb.s != b.comb.s ||
+        a.comb.curvature != b.comb.curvature || a.comb.flow != b.comb.flow ||
+        a.joints.size() != b.joints.size() || a.features.size() != b.features.size())
+        return 0;
+    for (size_t i = 0; i < a.joints.size(); i++)
+    {
+        if (a.joints[i].curve != b.joints[i].curve || a.joints[i].t != b.joints[i].t ||
+            a.joints[i].level != b.joints[i].level)
+            return 0;
+    }
+    for (size_t i = 0; i < a.features.size(); i++)
+    {
+        if (a.features[i].kind != b.features[i].kind || a.features[i].t != b.features[i].t)
+            return 0;
+    }
+    return 1;
+}
+
+/*******************************************************************/
+/* Function definition */
+void ChainReport
+(
+const ChainResult &result   /* I: analysis */
+)
+/*
+DESCRIPTION:
+   Show the summary of an analysis, the joints below G3 and the
+features, REPORT_LINES of each at most. Curves are counted from 1.
+*/
+{
+    static const char *levels[] = { "gap", "G0", "G1", "G2", "G3" };
+    char message[MESSAGE_SIZE];
+    int maxCurvature = 0;
+    for (int k = 1; k < result.comb.Count(); k++)
+        maxCurvature = result.comb.curvature[k] > result.comb.curvature[maxCurvature] ? k : maxCurvature;
+    sprintf_s(message, MESSAGE_SIZE, "%d curves, %s, length %g, %d comb samples, largest curvature %g at s=%g",
+        (int)result.reversed.size(), result.closed ? "closed" : "open", result.length, result.comb.Count(),
+        result.comb.Count() > 0 ? result.comb.curvature[maxCurvature] : 0.0,
+        result.comb.Count() > 0 ? result.comb.s[maxCurvature] : 0.0);
+    cvxMsgDisp(message);
+    sprintf_s(message, MESSAGE_SIZE, "Chain continuity between curves: %s", levels[result.level + 1]);
+    cvxMsgDisp(message);
+
+    int listed = 0;
+    for (const ChainJoint &joint : result.joints)
+    {
+        if (joint.level == 3 || listed++ >= REPORT_LINES)
+            continue;
+        if (joint.kind == Chain_Curves)
+            sprintf_s(message, MESSAGE_SIZE, "  %s after curve %d at s=%g: gap %g, angle %g, curvature %g, flow %g",
+                levels[joint.level + 1], joint.curve + 1, joint.s, joint.position, joint.tangent, joint.curvature,
+                joint.flow);
+        else
+            sprintf_s(message, MESSAGE_SIZE, "  %s at knot t=%g of curve %d, s=%g: angle %g, curvature %g",
+                levels[joint.level + 1], joint.t, joint.curve + 1, joint.s, joint.tangent, joint.curvature);
+        cvxMsgDisp(message);
+    }
+
+    int inflections = 0, cusps = 0;
+    for (const ChainFeature &feature : result.features)
+    {
+        inflections += feature.kind == Chain_Inflection ? 1 : 0;
+        cusps += feature.kind == Chain_Cusp ? 1 : 0;
+    }
+    sprintf_s(message, MESSAGE_SIZE, "%d inflections, %d cusps", inflections, cusps);
+    cvxMsgDisp(message);
+    for (int i = 0; i < (int)result.features.size() && i < REPORT_LINES; i++)
+    {
+        const ChainFeature &feature = result.features[i];
+        sprintf_s(message, MESSAGE_SIZE, "  %s on curve %d at t=%g, s=%g (%g, %g, %g)",
+            feature.kind == Chain_Inflection ? "Inflection" : "Cusp", feature.curve + 1, feature.t, feature.s,
+            feature.point.x, feature.point.y, feature.point.z);
+        cvxMsgDisp(message);
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+void HostContinuity
+(
+const ChainRun &run,            /* I: picked chain */
+const ChainOptions &options,    /* I: settings */
+const ChainResult &result       /* I: local analysis */
+)
+/*
+DESCRIPTION:
+   Check the joints between curves with ZwCurveContinuityGet() and
+report how many pairs of the host get the same level as the joint
+between the same curves.
+*/
+{
+    int count = 0;
+    szwCurveContinuityData *data = nullptr;
+    auto start = std::chrono::steady_clock::now();
+    if (ZwCurveContinuityGet(run.count, run.curves, options.tolerance, &count, &data))
+    {
+        cvxMsgDisp("ZwCurveContinuityGet() failed");
+        return;
+    }
+    const double hostTime = Seconds(start);
+
+    int matched = 0, agreed = 0;
+    for (int i = 0; i < count; i++)
+    {
+        int id1 = 0, id2 = 0;
+        if (ZwEntityIdGet(1, &data[i].curve1, &id1) || ZwEntityIdGet(1, &data[i].curve2, &id2))
+            continue;
+        const int hostLevel = !data[i].isPositionContinuous ? -1 : (!data[i].isTangentContinuous ? 0 :
+            (!data[i].isCurvatureContinuous ? 1 : (!data[i].isFlowContinuous ? 2 : 3)));
+        for (const ChainJoint &joint : result.joints)
+        {
+            if (joint.kind != Chain_Curves)
+                continue;
+            const int a = run.ids[joint.curve], b = run.ids[(joint.curve + 1) % run.count];
+            if ((a == id1 && b == id2) || (a == id2 && b == id1))
+            {
+                matched++;
+                agreed += joint.level == hostLevel ? 1 : 0;
+                break;
+            }
+        }
+    }
+    for (int i = 0; i < count; i++)
+    {
+        ZwEntityHandleFree(&data[i].curve1);
+        ZwEntityHandleFree(&data[i].curve2);
+    }
+    ZwMemoryFree((void **)&data);
+
+    char message[MESSAGE_SIZE];
+    sprintf_s(message, MESSAGE_SIZE, "Host continuity: %.4f s, %d pairs, %d on chain joints, %d at the same level",
+        hostTime, count, matched, agreed);
+    cvxMsgDisp(message);
+}
+
+/*******************************************************************/
+/* Function definition */
+void HostCurvature
+(
+const ChainRun &run,                /* I: picked chain */
+const ChainAnalyzer &analyzer,      /* I: chain */
+const ChainResult &result           /* I: local analysis */
+)
+/*
+DESCRIPTION:
+   Evaluate the curvature at every comb sample of the NURBS curves with
+one ZwCurveCurvatureGet() call each and report the largest difference to
+the comb. Curves whose host parameter range is not the knot range are
+skipped.
+*/
+{
+    int calls = 0, skipped = 0;
+    double largest = 0.0, difference = 0.0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < run.count; i++)
+    {
+        szwLimit range{};
+        const svxLimit domain = analyzer.Domain(i);
+        if (!run.nurbs[i] || ZwCurveTParameterRangeGet(run.curves[i], &range) ||
+            fabs(range.min - domain.min) > 1.0e-9 || fabs(range.max - domain.max) > 1.0e-9)
+        {
+            skipped++;
+            continue;
+        }
+        for (int k = result.comb.offsets[i]; k < result.comb.offsets[i + 1]; k++)
+        {
+            szwPoint point, normal;
+            double curvature = 0.0;
+            calls++;
+            if (ZwCurveCurvatureGet(run.curves[i], result.comb.t[k], &point, &normal, &curvature))
+                continue;
+            const double d = fabs(curvature - result.comb.curvature[k]);
+            difference = d > difference ? d : difference;
+            largest = curvature > largest ? curvature : largest;
+        }
+    }
+    const double hostTime = Seconds(start);
+
+    char message[MESSAGE_SIZE];
+    sprintf_s(message, MESSAGE_SIZE, "Host curvature: %.4f s, %d calls (%d curves skipped), largest difference %g"
+        " for a largest curvature of %g", hostTime, calls, skipped, difference, largest);
+    cvxMsgDisp(message);
+}
+
+/*******************************************************************/
+/* Function definition */
+int ChainContinuity
+(
+void
+)
+/*
+DESCRIPTION:
+   Analyze the chain of the picked seed curves on one thread and on the
+pool, report its joints and features, and check them with the host: the
+levels of the joints with ZwCurveContinuityGet(), and the curvature of
+the comb samples with ZwCurveCurvatureGet().
+
+   Return 1 if function fails, else 0.
+*/
+{
+    ChainAnalyzer analyzer;
+    ChainRun run;
+    if (ChainLoad(&analyzer, &run))
+    {
+        ZwEntityHandleListFree(run.count, &run.curves);
+        return 1;
+    }
+
+    ChainOptions options;
+    ZwCurveContinuityToleranceListInit(&options.tolerance);
+    double number = DEFAULT_SAMPLES;
+    if (cvxGetNumber("Comb samples per knot span", &number) || number < 1.0 || number > CHAIN_MAX_SAMPLES)
+        number = DEFAULT_SAMPLES;
+    options.samples = (int)number;
+
+    ChainResult serial, pooled;
+    auto start = std::chrono::steady_clock::now();
+    const int failed = analyzer.Analyze(options, nullptr, &serial);
+    const double serialTime = Seconds(start);
+    WorkPool pool;
+    start = std::chrono::steady_clock::now();
+    analyzer.Analyze(options, &pool, &pooled);
+    const double poolTime = Seconds(start);
+    if (failed)
+    {
+        ZwEntityHandleListFree(run.count, &run.curves);
+        cvxMsgDisp("Analysis failed");
+        return 1;
+    }
+
+    ChainReport(serial);
+    char message[MESSAGE_SIZE];
+    sprintf_s(message, MESSAGE_SIZE, "Local: read %.4f s, 1 thread %.4f s, %d threads %.4f s, same result: %s",
+        run.loadTime, serialTime, pool.ThreadCount(), poolTime, ResultsSame(serial, pooled) ? "yes" : "no");
+    cvxMsgDisp(message);
+
+    HostContinuity(run, options, serial);
+    HostCurvature(run, analyzer, serial);
+    ZwEntityHandleListFree(run.count, &run.curves);
+    return 0;
+}
@@ -0,0 +1,128 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+#pragma once
+
+/* ZW3D API includes */
+#include "zwapi_util.h"
+#include "zwapi_brep_data.h"
+
+/* Application includes */
+#include <vector>
+#include "PointProjector.h"
+#include "TriangleBvh.h"
+#include "WorkPool.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define DEVIATION_GRAIN 256                   /* samples taken at a time by a pool worker */
+#define DEVIATION_NO_FACE TRIANGLE_BVH_NO_HIT /* sample without a reference face within the limit */
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: settings of a measure */
+struct DeviationOptions
+{
+    double limit;             /* samples farther from the reference get no deviation (mm), 0 for no limit */
+    int refine;               /* 1 to refine the facet foot points on the true surfaces */
+    double refineGap;         /* largest move from the facet foot point to the refined one (mm) */
+    ProjectOptions project;   /* Newton settings of the refinement */
+};
+
+/*
+DESCRIPTION:
+   Deviation of every sample, in columns. The distance is signed: positive
+on the side the normals of the reference faces point to.
+*/
+struct DeviationField
+{
+    std::vector<double> distance;     /* signed distance to the reference, 0 if no face */
+    std::vector<svxPoint> foot;       /* closest point of the reference */
+    std::vector<int> face;            /* face tag of the foot point, DEVIATION_NO_FACE if none */
+    std::vector<char> refined;        /* 1 if the foot point is on the true surface */
+
+    int Count(void) const { return (int)distance.size(); }
+};
+
+/* DESCRIPTION: statistics of a field */
+struct DeviationStats
+{
+    int count;                 /* samples with a deviation */
+    int missed;                /* samples without a reference face */
+    int refined;               /* samples refined on the true surface */
+    double min, max;           /* signed extremes */
+    double mean, rms;
+    int minSample, maxSample;  /* samples of the extremes, -1 if none */
+};
+
+/*
+DESCRIPTION:
+   Samples of the measured faces as one triangle mesh: the vertices of
+their facets, with the strips turned into triangles, so a field measured
+at the vertices can be written as a colored mesh.
+*/
+struct DeviationMesh
+{
+    std::vector<svxPoint> vertices;
+    std::vector<int> triangles;      /* three vertex indices per triangle */
+
+    int AddFacets(const szwFacets &facets);
+    int VertexCount(void) const { return (int)vertices.size(); }
+};
+
+/*
+DESCRIPTION:
+   Deviation of points from a set of reference faces, replacing one
+cvxPntEntDist() / ZwEntityPointMinDistanceGet() call per point and face.
+
+   The facets of the reference faces go into a TriangleBvh, each
+triangle tagged with its face. Every sample finds its closest facet
+point through the tree; with refinement, the foot points are then
+projected on the true (untrimmed) surface of their face by the batch
+projector, and the projection is kept if it moved less than
+options.refineGap from the facet foot point, so a projection that left
+the trimmed face keeps the facet result. The sign comes from the facet
+normal (winding of the strips), which the surface normal is turned to.
+
+   Measure() runs both passes on a WorkPool. The map is immutable after
+Build() and may be shared by threads.
+*/
+class DeviationMap
+{
+public:
+    DeviationMap();
+
+    int AddFacets(const szwFacets &facets, int face);
+    int AddSurface(const svxSurface &surface, int face);
+    int Build(void);
+    void Clear(void);
+
+    int Measure(int count, const svxPoint *points, const DeviationOptions &options, WorkPool *pool,
+        DeviationField *field) const;
+    static DeviationStats Statistics(const DeviationField &field);
+
+    const TriangleBvh &Bvh(void) const { return m_bvh; }
+    int SurfaceCount(void) const { return m_projector.Count(); }
+
+private:
+    /* data of a running Measure() */
+    struct Batch
+    {
+        const DeviationMap *self;
+        const svxPoint *points;
+        const DeviationOptions *options;
+        DeviationField *field;
+        std::vector<int> triangles;    /* closest facet per sample */
+    };
+
+    static void TaskRun(void *data, int begin, int end, int worker);
+    svxVector FacetNormal(int triangle) const;
+
+    TriangleBvh m_bvh;
+    PointProjector m_projector;
+    std::vector<int> m_targets;        /* projector target per face tag, -1 if none */
+};
+
+/* Function declaration */
+int DeviationPlyWrite(const char *path, const DeviationMesh &mesh, const DeviationField &field, double range);
@@ -0,0 +1,451 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <math.h>
+#include <string.h>
+#include "..\inc\DeviationMap.h"
+
+/*******************************************************************/
+/* Function declarations */
+static double Distance(const svxPoint &a, const svxPoint &b);
+static void RampColor(double value, double range, unsigned char rgb[3]);
+
+/*******************************************************************/
+/* Function definition */
+double Distance
+(
+const svxPoint &a,   /* I: point */
+const svxPoint &b    /* I: point */
+)
+/*
+DESCRIPTION:
+   Distance between two points.
+*/
+{
+    const double x = a.x - b.x, y = a.y - b.y, z = a.z - b.z;
+    return sqrt(x * x + y * y + z * z);
+}
+
+/*******************************************************************/
+/* Function definition */
+void RampColor
+(
+double value,          /* I: deviation */
+double range,          /* I: deviation of the ends of the ramp */
+unsigned char rgb[3]   /* O: color */
+)
+/*
+DESCRIPTION:
+   Color of a deviation on a blue - green - red ramp from -range to
++range.
+*/
+{
+    double f = range > 0.0 ? value / range : 0.0;
+    f = f < -1.0 ? -1.0 : (f > 1.0 ? 1.0 : f);
+    const double red = f > 0.0 ? f : 0.0, blue = f < 0.0 ? -f : 0.0, green = 1.0 - fabs(f);
+    rgb[0] = (unsigned char)(255.0 * red + 0.5);
+    rgb[1] = (unsigned char)(255.0 * green + 0.5);
+    rgb[2] = (unsigned char)(255.0 * blue + 0.5);
+}
+
+/*******************************************************************/
+/* Function definition */
+int DeviationMesh::AddFacets
+(
+const szwFacets &facets   /* I: facets of one face */
+)
+/*
+DESCRIPTION:
+   Append the vertices of the facets of one face and their triangles,
+turning the strips the way TriangleBvh::AddFacets() does.
+
+   Return 1 if the strip list is invalid, else 0.
+*/
+{
+    if (facets.numberTriangleStrip < 0 || (facets.numberTriangleStrip > 0 && facets.triangleStrip == nullptr) ||
+        (facets.numberVertex > 0 && facets.vertex == nullptr))
+        return 1;
+    const int *s = facets.triangleStrip;
+    for (int k = 0; k < facets.numberTriangleStrip; k++)
+    {
+        const int n = *s++;
+        for (int j = 0; j < n; j++)
+        {
+            if (s[j] < 0 || s[j] >= facets.numberVertex)
+                return 1;
+        }
+        s += n;
+    }
+
+    const int base = VertexCount();
+    for (int i = 0; i < facets.numberVertex; i++)
+    {
+        svxPoint point;
+        point.x = facets.vertex[i].x;
+        point.y = facets.vertex[i].y;
+        point.z = facets.vertex[i].z;
+        vertices.push_back(point);
+    }
+    s = facets.triangleStrip;
+    for (int k = 0; k < facets.numberTriangleStrip; k++)
+    {
+        const int n = *s++;
+        for (int j = 0; j + 2 < n; j++)
+        {
+            const int a = s[(j & 1) ? j + 1 : j], b = s[(j & 1) ? j : j + 1], c = s[j + 2];
+            if (a == b || b == c || c == a)
+                continue;
+            triangles.push_back(base + a);
+            triangles.push_back(base + b);
+            triangles.push_back(base + c);
+        }
+        s += n;
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+DeviationMap::DeviationMap
+(
+void
+)
+/*
+DESCRIPTION:
+   Empty reference.
+*/
+{
+}
+
+/*******************************************************************/
+/* Function definition */
+void DeviationMap::Clear
+(
+void
+)
+/*
+DESCRIPTION:
+   Remove all reference faces.
+*/
+{
+    m_bvh.Clear();
+    m_projector.Clear();
+    m_targets.clear();
+}
+
+/*******************************************************************/
+/* Function definition */
+int DeviationMap::AddFacets
+(
+const szwFacets &facets,   /* I: facets of one reference face */
+int face                   /* I: face tag, 0 or more */
+)
+/*
+DESCRIPTION:
+   Add the facets of a reference face before Build().
+
+   Return 1 if function fails, else 0.
+*/
+{
+    if (face < 0)
+        return 1;
+    return m_bvh.AddFacets(facets, face);
+}
+
+/*******************************************************************/
+/* Function definition */
+int DeviationMap::AddSurface
+(
+const svxSurface &surface,   /* I: surface data of cvxPartInqFaceSrf() */
+int face                     /* I: face tag of the facets of the same face */
+)
+/*
+DESCRIPTION:
+   Add the true surface of a reference face for the refinement. Faces
+without a surface keep their facet foot points.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    if (face < 0)
+        return 1;
+    const int target = m_projector.AddSurface(surface);
+    if (target < 0)
+        return 1;
+    if ((int)m_targets.size() <= face)
+        m_targets.resize(face + 1, -1);
+    m_targets[face] = target;
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int DeviationMap::Build
+(
+void
+)
+/*
+DESCRIPTION:
+   Build the tree of the reference facets.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    return m_bvh.Build();
+}
+
+/*******************************************************************/
+/* Function definition */
+svxVector DeviationMap::FacetNormal
+(
+int triangle   /* I: triangle index in the tree */
+) const
+/*
+DESCRIPTION:
+   Normal of a facet by the winding of its strip, not unit.
+*/
+{
+    float a[3], b[3], c[3];
+    m_bvh.Triangle(triangle, a, b, c);
+    const double u[3] = { (double)b[0] - a[0], (double)b[1] - a[1], (double)b[2] - a[2] };
+    const double v[3] = { (double)c[0] - a[0], (double)c[1] - a[1], (double)c[2] - a[2] };
+    svxVector normal;
+    normal.x = u[1] * v[2] - u[2] * v[1];
+    normal.y = u[2] * v[0] - u[0] * v[2];
+    normal.z = u[0] * v[1] - u[1] * v[0];
+    return normal;
+}
+
+/*******************************************************************/
+/* Function definition */
+void DeviationMap::TaskRun
+(
+void *data,    /* I: running measure */
+int begin,     /* I: first sample */
+int end,       /* I: end of the range */
+int /* worker */ /* I: unused */
+)
+/*
+DESCRIPTION:
+   Find the closest facet point of a range of samples.
+*/
+{
+    Batch *batch = (Batch *)data;
+    const DeviationMap *self = batch->self;
+    DeviationField *field = batch->field;
+    for (int i = begin; i < end; i++)
+    {
+        const svxPoint &point = batch->points[i];
+        TriangleBvhNearest nearest;
+        self->m_bvh.Closest(point, batch->options->limit, &nearest);
+        batch->triangles[i] = nearest.triangle;
+        field->face[i] = nearest.face;
+        field->refined[i] = 0;
+        if (nearest.face == TRIANGLE_BVH_NO_HIT)
+        {
+            field->distance[i] = 0.0;
+            field->foot[i] = point;
+            continue;
+        }
+        const svxVector normal = self->FacetNormal(nearest.triangle);
+        const double side = (point.x - nearest.point.x) * normal.x + (point.y - nearest.point.y) * normal.y +
+            (point.z - nearest.point.z) * normal.z;
+        field->foot[i] = nearest.point;
+        field->distance[i] = side < 0.0 ? -nearest.distance : nearest.distance;
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+int DeviationMap::Measure
+(
+int count,                          /* I: number of samples */
+const svxPoint *points,             /* I: samples */
+const DeviationOptions &options,    /* I: settings */
+WorkPool *pool,                     /* I: pool running the samples, nullptr for this thread only */
+DeviationField *field               /* O: deviation per sample */
+) const
+/*
+DESCRIPTION:
+   Measure the deviation of every sample: its closest facet point, then
+with options.refine the projection of the samples on the true surface
+of their face, all in one batch.
+
+   Return the number of samples without a reference face within the
+limit, or -1 if the map is not built or the input is invalid.
+*/
+{
+    if (!m_bvh.IsBuilt() || count < 0 || (count > 0 && points == nullptr) || field == nullptr)
+        return -1;
+
+    field->distance.resize(count);
+    field->foot.resize(count);
+    field->face.resize(count);
+    field->refined.resize(count);
+
+    Batch batch;
+    batch.self = this;
+    batch.points = points;
+    batch.options = &options;
+    batch.field = field;
+    batch.triangles.resize(count);
+    if (pool != nullptr)
+        pool->Run(count, DEVIATION_GRAIN, TaskRun, &batch);
+    else
+        TaskRun(&batch, 0, count, 0);
+
+    int missed = 0;
+    for (int i = 0; i < count; i++)
+        missed += field->face[i] == DEVIATION_NO_FACE ? 1 : 0;
+    if (!options.refine || m_projector.Count() == 0)
+        return missed;
+
+    /* samples on faces with a surface, projected in one batch */
+    std::vector<int> samples, targets;
+    std::vector<svxPoint> queries;
+    for (int i = 0; i < count; i++)
+    {
+        const int face = field->face[i];
+        if (face == DEVIATION_NO_FACE || face >= (int)m_targets.size() || m_targets[face] < 0)
+            continue;
+        samples.push_back(i);
+        targets.push_back(m_targets[face]);
+        queries.push_back(points[i]);
+    }
+    std::vector<ProjectResult> results(samples.size());
+    if (m_projector.Project((int)samples.size(), queries.data(), targets.data(), options.project, pool,
+        results.data()) < 0)
+        return missed;
+
+    for (size_t k = 0; k < samples.size(); k++)
+    {
+        const int i = samples[k];
+        const ProjectResult &result = results[k];
+        if (result.status == Project_Failed || Distance(result.point, field->foot[i]) > options.refineGap)
+            continue;
+
+        /* surface normal turned to the facet side */
+        const svxVector facet = FacetNormal(batch.triangles[i]);
+        double nx = result.normal.x, ny = result.normal.y, nz = result.normal.z;
+        if (nx * facet.x + ny * facet.y + nz * facet.z < 0.0)
+        {
+            nx = -nx;
+            ny = -ny;
+            nz = -nz;
+        }
+        const svxPoint &point = points[i];
+        const double side = (point.x - result.point.x) * nx + (point.y - result.point.y) * ny +
+            (point.z - result.point.z) * nz;
+        field->foot[i] = result.point;
+        field->distance[i] = side < 0.0 ? -result.distance : result.distance;
+        field->refined[i] = 1;
+    }
+    return missed;
+}
+
+/*******************************************************************/
+/* Function definition */
+DeviationStats DeviationMap::Statistics
+(
+const DeviationField &field   /* I: deviations */
+)
+/*
+DESCRIPTION:
+   Extremes, mean and root mean square of the samples that have a
+reference face.
+*/
+{
+    DeviationStats stats;
+    memset(&stats, 0, sizeof(stats));
+    stats.minSample = stats.maxSample = -1;
+    double sum = 0.0, squares = 0.0;
+    for (int i = 0; i < field.Count(); i++)
+    {
+        if (field.face[i] == DEVIATION_NO_FACE)
+        {
+            stats.missed++;
+            continue;
+        }
+        const double d = field.distance[i];
+        if (stats.minSample < 0 || d < stats.min)
+        {
+            stats.min = d;
+            stats.minSample = i;
+        }
+        if (stats.maxSample < 0 || d > stats.max)
+        {
+            stats.max = d;
+            stats.maxSample = i;
+        }
+        sum += d;
+        squares += d * d;
+        stats.count++;
+        stats.refined += field.refined[i] ? 1 : 0;
+    }
+    if (stats.count > 0)
+    {
+        stats.mean = sum / stats.count;
+        stats.rms = sqrt(squares / stats.count);
+    }
+    return stats;
+}
+
+/*******************************************************************/
+/* Function definition */
+int DeviationPlyWrite
+(
+const char *path,              /* I: output file */
+const DeviationMesh &mesh,     /* I: measured mesh */
+const DeviationField &field,   /* I: deviation per vertex of the mesh */
+double range                   /* I: deviation at the ends of the color ramp */
+)
+/*
+DESCRIPTION:
+   Write the mesh with its deviations as a binary PLY file: per vertex
+the position, the deviation as a "deviation" scalar and a color of the
+blue - green - red ramp (gray where no reference face was found), then
+the triangles. Viewers color by the scalar or show the colors.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    if (path == nullptr || field.Count() != mesh.VertexCount())
+        return 1;
+    FILE *file = nullptr;
+    if (fopen_s(&file, path, "wb") || file == nullptr)
+        return 1;
+
+    const int triangles = (int)mesh.triangles.size() / 3;
+    fprintf(file, "ply\nformat binary_little_endian 1.0\ncomment deviation map\n");
+    fprintf(file, "element vertex %d\n", mesh.VertexCount());
+    fprintf(file, "property float x\nproperty float y\nproperty float z\nproperty float deviation\n");
+    fprintf(file, "property uchar red\nproperty uchar green\nproperty uchar blue\n");
+    fprintf(file, "element face %d\nproperty list uchar int vertex_indices\nend_header\n", triangles);
+
+    int failed = 0;
+    for (int i = 0; i < mesh.VertexCount() && !failed; i++)
+    {
+        unsigned char record[19];
+        const float values[4] = { (float)mesh.vertices[i].x, (float)mesh.vertices[i].y, (float)mesh.vertices[i].z,
+            (float)field.distance[i] };
+        memcpy(record, values, sizeof(values));
+        if (field.face[i] == DEVIATION_NO_FACE)
+            record[16] = record[17] = record[18] = 128;
+        else
+            RampColor(field.distance[i], range, record + 16);
+        failed = fwrite(record, sizeof(record), 1, file) != 1;
+    }
+    for (int i = 0; i < triangles && !failed; i++)
+    {
+        unsigned char record[13];
+        record[0] = 3;
+        memcpy(record + 1, &mesh.triangles[(size_t)i * 3], 3 * sizeof(int));
+        failed = fwrite(record, sizeof(record), 1, file) != 1;
+    }
+    failed |= fclose(file) != 0;
+    return failed ? 1 : 0;
+}
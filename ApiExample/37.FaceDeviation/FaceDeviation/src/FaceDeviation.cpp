@@ -0,0 +1,345 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* ZW3D API includes */
+#include "zwapi_brep_face.h"
+#include "zwapi_entity.h"
+#include "zwapi_face.h"
+#include "zwapi_part_objs.h"
+#include "zwapi_userinput.h"
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+#include "..\inc\FaceDeviationPr.h"
+#include "..\inc\DeviationMap.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define MESSAGE_SIZE 256
+#define PATH_SIZE 512
+#define DEFAULT_TOLERANCE 0.01       /* default facet distance tolerance (mm) */
+#define REFINE_GAP_FACTOR 10.0       /* largest refinement move, times the facet tolerance */
+#define PROJECT_TOLERANCE 1.0e-7     /* foot point move that ends the Newton iterations (mm) */
+#define PROJECT_SEEDS 2              /* seeds per refined sample */
+#define HOST_SAMPLES 200             /* samples checked with the host, at most */
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: picked faces */
+struct FaceSet
+{
+    int count;
+    szwEntityHandle *faces;
+};
+
+/*******************************************************************/
+/* Function declarations */
+static int FaceDeviation(void);
+static int FacesPick(const char *prompt, FaceSet *set);
+static int FacetsRead(const FaceSet &set, double tolerance, DeviationMesh *mesh, DeviationMap *map);
+static int SurfacesRead(const FaceSet &set, DeviationMap *map);
+static void HostCheck(const FaceSet &reference, const DeviationMesh &mesh, const DeviationField &field);
+static double Seconds(std::chrono::steady_clock::time_point start);
+
+/*******************************************************************/
+/* Function definition */
+int RegisterFaceDeviation
+(
+void
+)
+/*
+DESCRIPTION:
+   Register the commands of the face deviation example.
+*/
+{
+    /* Measure and export the deviation of faces from reference faces by entering "~FaceDeviation" */
+    ZwCommandFunctionLoad("FaceDeviation", (void *)FaceDeviation, ZW_LICENSE_CODE_GENERAL);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int UnloadFaceDeviation
+(
+void
+)
+/*
+DESCRIPTION:
+   Unload the commands of the face deviation example.
+*/
+{
+    ZwCommandFunctionUnload("FaceDeviation");
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+double Seconds
+(
+std::chrono::steady_clock::time_point start   /* I: start time */
+)
+/*
+DESCRIPTION:
+   Seconds elapsed since "start".
+*/
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*******************************************************************/
+/* Function definition */
+int FacesPick
+(
+const char *prompt,   /* I: pick prompt */
+FaceSet *set          /* O: picked faces, free with ZwEntityHandleListFree() */
+)
+/*
+DESCRIPTION:
+   Pick faces.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    set->count = 0;
+    set->faces = nullptr;
+    if (ZwEntityListGetByPick(prompt, ZW_INPUT_FACE, 0, &set->count, &set->faces) || set->count < 1)
+        return 1;
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int FacetsRead
+(
+const FaceSet &set,        /* I: faces */
+double tolerance,          /* I: facet distance tolerance */
+DeviationMesh *mesh,       /* O: samples, nullptr to skip */
+DeviationMap *map          /* O: reference facets, nullptr to skip */
+)
+/*
+DESCRIPTION:
+   Get the facets of the faces with one ZwFaceListFacetsGet() call, and
+append them to the sample mesh or to the reference, tagged with the
+index of their face.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    szwRefineFacetsOfMultiFace refine{};
+    refine.countFace = set.count;
+    refine.faceHandle = set.faces;
+    refine.type = ZW_FACETS_TOLORANCE_DISTANCE;
+    refine.edgeTolorance = tolerance;
+    refine.facetTolorance = tolerance;
+    refine.angleTolorance = 5.0;
+    refine.surfaceTolorance = 1.0;
+
+    int count = 0;
+    szwFacets *facets = nullptr;
+    if (ZwFaceListFacetsGet(refine, &count, &facets))
+        return 1;
+    int failed = 0;
+    for (int i = 0; i < count && i < set.count; i++)
+    {
+        if (mesh != nullptr)
+            failed |= mesh->AddFacets(facets[i]);
+        if (map != nullptr)
+            failed |= map->AddFacets(facets[i], i);
+    }
+    for (int i = 0; i < count; i++)
+        ZwFaceFacetsDataFree(&facets[i]);
+    ZwMemoryFree((void **)&facets);
+    return failed;
+}
+
+/*******************************************************************/
+/* Function definition */
+int SurfacesRead
+(
+const FaceSet &set,   /* I: reference faces */
+DeviationMap *map     /* I/O: reference, the surfaces are added */
+)
+/*
+DESCRIPTION:
+   Read the surface of every reference face with cvxPartInqFaceSrf() for
+the refinement.
+
+   Return the number of faces whose surface could not be added.
+*/
+{
+    std::vector<int> ids(set.count);
+    if (ZwEntityIdGet(set.count, set.faces, ids.data()))
+        return set.count;
+    int failed = 0;
+    for (int i = 0; i < set.count; i++)
+    {
+        svxSurface surface{};
+        if (cvxPartInqFaceSrf(ids[i], &surface))
+        {
+            failed++;
+            continue;
+        }
+        failed += map->AddSurface(surface, i);
+        cvxSurfaceFree(&surface);
+    }
+    return failed;
+}
+
+/*******************************************************************/
+/* Function definition */
+void HostCheck
+(
+const FaceSet &reference,      /* I: reference faces */
+const DeviationMesh &mesh,     /* I: samples */
+const DeviationField &field    /* I: local deviations */
+)
+/*
+DESCRIPTION:
+   Measure up to HOST_SAMPLES samples spread over the mesh with one
+ZwEntityPointMinDistanceGet() call per sample and reference face, the
+way it is done without the deviation map, and report the largest
+difference of the distances and the host time for all samples at that
+rate.
+*/
+{
+    const int count = mesh.VertexCount();
+    const int step = count > HOST_SAMPLES ? count / HOST_SAMPLES : 1;
+    int checked = 0, calls = 0;
+    double difference = 0.0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; i += step)
+    {
+        if (field.face[i] == DEVIATION_NO_FACE)
+            continue;
+        szwPoint point;
+        point.x = mesh.vertices[i].x;
+        point.y = mesh.vertices[i].y;
+        point.z = mesh.vertices[i].z;
+        double closest = -1.0;
+        for (int f = 0; f < reference.count; f++)
+        {
+            szwPoint target;
+            double distance = 0.0;
+            calls++;
+            if (ZwEntityPointMinDistanceGet(reference.faces[f], point, &target, &distance))
+                continue;
+            closest = closest < 0.0 || distance < closest ? distance : closest;
+        }
+        if (closest < 0.0)
+            continue;
+        const double d = fabs(closest - fabs(field.distance[i]));
+        difference = d > difference ? d : difference;
+        checked++;
+    }
+    const double hostTime = Seconds(start);
+
+    char message[MESSAGE_SIZE];
+    sprintf_s(message, MESSAGE_SIZE, "Host: %d samples, %d calls, %.3f s (%.1f s for all samples), largest "
+        "difference %g", checked, calls, hostTime, checked > 0 ? hostTime * count / checked : 0.0,
+        difference);
+    cvxMsgDisp(message);
+}
+
+/*******************************************************************/
+/* Function definition */
+int FaceDeviation
+(
+void
+)
+/*
+DESCRIPTION:
+   Measure the deviation of the facet vertices of the picked faces from
+the picked reference faces on one thread and on the pool, report the
+statistics and a check with the host, and export the deviation map.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    FaceSet measured, reference;
+    if (FacesPick("Select the faces to measure", &measured))
+        return 1;
+    if (FacesPick("Select the reference faces", &reference))
+    {
+        ZwEntityHandleListFree(measured.count, &measured.faces);
+        return 1;
+    }
+
+    double tolerance = DEFAULT_TOLERANCE;
+    if (cvxGetNumber("Facet distance tolerance", &tolerance) || !(tolerance > 0.0))
+        tolerance = DEFAULT_TOLERANCE;
+    double number = 1.0;
+    if (cvxGetNumber("Refine on the true surfaces (1 yes, 0 no)", &number))
+        number = 1.0;
+    DeviationOptions options;
+    options.refine = number != 0.0 ? 1 : 0;
+    options.limit = 0.0;
+    if (cvxGetNumber("Search distance (0 for no limit)", &options.limit) || options.limit < 0.0)
+        options.limit = 0.0;
+    options.refineGap = REFINE_GAP_FACTOR * tolerance;
+    options.project.tolerance = PROJECT_TOLERANCE;
+    options.project.seeds = PROJECT_SEEDS;
+
+    DeviationMesh mesh;
+    DeviationMap map;
+    auto start = std::chrono::steady_clock::now();
+    int failed = FacetsRead(measured, tolerance, &mesh, nullptr) || FacetsRead(reference, tolerance, nullptr, &map);
+    const int noSurface = failed || !options.refine ? 0 : SurfacesRead(reference, &map);
+    const double readTime = Seconds(start);
+    start = std::chrono::steady_clock::now();
+    failed = failed || map.Build();
+    const double buildTime = Seconds(start);
+    if (failed || mesh.VertexCount() == 0)
+    {
+        ZwEntityHandleListFree(measured.count, &measured.faces);
+        ZwEntityHandleListFree(reference.count, &reference.faces);
+        cvxMsgDisp("No facets");
+        return 1;
+    }
+
+    DeviationField serial, pooled;
+    start = std::chrono::steady_clock::now();
+    map.Measure(mesh.VertexCount(), mesh.vertices.data(), options, nullptr, &serial);
+    const double serialTime = Seconds(start);
+    WorkPool pool;
+    start = std::chrono::steady_clock::now();
+    map.Measure(mesh.VertexCount(), mesh.vertices.data(), options, &pool, &pooled);
+    const double poolTime = Seconds(start);
+
+    const DeviationStats stats = DeviationMap::Statistics(serial);
+    char message[MESSAGE_SIZE];
+    sprintf_s(message, MESSAGE_SIZE, "%d samples on %d faces, %d reference faces (%d triangles, %d surfaces, %d "
+        "without)", mesh.VertexCount(), measured.count, reference.count, map.Bvh().TriangleCount(),
+        map.SurfaceCount(), noSurface);
+    cvxMsgDisp(message);
+    sprintf_s(message, MESSAGE_SIZE, "Deviation: min %g, max %g, mean %g, RMS %g; %d refined, %d without reference",
+        stats.min, stats.max, stats.mean, stats.rms, stats.refined, stats.missed);
+    cvxMsgDisp(message);
+    sprintf_s(message, MESSAGE_SIZE, "Local: read %.3f s, tree %.3f s, 1 thread %.3f s, %d threads %.3f s, same "
+        "result: %s", readTime, buildTime, serialTime, pool.ThreadCount(), poolTime,
+        serial.distance == pooled.distance ? "yes" : "no");
+    cvxMsgDisp(message);
+
+    HostCheck(reference, mesh, serial);
+    ZwEntityHandleListFree(measured.count, &measured.faces);
+    ZwEntityHandleListFree(reference.count, &reference.faces);
+
+    char path[PATH_SIZE] = "";
+    cvxGetFileByLongPath(0, "Export deviation map", "", "PLY File (*.ply)|*.ply|", path, PATH_SIZE);
+    if (path[0] == '\0')
+        return 0;
+    const double range = fabs(stats.min) > fabs(stats.max) ? fabs(stats.min) : fabs(stats.max);
+    if (DeviationPlyWrite(path, mesh, serial, range))
+    {
+        cvxMsgDisp("Export failed");
+        return 1;
+    }
+    sprintf_s(message, MESSAGE_SIZE, "Deviation map written, colors from -%g (blue) to %g (red)", range, range);
+    cvxMsgDisp(message);
+    return 0;
+}
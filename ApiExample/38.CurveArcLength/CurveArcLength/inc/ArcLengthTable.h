@@ -0,0 +1,97 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+#pragma once
+
+/* ZW3D API includes */
+#include "zwapi_util.h"
+
+/* Application includes */
+#include <vector>
+#include "NurbsCurveEval.h"
+#include "WorkPool.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define ARC_LENGTH_GAUSS 8               /* Gauss-Legendre points per piece */
+#define ARC_LENGTH_MAX_DEPTH 30          /* halvings of a knot span at most */
+#define ARC_LENGTH_NEWTON_STEPS 30       /* Newton steps of a distance lookup at most */
+#define ARC_LENGTH_GRAIN 512             /* distances taken at a time by a pool worker */
+
+/*
+DESCRIPTION:
+   Arc-length table of one curve, replacing ZwCurveLengthGet(),
+ZwCurveSegmentLengthGet(), cvxCrvGetPntAtDist() and
+ZwCurvePointGetByLengthFraction(), which solve the length of the curve
+again at every call.
+
+   Init() copies the data of the curve read with cvxPartInqCurve(). The
+length of lines, arcs and circles is exact. A NURBS curve is cut at its
+knots and every knot span is halved until the 8-point Gauss-Legendre
+length of a piece and the sum of the lengths of its halves agree within
+the tolerance (relative to the piece length); the table keeps the
+parameter and the length from the curve start at the end of every piece,
+the lengths of the halves being the ones kept.
+
+   The parameter at a distance is found by a binary search of the pieces,
+a first guess interpolated from the lengths and speeds at the piece ends,
+and Newton steps on the Gauss-Legendre length inside the piece, kept in
+the piece by bisection. Place() and Divide() run many distances on a
+WorkPool; each worker walks the pieces forward from its last one, so
+sorted distances such as an equal spacing never search the table.
+
+   The parameter is 0 to 1 for lines, the angle in degrees for arcs and
+circles, and the knot range for NURBS curves. The table is immutable
+after Init() and may be shared by threads.
+*/
+class ArcLengthTable
+{
+public:
+    ArcLengthTable();
+
+    int Init(const svxCurve &curve, double tolerance);
+    void Clear(void);
+
+    double Length(void) const { return m_lengths.empty() ? 0.0 : m_lengths.back(); }
+    double Length(double t0, double t1) const;
+    double Distance(double t) const;
+    int Parameter(double s, double *t) const;
+    int Evaluate(double t, svxPoint *point) const;
+
+    int Place(int count, const double *s, WorkPool *pool, double *t, svxPoint *points) const;
+    int Divide(int count, WorkPool *pool, double *t, svxPoint *points) const;
+
+    int IsValid(void) const { return !m_lengths.empty(); }
+    int PieceCount(void) const { return m_lengths.empty() ? 0 : (int)m_lengths.size() - 1; }
+    svxLimit Domain(void) const;
+
+private:
+    /* data of a running Place() or Divide() */
+    struct Batch
+    {
+        const ArcLengthTable *self;
+        const double *s;      /* distances, nullptr for an equal spacing */
+        double step;          /* spacing of an equal spacing */
+        double *t;
+        svxPoint *points;
+    };
+
+    static void TaskRun(void *data, int begin, int end, int worker);
+    double Speed(double t) const;
+    double PieceLength(double t0, double t1) const;
+    int PieceFind(double value, const std::vector<double> &column, int hint) const;
+    double ParameterFind(double s, int *piece) const;
+    void SpanAdd(double t0, double t1, double tolerance);
+
+    evxCurveType m_type;
+    svxPoint m_start, m_end;          /* line */
+    svxPoint m_center;                /* arc and circle */
+    svxVector m_xAxis, m_yAxis;       /* arc plane, angle 0 on xAxis */
+    double m_radius;
+    double m_speed;                   /* length per parameter of lines and arcs */
+    NurbsCurveEvaluator m_nurbs;
+    std::vector<double> m_params;     /* parameter at the piece ends */
+    std::vector<double> m_lengths;    /* length from the curve start at the piece ends */
+    std::vector<double> m_speeds;     /* speed at the piece ends */
+};
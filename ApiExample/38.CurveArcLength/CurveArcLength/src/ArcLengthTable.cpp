@@ -0,0 +1,569 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* Application includes */
+#include <math.h>
+#include <algorithm>
+#include "..\inc\ArcLengthTable.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define ARC_LENGTH_PI 3.14159265358979323846
+#define ARC_LENGTH_EPS 1.0e-13           /* distance error of a lookup, relative to the curve length */
+
+/* Gauss-Legendre abscissas and weights on [-1, 1], positive half */
+static const double s_gaussX[ARC_LENGTH_GAUSS / 2] =
+{
+    0.1834346424956498, 0.5255324099163290, 0.7966664774136267, 0.9602898564975363
+};
+static const double s_gaussW[ARC_LENGTH_GAUSS / 2] =
+{
+    0.3626837833783620, 0.3137066458778873, 0.2223810344533745, 0.1012285362903763
+};
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: halving step of a knot span */
+struct ArcLengthPiece
+{
+    double t0, t1;
+    double length;     /* Gauss-Legendre length of the piece */
+    int depth;
+};
+
+/*******************************************************************/
+/* Function definition */
+ArcLengthTable::ArcLengthTable
+(
+)
+/*
+DESCRIPTION:
+   Create an empty table.
+*/
+{
+    Clear();
+}
+
+/*******************************************************************/
+/* Function definition */
+void ArcLengthTable::Clear
+(
+void
+)
+/*
+DESCRIPTION:
+   Remove the curve.
+*/
+{
+    m_type = VX_CRV_LINE;
+    m_start.x = m_start.y = m_start.z = 0.0;
+    m_end = m_center = m_start;
+    m_xAxis.x = 1.0;
+    m_xAxis.y = m_xAxis.z = 0.0;
+    m_yAxis.y = 1.0;
+    m_yAxis.x = m_yAxis.z = 0.0;
+    m_radius = 0.0;
+    m_speed = 0.0;
+    m_nurbs = NurbsCurveEvaluator();
+    m_params.clear();
+    m_lengths.clear();
+    m_speeds.clear();
+}
+
+/*******************************************************************/
+/* Function definition */
+int ArcLengthTable::Init
+(
+const svxCurve &curve,   /* I: curve data of cvxPartInqCurve() */
+double tolerance         /* I: length error of a NURBS piece, relative to its length */
+)
+/*
+DESCRIPTION:
+   Copy the data of a curve and build its table. Arcs and circles with a
+frame have their center at the frame origin and lie in its XY plane;
+without a frame (identity) they are 2D curves centered at P1.
+
+   Return 1 if the curve type or its data is not supported, else 0.
+*/
+{
+    Clear();
+    if (!(tolerance > 0.0))
+        return 1;
+
+    m_type = curve.Type;
+    m_start = curve.P1;
+    m_end = curve.P2;
+    m_center = curve.P1;
+    m_radius = curve.R;
+
+    switch (curve.Type)
+    {
+    case VX_CRV_LINE:
+    {
+        const double dx = m_end.x - m_start.x, dy = m_end.y - m_start.y, dz = m_end.z - m_start.z;
+        m_speed = sqrt(dx * dx + dy * dy + dz * dz);
+        m_params.push_back(0.0);
+        m_params.push_back(1.0);
+        break;
+    }
+
+    case VX_CRV_ARC:
+    case VX_CRV_CIRCLE:
+    {
+        if (!(curve.R > 0.0))
+            return 1;
+        if (!curve.Frame.identity)
+        {
+            m_center.x = curve.Frame.xt;
+            m_center.y = curve.Frame.yt;
+            m_center.z = curve.Frame.zt;
+            m_xAxis.x = curve.Frame.xx;
+            m_xAxis.y = curve.Frame.yx;
+            m_xAxis.z = curve.Frame.zx;
+            m_yAxis.x = curve.Frame.xy;
+            m_yAxis.y = curve.Frame.yy;
+            m_yAxis.z = curve.Frame.zy;
+        }
+        double sweep = 360.0;
+        if (curve.Type == VX_CRV_ARC)
+        {
+            sweep = curve.A2 - curve.A1;
+            while (sweep <= 0.0)
+                sweep += 360.0;
+            if (sweep > 360.0)
+                sweep = 360.0;
+        }
+        m_speed = curve.R * ARC_LENGTH_PI / 180.0;
+        m_params.push_back(curve.A1);
+        m_params.push_back(curve.A1 + sweep);
+        break;
+    }
+
+    case VX_CRV_NURB:
+    {
+        if (m_nurbs.Init(curve))
+            return 1;
+        const svxLimit domain = m_nurbs.Domain();
+        m_params.push_back(domain.min);
+        m_lengths.push_back(0.0);
+        m_speeds.push_back(Speed(domain.min));
+        double t0 = domain.min;
+        for (int i = 0; i <= curve.T.num_knots; i++)
+        {
+            const double knot = i < curve.T.num_knots ? curve.T.knots[i] : domain.max;
+            if (knot > t0 && (knot < domain.max || i == curve.T.num_knots))
+            {
+                SpanAdd(t0, knot, tolerance);
+                t0 = knot;
+            }
+        }
+        if (m_params.size() < 2)
+        {
+            Clear();
+            return 1;
+        }
+        return 0;
+    }
+
+    default:
+        return 1;
+    }
+
+    m_lengths.push_back(0.0);
+    m_lengths.push_back(m_speed * (m_params[1] - m_params[0]));
+    m_speeds.assign(2, m_speed);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void ArcLengthTable::SpanAdd
+(
+double t0,          /* I: knot span start */
+double t1,          /* I: knot span end */
+double tolerance    /* I: length error of a piece, relative to its length */
+)
+/*
+DESCRIPTION:
+   Halve a knot span until the length of every piece agrees with the sum
+of the lengths of its halves, and append the pieces to the table.
+*/
+{
+    std::vector<ArcLengthPiece> stack;
+    ArcLengthPiece piece = { t0, t1, PieceLength(t0, t1), 0 };
+    stack.push_back(piece);
+    while (!stack.empty())
+    {
+        const ArcLengthPiece top = stack.back();
+        stack.pop_back();
+
+        const double middle = 0.5 * (top.t0 + top.t1);
+        const double left = PieceLength(top.t0, middle), right = PieceLength(middle, top.t1);
+        if (top.depth >= ARC_LENGTH_MAX_DEPTH || fabs(left + right - top.length) <= tolerance * (left + right))
+        {
+            m_params.push_back(top.t1);
+            m_lengths.push_back(m_lengths.back() + left + right);
+            m_speeds.push_back(Speed(top.t1));
+            continue;
+        }
+
+        /* right half first, so the left half is done next */
+        piece.t0 = middle;
+        piece.t1 = top.t1;
+        piece.length = right;
+        piece.depth = top.depth + 1;
+        stack.push_back(piece);
+        piece.t0 = top.t0;
+        piece.t1 = middle;
+        piece.length = left;
+        stack.push_back(piece);
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+svxLimit ArcLengthTable::Domain
+(
+void
+) const
+/*
+DESCRIPTION:
+   Parameter range of the curve.
+*/
+{
+    svxLimit domain = { 0.0, 0.0 };
+    if (!m_params.empty())
+    {
+        domain.min = m_params.front();
+        domain.max = m_params.back();
+    }
+    return domain;
+}
+
+/*******************************************************************/
+/* Function definition */
+double ArcLengthTable::Speed
+(
+double t    /* I: parameter */
+) const
+/*
+DESCRIPTION:
+   Length of the first derivative of the curve.
+*/
+{
+    if (m_type != VX_CRV_NURB)
+        return m_speed;
+    svxEvalCurv eval;
+    m_nurbs.Evaluate(t, 1, &eval);
+    const svxPoint &d = eval.deriv_1;
+    return sqrt(d.x * d.x + d.y * d.y + d.z * d.z);
+}
+
+/*******************************************************************/
+/* Function definition */
+double ArcLengthTable::PieceLength
+(
+double t0,   /* I: start parameter */
+double t1    /* I: end parameter */
+) const
+/*
+DESCRIPTION:
+   Length of the curve from t0 to t1 by 8-point Gauss-Legendre quadrature
+of the speed, negative if t1 is before t0. The derivatives of the eight
+points are evaluated at once.
+*/
+{
+    if (m_type != VX_CRV_NURB)
+        return m_speed * (t1 - t0);
+
+    const double middle = 0.5 * (t0 + t1), half = 0.5 * (t1 - t0);
+    double t[ARC_LENGTH_GAUSS], w[ARC_LENGTH_GAUSS];
+    for (int i = 0; i < ARC_LENGTH_GAUSS / 2; i++)
+    {
+        const int k = ARC_LENGTH_GAUSS / 2 - 1 - i;
+        t[i] = middle - half * s_gaussX[k];
+        t[ARC_LENGTH_GAUSS - 1 - i] = middle + half * s_gaussX[k];
+        w[i] = w[ARC_LENGTH_GAUSS - 1 - i] = s_gaussW[k];
+    }
+    svxEvalCurv evals[ARC_LENGTH_GAUSS];
+    m_nurbs.Evaluate(ARC_LENGTH_GAUSS, t, 1, evals);
+
+    double sum = 0.0;
+    for (int i = 0; i < ARC_LENGTH_GAUSS; i++)
+    {
+        const svxPoint &d = evals[i].deriv_1;
+        sum += w[i] * sqrt(d.x * d.x + d.y * d.y + d.z * d.z);
+    }
+    return sum * half;
+}
+
+/*******************************************************************/
+/* Function definition */
+int ArcLengthTable::PieceFind
+(
+double value,                        /* I: parameter or length */
+const std::vector<double> &column,   /* I: m_params or m_lengths */
+int hint                             /* I: piece to try first, -1 for none */
+) const
+/*
+DESCRIPTION:
+   Find the piece of the table holding a value: the hint and the piece
+after it are tried first, then the pieces are searched.
+
+   Return the index of the piece.
+*/
+{
+    const int pieces = (int)column.size() - 1;
+    for (int i = hint; i >= 0 && i < pieces && i <= hint + 1; i++)
+    {
+        if (value >= column[i] && value <= column[i + 1])
+            return i;
+    }
+    const int i = (int)(std::upper_bound(column.begin(), column.end(), value) - column.begin()) - 1;
+    return i < 0 ? 0 : (i >= pieces ? pieces - 1 : i);
+}
+
+/*******************************************************************/
+/* Function definition */
+double ArcLengthTable::Distance
+(
+double t    /* I: parameter, clamped to the domain */
+) const
+/*
+DESCRIPTION:
+   Length of the curve from its start to a parameter.
+*/
+{
+    if (!IsValid())
+        return 0.0;
+    t = t < m_params.front() ? m_params.front() : (t > m_params.back() ? m_params.back() : t);
+    const int i = PieceFind(t, m_params, -1);
+    return t >= m_params[i + 1] ? m_lengths[i + 1] : m_lengths[i] + PieceLength(m_params[i], t);
+}
+
+/*******************************************************************/
+/* Function definition */
+double ArcLengthTable::Length
+(
+double t0,   /* I: start parameter */
+double t1    /* I: end parameter */
+) const
+/*
+DESCRIPTION:
+   Length of the curve between two parameters, as ZwCurveSegmentLengthGet().
+*/
+{
+    return fabs(Distance(t1) - Distance(t0));
+}
+
+/*******************************************************************/
+/* Function definition */
+double ArcLengthTable::ParameterFind
+(
+double s,      /* I: distance from the curve start, clamped to the length */
+int *piece     /* I/O: piece to try first (-1 for none), then piece of the parameter */
+) const
+/*
+DESCRIPTION:
+   Parameter at a distance along the curve: the piece is found in the
+table and the parameter guessed from the lengths and speeds at its ends,
+then Newton steps on the length inside the piece, a step leaving the
+bracket of the root being replaced by a bisection.
+*/
+{
+    const double length = m_lengths.back();
+    s = s < 0.0 ? 0.0 : (s > length ? length : s);
+    const int i = PieceFind(s, m_lengths, *piece);
+    *piece = i;
+
+    const double a = m_params[i], b = m_params[i + 1];
+    const double sa = m_lengths[i], sb = m_lengths[i + 1];
+    if (s <= sa || !(sb > sa))
+        return a;
+    if (s >= sb)
+        return b;
+    if (m_type != VX_CRV_NURB)
+        return a + (s - sa) / m_speed;
+
+    /* first guess by cubic Hermite interpolation of t(s), whose slopes are the inverse speeds */
+    const double ds = sb - sa, u = (s - sa) / ds;
+    double t = a + u * (b - a);
+    if (m_speeds[i] > 0.0 && m_speeds[i + 1] > 0.0)
+    {
+        const double u2 = u * u, u3 = u2 * u;
+        const double guess = (2.0 * u3 - 3.0 * u2 + 1.0) * a + (u3 - 2.0 * u2 + u) * ds / m_speeds[i] +
+            (3.0 * u2 - 2.0 * u3) * b + (u3 - u2) * ds / m_speeds[i + 1];
+        t = guess > a && guess < b ? guess : t;
+    }
+
+    const double eps = ARC_LENGTH_EPS * length;
+    double low = a, high = b;
+    for (int k = 0; k < ARC_LENGTH_NEWTON_STEPS; k++)
+    {
+        const double f = sa + PieceLength(a, t) - s;
+        if (fabs(f) <= eps)
+            break;
+        if (f < 0.0)
+            low = t;
+        else
+            high = t;
+        const double speed = Speed(t);
+        double next = speed > 0.0 ? t - f / speed : low;
+        if (!(next > low && next < high))
+            next = 0.5 * (low + high);
+        if (next == t)
+            break;
+        t = next;
+    }
+    return t;
+}
+
+/*******************************************************************/
+/* Function definition */
+int ArcLengthTable::Parameter
+(
+double s,     /* I: distance from the curve start, clamped to the length */
+double *t     /* O: parameter */
+) const
+/*
+DESCRIPTION:
+   Parameter at a distance along the curve, as cvxCrvGetPntAtDist() from
+the curve start.
+
+   Return 1 if the table is empty, else 0.
+*/
+{
+    if (!IsValid() || t == nullptr)
+        return 1;
+    int piece = -1;
+    *t = ParameterFind(s, &piece);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int ArcLengthTable::Evaluate
+(
+double t,           /* I: parameter */
+svxPoint *point     /* O: point of the curve */
+) const
+/*
+DESCRIPTION:
+   Point of the curve at a parameter.
+
+   Return 1 if the table is empty, else 0.
+*/
+{
+    if (!IsValid() || point == nullptr)
+        return 1;
+    if (m_type == VX_CRV_NURB)
+        return m_nurbs.EvaluatePoints(1, &t, point);
+    if (m_type == VX_CRV_LINE)
+    {
+        point->x = m_start.x + t * (m_end.x - m_start.x);
+        point->y = m_start.y + t * (m_end.y - m_start.y);
+        point->z = m_start.z + t * (m_end.z - m_start.z);
+        return 0;
+    }
+    const double angle = t * ARC_LENGTH_PI / 180.0;
+    const double c = m_radius * cos(angle), s = m_radius * sin(angle);
+    point->x = m_center.x + c * m_xAxis.x + s * m_yAxis.x;
+    point->y = m_center.y + c * m_xAxis.y + s * m_yAxis.y;
+    point->z = m_center.z + c * m_xAxis.z + s * m_yAxis.z;
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void ArcLengthTable::TaskRun
+(
+void *data,    /* I: Batch */
+int begin,     /* I: first distance */
+int end,       /* I: end of the range */
+int /* worker */ /* I: unused */
+)
+/*
+DESCRIPTION:
+   Find the parameters and points of a range of distances, each lookup
+starting from the piece of the one before.
+*/
+{
+    const Batch *batch = (const Batch *)data;
+    const ArcLengthTable *self = batch->self;
+    int piece = -1;
+    for (int i = begin; i < end; i++)
+    {
+        const double s = batch->s != nullptr ? batch->s[i] : batch->step * i;
+        batch->t[i] = self->ParameterFind(s, &piece);
+    }
+    if (batch->points == nullptr)
+        return;
+    if (self->m_type == VX_CRV_NURB)
+        self->m_nurbs.EvaluatePoints(end - begin, batch->t + begin, batch->points + begin);
+    else
+    {
+        for (int i = begin; i < end; i++)
+            self->Evaluate(batch->t[i], &batch->points[i]);
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+int ArcLengthTable::Place
+(
+int count,           /* I: number of distances */
+const double *s,     /* I: distances from the curve start, best sorted */
+WorkPool *pool,      /* I: pool running the distances, nullptr for this thread only */
+double *t,           /* O: parameters */
+svxPoint *points     /* O: points, nullptr to skip */
+) const
+/*
+DESCRIPTION:
+   Parameters and points at many distances along the curve.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    if (!IsValid() || count < 0 || (count > 0 && (s == nullptr || t == nullptr)))
+        return 1;
+    Batch batch = { this, s, 0.0, t, points };
+    if (pool != nullptr)
+        pool->Run(count, ARC_LENGTH_GRAIN, TaskRun, &batch);
+    else
+        TaskRun(&batch, 0, count, 0);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int ArcLengthTable::Divide
+(
+int count,           /* I: number of points, at least 2 */
+WorkPool *pool,      /* I: pool running the points, nullptr for this thread only */
+double *t,           /* O: parameters */
+svxPoint *points     /* O: points, nullptr to skip */
+) const
+/*
+DESCRIPTION:
+   Parameters and points at an equal spacing along the curve, from its
+start to its end.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    if (!IsValid() || count < 2 || t == nullptr)
+        return 1;
+    Batch batch = { this, nullptr, Length() / (count - 1), t, points };
+    if (pool != nullptr)
+        pool->Run(count, ARC_LENGTH_GRAIN, TaskRun, &batch);
+    else
+        TaskRun(&batch, 0, count, 0);
+
+    /* the last point exactly at the end */
+    t[count - 1] = m_params.back();
+    if (points != nullptr)
+        Evaluate(t[count - 1], &points[count - 1]);
+    return 0;
+}
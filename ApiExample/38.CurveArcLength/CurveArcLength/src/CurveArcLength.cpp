@@ -0,0 +1,321 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* ZW3D API includes */
+#include "zwapi_curve.h"
+#include "zwapi_entity.h"
+#include "zwapi_feature_wireframe.h"
+#include "zwapi_math_nurbscurve.h"
+#include "zwapi_part_objs.h"
+#include "zwapi_userinput.h"
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+#include "..\inc\CurveArcLengthPr.h"
+#include "..\inc\ArcLengthTable.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define MESSAGE_SIZE 256
+#define DEFAULT_POINTS 1000          /* default number of points per curve */
+#define LENGTH_TOLERANCE 1.0e-10     /* length error of a NURBS piece, relative to its length */
+#define HOST_SAMPLES 200             /* points checked with the host, at most */
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: picked curves and their tables */
+struct CurveSet
+{
+    int count;
+    szwEntityHandle *curves;
+    std::vector<int> ids;
+    std::vector<int> nurbs;               /* 1 for NURBS curves */
+    std::vector<ArcLengthTable> tables;
+};
+
+/* DESCRIPTION: equally spaced points of all curves, "points" per curve */
+struct CurvePoints
+{
+    int points;
+    std::vector<double> t;
+    std::vector<svxPoint> xyz;
+};
+
+/*******************************************************************/
+/* Function declarations */
+static int CurveArcLength(void);
+static int CurvesLoad(CurveSet *set);
+static void CurvesDivide(const CurveSet &set, WorkPool *pool, CurvePoints *points);
+static void HostCheck(const CurveSet &set, const CurvePoints &points);
+static double Seconds(std::chrono::steady_clock::time_point start);
+
+/*******************************************************************/
+/* Function definition */
+int RegisterCurveArcLength
+(
+void
+)
+/*
+DESCRIPTION:
+   Register the commands of the curve arc length example.
+*/
+{
+    /* Place equally spaced points along curves by entering "~CurveArcLength" */
+    ZwCommandFunctionLoad("CurveArcLength", (void *)CurveArcLength, ZW_LICENSE_CODE_GENERAL);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int UnloadCurveArcLength
+(
+void
+)
+/*
+DESCRIPTION:
+   Unload the commands of the curve arc length example.
+*/
+{
+    ZwCommandFunctionUnload("CurveArcLength");
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+double Seconds
+(
+std::chrono::steady_clock::time_point start   /* I: start time */
+)
+/*
+DESCRIPTION:
+   Seconds elapsed since "start".
+*/
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*******************************************************************/
+/* Function definition */
+int CurvesLoad
+(
+CurveSet *set   /* O: picked curves, free set->curves with ZwEntityHandleListFree() */
+)
+/*
+DESCRIPTION:
+   Pick curves, read their data with cvxPartInqCurve() and build their
+arc-length tables.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    set->count = 0;
+    set->curves = nullptr;
+    if (ZwEntityListGetByPick("Select the curves", ZW_INPUT_EDGE_OR_CURVE, 0, &set->count, &set->curves) ||
+        set->count < 1)
+        return 1;
+
+    set->ids.assign(set->count, 0);
+    set->nurbs.assign(set->count, 0);
+    set->tables.assign(set->count, ArcLengthTable());
+    if (ZwEntityIdGet(set->count, set->curves, set->ids.data()))
+        return 1;
+    for (int i = 0; i < set->count; i++)
+    {
+        svxCurve curve{};
+        if (cvxPartInqCurve(set->ids[i], 0, &curve))
+            return 1;
+        set->nurbs[i] = curve.Type == VX_CRV_NURB ? 1 : 0;
+        const int failed = set->tables[i].Init(curve, LENGTH_TOLERANCE);
+        cvxCurveFree(&curve);
+        if (failed)
+        {
+            char message[MESSAGE_SIZE];
+            sprintf_s(message, MESSAGE_SIZE, "Curve %d is not supported", i + 1);
+            cvxMsgDisp(message);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void CurvesDivide
+(
+const CurveSet &set,      /* I: curves */
+WorkPool *pool,           /* I: pool running the points, nullptr for this thread only */
+CurvePoints *points       /* I/O: points->points per curve, the points are set */
+)
+/*
+DESCRIPTION:
+   Place the equally spaced points of every curve.
+*/
+{
+    const size_t total = (size_t)set.count * points->points;
+    points->t.resize(total);
+    points->xyz.resize(total);
+    for (int i = 0; i < set.count; i++)
+    {
+        const size_t first = (size_t)i * points->points;
+        set.tables[i].Divide(points->points, pool, &points->t[first], &points->xyz[first]);
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+void HostCheck
+(
+const CurveSet &set,          /* I: curves */
+const CurvePoints &points     /* I: equally spaced points of the tables */
+)
+/*
+DESCRIPTION:
+   Check the tables against the host: the length of every curve with
+ZwCurveLengthGet(), the middle half of every NURBS curve with
+ZwCurveSegmentLengthGet(), and up to HOST_SAMPLES points with
+ZwCurvePointGetByLengthFraction() and, on NURBS curves,
+cvxCrvGetPntAtDist(). The largest differences and the host time for all
+points at that rate are reported.
+*/
+{
+    double lengthDifference = 0.0, segmentDifference = 0.0;
+    for (int i = 0; i < set.count; i++)
+    {
+        const ArcLengthTable &table = set.tables[i];
+        double length = 0.0;
+        if (!ZwCurveLengthGet(set.curves[i], &length))
+        {
+            const double d = fabs(length - table.Length());
+            lengthDifference = d > lengthDifference ? d : lengthDifference;
+        }
+        if (!set.nurbs[i])
+            continue;
+        const svxLimit domain = table.Domain();
+        const double t0 = domain.min + 0.25 * (domain.max - domain.min);
+        const double t1 = domain.min + 0.75 * (domain.max - domain.min);
+        if (!ZwCurveSegmentLengthGet(set.curves[i], t0, t1, &length))
+        {
+            const double d = fabs(length - table.Length(t0, t1));
+            segmentDifference = d > segmentDifference ? d : segmentDifference;
+        }
+    }
+
+    const int total = set.count * points.points;
+    const int step = total > HOST_SAMPLES ? total / HOST_SAMPLES : 1;
+    int checked = 0;
+    double pointDifference = 0.0, parameterDifference = 0.0;
+    auto start = std::chrono::steady_clock::now();
+    for (int k = 0; k < total; k += step)
+    {
+        const int curve = k / points.points, i = k % points.points;
+        const ArcLengthTable &table = set.tables[curve];
+        const double fraction = (double)i / (points.points - 1);
+        szwPoint point;
+        if (ZwCurvePointGetByLengthFraction(set.curves[curve], fraction, &point))
+            continue;
+        const svxPoint &p = points.xyz[k];
+        const double d = sqrt((point.x - p.x) * (point.x - p.x) + (point.y - p.y) * (point.y - p.y) +
+            (point.z - p.z) * (point.z - p.z));
+        pointDifference = d > pointDifference ? d : pointDifference;
+        checked++;
+
+        double t = 0.0;
+        if (set.nurbs[curve] && !cvxCrvGetPntAtDist(set.ids[curve], table.Domain().min, fraction * table.Length(),
+            &t, nullptr))
+        {
+            const double dt = fabs(t - points.t[k]);
+            parameterDifference = dt > parameterDifference ? dt : parameterDifference;
+        }
+    }
+    const double hostTime = Seconds(start);
+
+    char message[MESSAGE_SIZE];
+    sprintf_s(message, MESSAGE_SIZE, "Host: largest difference of the lengths %g, of the NURBS segment lengths %g",
+        lengthDifference, segmentDifference);
+    cvxMsgDisp(message);
+    sprintf_s(message, MESSAGE_SIZE, "Host: %d points, %.3f s (%.1f s for all points), largest difference of the "
+        "points %g, of the NURBS parameters %g", checked, hostTime, checked > 0 ? hostTime * total / checked : 0.0,
+        pointDifference, parameterDifference);
+    cvxMsgDisp(message);
+}
+
+/*******************************************************************/
+/* Function definition */
+int CurveArcLength
+(
+void
+)
+/*
+DESCRIPTION:
+   Build the arc-length tables of the picked curves, place equally spaced
+points along them on one thread and on the pool, check them with the host
+and create the points if asked.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    CurveSet set;
+    auto start = std::chrono::steady_clock::now();
+    int failed = CurvesLoad(&set);
+    const double loadTime = Seconds(start);
+    if (failed)
+    {
+        ZwEntityHandleListFree(set.count, &set.curves);
+        return 1;
+    }
+
+    double number = DEFAULT_POINTS;
+    if (cvxGetNumber("Number of points per curve", &number) || number < 2.0)
+        number = DEFAULT_POINTS;
+    CurvePoints serial, pooled;
+    serial.points = pooled.points = (int)number;
+
+    start = std::chrono::steady_clock::now();
+    CurvesDivide(set, nullptr, &serial);
+    const double serialTime = Seconds(start);
+    WorkPool pool;
+    start = std::chrono::steady_clock::now();
+    CurvesDivide(set, &pool, &pooled);
+    const double poolTime = Seconds(start);
+
+    int pieces = 0;
+    double length = 0.0;
+    for (int i = 0; i < set.count; i++)
+    {
+        pieces += set.tables[i].PieceCount();
+        length += set.tables[i].Length();
+    }
+    char message[MESSAGE_SIZE];
+    sprintf_s(message, MESSAGE_SIZE, "%d curves, length %g, %d table pieces, %d points", set.count, length, pieces,
+        set.count * serial.points);
+    cvxMsgDisp(message);
+    sprintf_s(message, MESSAGE_SIZE, "Local: read and tables %.3f s, 1 thread %.3f s, %d threads %.3f s, same "
+        "result: %s", loadTime, serialTime, pool.ThreadCount(), poolTime, serial.t == pooled.t ? "yes" : "no");
+    cvxMsgDisp(message);
+
+    HostCheck(set, serial);
+    ZwEntityHandleListFree(set.count, &set.curves);
+
+    number = 0.0;
+    if (cvxGetNumber("Create the points (1 yes, 0 no)", &number) || number == 0.0)
+        return 0;
+    std::vector<szwPoint> created(serial.xyz.size());
+    for (size_t i = 0; i < created.size(); i++)
+    {
+        created[i].x = serial.xyz[i].x;
+        created[i].y = serial.xyz[i].y;
+        created[i].z = serial.xyz[i].z;
+    }
+    start = std::chrono::steady_clock::now();
+    failed = ZwFeaturePointsCreateByAbsolute((int)created.size(), created.data(), nullptr) ? 1 : 0;
+    sprintf_s(message, MESSAGE_SIZE, failed ? "Points not created" : "%d points created in %.3f s",
+        (int)created.size(), Seconds(start));
+    cvxMsgDisp(message);
+    return failed;
+}
@@ -0,0 +1,23 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+#pragma once
+
+/* ZW3D API includes */
+#include "zwapi_util.h"
+
+/*
+DESCRIPTION:
+   Adaptive-precision 2D orientation predicate.
+
+   ExactOrient2d() first computes the determinant in double precision and
+returns it when it is farther from zero than its rounding error bound;
+only the nearly degenerate cases are evaluated again exactly with
+floating-point expansions (sums of non-overlapping doubles), so the sign
+of the result is always right for any double input while most calls cost
+a few multiplications.
+*/
+
+/* Function declaration */
+double ExactOrient2d(const svxPoint2 &a, const svxPoint2 &b, const svxPoint2 &c);
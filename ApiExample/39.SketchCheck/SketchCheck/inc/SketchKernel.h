@@ -0,0 +1,198 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+#pragma once
+
+/* ZW3D API includes */
+#include "zwapi_util.h"
+
+/* Application includes */
+#include <vector>
+#include "WorkPool.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define SKETCH_GRID_LOAD 2.0             /* grid cells per primitive */
+#define SKETCH_GRID_MAX_CELLS 64         /* primitives covering more cells are tested apart */
+#define SKETCH_CURVED_PIECES 8           /* pieces of a quarter of an ellipse in curved pair searches */
+#define SKETCH_NEWTON_STEPS 20           /* Newton steps of a curved intersection at most */
+#define SKETCH_MAX_POINTS 8              /* contact points of one pair at most */
+#define SKETCH_GRAIN 64                  /* grid cells taken at a time by a pool worker */
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: kind of a primitive */
+enum SketchPrimitiveKind
+{
+    Sketch_Line = 0,
+    Sketch_Arc = 1,          /* arc or circle */
+    Sketch_Ellipse = 2,      /* elliptic arc or ellipse */
+};
+
+/* DESCRIPTION: kind of a contact of two primitives */
+enum SketchContactKind
+{
+    Sketch_Cross = 0,        /* the primitives cross */
+    Sketch_Touch = 1,        /* tangency, or an end on the inside of the other primitive */
+    Sketch_Overlap = 2,      /* the primitives share a piece, "point" is one end of it */
+};
+
+/*
+DESCRIPTION:
+   Primitive of a sketch curve. Lines go from "start" to "end". Arcs and
+ellipses are center + major cos(a) axis + minor sin(a) axis', axis'
+being the axis turned by 90 degrees counter-clockwise, for a from
+"angle" to "angle" + "sweep" (radian, counter-clockwise).
+*/
+struct SketchPrimitive
+{
+    SketchPrimitiveKind kind;
+    int curve;               /* tag of the sketch curve */
+    int piece;               /* index along a polyline curve, 0 otherwise */
+    int pieces;              /* pieces of the curve */
+    int closed;              /* 1 for circles, ellipses and closed polylines */
+    int ends;                /* bit 0 if "start", bit 1 if "end" is an end of the curve */
+    svxPoint2 start, end;    /* end points */
+    svxPoint2 center;
+    svxPoint2 axis;          /* unit major axis */
+    double major, minor;     /* radii */
+    double angle, sweep;
+    svxPoint2 low, high;     /* box */
+};
+
+/* DESCRIPTION: contact of two primitives */
+struct SketchContact
+{
+    int primitive1, primitive2;
+    int curve1, curve2;           /* curve1 <= curve2 */
+    SketchContactKind kind;
+    svxPoint2 point;
+};
+
+/* DESCRIPTION: connection of the curve ends, as cvxSkInqCrvConnect() */
+struct SketchConnectivity
+{
+    int ends;                     /* ends of the open curves */
+    int unmatched;                /* ends meeting no other end */
+    int overmatched;              /* ends meeting more than one other end */
+    std::vector<svxPoint2> open;  /* unmatched ends */
+
+    int IsClosed(void) const { return unmatched == 0 && overmatched == 0; }
+};
+
+/*
+DESCRIPTION:
+   Uniform grid over boxes: the items covering each cell, stored cell
+after cell in one buffer. A box covering more than SKETCH_GRID_MAX_CELLS
+cells is not put in the cells but listed apart.
+*/
+class SketchGrid
+{
+public:
+    SketchGrid();
+
+    int Build(int count, const svxPoint2 *low, const svxPoint2 *high, double cell);
+    void CellRange(const svxPoint2 &low, const svxPoint2 &high, int range[4]) const;
+    int Cell(int x, int y) const { return y * m_columns + x; }
+    int CellCount(void) const { return m_columns * m_rows; }
+    int Columns(void) const { return m_columns; }
+    const int *Items(int cell, int *count) const;
+    const std::vector<int> &Large(void) const { return m_large; }
+
+private:
+    svxPoint2 m_origin;
+    double m_inverse;            /* 1 / cell size */
+    int m_columns, m_rows;
+    std::vector<int> m_offsets;  /* cell count + 1 entries */
+    std::vector<int> m_items;
+    std::vector<int> m_large;    /* items covering too many cells */
+};
+
+/*
+DESCRIPTION:
+   Host-independent 2D kernel answering the overlap and connection
+questions of cvxSkInqOverlap() and cvxSkInqCrvConnect() for a whole
+sketch at once, and finding where its curves cross.
+
+   Lines, arcs, circles and elliptic arcs are kept exactly; other curves
+are added as polylines, a piece per segment. Build() puts the primitive
+boxes, grown by the tolerance, into a uniform grid. Intersect() visits
+the pairs of primitives sharing a cell, each pair in the one cell
+holding the low corner of the common part of their boxes, so a pair is
+tested once without a hash of visited pairs.
+
+   Line pairs within the tolerance of each other are collinear and
+overlap, and an end within the tolerance of the other line touches it,
+as for curved pairs; the other crossings are decided by the exact
+orientation predicate (ExactPredicates.h) and do not depend on rounding,
+only the position of the crossing point does. Pairs
+with an arc are solved in closed form and pairs of curved primitives
+with an ellipse by Newton steps from the pieces whose boxes meet; they
+use the tolerance to tell a tangency from a miss. Contacts at the ends
+of both primitives are connections, not contacts.
+
+   Connect() and Intersect() run on a WorkPool. The kernel is immutable
+after Build() and may be shared by threads.
+*/
+class SketchKernel
+{
+public:
+    SketchKernel();
+
+    int AddLine(int curve, const svxPoint2 &start, const svxPoint2 &end);
+    int AddArc(int curve, const svxPoint2 &center, double radius, double startAngle, double endAngle);
+    int AddCircle(int curve, const svxPoint2 &center, double radius);
+    int AddEllipse(int curve, const svxPoint2 &center, const svxPoint2 &axis, double major, double minor,
+        double startAngle, double endAngle);
+    int AddPolyline(int curve, int count, const svxPoint2 *points);
+    int Build(double tolerance);
+    void Clear(void);
+
+    int Connect(WorkPool *pool, SketchConnectivity *connectivity) const;
+    int Intersect(WorkPool *pool, std::vector<SketchContact> *contacts) const;
+
+    int Count(void) const { return (int)m_primitives.size(); }
+    const SketchPrimitive &Primitive(int primitive) const { return m_primitives[primitive]; }
+    const SketchGrid &Grid(void) const { return m_grid; }
+
+private:
+    /* contact points of one pair */
+    struct Points
+    {
+        int count;
+        svxPoint2 point[SKETCH_MAX_POINTS];
+    };
+
+    /* data of a running Connect() or Intersect() */
+    struct Batch
+    {
+        const SketchKernel *self;
+        std::vector<std::vector<SketchContact>> *contacts;   /* one per worker */
+        std::vector<int> *matches;                           /* other ends met, per end */
+    };
+
+    static void PairRun(void *data, int begin, int end, int worker);
+    static void EndRun(void *data, int begin, int end, int worker);
+    void PairTest(int i, int j, std::vector<SketchContact> &contacts) const;
+    void PointAdd(const svxPoint2 &point, Points *points) const;
+    void LineLine(const SketchPrimitive &a, const SketchPrimitive &b, Points *points, int *overlap) const;
+    void LineCurve(const SketchPrimitive &line, const SketchPrimitive &curve, Points *points) const;
+    int CarrierShared(const SketchPrimitive &a, const SketchPrimitive &b, Points *points, int *overlap) const;
+    void ArcArc(const SketchPrimitive &a, const SketchPrimitive &b, Points *points) const;
+    void CurveCurve(const SketchPrimitive &a, const SketchPrimitive &b, Points *points) const;
+    int OnPrimitive(const SketchPrimitive &primitive, const svxPoint2 &point) const;
+    int AtEnd(const SketchPrimitive &primitive, const svxPoint2 &point) const;
+    svxPoint2 Tangent(const SketchPrimitive &primitive, const svxPoint2 &point) const;
+    int Push(SketchPrimitive &primitive);
+
+    double m_tolerance;
+    std::vector<SketchPrimitive> m_primitives;
+    std::vector<svxPoint2> m_ends;            /* ends of the open curves */
+    std::vector<char> m_large;                /* 1 for primitives listed apart by the grid */
+    SketchGrid m_grid;
+    SketchGrid m_endGrid;
+};
+
+/* Function declaration */
+void SketchEvaluate(const SketchPrimitive &primitive, double t, svxPoint2 *point, svxPoint2 *derivative);
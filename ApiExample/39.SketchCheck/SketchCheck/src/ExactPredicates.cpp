@@ -0,0 +1,190 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* Application includes */
+#include <math.h>
+#include <float.h>
+#include "ExactPredicates.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define EXACT_EPSILON (0.5 * DBL_EPSILON)                                          /* 2^-53 */
+#define EXACT_ORIENT_BOUND ((3.0 + 16.0 * EXACT_EPSILON) * EXACT_EPSILON)      /* error bound of the filter */
+#define EXACT_ORIENT_TERMS 16                                                  /* terms of the exact determinant */
+
+/*******************************************************************/
+/* Function declarations */
+static void TwoSum(double a, double b, double *sum, double *error);
+static void TwoProduct(double a, double b, double *product, double *error);
+static int ExpansionGrow(int count, const double *e, double b, double *h);
+static double Orient2dExact(const svxPoint2 &a, const svxPoint2 &b, const svxPoint2 &c);
+
+/*******************************************************************/
+/* Function definition */
+void TwoSum
+(
+double a,         /* I: term */
+double b,         /* I: term */
+double *sum,      /* O: rounded sum */
+double *error     /* O: rounding error, a + b = sum + error exactly */
+)
+/*
+DESCRIPTION:
+   Exact sum of two doubles (Knuth).
+*/
+{
+    const double s = a + b;
+    const double bVirtual = s - a;
+    const double aVirtual = s - bVirtual;
+    *sum = s;
+    *error = (a - aVirtual) + (b - bVirtual);
+}
+
+/*******************************************************************/
+/* Function definition */
+void TwoProduct
+(
+double a,          /* I: factor */
+double b,          /* I: factor */
+double *product,   /* O: rounded product */
+double *error      /* O: rounding error, a * b = product + error exactly */
+)
+/*
+DESCRIPTION:
+   Exact product of two doubles, the error given by a fused
+multiply-add.
+*/
+{
+    *product = a * b;
+    *error = fma(a, b, -*product);
+}
+
+/*******************************************************************/
+/* Function definition */
+int ExpansionGrow
+(
+int count,          /* I: components of the expansion */
+const double *e,    /* I: expansion, increasing magnitude */
+double b,           /* I: double to add */
+double *h           /* O: expansion of the sum, count + 1 components at most */
+)
+/*
+DESCRIPTION:
+   Add a double to a non-overlapping expansion (Shewchuk's
+Grow-Expansion), dropping zero components.
+
+   Return the number of components of the sum.
+*/
+{
+    double q = b;
+    int n = 0;
+    for (int i = 0; i < count; i++)
+    {
+        double error;
+        TwoSum(q, e[i], &q, &error);
+        if (error != 0.0)
+            h[n++] = error;
+    }
+    if (q != 0.0 || n == 0)
+        h[n++] = q;
+    return n;
+}
+
+/*******************************************************************/
+/* Function definition */
+double Orient2dExact
+(
+const svxPoint2 &a,   /* I: point */
+const svxPoint2 &b,   /* I: point */
+const svxPoint2 &c    /* I: point */
+)
+/*
+DESCRIPTION:
+   Exact (ax - cx)(by - cy) - (ay - cy)(bx - cx): the differences are
+split into exact pairs, the sixteen products of their parts into exact
+pairs, and all of them summed into one expansion.
+
+   Return the largest component of the determinant, of the exact sign.
+*/
+{
+    double acx[2], acy[2], bcx[2], bcy[2];
+    TwoSum(a.x, -c.x, &acx[1], &acx[0]);
+    TwoSum(a.y, -c.y, &acy[1], &acy[0]);
+    TwoSum(b.x, -c.x, &bcx[1], &bcx[0]);
+    TwoSum(b.y, -c.y, &bcy[1], &bcy[0]);
+
+    double terms[2 * EXACT_ORIENT_TERMS];
+    int n = 0;
+    for (int i = 0; i < 2; i++)
+    {
+        for (int j = 0; j < 2; j++)
+        {
+            TwoProduct(acx[i], bcy[j], &terms[n], &terms[n + 1]);
+            n += 2;
+            TwoProduct(-acy[i], bcx[j], &terms[n], &terms[n + 1]);
+            n += 2;
+        }
+    }
+
+    double sum[2 * EXACT_ORIENT_TERMS + 1], next[2 * EXACT_ORIENT_TERMS + 1];
+    int count = 0;
+    for (int i = 0; i < n; i++)
+    {
+        if (terms[i] == 0.0)
+            continue;
+        const int grown = ExpansionGrow(count, sum, terms[i], next);
+        for (int k = 0; k < grown; k++)
+            sum[k] = next[k];
+        count = grown;
+    }
+    for (int k = count - 1; k >= 0; k--)
+    {
+        if (sum[k] != 0.0)
+            return sum[k];
+    }
+    return 0.0;
+}
+
+/*******************************************************************/
+/* Function definition */
+double ExactOrient2d
+(
+const svxPoint2 &a,   /* I: first point of the line */
+const svxPoint2 &b,   /* I: second point of the line */
+const svxPoint2 &c    /* I: point tested */
+)
+/*
+DESCRIPTION:
+   Orientation of three points: positive if a, b, c turn counter-clockwise
+(c is left of the line from a to b), negative if clockwise, zero if they
+are collinear. The sign is exact; the value is about twice the signed
+area of the triangle.
+*/
+{
+    const double left = (a.x - c.x) * (b.y - c.y);
+    const double right = (a.y - c.y) * (b.x - c.x);
+    const double det = left - right;
+
+    double sum;
+    if (left > 0.0)
+    {
+        if (right <= 0.0)
+            return det;
+        sum = left + right;
+    }
+    else if (left < 0.0)
+    {
+        if (right >= 0.0)
+            return det;
+        sum = -left - right;
+    }
+    else
+        return det;
+
+    const double bound = EXACT_ORIENT_BOUND * sum;
+    if (det >= bound || -det >= bound)
+        return det;
+    return Orient2dExact(a, b, c);
+}
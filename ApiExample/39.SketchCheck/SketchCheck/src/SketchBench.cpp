@@ -0,0 +1,220 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <chrono>
+#include <random>
+#include <vector>
+#include "SketchKernel.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define BENCH_TOLERANCE 1.0e-6       /* point tolerance of the checks */
+#define BENCH_LINES 20000            /* default of the lines of the random sketch */
+#define BENCH_RANDOM_PAIRS 1000      /* random pairs of each degenerate check */
+#define BENCH_NO_CONTACT -1          /* expected kind of a pair without contact */
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: pair of lines and its expected contact */
+struct LinePair
+{
+    const char *name;
+    svxPoint2 a0, a1, b0, b1;
+    int kind;                    /* SketchContactKind, or BENCH_NO_CONTACT */
+};
+
+/*******************************************************************/
+/* Function declarations */
+static double Seconds(std::chrono::steady_clock::time_point start);
+static int PairContact(const svxPoint2 &a0, const svxPoint2 &a1, const svxPoint2 &b0, const svxPoint2 &b1, int *kind);
+static int PairCheck(const LinePair &pair);
+static int RandomCheck(std::mt19937 &random);
+
+/*******************************************************************/
+/* Function definition */
+double Seconds
+(
+std::chrono::steady_clock::time_point start   /* I: start time */
+)
+/*
+DESCRIPTION:
+   Seconds elapsed since "start".
+*/
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*******************************************************************/
+/* Function definition */
+int PairContact
+(
+const svxPoint2 &a0,   /* I: start of line 1 */
+const svxPoint2 &a1,   /* I: end of line 1 */
+const svxPoint2 &b0,   /* I: start of line 2 */
+const svxPoint2 &b1,   /* I: end of line 2 */
+int *kind              /* O: kind of the contact, BENCH_NO_CONTACT if none */
+)
+/*
+DESCRIPTION:
+   Contacts of two lines with BENCH_TOLERANCE.
+
+   Return the number of contacts.
+*/
+{
+    SketchKernel kernel;
+    kernel.AddLine(1, a0, a1);
+    kernel.AddLine(2, b0, b1);
+    kernel.Build(BENCH_TOLERANCE);
+    std::vector<SketchContact> contacts;
+    kernel.Intersect(nullptr, &contacts);
+    *kind = contacts.empty() ? BENCH_NO_CONTACT : contacts[0].kind;
+    return (int)contacts.size();
+}
+
+/*******************************************************************/
+/* Function definition */
+int PairCheck
+(
+const LinePair &pair   /* I: pair and its expected contact */
+)
+/*
+DESCRIPTION:
+   Check the contact of a pair of lines, both ways.
+
+   Return 1 if the contact is not the expected one, else 0.
+*/
+{
+    static const char *names[] = { "none", "cross", "touch", "overlap" };
+    const int expected = pair.kind == BENCH_NO_CONTACT ? 0 : 1;
+    int kind1, kind2;
+    const int count1 = PairContact(pair.a0, pair.a1, pair.b0, pair.b1, &kind1);
+    const int count2 = PairContact(pair.b1, pair.b0, pair.a0, pair.a1, &kind2);
+    const int failed = count1 != expected || count2 != expected || kind1 != pair.kind || kind2 != pair.kind;
+    printf("%-48s %-8s %s\n", pair.name, names[kind1 + 1], failed ? "FAILED" : "passed");
+    if (failed)
+        printf("check failed: %s, %d and %d contacts of kinds %s and %s, expected %s\n", pair.name, count1, count2,
+            names[kind1 + 1], names[kind2 + 1], names[pair.kind + 1]);
+    return failed;
+}
+
+/*******************************************************************/
+/* Function definition */
+int RandomCheck
+(
+std::mt19937 &random   /* I/O: random numbers */
+)
+/*
+DESCRIPTION:
+   Check random lines against a sub-segment computed on them, which is
+off their carrier by the rounding, and against a line ending at a point
+computed on them: the first must overlap, the second touch. The first
+failures are printed.
+
+   Return the number of failed pairs.
+*/
+{
+    std::uniform_real_distribution<double> coordinate(-100.0, 100.0), unit(0.05, 0.95);
+    int failures = 0, kind;
+    for (int i = 0; i < BENCH_RANDOM_PAIRS; i++)
+    {
+        const svxPoint2 a0 = { coordinate(random), coordinate(random) }, a1 = { coordinate(random), coordinate(random) };
+        const svxPoint2 d = { a1.x - a0.x, a1.y - a0.y };
+        double t0 = unit(random), t1 = unit(random);
+        if (fabs(t1 - t0) < 0.01)
+            t1 = t0 < 0.5 ? t0 + 0.01 : t0 - 0.01;
+        const svxPoint2 b0 = { a0.x + t0 * d.x, a0.y + t0 * d.y }, b1 = { a0.x + t1 * d.x, a0.y + t1 * d.y };
+        if (PairContact(a0, a1, b0, b1, &kind) != 1 || kind != Sketch_Overlap)
+        {
+            if (failures++ < 10)
+                printf("check failed: sub-segment %d, %s\n", i, kind == BENCH_NO_CONTACT ? "no contact" : "not an overlap");
+        }
+        const svxPoint2 b2 = { b0.x - d.y, b0.y + d.x };
+        if (PairContact(a0, a1, b2, b0, &kind) != 1 || kind != Sketch_Touch)
+        {
+            if (failures++ < 10)
+                printf("check failed: T-junction %d, %s\n", i, kind == BENCH_NO_CONTACT ? "no contact" : "not a touch");
+        }
+    }
+    printf("%-48s %s\n", "random sub-segments and T-junctions", failures ? "FAILED" : "passed");
+    return failures;
+}
+
+/*******************************************************************/
+/* Function definition */
+int main
+(
+int argc,      /* I: number of arguments */
+char **argv    /* I: [lines] */
+)
+/*
+DESCRIPTION:
+   Check the contacts of nearly degenerate pairs of lines with the point
+tolerance, then time the contacts of a random sketch on one thread and
+on the pool and check that they agree.
+
+   Return 1 if a check fails, else 0.
+*/
+{
+    const LinePair pairs[] = {
+        { "crossing", { 0.0, 0.0 }, { 10.0, 0.0 }, { 5.0, -1.0 }, { 5.0, 1.0 }, Sketch_Cross },
+        { "T-junction", { 0.0, 0.0 }, { 10.0, 0.0 }, { 5.0, 1.0 }, { 5.0, 0.0 }, Sketch_Touch },
+        { "T-junction 1e-9 short of the line", { 0.0, 0.0 }, { 10.0, 0.0 }, { 5.0, 1.0 }, { 5.0, 1.0e-9 }, Sketch_Touch },
+        { "T-junction 1e-9 past the line", { 0.0, 0.0 }, { 10.0, 0.0 }, { 5.0, 1.0 }, { 5.0, -1.0e-9 }, Sketch_Touch },
+        { "T-junction 1e-3 short of the line", { 0.0, 0.0 }, { 10.0, 0.0 }, { 5.0, 1.0 }, { 5.0, 1.0e-3 },
+            BENCH_NO_CONTACT },
+        { "parallel lines overlapping 1e-7 apart", { 0.0, 0.0 }, { 10.0, 0.0 }, { 5.0, 1.0e-7 }, { 15.0, 1.0e-7 },
+            Sketch_Overlap },
+        { "parallel lines overlapping 1e-5 apart", { 0.0, 0.0 }, { 10.0, 0.0 }, { 5.0, 1.0e-5 }, { 15.0, 1.0e-5 },
+            BENCH_NO_CONTACT },
+        { "lines crossing within 1e-7 of each other", { 0.0, -1.0e-7 }, { 10.0, 1.0e-7 }, { 0.0, 1.0e-7 },
+            { 10.0, -1.0e-7 }, Sketch_Overlap },
+        { "sub-segment computed on another line", { 0.1, 0.3 }, { 7.3, 2.9 }, { 0.1 + 0.3 * 7.2, 0.3 + 0.3 * 2.6 },
+            { 0.1 + 0.7 * 7.2, 0.3 + 0.7 * 2.6 }, Sketch_Overlap },
+        { "collinear lines end to end", { 0.0, 0.0 }, { 5.0, 0.0 }, { 5.0, 0.0 }, { 10.0, 0.0 }, BENCH_NO_CONTACT },
+        { "collinear lines 1e-9 apart end to end", { 0.0, 0.0 }, { 5.0, 0.0 }, { 5.0 + 1.0e-9, 1.0e-9 }, { 10.0, 0.0 },
+            BENCH_NO_CONTACT },
+        { "collinear lines with a gap", { 0.0, 0.0 }, { 5.0, 0.0 }, { 5.001, 0.0 }, { 10.0, 0.0 }, BENCH_NO_CONTACT },
+        { "corner 1e-9 apart", { 0.0, 0.0 }, { 5.0, 0.0 }, { 5.0 + 1.0e-9, 1.0e-9 }, { 5.0, 5.0 }, BENCH_NO_CONTACT },
+    };
+    int failures = 0;
+    for (const LinePair &pair : pairs)
+        failures += PairCheck(pair);
+    std::mt19937 random(11);
+    failures += RandomCheck(random);
+
+    /* random sketch of short lines */
+    const int lines = argc > 1 && atoi(argv[1]) > 0 ? atoi(argv[1]) : BENCH_LINES;
+    std::uniform_real_distribution<double> coordinate(0.0, 1000.0), step(-10.0, 10.0);
+    SketchKernel kernel;
+    for (int i = 0; i < lines; i++)
+    {
+        const svxPoint2 start = { coordinate(random), coordinate(random) };
+        const svxPoint2 end = { start.x + step(random), start.y + step(random) };
+        kernel.AddLine(i, start, end);
+    }
+    kernel.Build(BENCH_TOLERANCE);
+    WorkPool pool;
+    std::vector<SketchContact> single, pooled;
+    auto start = std::chrono::steady_clock::now();
+    kernel.Intersect(nullptr, &single);
+    const double singleTime = Seconds(start);
+    start = std::chrono::steady_clock::now();
+    kernel.Intersect(&pool, &pooled);
+    const double poolTime = Seconds(start);
+    int differ = single.size() != pooled.size();
+    for (size_t k = 0; k < single.size() && !differ; k++)
+        differ = single[k].curve1 != pooled[k].curve1 || single[k].curve2 != pooled[k].curve2 ||
+            single[k].kind != pooled[k].kind;
+    printf("random sketch (%d lines, %d contacts): one thread %.3f ms, pool of %d %.3f ms, %s\n", lines,
+        (int)single.size(), singleTime * 1e3, pool.ThreadCount(), poolTime * 1e3, differ ? "FAILED" : "passed");
+    failures += differ;
+
+    printf("checks: %s\n", failures ? "FAILED" : "passed");
+    return failures ? 1 : 0;
+}
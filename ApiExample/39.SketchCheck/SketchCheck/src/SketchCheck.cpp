@@ -0,0 +1,385 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* ZW3D API includes */
+#include "zwapi_curve.h"
+#include "zwapi_entity.h"
+#include "zwapi_memory.h"
+#include "zwapi_sketch_general.h"
+#include "zwapi_sk_objs.h"
+#include "zwapi_userinput.h"
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+#include "..\inc\SketchCheckPr.h"
+#include "..\inc\SketchKernel.h"
+#include "CurveTessellator.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define MESSAGE_SIZE 256
+#define SKETCH_PI 3.14159265358979323846
+#define DEFAULT_TOLERANCE 1.0e-4     /* default distance below which points are the same */
+#define DEFAULT_CHORD 1.0e-3         /* default chord tolerance of NURBS curves */
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: curves of the active sketch and their primitives */
+struct SketchSet
+{
+    int count;
+    szwEntityHandle *curves;
+    std::vector<int> ids;
+    int nurbs;                    /* curves added as polylines */
+    SketchKernel kernel;          /* primitive curve tags are indexes in "curves" */
+};
+
+/*******************************************************************/
+/* Function declarations */
+static int SketchCheck(void);
+static int SketchLoad(double chord, SketchSet *set);
+static int CurveAdd(int curve, const szwCurve &data, double chord, SketchSet *set);
+static void ContactsCount(const std::vector<SketchContact> &contacts, int counts[3], int *overlapPairs);
+static void HostCheck(SketchSet &set, const SketchConnectivity &connectivity, int overlapPairs);
+static double Seconds(std::chrono::steady_clock::time_point start);
+
+/*******************************************************************/
+/* Function definition */
+int RegisterSketchCheck
+(
+void
+)
+/*
+DESCRIPTION:
+   Register the commands of the sketch check example.
+*/
+{
+    /* Check the crossings, overlaps and open ends of the active sketch by entering "~SketchCheck" */
+    ZwCommandFunctionLoad("SketchCheck", (void *)SketchCheck, ZW_LICENSE_CODE_GENERAL);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int UnloadSketchCheck
+(
+void
+)
+/*
+DESCRIPTION:
+   Unload the commands of the sketch check example.
+*/
+{
+    ZwCommandFunctionUnload("SketchCheck");
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+double Seconds
+(
+std::chrono::steady_clock::time_point start   /* I: start time */
+)
+/*
+DESCRIPTION:
+   Seconds elapsed since "start".
+*/
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*******************************************************************/
+/* Function definition */
+int CurveAdd
+(
+int curve,               /* I: index of the curve */
+const szwCurve &data,    /* I: curve data read with ZwCurveNURBSDataGet() */
+double chord,            /* I: chord tolerance of NURBS curves */
+SketchSet *set           /* I/O: the primitives of the curve are added */
+)
+/*
+DESCRIPTION:
+   Add the primitives of a sketch curve, in the X and Y of the sketch.
+Lines, arcs, circles and ellipses are added exactly, the arc angles
+taken from its end points; NURBS curves are tessellated within the chord
+tolerance (CurveTessellator.h) and added as polylines.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    const auto &info = data.curveInformation;
+    SketchKernel &kernel = set->kernel;
+    switch (data.type)
+    {
+    case ZW_CURVE_LINE:
+    {
+        const svxPoint2 start = { info.line.startPoint.x, info.line.startPoint.y };
+        const svxPoint2 end = { info.line.endPoint.x, info.line.endPoint.y };
+        return kernel.AddLine(curve, start, end) < 0;
+    }
+
+    case ZW_CURVE_ARC:
+    {
+        const svxPoint2 center = { info.arc.centerPoint.x, info.arc.centerPoint.y };
+        const double startAngle = atan2(info.arc.startPoint.y - center.y, info.arc.startPoint.x - center.x);
+        const double endAngle = atan2(info.arc.endPoint.y - center.y, info.arc.endPoint.x - center.x);
+        return kernel.AddArc(curve, center, info.arc.radius, startAngle * 180.0 / SKETCH_PI,
+            endAngle * 180.0 / SKETCH_PI) < 0;
+    }
+
+    case ZW_CURVE_CIRCLE:
+    {
+        const svxPoint2 center = { info.circle.centerPoint.x, info.circle.centerPoint.y };
+        return kernel.AddCircle(curve, center, info.circle.radius) < 0;
+    }
+
+    case ZW_CURVE_ELLIPSE2:
+    {
+        const svxPoint2 center = { info.ellipse2.centerPoint.x, info.ellipse2.centerPoint.y };
+        const svxPoint2 axis = { info.ellipse2.majorAxisDirection.x, info.ellipse2.majorAxisDirection.y };
+        return kernel.AddEllipse(curve, center, axis, info.ellipse2.majorAxis, info.ellipse2.minorAxis,
+            info.ellipse2.startAngle, info.ellipse2.endAngle) < 0;
+    }
+
+    case ZW_CURVE_NURB:
+    {
+        /* the NURBS data is shared, not copied: the tessellator copies it */
+        svxCurve nurbs{};
+        nurbs.Type = VX_CRV_NURB;
+        nurbs.Frame.identity = 1;
+        nurbs.T.closed = data.parameter.closed;
+        nurbs.T.degree = data.parameter.degree;
+        nurbs.T.num_knots = data.parameter.numberKnots;
+        nurbs.T.bnd.min = data.parameter.boundary.min;
+        nurbs.T.bnd.max = data.parameter.boundary.max;
+        nurbs.T.knots = data.parameter.knots;
+        nurbs.P.rat = data.controlPoint.rational;
+        nurbs.P.dim = data.controlPoint.numberCoordinate;
+        nurbs.P.plane = data.controlPoint.plane;
+        nurbs.P.num_cp = data.controlPoint.numberControlPoint;
+        nurbs.P.coord = data.controlPoint.controlPointCoordinate;
+
+        CurveTessellator tessellator;
+        const CurveTessTolerance tolerance = { chord, 0.0 };
+        std::vector<svxPoint> points;
+        if (tessellator.Add(nurbs) < 0 || tessellator.TessellateCurve(0, tolerance, points))
+            return 1;
+        std::vector<svxPoint2> polyline(points.size());
+        for (size_t i = 0; i < points.size(); i++)
+        {
+            polyline[i].x = points[i].x;
+            polyline[i].y = points[i].y;
+        }
+        set->nurbs++;
+        return kernel.AddPolyline(curve, (int)polyline.size(), polyline.data()) < 0;
+    }
+
+    default:
+        return 1;
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+int SketchLoad
+(
+double chord,     /* I: chord tolerance of NURBS curves */
+SketchSet *set    /* O: curves of the active sketch, free set->curves with ZwEntityHandleListFree() */
+)
+/*
+DESCRIPTION:
+   Read the curves of the active sketch with ZwCurveNURBSDataGet() and
+add their primitives to the kernel.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    set->count = 0;
+    set->curves = nullptr;
+    set->nurbs = 0;
+    if (ZwSketch2DCurveListGet(nullptr, &set->count, &set->curves) || set->count < 1)
+    {
+        cvxMsgDisp("No curve in the active sketch");
+        return 1;
+    }
+
+    set->ids.assign(set->count, 0);
+    if (ZwEntityIdGet(set->count, set->curves, set->ids.data()))
+        return 1;
+    for (int i = 0; i < set->count; i++)
+    {
+        szwCurve data{};
+        if (ZwCurveNURBSDataGet(set->curves[i], 0, &data))
+            return 1;
+        const int failed = CurveAdd(i, data, chord, set);
+        ZwCurveFree(&data);
+        if (failed)
+        {
+            char message[MESSAGE_SIZE];
+            sprintf_s(message, MESSAGE_SIZE, "Curve %d (id %d) is not supported", i + 1, set->ids[i]);
+            cvxMsgDisp(message);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void ContactsCount
+(
+const std::vector<SketchContact> &contacts,   /* I: contacts sorted by curves */
+int counts[3],                                /* O: contacts of every SketchContactKind */
+int *overlapPairs                             /* O: pairs of curves overlapping */
+)
+/*
+DESCRIPTION:
+   Count the contacts by kind, and the pairs of curves with an overlap as
+cvxSkInqOverlap() lists them.
+*/
+{
+    counts[0] = counts[1] = counts[2] = 0;
+    *overlapPairs = 0;
+    const SketchContact *last = nullptr;
+    for (const SketchContact &contact : contacts)
+    {
+        counts[contact.kind]++;
+        if (contact.kind != Sketch_Overlap)
+            continue;
+        if (last == nullptr || last->curve1 != contact.curve1 || last->curve2 != contact.curve2)
+            (*overlapPairs)++;
+        last = &contact;
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+void HostCheck
+(
+SketchSet &set,                              /* I: curves */
+const SketchConnectivity &connectivity,      /* I: connection found by the kernel */
+int overlapPairs                             /* I: overlapping pairs found by the kernel */
+)
+/*
+DESCRIPTION:
+   Ask the host the same questions, with cvxSkInqCrvConnect() and
+cvxSkInqOverlap(), and report its answers and times.
+*/
+{
+    char message[MESSAGE_SIZE];
+    int unmatched = 0, overmatched = 0;
+    auto start = std::chrono::steady_clock::now();
+    const int connectFailed = cvxSkInqCrvConnect(set.count, set.ids.data(), &unmatched, &overmatched) ? 1 : 0;
+    const double connectTime = Seconds(start);
+    if (connectFailed)
+        cvxMsgDisp("Host: cvxSkInqCrvConnect failed");
+    else
+    {
+        sprintf_s(message, MESSAGE_SIZE, "Host: %d unmatched, %d over-matched ends in %.3f s, same result: %s",
+            unmatched, overmatched, connectTime, unmatched == connectivity.unmatched &&
+            overmatched == connectivity.overmatched ? "yes" : "no");
+        cvxMsgDisp(message);
+    }
+
+    int groups = 0;
+    svxSkOverlapGeom *overlaps = nullptr;
+    start = std::chrono::steady_clock::now();
+    const int overlapFailed = cvxSkInqOverlap(&groups, &overlaps) ? 1 : 0;
+    const double overlapTime = Seconds(start);
+    if (overlapFailed)
+        cvxMsgDisp("Host: cvxSkInqOverlap failed");
+    else
+    {
+        sprintf_s(message, MESSAGE_SIZE, "Host: %d overlapping pairs in %.3f s, same count: %s", groups,
+            overlapTime, groups == overlapPairs ? "yes" : "no");
+        cvxMsgDisp(message);
+    }
+    if (overlaps != nullptr)
+        ZwMemoryFree((void **)&overlaps);
+}
+
+/*******************************************************************/
+/* Function definition */
+int SketchCheck
+(
+void
+)
+/*
+DESCRIPTION:
+   Load the curves of the active sketch into the kernel, find their
+crossings, touches, overlaps and open ends on one thread and on the
+pool, and check the open ends and the overlaps with the host.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    double tolerance = DEFAULT_TOLERANCE, chord = DEFAULT_CHORD;
+    if (cvxGetNumber("Point tolerance", &tolerance) || !(tolerance > 0.0))
+        tolerance = DEFAULT_TOLERANCE;
+    if (cvxGetNumber("Chord tolerance of NURBS curves", &chord) || !(chord > 0.0))
+        chord = DEFAULT_CHORD;
+
+    SketchSet set;
+    auto start = std::chrono::steady_clock::now();
+    int failed = SketchLoad(chord, &set) || set.kernel.Build(tolerance);
+    const double loadTime = Seconds(start);
+    if (failed)
+    {
+        ZwEntityHandleListFree(set.count, &set.curves);
+        return 1;
+    }
+
+    std::vector<SketchContact> serial, pooled;
+    SketchConnectivity connectivity, pooledConnectivity;
+    start = std::chrono::steady_clock::now();
+    set.kernel.Intersect(nullptr, &serial);
+    set.kernel.Connect(nullptr, &connectivity);
+    const double serialTime = Seconds(start);
+    WorkPool pool;
+    start = std::chrono::steady_clock::now();
+    set.kernel.Intersect(&pool, &pooled);
+    set.kernel.Connect(&pool, &pooledConnectivity);
+    const double poolTime = Seconds(start);
+
+    int same = serial.size() == pooled.size() && connectivity.unmatched == pooledConnectivity.unmatched &&
+        connectivity.overmatched == pooledConnectivity.overmatched;
+    for (size_t i = 0; same && i < serial.size(); i++)
+    {
+        same = serial[i].primitive1 == pooled[i].primitive1 && serial[i].primitive2 == pooled[i].primitive2 &&
+            serial[i].kind == pooled[i].kind;
+    }
+
+    int counts[3], overlapPairs = 0;
+    ContactsCount(serial, counts, &overlapPairs);
+    char message[MESSAGE_SIZE];
+    sprintf_s(message, MESSAGE_SIZE, "%d curves (%d NURBS), %d primitives, %d grid cells", set.count, set.nurbs,
+        set.kernel.Count(), set.kernel.Grid().CellCount());
+    cvxMsgDisp(message);
+    sprintf_s(message, MESSAGE_SIZE, "%d crossings, %d touches, %d overlaps (%d pairs of curves), %d of %d ends "
+        "unmatched, %d over-matched", counts[Sketch_Cross], counts[Sketch_Touch], counts[Sketch_Overlap],
+        overlapPairs, connectivity.unmatched, connectivity.ends, connectivity.overmatched);
+    cvxMsgDisp(message);
+    sprintf_s(message, MESSAGE_SIZE, "Local: read and build %.3f s, 1 thread %.3f s, %d threads %.3f s, same "
+        "result: %s", loadTime, serialTime, pool.ThreadCount(), poolTime, same ? "yes" : "no");
+    cvxMsgDisp(message);
+
+    for (const SketchContact &contact : serial)
+    {
+        if (contact.kind != Sketch_Cross)
+            continue;
+        sprintf_s(message, MESSAGE_SIZE, "First crossing: curves %d and %d at (%g, %g)", set.ids[contact.curve1],
+            set.ids[contact.curve2], contact.point.x, contact.point.y);
+        cvxMsgDisp(message);
+        break;
+    }
+
+    HostCheck(set, connectivity, overlapPairs);
+    ZwEntityHandleListFree(set.count, &set.curves);
+    return 0;
+}
@@ -0,0 +1,1230 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* Application includes */
+#include <math.h>
+#include <float.h>
+#include <algorithm>
+#include "SketchKernel.h"
+#include "ExactPredicates.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define SKETCH_PI 3.14159265358979323846
+#define SKETCH_PARALLEL 1.0e-9           /* sine of the angle below which tangents are parallel */
+#define SKETCH_END_GRAIN 256             /* ends taken at a time by a pool worker */
+
+/*******************************************************************/
+/* Function declarations */
+static double Dot(const svxPoint2 &a, const svxPoint2 &b);
+static double Cross(const svxPoint2 &a, const svxPoint2 &b);
+static double Distance2(const svxPoint2 &a, const svxPoint2 &b);
+static double SegmentDistance2(const svxPoint2 &point, const svxPoint2 &start, const svxPoint2 &end);
+static double AngleIn(double angle, double start, double sweep, double slack);
+static int ContactLess(const SketchContact &a, const SketchContact &b);
+
+/*******************************************************************/
+/* Function definition */
+double Dot
+(
+const svxPoint2 &a,   /* I: vector */
+const svxPoint2 &b    /* I: vector */
+)
+/*
+DESCRIPTION:
+   Dot product.
+*/
+{
+    return a.x * b.x + a.y * b.y;
+}
+
+/*******************************************************************/
+/* Function definition */
+double Cross
+(
+const svxPoint2 &a,   /* I: vector */
+const svxPoint2 &b    /* I: vector */
+)
+/*
+DESCRIPTION:
+   Cross product, positive if b is counter-clockwise from a.
+*/
+{
+    return a.x * b.y - a.y * b.x;
+}
+
+/*******************************************************************/
+/* Function definition */
+double Distance2
+(
+const svxPoint2 &a,   /* I: point */
+const svxPoint2 &b    /* I: point */
+)
+/*
+DESCRIPTION:
+   Squared distance of two points.
+*/
+{
+    const double x = a.x - b.x, y = a.y - b.y;
+    return x * x + y * y;
+}
+
+/*******************************************************************/
+/* Function definition */
+double SegmentDistance2
+(
+const svxPoint2 &point,   /* I: point */
+const svxPoint2 &start,   /* I: start of the segment */
+const svxPoint2 &end      /* I: end of the segment */
+)
+/*
+DESCRIPTION:
+   Squared distance of a point from a segment.
+*/
+{
+    const svxPoint2 d = { end.x - start.x, end.y - start.y }, q = { point.x - start.x, point.y - start.y };
+    const double dd = Dot(d, d);
+    double t = dd > 0.0 ? Dot(q, d) / dd : 0.0;
+    t = t < 0.0 ? 0.0 : (t > 1.0 ? 1.0 : t);
+    const svxPoint2 foot = { start.x + t * d.x, start.y + t * d.y };
+    return Distance2(point, foot);
+}
+
+/*******************************************************************/
+/* Function definition */
+double AngleIn
+(
+double angle,    /* I: angle (radian) */
+double start,    /* I: start of the range */
+double sweep,    /* I: counter-clockwise sweep of the range */
+double slack     /* I: angle allowed outside of the range */
+)
+/*
+DESCRIPTION:
+   Bring an angle into a range of angles, turning it by whole turns.
+
+   Return the angle in the range, clamped to it when it is within the
+slack outside of it, or HUGE_VAL if it is not in the range.
+*/
+{
+    double a = fmod(angle - start, 2.0 * SKETCH_PI);
+    a = a < 0.0 ? a + 2.0 * SKETCH_PI : a;
+    if (a <= sweep)
+        return start + a;
+    if (a <= sweep + slack)
+        return start + sweep;
+    if (a >= 2.0 * SKETCH_PI - slack)
+        return start;
+    return HUGE_VAL;
+}
+
+/*******************************************************************/
+/* Function definition */
+int ContactLess
+(
+const SketchContact &a,   /* I: contact */
+const SketchContact &b    /* I: contact */
+)
+/*
+DESCRIPTION:
+   Order of the contacts: by curves, then by point.
+*/
+{
+    if (a.curve1 != b.curve1)
+        return a.curve1 < b.curve1;
+    if (a.curve2 != b.curve2)
+        return a.curve2 < b.curve2;
+    if (a.point.x != b.point.x)
+        return a.point.x < b.point.x;
+    if (a.point.y != b.point.y)
+        return a.point.y < b.point.y;
+    if (a.primitive1 != b.primitive1)
+        return a.primitive1 < b.primitive1;
+    if (a.primitive2 != b.primitive2)
+        return a.primitive2 < b.primitive2;
+    return a.kind < b.kind;
+}
+
+/*******************************************************************/
+/* Function definition */
+void SketchEvaluate
+(
+const SketchPrimitive &primitive,   /* I: primitive */
+double t,                           /* I: 0 to 1 on lines, angle (radian) on arcs and ellipses */
+svxPoint2 *point,                   /* O: point */
+svxPoint2 *derivative               /* O: first derivative, nullptr to skip */
+)
+/*
+DESCRIPTION:
+   Evaluate a primitive.
+*/
+{
+    const SketchPrimitive &p = primitive;
+    if (p.kind == Sketch_Line)
+    {
+        const double dx = p.end.x - p.start.x, dy = p.end.y - p.start.y;
+        point->x = p.start.x + t * dx;
+        point->y = p.start.y + t * dy;
+        if (derivative != nullptr)
+        {
+            derivative->x = dx;
+            derivative->y = dy;
+        }
+        return;
+    }
+    const double c = cos(t), s = sin(t);
+    const double ax = p.major * c, ay = p.minor * s;
+    point->x = p.center.x + ax * p.axis.x - ay * p.axis.y;
+    point->y = p.center.y + ax * p.axis.y + ay * p.axis.x;
+    if (derivative != nullptr)
+    {
+        const double dx = -p.major * s, dy = p.minor * c;
+        derivative->x = dx * p.axis.x - dy * p.axis.y;
+        derivative->y = dx * p.axis.y + dy * p.axis.x;
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+SketchGrid::SketchGrid
+(
+)
+/*
+DESCRIPTION:
+   Create an empty grid.
+*/
+{
+    m_origin.x = m_origin.y = 0.0;
+    m_inverse = 1.0;
+    m_columns = m_rows = 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int SketchGrid::Build
+(
+int count,                /* I: number of boxes */
+const svxPoint2 *low,     /* I: low corners of the boxes */
+const svxPoint2 *high,    /* I: high corners of the boxes */
+double cell               /* I: cell size */
+)
+/*
+DESCRIPTION:
+   Put boxes into a grid of square cells covering all of them, by a
+counting sort of the items into the cells.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    m_columns = m_rows = 0;
+    m_offsets.assign(1, 0);
+    m_items.clear();
+    m_large.clear();
+    if (count < 0 || !(cell > 0.0))
+        return 1;
+    if (count == 0)
+        return 0;
+
+    svxPoint2 top = high[0];
+    m_origin = low[0];
+    for (int i = 1; i < count; i++)
+    {
+        m_origin.x = low[i].x < m_origin.x ? low[i].x : m_origin.x;
+        m_origin.y = low[i].y < m_origin.y ? low[i].y : m_origin.y;
+        top.x = high[i].x > top.x ? high[i].x : top.x;
+        top.y = high[i].y > top.y ? high[i].y : top.y;
+    }
+    m_inverse = 1.0 / cell;
+    m_columns = (int)((top.x - m_origin.x) * m_inverse) + 1;
+    m_rows = (int)((top.y - m_origin.y) * m_inverse) + 1;
+
+    /* count the items of every cell, then place them */
+    m_offsets.assign((size_t)CellCount() + 1, 0);
+    int range[4];
+    for (int i = 0; i < count; i++)
+    {
+        CellRange(low[i], high[i], range);
+        if ((range[2] - range[0] + 1) * (range[3] - range[1] + 1) > SKETCH_GRID_MAX_CELLS)
+            continue;
+        for (int y = range[1]; y <= range[3]; y++)
+        {
+            for (int x = range[0]; x <= range[2]; x++)
+                m_offsets[Cell(x, y) + 1]++;
+        }
+    }
+    for (int c = 0; c < CellCount(); c++)
+        m_offsets[c + 1] += m_offsets[c];
+    m_items.resize(m_offsets[CellCount()]);
+    std::vector<int> fill(m_offsets.begin(), m_offsets.end() - 1);
+    for (int i = 0; i < count; i++)
+    {
+        CellRange(low[i], high[i], range);
+        if ((range[2] - range[0] + 1) * (range[3] - range[1] + 1) > SKETCH_GRID_MAX_CELLS)
+        {
+            m_large.push_back(i);
+            continue;
+        }
+        for (int y = range[1]; y <= range[3]; y++)
+        {
+            for (int x = range[0]; x <= range[2]; x++)
+                m_items[fill[Cell(x, y)]++] = i;
+        }
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void SketchGrid::CellRange
+(
+const svxPoint2 &low,    /* I: low corner of a box */
+const svxPoint2 &high,   /* I: high corner of the box */
+int range[4]             /* O: first column, first row, last column, last row */
+) const
+/*
+DESCRIPTION:
+   Cells covered by a box, clamped to the grid.
+*/
+{
+    const double x0 = (low.x - m_origin.x) * m_inverse, y0 = (low.y - m_origin.y) * m_inverse;
+    const double x1 = (high.x - m_origin.x) * m_inverse, y1 = (high.y - m_origin.y) * m_inverse;
+    range[0] = x0 < 0.0 ? 0 : (x0 >= m_columns ? m_columns - 1 : (int)x0);
+    range[1] = y0 < 0.0 ? 0 : (y0 >= m_rows ? m_rows - 1 : (int)y0);
+    range[2] = x1 < 0.0 ? 0 : (x1 >= m_columns ? m_columns - 1 : (int)x1);
+    range[3] = y1 < 0.0 ? 0 : (y1 >= m_rows ? m_rows - 1 : (int)y1);
+}
+
+/*******************************************************************/
+/* Function definition */
+const int *SketchGrid::Items
+(
+int cell,     /* I: cell */
+int *count    /* O: number of items of the cell */
+) const
+/*
+DESCRIPTION:
+   Items covering a cell.
+*/
+{
+    *count = m_offsets[cell + 1] - m_offsets[cell];
+    return m_items.data() + m_offsets[cell];
+}
+
+/*******************************************************************/
+/* Function definition */
+SketchKernel::SketchKernel
+(
+)
+/*
+DESCRIPTION:
+   Create an empty kernel.
+*/
+{
+    m_tolerance = 0.0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void SketchKernel::Clear
+(
+void
+)
+/*
+DESCRIPTION:
+   Remove all primitives.
+*/
+{
+    m_tolerance = 0.0;
+    m_primitives.clear();
+    m_ends.clear();
+    m_large.clear();
+    m_grid = SketchGrid();
+    m_endGrid = SketchGrid();
+}
+
+/*******************************************************************/
+/* Function definition */
+int SketchKernel::Push
+(
+SketchPrimitive &primitive   /* I/O: primitive, its ends and box are set */
+)
+/*
+DESCRIPTION:
+   Set the ends and the box of a primitive and append it. The box of an
+arc or ellipse holds its ends and the extreme points of the ellipse that
+are on it.
+
+   Return the index of the primitive.
+*/
+{
+    SketchPrimitive &p = primitive;
+    if (p.kind != Sketch_Line)
+    {
+        SketchEvaluate(p, p.angle, &p.start, nullptr);
+        SketchEvaluate(p, p.angle + p.sweep, &p.end, nullptr);
+    }
+    p.low.x = std::min(p.start.x, p.end.x);
+    p.low.y = std::min(p.start.y, p.end.y);
+    p.high.x = std::max(p.start.x, p.end.x);
+    p.high.y = std::max(p.start.y, p.end.y);
+    if (p.kind != Sketch_Line)
+    {
+        /* x and y are extreme where their derivatives vanish */
+        const double extremes[2] = { atan2(-p.minor * p.axis.y, p.major * p.axis.x),
+            atan2(p.minor * p.axis.x, p.major * p.axis.y) };
+        for (int k = 0; k < 4; k++)
+        {
+            const double t = AngleIn(extremes[k / 2] + (k % 2) * SKETCH_PI, p.angle, p.sweep, 0.0);
+            if (t == HUGE_VAL)
+                continue;
+            svxPoint2 q;
+            SketchEvaluate(p, t, &q, nullptr);
+            p.low.x = std::min(p.low.x, q.x);
+            p.low.y = std::min(p.low.y, q.y);
+            p.high.x = std::max(p.high.x, q.x);
+            p.high.y = std::max(p.high.y, q.y);
+        }
+    }
+    if (p.ends & 1)
+        m_ends.push_back(p.start);
+    if (p.ends & 2)
+        m_ends.push_back(p.end);
+    m_primitives.push_back(p);
+    return (int)m_primitives.size() - 1;
+}
+
+/*******************************************************************/
+/* Function definition */
+int SketchKernel::AddLine
+(
+int curve,                 /* I: tag of the curve */
+const svxPoint2 &start,    /* I: start point */
+const svxPoint2 &end       /* I: end point */
+)
+/*
+DESCRIPTION:
+   Add a line.
+
+   Return the index of the primitive.
+*/
+{
+    SketchPrimitive p{};
+    p.kind = Sketch_Line;
+    p.curve = curve;
+    p.pieces = 1;
+    p.ends = 3;
+    p.start = start;
+    p.end = end;
+    p.axis.x = 1.0;
+    return Push(p);
+}
+
+/*******************************************************************/
+/* Function definition */
+int SketchKernel::AddEllipse
+(
+int curve,                  /* I: tag of the curve */
+const svxPoint2 &center,    /* I: center */
+const svxPoint2 &axis,      /* I: direction of the major axis */
+double major,               /* I: major radius */
+double minor,               /* I: minor radius */
+double startAngle,          /* I: start angle (degree) */
+double endAngle             /* I: end angle (degree), 360 after the start for a whole ellipse */
+)
+/*
+DESCRIPTION:
+   Add an elliptic arc, counter-clockwise from the start to the end angle.
+The angles are the parameters of the ellipse, measured from its major
+axis.
+
+   Return the index of the primitive, or -1 if the data is not valid.
+*/
+{
+    const double length = sqrt(axis.x * axis.x + axis.y * axis.y);
+    if (!(major > 0.0) || !(minor > 0.0) || !(length > 0.0))
+        return -1;
+    double sweep = endAngle - startAngle;
+    while (sweep <= 0.0)
+        sweep += 360.0;
+
+    SketchPrimitive p{};
+    p.kind = major == minor ? Sketch_Arc : Sketch_Ellipse;
+    p.curve = curve;
+    p.pieces = 1;
+    p.closed = sweep >= 360.0 ? 1 : 0;
+    p.ends = p.closed ? 0 : 3;
+    p.center = center;
+    p.axis.x = axis.x / length;
+    p.axis.y = axis.y / length;
+    p.major = major;
+    p.minor = minor;
+    p.angle = startAngle * SKETCH_PI / 180.0;
+    p.sweep = (sweep > 360.0 ? 360.0 : sweep) * SKETCH_PI / 180.0;
+    return Push(p);
+}
+
+/*******************************************************************/
+/* Function definition */
+int SketchKernel::AddArc
+(
+int curve,                  /* I: tag of the curve */
+const svxPoint2 &center,    /* I: center */
+double radius,              /* I: radius */
+double startAngle,          /* I: start angle (degree) from the X axis */
+double endAngle             /* I: end angle (degree) */
+)
+/*
+DESCRIPTION:
+   Add an arc, counter-clockwise from the start to the end angle.
+
+   Return the index of the primitive, or -1 if the data is not valid.
+*/
+{
+    const svxPoint2 axis = { 1.0, 0.0 };
+    return AddEllipse(curve, center, axis, radius, radius, startAngle, endAngle);
+}
+
+/*******************************************************************/
+/* Function definition */
+int SketchKernel::AddCircle
+(
+int curve,                  /* I: tag of the curve */
+const svxPoint2 &center,    /* I: center */
+double radius               /* I: radius */
+)
+/*
+DESCRIPTION:
+   Add a circle.
+
+   Return the index of the primitive, or -1 if the data is not valid.
+*/
+{
+    return AddArc(curve, center, radius, 0.0, 360.0);
+}
+
+/*******************************************************************/
+/* Function definition */
+int SketchKernel::AddPolyline
+(
+int curve,                 /* I: tag of the curve */
+int count,                 /* I: number of points, at least 2 */
+const svxPoint2 *points    /* I: points, the last equal to the first for a closed curve */
+)
+/*
+DESCRIPTION:
+   Add a curve given as a polyline, a line primitive per segment.
+
+   Return the index of the first primitive, or -1 if there are less than
+two points.
+*/
+{
+    if (count < 2 || points == nullptr)
+        return -1;
+    const int closed = count > 2 && points[0].x == points[count - 1].x && points[0].y == points[count - 1].y;
+    const int first = Count();
+    for (int i = 0; i + 1 < count; i++)
+    {
+        SketchPrimitive p{};
+        p.kind = Sketch_Line;
+        p.curve = curve;
+        p.piece = i;
+        p.pieces = count - 1;
+        p.closed = closed;
+        p.ends = closed ? 0 : (i == 0 ? 1 : 0) | (i + 2 == count ? 2 : 0);
+        p.start = points[i];
+        p.end = points[i + 1];
+        p.axis.x = 1.0;
+        Push(p);
+    }
+    return first;
+}
+
+/*******************************************************************/
+/* Function definition */
+int SketchKernel::Build
+(
+double tolerance    /* I: distance below which points are the same */
+)
+/*
+DESCRIPTION:
+   Put the primitives, their boxes grown by half the tolerance, and the
+curve ends into grids. The cell size is the mean size of the boxes, but
+at least the size giving SKETCH_GRID_LOAD cells per primitive.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    if (!(tolerance > 0.0))
+        return 1;
+    m_tolerance = tolerance;
+
+    const int count = Count();
+    const double half = 0.5 * tolerance;
+    std::vector<svxPoint2> low(count), high(count);
+    svxPoint2 bottom = { HUGE_VAL, HUGE_VAL }, top = { -HUGE_VAL, -HUGE_VAL };
+    double extent = 0.0;
+    for (int i = 0; i < count; i++)
+    {
+        const SketchPrimitive &p = m_primitives[i];
+        low[i].x = p.low.x - half;
+        low[i].y = p.low.y - half;
+        high[i].x = p.high.x + half;
+        high[i].y = p.high.y + half;
+        bottom.x = std::min(bottom.x, low[i].x);
+        bottom.y = std::min(bottom.y, low[i].y);
+        top.x = std::max(top.x, high[i].x);
+        top.y = std::max(top.y, high[i].y);
+        extent += std::max(high[i].x - low[i].x, high[i].y - low[i].y);
+    }
+
+    double cell = count > 0 ? extent / count : 1.0;
+    if (count > 0)
+    {
+        const double width = top.x - bottom.x, height = top.y - bottom.y;
+        const double load = SKETCH_GRID_LOAD * count;
+        cell = std::max(cell, std::max(sqrt(width * height / load), std::max(width, height) / load));
+    }
+    if (m_grid.Build(count, low.data(), high.data(), cell))
+        return 1;
+    m_large.assign(count, 0);
+    for (int i : m_grid.Large())
+        m_large[i] = 1;
+    return m_endGrid.Build((int)m_ends.size(), m_ends.data(), m_ends.data(), std::max(cell, tolerance));
+}
+
+/*******************************************************************/
+/* Function definition */
+int SketchKernel::AtEnd
+(
+const SketchPrimitive &primitive,   /* I: primitive */
+const svxPoint2 &point              /* I: point on the primitive */
+) const
+/*
+DESCRIPTION:
+   Return 1 if a point is at an end of the curve of a primitive, else 0.
+*/
+{
+    const double t2 = m_tolerance * m_tolerance;
+    return ((primitive.ends & 1) && Distance2(point, primitive.start) <= t2) ||
+        ((primitive.ends & 2) && Distance2(point, primitive.end) <= t2);
+}
+
+/*******************************************************************/
+/* Function definition */
+int SketchKernel::OnPrimitive
+(
+const SketchPrimitive &primitive,   /* I: arc or ellipse */
+const svxPoint2 &point              /* I: point on the carrier ellipse */
+) const
+/*
+DESCRIPTION:
+   Return 1 if a point of the carrier ellipse of a primitive is within
+its angle range, give or take the tolerance, else 0.
+*/
+{
+    const SketchPrimitive &p = primitive;
+    if (p.closed)
+        return 1;
+    const svxPoint2 q = { point.x - p.center.x, point.y - p.center.y };
+    const double x = Dot(q, p.axis) / p.major, y = Cross(p.axis, q) / p.minor;
+    return AngleIn(atan2(y, x), p.angle, p.sweep, m_tolerance / p.minor) != HUGE_VAL;
+}
+
+/*******************************************************************/
+/* Function definition */
+svxPoint2 SketchKernel::Tangent
+(
+const SketchPrimitive &primitive,   /* I: primitive */
+const svxPoint2 &point              /* I: point on the primitive */
+) const
+/*
+DESCRIPTION:
+   Tangent of a primitive at a point.
+*/
+{
+    const SketchPrimitive &p = primitive;
+    svxPoint2 tangent = { p.end.x - p.start.x, p.end.y - p.start.y };
+    if (p.kind != Sketch_Line)
+    {
+        const svxPoint2 q = { point.x - p.center.x, point.y - p.center.y };
+        svxPoint2 on;
+        SketchEvaluate(p, atan2(Cross(p.axis, q) / p.minor, Dot(q, p.axis) / p.major), &on, &tangent);
+    }
+    return tangent;
+}
+
+/*******************************************************************/
+/* Function definition */
+void SketchKernel::PointAdd
+(
+const svxPoint2 &point,   /* I: contact point */
+Points *points            /* I/O: contact points of a pair */
+) const
+/*
+DESCRIPTION:
+   Add a contact point, unless it is one of the points already found.
+*/
+{
+    const double t2 = m_tolerance * m_tolerance;
+    for (int i = 0; i < points->count; i++)
+    {
+        if (Distance2(point, points->point[i]) <= t2)
+            return;
+    }
+    if (points->count < SKETCH_MAX_POINTS)
+        points->point[points->count++] = point;
+}
+
+/*******************************************************************/
+/* Function definition */
+void SketchKernel::LineLine
+(
+const SketchPrimitive &a,   /* I: line */
+const SketchPrimitive &b,   /* I: line */
+Points *points,             /* I/O: contact points */
+int *overlap                /* O: 1 if the lines share a piece longer than the tolerance */
+) const
+/*
+DESCRIPTION:
+   Contact of two lines. When both ends of the shorter line are within
+the tolerance of the carrier of the longer one, the lines are collinear
+and meet on the common part of their projections on it. Otherwise a
+proper crossing is decided by the signs of four exact orientations, and
+an end within the tolerance of the other line touches it.
+*/
+{
+    const double t2 = m_tolerance * m_tolerance;
+    const int longer = Distance2(a.start, a.end) >= Distance2(b.start, b.end);
+    const SketchPrimitive &c = longer ? a : b, &o = longer ? b : a;
+    const svxPoint2 d = { c.end.x - c.start.x, c.end.y - c.start.y };
+    const double length = sqrt(Dot(d, d));
+    if (!(length > 0.0))
+    {
+        if (Distance2(a.start, b.start) <= t2)
+            PointAdd(a.start, points);
+        return;
+    }
+
+    const svxPoint2 u = { d.x / length, d.y / length };
+    const svxPoint2 q0 = { o.start.x - c.start.x, o.start.y - c.start.y };
+    const svxPoint2 q1 = { o.end.x - c.start.x, o.end.y - c.start.y };
+    if (fabs(Cross(u, q0)) <= m_tolerance && fabs(Cross(u, q1)) <= m_tolerance)
+    {
+        /* collinear: common part of the projections on the longer line, or the gap between them */
+        const double s0 = Dot(q0, u), s1 = Dot(q1, u);
+        const double low = std::max(0.0, std::min(s0, s1)), high = std::min(length, std::max(s0, s1));
+        if (low - high > m_tolerance)
+            return;
+        *overlap = high - low > m_tolerance;
+        PointAdd(low > 0.0 ? (s0 <= s1 ? o.start : o.end) : c.start, points);
+        return;
+    }
+
+    const double o1 = ExactOrient2d(a.start, a.end, b.start), o2 = ExactOrient2d(a.start, a.end, b.end);
+    const double o3 = ExactOrient2d(b.start, b.end, a.start), o4 = ExactOrient2d(b.start, b.end, a.end);
+    if (((o1 > 0.0 && o2 < 0.0) || (o1 < 0.0 && o2 > 0.0)) && ((o3 > 0.0 && o4 < 0.0) || (o3 < 0.0 && o4 > 0.0)))
+    {
+        const double t = o3 / (o3 - o4);
+        const svxPoint2 point = { a.start.x + t * (a.end.x - a.start.x), a.start.y + t * (a.end.y - a.start.y) };
+        PointAdd(point, points);
+    }
+    const svxPoint2 *ends[4] = { &b.start, &b.end, &a.start, &a.end };
+    for (int k = 0; k < 4; k++)
+    {
+        const SketchPrimitive &line = k < 2 ? a : b;
+        if (SegmentDistance2(*ends[k], line.start, line.end) <= t2)
+            PointAdd(*ends[k], points);
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+void SketchKernel::LineCurve
+(
+const SketchPrimitive &line,    /* I: line */
+const SketchPrimitive &curve,   /* I: arc or ellipse */
+Points *points                  /* I/O: contact points */
+) const
+/*
+DESCRIPTION:
+   Contact of a line and an arc or ellipse: in the frame of the ellipse
+scaled to the unit circle, the line meets the circle at the roots of a
+quadratic; a line within the tolerance of the circle touches it at the
+foot point.
+*/
+{
+    const SketchPrimitive &c = curve;
+    const svxPoint2 q0 = { line.start.x - c.center.x, line.start.y - c.center.y };
+    const svxPoint2 q1 = { line.end.x - c.center.x, line.end.y - c.center.y };
+    const svxPoint2 p0 = { Dot(q0, c.axis) / c.major, Cross(c.axis, q0) / c.minor };
+    const svxPoint2 p1 = { Dot(q1, c.axis) / c.major, Cross(c.axis, q1) / c.minor };
+    const svxPoint2 d = { p1.x - p0.x, p1.y - p0.y };
+    const double dd = Dot(d, d), length2 = Distance2(line.start, line.end);
+    if (!(dd > 0.0))
+        return;
+
+    /* distance of the line from the center, in the unit frame */
+    const double foot = -Dot(p0, d) / dd;
+    const double h = fabs(Cross(d, p0)) / sqrt(dd);
+    const double slack = m_tolerance / c.minor;
+    double roots[2];
+    int count = 0;
+    if (fabs(h - 1.0) <= slack)
+        roots[count++] = foot;
+    else if (h < 1.0)
+    {
+        const double w = sqrt((1.0 - h * h) / dd);
+        roots[count++] = foot - w;
+        roots[count++] = foot + w;
+    }
+
+    const double endSlack = m_tolerance / sqrt(length2);
+    for (int i = 0; i < count; i++)
+    {
+        double t = roots[i];
+        if (t < -endSlack || t > 1.0 + endSlack)
+            continue;
+        t = t < 0.0 ? 0.0 : (t > 1.0 ? 1.0 : t);
+        svxPoint2 point;
+        SketchEvaluate(line, t, &point, nullptr);
+        if (OnPrimitive(c, point))
+            PointAdd(point, points);
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+int SketchKernel::CarrierShared
+(
+const SketchPrimitive &a,   /* I: arc or ellipse */
+const SketchPrimitive &b,   /* I: arc or ellipse */
+Points *points,             /* I/O: contact points */
+int *overlap                /* O: 1 if the primitives share a piece longer than the tolerance */
+) const
+/*
+DESCRIPTION:
+   Contact of two arcs or ellipses on the same carrier ellipse: the
+angle range of b is turned into the parameter of a and the common parts
+of the two circular ranges give the overlap or the touching ends.
+
+   Return 1 if the primitives have the same carrier, else 0.
+*/
+{
+    const double tolerance = m_tolerance;
+    if (Distance2(a.center, b.center) > tolerance * tolerance || fabs(a.major - b.major) > tolerance ||
+        fabs(a.minor - b.minor) > tolerance)
+        return 0;
+    /* parameter of a at the parameter 0 of b; ellipses must have the same or opposite axes */
+    double offset = atan2(Cross(a.axis, b.axis), Dot(a.axis, b.axis));
+    if (fabs(a.major - a.minor) > tolerance)
+    {
+        const double turn = fabs(offset) < 0.5 * SKETCH_PI ? 0.0 : (offset > 0.0 ? SKETCH_PI : -SKETCH_PI);
+        if (fabs(offset - turn) * a.major > tolerance)
+            return 0;
+        offset = turn;
+    }
+
+    /* b turned into a start of [a0, a0 + 2 pi), common parts before and after a full turn */
+    const double twoPi = 2.0 * SKETCH_PI;
+    const double a0 = a.angle, a1 = a.angle + a.sweep;
+    double b0 = fmod(b.angle + offset - a0, twoPi);
+    b0 = (b0 < 0.0 ? b0 + twoPi : b0) + a0;
+    const double b1 = b0 + b.sweep;
+    double pieces[2][2] = { { b0, std::min(a1, b1) }, { a0, std::min(a1, b1 - twoPi) } };
+    if (a.closed || b.closed)
+    {
+        pieces[0][0] = a.closed ? b0 : a0;
+        pieces[0][1] = a.closed ? b1 : a1;
+        pieces[1][0] = 1.0;
+        pieces[1][1] = 0.0;
+    }
+    const double slack = tolerance / a.minor;
+    for (int k = 0; k < 2; k++)
+    {
+        if (pieces[k][1] < pieces[k][0] - slack)
+            continue;
+        if ((pieces[k][1] - pieces[k][0]) * a.minor > tolerance)
+            *overlap = 1;
+        svxPoint2 point;
+        SketchEvaluate(a, pieces[k][0], &point, nullptr);
+        PointAdd(point, points);
+    }
+    return 1;
+}
+
+/*******************************************************************/
+/* Function definition */
+void SketchKernel::ArcArc
+(
+const SketchPrimitive &a,   /* I: arc */
+const SketchPrimitive &b,   /* I: arc */
+Points *points              /* I/O: contact points */
+) const
+/*
+DESCRIPTION:
+   Contact of two arcs on different circles, in closed form; circles
+within the tolerance of tangency touch at one point.
+*/
+{
+    const svxPoint2 e = { b.center.x - a.center.x, b.center.y - a.center.y };
+    const double d = sqrt(Dot(e, e)), r1 = a.major, r2 = b.major;
+    if (!(d > 0.0) || d > r1 + r2 + m_tolerance || d < fabs(r1 - r2) - m_tolerance)
+        return;
+    const svxPoint2 u = { e.x / d, e.y / d };
+    double x = (d * d + r1 * r1 - r2 * r2) / (2.0 * d);
+    x = x > r1 ? r1 : (x < -r1 ? -r1 : x);
+    const double h2 = r1 * r1 - x * x;
+    const int tangent = fabs(d - (r1 + r2)) <= m_tolerance || fabs(d - fabs(r1 - r2)) <= m_tolerance;
+    const double h = tangent || !(h2 > 0.0) ? 0.0 : sqrt(h2);
+    for (int k = 0; k < (h > 0.0 ? 2 : 1); k++)
+    {
+        const double s = k == 0 ? h : -h;
+        const svxPoint2 point = { a.center.x + x * u.x - s * u.y, a.center.y + x * u.y + s * u.x };
+        if (OnPrimitive(a, point) && OnPrimitive(b, point))
+            PointAdd(point, points);
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+void SketchKernel::CurveCurve
+(
+const SketchPrimitive &a,   /* I: arc or ellipse */
+const SketchPrimitive &b,   /* I: arc or ellipse, one of a and b an ellipse */
+Points *points              /* I/O: contact points */
+) const
+/*
+DESCRIPTION:
+   Contact of two curved primitives with an ellipse: both are cut into
+pieces of SKETCH_CURVED_PIECES per quarter turn, and Newton steps on
+a(s) - b(t) = 0 start from the middles of every two pieces whose boxes,
+grown by the sagitta bound, meet.
+*/
+{
+    const SketchPrimitive *primitive[2] = { &a, &b };
+    int count[2];
+    double step[2], grow[2];
+    for (int k = 0; k < 2; k++)
+    {
+        const SketchPrimitive &p = *primitive[k];
+        count[k] = (int)ceil(p.sweep / (0.5 * SKETCH_PI) * SKETCH_CURVED_PIECES - 1.0e-9);
+        count[k] = count[k] < 1 ? 1 : count[k];
+        step[k] = p.sweep / count[k];
+        grow[k] = p.major * (1.0 - cos(0.5 * step[k])) + m_tolerance;
+    }
+    std::vector<svxPoint2> corners((size_t)2 * (count[0] + count[1]));
+    for (int k = 0; k < 2; k++)
+    {
+        svxPoint2 *box = corners.data() + (k == 0 ? 0 : 2 * count[0]);
+        svxPoint2 q0, q1;
+        SketchEvaluate(*primitive[k], primitive[k]->angle, &q1, nullptr);
+        for (int i = 0; i < count[k]; i++)
+        {
+            q0 = q1;
+            SketchEvaluate(*primitive[k], primitive[k]->angle + step[k] * (i + 1), &q1, nullptr);
+            box[2 * i].x = std::min(q0.x, q1.x) - grow[k];
+            box[2 * i].y = std::min(q0.y, q1.y) - grow[k];
+            box[2 * i + 1].x = std::max(q0.x, q1.x) + grow[k];
+            box[2 * i + 1].y = std::max(q0.y, q1.y) + grow[k];
+        }
+    }
+
+    const svxPoint2 *boxA = corners.data(), *boxB = corners.data() + 2 * count[0];
+    for (int i = 0; i < count[0]; i++)
+    {
+        for (int j = 0; j < count[1]; j++)
+        {
+            if (boxA[2 * i].x > boxB[2 * j + 1].x || boxB[2 * j].x > boxA[2 * i + 1].x ||
+                boxA[2 * i].y > boxB[2 * j + 1].y || boxB[2 * j].y > boxA[2 * i + 1].y)
+                continue;
+
+            double s = a.angle + step[0] * (i + 0.5), t = b.angle + step[1] * (j + 0.5);
+            svxPoint2 pa, pb, da, db;
+            for (int n = 0; n < SKETCH_NEWTON_STEPS; n++)
+            {
+                SketchEvaluate(a, s, &pa, &da);
+                SketchEvaluate(b, t, &pb, &db);
+                const svxPoint2 f = { pa.x - pb.x, pa.y - pb.y };
+                const double det = Cross(db, da);
+                if (fabs(det) <= DBL_EPSILON * sqrt(Dot(da, da) * Dot(db, db)))
+                    break;
+                /* solve da ds - db dt = -f */
+                const double ds = Cross(db, f) / det, dt = Cross(da, f) / det;
+                s -= ds;
+                t -= dt;
+                if (fabs(ds) * a.major + fabs(dt) * b.major <= 1.0e-3 * m_tolerance)
+                    break;
+            }
+            SketchEvaluate(a, s, &pa, nullptr);
+            SketchEvaluate(b, t, &pb, nullptr);
+            if (Distance2(pa, pb) <= m_tolerance * m_tolerance && OnPrimitive(a, pa) && OnPrimitive(b, pb))
+                PointAdd(pa, points);
+        }
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+void SketchKernel::PairTest
+(
+int i,                                   /* I: primitive */
+int j,                                   /* I: primitive, j > i */
+std::vector<SketchContact> &contacts     /* I/O: contacts are added */
+) const
+/*
+DESCRIPTION:
+   Find the contacts of two primitives whose grown boxes meet. Neighbour
+pieces of a polyline only meet at their joint and are skipped; points at
+the ends of both curves are connections and are not contacts.
+*/
+{
+    const SketchPrimitive &a = m_primitives[i], &b = m_primitives[j];
+    if (a.curve == b.curve && a.pieces > 1)
+    {
+        const int gap = abs(a.piece - b.piece);
+        if (gap == 1 || (a.closed && gap == a.pieces - 1))
+            return;
+    }
+
+    Points points;
+    points.count = 0;
+    int overlap = 0;
+    if (a.kind == Sketch_Line && b.kind == Sketch_Line)
+        LineLine(a, b, &points, &overlap);
+    else if (a.kind == Sketch_Line)
+        LineCurve(a, b, &points);
+    else if (b.kind == Sketch_Line)
+        LineCurve(b, a, &points);
+    else if (!CarrierShared(a, b, &points, &overlap))
+    {
+        if (a.kind == Sketch_Arc && b.kind == Sketch_Arc)
+            ArcArc(a, b, &points);
+        else
+            CurveCurve(a, b, &points);
+    }
+
+    for (int k = 0; k < points.count; k++)
+    {
+        const svxPoint2 &point = points.point[k];
+        SketchContact contact;
+        contact.kind = Sketch_Overlap;
+        if (!overlap)
+        {
+            const int endA = AtEnd(a, point), endB = AtEnd(b, point);
+            if (endA && endB)
+                continue;
+            const svxPoint2 ta = Tangent(a, point), tb = Tangent(b, point);
+            const int parallel = fabs(Cross(ta, tb)) <= SKETCH_PARALLEL * sqrt(Dot(ta, ta) * Dot(tb, tb));
+            contact.kind = endA || endB || parallel ? Sketch_Touch : Sketch_Cross;
+        }
+        const int swap = b.curve < a.curve;
+        contact.primitive1 = swap ? j : i;
+        contact.primitive2 = swap ? i : j;
+        contact.curve1 = swap ? b.curve : a.curve;
+        contact.curve2 = swap ? a.curve : b.curve;
+        contact.point = point;
+        contacts.push_back(contact);
+        if (overlap)
+            break;
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+void SketchKernel::PairRun
+(
+void *data,    /* I: Batch */
+int begin,     /* I: first task */
+int end,       /* I: end of the range */
+int worker     /* I: worker */
+)
+/*
+DESCRIPTION:
+   Test the pairs of a range of tasks: a task below the cell count is a
+cell, whose pairs are tested when the cell holds the low corner of the
+common part of their boxes; a task above is a primitive listed apart,
+tested against all primitives.
+*/
+{
+    const Batch *batch = (const Batch *)data;
+    const SketchKernel *self = batch->self;
+    const SketchGrid &grid = self->m_grid;
+    std::vector<SketchContact> &contacts = (*batch->contacts)[worker];
+    const std::vector<SketchPrimitive> &primitives = self->m_primitives;
+    const double half = 0.5 * self->m_tolerance;
+    const int cells = grid.CellCount(), total = self->Count();
+
+    for (int task = begin; task < end; task++)
+    {
+        if (task >= cells)
+        {
+            const int i = grid.Large()[task - cells];
+            const SketchPrimitive &a = primitives[i];
+            for (int j = 0; j < total; j++)
+            {
+                const SketchPrimitive &b = primitives[j];
+                if (j == i || (self->m_large[j] && j < i) || a.low.x - b.high.x > 2.0 * half ||
+                    b.low.x - a.high.x > 2.0 * half || a.low.y - b.high.y > 2.0 * half ||
+                    b.low.y - a.high.y > 2.0 * half)
+                    continue;
+                self->PairTest(std::min(i, j), std::max(i, j), contacts);
+            }
+            continue;
+        }
+
+        int count = 0;
+        const int *items = grid.Items(task, &count);
+        for (int m = 0; m < count; m++)
+        {
+            const SketchPrimitive &a = primitives[items[m]];
+            for (int n = m + 1; n < count; n++)
+            {
+                const SketchPrimitive &b = primitives[items[n]];
+                if (a.low.x - b.high.x > 2.0 * half || b.low.x - a.high.x > 2.0 * half ||
+                    a.low.y - b.high.y > 2.0 * half || b.low.y - a.high.y > 2.0 * half)
+                    continue;
+                /* low corner of the common part, grown as in the grid */
+                const svxPoint2 corner = { std::max(a.low.x, b.low.x) - half, std::max(a.low.y, b.low.y) - half };
+                int range[4];
+                grid.CellRange(corner, corner, range);
+                if (grid.Cell(range[0], range[1]) != task)
+                    continue;
+                self->PairTest(std::min(items[m], items[n]), std::max(items[m], items[n]), contacts);
+            }
+        }
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+int SketchKernel::Intersect
+(
+WorkPool *pool,                           /* I: pool running the cells, nullptr for this thread only */
+std::vector<SketchContact> *contacts      /* O: contacts, sorted by curves and points */
+) const
+/*
+DESCRIPTION:
+   Find the crossings, touches and overlaps of all primitives. A contact
+found twice, at the joint of two pieces of a polyline, is kept once.
+
+   Return 1 if the kernel is not built, else 0.
+*/
+{
+    if (contacts == nullptr || !(m_tolerance > 0.0))
+        return 1;
+    contacts->clear();
+
+    const int workers = pool != nullptr ? pool->ThreadCount() : 1;
+    std::vector<std::vector<SketchContact>> found(workers);
+    Batch batch = { this, &found, nullptr };
+    const int tasks = m_grid.CellCount() + (int)m_grid.Large().size();
+    if (pool != nullptr)
+        pool->Run(tasks, SKETCH_GRAIN, PairRun, &batch);
+    else
+        PairRun(&batch, 0, tasks, 0);
+
+    std::vector<SketchContact> all;
+    for (const std::vector<SketchContact> &part : found)
+        all.insert(all.end(), part.begin(), part.end());
+    std::sort(all.begin(), all.end(), ContactLess);
+
+    const double t2 = m_tolerance * m_tolerance;
+    for (const SketchContact &contact : all)
+    {
+        int same = 0;
+        for (size_t k = contacts->size(); k-- > 0 && !same;)
+        {
+            const SketchContact &kept = (*contacts)[k];
+            if (kept.curve1 != contact.curve1 || kept.curve2 != contact.curve2 ||
+                contact.point.x - kept.point.x > m_tolerance)
+                break;
+            same = Distance2(kept.point, contact.point) <= t2;
+        }
+        if (!same)
+            contacts->push_back(contact);
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void SketchKernel::EndRun
+(
+void *data,    /* I: Batch */
+int begin,     /* I: first end */
+int end,       /* I: end of the range */
+int /* worker */ /* I: unused */
+)
+/*
+DESCRIPTION:
+   Count the other ends within the tolerance of a range of ends.
+*/
+{
+    const Batch *batch = (const Batch *)data;
+    const SketchKernel *self = batch->self;
+    const SketchGrid &grid = self->m_endGrid;
+    const double tolerance = self->m_tolerance, t2 = tolerance * tolerance;
+    for (int e = begin; e < end; e++)
+    {
+        const svxPoint2 &point = self->m_ends[e];
+        const svxPoint2 low = { point.x - tolerance, point.y - tolerance };
+        const svxPoint2 high = { point.x + tolerance, point.y + tolerance };
+        int range[4], matches = 0;
+        grid.CellRange(low, high, range);
+        for (int y = range[1]; y <= range[3]; y++)
+        {
+            for (int x = range[0]; x <= range[2]; x++)
+            {
+                int count = 0;
+                const int *items = grid.Items(grid.Cell(x, y), &count);
+                for (int k = 0; k < count; k++)
+                    matches += items[k] != e && Distance2(point, self->m_ends[items[k]]) <= t2;
+            }
+        }
+        (*batch->matches)[e] = matches;
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+int SketchKernel::Connect
+(
+WorkPool *pool,                        /* I: pool running the ends, nullptr for this thread only */
+SketchConnectivity *connectivity       /* O: connection of the ends */
+) const
+/*
+DESCRIPTION:
+   Count the ends of the open curves meeting no other end and meeting
+more than one other end, as cvxSkInqCrvConnect(). The sketch is a set of
+closed profiles when there is neither.
+
+   Return 1 if the kernel is not built, else 0.
+*/
+{
+    if (connectivity == nullptr || !(m_tolerance > 0.0))
+        return 1;
+    const int count = (int)m_ends.size();
+    std::vector<int> matches(count, 0);
+    Batch batch = { this, nullptr, &matches };
+    if (pool != nullptr)
+        pool->Run(count, SKETCH_END_GRAIN, EndRun, &batch);
+    else
+        EndRun(&batch, 0, count, 0);
+
+    connectivity->ends = count;
+    connectivity->unmatched = connectivity->overmatched = 0;
+    connectivity->open.clear();
+    for (int e = 0; e < count; e++)
+    {
+        if (matches[e] == 0)
+        {
+            connectivity->unmatched++;
+            connectivity->open.push_back(m_ends[e]);
+        }
+        else if (matches[e] > 1)
+            connectivity->overmatched++;
+    }
+    return 0;
+}
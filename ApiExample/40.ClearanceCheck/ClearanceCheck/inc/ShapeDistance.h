@@ -0,0 +1,123 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+#pragma once
+
+/* ZW3D API includes */
+#include "zwapi_util.h"
+
+/* Application includes */
+#include <vector>
+#include "TriangleBvh.h"
+#include "SmallMatrix.h"
+#include "WorkPool.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define SHAPE_DISTANCE_STACK (2 * TRIANGLE_BVH_STACK + 2)   /* node pairs waiting in a traversal */
+#define SHAPE_DISTANCE_GRAIN 1           /* pairs taken at a time by a pool worker */
+#define SHAPE_DISTANCE_NONE (-1)
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: pair of shapes of a distance query */
+struct ShapeDistancePair
+{
+    int shape1, shape2;
+};
+
+/*
+DESCRIPTION:
+   Closest triangles of the last query of a pair of shapes. Set both to
+SHAPE_DISTANCE_NONE before the first query; the query updates them.
+*/
+struct ShapeDistanceCache
+{
+    int triangle1, triangle2;
+};
+
+/* DESCRIPTION: closest points of two shapes */
+struct ShapeDistanceResult
+{
+    double distance;       /* 0 if the shapes intersect */
+    svxPoint point1;       /* closest point on shape 1, world space */
+    svxPoint point2;       /* closest point on shape 2, world space */
+    int face1, face2;      /* face tags, SHAPE_DISTANCE_NONE if no triangles are within the limit */
+    int triangle1;         /* triangle index in the tree of shape 1 */
+    int triangle2;
+    int tests;             /* triangle pairs measured */
+    int refined;           /* 1 if the points come from the refine callback */
+};
+
+/*
+DESCRIPTION:
+   Exact closest points of two faces, called with the face tags and the
+world points of the closest facets. Return 0 and the points on the true
+surfaces, or 1 to keep the facet points.
+*/
+typedef int (*ShapeDistanceRefine)(void *data, int shape1, int face1, int shape2, int face2, svxPoint *point1,
+    svxPoint *point2);
+
+/*
+DESCRIPTION:
+   Closest distance between shapes, each given by the tree of its facets
+(TriangleBvh.h) built once and placed by a rigid pose.
+
+   A query walks the two trees together in the space of shape 1, the
+boxes of shape 2 being moved by the relative pose and bounded again
+(and the boxes of shape 1 moved back, the larger distance being kept):
+pairs of nodes are visited nearest first and a pair farther than the
+closest triangles found so far is dropped, so only the triangle pairs
+near the closest points are measured. Triangle pairs are measured
+exactly (edge to edge, vertex to triangle, and edge through triangle
+for touching shapes).
+
+   For moving shapes, the cache of a pair keeps its closest triangles;
+the next query measures them first and starts with their distance as
+the bound, which prunes most of the walk when the shapes moved a
+little. The limit of a query is the largest distance of interest: a
+clearance check passes its clearance and pairs farther apart stop at the
+root.
+
+   DistanceList() runs pairs on a WorkPool, then calls the refine
+callback on the calling thread, so it may call ZW3D. The face tags map
+the points back to the face handles. The trees are not copied and must
+outlive the engine; the engine is immutable between PoseSet() calls and
+may be shared by threads.
+*/
+class ShapeDistance
+{
+public:
+    ShapeDistance();
+
+    int AddShape(const TriangleBvh *bvh);
+    int PoseSet(int shape, const SmallTransform &pose);
+    void Clear(void);
+
+    int Distance(int shape1, int shape2, double limit, ShapeDistanceCache *cache, ShapeDistanceResult *result) const;
+    int DistanceList(int count, const ShapeDistancePair *pairs, double limit, ShapeDistanceRefine refine, void *data,
+        WorkPool *pool, ShapeDistanceCache *caches, ShapeDistanceResult *results) const;
+
+    int Count(void) const { return (int)m_shapes.size(); }
+    const SmallTransform &Pose(int shape) const { return m_poses[shape]; }
+
+private:
+    /* data of a running DistanceList() */
+    struct Batch
+    {
+        const ShapeDistance *self;
+        const ShapeDistancePair *pairs;
+        double limit;
+        ShapeDistanceCache *caches;
+        ShapeDistanceResult *results;
+    };
+
+    static void TaskRun(void *data, int begin, int end, int worker);
+
+    std::vector<const TriangleBvh *> m_shapes;
+    std::vector<SmallTransform> m_poses;
+};
+
+/* Function declaration */
+double ShapeTriangleDistance(const svxPoint a[3], const svxPoint b[3], svxPoint *point1, svxPoint *point2);
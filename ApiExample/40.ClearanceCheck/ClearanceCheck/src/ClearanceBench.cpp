@@ -0,0 +1,287 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <float.h>
+#include <chrono>
+#include <random>
+#include <vector>
+#include "ShapeDistance.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define BENCH_TRIANGLES 2000         /* default of the triangles of a random shape */
+#define BENCH_POSES 50               /* poses of each check */
+#define STACKED_TRIANGLES 24         /* coincident triangles of the stacked shape, one leaf */
+#define CHECK_TOLERANCE 1e-9
+#define CHECK_PI 3.14159265358979323846
+
+/*******************************************************************/
+/* Function declarations */
+static double Seconds(std::chrono::steady_clock::time_point start);
+static void ShapeRandom(std::mt19937 &random, int count, double offset, TriangleBvh *bvh);
+static void ShapeStacked(double offset, TriangleBvh *bvh);
+static int LeafLargest(const TriangleBvh &bvh);
+static SmallTransform PoseRandom(std::mt19937 &random, double travel);
+static double DistanceBrute(const TriangleBvh &bvh1, const SmallTransform &pose1, const TriangleBvh &bvh2,
+    const SmallTransform &pose2);
+static int PairsCheck(const char *name, const TriangleBvh &bvh1, const TriangleBvh &bvh2, WorkPool &pool,
+    std::mt19937 &random, double *engineTime, double *bruteTime);
+
+/*******************************************************************/
+/* Function definition */
+double Seconds
+(
+std::chrono::steady_clock::time_point start   /* I: start time */
+)
+/*
+DESCRIPTION:
+   Seconds elapsed since "start".
+*/
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*******************************************************************/
+/* Function definition */
+void ShapeRandom
+(
+std::mt19937 &random,   /* I/O: random numbers */
+int count,              /* I: number of triangles */
+double offset,          /* I: x offset of the shape */
+TriangleBvh *bvh        /* O: built tree */
+)
+/*
+DESCRIPTION:
+   Shape of small random triangles in a few clusters, as facets of
+neighbouring faces; the face tag of a triangle is its cluster.
+*/
+{
+    std::uniform_real_distribution<double> unit(-1.0, 1.0);
+    bvh->Clear();
+    for (int i = 0; i < count; i++)
+    {
+        const int cluster = i % 5;
+        const double cx = offset + cluster * 3.0, cy = cluster * 0.5, cz = 0.0;
+        const double x = cx + 2.0 * unit(random), y = cy + 2.0 * unit(random), z = cz + 2.0 * unit(random);
+        float v[3][3];
+        for (int k = 0; k < 3; k++)
+        {
+            v[k][0] = (float)(x + 0.3 * unit(random));
+            v[k][1] = (float)(y + 0.3 * unit(random));
+            v[k][2] = (float)(z + 0.3 * unit(random));
+        }
+        bvh->AddTriangle(v[0], v[1], v[2], cluster);
+    }
+    bvh->Build();
+}
+
+/*******************************************************************/
+/* Function definition */
+void ShapeStacked
+(
+double offset,      /* I: x offset of the shape */
+TriangleBvh *bvh    /* O: built tree */
+)
+/*
+DESCRIPTION:
+   Shape of STACKED_TRIANGLES different triangles with the same center,
+as duplicated or stacked faces. The box of each triangle is symmetric
+about the center and its corners are small integers, so the centers are
+equal to the last bit and no split separates them: they make one leaf.
+*/
+{
+    bvh->Clear();
+    for (int i = 0; i < STACKED_TRIANGLES; i++)
+    {
+        const int a = 1 + i % 3, b = 1 + i % 2, c = i % 4, y = i % 3 - 1, x = 1 - i % 3;
+        const float v[3][3] = { { (float)(offset - a), (float)-b, (float)-c }, { (float)(offset + a), (float)y, 0.0f },
+            { (float)(offset + (x < a ? x : a)), (float)b, (float)c } };
+        bvh->AddTriangle(v[0], v[1], v[2], i);
+    }
+    bvh->Build();
+}
+
+/*******************************************************************/
+/* Function definition */
+int LeafLargest
+(
+const TriangleBvh &bvh   /* I: built tree */
+)
+/*
+DESCRIPTION:
+   Number of triangles of the largest leaf of a tree.
+*/
+{
+    int largest = 0;
+    for (int i = 0; i < bvh.NodeCount(); i++)
+        largest = bvh.Nodes()[i].count > largest ? bvh.Nodes()[i].count : largest;
+    return largest;
+}
+
+/*******************************************************************/
+/* Function definition */
+SmallTransform PoseRandom
+(
+std::mt19937 &random,   /* I/O: random numbers */
+double travel           /* I: largest move along each axis */
+)
+/*
+DESCRIPTION:
+   Random rigid pose: a turn about Z then about X, and a move.
+*/
+{
+    std::uniform_real_distribution<double> unit(-1.0, 1.0);
+    const SmallMatrix<3> turn = SmallMultiply(SmallAxisRotation(0, CHECK_PI * unit(random)),
+        SmallAxisRotation(2, CHECK_PI * unit(random)));
+    SmallTransform pose = SmallTransformRotationSet(SmallTransformIdentity(), turn);
+    pose.identity = 0;
+    for (int k = 0; k < 3; k++)
+        pose.m[k][3] = travel * unit(random);
+    return pose;
+}
+
+/*******************************************************************/
+/* Function definition */
+double DistanceBrute
+(
+const TriangleBvh &bvh1,        /* I: tree of shape 1 */
+const SmallTransform &pose1,    /* I: pose of shape 1 */
+const TriangleBvh &bvh2,        /* I: tree of shape 2 */
+const SmallTransform &pose2     /* I: pose of shape 2 */
+)
+/*
+DESCRIPTION:
+   Distance of two shapes measuring every pair of triangles in world
+space.
+*/
+{
+    std::vector<svxPoint> world2(3 * (size_t)bvh2.TriangleCount());
+    float v[3][3];
+    for (int j = 0; j < bvh2.TriangleCount(); j++)
+    {
+        bvh2.Triangle(j, v[0], v[1], v[2]);
+        for (int k = 0; k < 3; k++)
+            world2[3 * j + k] = SmallTransformPoint(pose2, svxPoint{ v[k][0], v[k][1], v[k][2] });
+    }
+    double best = DBL_MAX;
+    for (int i = 0; i < bvh1.TriangleCount(); i++)
+    {
+        svxPoint a[3], c1, c2;
+        bvh1.Triangle(i, v[0], v[1], v[2]);
+        for (int k = 0; k < 3; k++)
+            a[k] = SmallTransformPoint(pose1, svxPoint{ v[k][0], v[k][1], v[k][2] });
+        for (int j = 0; j < bvh2.TriangleCount(); j++)
+        {
+            const double d = ShapeTriangleDistance(a, &world2[3 * j], &c1, &c2);
+            best = d < best ? d : best;
+        }
+    }
+    return sqrt(best);
+}
+
+/*******************************************************************/
+/* Function definition */
+int PairsCheck
+(
+const char *name,           /* I: name of the check */
+const TriangleBvh &bvh1,    /* I: tree of shape 1 */
+const TriangleBvh &bvh2,    /* I: tree of shape 2 */
+WorkPool &pool,             /* I: pool of DistanceList() */
+std::mt19937 &random,       /* I/O: random numbers */
+double *engineTime,         /* I/O: seconds of the engine */
+double *bruteTime           /* I/O: seconds of the brute force */
+)
+/*
+DESCRIPTION:
+   Compare the distances of the engine, both ways, with and without a
+cache and on the pool, against the brute force for random poses.
+
+   Return the number of failed poses.
+*/
+{
+    int failures = 0;
+    ShapeDistance engine;
+    engine.AddShape(&bvh1);
+    engine.AddShape(&bvh2);
+    ShapeDistanceCache cache = { SHAPE_DISTANCE_NONE, SHAPE_DISTANCE_NONE };
+    const ShapeDistancePair pairs[2] = { { 0, 1 }, { 1, 0 } };
+    for (int p = 0; p < BENCH_POSES; p++)
+    {
+        engine.PoseSet(0, PoseRandom(random, 4.0));
+        engine.PoseSet(1, PoseRandom(random, 4.0));
+
+        auto start = std::chrono::steady_clock::now();
+        const double expected = DistanceBrute(bvh1, engine.Pose(0), bvh2, engine.Pose(1));
+        *bruteTime += Seconds(start);
+
+        ShapeDistanceResult results[4];
+        start = std::chrono::steady_clock::now();
+        int failed = engine.Distance(0, 1, 0.0, nullptr, &results[0]);
+        *engineTime += Seconds(start);
+        failed |= engine.Distance(0, 1, 0.0, &cache, &results[1]);
+        failed |= engine.DistanceList(2, pairs, 0.0, nullptr, nullptr, &pool, nullptr, &results[2]);
+        for (int r = 0; r < 4 && !failed; r++)
+            failed = fabs(results[r].distance - expected) > CHECK_TOLERANCE * (1.0 + expected);
+        if (failed)
+        {
+            printf("check failed: %s pose %d, distance %.12g, engine %.12g %.12g %.12g %.12g\n", name, p, expected,
+                results[0].distance, results[1].distance, results[2].distance, results[3].distance);
+            failures++;
+        }
+    }
+    return failures;
+}
+
+/*******************************************************************/
+/* Function definition */
+int main
+(
+int argc,      /* I: number of arguments */
+char **argv    /* I: [triangles] */
+)
+/*
+DESCRIPTION:
+   Check the distances of the engine against the brute force, for random
+shapes and for a shape whose triangles make a leaf larger than
+TRIANGLE_BVH_LEAF_SIZE, and compare their times.
+
+   Return 1 if a check fails, else 0.
+*/
+{
+    const int triangles = argc > 1 && atoi(argv[1]) > 0 ? atoi(argv[1]) : BENCH_TRIANGLES;
+    std::mt19937 random(7);
+    WorkPool pool;
+    TriangleBvh random1, random2, stacked;
+    ShapeRandom(random, triangles, 0.0, &random1);
+    ShapeRandom(random, triangles / 2, 6.0, &random2);
+    ShapeStacked(3.0, &stacked);
+
+    int failures = 0;
+    const int largest = LeafLargest(stacked);
+    if (largest <= TRIANGLE_BVH_LEAF_SIZE)
+    {
+        printf("check failed: the stacked shape has no leaf above %d triangles\n", TRIANGLE_BVH_LEAF_SIZE);
+        failures++;
+    }
+
+    double engineTime = 0.0, bruteTime = 0.0;
+    failures += PairsCheck("random shapes", random1, random2, pool, random, &engineTime, &bruteTime);
+    printf("random shapes (%d, %d triangles, largest leaves %d, %d): engine %.3f ms, brute force %.3f ms a pose\n",
+        random1.TriangleCount(), random2.TriangleCount(), LeafLargest(random1), LeafLargest(random2),
+        engineTime * 1e3 / BENCH_POSES, bruteTime * 1e3 / BENCH_POSES);
+
+    double stackedEngine = 0.0, stackedBrute = 0.0;
+    const int stackedFailures = PairsCheck("stacked shape", stacked, random2, pool, random, &stackedEngine, &stackedBrute) +
+        PairsCheck("two stacked shapes", stacked, stacked, pool, random, &stackedEngine, &stackedBrute);
+    printf("stacked shape (%d triangles in a leaf): %s\n", largest, stackedFailures ? "FAILED" : "passed");
+    failures += stackedFailures;
+
+    printf("checks: %s\n", failures ? "FAILED" : "passed");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,432 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* ZW3D API includes */
+#include "zwapi_entity.h"
+#include "zwapi_face.h"
+#include "zwapi_math.h"
+#include "zwapi_memory.h"
+#include "zwapi_shape.h"
+#include "zwapi_userinput.h"
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <math.h>
+#include <float.h>
+#include <chrono>
+#include <vector>
+#include "..\inc\ClearanceCheckPr.h"
+#include "..\inc\ShapeDistance.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define MESSAGE_SIZE 256
+#define CHECK_PI 3.14159265358979323846
+#define DEFAULT_TOLERANCE 0.01       /* default facet distance tolerance (mm) */
+#define DEFAULT_CLEARANCE 1.0        /* default clearance (mm) */
+#define DEFAULT_STEPS 200            /* default steps of the motion */
+#define MOTION_TURN 90.0             /* turn of the moving shape about Z over the motion (degree) */
+#define REFINE_STEPS 4               /* alternating projections of a refinement */
+#define LIST_PAIRS 10                /* pairs listed, at most */
+
+/*******************************************************************/
+/* Data type definitions */
+/*
+DESCRIPTION:
+   Picked shapes, their faces and the trees of their facets. The face
+tag of a triangle is its face's index in the face list of its shape.
+*/
+struct ClearanceScene
+{
+    int count;
+    szwEntityHandle *shapes;
+    std::vector<int> ids;
+    std::vector<szwEntityHandle *> faces;     /* face lists of ZwShapeFaceListGet() */
+    std::vector<int> faceCounts;
+    std::vector<TriangleBvh> trees;
+    ShapeDistance engine;
+    std::vector<ShapeDistancePair> pairs;     /* all pairs of shapes */
+};
+
+/*******************************************************************/
+/* Function declarations */
+static int ClearanceCheck(void);
+static int SceneBuild(double tolerance, ClearanceScene *scene);
+static void SceneFree(ClearanceScene *scene);
+static int FaceRefine(void *data, int shape1, int face1, int shape2, int face2, svxPoint *point1, svxPoint *point2);
+static void HostCheck(const ClearanceScene &scene, const std::vector<ShapeDistanceResult> &results);
+static void MotionRun(ClearanceScene &scene, double clearance, int steps, WorkPool *pool);
+static double Seconds(std::chrono::steady_clock::time_point start);
+
+/*******************************************************************/
+/* Function definition */
+int RegisterClearanceCheck
+(
+void
+)
+/*
+DESCRIPTION:
+   Register the commands of the clearance check example.
+*/
+{
+    /* Check the distances and the clearance of moving shapes by entering "~ClearanceCheck" */
+    ZwCommandFunctionLoad("ClearanceCheck", (void *)ClearanceCheck, ZW_LICENSE_CODE_GENERAL);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int UnloadClearanceCheck
+(
+void
+)
+/*
+DESCRIPTION:
+   Unload the commands of the clearance check example.
+*/
+{
+    ZwCommandFunctionUnload("ClearanceCheck");
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+double Seconds
+(
+std::chrono::steady_clock::time_point start   /* I: start time */
+)
+/*
+DESCRIPTION:
+   Seconds elapsed since "start".
+*/
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*******************************************************************/
+/* Function definition */
+int SceneBuild
+(
+double tolerance,          /* I: facet distance tolerance */
+ClearanceScene *scene      /* O: shapes and trees, free with SceneFree() */
+)
+/*
+DESCRIPTION:
+   Pick the shapes, get the facets of the faces of each shape with one
+ZwFaceListFacetsGet() call, build its tree and add it to the engine.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    scene->count = 0;
+    scene->shapes = nullptr;
+    if (ZwEntityListGetByPick("Select at least two shapes", ZW_INPUT_SHAPE, 0, &scene->count, &scene->shapes) ||
+        scene->count < 2)
+        return 1;
+    scene->ids.assign(scene->count, 0);
+    scene->faces.assign(scene->count, nullptr);
+    scene->faceCounts.assign(scene->count, 0);
+    scene->trees.assign(scene->count, TriangleBvh());
+    if (ZwEntityIdGet(scene->count, scene->shapes, scene->ids.data()))
+        return 1;
+
+    for (int i = 0; i < scene->count; i++)
+    {
+        if (ZwShapeFaceListGet(scene->shapes[i], &scene->faceCounts[i], &scene->faces[i]) || scene->faceCounts[i] < 1)
+            return 1;
+
+        szwRefineFacetsOfMultiFace refine{};
+        refine.countFace = scene->faceCounts[i];
+        refine.faceHandle = scene->faces[i];
+        refine.type = ZW_FACETS_TOLORANCE_DISTANCE;
+        refine.edgeTolorance = tolerance;
+        refine.facetTolorance = tolerance;
+        refine.angleTolorance = 5.0;
+        refine.surfaceTolorance = 1.0;
+
+        int count = 0;
+        szwFacets *facets = nullptr;
+        if (ZwFaceListFacetsGet(refine, &count, &facets))
+            return 1;
+        for (int k = 0; k < count && k < scene->faceCounts[i]; k++)
+            scene->trees[i].AddFacets(facets[k], k);
+        for (int k = 0; k < count; k++)
+            ZwFaceFacetsDataFree(&facets[k]);
+        ZwMemoryFree((void **)&facets);
+        if (scene->trees[i].Build())
+            return 1;
+    }
+
+    /* the trees are not moved any more */
+    for (int i = 0; i < scene->count; i++)
+        scene->engine.AddShape(&scene->trees[i]);
+    for (int i = 0; i < scene->count; i++)
+    {
+        for (int j = i + 1; j < scene->count; j++)
+            scene->pairs.push_back(ShapeDistancePair{ i, j });
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void SceneFree
+(
+ClearanceScene *scene   /* I/O: scene of SceneBuild() */
+)
+/*
+DESCRIPTION:
+   Free the face lists, the shape list and the trees.
+*/
+{
+    scene->engine.Clear();
+    for (size_t i = 0; i < scene->faces.size(); i++)
+    {
+        if (scene->faces[i] != nullptr)
+            ZwEntityHandleListFree(scene->faceCounts[i], &scene->faces[i]);
+    }
+    scene->faces.clear();
+    scene->trees.clear();
+    ZwEntityHandleListFree(scene->count, &scene->shapes);
+}
+
+/*******************************************************************/
+/* Function definition */
+int FaceRefine
+(
+void *data,           /* I: ClearanceScene */
+int shape1,           /* I: shape */
+int face1,            /* I: face tag of the closest facet of shape 1 */
+int shape2,           /* I: shape */
+int face2,            /* I: face tag of the closest facet of shape 2 */
+svxPoint *point1,     /* I/O: closest point on shape 1, world space */
+svxPoint *point2      /* I/O: closest point on shape 2, world space */
+)
+/*
+DESCRIPTION:
+   ShapeDistanceRefine callback: starting from the facet points, project
+each point on the true surface of its face in turn with
+ZwEntityPointMinDistanceGet(), the faces being where the host has them
+and the points moved there by the inverse poses.
+
+   Return 0 if the points are refined, else 1 (the facet points are kept).
+*/
+{
+    const ClearanceScene *scene = (const ClearanceScene *)data;
+    const SmallTransform &pose1 = scene->engine.Pose(shape1), &pose2 = scene->engine.Pose(shape2);
+    SmallTransform inverse1, inverse2;
+    if (SmallTransformInvert(pose1, &inverse1) || SmallTransformInvert(pose2, &inverse2))
+        return 1;
+    const szwEntityHandle faceHandle1 = scene->faces[shape1][face1];
+    const szwEntityHandle faceHandle2 = scene->faces[shape2][face2];
+
+    svxPoint on1 = SmallTransformPoint(inverse1, *point1), on2 = SmallTransformPoint(inverse2, *point2);
+    for (int i = 0; i < REFINE_STEPS; i++)
+    {
+        double distance = 0.0;
+        szwPoint target;
+        if (ZwEntityPointMinDistanceGet(faceHandle2, SmallTransformPoint(inverse2, SmallTransformPoint(pose1, on1)),
+            &target, &distance))
+            return 1;
+        on2 = target;
+        if (ZwEntityPointMinDistanceGet(faceHandle1, SmallTransformPoint(inverse1, SmallTransformPoint(pose2, on2)),
+            &target, &distance))
+            return 1;
+        on1 = target;
+    }
+    *point1 = SmallTransformPoint(pose1, on1);
+    *point2 = SmallTransformPoint(pose2, on2);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void HostCheck
+(
+const ClearanceScene &scene,                       /* I: shapes in place */
+const std::vector<ShapeDistanceResult> &results    /* I: refined distances of all pairs */
+)
+/*
+DESCRIPTION:
+   Ask the host the distance of every pair with cvxEntGetDistance() and
+report the largest difference and the host time.
+*/
+{
+    double difference = 0.0;
+    int checked = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < scene.pairs.size(); i++)
+    {
+        svxPoint p1, p2;
+        double distance = 0.0;
+        if (cvxEntGetDistance(scene.ids[scene.pairs[i].shape1], scene.ids[scene.pairs[i].shape2], &p1, &p2,
+            &distance))
+            continue;
+        const double d = fabs(distance - results[i].distance);
+        difference = d > difference ? d : difference;
+        checked++;
+    }
+    const double hostTime = Seconds(start);
+
+    char message[MESSAGE_SIZE];
+    sprintf_s(message, MESSAGE_SIZE, "Host: %d pairs in %.3f s, largest difference of the distances %g", checked,
+        hostTime, difference);
+    cvxMsgDisp(message);
+}
+
+/*******************************************************************/
+/* Function definition */
+void MotionRun
+(
+ClearanceScene &scene,     /* I/O: shapes, the first one is moved and put back */
+double clearance,          /* I: clearance */
+int steps,                 /* I: steps of the motion */
+WorkPool *pool             /* I: pool running the pairs */
+)
+/*
+DESCRIPTION:
+   Move the first shape through the center of the second one, turning it
+by MOTION_TURN degrees about Z, and check the clearance of all pairs at
+every step, with and without the caches of the pairs. The steps closer
+than the clearance, the smallest distance and the times are reported.
+*/
+{
+    const svxBndBox box1 = scene.trees[0].Bounds(), box2 = scene.trees[1].Bounds();
+    const svxPoint center = { 0.5 * (box1.X.min + box1.X.max), 0.5 * (box1.Y.min + box1.Y.max),
+        0.5 * (box1.Z.min + box1.Z.max) };
+    const svxVector travel = { box2.X.min + box2.X.max - 2.0 * center.x, box2.Y.min + box2.Y.max - 2.0 * center.y,
+        box2.Z.min + box2.Z.max - 2.0 * center.z };
+
+    const size_t count = scene.pairs.size();
+    std::vector<ShapeDistanceCache> caches(count, ShapeDistanceCache{ SHAPE_DISTANCE_NONE, SHAPE_DISTANCE_NONE });
+    std::vector<ShapeDistanceResult> cached(count), fresh(count);
+    double cachedTime = 0.0, freshTime = 0.0, smallest = DBL_MAX, difference = 0.0;
+    long long cachedTests = 0, freshTests = 0;
+    int clashes = 0, smallestStep = 0;
+    for (int step = 0; step <= steps; step++)
+    {
+        /* turn about the Z axis through the center, then move */
+        const double f = (double)step / steps, angle = f * MOTION_TURN * CHECK_PI / 180.0;
+        const double c = cos(angle), s = sin(angle);
+        SmallTransform pose = SmallTransformIdentity();
+        pose.identity = 0;
+        pose.m[0][0] = c;
+        pose.m[0][1] = -s;
+        pose.m[1][0] = s;
+        pose.m[1][1] = c;
+        pose.m[0][3] = center.x - c * center.x + s * center.y + f * travel.x;
+        pose.m[1][3] = center.y - s * center.x - c * center.y + f * travel.y;
+        pose.m[2][3] = f * travel.z;
+        scene.engine.PoseSet(0, pose);
+
+        auto start = std::chrono::steady_clock::now();
+        scene.engine.DistanceList((int)count, scene.pairs.data(), clearance, nullptr, nullptr, pool, caches.data(),
+            cached.data());
+        cachedTime += Seconds(start);
+        start = std::chrono::steady_clock::now();
+        scene.engine.DistanceList((int)count, scene.pairs.data(), clearance, nullptr, nullptr, pool, nullptr,
+            fresh.data());
+        freshTime += Seconds(start);
+
+        int clash = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            cachedTests += cached[i].tests;
+            freshTests += fresh[i].tests;
+            const double d = fabs(cached[i].distance - fresh[i].distance);
+            difference = d > difference ? d : difference;
+            if (cached[i].face1 == SHAPE_DISTANCE_NONE)
+                continue;
+            clash = 1;
+            if (cached[i].distance < smallest)
+            {
+                smallest = cached[i].distance;
+                smallestStep = step;
+            }
+        }
+        clashes += clash;
+    }
+    scene.engine.PoseSet(0, SmallTransformIdentity());
+
+    char message[MESSAGE_SIZE];
+    if (clashes > 0)
+        sprintf_s(message, MESSAGE_SIZE, "Motion: %d of %d steps closer than %g, smallest distance %g at step %d",
+            clashes, steps + 1, clearance, smallest, smallestStep);
+    else
+        sprintf_s(message, MESSAGE_SIZE, "Motion: %d steps, no pair closer than %g", steps + 1, clearance);
+    cvxMsgDisp(message);
+    sprintf_s(message, MESSAGE_SIZE, "Motion: cached %.3f s (%lld triangle pairs), not cached %.3f s (%lld), largest "
+        "difference %g", cachedTime, cachedTests, freshTime, freshTests, difference);
+    cvxMsgDisp(message);
+}
+
+/*******************************************************************/
+/* Function definition */
+int ClearanceCheck
+(
+void
+)
+/*
+DESCRIPTION:
+   Build the trees of the picked shapes, measure the distances of all
+pairs in place with refinement and check them with the host, then run
+the clearance check of a motion of the first shape.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    double tolerance = DEFAULT_TOLERANCE;
+    if (cvxGetNumber("Facet distance tolerance", &tolerance) || !(tolerance > 0.0))
+        tolerance = DEFAULT_TOLERANCE;
+
+    ClearanceScene scene;
+    auto start = std::chrono::steady_clock::now();
+    if (SceneBuild(tolerance, &scene))
+    {
+        SceneFree(&scene);
+        return 1;
+    }
+    const double buildTime = Seconds(start);
+    int triangles = 0;
+    for (const TriangleBvh &tree : scene.trees)
+        triangles += tree.TriangleCount();
+
+    const int count = (int)scene.pairs.size();
+    std::vector<ShapeDistanceResult> facet(count), refined(count);
+    WorkPool pool;
+    start = std::chrono::steady_clock::now();
+    scene.engine.DistanceList(count, scene.pairs.data(), 0.0, nullptr, nullptr, &pool, nullptr, facet.data());
+    const double facetTime = Seconds(start);
+    start = std::chrono::steady_clock::now();
+    scene.engine.DistanceList(count, scene.pairs.data(), 0.0, FaceRefine, &scene, &pool, nullptr, refined.data());
+    const double refineTime = Seconds(start);
+
+    char message[MESSAGE_SIZE];
+    sprintf_s(message, MESSAGE_SIZE, "%d shapes, %d triangles, %d pairs, facets and trees %.3f s", scene.count,
+        triangles, count, buildTime);
+    cvxMsgDisp(message);
+    sprintf_s(message, MESSAGE_SIZE, "Local: facet distances %.3f s, refined %.3f s, %d threads", facetTime,
+        refineTime, pool.ThreadCount());
+    cvxMsgDisp(message);
+    for (int i = 0; i < count && i < LIST_PAIRS; i++)
+    {
+        const ShapeDistanceResult &r = refined[i];
+        sprintf_s(message, MESSAGE_SIZE, "Shapes %d and %d: %g (facets %g), faces %d and %d, %d triangle pairs",
+            scene.ids[scene.pairs[i].shape1], scene.ids[scene.pairs[i].shape2], r.distance, facet[i].distance,
+            r.face1, r.face2, r.tests);
+        cvxMsgDisp(message);
+    }
+    HostCheck(scene, refined);
+
+    double clearance = DEFAULT_CLEARANCE, steps = DEFAULT_STEPS;
+    if (cvxGetNumber("Clearance", &clearance) || !(clearance > 0.0))
+        clearance = DEFAULT_CLEARANCE;
+    if (cvxGetNumber("Steps of the motion", &steps) || steps < 1.0)
+        steps = DEFAULT_STEPS;
+    MotionRun(scene, clearance, (int)steps, &pool);
+    SceneFree(&scene);
+    return 0;
+}
@@ -0,0 +1,768 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* Application includes */
+#include <math.h>
+#include <float.h>
+#include "ShapeDistance.h"
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: box of a node, in the space of shape 1 */
+struct NodeBox
+{
+    double low[3], high[3];
+};
+
+/* DESCRIPTION: pair of nodes waiting in a traversal */
+struct NodePair
+{
+    int node1, node2;
+    double distance2;     /* squared distance of their boxes */
+};
+
+/*******************************************************************/
+/* Function declarations */
+static svxPoint Difference(const svxPoint &a, const svxPoint &b);
+static double Dot(const svxPoint &a, const svxPoint &b);
+static svxPoint Along(const svxPoint &a, const svxPoint &d, double t);
+static double SegmentClosest(const svxPoint &p1, const svxPoint &q1, const svxPoint &p2, const svxPoint &q2,
+    svxPoint *c1, svxPoint *c2);
+static double PointTriangleClosest(const svxPoint &p, const svxPoint t[3], svxPoint *closest);
+static int SegmentTriangleHit(const svxPoint &p, const svxPoint &q, const svxPoint t[3], svxPoint *hit);
+static void TriangleGet(const TriangleBvh &bvh, int index, const SmallTransform *move, svxPoint t[3]);
+static double TrianglesMeasure(const TriangleBvh &bvh1, int triangle1, const TriangleBvh &bvh2, int triangle2,
+    const SmallTransform &relative, svxPoint *point1, svxPoint *point2);
+static void BoxGet(const TriangleBvhNode &node, const SmallTransform *move, NodeBox *box);
+static void TriangleBox(const svxPoint t[3], NodeBox *box);
+static double BoxDistance2(const NodeBox &a, const NodeBox &b);
+
+/*******************************************************************/
+/* Function definition */
+svxPoint Difference
+(
+const svxPoint &a,   /* I: point */
+const svxPoint &b    /* I: point */
+)
+/*
+DESCRIPTION:
+   Vector from b to a.
+*/
+{
+    return svxPoint{ a.x - b.x, a.y - b.y, a.z - b.z };
+}
+
+/*******************************************************************/
+/* Function definition */
+double Dot
+(
+const svxPoint &a,   /* I: vector */
+const svxPoint &b    /* I: vector */
+)
+/*
+DESCRIPTION:
+   Dot product.
+*/
+{
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+/*******************************************************************/
+/* Function definition */
+svxPoint Along
+(
+const svxPoint &a,   /* I: point */
+const svxPoint &d,   /* I: direction */
+double t             /* I: factor of the direction */
+)
+/*
+DESCRIPTION:
+   Point a + t d.
+*/
+{
+    return svxPoint{ a.x + t * d.x, a.y + t * d.y, a.z + t * d.z };
+}
+
+/*******************************************************************/
+/* Function definition */
+double SegmentClosest
+(
+const svxPoint &p1,   /* I: start of segment 1 */
+const svxPoint &q1,   /* I: end of segment 1 */
+const svxPoint &p2,   /* I: start of segment 2 */
+const svxPoint &q2,   /* I: end of segment 2 */
+svxPoint *c1,         /* O: closest point on segment 1 */
+svxPoint *c2          /* O: closest point on segment 2 */
+)
+/*
+DESCRIPTION:
+   Closest points of two segments, degenerate segments included
+(Ericson, Real-Time Collision Detection, 5.1.9).
+
+   Return the squared distance.
+*/
+{
+    const svxPoint d1 = Difference(q1, p1), d2 = Difference(q2, p2), r = Difference(p1, p2);
+    const double a = Dot(d1, d1), e = Dot(d2, d2), f = Dot(d2, r);
+    double s = 0.0, t = 0.0;
+    if (a <= DBL_MIN && e <= DBL_MIN)
+        s = t = 0.0;
+    else if (a <= DBL_MIN)
+        t = f / e < 0.0 ? 0.0 : (f / e > 1.0 ? 1.0 : f / e);
+    else
+    {
+        const double c = Dot(d1, r);
+        if (e <= DBL_MIN)
+            s = -c / a < 0.0 ? 0.0 : (-c / a > 1.0 ? 1.0 : -c / a);
+        else
+        {
+            const double b = Dot(d1, d2), denominator = a * e - b * b;
+            if (denominator > 0.0)
+            {
+                s = (b * f - c * e) / denominator;
+                s = s < 0.0 ? 0.0 : (s > 1.0 ? 1.0 : s);
+            }
+            t = (b * s + f) / e;
+            if (t < 0.0)
+            {
+                t = 0.0;
+                s = -c / a < 0.0 ? 0.0 : (-c / a > 1.0 ? 1.0 : -c / a);
+            }
+            else if (t > 1.0)
+            {
+                t = 1.0;
+                s = (b - c) / a < 0.0 ? 0.0 : ((b - c) / a > 1.0 ? 1.0 : (b - c) / a);
+            }
+        }
+    }
+    *c1 = Along(p1, d1, s);
+    *c2 = Along(p2, d2, t);
+    const svxPoint gap = Difference(*c1, *c2);
+    return Dot(gap, gap);
+}
+
+/*******************************************************************/
+/* Function definition */
+double PointTriangleClosest
+(
+const svxPoint &p,       /* I: point */
+const svxPoint t[3],     /* I: triangle */
+svxPoint *closest        /* O: closest point of the triangle */
+)
+/*
+DESCRIPTION:
+   Closest point of a triangle to a point, by the Voronoi regions of its
+vertices and edges (Ericson 5.1.5).
+
+   Return the squared distance.
+*/
+{
+    const svxPoint ab = Difference(t[1], t[0]), ac = Difference(t[2], t[0]), ap = Difference(p, t[0]);
+    const double d1 = Dot(ab, ap), d2 = Dot(ac, ap);
+    if (d1 <= 0.0 && d2 <= 0.0)
+        *closest = t[0];
+    else
+    {
+        const svxPoint bp = Difference(p, t[1]);
+        const double d3 = Dot(ab, bp), d4 = Dot(ac, bp);
+        const svxPoint cp = Difference(p, t[2]);
+        const double d5 = Dot(ab, cp), d6 = Dot(ac, cp);
+        const double vc = d1 * d4 - d3 * d2, vb = d5 * d2 - d1 * d6, va = d3 * d6 - d5 * d4;
+        if (d3 >= 0.0 && d4 <= d3)
+            *closest = t[1];
+        else if (vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0)
+            *closest = Along(t[0], ab, d1 / (d1 - d3));
+        else if (d6 >= 0.0 && d5 <= d6)
+            *closest = t[2];
+        else if (vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0)
+            *closest = Along(t[0], ac, d2 / (d2 - d6));
+        else if (va <= 0.0 && d4 - d3 >= 0.0 && d5 - d6 >= 0.0)
+            *closest = Along(t[1], Difference(t[2], t[1]), (d4 - d3) / ((d4 - d3) + (d5 - d6)));
+        else
+        {
+            const double sum = va + vb + vc;
+            if (!(sum > 0.0))
+                *closest = t[0];
+            else
+                *closest = Along(Along(t[0], ab, vb / sum), ac, vc / sum);
+        }
+    }
+    const svxPoint gap = Difference(p, *closest);
+    return Dot(gap, gap);
+}
+
+/*******************************************************************/
+/* Function definition */
+int SegmentTriangleHit
+(
+const svxPoint &p,       /* I: start of the segment */
+const svxPoint &q,       /* I: end of the segment */
+const svxPoint t[3],     /* I: triangle */
+svxPoint *hit            /* O: point where the segment passes through the triangle */
+)
+/*
+DESCRIPTION:
+   Intersection of a segment with a triangle (Moller-Trumbore). A segment
+in the plane of the triangle does not hit it; such contacts are found by
+the edge distances.
+
+   Return 1 if the segment passes through the triangle, else 0.
+*/
+{
+    const svxPoint d = Difference(q, p), e1 = Difference(t[1], t[0]), e2 = Difference(t[2], t[0]);
+    const svxPoint h = { d.y * e2.z - d.z * e2.y, d.z * e2.x - d.x * e2.z, d.x * e2.y - d.y * e2.x };
+    const double det = Dot(e1, h);
+    if (det == 0.0)
+        return 0;
+    const double inverse = 1.0 / det;
+    const svxPoint s = Difference(p, t[0]);
+    const double u = Dot(s, h) * inverse;
+    if (u < 0.0 || u > 1.0)
+        return 0;
+    const svxPoint g = { s.y * e1.z - s.z * e1.y, s.z * e1.x - s.x * e1.z, s.x * e1.y - s.y * e1.x };
+    const double v = Dot(d, g) * inverse;
+    if (v < 0.0 || u + v > 1.0)
+        return 0;
+    const double w = Dot(e2, g) * inverse;
+    if (w < 0.0 || w > 1.0)
+        return 0;
+    *hit = Along(p, d, w);
+    return 1;
+}
+
+/*******************************************************************/
+/* Function definition */
+double ShapeTriangleDistance
+(
+const svxPoint a[3],     /* I: triangle */
+const svxPoint b[3],     /* I: triangle */
+svxPoint *point1,        /* O: closest point on a */
+svxPoint *point2         /* O: closest point on b */
+)
+/*
+DESCRIPTION:
+   Closest points of two triangles: the closest points of two disjoint
+triangles are on two edges or are a vertex and its foot on the other
+triangle, so the nine edge pairs and six vertices are measured. If the
+vertices of each triangle are not all on one side of the plane of the
+other, an edge may pass through the other triangle, and the distance is
+0 at that point.
+
+   Return the squared distance.
+*/
+{
+    double best = DBL_MAX;
+    svxPoint c1, c2;
+    for (int i = 0; i < 3; i++)
+    {
+        for (int j = 0; j < 3; j++)
+        {
+            const double d = SegmentClosest(a[i], a[(i + 1) % 3], b[j], b[(j + 1) % 3], &c1, &c2);
+            if (d < best)
+            {
+                best = d;
+                *point1 = c1;
+                *point2 = c2;
+            }
+        }
+    }
+    for (int i = 0; i < 3; i++)
+    {
+        double d = PointTriangleClosest(a[i], b, &c2);
+        if (d < best)
+        {
+            best = d;
+            *point1 = a[i];
+            *point2 = c2;
+        }
+        d = PointTriangleClosest(b[i], a, &c1);
+        if (d < best)
+        {
+            best = d;
+            *point1 = c1;
+            *point2 = b[i];
+        }
+    }
+    if (best == 0.0)
+        return 0.0;
+
+    /* an edge through the other triangle needs vertices on both sides of its plane */
+    const svxPoint *triangle[2] = { a, b };
+    int straddle = 1;
+    for (int k = 0; k < 2 && straddle; k++)
+    {
+        const svxPoint *t = triangle[k], *o = triangle[1 - k];
+        const svxPoint e1 = Difference(t[1], t[0]), e2 = Difference(t[2], t[0]);
+        const svxPoint n = { e1.y * e2.z - e1.z * e2.y, e1.z * e2.x - e1.x * e2.z, e1.x * e2.y - e1.y * e2.x };
+        const double s0 = Dot(n, Difference(o[0], t[0])), s1 = Dot(n, Difference(o[1], t[0]));
+        const double s2 = Dot(n, Difference(o[2], t[0]));
+        straddle = !((s0 > 0.0 && s1 > 0.0 && s2 > 0.0) || (s0 < 0.0 && s1 < 0.0 && s2 < 0.0));
+    }
+    if (!straddle)
+        return best;
+    for (int k = 0; k < 2; k++)
+    {
+        const svxPoint *t = triangle[k], *o = triangle[1 - k];
+        for (int i = 0; i < 3; i++)
+        {
+            svxPoint hit;
+            if (SegmentTriangleHit(o[i], o[(i + 1) % 3], t, &hit))
+            {
+                *point1 = *point2 = hit;
+                return 0.0;
+            }
+        }
+    }
+    return best;
+}
+
+/*******************************************************************/
+/* Function definition */
+void TriangleGet
+(
+const TriangleBvh &bvh,        /* I: tree */
+int index,                     /* I: triangle in tree order */
+const SmallTransform *move,    /* I: map into the query space, nullptr for none */
+svxPoint t[3]                  /* O: vertices */
+)
+/*
+DESCRIPTION:
+   Vertices of a triangle of a tree, in double precision.
+*/
+{
+    float v[3][3];
+    bvh.Triangle(index, v[0], v[1], v[2]);
+    for (int i = 0; i < 3; i++)
+    {
+        t[i].x = v[i][0];
+        t[i].y = v[i][1];
+        t[i].z = v[i][2];
+        if (move != nullptr)
+            t[i] = SmallTransformPoint(*move, t[i]);
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+double TrianglesMeasure
+(
+const TriangleBvh &bvh1,           /* I: tree of shape 1 */
+int triangle1,                     /* I: triangle of shape 1 */
+const TriangleBvh &bvh2,           /* I: tree of shape 2 */
+int triangle2,                     /* I: triangle of shape 2 */
+const SmallTransform &relative,    /* I: map from shape 2 to shape 1 */
+svxPoint *point1,                  /* O: closest point on triangle 1, shape 1 space */
+svxPoint *point2                   /* O: closest point on triangle 2, shape 1 space */
+)
+/*
+DESCRIPTION:
+   Measure two triangles of two shapes.
+
+   Return the squared distance.
+*/
+{
+    svxPoint a[3], b[3];
+    TriangleGet(bvh1, triangle1, nullptr, a);
+    TriangleGet(bvh2, triangle2, &relative, b);
+    return ShapeTriangleDistance(a, b, point1, point2);
+}
+
+/*******************************************************************/
+/* Function definition */
+void BoxGet
+(
+const TriangleBvhNode &node,   /* I: node */
+const SmallTransform *move,    /* I: map into the query space, nullptr for none */
+NodeBox *box                   /* O: box holding the moved node box */
+)
+/*
+DESCRIPTION:
+   Box of a node. A moved box is the box of the moved center grown by
+the absolute rotation times the half size.
+*/
+{
+    if (move == nullptr || move->identity)
+    {
+        for (int k = 0; k < 3; k++)
+        {
+            box->low[k] = node.low[k];
+            box->high[k] = node.high[k];
+        }
+        return;
+    }
+    double center[3], half[3];
+    for (int k = 0; k < 3; k++)
+    {
+        center[k] = 0.5 * ((double)node.low[k] + node.high[k]);
+        half[k] = 0.5 * ((double)node.high[k] - node.low[k]);
+    }
+    for (int i = 0; i < 3; i++)
+    {
+        const double *m = move->m[i];
+        const double c = m[0] * center[0] + m[1] * center[1] + m[2] * center[2] + m[3];
+        const double h = fabs(m[0]) * half[0] + fabs(m[1]) * half[1] + fabs(m[2]) * half[2];
+        box->low[i] = c - h;
+        box->high[i] = c + h;
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+void TriangleBox
+(
+const svxPoint t[3],   /* I: triangle */
+NodeBox *box           /* O: box of the triangle */
+)
+/*
+DESCRIPTION:
+   Box of a triangle.
+*/
+{
+    box->low[0] = box->high[0] = t[0].x;
+    box->low[1] = box->high[1] = t[0].y;
+    box->low[2] = box->high[2] = t[0].z;
+    for (int i = 1; i < 3; i++)
+    {
+        const double v[3] = { t[i].x, t[i].y, t[i].z };
+        for (int k = 0; k < 3; k++)
+        {
+            box->low[k] = v[k] < box->low[k] ? v[k] : box->low[k];
+            box->high[k] = v[k] > box->high[k] ? v[k] : box->high[k];
+        }
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+double BoxDistance2
+(
+const NodeBox &a,   /* I: box */
+const NodeBox &b    /* I: box */
+)
+/*
+DESCRIPTION:
+   Squared distance of two boxes, 0 if they overlap.
+*/
+{
+    double d = 0.0;
+    for (int k = 0; k < 3; k++)
+    {
+        const double gap = a.low[k] > b.high[k] ? a.low[k] - b.high[k] : (b.low[k] > a.high[k] ? b.low[k] - a.high[k] : 0.0);
+        d += gap * gap;
+    }
+    return d;
+}
+
+/*******************************************************************/
+/* Function definition */
+ShapeDistance::ShapeDistance
+(
+)
+/*
+DESCRIPTION:
+   Create an engine without shapes.
+*/
+{
+}
+
+/*******************************************************************/
+/* Function definition */
+int ShapeDistance::AddShape
+(
+const TriangleBvh *bvh    /* I: built tree of the facets of a shape, kept by the caller */
+)
+/*
+DESCRIPTION:
+   Add a shape, placed by the identity pose.
+
+   Return the index of the shape, or -1 if the tree is not built.
+*/
+{
+    if (bvh == nullptr || !bvh->IsBuilt())
+        return -1;
+    m_shapes.push_back(bvh);
+    m_poses.push_back(SmallTransformIdentity());
+    return (int)m_shapes.size() - 1;
+}
+
+/*******************************************************************/
+/* Function definition */
+int ShapeDistance::PoseSet
+(
+int shape,                     /* I: shape */
+const SmallTransform &pose     /* I: rigid map from the shape facets to world space */
+)
+/*
+DESCRIPTION:
+   Place a shape, as a component is placed by its matrix (SmallFromZw()
+of the szwMatrix).
+
+   Return 1 if function fails, else 0.
+*/
+{
+    if (shape < 0 || shape >= Count())
+        return 1;
+    m_poses[shape] = pose;
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void ShapeDistance::Clear
+(
+void
+)
+/*
+DESCRIPTION:
+   Remove all shapes.
+*/
+{
+    m_shapes.clear();
+    m_poses.clear();
+}
+
+/*******************************************************************/
+/* Function definition */
+int ShapeDistance::Distance
+(
+int shape1,                     /* I: shape */
+int shape2,                     /* I: shape */
+double limit,                   /* I: largest distance searched (0 = unlimited) */
+ShapeDistanceCache *cache,      /* I/O: closest triangles of the last query of the pair, nullptr for none */
+ShapeDistanceResult *result     /* O: closest points */
+) const
+/*
+DESCRIPTION:
+   Find the closest points of two shapes. The cached triangles are
+measured first; then node pairs are visited nearest first, the larger
+box of a pair being split, and a pair whose boxes are farther than the
+closest triangles found so far is skipped. A moved box is larger than
+the node, so the boxes of a pair are also compared in the space of
+shape 2 and the larger distance is kept. Triangles of two leaves are
+measured only if their own boxes are nearer than the best. The walk
+stops at once when the shapes touch.
+
+   Return 1 if a shape is not valid, else 0 (also when no triangles are
+within "limit": result->face1 is SHAPE_DISTANCE_NONE).
+*/
+{
+    result->distance = limit > 0.0 ? limit : DBL_MAX;
+    result->face1 = result->face2 = SHAPE_DISTANCE_NONE;
+    result->triangle1 = result->triangle2 = SHAPE_DISTANCE_NONE;
+    result->tests = 0;
+    result->refined = 0;
+    if (shape1 < 0 || shape1 >= Count() || shape2 < 0 || shape2 >= Count())
+        return 1;
+
+    const TriangleBvh &bvh1 = *m_shapes[shape1], &bvh2 = *m_shapes[shape2];
+    const SmallTransform &pose1 = m_poses[shape1];
+    SmallTransform inverse;
+    if (SmallTransformInvert(pose1, &inverse))
+        return 1;
+    const SmallTransform relative = SmallTransformMultiply(inverse, m_poses[shape2]);
+    SmallTransform back;
+    if (SmallTransformInvert(relative, &back))
+        return 1;
+
+    double best = limit > 0.0 ? limit * limit : DBL_MAX;
+    svxPoint point1 = {}, point2 = {};
+    if (cache != nullptr && cache->triangle1 >= 0 && cache->triangle1 < bvh1.TriangleCount() &&
+        cache->triangle2 >= 0 && cache->triangle2 < bvh2.TriangleCount())
+    {
+        svxPoint c1, c2;
+        const double d = TrianglesMeasure(bvh1, cache->triangle1, bvh2, cache->triangle2, relative, &c1, &c2);
+        result->tests++;
+        if (d < best)
+        {
+            best = d;
+            point1 = c1;
+            point2 = c2;
+            result->triangle1 = cache->triangle1;
+            result->triangle2 = cache->triangle2;
+        }
+    }
+
+    const TriangleBvhNode *nodes1 = bvh1.Nodes(), *nodes2 = bvh2.Nodes();
+    NodePair stack[SHAPE_DISTANCE_STACK];
+    int top = 0;
+    NodeBox box1, box2;
+    BoxGet(nodes1[0], nullptr, &box1);
+    BoxGet(nodes2[0], &relative, &box2);
+    stack[top].node1 = stack[top].node2 = 0;
+    stack[top].distance2 = BoxDistance2(box1, box2);
+    top += stack[top].distance2 < best ? 1 : 0;
+    while (top > 0 && best > 0.0)
+    {
+        const NodePair pair = stack[--top];
+        if (pair.distance2 >= best)
+            continue;
+        const TriangleBvhNode &n1 = nodes1[pair.node1], &n2 = nodes2[pair.node2];
+        if (n1.count > 0 && n2.count > 0)
+        {
+            /* triangles farther apart than the best by their boxes are not measured. Leaves
+               are larger than TRIANGLE_BVH_LEAF_SIZE when no split is cheaper or the centers
+               coincide, so the triangles of shape 1 are taken that many at a time */
+            svxPoint a[TRIANGLE_BVH_LEAF_SIZE][3], b[3];
+            NodeBox boxes[TRIANGLE_BVH_LEAF_SIZE], box;
+            for (int first = n1.first; first < n1.first + n1.count && best > 0.0; first += TRIANGLE_BVH_LEAF_SIZE)
+            {
+                const int rest = n1.first + n1.count - first;
+                const int count = rest < TRIANGLE_BVH_LEAF_SIZE ? rest : TRIANGLE_BVH_LEAF_SIZE;
+                for (int i = 0; i < count; i++)
+                {
+                    TriangleGet(bvh1, first + i, nullptr, a[i]);
+                    TriangleBox(a[i], &boxes[i]);
+                }
+                for (int j = n2.first; j < n2.first + n2.count && best > 0.0; j++)
+                {
+                    TriangleGet(bvh2, j, &relative, b);
+                    TriangleBox(b, &box);
+                    for (int i = 0; i < count; i++)
+                    {
+                        if (BoxDistance2(boxes[i], box) >= best)
+                            continue;
+                        svxPoint c1, c2;
+                        const double d = ShapeTriangleDistance(a[i], b, &c1, &c2);
+                        result->tests++;
+                        if (d < best)
+                        {
+                            best = d;
+                            point1 = c1;
+                            point2 = c2;
+                            result->triangle1 = first + i;
+                            result->triangle2 = j;
+                        }
+                    }
+                }
+            }
+            continue;
+        }
+
+        /* split the leaf-free node with the larger box */
+        int split1 = n2.count > 0;
+        if (n1.count <= 0 && n2.count <= 0)
+        {
+            double size1 = 0.0, size2 = 0.0;
+            for (int k = 0; k < 3; k++)
+            {
+                size1 += (double)n1.high[k] - n1.low[k];
+                size2 += (double)n2.high[k] - n2.low[k];
+            }
+            split1 = size1 >= size2;
+        }
+        NodePair children[2];
+        for (int c = 0; c < 2; c++)
+        {
+            NodePair &child = children[c];
+            child.node1 = split1 ? (c == 0 ? pair.node1 + 1 : n1.first) : pair.node1;
+            child.node2 = split1 ? pair.node2 : (c == 0 ? pair.node2 + 1 : n2.first);
+            BoxGet(nodes1[child.node1], nullptr, &box1);
+            BoxGet(nodes2[child.node2], &relative, &box2);
+            child.distance2 = BoxDistance2(box1, box2);
+            if (child.distance2 < best)
+            {
+                /* bounded again in the space of shape 2, the larger bound holds */
+                BoxGet(nodes1[child.node1], &back, &box1);
+                BoxGet(nodes2[child.node2], nullptr, &box2);
+                const double other = BoxDistance2(box1, box2);
+                child.distance2 = other > child.distance2 ? other : child.distance2;
+            }
+        }
+        /* the nearer pair is pushed last to be visited first */
+        const int nearer = children[1].distance2 < children[0].distance2 ? 1 : 0;
+        for (int c = 0; c < 2; c++)
+        {
+            const NodePair &child = children[c == 0 ? 1 - nearer : nearer];
+            if (child.distance2 < best && top < SHAPE_DISTANCE_STACK)
+                stack[top++] = child;
+        }
+    }
+
+    if (result->triangle1 == SHAPE_DISTANCE_NONE)
+        return 0;
+    result->distance = sqrt(best);
+    result->point1 = SmallTransformPoint(pose1, point1);
+    result->point2 = SmallTransformPoint(pose1, point2);
+    result->face1 = bvh1.TriangleFace(result->triangle1);
+    result->face2 = bvh2.TriangleFace(result->triangle2);
+    if (cache != nullptr)
+    {
+        cache->triangle1 = result->triangle1;
+        cache->triangle2 = result->triangle2;
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void ShapeDistance::TaskRun
+(
+void *data,    /* I: Batch */
+int begin,     /* I: first pair */
+int end,       /* I: end of the range */
+int /* worker */ /* I: unused */
+)
+/*
+DESCRIPTION:
+   Find the closest points of a range of pairs.
+*/
+{
+    const Batch *batch = (const Batch *)data;
+    for (int i = begin; i < end; i++)
+    {
+        batch->self->Distance(batch->pairs[i].shape1, batch->pairs[i].shape2, batch->limit,
+            batch->caches != nullptr ? &batch->caches[i] : nullptr, &batch->results[i]);
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+int ShapeDistance::DistanceList
+(
+int count,                          /* I: number of pairs */
+const ShapeDistancePair *pairs,     /* I: pairs of shapes */
+double limit,                       /* I: largest distance searched (0 = unlimited) */
+ShapeDistanceRefine refine,         /* I: exact closest points of two faces, nullptr for the facet points */
+void *data,                         /* I: data of "refine" */
+WorkPool *pool,                     /* I: pool running the pairs, nullptr for this thread only */
+ShapeDistanceCache *caches,         /* I/O: cache per pair, nullptr for none */
+ShapeDistanceResult *results        /* O: closest points per pair */
+) const
+/*
+DESCRIPTION:
+   Find the closest points of many pairs of shapes. The facet distances
+run on the pool; the refine callback is then called on this thread for
+every pair within the limit.
+
+   Return 1 if a pair is not valid, else 0.
+*/
+{
+    if (count < 0 || (count > 0 && (pairs == nullptr || results == nullptr)))
+        return 1;
+    Batch batch = { this, pairs, limit, caches, results };
+    if (pool != nullptr)
+        pool->Run(count, SHAPE_DISTANCE_GRAIN, TaskRun, &batch);
+    else
+        TaskRun(&batch, 0, count, 0);
+
+    int failed = 0;
+    for (int i = 0; i < count; i++)
+    {
+        ShapeDistanceResult &result = results[i];
+        failed |= pairs[i].shape1 < 0 || pairs[i].shape1 >= Count() || pairs[i].shape2 < 0 ||
+            pairs[i].shape2 >= Count();
+        if (refine == nullptr || result.face1 == SHAPE_DISTANCE_NONE)
+            continue;
+        svxPoint point1 = result.point1, point2 = result.point2;
+        if (refine(data, pairs[i].shape1, result.face1, pairs[i].shape2, result.face2, &point1, &point2))
+            continue;
+        const svxPoint gap = Difference(point1, point2);
+        result.point1 = point1;
+        result.point2 = point2;
+        result.distance = sqrt(Dot(gap, gap));
+        result.refined = 1;
+    }
+    return failed;
+}
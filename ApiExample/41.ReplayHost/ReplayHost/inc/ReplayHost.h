@@ -0,0 +1,55 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+#pragma once
+
+/* ZW3D API includes */
+#include "zwapi_util.h"
+
+/* Application includes */
+#include "ReplayTrace.h"
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: counters since the last ReplayHostStatsReset() */
+struct ReplayStats
+{
+    long long calls;                          /* replayed calls */
+    long long misses;                         /* calls not found in the trace */
+    double latency;                           /* latency added to the calls (second) */
+    long long callCount[Replay_CallCount];    /* calls of each ReplayCall */
+    long long missCount[Replay_CallCount];    /* misses of each ReplayCall */
+};
+
+/*******************************************************************/
+/* Function declarations */
+/*
+DESCRIPTION:
+   Control of the stand-in host. The stand-in library exports the ZW3D
+API functions of the replayed calls; an add-on linked against it gets
+the answers of the trace opened with ReplayHostOpen(), or of the file
+named by the environment variable ZW_REPLAY_TRACE on the first call.
+
+   A call is found by its inputs. Calls recorded more than once with the
+same inputs answer in the recorded order, and the last answer repeats,
+so a flow can be replayed any number of times.
+
+   The latency of a call is a fixed time per call (ReplayHostLatencySet(),
+ZW_REPLAY_LATENCY_US) plus the time the call took in the recording host
+times a scale (ReplayHostLatencyScaleSet(), ZW_REPLAY_LATENCY_SCALE),
+spent busy-waiting so short latencies are kept.
+*/
+int ReplayHostOpen(const char *path);
+void ReplayHostClose(void);
+void ReplayHostRewind(void);
+void ReplayHostLatencySet(int call, double micros);
+void ReplayHostLatencyScaleSet(double scale);
+void ReplayHostStatsGet(ReplayStats *stats);
+void ReplayHostStatsReset(void);
+
+/* used by the replayed API functions */
+int ReplayHostFind(int call, const TraceBuffer &key, TraceReader *reply);
+szwEntityHandle ReplayHostHandle(int id);
+int ReplayHostHandleId(szwEntityHandle handle);
+void ReplayHostHandleListGet(TraceReader &in, int *count, szwEntityHandle **handles);
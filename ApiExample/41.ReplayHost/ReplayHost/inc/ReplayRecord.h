@@ -0,0 +1,31 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+#pragma once
+
+/* Application includes */
+#include "ReplayTrace.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define REPLAY_EXPORT_NAME "test.png"      /* image of the recorded file export, as FileExport */
+#define REPLAY_FACET_ANGLE 5.0             /* angle tolerance of the recorded facets (degree) */
+#define REPLAY_FACET_SURFACE 1.0           /* surface tolerance of the recorded facets */
+
+/*******************************************************************/
+/* Function declarations */
+/*
+DESCRIPTION:
+   Recording of a trace. The functions call the ZW3D API and add each call
+to the trace with its inputs, outputs, return code and time. They walk
+the whole topology of the shapes, so an add-on replayed against the
+trace finds every inquiry it can make on them; the facets are recorded
+with one distance tolerance (ZW_FACETS_TOLORANCE_DISTANCE, edge and
+facet tolerance "tolerance", REPLAY_FACET_ANGLE, REPLAY_FACET_SURFACE),
+which a replayed add-on must ask for.
+*/
+int ReplayRecordPick(TraceWriter *trace);
+int ReplayRecordPart(double tolerance, TraceWriter *trace);
+int ReplayRecordShape(int idShape, double tolerance, TraceWriter *trace);
+int ReplayRecordExport(TraceWriter *trace);
@@ -0,0 +1,179 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+#pragma once
+
+/* ZW3D API includes */
+#include "zwapi_util.h"
+#include "zwapi_brep_data.h"
+#include "zwapi_matrix_data.h"
+
+/* Application includes */
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+/*******************************************************************/
+/* Constant definitions */
+#define REPLAY_TRACE_MAGIC "ZWRT"
+#define REPLAY_TRACE_VERSION 1       /* version of the trace file */
+
+/*******************************************************************/
+/* Data type definitions */
+/*
+DESCRIPTION:
+   Recorded API calls. The numbers are stored in trace files: append new
+calls at the end and never renumber.
+*/
+enum ReplayCall
+{
+    Replay_None = 0,
+    Replay_PartInqShapes,
+    Replay_PartInqShapeFaces,
+    Replay_PartInqShapeEdges,
+    Replay_PartInqFaceLoops,
+    Replay_PartInqLoopEdges,
+    Replay_PartInqLoopInner,
+    Replay_PartInqEdgeFaces,
+    Replay_PartInqEdgeCrv,
+    Replay_PartInqVertexEdges,
+    Replay_PartInqFaceFacets2,
+    Replay_ShapeFaceListGet,
+    Replay_FaceEdgeListGet,
+    Replay_EdgeFaceListGet,
+    Replay_FaceFacetsGet,
+    Replay_FaceListFacetsGet,
+    Replay_EntityTypeNumberGet,
+    Replay_EntityBoundingBoxGet,
+    Replay_EntityUniqueIdGet,
+    Replay_EntityListGetByPick,
+    Replay_FileInqActive,
+    Replay_FileDirectory,
+    Replay_PathCompose,
+    Replay_DispWindowRectGet,
+    Replay_FileExport,
+    Replay_CallCount
+};
+
+/*
+DESCRIPTION:
+   Bytes of a call key or of a reply. Integers are stored as zigzag
+variable-length integers (small ids take one or two bytes), doubles and
+floats as their little-endian bytes, texts with their length.
+*/
+class TraceBuffer
+{
+public:
+    void Int(int value);
+    void Double(double value);
+    void Float(float value);
+    void Text(const char *text);
+    void Bytes(const void *data, int bytes);
+
+    const std::string &Data(void) const { return m_data; }
+    void Clear(void) { m_data.clear(); }
+
+private:
+    std::string m_data;
+};
+
+/*
+DESCRIPTION:
+   Reading position in a key or reply. Every read checks the end; past
+the end, or on bad data, the reads answer zero and Failed() is set.
+*/
+class TraceReader
+{
+public:
+    TraceReader();
+    TraceReader(const void *data, size_t bytes);
+
+    uint64_t Varint(void);
+    int Int(void);
+    double Double(void);
+    float Float(void);
+    void Text(char *text, int size);
+    void Bytes(void *data, int bytes);
+    const unsigned char *Skip(uint64_t bytes);
+    int Count(int itemBytes);
+
+    int Failed(void) const { return m_failed; }
+    int End(void) const { return m_offset == m_size; }
+
+private:
+    const unsigned char *m_data;
+    size_t m_size;
+    size_t m_offset;
+    int m_failed;
+};
+
+/* DESCRIPTION: one call of a trace, pointing into the loaded file */
+struct TraceRecord
+{
+    int call;                 /* ReplayCall */
+    int result;               /* return code of the call */
+    int micros;               /* time of the call in the recording host (microsecond) */
+    const unsigned char *key;
+    int keyBytes;
+    const unsigned char *reply;
+    int replyBytes;
+};
+
+/*
+DESCRIPTION:
+   Writer of a trace file. The records are kept in memory and written by
+Close() behind a header, followed by a checksum of all bytes.
+*/
+class TraceWriter
+{
+public:
+    TraceWriter();
+
+    void Add(int call, const TraceBuffer &key, int result, const TraceBuffer &reply, int micros);
+    int Close(const char *path);
+
+    int Count(void) const { return m_count; }
+    long long Bytes(void) const { return (long long)m_records.size(); }
+
+private:
+    std::string m_records;
+    int m_count;
+};
+
+/*
+DESCRIPTION:
+   Loaded trace file. Open() takes the file only if the magic, the version
+and the checksum match; the records point into the loaded bytes.
+*/
+class TraceFile
+{
+public:
+    int Open(const char *path);
+
+    int Count(void) const { return (int)m_records.size(); }
+    const TraceRecord &Record(int index) const { return m_records[index]; }
+
+private:
+    std::vector<unsigned char> m_data;
+    std::vector<TraceRecord> m_records;
+};
+
+/*******************************************************************/
+/* Function declarations */
+const char *ReplayCallName(int call);
+
+void TraceIntListPut(TraceBuffer &out, int count, const int *list);
+void TraceIntListGet(TraceReader &in, int *count, int **list);
+void TraceMatrixPut(TraceBuffer &out, const svxMatrix &matrix);
+void TraceMatrixGet(TraceReader &in, svxMatrix *matrix);
+void TraceZwMatrixPut(TraceBuffer &out, const szwMatrix &matrix);
+void TraceRefinePut(TraceBuffer &out, const szwRefineFacetsOfMultiFace &refine, const int *faceIds);
+void TraceBoxPut(TraceBuffer &out, const svxBndBox &box);
+void TraceBoxGet(TraceReader &in, svxBndBox *box);
+void TraceCurvePut(TraceBuffer &out, const svxCurve &curve);
+void TraceCurveGet(TraceReader &in, svxCurve *curve);
+void TraceFacetsPut(TraceBuffer &out, const svxFacets &facets);
+void TraceFacetsGet(TraceReader &in, svxFacets *facets);
+void TraceZwFacetsPut(TraceBuffer &out, const szwFacets &facets);
+void TraceZwFacetsGet(TraceReader &in, szwFacets *facets);
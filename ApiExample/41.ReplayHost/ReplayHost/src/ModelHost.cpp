@@ -0,0 +1,1191 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* ZW3D API includes */
+#include "zwapi_brep_shape.h"   /* first, its include guard is the one of zwapi_shape.h */
+#include "zwapi_brep_edge.h"
+#include "zwapi_brep_face.h"
+#include "zwapi_brep_loop.h"
+#include "zwapi_brep_vertex.h"
+#include "zwapi_display.h"
+#include "zwapi_edge.h"
+#include "zwapi_entity.h"
+#include "zwapi_face.h"
+#include "zwapi_file.h"
+#include "zwapi_file_path.h"
+#include "zwapi_math_matrix.h"
+#include "zwapi_memory.h"
+#include "zwapi_part_facets.h"
+#include "zwapi_part_objs.h"
+#include "zwapi_shape.h"
+
+/*******************************************************************/
+/* Application includes */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <memory>
+#include <unordered_map>
+#include "ReplayRecord.h"
+
+/*
+DESCRIPTION:
+   Synthetic model host, the "ReplayModel" tool of the Linux build. It
+answers the calls of ReplayRecord.cpp for a row of boxes, so a trace can
+be recorded without ZW3D and replayed by the stand-in host:
+
+   ReplayModel <trace> [boxes] [tolerance]
+
+   Each box is a shape of 6 faces with one loop each and 12 line edges.
+The ids of box "s" start at 1 + s * MODEL_IDS: the shape, then the faces,
+the loops and the edges. The facets of a face are a grid of triangle
+strips, finer for a smaller distance tolerance.
+*/
+
+/*******************************************************************/
+/* Constant definitions */
+#define MODEL_IDS 64              /* ids of a box */
+#define MODEL_FACE 1              /* first face id of a box */
+#define MODEL_LOOP 7              /* first loop id of a box */
+#define MODEL_EDGE 13             /* first edge id of a box */
+#define MODEL_SIZE 10.0           /* box size (mm) */
+#define MODEL_STEP 15.0           /* box spacing along X (mm) */
+#define MODEL_GRID 8              /* grid of cvxPartInqFaceFacets2() */
+#define MODEL_GRID_MAX 64         /* finest grid of the refined facets */
+#define DEFAULT_BOXES 20
+#define DEFAULT_TOLERANCE 0.1     /* facet distance tolerance (mm) */
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: inner data of a model handle, one for each entity id */
+struct szwEntityInnerData
+{
+    int id;
+};
+
+/* DESCRIPTION: entity of an id */
+struct ModelEntity
+{
+    ezwEntityType type;    /* 0 if the id is not in the model */
+    int box;
+    int index;             /* face, loop or edge index in the box */
+};
+
+/*******************************************************************/
+/* Function declarations */
+static int &BoxCount(void);
+static ModelEntity Entity(int id);
+static int EntityIdOf(int box, int first, int index);
+static szwEntityHandle Handle(int id);
+static int HandleId(szwEntityHandle handle);
+static int IdList(int count, const int *ids, int *Count, int **List);
+static int HandleList(int count, const int *ids, int *count2, szwEntityHandle **list);
+static void FaceEdges(int face, int edges[4]);
+static void EdgeFaces(int edge, int faces[2]);
+static void EdgePoint(int box, int edge, int end, double point[3]);
+static int Grid(double tolerance);
+static int FaceMesh(int box, int face, int grid, int *stripCount, int **strips, int *vertexCount, float **vertices,
+                    float **normals, float **st);
+
+/*******************************************************************/
+/* Function definition */
+int &BoxCount
+(
+void
+)
+/*
+DESCRIPTION:
+   Number of boxes of the model.
+*/
+{
+    static int count = DEFAULT_BOXES;
+    return count;
+}
+
+/*******************************************************************/
+/* Function definition */
+ModelEntity Entity
+(
+int id   /* I: entity id */
+)
+/*
+DESCRIPTION:
+   Entity of an id, a zero type if the id is not in the model.
+*/
+{
+    ModelEntity entity = { (ezwEntityType)0, 0, 0 };
+    if (id < 1 || (id - 1) / MODEL_IDS >= BoxCount())
+        return entity;
+    const int offset = (id - 1) % MODEL_IDS;
+    entity.box = (id - 1) / MODEL_IDS;
+    if (offset == 0)
+        entity.type = ZW_ENTITY_SHAPE;
+    else if (offset < MODEL_LOOP)
+        entity.type = ZW_ENTITY_FACE, entity.index = offset - MODEL_FACE;
+    else if (offset < MODEL_EDGE)
+        entity.type = ZW_ENTITY_LOOP, entity.index = offset - MODEL_LOOP;
+    else if (offset < MODEL_EDGE + 12)
+        entity.type = ZW_ENTITY_EDGE, entity.index = offset - MODEL_EDGE;
+    return entity;
+}
+
+/*******************************************************************/
+/* Function definition */
+int EntityIdOf
+(
+int box,      /* I: box index */
+int first,    /* I: MODEL_FACE, MODEL_LOOP or MODEL_EDGE, 0 for the shape */
+int index     /* I: index of the entity in the box */
+)
+/*
+DESCRIPTION:
+   Entity id of an entity of a box.
+*/
+{
+    return 1 + box * MODEL_IDS + first + index;
+}
+
+/*******************************************************************/
+/* Function definition */
+szwEntityHandle Handle
+(
+int id   /* I: entity id */
+)
+/*
+DESCRIPTION:
+   Handle of an entity id, the same inner data for the same id.
+*/
+{
+    static std::unordered_map<int, std::unique_ptr<szwEntityInnerData>> handles;
+    std::unique_ptr<szwEntityInnerData> &data = handles[id];
+    if (!data)
+    {
+        data.reset(new szwEntityInnerData);
+        data->id = id;
+    }
+    szwEntityHandle handle;
+    handle.innerData = data.get();
+    return handle;
+}
+
+/*******************************************************************/
+/* Function definition */
+int HandleId
+(
+szwEntityHandle handle   /* I: handle */
+)
+/*
+DESCRIPTION:
+   Entity id of a handle, 0 for an empty handle.
+*/
+{
+    return handle.innerData != nullptr ? handle.innerData->id : 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int IdList
+(
+int count,         /* I: number of ids */
+const int *ids,    /* I: ids */
+int *Count,        /* O: number of ids */
+int **List         /* O: copy of the ids, free with cvxMemFree() */
+)
+/*
+DESCRIPTION:
+   Answer a list of ids as the cvxPartInq functions do.
+
+   Return an evxErrors code.
+*/
+{
+    if (Count == nullptr || List == nullptr)
+        return ZW_API_INVALID_OUTPUT;
+    *Count = count;
+    *List = (int *)malloc(sizeof(int) * (size_t)(count > 0 ? count : 1));
+    if (*List == nullptr)
+        return ZW_API_MEMORY_ERROR;
+    if (count > 0)
+        memcpy(*List, ids, sizeof(int) * (size_t)count);
+    return ZW_API_NO_ERROR;
+}
+
+/*******************************************************************/
+/* Function definition */
+int HandleList
+(
+int count,                    /* I: number of ids */
+const int *ids,               /* I: ids */
+int *count2,                  /* O: number of handles */
+szwEntityHandle **list        /* O: handles, free with ZwEntityHandleListFree() */
+)
+/*
+DESCRIPTION:
+   Answer a list of ids as handles.
+
+   Return an ezwErrors code.
+*/
+{
+    if (count2 == nullptr || list == nullptr)
+        return ZW_API_INVALID_OUTPUT;
+    *count2 = count;
+    *list = (szwEntityHandle *)calloc((size_t)(count > 0 ? count : 1), sizeof(szwEntityHandle));
+    if (*list == nullptr)
+        return ZW_API_MEMORY_ERROR;
+    for (int i = 0; i < count; i++)
+        (*list)[i] = Handle(ids[i]);
+    return ZW_API_NO_ERROR;
+}
+
+/*******************************************************************/
+/* Function definition */
+void FaceEdges
+(
+int face,        /* I: face index: axis * 2 + side */
+int edges[4]     /* O: edge indexes around the face */
+)
+/*
+DESCRIPTION:
+   Edges of a face. Edge "d * 4 + sb + 2 * sc" runs along axis "d" at side
+"sb" of axis (d + 1) % 3 and side "sc" of axis (d + 2) % 3.
+*/
+{
+    const int a = face / 2, side = face % 2;
+    const int u = (a + 1) % 3, v = (a + 2) % 3;
+    edges[0] = u * 4 + 0 + 2 * side;
+    edges[1] = v * 4 + side + 2;
+    edges[2] = u * 4 + 1 + 2 * side;
+    edges[3] = v * 4 + side;
+}
+
+/*******************************************************************/
+/* Function definition */
+void EdgeFaces
+(
+int edge,        /* I: edge index */
+int faces[2]     /* O: face indexes of the edge */
+)
+/*
+DESCRIPTION:
+   The two faces of an edge.
+*/
+{
+    const int d = edge / 4, sb = edge % 2, sc = (edge / 2) % 2;
+    faces[0] = ((d + 1) % 3) * 2 + sb;
+    faces[1] = ((d + 2) % 3) * 2 + sc;
+}
+
+/*******************************************************************/
+/* Function definition */
+void EdgePoint
+(
+int box,            /* I: box index */
+int edge,           /* I: edge index */
+int end,            /* I: 0 for the start, 1 for the end */
+double point[3]     /* O: vertex */
+)
+/*
+DESCRIPTION:
+   Vertex of an edge.
+*/
+{
+    const int d = edge / 4;
+    point[d] = end * MODEL_SIZE;
+    point[(d + 1) % 3] = (edge % 2) * MODEL_SIZE;
+    point[(d + 2) % 3] = ((edge / 2) % 2) * MODEL_SIZE;
+    point[0] += box * MODEL_STEP;
+}
+
+/*******************************************************************/
+/* Function definition */
+int Grid
+(
+double tolerance   /* I: facet distance tolerance */
+)
+/*
+DESCRIPTION:
+   Grid of the facets of a face for a tolerance.
+*/
+{
+    if (!(tolerance > 0.0))
+        return MODEL_GRID;
+    const int grid = (int)ceil(sqrt(MODEL_SIZE / tolerance));
+    return grid < 1 ? 1 : (grid > MODEL_GRID_MAX ? MODEL_GRID_MAX : grid);
+}
+
+/*******************************************************************/
+/* Function definition */
+int FaceMesh
+(
+int box,             /* I: box index */
+int face,            /* I: face index */
+int grid,            /* I: cells along each side */
+int *stripCount,     /* O: number of strips */
+int **strips,        /* O: strips */
+int *vertexCount,    /* O: number of vertices */
+float **vertices,    /* O: vertices (x,y,z) */
+float **normals,     /* O: normals (i,j,k) */
+float **st           /* O: texture coordinates (s,t) */
+)
+/*
+DESCRIPTION:
+   Grid of triangle strips of a face, one strip for each row of cells.
+The lists are allocated with malloc().
+
+   Return 1 if function fails, else 0.
+*/
+{
+    const int a = face / 2, side = face % 2;
+    const int u = (a + 1) % 3, v = (a + 2) % 3;
+    const int row = grid + 1;
+    *stripCount = grid;
+    *vertexCount = row * row;
+    *strips = (int *)malloc(sizeof(int) * (size_t)(grid * (1 + 2 * row)));
+    *vertices = (float *)malloc(sizeof(float) * 3 * (size_t)*vertexCount);
+    *normals = (float *)malloc(sizeof(float) * 3 * (size_t)*vertexCount);
+    *st = (float *)malloc(sizeof(float) * 2 * (size_t)*vertexCount);
+    if (*strips == nullptr || *vertices == nullptr || *normals == nullptr || *st == nullptr)
+        return 1;
+
+    for (int j = 0; j < row; j++)
+    {
+        for (int i = 0; i < row; i++)
+        {
+            const int k = j * row + i;
+            float *p = *vertices + 3 * k, *n = *normals + 3 * k;
+            p[a] = (float)(side * MODEL_SIZE);
+            p[u] = (float)(MODEL_SIZE * i / grid);
+            p[v] = (float)(MODEL_SIZE * j / grid);
+            p[0] += (float)(box * MODEL_STEP);
+            n[0] = n[1] = n[2] = 0.0f;
+            n[a] = side ? 1.0f : -1.0f;
+            (*st)[2 * k] = (float)i / grid;
+            (*st)[2 * k + 1] = (float)j / grid;
+        }
+    }
+
+    /* triangle (0,1,2) of a strip faces the outside of the box */
+    int *out = *strips;
+    for (int j = 0; j < grid; j++)
+    {
+        *out++ = 2 * row;
+        for (int i = 0; i < row; i++)
+        {
+            *out++ = (j + side) * row + i;
+            *out++ = (j + 1 - side) * row + i;
+        }
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+evxErrors cvxPartInqShapes
+(
+const vxLongPath /* File */,  /* I: file, empty for the active one */
+const vxRootName /* Part */,  /* I: part, empty for the active one */
+int *Count,                   /* O: number of shapes */
+int **Shapes                  /* O: shape ids */
+)
+/*
+DESCRIPTION:
+   The boxes.
+*/
+{
+    int *ids = (int *)malloc(sizeof(int) * (size_t)(BoxCount() > 0 ? BoxCount() : 1));
+    if (ids == nullptr)
+        return ZW_API_MEMORY_ERROR;
+    for (int s = 0; s < BoxCount(); s++)
+        ids[s] = EntityIdOf(s, 0, 0);
+    const int result = IdList(BoxCount(), ids, Count, Shapes);
+    free(ids);
+    return (evxErrors)result;
+}
+
+/*******************************************************************/
+/* Function definition */
+evxErrors cvxPartInqShapeFaces
+(
+int idShape,    /* I: shape id */
+int *Count,     /* O: number of faces */
+int **Faces     /* O: face ids */
+)
+/*
+DESCRIPTION:
+   The 6 faces of a box.
+*/
+{
+    const ModelEntity shape = Entity(idShape);
+    if (shape.type != ZW_ENTITY_SHAPE)
+        return ZW_API_INVALID_INPUT;
+    int ids[6];
+    for (int f = 0; f < 6; f++)
+        ids[f] = EntityIdOf(shape.box, MODEL_FACE, f);
+    return (evxErrors)IdList(6, ids, Count, Faces);
+}
+
+/*******************************************************************/
+/* Function definition */
+evxErrors cvxPartInqShapeEdges
+(
+int idShape,    /* I: shape id */
+int *Count,     /* O: number of edges */
+int **Edges     /* O: edge ids */
+)
+/*
+DESCRIPTION:
+   The 12 edges of a box.
+*/
+{
+    const ModelEntity shape = Entity(idShape);
+    if (shape.type != ZW_ENTITY_SHAPE)
+        return ZW_API_INVALID_INPUT;
+    int ids[12];
+    for (int e = 0; e < 12; e++)
+        ids[e] = EntityIdOf(shape.box, MODEL_EDGE, e);
+    return (evxErrors)IdList(12, ids, Count, Edges);
+}
+
+/*******************************************************************/
+/* Function definition */
+evxErrors cvxPartInqFaceLoops
+(
+int idFace,       /* I: face id */
+int /* Inner */,  /* I: 1 to include the inner loops */
+int *Count,       /* O: number of loops */
+int **Loops       /* O: loop ids */
+)
+/*
+DESCRIPTION:
+   The outer loop of a face, there are no inner ones.
+*/
+{
+    const ModelEntity face = Entity(idFace);
+    if (face.type != ZW_ENTITY_FACE)
+        return ZW_API_INVALID_INPUT;
+    const int id = EntityIdOf(face.box, MODEL_LOOP, face.index);
+    return (evxErrors)IdList(1, &id, Count, Loops);
+}
+
+/*******************************************************************/
+/* Function definition */
+evxErrors cvxPartInqLoopEdges
+(
+int idLoop,     /* I: loop id */
+int *Count,     /* O: number of edges */
+int **Edges     /* O: edge ids */
+)
+/*
+DESCRIPTION:
+   The 4 edges around the face of a loop.
+*/
+{
+    const ModelEntity loop = Entity(idLoop);
+    if (loop.type != ZW_ENTITY_LOOP)
+        return ZW_API_INVALID_INPUT;
+    int edges[4];
+    FaceEdges(loop.index, edges);
+    for (int i = 0; i < 4; i++)
+        edges[i] = EntityIdOf(loop.box, MODEL_EDGE, edges[i]);
+    return (evxErrors)IdList(4, edges, Count, Edges);
+}
+
+/*******************************************************************/
+/* Function definition */
+evxErrors cvxPartInqLoopInner
+(
+int idLoop,     /* I: loop id */
+int *Inner      /* O: 1 if inner */
+)
+/*
+DESCRIPTION:
+   All loops are outer ones.
+*/
+{
+    if (Entity(idLoop).type != ZW_ENTITY_LOOP)
+        return ZW_API_INVALID_INPUT;
+    if (Inner == nullptr)
+        return ZW_API_INVALID_OUTPUT;
+    *Inner = 0;
+    return ZW_API_NO_ERROR;
+}
+
+/*******************************************************************/
+/* Function definition */
+evxErrors cvxPartInqEdgeFaces
+(
+int idEdge,     /* I: edge id */
+int *Count,     /* O: number of faces */
+int **Faces     /* O: face ids */
+)
+/*
+DESCRIPTION:
+   The 2 faces of an edge.
+*/
+{
+    const ModelEntity edge = Entity(idEdge);
+    if (edge.type != ZW_ENTITY_EDGE)
+        return ZW_API_INVALID_INPUT;
+    int faces[2];
+    EdgeFaces(edge.index, faces);
+    for (int i = 0; i < 2; i++)
+        faces[i] = EntityIdOf(edge.box, MODEL_FACE, faces[i]);
+    return (evxErrors)IdList(2, faces, Count, Faces);
+}
+
+/*******************************************************************/
+/* Function definition */
+evxErrors cvxPartInqEdgeCrv
+(
+int idEdge,      /* I: edge id */
+int idFace,      /* I: face id, 0 for the 3D curve */
+svxCurve *Crv    /* O: line, in the (s,t) space of the face for a face */
+)
+/*
+DESCRIPTION:
+   Line of an edge, in 3D or on one of its faces.
+*/
+{
+    const ModelEntity edge = Entity(idEdge);
+    if (edge.type != ZW_ENTITY_EDGE)
+        return ZW_API_INVALID_INPUT;
+    if (Crv == nullptr)
+        return ZW_API_INVALID_OUTPUT;
+    memset(Crv, 0, sizeof(*Crv));
+    cvxMatInit(&Crv->Frame);
+    Crv->Type = VX_CRV_LINE;
+    double start[3], end[3];
+    EdgePoint(edge.box, edge.index, 0, start);
+    EdgePoint(edge.box, edge.index, 1, end);
+    if (idFace != 0)
+    {
+        const ModelEntity face = Entity(idFace);
+        int faces[2];
+        EdgeFaces(edge.index, faces);
+        if (face.type != ZW_ENTITY_FACE || face.box != edge.box ||
+            (face.index != faces[0] && face.index != faces[1]))
+            return ZW_API_INVALID_INPUT;
+        const int u = (face.index / 2 + 1) % 3, v = (face.index / 2 + 2) % 3;
+        start[0] -= edge.box * MODEL_STEP;
+        end[0] -= edge.box * MODEL_STEP;
+        const double s1 = start[u] / MODEL_SIZE, t1 = start[v] / MODEL_SIZE;
+        const double s2 = end[u] / MODEL_SIZE, t2 = end[v] / MODEL_SIZE;
+        start[0] = s1, start[1] = t1, start[2] = 0.0;
+        end[0] = s2, end[1] = t2, end[2] = 0.0;
+    }
+    Crv->P1.x = start[0], Crv->P1.y = start[1], Crv->P1.z = start[2];
+    Crv->P2.x = end[0], Crv->P2.y = end[1], Crv->P2.z = end[2];
+    return ZW_API_NO_ERROR;
+}
+
+/*******************************************************************/
+/* Function definition */
+evxErrors cvxPartInqVertexEdges
+(
+int idEdge,     /* I: edge id */
+int EndPnt,     /* I: 0 for the start vertex, 1 for the end vertex */
+int *Count,     /* O: number of edges */
+int **Edges     /* O: edge ids */
+)
+/*
+DESCRIPTION:
+   The 3 edges at a vertex of an edge.
+*/
+{
+    const ModelEntity edge = Entity(idEdge);
+    if (edge.type != ZW_ENTITY_EDGE)
+        return ZW_API_INVALID_INPUT;
+    const int d = edge.index / 4;
+    int corner[3];
+    corner[d] = EndPnt ? 1 : 0;
+    corner[(d + 1) % 3] = edge.index % 2;
+    corner[(d + 2) % 3] = (edge.index / 2) % 2;
+    int ids[3];
+    for (int axis = 0; axis < 3; axis++)
+        ids[axis] = EntityIdOf(edge.box, MODEL_EDGE, axis * 4 + corner[(axis + 1) % 3] + 2 * corner[(axis + 2) % 3]);
+    return (evxErrors)IdList(3, ids, Count, Edges);
+}
+
+/*******************************************************************/
+/* Function definition */
+evxErrors cvxPartInqFaceFacets2
+(
+int idFace,          /* I: face id */
+svxFacets *Facets    /* O: facets, free with cvxFacetsFree() */
+)
+/*
+DESCRIPTION:
+   Facets of a face on a grid of MODEL_GRID.
+*/
+{
+    const ModelEntity face = Entity(idFace);
+    if (face.type != ZW_ENTITY_FACE)
+        return ZW_API_INVALID_INPUT;
+    if (Facets == nullptr)
+        return ZW_API_INVALID_OUTPUT;
+    memset(Facets, 0, sizeof(*Facets));
+    if (FaceMesh(face.box, face.index, MODEL_GRID, &Facets->numTriStrip, &Facets->TriStrip, &Facets->numVertex,
+                 (float **)&Facets->Vertex, (float **)&Facets->Normal, (float **)&Facets->ST))
+    {
+        cvxFacetsFree(Facets);
+        return ZW_API_MEMORY_ERROR;
+    }
+    return ZW_API_NO_ERROR;
+}
+
+/*******************************************************************/
+/* Function definition */
+void cvxFacetsFree
+(
+svxFacets *Facets   /* I/O: facets */
+)
+/*
+DESCRIPTION:
+   Free the lists of facets.
+*/
+{
+    if (Facets == nullptr)
+        return;
+    free(Facets->TriStrip);
+    free(Facets->Vertex);
+    free(Facets->Normal);
+    free(Facets->ST);
+    free(Facets->UV);
+    free(Facets->RGB);
+    memset(Facets, 0, sizeof(*Facets));
+}
+
+/*******************************************************************/
+/* Function definition */
+ezwErrors ZwFaceFacetsGet
+(
+szwRefineFacets refineData,   /* I: face and tolerances */
+szwFacets *facetsData         /* O: facets, free with ZwFaceFacetsDataFree() */
+)
+/*
+DESCRIPTION:
+   Facets of a face on the grid of the facet tolerance.
+*/
+{
+    const ModelEntity face = Entity(HandleId(refineData.faceHandle));
+    if (face.type != ZW_ENTITY_FACE)
+        return ZW_API_INVALID_INPUT;
+    if (facetsData == nullptr)
+        return ZW_API_INVALID_OUTPUT;
+    memset(facetsData, 0, sizeof(*facetsData));
+    if (FaceMesh(face.box, face.index, Grid(refineData.facetTolorance), &facetsData->numberTriangleStrip,
+                 &facetsData->triangleStrip, &facetsData->numberVertex, (float **)&facetsData->vertex,
+                 (float **)&facetsData->normal, (float **)&facetsData->st))
+    {
+        ZwFaceFacetsDataFree(facetsData);
+        return ZW_API_MEMORY_ERROR;
+    }
+    return ZW_API_NO_ERROR;
+}
+
+/*******************************************************************/
+/* Function definition */
+ezwErrors ZwFaceListFacetsGet
+(
+szwRefineFacetsOfMultiFace refineData,   /* I: faces and tolerances */
+int *count,                              /* O: number of facets */
+szwFacets **facetsData                   /* O: facets of each face */
+)
+/*
+DESCRIPTION:
+   Facets of each face, as ZwFaceFacetsGet().
+*/
+{
+    if (refineData.countFace < 1 || refineData.faceHandle == nullptr)
+        return ZW_API_INVALID_INPUT;
+    if (count == nullptr || facetsData == nullptr)
+        return ZW_API_INVALID_OUTPUT;
+    *count = 0;
+    *facetsData = (szwFacets *)calloc((size_t)refineData.countFace, sizeof(szwFacets));
+    if (*facetsData == nullptr)
+        return ZW_API_MEMORY_ERROR;
+    szwRefineFacets refine;
+    refine.type = refineData.type;
+    refine.edgeTolorance = refineData.edgeTolorance;
+    refine.facetTolorance = refineData.facetTolorance;
+    refine.angleTolorance = refineData.angleTolorance;
+    refine.surfaceTolorance = refineData.surfaceTolorance;
+    for (int i = 0; i < refineData.countFace; i++)
+    {
+        refine.faceHandle = refineData.faceHandle[i];
+        const ezwErrors result = ZwFaceFacetsGet(refine, &(*facetsData)[i]);
+        if (result != ZW_API_NO_ERROR)
+        {
+            for (int k = 0; k < i; k++)
+                ZwFaceFacetsDataFree(&(*facetsData)[k]);
+            ZwMemoryFree((void **)facetsData);
+            return result;
+        }
+    }
+    *count = refineData.countFace;
+    return ZW_API_NO_ERROR;
+}
+
+/*******************************************************************/
+/* Function definition */
+ezwErrors ZwFaceFacetsDataFree
+(
+szwFacets *facetsData   /* I/O: facets */
+)
+/*
+DESCRIPTION:
+   Free the lists of facets.
+*/
+{
+    if (facetsData == nullptr)
+        return ZW_API_INVALID_INPUT;
+    free(facetsData->triangleStrip);
+    free(facetsData->vertex);
+    free(facetsData->normal);
+    free(facetsData->st);
+    free(facetsData->uv);
+    free(facetsData->rgb);
+    memset(facetsData, 0, sizeof(*facetsData));
+    return ZW_API_NO_ERROR;
+}
+
+/*******************************************************************/
+/* Function definition */
+ezwErrors ZwShapeFaceListGet
+(
+szwEntityHandle shape,        /* I: shape */
+int *count,                   /* O: number of faces */
+szwEntityHandle **faceList    /* O: faces */
+)
+/*
+DESCRIPTION:
+   The 6 faces of a box as handles.
+*/
+{
+    const ModelEntity entity = Entity(HandleId(shape));
+    if (entity.type != ZW_ENTITY_SHAPE)
+        return ZW_API_INVALID_INPUT;
+    int ids[6];
+    for (int f = 0; f < 6; f++)
+        ids[f] = EntityIdOf(entity.box, MODEL_FACE, f);
+    return (ezwErrors)HandleList(6, ids, count, faceList);
+}
+
+/*******************************************************************/
+/* Function definition */
+ezwErrors ZwFaceEdgeListGet
+(
+szwEntityHandle face,         /* I: face */
+int *count,                   /* O: number of edges */
+szwEntityHandle **edgeList    /* O: edges */
+)
+/*
+DESCRIPTION:
+   The 4 edges of a face as handles.
+*/
+{
+    const ModelEntity entity = Entity(HandleId(face));
+    if (entity.type != ZW_ENTITY_FACE)
+        return ZW_API_INVALID_INPUT;
+    int ids[4];
+    FaceEdges(entity.index, ids);
+    for (int i = 0; i < 4; i++)
+        ids[i] = EntityIdOf(entity.box, MODEL_EDGE, ids[i]);
+    return (ezwErrors)HandleList(4, ids, count, edgeList);
+}
+
+/*******************************************************************/
+/* Function definition */
+ezwErrors ZwEdgeFaceListGet
+(
+szwEntityHandle edge,         /* I: edge */
+int *count,                   /* O: number of faces */
+szwEntityHandle **faceList    /* O: faces */
+)
+/*
+DESCRIPTION:
+   The 2 faces of an edge as handles.
+*/
+{
+    const ModelEntity entity = Entity(HandleId(edge));
+    if (entity.type != ZW_ENTITY_EDGE)
+        return ZW_API_INVALID_INPUT;
+    int ids[2];
+    EdgeFaces(entity.index, ids);
+    for (int i = 0; i < 2; i++)
+        ids[i] = EntityIdOf(entity.box, MODEL_FACE, ids[i]);
+    return (ezwErrors)HandleList(2, ids, count, faceList);
+}
+
+/*******************************************************************/
+/* Function definition */
+void cvxCurveFree
+(
+svxCurve *Crv   /* I/O: curve */
+)
+/*
+DESCRIPTION:
+   The lines have no knots or control points.
+*/
+{
+    if (Crv == nullptr)
+        return;
+    if (Crv->T.free_mem)
+        free(Crv->T.knots);
+    if (Crv->P.free_mem)
+        free(Crv->P.coord);
+    memset(&Crv->T, 0, sizeof(Crv->T));
+    memset(&Crv->P, 0, sizeof(Crv->P));
+}
+
+/*******************************************************************/
+/* Function definition */
+void cvxMatInit
+(
+svxMatrix *Mat   /* O: identity matrix */
+)
+/*
+DESCRIPTION:
+   Set the identity matrix.
+*/
+{
+    if (Mat == nullptr)
+        return;
+    memset(Mat, 0, sizeof(*Mat));
+    Mat->identity = 1;
+    Mat->xx = Mat->yy = Mat->zz = 1.0;
+}
+
+/*******************************************************************/
+/* Function definition */
+ezwErrors ZwEntityIdGet
+(
+int count,                           /* I: number of handles */
+const szwEntityHandle *handleList,   /* I: handles */
+int *entityIdList                    /* O: entity ids */
+)
+/*
+DESCRIPTION:
+   The ids of the handles.
+*/
+{
+    if (count < 0 || (count > 0 && handleList == nullptr))
+        return ZW_API_INVALID_INPUT;
+    if (count > 0 && entityIdList == nullptr)
+        return ZW_API_INVALID_OUTPUT;
+    for (int i = 0; i < count; i++)
+        entityIdList[i] = HandleId(handleList[i]);
+    return ZW_API_NO_ERROR;
+}
+
+/*******************************************************************/
+/* Function definition */
+ezwErrors ZwEntityIdTransfer
+(
+int count,                          /* I: number of ids */
+const int *indexes,                 /* I: entity ids */
+szwEntityHandle *entityHandles      /* O: handles */
+)
+/*
+DESCRIPTION:
+   The handles of the ids.
+*/
+{
+    if (count < 0 || (count > 0 && indexes == nullptr))
+        return ZW_API_INVALID_INPUT;
+    if (count > 0 && entityHandles == nullptr)
+        return ZW_API_INVALID_OUTPUT;
+    for (int i = 0; i < count; i++)
+    {
+        if (Entity(indexes[i]).type == 0)
+            return ZW_API_INVALID_INPUT;
+        entityHandles[i] = Handle(indexes[i]);
+    }
+    return ZW_API_NO_ERROR;
+}
+
+/*******************************************************************/
+/* Function definition */
+ezwErrors ZwEntityHandleFree
+(
+szwEntityHandle *entityHandle   /* I/O: handle, empty on return */
+)
+/*
+DESCRIPTION:
+   The inner data is kept, the handle is emptied.
+*/
+{
+    if (entityHandle == nullptr)
+        return ZW_API_INVALID_INPUT;
+    entityHandle->innerData = nullptr;
+    return ZW_API_NO_ERROR;
+}
+
+/*******************************************************************/
+/* Function definition */
+ezwErrors ZwEntityHandleListFree
+(
+int count,                        /* I: number of handles */
+szwEntityHandle **entityList      /* I/O: handle list, NULL on return */
+)
+/*
+DESCRIPTION:
+   Free a handle list.
+*/
+{
+    if (entityList == nullptr || count < 0)
+        return ZW_API_INVALID_INPUT;
+    free(*entityList);
+    *entityList = nullptr;
+    return ZW_API_NO_ERROR;
+}
+
+/*******************************************************************/
+/* Function definition */
+ezwErrors ZwEntityTypeNumberGet
+(
+szwEntityHandle entityHandle,   /* I: entity */
+ezwEntityType *type             /* O: class number */
+)
+/*
+DESCRIPTION:
+   Class number of a shape, face, loop or edge.
+*/
+{
+    const ModelEntity entity = Entity(HandleId(entityHandle));
+    if (entity.type == 0)
+        return ZW_API_INVALID_INPUT;
+    if (type == nullptr)
+        return ZW_API_INVALID_OUTPUT;
+    *type = entity.type;
+    return ZW_API_NO_ERROR;
+}
+
+/*******************************************************************/
+/* Function definition */
+ezwErrors ZwEntityBoundingBoxGet
+(
+szwEntityHandle entityHandle,                  /* I: entity */
+ezwCoordinateType /* coordinateSystemType */,  /* I: coordinate system of the box, the world one is used */
+szwMatrix /* matrix */,                        /* I: frame of a user coordinate system, not used */
+szwBoundingBox *box                            /* O: box */
+)
+/*
+DESCRIPTION:
+   World box of a shape, a face or an edge.
+*/
+{
+    const ModelEntity entity = Entity(HandleId(entityHandle));
+    if (entity.type != ZW_ENTITY_SHAPE && entity.type != ZW_ENTITY_FACE && entity.type != ZW_ENTITY_EDGE)
+        return ZW_API_INVALID_INPUT;
+    if (box == nullptr)
+        return ZW_API_INVALID_OUTPUT;
+    double low[3] = { 0.0, 0.0, 0.0 }, high[3] = { MODEL_SIZE, MODEL_SIZE, MODEL_SIZE };
+    if (entity.type == ZW_ENTITY_FACE)
+        low[entity.index / 2] = high[entity.index / 2] = (entity.index % 2) * MODEL_SIZE;
+    else if (entity.type == ZW_ENTITY_EDGE)
+    {
+        EdgePoint(0, entity.index, 0, low);
+        EdgePoint(0, entity.index, 1, high);
+    }
+    box->X.min = low[0] + entity.box * MODEL_STEP;
+    box->X.max = high[0] + entity.box * MODEL_STEP;
+    box->Y.min = low[1];
+    box->Y.max = high[1];
+    box->Z.min = low[2];
+    box->Z.max = high[2];
+    return ZW_API_NO_ERROR;
+}
+
+/*******************************************************************/
+/* Function definition */
+ezwErrors ZwEntityUniqueIdGet
+(
+szwEntityHandle entityHandle,    /* I: entity */
+szwEntityIdentifier *entityId    /* O: unique id, free "innerData" with ZwMemoryFree() */
+)
+/*
+DESCRIPTION:
+   Unique id of an entity: the bytes of its id.
+*/
+{
+    const int id = HandleId(entityHandle);
+    if (Entity(id).type == 0)
+        return ZW_API_INVALID_INPUT;
+    if (entityId == nullptr)
+        return ZW_API_INVALID_OUTPUT;
+    entityId->innerData = (char *)malloc(sizeof(id));
+    if (entityId->innerData == nullptr)
+        return ZW_API_MEMORY_ERROR;
+    memcpy(entityId->innerData, &id, sizeof(id));
+    entityId->dataLen = (int)sizeof(id);
+    entityId->idType = 1;
+    return ZW_API_NO_ERROR;
+}
+
+/*******************************************************************/
+/* Function definition */
+ezwErrors ZwEntityListGetByPick
+(
+const char * /* prompt */,         /* I: prompt */
+ezwEntityInputOption option,       /* I: entity filter */
+int emptyOk,                       /* I: 1 if no pick is accepted */
+int *count,                        /* O: number of picked entities */
+szwEntityHandle **handleList       /* O: picked entities */
+)
+/*
+DESCRIPTION:
+   A pick of shapes picks all boxes, nothing else is picked.
+*/
+{
+    if (count == nullptr || handleList == nullptr)
+        return ZW_API_INVALID_OUTPUT;
+    *count = 0;
+    *handleList = nullptr;
+    if (option != ZW_INPUT_SHAPE || BoxCount() < 1)
+        return emptyOk ? ZW_API_NO_ERROR : ZW_API_GENERAL_ERROR;
+    int *ids = nullptr;
+    int shapes = 0;
+    cvxPartInqShapes("", "", &shapes, &ids);
+    const int result = HandleList(shapes, ids, count, handleList);
+    free(ids);
+    return (ezwErrors)result;
+}
+
+/*******************************************************************/
+/* Function definition */
+void cvxFileInqActive
+(
+char *Name,    /* O: name of the active file */
+int nBytes     /* I: size of "Name" in bytes */
+)
+/*
+DESCRIPTION:
+   Name of the synthetic file.
+*/
+{
+    if (Name != nullptr && nBytes > 0)
+        snprintf(Name, (size_t)nBytes, "%s", "ReplayModel");
+}
+
+/*******************************************************************/
+/* Function definition */
+void cvxFileDirectory
+(
+vxPath Dir   /* O: directory of the active file */
+)
+/*
+DESCRIPTION:
+   Directory of the synthetic file.
+*/
+{
+    if (Dir != nullptr)
+        snprintf(Dir, sizeof(vxPath), "%s", "ReplayModel");
+}
+
+/*******************************************************************/
+/* Function definition */
+evxErrors cvxPathCompose
+(
+vxPath Path,          /* I/O: directory, the composed path on return */
+const char *File      /* I: file name */
+)
+/*
+DESCRIPTION:
+   Join a directory and a file name with "/".
+*/
+{
+    if (Path == nullptr || File == nullptr)
+        return ZW_API_INVALID_INPUT;
+    const size_t length = strlen(Path);
+    if (length + 1 + strlen(File) >= sizeof(vxPath))
+        return ZW_API_INVALID_INPUT;
+    snprintf(Path + length, sizeof(vxPath) - length, "/%s", File);
+    return ZW_API_NO_ERROR;
+}
+
+/*******************************************************************/
+/* Function definition */
+evxErrors cvxDispWindowRectGet
+(
+const int /* includeFrame */,  /* I: 1 to include the frame */
+const int /* isGlobal */,      /* I: 1 for screen coordinates */
+int *x,                        /* O: left, can be NULL */
+int *y,                        /* O: top, can be NULL */
+int *w,                        /* O: width, can be NULL */
+int *h                         /* O: height, can be NULL */
+)
+/*
+DESCRIPTION:
+   A 1280 x 720 window at the origin.
+*/
+{
+    if (x != nullptr)
+        *x = 0;
+    if (y != nullptr)
+        *y = 0;
+    if (w != nullptr)
+        *w = 1280;
+    if (h != nullptr)
+        *h = 720;
+    return ZW_API_NO_ERROR;
+}
+
+/*******************************************************************/
+/* Function definition */
+evxErrors cvxFileExport
+(
+evxExportType /* Type */,  /* I: export type */
+const vxLongPath Path,     /* I: output file */
+void * /* Data */          /* I: export options of the type */
+)
+/*
+DESCRIPTION:
+   The export succeeds without writing a file.
+*/
+{
+    return Path != nullptr && Path[0] ? ZW_API_NO_ERROR : ZW_API_INVALID_INPUT;
+}
+
+/*******************************************************************/
+/* Function definition */
+int main
+(
+int argc,        /* I: number of arguments */
+char **argv      /* I: arguments */
+)
+/*
+DESCRIPTION:
+   Record a trace of the synthetic model: the part, a pick of all shapes
+and the image export.
+*/
+{
+    if (argc < 2)
+    {
+        fprintf(stderr, "usage: ReplayModel <trace> [boxes] [tolerance]\n");
+        return 2;
+    }
+    BoxCount() = argc > 2 ? atoi(argv[2]) : DEFAULT_BOXES;
+    const double tolerance = argc > 3 ? atof(argv[3]) : DEFAULT_TOLERANCE;
+    if (BoxCount() < 1 || BoxCount() > 1000000 || !(tolerance > 0.0))
+    {
+        fprintf(stderr, "ReplayModel: invalid boxes or tolerance\n");
+        return 2;
+    }
+
+    TraceWriter trace;
+    if (ReplayRecordPart(tolerance, &trace) || ReplayRecordPick(&trace) || ReplayRecordExport(&trace))
+    {
+        fprintf(stderr, "ReplayModel: recording failed\n");
+        return 1;
+    }
+    if (trace.Close(argv[1]))
+    {
+        fprintf(stderr, "ReplayModel: cannot write %s\n", argv[1]);
+        return 1;
+    }
+    printf("%d boxes, %d calls, %lld bytes: %s\n", BoxCount(), trace.Count(), trace.Bytes(), argv[1]);
+    return 0;
+}
@@ -0,0 +1,316 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* ZW3D API includes */
+#include "zwapi_brep_shape.h"   /* first, its include guard is the one of zwapi_shape.h */
+#include "zwapi_brep_edge.h"
+#include "zwapi_brep_face.h"
+#include "zwapi_brep_loop.h"
+#include "zwapi_brep_vertex.h"
+#include "zwapi_display.h"
+#include "zwapi_edge.h"
+#include "zwapi_entity.h"
+#include "zwapi_face.h"
+#include "zwapi_file.h"
+#include "zwapi_file_path.h"
+#include "zwapi_math_matrix.h"
+#include "zwapi_memory.h"
+#include "zwapi_part_facets.h"
+#include "zwapi_part_objs.h"
+#include "zwapi_shape.h"
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include "ReplayHost.h"
+#include "ReplayRecord.h"
+
+/*
+DESCRIPTION:
+   Benchmark of add-on flows against the stand-in host, the "ReplayBench"
+tool of the Linux build:
+
+   ReplayBench <trace> [tolerance] [latency us] [latency scale] [repeat]
+
+   It runs the topology inquiry of the TopoInquiry example, the facets of
+the picked shapes as the ClearanceCheck example gets them and the image
+export of the FileExport example, "repeat" times, and prints the time,
+the calls and a digest of the answers of each flow. The tolerance must
+be the one of the recording. It exits with 1 if a call is not in the
+trace.
+*/
+
+/*******************************************************************/
+/* Constant definitions */
+#define DEFAULT_TOLERANCE 0.1     /* as the default of ReplayModel (mm) */
+#define DEFAULT_REPEAT 10
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: a flow of the benchmark */
+struct BenchFlow
+{
+    const char *name;
+    int (*run)(double tolerance, double *digest);
+};
+
+/*******************************************************************/
+/* Function declarations */
+static int TopoFlow(double tolerance, double *digest);
+static int FacetsFlow(double tolerance, double *digest);
+static int ExportFlow(double tolerance, double *digest);
+static double Seconds(std::chrono::steady_clock::time_point start);
+
+/*******************************************************************/
+/* Function definition */
+double Seconds
+(
+std::chrono::steady_clock::time_point start   /* I: start time */
+)
+/*
+DESCRIPTION:
+   Seconds elapsed since "start".
+*/
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*******************************************************************/
+/* Function definition */
+int TopoFlow
+(
+double /* tolerance */,  /* I: not used */
+double *digest           /* I/O: sum of the answers */
+)
+/*
+DESCRIPTION:
+   The topology inquiry of the TopoInquiry example for all shapes of the
+part: faces, loops, edges, their faces and the UV curve of each edge on
+each face, then the edges at the vertices and the class number, the box
+and the unique id of each face.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    int shapeCount = 0, *shapes = nullptr;
+    if (cvxPartInqShapes("", "", &shapeCount, &shapes))
+        return 1;
+    for (int s = 0; s < shapeCount; s++)
+    {
+        int faceCount = 0, *faces = nullptr;
+        if (cvxPartInqShapeFaces(shapes[s], &faceCount, &faces))
+            continue;
+        for (int f = 0; f < faceCount; f++)
+        {
+            int loopCount = 0, *loops = nullptr;
+            if (cvxPartInqFaceLoops(faces[f], 1, &loopCount, &loops))
+                continue;
+            for (int l = 0; l < loopCount; l++)
+            {
+                int edgeCount = 0, *edges = nullptr, inner = 0;
+                cvxPartInqLoopInner(loops[l], &inner);
+                *digest += inner;
+                if (cvxPartInqLoopEdges(loops[l], &edgeCount, &edges))
+                    continue;
+                for (int e = 0; e < edgeCount; e++)
+                {
+                    int edgeFaceCount = 0, *edgeFaces = nullptr;
+                    if (cvxPartInqEdgeFaces(edges[e], &edgeFaceCount, &edgeFaces))
+                        continue;
+                    for (int k = 0; k < edgeFaceCount; k++)
+                    {
+                        svxCurve curve;
+                        memset(&curve, 0, sizeof(curve));
+                        cvxMatInit(&curve.Frame);
+                        if (cvxPartInqEdgeCrv(edges[e], edgeFaces[k], &curve) == ZW_API_NO_ERROR)
+                            *digest += curve.P1.x + curve.P1.y + curve.P2.x + curve.P2.y;
+                        cvxCurveFree(&curve);
+                    }
+                    for (int end = 0; end < 2; end++)
+                    {
+                        int vertexCount = 0, *vertexEdges = nullptr;
+                        if (cvxPartInqVertexEdges(edges[e], end, &vertexCount, &vertexEdges) == ZW_API_NO_ERROR)
+                            *digest += vertexCount;
+                        cvxMemFree((void **)&vertexEdges);
+                    }
+                    cvxMemFree((void **)&edgeFaces);
+                }
+                cvxMemFree((void **)&edges);
+            }
+            cvxMemFree((void **)&loops);
+
+            szwEntityHandle face{};
+            if (ZwEntityIdTransfer(1, &faces[f], &face))
+                continue;
+            ezwEntityType type = (ezwEntityType)0;
+            if (ZwEntityTypeNumberGet(face, &type) == ZW_API_NO_ERROR)
+                *digest += type;
+            szwMatrix frame;
+            memset(&frame, 0, sizeof(frame));
+            frame.identity = 1;
+            frame.xx = frame.yy = frame.zz = frame.scale = 1.0;
+            szwBoundingBox box;
+            if (ZwEntityBoundingBoxGet(face, ZW_COORDINATE_WORLD, frame, &box) == ZW_API_NO_ERROR)
+                *digest += box.X.max - box.X.min + box.Y.max - box.Y.min + box.Z.max - box.Z.min;
+            szwEntityIdentifier unique{};
+            if (ZwEntityUniqueIdGet(face, &unique) == ZW_API_NO_ERROR)
+                *digest += unique.dataLen;
+            ZwMemoryFree((void **)&unique.innerData);
+            ZwEntityHandleFree(&face);
+        }
+        cvxMemFree((void **)&faces);
+    }
+    cvxMemFree((void **)&shapes);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int FacetsFlow
+(
+double tolerance,    /* I: facet distance tolerance of the recording */
+double *digest       /* I/O: sum of the answers */
+)
+/*
+DESCRIPTION:
+   The facets of the ClearanceCheck example: pick the shapes and get the
+facets of the faces of each shape with one ZwFaceListFacetsGet() call.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    int count = 0;
+    szwEntityHandle *shapes = nullptr;
+    if (ZwEntityListGetByPick("Select shapes", ZW_INPUT_SHAPE, 0, &count, &shapes))
+        return 1;
+    for (int i = 0; i < count; i++)
+    {
+        int faceCount = 0;
+        szwEntityHandle *faces = nullptr;
+        if (ZwShapeFaceListGet(shapes[i], &faceCount, &faces) || faceCount < 1)
+            continue;
+        szwRefineFacetsOfMultiFace refine{};
+        refine.countFace = faceCount;
+        refine.faceHandle = faces;
+        refine.type = ZW_FACETS_TOLORANCE_DISTANCE;
+        refine.edgeTolorance = tolerance;
+        refine.facetTolorance = tolerance;
+        refine.angleTolorance = REPLAY_FACET_ANGLE;
+        refine.surfaceTolorance = REPLAY_FACET_SURFACE;
+        int facetsCount = 0;
+        szwFacets *facets = nullptr;
+        if (ZwFaceListFacetsGet(refine, &facetsCount, &facets) == ZW_API_NO_ERROR)
+        {
+            for (int k = 0; k < facetsCount; k++)
+            {
+                *digest += facets[k].numberVertex;
+                for (int v = 0; v < facets[k].numberVertex; v++)
+                    *digest += facets[k].vertex[v].x + facets[k].vertex[v].y + facets[k].vertex[v].z;
+                ZwFaceFacetsDataFree(&facets[k]);
+            }
+            ZwMemoryFree((void **)&facets);
+        }
+        ZwEntityHandleListFree(faceCount, &faces);
+    }
+    ZwEntityHandleListFree(count, &shapes);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int ExportFlow
+(
+double /* tolerance */,  /* I: not used */
+double *digest           /* I/O: sum of the answers */
+)
+/*
+DESCRIPTION:
+   The image export of the FileExport example.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    vxLongName fileName;
+    cvxFileInqActive(fileName, sizeof(fileName));
+    if (!fileName[0])
+        return 1;
+    vxPath filePath;
+    cvxFileDirectory(filePath);
+    if (cvxPathCompose(filePath, REPLAY_EXPORT_NAME))
+        return 1;
+
+    svxImgData image;
+    cvxMemZero(&image, sizeof(image));
+    image.Type = VX_EXPORT_IMG_TYPE_PNG;
+    image.BkgndMode = VX_EXPORT_IMG_BKGND_MODE_CURRENT;
+    image.ColorMode = VX_EXPORT_IMG_COLOR_MODE_24BITS;
+    image.RangeMode = VX_EXPORT_IMG_RANGE_MODE_NORMAL;
+    int width = 0, height = 0;
+    cvxDispWindowRectGet(0, 1, NULL, NULL, &width, &height);
+    image.Width = (unsigned int)width;
+    image.Height = (unsigned int)height;
+    *digest += width + height + (double)strlen(filePath);
+    return cvxFileExport(VX_EXPORT_TYPE_IMG, filePath, &image) ? 1 : 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int main
+(
+int argc,        /* I: number of arguments */
+char **argv      /* I: arguments */
+)
+/*
+DESCRIPTION:
+   Replay the flows and print their times, calls and digests.
+*/
+{
+    if (argc < 2)
+    {
+        fprintf(stderr, "usage: ReplayBench <trace> [tolerance] [latency us] [latency scale] [repeat]\n");
+        return 2;
+    }
+    const double tolerance = argc > 2 ? atof(argv[2]) : DEFAULT_TOLERANCE;
+    const double latency = argc > 3 ? atof(argv[3]) : 0.0;
+    const double scale = argc > 4 ? atof(argv[4]) : 0.0;
+    const int repeat = argc > 5 ? atoi(argv[5]) : DEFAULT_REPEAT;
+    if (ReplayHostOpen(argv[1]))
+    {
+        fprintf(stderr, "ReplayBench: cannot open the trace %s\n", argv[1]);
+        return 2;
+    }
+    ReplayHostLatencySet(Replay_None, latency);
+    ReplayHostLatencyScaleSet(scale);
+
+    const BenchFlow flows[] = { { "TopoInquiry", TopoFlow }, { "Facets", FacetsFlow }, { "FileExport", ExportFlow } };
+    long long misses = 0;
+    for (const BenchFlow &flow : flows)
+    {
+        ReplayHostStatsReset();
+        double digest = 0.0;
+        int failed = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < repeat; r++)
+            failed += flow.run(tolerance, &digest);
+        const double time = Seconds(start);
+        ReplayStats stats;
+        ReplayHostStatsGet(&stats);
+        misses += stats.misses;
+        printf("%-12s %8.3f ms/run, %8lld calls/run, latency %8.3f ms/run, misses %lld, failed %d, digest %.6g\n",
+               flow.name, 1e3 * time / (repeat > 0 ? repeat : 1), stats.calls / (repeat > 0 ? repeat : 1),
+               1e3 * stats.latency / (repeat > 0 ? repeat : 1), stats.misses, failed,
+               digest / (repeat > 0 ? repeat : 1));
+        for (int call = Replay_None + 1; call < Replay_CallCount; call++)
+        {
+            if (stats.missCount[call] > 0)
+                printf("    %s: %lld misses\n", ReplayCallName(call), stats.missCount[call]);
+        }
+    }
+    ReplayHostClose();
+    return misses > 0 ? 1 : 0;
+}
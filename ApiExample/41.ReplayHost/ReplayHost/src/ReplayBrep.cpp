@@ -0,0 +1,349 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* ZW3D API includes */
+#include "zwapi_brep_shape.h"   /* first, its include guard is the one of zwapi_shape.h */
+#include "zwapi_brep_edge.h"
+#include "zwapi_brep_face.h"
+#include "zwapi_brep_loop.h"
+#include "zwapi_brep_vertex.h"
+#include "zwapi_edge.h"
+#include "zwapi_face.h"
+#include "zwapi_math_matrix.h"
+#include "zwapi_part_objs.h"
+#include "zwapi_shape.h"
+
+/*******************************************************************/
+/* Application includes */
+#include <stdlib.h>
+#include <string.h>
+#include "ReplayHost.h"
+
+/*
+DESCRIPTION:
+   Topology inquiry of the stand-in host: shapes, faces, loops, edges and
+edge curves, replayed from the trace. The key and the reply of each call
+are written the same way by ReplayRecord.cpp.
+*/
+
+/*******************************************************************/
+/* Function declarations */
+static evxErrors IdListCall(int call, const TraceBuffer &key, int *count, int **list);
+static ezwErrors HandleListCall(int call, szwEntityHandle entity, int *count, szwEntityHandle **list);
+
+/*******************************************************************/
+/* Function definition */
+evxErrors IdListCall
+(
+int call,                 /* I: ReplayCall */
+const TraceBuffer &key,   /* I: inputs of the call */
+int *count,               /* O: number of ids */
+int **list                /* O: ids, free with cvxMemFree() */
+)
+/*
+DESCRIPTION:
+   Replay a call answering a list of ids.
+*/
+{
+    if (count == nullptr || list == nullptr)
+        return ZW_API_INVALID_OUTPUT;
+    TraceReader reply;
+    const int result = ReplayHostFind(call, key, &reply);
+    TraceIntListGet(reply, count, list);
+    return (evxErrors)result;
+}
+
+/*******************************************************************/
+/* Function definition */
+ezwErrors HandleListCall
+(
+int call,                   /* I: ReplayCall */
+szwEntityHandle entity,     /* I: entity of the call */
+int *count,                 /* O: number of handles */
+szwEntityHandle **list      /* O: handles, free with ZwEntityHandleListFree() */
+)
+/*
+DESCRIPTION:
+   Replay a call of one entity answering a list of handles.
+*/
+{
+    if (count == nullptr || list == nullptr)
+        return ZW_API_INVALID_OUTPUT;
+    TraceBuffer key;
+    key.Int(ReplayHostHandleId(entity));
+    TraceReader reply;
+    const int result = ReplayHostFind(call, key, &reply);
+    ReplayHostHandleListGet(reply, count, list);
+    return (ezwErrors)result;
+}
+
+/*******************************************************************/
+/* Function definition */
+evxErrors cvxPartInqShapes
+(
+const vxLongPath File,   /* I: part file, empty for the active file */
+const vxRootName Part,   /* I: part name, empty for the active part */
+int *Count,              /* O: number of shapes */
+int **Shapes             /* O: shape ids */
+)
+/*
+DESCRIPTION:
+   Key: file and part name. Reply: shape ids.
+*/
+{
+    TraceBuffer key;
+    key.Text(File);
+    key.Text(Part);
+    return IdListCall(Replay_PartInqShapes, key, Count, Shapes);
+}
+
+/*******************************************************************/
+/* Function definition */
+evxErrors cvxPartInqShapeFaces
+(
+int idShape,    /* I: shape id */
+int *Count,     /* O: number of faces */
+int **Faces     /* O: face ids */
+)
+/*
+DESCRIPTION:
+   Key: shape id. Reply: face ids.
+*/
+{
+    TraceBuffer key;
+    key.Int(idShape);
+    return IdListCall(Replay_PartInqShapeFaces, key, Count, Faces);
+}
+
+/*******************************************************************/
+/* Function definition */
+evxErrors cvxPartInqShapeEdges
+(
+int idShape,    /* I: shape id */
+int *Count,     /* O: number of edges */
+int **Edges     /* O: edge ids */
+)
+/*
+DESCRIPTION:
+   Key: shape id. Reply: edge ids.
+*/
+{
+    TraceBuffer key;
+    key.Int(idShape);
+    return IdListCall(Replay_PartInqShapeEdges, key, Count, Edges);
+}
+
+/*******************************************************************/
+/* Function definition */
+evxErrors cvxPartInqFaceLoops
+(
+int idFace,     /* I: face id */
+int Inner,      /* I: 1 to include the inner loops */
+int *Count,     /* O: number of loops */
+int **Loops     /* O: loop ids */
+)
+/*
+DESCRIPTION:
+   Key: face id and "Inner". Reply: loop ids.
+*/
+{
+    TraceBuffer key;
+    key.Int(idFace);
+    key.Int(Inner);
+    return IdListCall(Replay_PartInqFaceLoops, key, Count, Loops);
+}
+
+/*******************************************************************/
+/* Function definition */
+evxErrors cvxPartInqLoopEdges
+(
+int idLoop,     /* I: loop id */
+int *Count,     /* O: number of edges */
+int **Edges     /* O: edge ids */
+)
+/*
+DESCRIPTION:
+   Key: loop id. Reply: edge ids.
+*/
+{
+    TraceBuffer key;
+    key.Int(idLoop);
+    return IdListCall(Replay_PartInqLoopEdges, key, Count, Edges);
+}
+
+/*******************************************************************/
+/* Function definition */
+evxErrors cvxPartInqLoopInner
+(
+int idLoop,     /* I: loop id */
+int *isInner    /* O: 1 for an inner loop */
+)
+/*
+DESCRIPTION:
+   Key: loop id. Reply: inner flag.
+*/
+{
+    if (isInner == nullptr)
+        return ZW_API_INVALID_OUTPUT;
+    TraceBuffer key;
+    key.Int(idLoop);
+    TraceReader reply;
+    const int result = ReplayHostFind(Replay_PartInqLoopInner, key, &reply);
+    *isInner = reply.Int();
+    return (evxErrors)result;
+}
+
+/*******************************************************************/
+/* Function definition */
+evxErrors cvxPartInqEdgeFaces
+(
+int idEdge,     /* I: edge id */
+int *Count,     /* O: number of faces */
+int **Faces     /* O: face ids */
+)
+/*
+DESCRIPTION:
+   Key: edge id. Reply: face ids.
+*/
+{
+    TraceBuffer key;
+    key.Int(idEdge);
+    return IdListCall(Replay_PartInqEdgeFaces, key, Count, Faces);
+}
+
+/*******************************************************************/
+/* Function definition */
+evxErrors cvxPartInqEdgeCrv
+(
+int idEdge,      /* I: edge id */
+int idFace,      /* I: face or loop id for the UV curve, else 0 */
+svxCurve *Crv    /* O: curve, free with cvxCurveFree() */
+)
+/*
+DESCRIPTION:
+   Key: edge and face id. Reply: curve.
+*/
+{
+    if (Crv == nullptr)
+        return ZW_API_INVALID_OUTPUT;
+    TraceBuffer key;
+    key.Int(idEdge);
+    key.Int(idFace);
+    TraceReader reply;
+    const int result = ReplayHostFind(Replay_PartInqEdgeCrv, key, &reply);
+    TraceCurveGet(reply, Crv);
+    return (evxErrors)result;
+}
+
+/*******************************************************************/
+/* Function definition */
+evxErrors cvxPartInqVertexEdges
+(
+int idEdge,     /* I: edge id */
+int EndPnt,     /* I: 0 for the start vertex, 1 for the end vertex */
+int *Count,     /* O: number of edges */
+int **Edges     /* O: edge ids */
+)
+/*
+DESCRIPTION:
+   Key: edge id and end. Reply: edge ids.
+*/
+{
+    TraceBuffer key;
+    key.Int(idEdge);
+    key.Int(EndPnt);
+    return IdListCall(Replay_PartInqVertexEdges, key, Count, Edges);
+}
+
+/*******************************************************************/
+/* Function definition */
+ezwErrors ZwShapeFaceListGet
+(
+szwEntityHandle shapeHandle,    /* I: shape */
+int *count,                     /* O: number of faces */
+szwEntityHandle **faceList      /* O: faces */
+)
+/*
+DESCRIPTION:
+   Key: shape id. Reply: face ids.
+*/
+{
+    return HandleListCall(Replay_ShapeFaceListGet, shapeHandle, count, faceList);
+}
+
+/*******************************************************************/
+/* Function definition */
+ezwErrors ZwFaceEdgeListGet
+(
+szwEntityHandle face,           /* I: face */
+int *count,                     /* O: number of edges */
+szwEntityHandle **edgeList      /* O: edges */
+)
+/*
+DESCRIPTION:
+   Key: face id. Reply: edge ids.
+*/
+{
+    return HandleListCall(Replay_FaceEdgeListGet, face, count, edgeList);
+}
+
+/*******************************************************************/
+/* Function definition */
+ezwErrors ZwEdgeFaceListGet
+(
+szwEntityHandle edgeHandle,     /* I: edge */
+int *countFace,                 /* O: number of faces */
+szwEntityHandle **faceList      /* O: faces */
+)
+/*
+DESCRIPTION:
+   Key: edge id. Reply: face ids.
+*/
+{
+    return HandleListCall(Replay_EdgeFaceListGet, edgeHandle, countFace, faceList);
+}
+
+/*******************************************************************/
+/* Function definition */
+void cvxCurveFree
+(
+svxCurve *Crv   /* I/O: curve */
+)
+/*
+DESCRIPTION:
+   Not replayed: free the knots and control points of a curve.
+*/
+{
+    if (Crv == nullptr)
+        return;
+    if (Crv->T.free_mem)
+        free(Crv->T.knots);
+    if (Crv->P.free_mem)
+        free(Crv->P.coord);
+    Crv->T.knots = nullptr;
+    Crv->T.num_knots = 0;
+    Crv->T.free_mem = 0;
+    Crv->P.coord = nullptr;
+    Crv->P.num_cp = 0;
+    Crv->P.free_mem = 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void cvxMatInit
+(
+svxMatrix *Mat   /* O: identity matrix */
+)
+/*
+DESCRIPTION:
+   Not replayed: set the identity matrix.
+*/
+{
+    if (Mat == nullptr)
+        return;
+    memset(Mat, 0, sizeof(*Mat));
+    Mat->identity = 1;
+    Mat->xx = Mat->yy = Mat->zz = 1.0;
+}
@@ -0,0 +1,125 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* ZW3D API includes */
+#include "zwapi_file.h"
+#include "zwapi_file_path.h"
+#include "zwapi_userinput.h"
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <chrono>
+#include "..\inc\ReplayHostPr.h"
+#include "..\inc\ReplayRecord.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define MESSAGE_SIZE 256
+#define DEFAULT_TOLERANCE 0.01              /* default facet distance tolerance (mm) */
+#define TRACE_NAME "ReplayTrace.zwrt"       /* trace, next to the active file */
+
+/*******************************************************************/
+/* Function declarations */
+static int ReplayRecord(void);
+static double Seconds(std::chrono::steady_clock::time_point start);
+
+/*******************************************************************/
+/* Function definition */
+int RegisterReplayHost
+(
+void
+)
+/*
+DESCRIPTION:
+   Register the commands of the replay host example.
+*/
+{
+    /* Record a trace of the active part for the stand-in host by entering "~ReplayRecord" */
+    ZwCommandFunctionLoad("ReplayRecord", (void *)ReplayRecord, ZW_LICENSE_CODE_GENERAL);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int UnloadReplayHost
+(
+void
+)
+/*
+DESCRIPTION:
+   Unload the commands of the replay host example.
+*/
+{
+    ZwCommandFunctionUnload("ReplayRecord");
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+double Seconds
+(
+std::chrono::steady_clock::time_point start   /* I: start time */
+)
+/*
+DESCRIPTION:
+   Seconds elapsed since "start".
+*/
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*******************************************************************/
+/* Function definition */
+int ReplayRecord
+(
+void
+)
+/*
+DESCRIPTION:
+   Record the topology and the facets of the shapes of the active part,
+an optional pick of shapes and the image export of the FileExport
+example, and write the trace next to the active file. The stand-in host
+replays it without ZW3D (see "Read Me.txt").
+
+   Return 1 if function fails, else 0.
+*/
+{
+    double tolerance = DEFAULT_TOLERANCE;
+    if (cvxGetNumber("Facet distance tolerance", &tolerance) || !(tolerance > 0.0))
+        tolerance = DEFAULT_TOLERANCE;
+
+    vxPath path;
+    cvxFileDirectory(path);
+    if (!path[0] || cvxPathCompose(path, TRACE_NAME))
+    {
+        cvxMsgDisp("Save the active file first, the trace is written next to it");
+        return 1;
+    }
+
+    TraceWriter trace;
+    const auto start = std::chrono::steady_clock::now();
+    if (ReplayRecordPart(tolerance, &trace))
+    {
+        cvxMsgDisp("No shapes in the active part");
+        return 1;
+    }
+    ReplayRecordPick(&trace);
+    ReplayRecordExport(&trace);
+    const double time = Seconds(start);
+
+    char message[MESSAGE_SIZE];
+    if (trace.Close(path))
+    {
+        sprintf_s(message, MESSAGE_SIZE, "Cannot write %s", path);
+        cvxMsgDisp(message);
+        return 1;
+    }
+    sprintf_s(message, MESSAGE_SIZE, "%d calls, %lld bytes, recorded in %.3f s", trace.Count(), trace.Bytes(), time);
+    cvxMsgDisp(message);
+    sprintf_s(message, MESSAGE_SIZE, "Trace: %s", path);
+    cvxMsgDisp(message);
+    return 0;
+}
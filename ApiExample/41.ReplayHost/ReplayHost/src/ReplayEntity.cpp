@@ -0,0 +1,204 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* ZW3D API includes */
+#include "zwapi_entity.h"
+
+/*******************************************************************/
+/* Application includes */
+#include <stdlib.h>
+#include "ReplayHost.h"
+
+/*
+DESCRIPTION:
+   Entity functions of the stand-in host. A handle stands for the entity
+id it was recorded with, so the id functions and the handle frees are
+answered without the trace; the others are replayed. The key and the
+reply of each call are written the same way by ReplayRecord.cpp.
+*/
+
+/*******************************************************************/
+/* Function definition */
+ezwErrors ZwEntityIdGet
+(
+int count,                           /* I: number of handles */
+const szwEntityHandle *handleList,   /* I: handles */
+int *entityIdList                    /* O: entity ids */
+)
+/*
+DESCRIPTION:
+   Not replayed: the ids of the handles.
+*/
+{
+    if (count < 0 || (count > 0 && handleList == nullptr))
+        return ZW_API_INVALID_INPUT;
+    if (count > 0 && entityIdList == nullptr)
+        return ZW_API_INVALID_OUTPUT;
+    for (int i = 0; i < count; i++)
+    {
+        entityIdList[i] = ReplayHostHandleId(handleList[i]);
+        if (entityIdList[i] == 0)
+            return ZW_API_INVALID_INPUT;
+    }
+    return ZW_API_NO_ERROR;
+}
+
+/*******************************************************************/
+/* Function definition */
+ezwErrors ZwEntityIdTransfer
+(
+int count,                          /* I: number of ids */
+const int *indexes,                 /* I: entity ids */
+szwEntityHandle *entityHandles      /* O: handles */
+)
+/*
+DESCRIPTION:
+   Not replayed: the handles of the ids.
+*/
+{
+    if (count < 0 || (count > 0 && indexes == nullptr))
+        return ZW_API_INVALID_INPUT;
+    if (count > 0 && entityHandles == nullptr)
+        return ZW_API_INVALID_OUTPUT;
+    for (int i = 0; i < count; i++)
+        entityHandles[i] = ReplayHostHandle(indexes[i]);
+    return ZW_API_NO_ERROR;
+}
+
+/*******************************************************************/
+/* Function definition */
+ezwErrors ZwEntityHandleFree
+(
+szwEntityHandle *entityHandle   /* I/O: handle, empty on return */
+)
+/*
+DESCRIPTION:
+   Not replayed: the inner data is kept by the host, the handle is
+emptied.
+*/
+{
+    if (entityHandle == nullptr)
+        return ZW_API_INVALID_INPUT;
+    entityHandle->innerData = nullptr;
+    return ZW_API_NO_ERROR;
+}
+
+/*******************************************************************/
+/* Function definition */
+ezwErrors ZwEntityHandleListFree
+(
+int count,                        /* I: number of handles */
+szwEntityHandle **entityList      /* I/O: handle list, NULL on return */
+)
+/*
+DESCRIPTION:
+   Not replayed: free the list of a replayed call.
+*/
+{
+    if (entityList == nullptr || count < 0)
+        return ZW_API_INVALID_INPUT;
+    free(*entityList);
+    *entityList = nullptr;
+    return ZW_API_NO_ERROR;
+}
+
+/*******************************************************************/
+/* Function definition */
+ezwErrors ZwEntityTypeNumberGet
+(
+szwEntityHandle entityHandle,   /* I: entity */
+ezwEntityType *type             /* O: class number */
+)
+/*
+DESCRIPTION:
+   Key: entity id. Reply: class number.
+*/
+{
+    if (type == nullptr)
+        return ZW_API_INVALID_OUTPUT;
+    TraceBuffer key;
+    key.Int(ReplayHostHandleId(entityHandle));
+    TraceReader reply;
+    const int result = ReplayHostFind(Replay_EntityTypeNumberGet, key, &reply);
+    *type = (ezwEntityType)reply.Int();
+    return (ezwErrors)result;
+}
+
+/*******************************************************************/
+/* Function definition */
+ezwErrors ZwEntityBoundingBoxGet
+(
+szwEntityHandle entityHandle,                /* I: entity */
+ezwCoordinateType coordinateSystemType,      /* I: coordinate system of the box */
+szwMatrix matrix,                            /* I: frame of a user coordinate system */
+szwBoundingBox *box                          /* O: box */
+)
+/*
+DESCRIPTION:
+   Key: entity id, coordinate system type and frame. Reply: box.
+*/
+{
+    if (box == nullptr)
+        return ZW_API_INVALID_OUTPUT;
+    TraceBuffer key;
+    key.Int(ReplayHostHandleId(entityHandle));
+    key.Int(coordinateSystemType);
+    TraceZwMatrixPut(key, matrix);
+    TraceReader reply;
+    const int result = ReplayHostFind(Replay_EntityBoundingBoxGet, key, &reply);
+    TraceBoxGet(reply, box);
+    return (ezwErrors)result;
+}
+
+/*******************************************************************/
+/* Function definition */
+ezwErrors ZwEntityUniqueIdGet
+(
+szwEntityHandle entityHandle,    /* I: entity */
+szwEntityIdentifier *entityId    /* O: unique id, free "innerData" with ZwMemoryFree() */
+)
+/*
+DESCRIPTION:
+   Key: entity id. Reply: id bytes and id type.
+*/
+{
+    if (entityId == nullptr)
+        return ZW_API_INVALID_OUTPUT;
+    TraceBuffer key;
+    key.Int(ReplayHostHandleId(entityHandle));
+    TraceReader reply;
+    const int result = ReplayHostFind(Replay_EntityUniqueIdGet, key, &reply);
+    entityId->dataLen = reply.Count(1);
+    entityId->innerData = entityId->dataLen > 0 ? (char *)malloc((size_t)entityId->dataLen) : nullptr;
+    if (entityId->innerData != nullptr)
+        reply.Bytes(entityId->innerData, entityId->dataLen);
+    entityId->idType = reply.Int();
+    return (ezwErrors)result;
+}
+
+/*******************************************************************/
+/* Function definition */
+ezwErrors ZwEntityListGetByPick
+(
+const char * /* prompt */,         /* I: prompt, not part of the key */
+ezwEntityInputOption option,       /* I: entity filter */
+int /* emptyOk */,                 /* I: 1 if no pick is accepted, not part of the key */
+int *count,                        /* O: number of picked entities */
+szwEntityHandle **handleList       /* O: picked entities, free with ZwEntityHandleListFree() */
+)
+/*
+DESCRIPTION:
+   Key: filter. Reply: entity ids.
+*/
+{
+    if (count == nullptr || handleList == nullptr)
+        return ZW_API_INVALID_OUTPUT;
+    TraceBuffer key;
+    key.Int(option);
+    TraceReader reply;
+    const int result = ReplayHostFind(Replay_EntityListGetByPick, key, &reply);
+    ReplayHostHandleListGet(reply, count, handleList);
+    return (ezwErrors)result;
+}
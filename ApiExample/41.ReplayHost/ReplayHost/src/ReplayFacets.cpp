@@ -0,0 +1,161 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* ZW3D API includes */
+#include "zwapi_face.h"
+#include "zwapi_part_facets.h"
+
+/*******************************************************************/
+/* Application includes */
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "ReplayHost.h"
+
+/*
+DESCRIPTION:
+   Face facets of the stand-in host, replayed from the trace; the frees
+are answered without it. The key and the reply of each call are written
+the same way by ReplayRecord.cpp.
+*/
+
+/*******************************************************************/
+/* Function definition */
+evxErrors cvxPartInqFaceFacets2
+(
+int idFace,          /* I: face id */
+svxFacets *Facets    /* O: facets, free with cvxFacetsFree() */
+)
+/*
+DESCRIPTION:
+   Key: face id. Reply: facets.
+*/
+{
+    if (Facets == nullptr)
+        return ZW_API_INVALID_OUTPUT;
+    TraceBuffer key;
+    key.Int(idFace);
+    TraceReader reply;
+    const int result = ReplayHostFind(Replay_PartInqFaceFacets2, key, &reply);
+    TraceFacetsGet(reply, Facets);
+    return (evxErrors)result;
+}
+
+/*******************************************************************/
+/* Function definition */
+void cvxFacetsFree
+(
+svxFacets *Facets   /* I/O: facets */
+)
+/*
+DESCRIPTION:
+   Not replayed: free the lists of facets.
+*/
+{
+    if (Facets == nullptr)
+        return;
+    free(Facets->TriStrip);
+    free(Facets->Vertex);
+    free(Facets->Normal);
+    free(Facets->ST);
+    free(Facets->UV);
+    free(Facets->RGB);
+    Facets->numTriStrip = 0;
+    Facets->numVertex = 0;
+    Facets->TriStrip = nullptr;
+    Facets->Vertex = nullptr;
+    Facets->Normal = nullptr;
+    Facets->ST = nullptr;
+    Facets->UV = nullptr;
+    Facets->RGB = nullptr;
+}
+
+/*******************************************************************/
+/* Function definition */
+ezwErrors ZwFaceFacetsGet
+(
+szwRefineFacets refineData,   /* I: face and tolerances */
+szwFacets *facetsData         /* O: facets, free with ZwFaceFacetsDataFree() */
+)
+/*
+DESCRIPTION:
+   Key: face id and tolerances. Reply: facets.
+*/
+{
+    if (facetsData == nullptr)
+        return ZW_API_INVALID_OUTPUT;
+    szwRefineFacetsOfMultiFace refine;
+    refine.countFace = 1;
+    refine.faceHandle = &refineData.faceHandle;
+    refine.type = refineData.type;
+    refine.edgeTolorance = refineData.edgeTolorance;
+    refine.facetTolorance = refineData.facetTolorance;
+    refine.angleTolorance = refineData.angleTolorance;
+    refine.surfaceTolorance = refineData.surfaceTolorance;
+    const int faceId = ReplayHostHandleId(refineData.faceHandle);
+
+    TraceBuffer key;
+    TraceRefinePut(key, refine, &faceId);
+    TraceReader reply;
+    const int result = ReplayHostFind(Replay_FaceFacetsGet, key, &reply);
+    TraceZwFacetsGet(reply, facetsData);
+    return (ezwErrors)result;
+}
+
+/*******************************************************************/
+/* Function definition */
+ezwErrors ZwFaceListFacetsGet
+(
+szwRefineFacetsOfMultiFace refineData,   /* I: faces and tolerances */
+int *countFacets,                        /* O: number of facets */
+szwFacets **facetsDataList               /* O: facets of each face */
+)
+/*
+DESCRIPTION:
+   Key: face ids and tolerances. Reply: number of facets, then the facets
+of each face.
+*/
+{
+    if (countFacets == nullptr || facetsDataList == nullptr)
+        return ZW_API_INVALID_OUTPUT;
+    if (refineData.countFace < 0 || (refineData.countFace > 0 && refineData.faceHandle == nullptr))
+        return ZW_API_INVALID_INPUT;
+    std::vector<int> faceIds((size_t)refineData.countFace);
+    for (int i = 0; i < refineData.countFace; i++)
+        faceIds[i] = ReplayHostHandleId(refineData.faceHandle[i]);
+
+    TraceBuffer key;
+    TraceRefinePut(key, refineData, faceIds.data());
+    TraceReader reply;
+    const int result = ReplayHostFind(Replay_FaceListFacetsGet, key, &reply);
+    *countFacets = reply.Count(1);
+    *facetsDataList = *countFacets > 0 ? (szwFacets *)calloc((size_t)*countFacets, sizeof(szwFacets)) : nullptr;
+    for (int i = 0; i < *countFacets && *facetsDataList != nullptr; i++)
+        TraceZwFacetsGet(reply, &(*facetsDataList)[i]);
+    return (ezwErrors)result;
+}
+
+/*******************************************************************/
+/* Function definition */
+ezwErrors ZwFaceFacetsDataFree
+(
+szwFacets *facetsData   /* I/O: facets */
+)
+/*
+DESCRIPTION:
+   Not replayed: free the lists of facets.
+*/
+{
+    if (facetsData == nullptr)
+        return ZW_API_INVALID_INPUT;
+    free(facetsData->triangleStrip);
+    free(facetsData->vertex);
+    free(facetsData->normal);
+    free(facetsData->st);
+    free(facetsData->uv);
+    free(facetsData->rgb);
+    memset(facetsData, 0, sizeof(*facetsData));
+    return ZW_API_NO_ERROR;
+}
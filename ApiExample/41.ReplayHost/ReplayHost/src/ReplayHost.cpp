@@ -0,0 +1,388 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* ZW3D API includes */
+#include "zwapi_util.h"
+
+/*******************************************************************/
+/* Application includes */
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "ReplayHost.h"
+
+/*******************************************************************/
+/* Data type definitions */
+/*
+DESCRIPTION:
+   Inner data of a replayed entity handle: the entity id it was recorded
+with. One is kept for each id, so a handle stays valid after its list is
+freed and equal handles point to the same data.
+*/
+struct szwEntityInnerData
+{
+    int id;
+};
+
+/* DESCRIPTION: records of one call with the same inputs, in the recorded order */
+struct ReplaySlot
+{
+    std::vector<int> records;
+    size_t next;
+};
+
+/* DESCRIPTION: state of the stand-in host */
+struct ReplayState
+{
+    std::mutex lock;
+    int opened;                                                  /* a trace was opened or tried */
+    TraceFile trace;
+    std::unordered_map<std::string, ReplaySlot> slots;           /* call and key bytes to records */
+    std::unordered_map<int, std::unique_ptr<szwEntityInnerData>> handles;
+    double fixedMicros[Replay_CallCount];
+    double scale;
+    ReplayStats stats;
+};
+
+/*******************************************************************/
+/* Function declarations */
+static ReplayState &State(void);
+static int OpenLocked(ReplayState &state, const char *path);
+static std::string SlotKey(int call, const void *key, size_t bytes);
+static void Wait(std::chrono::steady_clock::time_point start, double micros);
+
+/*******************************************************************/
+/* Function definition */
+ReplayState &State
+(
+void
+)
+/*
+DESCRIPTION:
+   The state of the stand-in host, created on the first call.
+*/
+{
+    static ReplayState state;
+    return state;
+}
+
+/*******************************************************************/
+/* Function definition */
+std::string SlotKey
+(
+int call,           /* I: ReplayCall */
+const void *key,    /* I: key bytes */
+size_t bytes        /* I: number of key bytes */
+)
+/*
+DESCRIPTION:
+   Key of a slot: the call number in one byte, then the key bytes.
+*/
+{
+    std::string slot(1, (char)call);
+    slot.append((const char *)key, bytes);
+    return slot;
+}
+
+/*******************************************************************/
+/* Function definition */
+int OpenLocked
+(
+ReplayState &state,   /* I/O: host state, locked */
+const char *path      /* I: trace file */
+)
+/*
+DESCRIPTION:
+   Load the trace, index its records by call and inputs and read the
+latency settings of the environment.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    state.opened = 1;
+    state.slots.clear();
+    if (path == nullptr || state.trace.Open(path))
+        return 1;
+
+    for (int i = 0; i < state.trace.Count(); i++)
+    {
+        const TraceRecord &record = state.trace.Record(i);
+        ReplaySlot &slot = state.slots[SlotKey(record.call, record.key, (size_t)record.keyBytes)];
+        if (slot.records.empty())
+            slot.next = 0;
+        slot.records.push_back(i);
+    }
+
+    const char *micros = getenv("ZW_REPLAY_LATENCY_US");
+    const char *scale = getenv("ZW_REPLAY_LATENCY_SCALE");
+    for (int call = 0; call < Replay_CallCount && micros != nullptr; call++)
+        state.fixedMicros[call] = atof(micros);
+    if (scale != nullptr)
+        state.scale = atof(scale);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void Wait
+(
+std::chrono::steady_clock::time_point start,   /* I: start of the call */
+double micros                                  /* I: latency of the call (microsecond) */
+)
+/*
+DESCRIPTION:
+   Busy-wait until the latency has passed since "start". Sleeping would
+round short latencies up to the scheduler tick.
+*/
+{
+    const auto end = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                 std::chrono::duration<double, std::micro>(micros));
+    while (std::chrono::steady_clock::now() < end)
+    {
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+int ReplayHostOpen
+(
+const char *path   /* I: trace file of the recording add-on */
+)
+/*
+DESCRIPTION:
+   Open a trace and rewind it; the handles and the counters are kept.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    ReplayState &state = State();
+    std::lock_guard<std::mutex> guard(state.lock);
+    return OpenLocked(state, path);
+}
+
+/*******************************************************************/
+/* Function definition */
+void ReplayHostClose
+(
+void
+)
+/*
+DESCRIPTION:
+   Forget the trace; the next call opens ZW_REPLAY_TRACE again.
+*/
+{
+    ReplayState &state = State();
+    std::lock_guard<std::mutex> guard(state.lock);
+    state.slots.clear();
+    state.trace = TraceFile();
+    state.opened = 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void ReplayHostRewind
+(
+void
+)
+/*
+DESCRIPTION:
+   Answer the calls from their first record again.
+*/
+{
+    ReplayState &state = State();
+    std::lock_guard<std::mutex> guard(state.lock);
+    for (auto &slot : state.slots)
+        slot.second.next = 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void ReplayHostLatencySet
+(
+int call,        /* I: ReplayCall, Replay_None for all calls */
+double micros    /* I: fixed latency of the call (microsecond) */
+)
+/*
+DESCRIPTION:
+   Set the fixed latency of a call or of all calls.
+*/
+{
+    ReplayState &state = State();
+    std::lock_guard<std::mutex> guard(state.lock);
+    for (int i = 0; i < Replay_CallCount; i++)
+    {
+        if (call == Replay_None || call == i)
+            state.fixedMicros[i] = micros > 0.0 ? micros : 0.0;
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+void ReplayHostLatencyScaleSet
+(
+double scale   /* I: factor of the recorded time of a call, 0 to ignore it */
+)
+/*
+DESCRIPTION:
+   Set the share of the recorded time added to each call.
+*/
+{
+    ReplayState &state = State();
+    std::lock_guard<std::mutex> guard(state.lock);
+    state.scale = scale > 0.0 ? scale : 0.0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void ReplayHostStatsGet
+(
+ReplayStats *stats   /* O: counters */
+)
+/*
+DESCRIPTION:
+   Copy the counters.
+*/
+{
+    ReplayState &state = State();
+    std::lock_guard<std::mutex> guard(state.lock);
+    *stats = state.stats;
+}
+
+/*******************************************************************/
+/* Function definition */
+void ReplayHostStatsReset
+(
+void
+)
+/*
+DESCRIPTION:
+   Reset the counters.
+*/
+{
+    ReplayState &state = State();
+    std::lock_guard<std::mutex> guard(state.lock);
+    memset(&state.stats, 0, sizeof(state.stats));
+}
+
+/*******************************************************************/
+/* Function definition */
+int ReplayHostFind
+(
+int call,                   /* I: ReplayCall */
+const TraceBuffer &key,     /* I: inputs of the call */
+TraceReader *reply          /* O: outputs of the call, empty if not recorded */
+)
+/*
+DESCRIPTION:
+   Answer a call: find its next record, wait its latency and return the
+recorded return code. A call missing in the trace answers an empty reply
+and ZW_API_GENERAL_ERROR.
+*/
+{
+    const auto start = std::chrono::steady_clock::now();
+    ReplayState &state = State();
+    const TraceRecord *record = nullptr;
+    double micros = 0.0;
+    {
+        std::lock_guard<std::mutex> guard(state.lock);
+        if (!state.opened)
+            OpenLocked(state, getenv("ZW_REPLAY_TRACE"));
+
+        const std::string &bytes = key.Data();
+        auto found = state.slots.find(SlotKey(call, bytes.data(), bytes.size()));
+        if (found != state.slots.end())
+        {
+            ReplaySlot &slot = found->second;
+            record = &state.trace.Record(slot.records[slot.next]);
+            if (slot.next + 1 < slot.records.size())
+                slot.next++;
+        }
+
+        const int index = call > Replay_None && call < Replay_CallCount ? call : Replay_None;
+        state.stats.calls++;
+        state.stats.callCount[index]++;
+        if (record == nullptr)
+        {
+            state.stats.misses++;
+            state.stats.missCount[index]++;
+        }
+        micros = state.fixedMicros[index] + (record != nullptr ? state.scale * record->micros : 0.0);
+        state.stats.latency += micros * 1e-6;
+    }
+
+    if (micros > 0.0)
+        Wait(start, micros);
+    if (record == nullptr)
+    {
+        *reply = TraceReader();
+        return ZW_API_GENERAL_ERROR;
+    }
+    *reply = TraceReader(record->reply, (size_t)record->replyBytes);
+    return record->result;
+}
+
+/*******************************************************************/
+/* Function definition */
+szwEntityHandle ReplayHostHandle
+(
+int id   /* I: entity id of the recording */
+)
+/*
+DESCRIPTION:
+   Handle of an entity id, the same inner data for the same id.
+*/
+{
+    ReplayState &state = State();
+    std::lock_guard<std::mutex> guard(state.lock);
+    std::unique_ptr<szwEntityInnerData> &data = state.handles[id];
+    if (!data)
+    {
+        data.reset(new szwEntityInnerData);
+        data->id = id;
+    }
+    szwEntityHandle handle;
+    handle.innerData = data.get();
+    return handle;
+}
+
+/*******************************************************************/
+/* Function definition */
+int ReplayHostHandleId
+(
+szwEntityHandle handle   /* I: handle of ReplayHostHandle() */
+)
+/*
+DESCRIPTION:
+   Entity id of a handle, 0 for an empty handle.
+*/
+{
+    return handle.innerData != nullptr ? handle.innerData->id : 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void ReplayHostHandleListGet
+(
+TraceReader &in,              /* I/O: reply */
+int *count,                   /* O: number of handles */
+szwEntityHandle **handles     /* O: handles, free with ZwEntityHandleListFree() */
+)
+/*
+DESCRIPTION:
+   Read a list of entity ids written by TraceIntListPut() as handles.
+*/
+{
+    int *ids = nullptr;
+    TraceIntListGet(in, count, &ids);
+    *handles = *count > 0 ? (szwEntityHandle *)calloc((size_t)*count, sizeof(szwEntityHandle)) : nullptr;
+    for (int i = 0; i < *count && *handles != nullptr; i++)
+        (*handles)[i] = ReplayHostHandle(ids[i]);
+    free(ids);
+}
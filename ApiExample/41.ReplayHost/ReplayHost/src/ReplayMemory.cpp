@@ -0,0 +1,158 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* ZW3D API includes */
+#include "zwapi_memory.h"
+
+/*******************************************************************/
+/* Application includes */
+#include <stdlib.h>
+#include <string.h>
+
+/*
+DESCRIPTION:
+   Memory functions of the stand-in host. They are not replayed: every
+list answered by a replayed call is allocated with malloc(), so these
+are the allocator the add-on frees it with.
+*/
+
+/*******************************************************************/
+/* Function definition */
+evxErrors cvxMemAlloc
+(
+int NumBytes,        /* I: number of bytes */
+void **MemPointer    /* O: zeroed memory */
+)
+/*
+DESCRIPTION:
+   Not replayed: as ZwMemoryAlloc().
+*/
+{
+    return ZwMemoryAlloc(NumBytes, MemPointer);
+}
+
+/*******************************************************************/
+/* Function definition */
+evxErrors cvxMemResize
+(
+int NumBytes,        /* I: new number of bytes */
+void **MemPointer    /* I/O: memory */
+)
+/*
+DESCRIPTION:
+   Not replayed: as ZwMemoryResize().
+*/
+{
+    return ZwMemoryResize(NumBytes, MemPointer);
+}
+
+/*******************************************************************/
+/* Function definition */
+void cvxMemZero
+(
+void *MemPointer,   /* I/O: memory */
+int NumBytes        /* I: number of bytes */
+)
+/*
+DESCRIPTION:
+   Not replayed: as ZwMemoryZero().
+*/
+{
+    ZwMemoryZero(NumBytes, MemPointer);
+}
+
+/*******************************************************************/
+/* Function definition */
+void cvxMemFree
+(
+void **MemPointer   /* I/O: memory, NULL on return */
+)
+/*
+DESCRIPTION:
+   Not replayed: as ZwMemoryFree().
+*/
+{
+    ZwMemoryFree(MemPointer);
+}
+
+/*******************************************************************/
+/* Function definition */
+ezwErrors ZwMemoryAlloc
+(
+int numBytes,           /* I: number of bytes */
+void **memoryPointer    /* O: zeroed memory */
+)
+/*
+DESCRIPTION:
+   Not replayed: zeroed memory of calloc().
+*/
+{
+    if (memoryPointer == nullptr)
+        return ZW_API_INVALID_OUTPUT;
+    *memoryPointer = nullptr;
+    if (numBytes <= 0)
+        return ZW_API_INVALID_INPUT;
+    *memoryPointer = calloc(1, (size_t)numBytes);
+    return *memoryPointer != nullptr ? ZW_API_NO_ERROR : ZW_API_MEMORY_ERROR;
+}
+
+/*******************************************************************/
+/* Function definition */
+ezwErrors ZwMemoryResize
+(
+int numBytes,           /* I: new number of bytes */
+void **memoryPointer    /* I/O: memory */
+)
+/*
+DESCRIPTION:
+   Not replayed: realloc(), the memory is kept if it fails.
+*/
+{
+    if (memoryPointer == nullptr)
+        return ZW_API_INVALID_OUTPUT;
+    if (numBytes <= 0)
+        return ZW_API_INVALID_INPUT;
+    void *resized = realloc(*memoryPointer, (size_t)numBytes);
+    if (resized == nullptr)
+        return ZW_API_MEMORY_ERROR;
+    *memoryPointer = resized;
+    return ZW_API_NO_ERROR;
+}
+
+/*******************************************************************/
+/* Function definition */
+ezwErrors ZwMemoryZero
+(
+int numBytes,          /* I: number of bytes */
+void *memoryPointer    /* I/O: memory */
+)
+/*
+DESCRIPTION:
+   Not replayed: zero the memory.
+*/
+{
+    if (memoryPointer == nullptr || numBytes < 0)
+        return ZW_API_INVALID_INPUT;
+    memset(memoryPointer, 0, (size_t)numBytes);
+    return ZW_API_NO_ERROR;
+}
+
+/*******************************************************************/
+/* Function definition */
+ezwErrors ZwMemoryFree
+(
+void **memoryPointer   /* I/O: memory, NULL on return */
+)
+/*
+DESCRIPTION:
+   Not replayed: free() and clear the pointer.
+*/
+{
+    if (memoryPointer == nullptr)
+        return ZW_API_INVALID_INPUT;
+    free(*memoryPointer);
+    *memoryPointer = nullptr;
+    return ZW_API_NO_ERROR;
+}
@@ -0,0 +1,643 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* ZW3D API includes */
+#include "zwapi_brep_shape.h"   /* first, its include guard is the one of zwapi_shape.h */
+#include "zwapi_brep_edge.h"
+#include "zwapi_brep_face.h"
+#include "zwapi_brep_loop.h"
+#include "zwapi_brep_vertex.h"
+#include "zwapi_display.h"
+#include "zwapi_edge.h"
+#include "zwapi_entity.h"
+#include "zwapi_face.h"
+#include "zwapi_file.h"
+#include "zwapi_file_path.h"
+#include "zwapi_math_matrix.h"
+#include "zwapi_memory.h"
+#include "zwapi_part_facets.h"
+#include "zwapi_part_objs.h"
+#include "zwapi_shape.h"
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+#include "ReplayRecord.h"
+
+/*******************************************************************/
+/* Data type definitions */
+typedef std::chrono::steady_clock::time_point RecordTime;
+
+/*******************************************************************/
+/* Function declarations */
+static RecordTime Now(void);
+static void Add(TraceWriter *trace, int call, const TraceBuffer &key, int result, const TraceBuffer &reply, RecordTime start);
+static void IdListAdd(TraceWriter *trace, int call, const TraceBuffer &key, int result, int count, const int *list, RecordTime start);
+static void HandleListAdd(TraceWriter *trace, int call, const TraceBuffer &key, int result, int count, const szwEntityHandle *list, RecordTime start);
+static void RefineSet(double tolerance, szwRefineFacetsOfMultiFace *refine);
+static int EntityRecord(int id, TraceWriter *trace);
+static int FaceRecord(int idFace, double tolerance, TraceWriter *trace);
+static int LoopRecord(int idLoop, TraceWriter *trace);
+static int EdgeRecord(int idEdge, TraceWriter *trace);
+static int ShapeFacetsRecord(int idShape, double tolerance, TraceWriter *trace);
+
+/*******************************************************************/
+/* Function definition */
+RecordTime Now
+(
+void
+)
+/*
+DESCRIPTION:
+   Start time of a recorded call.
+*/
+{
+    return std::chrono::steady_clock::now();
+}
+
+/*******************************************************************/
+/* Function definition */
+void Add
+(
+TraceWriter *trace,         /* I/O: trace */
+int call,                   /* I: ReplayCall */
+const TraceBuffer &key,     /* I: inputs */
+int result,                 /* I: return code */
+const TraceBuffer &reply,   /* I: outputs */
+RecordTime start            /* I: start of the call */
+)
+/*
+DESCRIPTION:
+   Add a call to the trace with the time since "start".
+*/
+{
+    const double micros = std::chrono::duration<double, std::micro>(Now() - start).count();
+    trace->Add(call, key, result, reply, (int)(micros + 0.5));
+}
+
+/*******************************************************************/
+/* Function definition */
+void IdListAdd
+(
+TraceWriter *trace,         /* I/O: trace */
+int call,                   /* I: ReplayCall */
+const TraceBuffer &key,     /* I: inputs */
+int result,                 /* I: return code */
+int count,                  /* I: number of ids */
+const int *list,            /* I: ids */
+RecordTime start            /* I: start of the call */
+)
+/*
+DESCRIPTION:
+   Add a call answering a list of ids.
+*/
+{
+    const RecordTime end = Now();
+    TraceBuffer reply;
+    TraceIntListPut(reply, result == ZW_API_NO_ERROR ? count : 0, list);
+    Add(trace, call, key, result, reply, start + (Now() - end));
+}
+
+/*******************************************************************/
+/* Function definition */
+void HandleListAdd
+(
+TraceWriter *trace,                /* I/O: trace */
+int call,                          /* I: ReplayCall */
+const TraceBuffer &key,            /* I: inputs */
+int result,                        /* I: return code */
+int count,                         /* I: number of handles */
+const szwEntityHandle *list,       /* I: handles */
+RecordTime start                   /* I: start of the call */
+)
+/*
+DESCRIPTION:
+   Add a call answering a list of handles; the handles are recorded as
+their entity ids.
+*/
+{
+    const RecordTime end = Now();
+    std::vector<int> ids(result == ZW_API_NO_ERROR && count > 0 ? (size_t)count : 0);
+    if (!ids.empty() && ZwEntityIdGet(count, list, ids.data()))
+        ids.clear();
+    TraceBuffer reply;
+    TraceIntListPut(reply, (int)ids.size(), ids.data());
+    Add(trace, call, key, result, reply, start + (Now() - end));
+}
+
+/*******************************************************************/
+/* Function definition */
+void RefineSet
+(
+double tolerance,                      /* I: distance tolerance (mm) */
+szwRefineFacetsOfMultiFace *refine     /* O: tolerances, no faces */
+)
+/*
+DESCRIPTION:
+   The tolerances of the recorded facets.
+*/
+{
+    memset(refine, 0, sizeof(*refine));
+    refine->type = ZW_FACETS_TOLORANCE_DISTANCE;
+    refine->edgeTolorance = tolerance;
+    refine->facetTolorance = tolerance;
+    refine->angleTolorance = REPLAY_FACET_ANGLE;
+    refine->surfaceTolorance = REPLAY_FACET_SURFACE;
+}
+
+/*******************************************************************/
+/* Function definition */
+int EntityRecord
+(
+int id,               /* I: entity id */
+TraceWriter *trace    /* I/O: trace */
+)
+/*
+DESCRIPTION:
+   Record the class number, the world box and the unique id of an entity.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    szwEntityHandle entity{};
+    if (ZwEntityIdTransfer(1, &id, &entity))
+        return 1;
+
+    TraceBuffer key, reply;
+    key.Int(id);
+    ezwEntityType type = (ezwEntityType)0;
+    RecordTime start = Now();
+    int result = ZwEntityTypeNumberGet(entity, &type);
+    reply.Int(type);
+    Add(trace, Replay_EntityTypeNumberGet, key, result, reply, start);
+
+    szwMatrix frame;
+    memset(&frame, 0, sizeof(frame));
+    frame.identity = 1;
+    frame.xx = frame.yy = frame.zz = frame.scale = 1.0;
+    szwBoundingBox box;
+    memset(&box, 0, sizeof(box));
+    TraceBuffer boxKey;
+    boxKey.Int(id);
+    boxKey.Int(ZW_COORDINATE_WORLD);
+    TraceZwMatrixPut(boxKey, frame);
+    start = Now();
+    result = ZwEntityBoundingBoxGet(entity, ZW_COORDINATE_WORLD, frame, &box);
+    reply.Clear();
+    TraceBoxPut(reply, box);
+    Add(trace, Replay_EntityBoundingBoxGet, boxKey, result, reply, start);
+
+    szwEntityIdentifier unique{};
+    start = Now();
+    result = ZwEntityUniqueIdGet(entity, &unique);
+    reply.Clear();
+    const int bytes = unique.innerData != nullptr ? unique.dataLen : 0;
+    reply.Int(bytes);
+    reply.Bytes(unique.innerData, bytes);
+    reply.Int(unique.idType);
+    Add(trace, Replay_EntityUniqueIdGet, key, result, reply, start);
+    ZwMemoryFree((void **)&unique.innerData);
+
+    ZwEntityHandleFree(&entity);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int FaceRecord
+(
+int idFace,           /* I: face id */
+double tolerance,     /* I: facet distance tolerance */
+TraceWriter *trace    /* I/O: trace */
+)
+/*
+DESCRIPTION:
+   Record the loops, the facets and the edge handles of a face, then walk
+its loops.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    TraceBuffer key;
+    key.Int(idFace);
+
+    /* loops, with and without the inner ones; the inner list holds all */
+    std::vector<int> loops;
+    for (int inner = 1; inner >= 0; inner--)
+    {
+        TraceBuffer loopKey;
+        loopKey.Int(idFace);
+        loopKey.Int(inner);
+        int count = 0, *list = nullptr;
+        const RecordTime start = Now();
+        const int result = cvxPartInqFaceLoops(idFace, inner, &count, &list);
+        IdListAdd(trace, Replay_PartInqFaceLoops, loopKey, result, count, list, start);
+        if (inner && result == ZW_API_NO_ERROR && list != nullptr)
+            loops.assign(list, list + count);
+        cvxMemFree((void **)&list);
+    }
+
+    svxFacets facets;
+    memset(&facets, 0, sizeof(facets));
+    RecordTime start = Now();
+    int result = cvxPartInqFaceFacets2(idFace, &facets);
+    {
+        const RecordTime end = Now();
+        TraceBuffer reply;
+        TraceFacetsPut(reply, facets);
+        Add(trace, Replay_PartInqFaceFacets2, key, result, reply, start + (Now() - end));
+    }
+    cvxFacetsFree(&facets);
+
+    szwEntityHandle face{};
+    if (ZwEntityIdTransfer(1, &idFace, &face) == ZW_API_NO_ERROR)
+    {
+        int count = 0;
+        szwEntityHandle *edges = nullptr;
+        start = Now();
+        result = ZwFaceEdgeListGet(face, &count, &edges);
+        HandleListAdd(trace, Replay_FaceEdgeListGet, key, result, count, edges, start);
+        if (edges != nullptr)
+            ZwEntityHandleListFree(count, &edges);
+
+        szwRefineFacetsOfMultiFace multi;
+        RefineSet(tolerance, &multi);
+        multi.countFace = 1;
+        multi.faceHandle = &face;
+        szwRefineFacets refine;
+        refine.faceHandle = face;
+        refine.type = multi.type;
+        refine.edgeTolorance = multi.edgeTolorance;
+        refine.facetTolorance = multi.facetTolorance;
+        refine.angleTolorance = multi.angleTolorance;
+        refine.surfaceTolorance = multi.surfaceTolorance;
+        TraceBuffer refineKey;
+        TraceRefinePut(refineKey, multi, &idFace);
+        szwFacets mesh;
+        memset(&mesh, 0, sizeof(mesh));
+        start = Now();
+        result = ZwFaceFacetsGet(refine, &mesh);
+        const RecordTime end = Now();
+        TraceBuffer reply;
+        TraceZwFacetsPut(reply, mesh);
+        Add(trace, Replay_FaceFacetsGet, refineKey, result, reply, start + (Now() - end));
+        ZwFaceFacetsDataFree(&mesh);
+        ZwEntityHandleFree(&face);
+    }
+
+    EntityRecord(idFace, trace);
+    for (size_t i = 0; i < loops.size(); i++)
+        LoopRecord(loops[i], trace);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int LoopRecord
+(
+int idLoop,           /* I: loop id */
+TraceWriter *trace    /* I/O: trace */
+)
+/*
+DESCRIPTION:
+   Record the edges and the inner flag of a loop.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    TraceBuffer key;
+    key.Int(idLoop);
+    int count = 0, *edges = nullptr;
+    RecordTime start = Now();
+    int result = cvxPartInqLoopEdges(idLoop, &count, &edges);
+    IdListAdd(trace, Replay_PartInqLoopEdges, key, result, count, edges, start);
+    cvxMemFree((void **)&edges);
+
+    int inner = 0;
+    start = Now();
+    result = cvxPartInqLoopInner(idLoop, &inner);
+    TraceBuffer reply;
+    reply.Int(inner);
+    Add(trace, Replay_PartInqLoopInner, key, result, reply, start);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int EdgeRecord
+(
+int idEdge,           /* I: edge id */
+TraceWriter *trace    /* I/O: trace */
+)
+/*
+DESCRIPTION:
+   Record the faces, the 3D curve, the UV curve on each face, the edges at
+both vertices and the face handles of an edge.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    TraceBuffer key;
+    key.Int(idEdge);
+    int faceCount = 0, *faces = nullptr;
+    RecordTime start = Now();
+    int result = cvxPartInqEdgeFaces(idEdge, &faceCount, &faces);
+    IdListAdd(trace, Replay_PartInqEdgeFaces, key, result, faceCount, faces, start);
+    if (result != ZW_API_NO_ERROR)
+        faceCount = 0;
+
+    /* the 3D curve (face 0), then the UV curve on each face */
+    for (int i = -1; i < faceCount; i++)
+    {
+        const int idFace = i < 0 ? 0 : faces[i];
+        TraceBuffer curveKey;
+        curveKey.Int(idEdge);
+        curveKey.Int(idFace);
+        svxCurve curve;
+        memset(&curve, 0, sizeof(curve));
+        cvxMatInit(&curve.Frame);
+        start = Now();
+        result = cvxPartInqEdgeCrv(idEdge, idFace, &curve);
+        const RecordTime end = Now();
+        TraceBuffer reply;
+        TraceCurvePut(reply, curve);
+        Add(trace, Replay_PartInqEdgeCrv, curveKey, result, reply, start + (Now() - end));
+        cvxCurveFree(&curve);
+    }
+    cvxMemFree((void **)&faces);
+
+    for (int end = 0; end < 2; end++)
+    {
+        TraceBuffer vertexKey;
+        vertexKey.Int(idEdge);
+        vertexKey.Int(end);
+        int count = 0, *edges = nullptr;
+        start = Now();
+        result = cvxPartInqVertexEdges(idEdge, end, &count, &edges);
+        IdListAdd(trace, Replay_PartInqVertexEdges, vertexKey, result, count, edges, start);
+        cvxMemFree((void **)&edges);
+    }
+
+    szwEntityHandle edge{};
+    if (ZwEntityIdTransfer(1, &idEdge, &edge) == ZW_API_NO_ERROR)
+    {
+        int count = 0;
+        szwEntityHandle *list = nullptr;
+        start = Now();
+        result = ZwEdgeFaceListGet(edge, &count, &list);
+        HandleListAdd(trace, Replay_EdgeFaceListGet, key, result, count, list, start);
+        if (list != nullptr)
+            ZwEntityHandleListFree(count, &list);
+        ZwEntityHandleFree(&edge);
+    }
+
+    EntityRecord(idEdge, trace);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int ShapeFacetsRecord
+(
+int idShape,          /* I: shape id */
+double tolerance,     /* I: facet distance tolerance */
+TraceWriter *trace    /* I/O: trace */
+)
+/*
+DESCRIPTION:
+   Record the face handles of a shape and the facets of all its faces in
+one call, as add-ons meshing a whole shape ask for them.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    szwEntityHandle shape{};
+    if (ZwEntityIdTransfer(1, &idShape, &shape))
+        return 1;
+
+    TraceBuffer key;
+    key.Int(idShape);
+    int count = 0;
+    szwEntityHandle *faces = nullptr;
+    RecordTime start = Now();
+    int result = ZwShapeFaceListGet(shape, &count, &faces);
+    HandleListAdd(trace, Replay_ShapeFaceListGet, key, result, count, faces, start);
+
+    if (result == ZW_API_NO_ERROR && count > 0)
+    {
+        std::vector<int> ids((size_t)count);
+        if (ZwEntityIdGet(count, faces, ids.data()) == ZW_API_NO_ERROR)
+        {
+            szwRefineFacetsOfMultiFace refine;
+            RefineSet(tolerance, &refine);
+            refine.countFace = count;
+            refine.faceHandle = faces;
+            TraceBuffer refineKey;
+            TraceRefinePut(refineKey, refine, ids.data());
+            int meshCount = 0;
+            szwFacets *meshes = nullptr;
+            start = Now();
+            result = ZwFaceListFacetsGet(refine, &meshCount, &meshes);
+            const RecordTime end = Now();
+            TraceBuffer reply;
+            reply.Int(result == ZW_API_NO_ERROR && meshes != nullptr ? meshCount : 0);
+            for (int i = 0; i < meshCount && result == ZW_API_NO_ERROR && meshes != nullptr; i++)
+                TraceZwFacetsPut(reply, meshes[i]);
+            Add(trace, Replay_FaceListFacetsGet, refineKey, result, reply, start + (Now() - end));
+            for (int i = 0; i < meshCount && meshes != nullptr; i++)
+                ZwFaceFacetsDataFree(&meshes[i]);
+            ZwMemoryFree((void **)&meshes);
+        }
+    }
+    if (faces != nullptr)
+        ZwEntityHandleListFree(count, &faces);
+    ZwEntityHandleFree(&shape);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int ReplayRecordShape
+(
+int idShape,          /* I: shape id */
+double tolerance,     /* I: facet distance tolerance (mm) */
+TraceWriter *trace    /* I/O: trace */
+)
+/*
+DESCRIPTION:
+   Record the whole topology of a shape: its faces and edges, each face
+with its loops and facets, each loop, each edge with its curves, and the
+entity inquiries of the shape, the faces and the edges.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    TraceBuffer key;
+    key.Int(idShape);
+    int faceCount = 0, *faces = nullptr;
+    RecordTime start = Now();
+    int result = cvxPartInqShapeFaces(idShape, &faceCount, &faces);
+    IdListAdd(trace, Replay_PartInqShapeFaces, key, result, faceCount, faces, start);
+    if (result != ZW_API_NO_ERROR)
+        return 1;
+
+    int edgeCount = 0, *edges = nullptr;
+    start = Now();
+    result = cvxPartInqShapeEdges(idShape, &edgeCount, &edges);
+    IdListAdd(trace, Replay_PartInqShapeEdges, key, result, edgeCount, edges, start);
+    if (result != ZW_API_NO_ERROR)
+        edgeCount = 0;
+
+    EntityRecord(idShape, trace);
+    ShapeFacetsRecord(idShape, tolerance, trace);
+    for (int i = 0; i < faceCount; i++)
+        FaceRecord(faces[i], tolerance, trace);
+    for (int i = 0; i < edgeCount; i++)
+        EdgeRecord(edges[i], trace);
+
+    cvxMemFree((void **)&faces);
+    cvxMemFree((void **)&edges);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int ReplayRecordPart
+(
+double tolerance,     /* I: facet distance tolerance (mm) */
+TraceWriter *trace    /* I/O: trace */
+)
+/*
+DESCRIPTION:
+   Record the shapes of the active part and walk each of them.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    TraceBuffer key;
+    key.Text("");
+    key.Text("");
+    int count = 0, *shapes = nullptr;
+    const RecordTime start = Now();
+    const int result = cvxPartInqShapes("", "", &count, &shapes);
+    IdListAdd(trace, Replay_PartInqShapes, key, result, count, shapes, start);
+    if (result != ZW_API_NO_ERROR)
+        return 1;
+
+    for (int i = 0; i < count; i++)
+        ReplayRecordShape(shapes[i], tolerance, trace);
+    cvxMemFree((void **)&shapes);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int ReplayRecordPick
+(
+TraceWriter *trace    /* I/O: trace */
+)
+/*
+DESCRIPTION:
+   Let the user pick shapes and record the pick, which a replayed add-on
+then gets without a user. An empty pick is not recorded.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    TraceBuffer key;
+    key.Int(ZW_INPUT_SHAPE);
+    int count = 0;
+    szwEntityHandle *shapes = nullptr;
+    const RecordTime start = Now();
+    const int result = ZwEntityListGetByPick("Select the shapes an add-on picks (optional)", ZW_INPUT_SHAPE, 1,
+                                             &count, &shapes);
+    if (result == ZW_API_NO_ERROR && count > 0)
+        HandleListAdd(trace, Replay_EntityListGetByPick, key, result, count, shapes, start);
+    if (shapes != nullptr)
+        ZwEntityHandleListFree(count, &shapes);
+    return result == ZW_API_NO_ERROR ? 0 : 1;
+}
+
+/*******************************************************************/
+/* Function definition */
+int ReplayRecordExport
+(
+TraceWriter *trace    /* I/O: trace */
+)
+/*
+DESCRIPTION:
+   Record the calls of the file export flow of the FileExport example:
+active file, directory, output path, window size and the export of the
+image, which is written next to the active file.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    TraceBuffer none, reply;
+    vxLongName name;
+    RecordTime start = Now();
+    cvxFileInqActive(name, sizeof(name));
+    reply.Text(name);
+    Add(trace, Replay_FileInqActive, none, ZW_API_NO_ERROR, reply, start);
+    if (!name[0])
+        return 1;
+
+    vxPath directory;
+    start = Now();
+    cvxFileDirectory(directory);
+    reply.Clear();
+    reply.Text(directory);
+    Add(trace, Replay_FileDirectory, none, ZW_API_NO_ERROR, reply, start);
+
+    vxPath path;
+    snprintf(path, sizeof(path), "%s", REPLAY_EXPORT_NAME);
+    if (directory[0])
+    {
+        TraceBuffer key;
+        key.Text(directory);
+        key.Text(REPLAY_EXPORT_NAME);
+        snprintf(path, sizeof(path), "%s", directory);
+        start = Now();
+        const int result = cvxPathCompose(path, REPLAY_EXPORT_NAME);
+        reply.Clear();
+        reply.Text(path);
+        Add(trace, Replay_PathCompose, key, result, reply, start);
+        if (result != ZW_API_NO_ERROR)
+            return 1;
+    }
+
+    TraceBuffer rectKey;
+    rectKey.Int(0);
+    rectKey.Int(1);
+    int x = 0, y = 0, width = 0, height = 0;
+    start = Now();
+    int result = cvxDispWindowRectGet(0, 1, &x, &y, &width, &height);
+    reply.Clear();
+    reply.Int(x);
+    reply.Int(y);
+    reply.Int(width);
+    reply.Int(height);
+    Add(trace, Replay_DispWindowRectGet, rectKey, result, reply, start);
+
+    svxImgData image;
+    memset(&image, 0, sizeof(image));
+    image.Type = VX_EXPORT_IMG_TYPE_PNG;
+    image.BkgndMode = VX_EXPORT_IMG_BKGND_MODE_CURRENT;
+    image.ColorMode = VX_EXPORT_IMG_COLOR_MODE_24BITS;
+    image.RangeMode = VX_EXPORT_IMG_RANGE_MODE_NORMAL;
+    image.Width = (unsigned int)width;
+    image.Height = (unsigned int)height;
+    TraceBuffer exportKey;
+    exportKey.Int(VX_EXPORT_TYPE_IMG);
+    exportKey.Text(path);
+    start = Now();
+    result = cvxFileExport(VX_EXPORT_TYPE_IMG, path, &image);
+    reply.Clear();
+    Add(trace, Replay_FileExport, exportKey, result, reply, start);
+    return result == ZW_API_NO_ERROR ? 0 : 1;
+}
@@ -0,0 +1,150 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* ZW3D API includes */
+#include "zwapi_display.h"
+#include "zwapi_file.h"
+#include "zwapi_file_path.h"
+#include "zwapi_message.h"
+
+/*******************************************************************/
+/* Application includes */
+#include "ReplayHost.h"
+
+/*
+DESCRIPTION:
+   File, path, display and message functions of the stand-in host used by
+the file export flow. The export itself is replayed: the recorded return
+code is answered and no file is written. The key and the reply of each
+call are written the same way by ReplayRecord.cpp.
+*/
+
+/*******************************************************************/
+/* Function definition */
+void cvxFileInqActive
+(
+char *Name,    /* O: name of the active file, empty if none */
+int nBytes     /* I: size of "Name" in bytes */
+)
+/*
+DESCRIPTION:
+   Key: none. Reply: file name.
+*/
+{
+    if (Name == nullptr || nBytes < 1)
+        return;
+    TraceBuffer key;
+    TraceReader reply;
+    ReplayHostFind(Replay_FileInqActive, key, &reply);
+    reply.Text(Name, nBytes);
+}
+
+/*******************************************************************/
+/* Function definition */
+void cvxFileDirectory
+(
+vxPath Dir   /* O: directory of the active file, empty if none */
+)
+/*
+DESCRIPTION:
+   Key: none. Reply: directory.
+*/
+{
+    if (Dir == nullptr)
+        return;
+    TraceBuffer key;
+    TraceReader reply;
+    ReplayHostFind(Replay_FileDirectory, key, &reply);
+    reply.Text(Dir, sizeof(vxPath));
+}
+
+/*******************************************************************/
+/* Function definition */
+evxErrors cvxPathCompose
+(
+vxPath Path,          /* I/O: directory, the composed path on return */
+const char *File      /* I: file name */
+)
+/*
+DESCRIPTION:
+   Key: directory and file name. Reply: composed path.
+*/
+{
+    if (Path == nullptr || File == nullptr)
+        return ZW_API_INVALID_INPUT;
+    TraceBuffer key;
+    key.Text(Path);
+    key.Text(File);
+    TraceReader reply;
+    const int result = ReplayHostFind(Replay_PathCompose, key, &reply);
+    if (result == ZW_API_NO_ERROR)
+        reply.Text(Path, sizeof(vxPath));
+    return (evxErrors)result;
+}
+
+/*******************************************************************/
+/* Function definition */
+evxErrors cvxDispWindowRectGet
+(
+const int includeFrame,   /* I: 1 to include the frame */
+const int isGlobal,       /* I: 1 for screen coordinates */
+int *x,                   /* O: left, can be NULL */
+int *y,                   /* O: top, can be NULL */
+int *w,                   /* O: width, can be NULL */
+int *h                    /* O: height, can be NULL */
+)
+/*
+DESCRIPTION:
+   Key: "includeFrame" and "isGlobal". Reply: left, top, width, height.
+*/
+{
+    TraceBuffer key;
+    key.Int(includeFrame);
+    key.Int(isGlobal);
+    TraceReader reply;
+    const int result = ReplayHostFind(Replay_DispWindowRectGet, key, &reply);
+    int *outputs[4] = { x, y, w, h };
+    for (int i = 0; i < 4; i++)
+    {
+        const int value = reply.Int();
+        if (outputs[i] != nullptr)
+            *outputs[i] = value;
+    }
+    return (evxErrors)result;
+}
+
+/*******************************************************************/
+/* Function definition */
+evxErrors cvxFileExport
+(
+evxExportType Type,        /* I: export type */
+const vxLongPath Path,     /* I: output file */
+void * /* Data */          /* I: export options of the type, not part of the key */
+)
+/*
+DESCRIPTION:
+   Key: type and path. Reply: none.
+*/
+{
+    TraceBuffer key;
+    key.Int(Type);
+    key.Text(Path);
+    TraceReader reply;
+    return (evxErrors)ReplayHostFind(Replay_FileExport, key, &reply);
+}
+
+/*******************************************************************/
+/* Function definition */
+void cvxMsgDisp
+(
+const char *Text   /* I: message */
+)
+/*
+DESCRIPTION:
+   Not replayed: there is no message area, the message is dropped.
+*/
+{
+    (void)Text;
+}
@@ -0,0 +1,1072 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ReplayTrace.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define TRACE_HEADER_BYTES 16        /* magic, version, record count, reserved */
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: names of the calls, in the order of ReplayCall */
+static const char *s_callNames[Replay_CallCount] =
+{
+    "None",
+    "cvxPartInqShapes",
+    "cvxPartInqShapeFaces",
+    "cvxPartInqShapeEdges",
+    "cvxPartInqFaceLoops",
+    "cvxPartInqLoopEdges",
+    "cvxPartInqLoopInner",
+    "cvxPartInqEdgeFaces",
+    "cvxPartInqEdgeCrv",
+    "cvxPartInqVertexEdges",
+    "cvxPartInqFaceFacets2",
+    "ZwShapeFaceListGet",
+    "ZwFaceEdgeListGet",
+    "ZwEdgeFaceListGet",
+    "ZwFaceFacetsGet",
+    "ZwFaceListFacetsGet",
+    "ZwEntityTypeNumberGet",
+    "ZwEntityBoundingBoxGet",
+    "ZwEntityUniqueIdGet",
+    "ZwEntityListGetByPick",
+    "cvxFileInqActive",
+    "cvxFileDirectory",
+    "cvxPathCompose",
+    "cvxDispWindowRectGet",
+    "cvxFileExport",
+};
+
+/*******************************************************************/
+/* Function declarations */
+static uint64_t Fnv1a(const void *data, size_t bytes);
+static void PutVarint(std::string &out, uint64_t value);
+static void PutWord(std::string &out, uint32_t value);
+static uint32_t GetWord(const unsigned char *data);
+static FILE *FileOpen(const char *path, const char *mode);
+static void *ListAlloc(int count, int itemBytes);
+static int StripLength(int stripCount, const int *strips);
+static void StripsPut(TraceBuffer &out, int stripCount, const int *strips);
+static void StripsGet(TraceReader &in, int *stripCount, int **strips);
+static void PointsPut(TraceBuffer &out, int count, int dimension, const float *points);
+static void PointsGet(TraceReader &in, int count, int dimension, float **points);
+
+/*******************************************************************/
+/* Function definition */
+const char *ReplayCallName
+(
+int call   /* I: ReplayCall */
+)
+/*
+DESCRIPTION:
+   Name of the API function of a call.
+*/
+{
+    return call > Replay_None && call < Replay_CallCount ? s_callNames[call] : "unknown";
+}
+
+/*******************************************************************/
+/* Function definition */
+uint64_t Fnv1a
+(
+const void *data,   /* I: bytes */
+size_t bytes        /* I: number of bytes */
+)
+/*
+DESCRIPTION:
+   64-bit FNV-1a hash, the checksum of the trace file.
+*/
+{
+    const unsigned char *p = (const unsigned char *)data;
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < bytes; i++)
+        hash = (hash ^ p[i]) * 1099511628211ULL;
+    return hash;
+}
+
+/*******************************************************************/
+/* Function definition */
+void PutVarint
+(
+std::string &out,   /* I/O: bytes */
+uint64_t value      /* I: value */
+)
+/*
+DESCRIPTION:
+   Append a value 7 bits per byte, low bits first; values below 128 take
+one byte.
+*/
+{
+    while (value >= 0x80)
+    {
+        out.push_back((char)(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back((char)value);
+}
+
+/*******************************************************************/
+/* Function definition */
+void PutWord
+(
+std::string &out,   /* I/O: bytes */
+uint32_t value      /* I: value */
+)
+/*
+DESCRIPTION:
+   Append a 32-bit value in little-endian order.
+*/
+{
+    for (int i = 0; i < 4; i++)
+        out.push_back((char)(value >> (8 * i)));
+}
+
+/*******************************************************************/
+/* Function definition */
+uint32_t GetWord
+(
+const unsigned char *data   /* I: 4 bytes of PutWord() */
+)
+/*
+DESCRIPTION:
+   Read a value of PutWord().
+*/
+{
+    return (uint32_t)data[0] | (uint32_t)data[1] << 8 | (uint32_t)data[2] << 16 | (uint32_t)data[3] << 24;
+}
+
+/*******************************************************************/
+/* Function definition */
+FILE *FileOpen
+(
+const char *path,   /* I: file path */
+const char *mode    /* I: fopen() mode */
+)
+/*
+DESCRIPTION:
+   Open a file, NULL if it fails. The trace is written by the add-on and
+read by the stand-in library, so both compilers are served.
+*/
+{
+#ifdef _MSC_VER
+    FILE *file = nullptr;
+    return fopen_s(&file, path, mode) ? nullptr : file;
+#else
+    return fopen(path, mode);
+#endif
+}
+
+/*******************************************************************/
+/* Function definition */
+void *ListAlloc
+(
+int count,       /* I: number of items */
+int itemBytes    /* I: bytes of an item */
+)
+/*
+DESCRIPTION:
+   Zeroed list for an output of a replayed call, freed by the memory
+functions of the stand-in library. NULL for an empty list.
+*/
+{
+    return count > 0 ? calloc((size_t)count, (size_t)itemBytes) : nullptr;
+}
+
+/*******************************************************************/
+/* Function definition */
+void TraceBuffer::Int
+(
+int value   /* I: value */
+)
+/*
+DESCRIPTION:
+   Append a zigzag variable-length integer.
+*/
+{
+    PutVarint(m_data, (uint64_t)(((uint32_t)value << 1) ^ (uint32_t)(value >> 31)));
+}
+
+/*******************************************************************/
+/* Function definition */
+void TraceBuffer::Double
+(
+double value   /* I: value */
+)
+/*
+DESCRIPTION:
+   Append the 8 bytes of a double.
+*/
+{
+    Bytes(&value, sizeof(value));
+}
+
+/*******************************************************************/
+/* Function definition */
+void TraceBuffer::Float
+(
+float value   /* I: value */
+)
+/*
+DESCRIPTION:
+   Append the 4 bytes of a float.
+*/
+{
+    Bytes(&value, sizeof(value));
+}
+
+/*******************************************************************/
+/* Function definition */
+void TraceBuffer::Text
+(
+const char *text   /* I: text, NULL for an empty one */
+)
+/*
+DESCRIPTION:
+   Append the length and the characters of a text.
+*/
+{
+    const int length = text != nullptr ? (int)strlen(text) : 0;
+    Int(length);
+    Bytes(text, length);
+}
+
+/*******************************************************************/
+/* Function definition */
+void TraceBuffer::Bytes
+(
+const void *data,   /* I: bytes */
+int bytes           /* I: number of bytes */
+)
+/*
+DESCRIPTION:
+   Append raw bytes.
+*/
+{
+    if (bytes > 0)
+        m_data.append((const char *)data, (size_t)bytes);
+}
+
+/*******************************************************************/
+/* Function definition */
+TraceReader::TraceReader
+(
+)
+/*
+DESCRIPTION:
+   Empty reader, the reply of a call missing in the trace.
+*/
+    : m_data(nullptr), m_size(0), m_offset(0), m_failed(1)
+{
+}
+
+/*******************************************************************/
+/* Function definition */
+TraceReader::TraceReader
+(
+const void *data,   /* I: bytes of a key or a reply */
+size_t bytes        /* I: number of bytes */
+)
+/*
+DESCRIPTION:
+   Reader of the bytes, which must outlive it.
+*/
+    : m_data((const unsigned char *)data), m_size(bytes), m_offset(0), m_failed(0)
+{
+}
+
+/*******************************************************************/
+/* Function definition */
+uint64_t TraceReader::Varint
+(
+void
+)
+/*
+DESCRIPTION:
+   Read a variable-length integer, 7 bits per byte, low bits first.
+*/
+{
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7)
+    {
+        if (m_offset >= m_size)
+            break;
+        const unsigned char byte = m_data[m_offset++];
+        value |= (uint64_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80))
+            return value;
+    }
+    m_failed = 1;
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int TraceReader::Int
+(
+void
+)
+/*
+DESCRIPTION:
+   Read a value of TraceBuffer::Int().
+*/
+{
+    const uint32_t zigzag = (uint32_t)Varint();
+    return (int)(zigzag >> 1) ^ -(int)(zigzag & 1);
+}
+
+/*******************************************************************/
+/* Function definition */
+double TraceReader::Double
+(
+void
+)
+/*
+DESCRIPTION:
+   Read a value of TraceBuffer::Double().
+*/
+{
+    double value = 0.0;
+    Bytes(&value, sizeof(value));
+    return value;
+}
+
+/*******************************************************************/
+/* Function definition */
+float TraceReader::Float
+(
+void
+)
+/*
+DESCRIPTION:
+   Read a value of TraceBuffer::Float().
+*/
+{
+    float value = 0.0f;
+    Bytes(&value, sizeof(value));
+    return value;
+}
+
+/*******************************************************************/
+/* Function definition */
+void TraceReader::Text
+(
+char *text,   /* O: text */
+int size      /* I: size of "text" in bytes */
+)
+/*
+DESCRIPTION:
+   Read a text of TraceBuffer::Text(). A text longer than "size" is cut;
+the rest is skipped.
+*/
+{
+    const int length = Int();
+    if (length < 0 || (size_t)length > m_size - m_offset)
+    {
+        m_failed = 1;
+        if (size > 0)
+            text[0] = 0;
+        return;
+    }
+    const int copy = length < size ? length : size - 1;
+    if (copy > 0)
+        memcpy(text, m_data + m_offset, (size_t)copy);
+    if (size > 0)
+        text[copy > 0 ? copy : 0] = 0;
+    m_offset += (size_t)length;
+}
+
+/*******************************************************************/
+/* Function definition */
+void TraceReader::Bytes
+(
+void *data,   /* O: bytes */
+int bytes     /* I: number of bytes */
+)
+/*
+DESCRIPTION:
+   Read raw bytes, zeros past the end.
+*/
+{
+    if (bytes <= 0)
+        return;
+    if ((size_t)bytes > m_size - m_offset)
+    {
+        m_failed = 1;
+        m_offset = m_size;
+        memset(data, 0, (size_t)bytes);
+        return;
+    }
+    memcpy(data, m_data + m_offset, (size_t)bytes);
+    m_offset += (size_t)bytes;
+}
+
+/*******************************************************************/
+/* Function definition */
+const unsigned char *TraceReader::Skip
+(
+uint64_t bytes   /* I: number of bytes */
+)
+/*
+DESCRIPTION:
+   Pass over bytes and return where they start, NULL (and failed) if the
+data ends before.
+*/
+{
+    if (bytes > m_size - m_offset || bytes > 0x7FFFFFFF)
+    {
+        m_failed = 1;
+        m_offset = m_size;
+        return nullptr;
+    }
+    const unsigned char *start = m_data + m_offset;
+    m_offset += (size_t)bytes;
+    return start;
+}
+
+/*******************************************************************/
+/* Function definition */
+int TraceReader::Count
+(
+int itemBytes   /* I: least bytes of an item in the data */
+)
+/*
+DESCRIPTION:
+   Read the number of items of a list, 0 (and failed) if the rest of the
+data cannot hold them, so a bad trace never makes a huge allocation.
+*/
+{
+    const int count = Int();
+    if (count < 0 || (itemBytes > 0 && (size_t)count > (m_size - m_offset) / (size_t)itemBytes))
+    {
+        m_failed = 1;
+        return 0;
+    }
+    return count;
+}
+
+/*******************************************************************/
+/* Function definition */
+TraceWriter::TraceWriter
+(
+)
+/*
+DESCRIPTION:
+   Create an empty writer.
+*/
+    : m_count(0)
+{
+}
+
+/*******************************************************************/
+/* Function definition */
+void TraceWriter::Add
+(
+int call,                    /* I: ReplayCall */
+const TraceBuffer &key,      /* I: inputs of the call */
+int result,                  /* I: return code of the call */
+const TraceBuffer &reply,    /* I: outputs of the call */
+int micros                   /* I: time of the call (microsecond) */
+)
+/*
+DESCRIPTION:
+   Append a record: call, result (zigzag) and time as variable-length
+integers, then the sizes and the bytes of the key and the reply.
+*/
+{
+    const std::string &keyData = key.Data();
+    const std::string &replyData = reply.Data();
+    PutVarint(m_records, (uint64_t)call);
+    PutVarint(m_records, (uint64_t)(((uint32_t)result << 1) ^ (uint32_t)(result >> 31)));   /* as TraceBuffer::Int() */
+    PutVarint(m_records, (uint64_t)(micros > 0 ? micros : 0));
+    PutVarint(m_records, keyData.size());
+    PutVarint(m_records, replyData.size());
+    m_records.append(keyData);
+    m_records.append(replyData);
+    m_count++;
+}
+
+/*******************************************************************/
+/* Function definition */
+int TraceWriter::Close
+(
+const char *path   /* I: trace file */
+)
+/*
+DESCRIPTION:
+   Write the header, the records and the checksum of both.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    std::string header(REPLAY_TRACE_MAGIC);
+    PutWord(header, REPLAY_TRACE_VERSION);
+    PutWord(header, (uint32_t)m_count);
+    PutWord(header, 0);
+
+    uint64_t checksum = Fnv1a(header.data(), header.size()) ^ Fnv1a(m_records.data(), m_records.size());
+    std::string tail;
+    PutWord(tail, (uint32_t)checksum);
+    PutWord(tail, (uint32_t)(checksum >> 32));
+
+    FILE *file = FileOpen(path, "wb");
+    if (file == nullptr)
+        return 1;
+    int written = fwrite(header.data(), 1, header.size(), file) == header.size();
+    written = written && fwrite(m_records.data(), 1, m_records.size(), file) == m_records.size();
+    written = written && fwrite(tail.data(), 1, tail.size(), file) == tail.size();
+    return (fclose(file) == 0 && written) ? 0 : 1;
+}
+
+/*******************************************************************/
+/* Function definition */
+int TraceFile::Open
+(
+const char *path   /* I: trace file of TraceWriter::Close() */
+)
+/*
+DESCRIPTION:
+   Load the file and index its records.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    m_data.clear();
+    m_records.clear();
+
+    FILE *file = FileOpen(path, "rb");
+    if (file == nullptr)
+        return 1;
+    unsigned char chunk[65536];
+    size_t read;
+    while ((read = fread(chunk, 1, sizeof(chunk), file)) > 0)
+        m_data.insert(m_data.end(), chunk, chunk + read);
+    fclose(file);
+
+    const size_t size = m_data.size();
+    if (size < TRACE_HEADER_BYTES + 8 || memcmp(m_data.data(), REPLAY_TRACE_MAGIC, 4) ||
+        GetWord(&m_data[4]) != REPLAY_TRACE_VERSION)
+        return 1;
+    const uint64_t checksum = (uint64_t)GetWord(&m_data[size - 8]) | (uint64_t)GetWord(&m_data[size - 4]) << 32;
+    if (checksum != (Fnv1a(m_data.data(), TRACE_HEADER_BYTES) ^
+                     Fnv1a(&m_data[TRACE_HEADER_BYTES], size - 8 - TRACE_HEADER_BYTES)))
+        return 1;
+
+    const int count = (int)GetWord(&m_data[8]);
+    TraceReader in(&m_data[TRACE_HEADER_BYTES], size - 8 - TRACE_HEADER_BYTES);
+    m_records.reserve((size_t)count);
+    for (int i = 0; i < count && !in.Failed(); i++)
+    {
+        TraceRecord record;
+        record.call = (int)in.Varint();
+        record.result = in.Int();
+        record.micros = (int)in.Varint();
+        const uint64_t keyBytes = in.Varint();
+        const uint64_t replyBytes = in.Varint();
+        record.key = in.Skip(keyBytes);
+        record.keyBytes = (int)keyBytes;
+        record.reply = in.Skip(replyBytes);
+        record.replyBytes = (int)replyBytes;
+        m_records.push_back(record);
+    }
+    if (in.Failed() || !in.End())
+    {
+        m_records.clear();
+        return 1;
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int StripLength
+(
+int stripCount,      /* I: number of strips */
+const int *strips    /* I: "count, index, index, ..." of each strip */
+)
+/*
+DESCRIPTION:
+   Number of integers of a strip list.
+*/
+{
+    int length = 0;
+    for (int s = 0; s < stripCount && strips != nullptr; s++)
+        length += strips[length] + 1;
+    return length;
+}
+
+/*******************************************************************/
+/* Function definition */
+void StripsPut
+(
+TraceBuffer &out,     /* I/O: reply */
+int stripCount,       /* I: number of strips */
+const int *strips     /* I: strip list */
+)
+/*
+DESCRIPTION:
+   Append a strip list: the vertex counts as they are, the indices as the
+difference to the previous index, which is small for meshes of a face.
+*/
+{
+    const int length = StripLength(stripCount, strips);
+    out.Int(stripCount);
+    out.Int(length);
+    int previous = 0;
+    for (int i = 0; i < length;)
+    {
+        const int count = strips[i++];
+        out.Int(count);
+        for (int k = 0; k < count; k++, i++)
+        {
+            out.Int(strips[i] - previous);
+            previous = strips[i];
+        }
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+void StripsGet
+(
+TraceReader &in,    /* I/O: reply */
+int *stripCount,    /* O: number of strips */
+int **strips        /* O: strip list, NULL if empty */
+)
+/*
+DESCRIPTION:
+   Read a strip list of StripsPut().
+*/
+{
+    *stripCount = in.Int();
+    const int length = in.Count(1);
+    *strips = (int *)ListAlloc(length, sizeof(int));
+    int previous = 0;
+    for (int i = 0, s = 0; i < length; s++)
+    {
+        const int count = in.Int();
+        if (count < 0 || count >= length - i)
+        {
+            *stripCount = s;
+            return;
+        }
+        (*strips)[i++] = count;
+        for (int k = 0; k < count; k++, i++)
+        {
+            previous += in.Int();
+            (*strips)[i] = previous;
+        }
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+void PointsPut
+(
+TraceBuffer &out,       /* I/O: reply */
+int count,              /* I: number of points */
+int dimension,          /* I: floats of a point */
+const float *points     /* I: points, NULL if the facets have none */
+)
+/*
+DESCRIPTION:
+   Append a flag and the floats of an optional point list of facets.
+*/
+{
+    out.Int(points != nullptr && count > 0);
+    if (points != nullptr && count > 0)
+        out.Bytes(points, count * dimension * (int)sizeof(float));
+}
+
+/*******************************************************************/
+/* Function definition */
+void PointsGet
+(
+TraceReader &in,    /* I/O: reply */
+int count,          /* I: number of points */
+int dimension,      /* I: floats of a point */
+float **points      /* O: points, NULL if not recorded */
+)
+/*
+DESCRIPTION:
+   Read a point list of PointsPut().
+*/
+{
+    *points = nullptr;
+    if (!in.Int())
+        return;
+    *points = (float *)ListAlloc(count, dimension * (int)sizeof(float));
+    if (*points != nullptr)
+        in.Bytes(*points, count * dimension * (int)sizeof(float));
+}
+
+/*******************************************************************/
+/* Function definition */
+void TraceIntListPut
+(
+TraceBuffer &out,    /* I/O: reply */
+int count,           /* I: number of integers */
+const int *list      /* I: integers, such as entity ids */
+)
+/*
+DESCRIPTION:
+   Append a list of integers as differences to the previous one; the ids
+of a list are mostly close to each other.
+*/
+{
+    if (list == nullptr)
+        count = 0;
+    out.Int(count);
+    for (int i = 0, previous = 0; i < count; previous = list[i++])
+        out.Int(list[i] - previous);
+}
+
+/*******************************************************************/
+/* Function definition */
+void TraceIntListGet
+(
+TraceReader &in,    /* I/O: reply */
+int *count,         /* O: number of integers */
+int **list          /* O: integers, NULL if empty, free with cvxMemFree() */
+)
+/*
+DESCRIPTION:
+   Read a list of TraceIntListPut().
+*/
+{
+    *count = in.Count(1);
+    *list = (int *)ListAlloc(*count, sizeof(int));
+    for (int i = 0, previous = 0; i < *count; i++)
+        previous = (*list)[i] = previous + in.Int();
+}
+
+/*******************************************************************/
+/* Function definition */
+void TraceMatrixPut
+(
+TraceBuffer &out,           /* I/O: key or reply */
+const svxMatrix &matrix     /* I: matrix */
+)
+/*
+DESCRIPTION:
+   Append a matrix, only its flag if it is the identity.
+*/
+{
+    out.Int(matrix.identity ? 1 : 0);
+    if (matrix.identity)
+        return;
+    const double values[12] = { matrix.xx, matrix.yx, matrix.zx, matrix.xt,
+                                matrix.xy, matrix.yy, matrix.zy, matrix.yt,
+                                matrix.xz, matrix.yz, matrix.zz, matrix.zt };
+    for (int i = 0; i < 12; i++)
+        out.Double(values[i]);
+}
+
+/*******************************************************************/
+/* Function definition */
+void TraceMatrixGet
+(
+TraceReader &in,      /* I/O: key or reply */
+svxMatrix *matrix     /* O: matrix */
+)
+/*
+DESCRIPTION:
+   Read a matrix of TraceMatrixPut(); the identity is filled in as
+cvxMatInit() does.
+*/
+{
+    memset(matrix, 0, sizeof(*matrix));
+    if (in.Int())
+    {
+        matrix->identity = 1;
+        matrix->xx = matrix->yy = matrix->zz = 1.0;
+        return;
+    }
+    double *values[12] = { &matrix->xx, &matrix->yx, &matrix->zx, &matrix->xt,
+                           &matrix->xy, &matrix->yy, &matrix->zy, &matrix->yt,
+                           &matrix->xz, &matrix->yz, &matrix->zz, &matrix->zt };
+    for (int i = 0; i < 12; i++)
+        *values[i] = in.Double();
+}
+
+/*******************************************************************/
+/* Function definition */
+void TraceZwMatrixPut
+(
+TraceBuffer &out,           /* I/O: key */
+const szwMatrix &matrix     /* I: matrix */
+)
+/*
+DESCRIPTION:
+   Append a matrix of the Zw functions, only its flag if it is the
+identity.
+*/
+{
+    out.Int(matrix.identity ? 1 : 0);
+    if (matrix.identity)
+        return;
+    const double values[16] = { matrix.xx, matrix.yx, matrix.zx, matrix.xt,
+                                matrix.xy, matrix.yy, matrix.zy, matrix.yt,
+                                matrix.xz, matrix.yz, matrix.zz, matrix.zt,
+                                matrix.ox, matrix.oy, matrix.oz, matrix.scale };
+    for (int i = 0; i < 16; i++)
+        out.Double(values[i]);
+}
+
+/*******************************************************************/
+/* Function definition */
+void TraceRefinePut
+(
+TraceBuffer &out,                             /* I/O: key */
+const szwRefineFacetsOfMultiFace &refine,     /* I: faces and tolerances */
+const int *faceIds                            /* I: ids of the faces of "refine" */
+)
+/*
+DESCRIPTION:
+   Append the inputs of a facets call: face ids, tolerance type and the
+tolerances. ZwFaceFacetsGet() is keyed as a list of one face.
+*/
+{
+    TraceIntListPut(out, refine.countFace, faceIds);
+    out.Int(refine.type);
+    out.Double(refine.edgeTolorance);
+    out.Double(refine.facetTolorance);
+    out.Double(refine.angleTolorance);
+    out.Double(refine.surfaceTolorance);
+}
+
+/*******************************************************************/
+/* Function definition */
+void TraceBoxPut
+(
+TraceBuffer &out,        /* I/O: reply */
+const svxBndBox &box     /* I: box */
+)
+/*
+DESCRIPTION:
+   Append the limits of a box.
+*/
+{
+    out.Double(box.X.min);
+    out.Double(box.X.max);
+    out.Double(box.Y.min);
+    out.Double(box.Y.max);
+    out.Double(box.Z.min);
+    out.Double(box.Z.max);
+}
+
+/*******************************************************************/
+/* Function definition */
+void TraceBoxGet
+(
+TraceReader &in,   /* I/O: reply */
+svxBndBox *box     /* O: box */
+)
+/*
+DESCRIPTION:
+   Read a box of TraceBoxPut().
+*/
+{
+    box->X.min = in.Double();
+    box->X.max = in.Double();
+    box->Y.min = in.Double();
+    box->Y.max = in.Double();
+    box->Z.min = in.Double();
+    box->Z.max = in.Double();
+}
+
+/*******************************************************************/
+/* Function definition */
+void TraceCurvePut
+(
+TraceBuffer &out,        /* I/O: reply */
+const svxCurve &curve    /* I: curve */
+)
+/*
+DESCRIPTION:
+   Append a curve: type, frame, the analytic data and the NURBS data with
+its knots and control points.
+*/
+{
+    out.Int(curve.Type);
+    TraceMatrixPut(out, curve.Frame);
+    out.Double(curve.P1.x);
+    out.Double(curve.P1.y);
+    out.Double(curve.P1.z);
+    out.Double(curve.P2.x);
+    out.Double(curve.P2.y);
+    out.Double(curve.P2.z);
+    out.Double(curve.A1);
+    out.Double(curve.A2);
+    out.Double(curve.R);
+
+    const int knots = curve.T.knots != nullptr ? curve.T.num_knots : 0;
+    out.Int(curve.T.closed);
+    out.Int(curve.T.degree);
+    out.Int(knots);
+    out.Double(curve.T.bnd.min);
+    out.Double(curve.T.bnd.max);
+    for (int i = 0; i < knots; i++)
+        out.Double(curve.T.knots[i]);
+
+    const int coordinates = curve.P.coord != nullptr ? curve.P.num_cp * curve.P.dim : 0;
+    out.Int(curve.P.rat);
+    out.Int(curve.P.dim);
+    out.Int(curve.P.plane);
+    out.Int(coordinates > 0 ? curve.P.num_cp : 0);
+    TraceBoxPut(out, curve.P.box);
+    for (int i = 0; i < coordinates; i++)
+        out.Double(curve.P.coord[i]);
+}
+
+/*******************************************************************/
+/* Function definition */
+void TraceCurveGet
+(
+TraceReader &in,    /* I/O: reply */
+svxCurve *curve     /* O: curve, free with cvxCurveFree() */
+)
+/*
+DESCRIPTION:
+   Read a curve of TraceCurvePut(). The knots and control points are
+allocated and marked to be freed by cvxCurveFree().
+*/
+{
+    memset(curve, 0, sizeof(*curve));
+    curve->Type = (evxCurveType)in.Int();
+    TraceMatrixGet(in, &curve->Frame);
+    curve->P1.x = in.Double();
+    curve->P1.y = in.Double();
+    curve->P1.z = in.Double();
+    curve->P2.x = in.Double();
+    curve->P2.y = in.Double();
+    curve->P2.z = in.Double();
+    curve->A1 = in.Double();
+    curve->A2 = in.Double();
+    curve->R = in.Double();
+
+    curve->T.closed = in.Int();
+    curve->T.degree = in.Int();
+    curve->T.num_knots = in.Count(sizeof(double));
+    curve->T.bnd.min = in.Double();
+    curve->T.bnd.max = in.Double();
+    curve->T.knots = (double *)ListAlloc(curve->T.num_knots, sizeof(double));
+    for (int i = 0; i < curve->T.num_knots; i++)
+        curve->T.knots[i] = in.Double();
+    curve->T.free_mem = 1;
+
+    curve->P.rat = in.Int();
+    curve->P.dim = in.Int();
+    curve->P.plane = in.Int();
+    curve->P.num_cp = in.Count(curve->P.dim > 0 ? curve->P.dim * (int)sizeof(double) : 1);
+    TraceBoxGet(in, &curve->P.box);
+    const int coordinates = curve->P.dim > 0 ? curve->P.num_cp * curve->P.dim : 0;
+    curve->P.coord = (double *)ListAlloc(coordinates, sizeof(double));
+    for (int i = 0; i < coordinates; i++)
+        curve->P.coord[i] = in.Double();
+    curve->P.free_mem = 1;
+}
+
+/*******************************************************************/
+/* Function definition */
+void TraceFacetsPut
+(
+TraceBuffer &out,          /* I/O: reply */
+const svxFacets &facets    /* I: facets of cvxPartInqFaceFacets2() */
+)
+/*
+DESCRIPTION:
+   Append facets: strips, vertices, the optional lists and the display
+attributes. The texture and shader attributes are not recorded.
+*/
+{
+    StripsPut(out, facets.numTriStrip, facets.TriStrip);
+    const int vertices = facets.Vertex != nullptr ? facets.numVertex : 0;
+    out.Int(vertices);
+    if (vertices > 0)
+        out.Bytes(facets.Vertex, vertices * (int)sizeof(svxPointf));
+    PointsPut(out, vertices, 3, (const float *)facets.Normal);
+    PointsPut(out, vertices, 2, (const float *)facets.ST);
+    PointsPut(out, vertices, 2, (const float *)facets.UV);
+    PointsPut(out, vertices, 3, (const float *)facets.RGB);
+    out.Bytes(&facets.At, sizeof(facets.At));
+}
+
+/*******************************************************************/
+/* Function definition */
+void TraceFacetsGet
+(
+TraceReader &in,      /* I/O: reply */
+svxFacets *facets     /* O: facets, free with cvxFacetsFree() */
+)
+/*
+DESCRIPTION:
+   Read facets of TraceFacetsPut().
+*/
+{
+    memset(facets, 0, sizeof(*facets));
+    StripsGet(in, &facets->numTriStrip, &facets->TriStrip);
+    facets->numVertex = in.Count(sizeof(svxPointf));
+    facets->Vertex = (svxPointf *)ListAlloc(facets->numVertex, sizeof(svxPointf));
+    if (facets->Vertex != nullptr)
+        in.Bytes(facets->Vertex, facets->numVertex * (int)sizeof(svxPointf));
+    PointsGet(in, facets->numVertex, 3, (float **)&facets->Normal);
+    PointsGet(in, facets->numVertex, 2, (float **)&facets->ST);
+    PointsGet(in, facets->numVertex, 2, (float **)&facets->UV);
+    PointsGet(in, facets->numVertex, 3, (float **)&facets->RGB);
+    in.Bytes(&facets->At, sizeof(facets->At));
+}
+
+/*******************************************************************/
+/* Function definition */
+void TraceZwFacetsPut
+(
+TraceBuffer &out,          /* I/O: reply */
+const szwFacets &facets    /* I: facets of ZwFaceFacetsGet() */
+)
+/*
+DESCRIPTION:
+   Append facets: strips, vertices and the optional lists.
+*/
+{
+    StripsPut(out, facets.numberTriangleStrip, facets.triangleStrip);
+    const int vertices = facets.vertex != nullptr ? facets.numberVertex : 0;
+    out.Int(vertices);
+    if (vertices > 0)
+        out.Bytes(facets.vertex, vertices * (int)sizeof(szwPointf));
+    PointsPut(out, vertices, 3, (const float *)facets.normal);
+    PointsPut(out, vertices, 2, (const float *)facets.st);
+    PointsPut(out, vertices, 2, (const float *)facets.uv);
+    PointsPut(out, vertices, 3, (const float *)facets.rgb);
+}
+
+/*******************************************************************/
+/* Function definition */
+void TraceZwFacetsGet
+(
+TraceReader &in,      /* I/O: reply */
+szwFacets *facets     /* O: facets, free with ZwFaceFacetsDataFree() */
+)
+/*
+DESCRIPTION:
+   Read facets of TraceZwFacetsPut().
+*/
+{
+    memset(facets, 0, sizeof(*facets));
+    StripsGet(in, &facets->numberTriangleStrip, &facets->triangleStrip);
+    facets->numberVertex = in.Count(sizeof(szwPointf));
+    facets->vertex = (szwPointf *)ListAlloc(facets->numberVertex, sizeof(szwPointf));
+    if (facets->vertex != nullptr)
+        in.Bytes(facets->vertex, facets->numberVertex * (int)sizeof(szwPointf));
+    PointsGet(in, facets->numberVertex, 3, (float **)&facets->normal);
+    PointsGet(in, facets->numberVertex, 2, (float **)&facets->st);
+    PointsGet(in, facets->numberVertex, 2, (float **)&facets->uv);
+    PointsGet(in, facets->numberVertex, 3, (float **)&facets->rgb);
+}
@@ -0,0 +1,235 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+#pragma once
+
+/* Application includes */
+#include <atomic>
+#include <type_traits>
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+
+/*******************************************************************/
+/* Constant definitions */
+#define CALL_PROFILE_BUCKETS 32                      /* buckets of the size histogram */
+#define CALL_PROFILE_ENV "ZW_CALL_PROFILE"           /* output path without extension, profiling on if set */
+#define CALL_PROFILE_EVENTS_ENV "ZW_CALL_PROFILE_EVENTS"   /* ring size per thread */
+#define CALL_PROFILE_EVENTS 65536                    /* default ring size per thread */
+#define CALL_PROFILE_LISTS 4                         /* lists returned by a call, at most */
+
+/*******************************************************************/
+/* Data type definitions */
+/*
+DESCRIPTION:
+   Counters of an API function. "sizes[k]" counts the calls whose largest
+integer argument (a count, a size in bytes, an id) is 0 for k = 0, else
+in [2^(k-1), 2^k). "allocBytes" adds the sizes asked to cvxMemAlloc(),
+cvxMemResize(), ZwMemoryAlloc() and ZwMemoryResize(), and the bytes of
+the lists returned by the calls, the count times the element size.
+*/
+struct CallProfileCall
+{
+    const char *name;
+    long long count;
+    double total;                              /* second */
+    double max;                                /* second */
+    long long allocBytes;
+    long long sizes[CALL_PROFILE_BUCKETS];
+};
+
+/*
+DESCRIPTION:
+   Lists a call returns: a "T **list" argument, T neither const, void nor
+char (a string), next to an "int *count" argument, before it or else
+after it, as cvxPartInqCurves(int *Count, int **Curves). The count and
+the list are read after the call.
+*/
+struct CallProfileLists
+{
+    struct List
+    {
+        const int *count;
+        const void *list;                   /* T ** */
+        long long element;                  /* sizeof(T) */
+        int (*filled)(const void *list);    /* 1 if *list is not null */
+    };
+    int count;
+    int unpaired;                           /* 1 if the last list waits for the count after it */
+    List list[CALL_PROFILE_LISTS];
+};
+
+/*******************************************************************/
+/* Function declarations */
+/*
+DESCRIPTION:
+   Profiling of the ZW3D API calls of an add-on. Compiling every source of
+the add-on with CallProfile.h included first (/FI"CallProfile.h", or
+-include CallProfile.h) redirects each ZW_API_C function to a slot of
+CallProfileApi.h, a pointer chosen once, on the first call of the
+function: the function itself when the environment variable
+ZW_CALL_PROFILE is not set, so a disabled add-on pays one indirect call
+as for any imported function, else a wrapper that times the call with
+the time stamp counter.
+
+   Each thread keeps its counters and the last ZW_CALL_PROFILE_EVENTS
+calls in a ring. CallProfileFlush() writes "path.json" (Chrome trace
+events, chrome://tracing or ui.perfetto.dev), "path.folded" (folded
+stacks of self time in microseconds, for flamegraph.pl) and "path.csv"
+(counters); it is called at unload with the path of ZW_CALL_PROFILE.
+Flush and reset while no profiled call is running.
+*/
+int CallProfileEnabled(void);
+int CallProfileFlush(const char *path);
+int CallProfileSummary(int max, CallProfileCall *calls);
+void CallProfileReset(void);
+
+/* used by the slots */
+void CallProfileRecord(int id, long long size, long long bytes, unsigned long long start, unsigned long long end);
+
+/*******************************************************************/
+/* Inline functions */
+/* DESCRIPTION: time stamp counter, or nanoseconds of the steady clock */
+inline unsigned long long CallProfileTicks(void)
+{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86)) || \
+    defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    return __rdtsc();
+#else
+    return (unsigned long long)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+/* DESCRIPTION: largest integer argument of a call, 0 if none */
+inline long long CallProfileSize(void)
+{
+    return 0;
+}
+
+template <class T, class... A>
+inline long long CallProfileSize(T first, A... rest)
+{
+    long long size = CallProfileSize(rest...);
+    if constexpr (std::is_integral<T>::value)
+    {
+        if ((long long)first > size)
+            size = (long long)first;
+    }
+    return size;
+}
+
+/* DESCRIPTION: 1 if a "T **" list argument returned a list */
+template <class T>
+inline int CallProfileFilled(const void *list)
+{
+    return list != nullptr && *(T *const *)list != nullptr;
+}
+
+/* DESCRIPTION: find the lists of the arguments of a call, "previous" the count of the argument before */
+inline void CallProfileListsFind(CallProfileLists *, const int *)
+{
+}
+
+template <class T, class... A>
+inline void CallProfileListsFind(CallProfileLists *lists, const int *previous, T first, A... rest)
+{
+    const int *count = nullptr;
+    if constexpr (std::is_same<T, int *>::value)
+    {
+        count = first;
+        if (lists->unpaired)
+            lists->list[lists->count - 1].count = first;
+    }
+    lists->unpaired = 0;
+    if constexpr (std::is_pointer<T>::value && std::is_pointer<typename std::remove_pointer<T>::type>::value)
+    {
+        typedef typename std::remove_pointer<typename std::remove_pointer<T>::type>::type Element;
+        if constexpr (!std::is_const<Element>::value && !std::is_void<Element>::value &&
+                      !std::is_same<Element, char>::value)
+        {
+            if (lists->count < CALL_PROFILE_LISTS)
+            {
+                lists->list[lists->count++] = { previous, first, (long long)sizeof(Element), CallProfileFilled<Element> };
+                lists->unpaired = previous == nullptr;
+            }
+        }
+    }
+    CallProfileListsFind(lists, count, rest...);
+}
+
+/* DESCRIPTION: bytes of the lists returned by a call */
+inline long long CallProfileListBytes(const CallProfileLists &lists)
+{
+    long long bytes = 0;
+    for (int k = 0; k < lists.count; k++)
+    {
+        const CallProfileLists::List &list = lists.list[k];
+        if (list.count != nullptr && *list.count > 0 && list.filled(list.list))
+            bytes += *list.count * list.element;
+    }
+    return bytes;
+}
+
+/*
+DESCRIPTION:
+   Profiling slot of API function "Fn" of id "Id". Pointer() starts as
+Resolve(), which sets it to the function or to Call() on the first call.
+*/
+template <int Id, auto Fn, class F = decltype(Fn)>
+struct CallProfileSlot;
+
+template <int Id, auto Fn, class R, class... A>
+struct CallProfileSlot<Id, Fn, R (*)(A...)>
+{
+    typedef R (*Function)(A...);
+
+    static Function Pointer(void)
+    {
+        return s_pointer.load(std::memory_order_relaxed);
+    }
+
+    static R Call(A... args)
+    {
+        const long long size = CallProfileSize(args...);
+        CallProfileLists lists;
+        lists.count = 0;
+        lists.unpaired = 0;
+        CallProfileListsFind(&lists, nullptr, args...);
+        const unsigned long long start = CallProfileTicks();
+        struct Scope
+        {
+            long long size;
+            const CallProfileLists &lists;
+            unsigned long long start;
+            ~Scope()
+            {
+                const unsigned long long end = CallProfileTicks();
+                CallProfileRecord(Id, size, CallProfileListBytes(lists), start, end);
+            }
+        } scope = { size, lists, start };
+        return Fn(args...);
+    }
+
+    static R Resolve(A... args)
+    {
+        const Function function = CallProfileEnabled() ? Call : Fn;
+        s_pointer.store(function, std::memory_order_relaxed);
+        return function(args...);
+    }
+
+    static std::atomic<Function> s_pointer;
+};
+
+template <int Id, auto Fn, class R, class... A>
+std::atomic<R (*)(A...)> CallProfileSlot<Id, Fn, R (*)(A...)>::s_pointer(Resolve);
+
+#define CALL_PROFILE_CALL(id, name) (*CallProfileSlot<id, &::name>::Pointer())
+
+/* ZW3D API functions, redirected to their slots */
+#include "CallProfileApi.h"
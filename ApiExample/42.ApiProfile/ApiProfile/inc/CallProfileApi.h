@@ -0,0 +1,5978 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/* Generated by ProfileGen from the ZW_API_C declarations of headers\, do not edit. */
+
+/*******************************************************************/
+/* ZW3D API includes */
+#ifndef CALL_PROFILE_API_INCLUDES
+#define CALL_PROFILE_API_INCLUDES
+#include "zwapi_brep_shape.h"   /* first, its include guard is the one of another header */
+#include "zwapi_3dbom.h"
+#include "zwapi_3dbom_data.h"
+#include "zwapi_asm_comp.h"
+#include "zwapi_asm_comp_attribute.h"
+#include "zwapi_asm_constraint.h"
+#include "zwapi_asm_data.h"
+#include "zwapi_asm_opts.h"
+#include "zwapi_asm_reuselibrary.h"
+#include "zwapi_assembly_constraint.h"
+#include "zwapi_assembly_constraint_data.h"
+#include "zwapi_attribute.h"
+#include "zwapi_attribute_data.h"
+#include "zwapi_boundingbox.h"
+#include "zwapi_brep_data.h"
+#include "zwapi_brep_edge.h"
+#include "zwapi_brep_face.h"
+#include "zwapi_brep_loop.h"
+#include "zwapi_brep_preedge.h"
+#include "zwapi_brep_vertex.h"
+#include "zwapi_cm_comp.h"
+#include "zwapi_cm_folder.h"
+#include "zwapi_cm_forms.h"
+#include "zwapi_cm_frame.h"
+#include "zwapi_cm_ftr.h"
+#include "zwapi_cm_machine.h"
+#include "zwapi_cm_op.h"
+#include "zwapi_cm_op_param.h"
+#include "zwapi_cm_op_param_data.h"
+#include "zwapi_cm_query.h"
+#include "zwapi_cm_tool.h"
+#include "zwapi_cmd.h"
+#include "zwapi_cmd_assembly.h"
+#include "zwapi_cmd_assembly_data.h"
+#include "zwapi_cmd_data.h"
+#include "zwapi_cmd_dataexchange.h"
+#include "zwapi_cmd_dataexchange_data.h"
+#include "zwapi_cmd_datum.h"
+#include "zwapi_cmd_datum_data.h"
+#include "zwapi_cmd_direct_edit.h"
+#include "zwapi_cmd_direct_edit_data.h"
+#include "zwapi_cmd_dwg_data.h"
+#include "zwapi_cmd_dwg_dimension.h"
+#include "zwapi_cmd_dwg_drawing.h"
+#include "zwapi_cmd_dwg_layout.h"
+#include "zwapi_cmd_ecadboard.h"
+#include "zwapi_cmd_ecadboard_data.h"
+#include "zwapi_cmd_freeform.h"
+#include "zwapi_cmd_freeform_data.h"
+#include "zwapi_cmd_paramdefine_param.h"
+#include "zwapi_cmd_paramdefine_tpl.h"
+#include "zwapi_cmd_pmi.h"
+#include "zwapi_cmd_pmi_data.h"
+#include "zwapi_cmd_shape.h"
+#include "zwapi_cmd_shape_data.h"
+#include "zwapi_cmd_sheetmetal.h"
+#include "zwapi_cmd_sheetmetal_data.h"
+#include "zwapi_cmd_sk_app.h"
+#include "zwapi_cmd_sk_app_data.h"
+#include "zwapi_cmd_sk_cmds.h"
+#include "zwapi_cmd_sk_cmds_data.h"
+#include "zwapi_cmd_sk_create.h"
+#include "zwapi_cmd_sk_create_data.h"
+#include "zwapi_cmd_subcmd.h"
+#include "zwapi_cmd_subcmd_data.h"
+#include "zwapi_cmd_udf.h"
+#include "zwapi_cmd_udf_data.h"
+#include "zwapi_cmd_wireframe.h"
+#include "zwapi_cmd_wireframe_data.h"
+#include "zwapi_command.h"
+#include "zwapi_command_data.h"
+#include "zwapi_component.h"
+#include "zwapi_component_data.h"
+#include "zwapi_config.h"
+#include "zwapi_configtable.h"
+#include "zwapi_constraint.h"
+#include "zwapi_curve.h"
+#include "zwapi_curve_data.h"
+#include "zwapi_dataexchange.h"
+#include "zwapi_dataexchange_data.h"
+#include "zwapi_datum.h"
+#include "zwapi_datum_data.h"
+#include "zwapi_dim.h"
+#include "zwapi_dimension.h"
+#include "zwapi_dimension_data.h"
+#include "zwapi_display.h"
+#include "zwapi_dll_define.h"
+#include "zwapi_drawing_data.h"
+#include "zwapi_drawing_dimension.h"
+#include "zwapi_drawing_dimension_data.h"
+#include "zwapi_drawing_general.h"
+#include "zwapi_drawing_general_data.h"
+#include "zwapi_drawing_sheet.h"
+#include "zwapi_drawing_symbol.h"
+#include "zwapi_drawing_symbol_data.h"
+#include "zwapi_drawing_table.h"
+#include "zwapi_drawing_table_data.h"
+#include "zwapi_drawing_view.h"
+#include "zwapi_drawing_view_data.h"
+#include "zwapi_drawing_wireframe.h"
+#include "zwapi_drawing_wireframe_data.h"
+#include "zwapi_dwg_attribute.h"
+#include "zwapi_dwg_data.h"
+#include "zwapi_dwg_dim.h"
+#include "zwapi_dwg_drawing.h"
+#include "zwapi_dwg_geometry.h"
+#include "zwapi_dwg_symbol.h"
+#include "zwapi_dwg_table.h"
+#include "zwapi_dwg_view.h"
+#include "zwapi_edge.h"
+#include "zwapi_edge_data.h"
+#include "zwapi_entity.h"
+#include "zwapi_entity_data.h"
+#include "zwapi_entity_general.h"
+#include "zwapi_face.h"
+#include "zwapi_feature_data_exchange.h"
+#include "zwapi_feature_data_exchange_data.h"
+#include "zwapi_feature_freeform.h"
+#include "zwapi_feature_general.h"
+#include "zwapi_feature_general_data.h"
+#include "zwapi_feature_pmi.h"
+#include "zwapi_feature_shape.h"
+#include "zwapi_feature_shape_data.h"
+#include "zwapi_feature_wireframe.h"
+#include "zwapi_feature_wireframe_data.h"
+#include "zwapi_file.h"
+#include "zwapi_file_data.h"
+#include "zwapi_file_general.h"
+#include "zwapi_file_path.h"
+#include "zwapi_general_ent.h"
+#include "zwapi_geometry_boundingbox.h"
+#include "zwapi_geometry_point.h"
+#include "zwapi_geometry_surface.h"
+#include "zwapi_geometry_surface_data.h"
+#include "zwapi_global_apply.h"
+#include "zwapi_global_apply_data.h"
+#include "zwapi_harness.h"
+#include "zwapi_history.h"
+#include "zwapi_history_data.h"
+#include "zwapi_intersection.h"
+#include "zwapi_layer.h"
+#include "zwapi_layer_data.h"
+#include "zwapi_license.h"
+#include "zwapi_linkmanager.h"
+#include "zwapi_linkmanager_data.h"
+#include "zwapi_loop.h"
+#include "zwapi_material.h"
+#include "zwapi_materiallibrary.h"
+#include "zwapi_materiallibrary_data.h"
+#include "zwapi_math.h"
+#include "zwapi_math_bndbox.h"
+#include "zwapi_math_data.h"
+#include "zwapi_math_insect.h"
+#include "zwapi_math_matrix.h"
+#include "zwapi_math_nurbscurve.h"
+#include "zwapi_math_nurbssurface.h"
+#include "zwapi_math_point.h"
+#include "zwapi_math_vector.h"
+#include "zwapi_math_vector_data.h"
+#include "zwapi_matrix.h"
+#include "zwapi_matrix_data.h"
+#include "zwapi_memory.h"
+#include "zwapi_message.h"
+#include "zwapi_motion.h"
+#include "zwapi_motion_data.h"
+#include "zwapi_part_attribute.h"
+#include "zwapi_part_config.h"
+#include "zwapi_part_data.h"
+#include "zwapi_part_datum_query.h"
+#include "zwapi_part_dim.h"
+#include "zwapi_part_facets.h"
+#include "zwapi_part_history.h"
+#include "zwapi_part_hole.h"
+#include "zwapi_part_objs.h"
+#include "zwapi_part_opts.h"
+#include "zwapi_part_sheetmetal_attribute.h"
+#include "zwapi_part_var.h"
+#include "zwapi_part_view.h"
+#include "zwapi_pickset.h"
+#include "zwapi_pmi.h"
+#include "zwapi_pmi_data.h"
+#include "zwapi_point.h"
+#include "zwapi_point_data.h"
+#include "zwapi_preedge.h"
+#include "zwapi_root.h"
+#include "zwapi_shape.h"
+#include "zwapi_sheet_metal.h"
+#include "zwapi_sheet_metal_data.h"
+#include "zwapi_sk3d_objs.h"
+#include "zwapi_sk_attribute.h"
+#include "zwapi_sk_cons.h"
+#include "zwapi_sk_data.h"
+#include "zwapi_sk_dim.h"
+#include "zwapi_sk_dim_data.h"
+#include "zwapi_sk_objs.h"
+#include "zwapi_sk_opts.h"
+#include "zwapi_sk_var.h"
+#include "zwapi_sketch.h"
+#include "zwapi_sketch_constraint.h"
+#include "zwapi_sketch_data.h"
+#include "zwapi_sketch_dimension.h"
+#include "zwapi_sketch_dimension_data.h"
+#include "zwapi_sketch_general.h"
+#include "zwapi_sketch_general_data.h"
+#include "zwapi_sketch_wireframe.h"
+#include "zwapi_sketch_wireframe_data.h"
+#include "zwapi_symbol_data.h"
+#include "zwapi_table.h"
+#include "zwapi_table_data.h"
+#include "zwapi_template_command.h"
+#include "zwapi_text.h"
+#include "zwapi_tool_entpath.h"
+#include "zwapi_ui_combobox.h"
+#include "zwapi_ui_command.h"
+#include "zwapi_ui_data.h"
+#include "zwapi_ui_drawbackboxgroup.h"
+#include "zwapi_ui_filedialog.h"
+#include "zwapi_ui_form.h"
+#include "zwapi_ui_guiset.h"
+#include "zwapi_ui_listwidget.h"
+#include "zwapi_ui_listwidget_data.h"
+#include "zwapi_ui_popupform.h"
+#include "zwapi_ui_ribbon.h"
+#include "zwapi_ui_slider.h"
+#include "zwapi_ui_tablewidget.h"
+#include "zwapi_ui_tabwidget.h"
+#include "zwapi_ui_treeview.h"
+#include "zwapi_userinput.h"
+#include "zwapi_util.h"
+#include "zwapi_var.h"
+#include "zwapi_variable.h"
+#include "zwapi_variable_data.h"
+#include "zwapi_vector.h"
+#include "zwapi_view.h"
+#include "zwapi_view_data.h"
+#include "zwapi_xn.h"
+#endif
+
+/*******************************************************************/
+/* Constant definitions */
+#define CALL_PROFILE_COUNT 2857   /* API functions */
+
+/*******************************************************************/
+/* Function names, for CALL_PROFILE_NAME(id, name) */
+#if defined CALL_PROFILE_NAME
+CALL_PROFILE_NAME(0, cvxShellAtGet)
+CALL_PROFILE_NAME(1, cvxShellAtItemGet)
+CALL_PROFILE_NAME(2, cvxShellAtItemSet)
+CALL_PROFILE_NAME(3, cvxPartInqShapeOpen)
+CALL_PROFILE_NAME(4, cvxPartInqShapeBox)
+CALL_PROFILE_NAME(5, cvxPartInqShapeMass)
+CALL_PROFILE_NAME(6, cvxPartShapeStructGet)
+CALL_PROFILE_NAME(7, cvxPartInqShapes)
+CALL_PROFILE_NAME(8, cvxPartInqShapeComp)
+CALL_PROFILE_NAME(9, cvxPartInqShapeEdges)
+CALL_PROFILE_NAME(10, cvxPartInqShapeFaces)
+CALL_PROFILE_NAME(11, cvxPartInqShapeFtrs)
+CALL_PROFILE_NAME(12, cvxPartInqShapeExtreme)
+CALL_PROFILE_NAME(13, cvxInstShpGetMatrix)
+CALL_PROFILE_NAME(14, cvxPartInqEntShape)
+CALL_PROFILE_NAME(15, Zw3DBomDataGet)
+CALL_PROFILE_NAME(16, Zw3DBomDataFree)
+CALL_PROFILE_NAME(17, Zw3DBomDataExport)
+CALL_PROFILE_NAME(18, Zw3DBomSettingGet)
+CALL_PROFILE_NAME(19, Zw3DBomSettingSet)
+CALL_PROFILE_NAME(20, Zw3DBomSettingDataFree)
+CALL_PROFILE_NAME(21, Zw3DBomFormatDataGet)
+CALL_PROFILE_NAME(22, Zw3DBomFormatDataSet)
+CALL_PROFILE_NAME(23, Zw3DBomExcludedStateSet)
+CALL_PROFILE_NAME(24, Zw3DBomTemplateSet)
+CALL_PROFILE_NAME(25, cvxPartInqAsmFolders)
+CALL_PROFILE_NAME(26, cvxPartInqAsmFldChildEnts)
+CALL_PROFILE_NAME(27, cvxPartInqAsmFtrList)
+CALL_PROFILE_NAME(28, cvxPartInqComps)
+CALL_PROFILE_NAME(29, cvxPartInqComps2)
+CALL_PROFILE_NAME(30, cvxPartInqCompsInfo)
+CALL_PROFILE_NAME(31, cvxPartInqCompsInfoByLongPath)
+CALL_PROFILE_NAME(32, cvxCompInqPaths)
+CALL_PROFILE_NAME(33, cvxCompInqPart)
+CALL_PROFILE_NAME(34, cvxCompInqPartByPath)
+CALL_PROFILE_NAME(35, cvxCompInqPartByPathByLongPath)
+CALL_PROFILE_NAME(36, cvxCompGetRefPart)
+CALL_PROFILE_NAME(37, cvxCompGetRefPartByLongPath)
+CALL_PROFILE_NAME(38, cvxPartInqAsmIsFlex)
+CALL_PROFILE_NAME(39, cvxPartInqAsmIsFlexByPath)
+CALL_PROFILE_NAME(40, cvxCompSuppressGet)
+CALL_PROFILE_NAME(41, cvxCompSuppressGetByPath)
+CALL_PROFILE_NAME(42, cvxAssemCompVisAll)
+CALL_PROFILE_NAME(43, cvxCompVisGet)
+CALL_PROFILE_NAME(44, cvxCompHighlight)
+CALL_PROFILE_NAME(45, cvxCompUnHighlight)
+CALL_PROFILE_NAME(46, cvxCompMakeVirtual)
+CALL_PROFILE_NAME(47, cvxCompIsVirtual)
+CALL_PROFILE_NAME(48, cvxCompIsEnvelope)
+CALL_PROFILE_NAME(49, cvxCompInqRenderMode)
+CALL_PROFILE_NAME(50, cvxCompIsUnplaced)
+CALL_PROFILE_NAME(51, cvxCompIsUnplacedByPath)
+CALL_PROFILE_NAME(52, cvxCompIsFileLost)
+CALL_PROFILE_NAME(53, cvxCompExpandStateGet)
+CALL_PROFILE_NAME(54, cvxCompExpandStateSet)
+CALL_PROFILE_NAME(55, cvxCompSelectedStateGet)
+CALL_PROFILE_NAME(56, cvxCompSelectedStateSet)
+CALL_PROFILE_NAME(57, cvxCompBomExcludedGet)
+CALL_PROFILE_NAME(58, cvxCompBomSettingGet)
+CALL_PROFILE_NAME(59, cvxCompBomSettingSet)
+CALL_PROFILE_NAME(60, cvxCompBomDispDataGet)
+CALL_PROFILE_NAME(61, cvxBomDataFree)
+CALL_PROFILE_NAME(62, cvxCompBomPathByPart)
+CALL_PROFILE_NAME(63, cvxCompRegenSet)
+CALL_PROFILE_NAME(64, cvxPartInqFlexAsmMat)
+CALL_PROFILE_NAME(65, cvxCompInqOpenShapes)
+CALL_PROFILE_NAME(66, cvxCompShapeInqOpenEdges)
+CALL_PROFILE_NAME(67, cvxCompCfgIdGet)
+CALL_PROFILE_NAME(68, cvxCompFolderIns)
+CALL_PROFILE_NAME(69, cvxCompFromAsmFtr)
+CALL_PROFILE_NAME(70, cvxAsmReorder)
+CALL_PROFILE_NAME(71, cvxSubPartFlag)
+CALL_PROFILE_NAME(72, cvxCompNameWithOrderNumberGet)
+CALL_PROFILE_NAME(73, cvxCompUserAtGet)
+CALL_PROFILE_NAME(74, cvxCompUserAtSet)
+CALL_PROFILE_NAME(75, cvxCompUserAtDel)
+CALL_PROFILE_NAME(76, cvxCompFaceAtGet)
+CALL_PROFILE_NAME(77, cvxCompFaceAtSet)
+CALL_PROFILE_NAME(78, cvxConsInqType)
+CALL_PROFILE_NAME(79, cvxConsInqRefEnts)
+CALL_PROFILE_NAME(80, cvxConsInqConsData)
+CALL_PROFILE_NAME(81, cvxCompInqConsState)
+CALL_PROFILE_NAME(82, cvxCompInqConstraints)
+CALL_PROFILE_NAME(83, cvxAsmDissolve)
+CALL_PROFILE_NAME(84, cvxAsmGrpComp)
+CALL_PROFILE_NAME(85, cvxAsmAddToFavorites)
+CALL_PROFILE_NAME(86, cvxAsmRemoveFromFavorites)
+CALL_PROFILE_NAME(87, cvxAsmFavoritesEnable)
+CALL_PROFILE_NAME(88, cvxAsmUpdateCompRef)
+CALL_PROFILE_NAME(89, cvxCompEditPart)
+CALL_PROFILE_NAME(90, cvxCompEditPartByPath)
+CALL_PROFILE_NAME(91, cvxCompRegen)
+CALL_PROFILE_NAME(92, cvxCompSetPart)
+CALL_PROFILE_NAME(93, cvxCompIsLightweightByPath)
+CALL_PROFILE_NAME(94, cvxCompLightweightSetByPath)
+CALL_PROFILE_NAME(95, cvxCompSetRenderMode)
+CALL_PROFILE_NAME(96, cvxCompShift)
+CALL_PROFILE_NAME(97, cvxCompSuppress)
+CALL_PROFILE_NAME(98, cvxCompSuppressByPath)
+CALL_PROFILE_NAME(99, cvxCompVisSet)
+CALL_PROFILE_NAME(100, cvxCompCfgIdSet)
+CALL_PROFILE_NAME(101, cvxConsRedefine)
+CALL_PROFILE_NAME(102, cvxConsEnable)
+CALL_PROFILE_NAME(103, cvxConsDel)
+CALL_PROFILE_NAME(104, cvxSubPartIns)
+CALL_PROFILE_NAME(105, cvxAsmTreeEcadRefDesSet)
+CALL_PROFILE_NAME(106, cvxAsmFlexibleAsmSet)
+CALL_PROFILE_NAME(107, cvxAsmFlexiblePartSet)
+CALL_PROFILE_NAME(108, cvxAsmTreeEcadRefDesGet)
+CALL_PROFILE_NAME(109, cvxAssembleContextGet)
+CALL_PROFILE_NAME(110, cvxAsmAutoRegenStateSetByPath)
+CALL_PROFILE_NAME(111, cvxAsmAutoRegenStateGetByPath)
+CALL_PROFILE_NAME(112, cvxAsmTreeRegen)
+CALL_PROFILE_NAME(113, cvxAsmFlexiblePartGet)
+CALL_PROFILE_NAME(114, cvxAsmFlexiblePartDataFree)
+CALL_PROFILE_NAME(115, cvxLibPartIns)
+CALL_PROFILE_NAME(116, cvxInstPartAsShp)
+CALL_PROFILE_NAME(117, cvxLibPartAdjust)
+CALL_PROFILE_NAME(118, ZwConstraintCoincidentAdd)
+CALL_PROFILE_NAME(119, ZwAssemblyConstraintDimensionGet)
+CALL_PROFILE_NAME(120, ZwAssemblyConstraintDataGet)
+CALL_PROFILE_NAME(121, ZwAssemblyConstraintDataSet)
+CALL_PROFILE_NAME(122, ZwAssemblyConstraintTypeGet)
+CALL_PROFILE_NAME(123, ZwAssemblyConstraintReferenceListGet)
+CALL_PROFILE_NAME(124, ZwAssemblyConstraintNodeNameGet)
+CALL_PROFILE_NAME(125, ZwPhysicalAttributeGet)
+CALL_PROFILE_NAME(126, ZwPhysicalAttributeSet)
+CALL_PROFILE_NAME(127, ZwPhysicalAttributeCalculate)
+CALL_PROFILE_NAME(128, ZwStandardAttributeGet)
+CALL_PROFILE_NAME(129, ZwStandardAttributeSet)
+CALL_PROFILE_NAME(130, ZwStandardAttributeDateSet)
+CALL_PROFILE_NAME(131, ZwUserAttributeImport)
+CALL_PROFILE_NAME(132, ZwUserAttributeExport)
+CALL_PROFILE_NAME(133, ZwUserAttributeGet)
+CALL_PROFILE_NAME(134, ZwUserAttributeSet)
+CALL_PROFILE_NAME(135, ZwUserAttributeDelete)
+CALL_PROFILE_NAME(136, ZwUserAttributeLockSet)
+CALL_PROFILE_NAME(137, ZwComponentUserAttributeGet)
+CALL_PROFILE_NAME(138, ZwComponentUserAttributeSet)
+CALL_PROFILE_NAME(139, ZwComponentUserAttributeDelete)
+CALL_PROFILE_NAME(140, ZwEntityUserAttributeGet)
+CALL_PROFILE_NAME(141, ZwEntityUserAttributeSet)
+CALL_PROFILE_NAME(142, ZwEntityUserAttributeDelete)
+CALL_PROFILE_NAME(143, ZwHistoryUserAttributeGet)
+CALL_PROFILE_NAME(144, ZwHistoryUserAttributeSet)
+CALL_PROFILE_NAME(145, ZwHistoryUserAttributeDelete)
+CALL_PROFILE_NAME(146, ZwUserAttributeDataFree)
+CALL_PROFILE_NAME(147, ZwBoundingBoxTransform)
+CALL_PROFILE_NAME(148, cvxPartInqEdgeOpen)
+CALL_PROFILE_NAME(149, cvxPartInqEdgeType)
+CALL_PROFILE_NAME(150, cvxPartInqEdgeFaces)
+CALL_PROFILE_NAME(151, cvxPartInqEdgePreEdges)
+CALL_PROFILE_NAME(152, cvxPartInqEdgeLoop)
+CALL_PROFILE_NAME(153, cvxPartInqEdgeShape)
+CALL_PROFILE_NAME(154, cvxPartInqEdgeCrv)
+CALL_PROFILE_NAME(155, cvxPartInqEdgeDiscreteData)
+CALL_PROFILE_NAME(156, cvxPartInqFaceAt)
+CALL_PROFILE_NAME(157, cvxPartInqFaceSh)
+CALL_PROFILE_NAME(158, cvxPartInqFaceTx)
+CALL_PROFILE_NAME(159, cvxFaceGetArea)
+CALL_PROFILE_NAME(160, cvxFaceGetMaxCurvature)
+CALL_PROFILE_NAME(161, cvxPartSetFaceAtInit)
+CALL_PROFILE_NAME(162, cvxPartSetFaceAt)
+CALL_PROFILE_NAME(163, cvxPartSetFaceTx)
+CALL_PROFILE_NAME(164, cvxPartDelFaceTx)
+CALL_PROFILE_NAME(165, cvxPartInqFaceTxFile)
+CALL_PROFILE_NAME(166, cvxPartInqFaceTxFileByLongPath)
+CALL_PROFILE_NAME(167, cvxPartInqFaceBox)
+CALL_PROFILE_NAME(168, cvxPartInqFaceCrvs)
+CALL_PROFILE_NAME(169, cvxPartInqFaceEdges)
+CALL_PROFILE_NAME(170, cvxPartInqFaceLoops)
+CALL_PROFILE_NAME(171, cvxPartInqFaceSrf)
+CALL_PROFILE_NAME(172, cvxSurfaceFree)
+CALL_PROFILE_NAME(173, cvxPartInqFaceSrfPrim)
+CALL_PROFILE_NAME(174, cvxSrfPrimFree)
+CALL_PROFILE_NAME(175, cvxPartInqFaceShape)
+CALL_PROFILE_NAME(176, cvxPartInqFaceGeom)
+CALL_PROFILE_NAME(177, cvxPartInqFaceFillet)
+CALL_PROFILE_NAME(178, cvxFaceRadius)
+CALL_PROFILE_NAME(179, cvxFaceInqBend)
+CALL_PROFILE_NAME(180, cvxFaceIsConcave)
+CALL_PROFILE_NAME(181, cvxFaceIsPlanar)
+CALL_PROFILE_NAME(182, cvxFaceInqExtreme)
+CALL_PROFILE_NAME(183, cvxFaceEval)
+CALL_PROFILE_NAME(184, cvxFaceEval2)
+CALL_PROFILE_NAME(185, cvxFaceParam)
+CALL_PROFILE_NAME(186, cvxFacePntLoc)
+CALL_PROFILE_NAME(187, cvxFacePntProj)
+CALL_PROFILE_NAME(188, cvxFaceRadialIntegrity)
+CALL_PROFILE_NAME(189, cvxFaceEvalGeom)
+CALL_PROFILE_NAME(190, cvxPartInqLoopEdges)
+CALL_PROFILE_NAME(191, cvxPartInqLoopFace)
+CALL_PROFILE_NAME(192, cvxPartInqLoopPreEdges)
+CALL_PROFILE_NAME(193, cvxPartInqLoopInner)
+CALL_PROFILE_NAME(194, cvxPartInqPreEdgeInfo)
+CALL_PROFILE_NAME(195, cvxPartInqPreEdgeStartPnt)
+CALL_PROFILE_NAME(196, cvxPartInqVertexEdges)
+CALL_PROFILE_NAME(197, cvxCmCompInsert)
+CALL_PROFILE_NAME(198, cvxCmCompDelete)
+CALL_PROFILE_NAME(199, cvxCmCompGetAttr)
+CALL_PROFILE_NAME(200, cvxCmCompSetAttr)
+CALL_PROFILE_NAME(201, cvxCmCompInqInfo)
+CALL_PROFILE_NAME(202, cvxCmCompInqInfoByLongPath)
+CALL_PROFILE_NAME(203, cvxCmPlanSkNew)
+CALL_PROFILE_NAME(204, cvxCmGeomUpdata)
+CALL_PROFILE_NAME(205, cvxCmFolderGetAttr)
+CALL_PROFILE_NAME(206, cvxCmFolderInqOps)
+CALL_PROFILE_NAME(207, cvxCmOpInsFolder)
+CALL_PROFILE_NAME(208, cvxCmObjGetTreeId)
+CALL_PROFILE_NAME(209, cvxCmObjGetUiPos)
+CALL_PROFILE_NAME(210, cvxCmFldRename)
+CALL_PROFILE_NAME(211, ZwCamFolderCreate)
+CALL_PROFILE_NAME(212, ZwCamFolderNameSet)
+CALL_PROFILE_NAME(213, ZwCamFolderNameGet)
+CALL_PROFILE_NAME(214, cvxCmSetClearance)
+CALL_PROFILE_NAME(215, cvxCmGetClearance)
+CALL_PROFILE_NAME(216, cvxCmSetSAndF)
+CALL_PROFILE_NAME(217, cvxCmOutputManhours)
+CALL_PROFILE_NAME(218, cvxCmOutputInsNC)
+CALL_PROFILE_NAME(219, cvxCmOutputDelNC)
+CALL_PROFILE_NAME(220, cvxCmGetOutputNCSet)
+CALL_PROFILE_NAME(221, cvxCmSetOutputNCSet)
+CALL_PROFILE_NAME(222, cvxCmOutputInsOps)
+CALL_PROFILE_NAME(223, cvxCmOutputDelOps)
+CALL_PROFILE_NAME(224, cvxCmOutputNC)
+CALL_PROFILE_NAME(225, cvxCmOpsOutputNc)
+CALL_PROFILE_NAME(226, cvxCmMsgClear)
+CALL_PROFILE_NAME(227, cvxCmFrameInsert)
+CALL_PROFILE_NAME(228, cvxCmFrameDelete)
+CALL_PROFILE_NAME(229, cvxCmFrameGetAttr)
+CALL_PROFILE_NAME(230, cvxCmFrameInsert2)
+CALL_PROFILE_NAME(231, cvxCmOpAddFrame)
+CALL_PROFILE_NAME(232, cvxCmFrameGetMatrix)
+CALL_PROFILE_NAME(233, cvxCmFrameGetActive)
+CALL_PROFILE_NAME(234, cvxCmFtrInsert)
+CALL_PROFILE_NAME(235, cvxCmFtrInsertNew)
+CALL_PROFILE_NAME(236, cvxCmFtrInsertWithoutHoles)
+CALL_PROFILE_NAME(237, cvxCmFtrInsertSK)
+CALL_PROFILE_NAME(238, cvxCmFtrGetComp)
+CALL_PROFILE_NAME(239, cvxCmGetCrvId)
+CALL_PROFILE_NAME(240, cvxCmFtrInsertHole)
+CALL_PROFILE_NAME(241, cvxCmPlanDispSetMode)
+CALL_PROFILE_NAME(242, cvxCmPlanDispResetMode)
+CALL_PROFILE_NAME(243, cvxCmFtrDelete)
+CALL_PROFILE_NAME(244, cvxCmFtrRename)
+CALL_PROFILE_NAME(245, cvxCmProfSetAttr)
+CALL_PROFILE_NAME(246, cvxCmFtrInqType)
+CALL_PROFILE_NAME(247, ZwCamFtrGrpFeatListGet)
+CALL_PROFILE_NAME(248, ZwCamFtrElementListGet)
+CALL_PROFILE_NAME(249, ZwCamHoleFeatDataGet)
+CALL_PROFILE_NAME(250, ZwCamHoleFeatDataSet)
+CALL_PROFILE_NAME(251, ZwCamProfFeatDataGet)
+CALL_PROFILE_NAME(252, ZwCamProfFeatDataSet)
+CALL_PROFILE_NAME(253, ZwCamProfElementDataGet)
+CALL_PROFILE_NAME(254, ZwCamProfElementDataSet)
+CALL_PROFILE_NAME(255, ZwCamCroundFeatDataGet)
+CALL_PROFILE_NAME(256, ZwCamCroundFeatDataSet)
+CALL_PROFILE_NAME(257, ZwCamSlotFeatDataGet)
+CALL_PROFILE_NAME(258, ZwCamSlotFeatDataSet)
+CALL_PROFILE_NAME(259, ZwCamChamferFeatDataGet)
+CALL_PROFILE_NAME(260, ZwCamChamferFeatDataSet)
+CALL_PROFILE_NAME(261, ZwCamFtrGrpProfClassSet)
+CALL_PROFILE_NAME(262, ZwCamFtrGrpProfClassGet)
+CALL_PROFILE_NAME(263, cvxCmMachineInsert)
+CALL_PROFILE_NAME(264, cvxCmMachineActive)
+CALL_PROFILE_NAME(265, cvxCmMachineDelete)
+CALL_PROFILE_NAME(266, cvxCmMachineGetAttr)
+CALL_PROFILE_NAME(267, cvxCmMachineSetAttr)
+CALL_PROFILE_NAME(268, cvxCmToolChangerInsert)
+CALL_PROFILE_NAME(269, cvxCmToolChangerDelete)
+CALL_PROFILE_NAME(270, ZwCamMachineIntSet)
+CALL_PROFILE_NAME(271, ZwCamMachineIntGet)
+CALL_PROFILE_NAME(272, ZwCamMachineStrGet)
+CALL_PROFILE_NAME(273, ZwCamMachineStrSet)
+CALL_PROFILE_NAME(274, cvxCmOpInsert)
+CALL_PROFILE_NAME(275, cvxCmOpDelete)
+CALL_PROFILE_NAME(276, cvxCmOpDuplicate)
+CALL_PROFILE_NAME(277, cvxCmOpAddComp)
+CALL_PROFILE_NAME(278, cvxCmOpRemoveComp)
+CALL_PROFILE_NAME(279, cvxCmOpAddFtr)
+CALL_PROFILE_NAME(280, cvxCmOpRemoveFtr)
+CALL_PROFILE_NAME(281, cvxCmOpCalTPath)
+CALL_PROFILE_NAME(282, cvxCmOpAddTool)
+CALL_PROFILE_NAME(283, cvxCmOpRemoveTool)
+CALL_PROFILE_NAME(284, cvxCmOpSetSpeed)
+CALL_PROFILE_NAME(285, cvxCmOpSetAttr2)
+CALL_PROFILE_NAME(286, cvxCmOpGetAttr2)
+CALL_PROFILE_NAME(287, cvxCmOpGetIdxFromName)
+CALL_PROFILE_NAME(288, cvxCmSetOpPoint)
+CALL_PROFILE_NAME(289, cvxCmSetOpPoints)
+CALL_PROFILE_NAME(290, cvxCmOpRename)
+CALL_PROFILE_NAME(291, cvxCmOpDrag)
+CALL_PROFILE_NAME(292, cvxCmOpSetBasicAttr)
+CALL_PROFILE_NAME(293, cvxCmOpInqClass)
+CALL_PROFILE_NAME(294, cvxCmOpSetClass)
+CALL_PROFILE_NAME(295, cvxCmOpInqTypeS)
+CALL_PROFILE_NAME(296, cvxCmOpSetSpindleSpd)
+CALL_PROFILE_NAME(297, cvxCmOpSetFeedRate)
+CALL_PROFILE_NAME(298, cvxCmOpGetSpindleSpd)
+CALL_PROFILE_NAME(299, cvxCmOpGetFeedRate)
+CALL_PROFILE_NAME(300, ZwCamOpSetFolder)
+CALL_PROFILE_NAME(301, ZwCamOpSaveToXml)
+CALL_PROFILE_NAME(302, ZwCamOpDoubleSet)
+CALL_PROFILE_NAME(303, ZwCamOpIntSet)
+CALL_PROFILE_NAME(304, ZwCamOpStrSet)
+CALL_PROFILE_NAME(305, ZwCamOpObjSet)
+CALL_PROFILE_NAME(306, ZwCamOpDoubleGet)
+CALL_PROFILE_NAME(307, ZwCamOpIntGet)
+CALL_PROFILE_NAME(308, ZwCamOpStrGet)
+CALL_PROFILE_NAME(309, ZwCamOpObjGet)
+CALL_PROFILE_NAME(310, cvxCmInqAl)
+CALL_PROFILE_NAME(311, cvxCmSolidVerify)
+CALL_PROFILE_NAME(312, cvxCmClashDetect)
+CALL_PROFILE_NAME(313, cvxCmGougeDetect)
+CALL_PROFILE_NAME(314, cvxCmConfigFileGetString)
+CALL_PROFILE_NAME(315, cvxCmInqOpName)
+CALL_PROFILE_NAME(316, cvxCmInqIndexFromName)
+CALL_PROFILE_NAME(317, cvxCmCompGetIdxFromName)
+CALL_PROFILE_NAME(318, ZwCamTreeRefresh)
+CALL_PROFILE_NAME(319, ZwCamLicProductCheck)
+CALL_PROFILE_NAME(320, cvxCmToolInsert)
+CALL_PROFILE_NAME(321, cvxCmToolInsertAsTemplate)
+CALL_PROFILE_NAME(322, cvxCmToolDelete)
+CALL_PROFILE_NAME(323, cvxCmHolderInsertAsTemplate)
+CALL_PROFILE_NAME(324, cvxCmSpeedInsertAsTemplate)
+CALL_PROFILE_NAME(325, cvxCmToolGetData)
+CALL_PROFILE_NAME(326, cvxCmToolGetRegister)
+CALL_PROFILE_NAME(327, cvxCmToolSetRegister)
+CALL_PROFILE_NAME(328, cvxCmToolSetCoolant)
+CALL_PROFILE_NAME(329, cvxCmToolGetCoolant)
+CALL_PROFILE_NAME(330, cvxCmToolAddHolderLayer)
+CALL_PROFILE_NAME(331, cvxCmToolDelHolderLayer)
+CALL_PROFILE_NAME(332, cvxCmToolGetHolderLayers)
+CALL_PROFILE_NAME(333, cvxCmToolSetHolderLayer)
+CALL_PROFILE_NAME(334, cvxCmToolSetSpindleSpd)
+CALL_PROFILE_NAME(335, cvxCmToolGetSpindleSpd)
+CALL_PROFILE_NAME(336, cvxCmToolSetFeedRate)
+CALL_PROFILE_NAME(337, cvxCmToolGetFeedRate)
+CALL_PROFILE_NAME(338, cvxCmToolGetSpdFdRowCnt)
+CALL_PROFILE_NAME(339, cvxCmToolRenameHolder)
+CALL_PROFILE_NAME(340, cvxCmToolGetHolderName)
+CALL_PROFILE_NAME(341, cvxCmToolOpenMillForm)
+CALL_PROFILE_NAME(342, ZwCamToolInsertFromLibrary)
+CALL_PROFILE_NAME(343, ZwCamToolExportAllToLibrary)
+CALL_PROFILE_NAME(344, cvxNewCommand)
+CALL_PROFILE_NAME(345, cvxCmdBuffer)
+CALL_PROFILE_NAME(346, cvxCmdSend)
+CALL_PROFILE_NAME(347, cvxCmdChkLic)
+CALL_PROFILE_NAME(348, cvxCmdAction)
+CALL_PROFILE_NAME(349, cvxCmdFunc)
+CALL_PROFILE_NAME(350, cvxCmdCallback)
+CALL_PROFILE_NAME(351, cvxCmdFuncUnload)
+CALL_PROFILE_NAME(352, cvxCmdVariable)
+CALL_PROFILE_NAME(353, cvxCmdVariableUnload)
+CALL_PROFILE_NAME(354, cvxCmdRegisterRcc)
+CALL_PROFILE_NAME(355, cvxCmdUnRegisterRcc)
+CALL_PROFILE_NAME(356, cvxCmdMacro)
+CALL_PROFILE_NAME(357, cvxCmdMacro2)
+CALL_PROFILE_NAME(358, cvxMacroInqPath)
+CALL_PROFILE_NAME(359, cvxMacroInqPathByLongPath)
+CALL_PROFILE_NAME(360, cvxCompIns)
+CALL_PROFILE_NAME(361, cvxCompAutoHoleMatchIns)
+CALL_PROFILE_NAME(362, cvxCompWithLayoutIns)
+CALL_PROFILE_NAME(363, cvxCompInclude)
+CALL_PROFILE_NAME(364, cvxCompMerge)
+CALL_PROFILE_NAME(365, cvxCompMerge2)
+CALL_PROFILE_NAME(366, cvxCompExtract)
+CALL_PROFILE_NAME(367, cvxPartGeomExport)
+CALL_PROFILE_NAME(368, cvxPartGeomExportII)
+CALL_PROFILE_NAME(369, cvxPartIns)
+CALL_PROFILE_NAME(370, cvxCompAddCoincidentCons)
+CALL_PROFILE_NAME(371, cvxCompAddTangentCons)
+CALL_PROFILE_NAME(372, cvxCompAddConcentricCons)
+CALL_PROFILE_NAME(373, cvxCompAddParallelCons)
+CALL_PROFILE_NAME(374, cvxCompAddPerpendicularCons)
+CALL_PROFILE_NAME(375, cvxCompAddAngularCons)
+CALL_PROFILE_NAME(376, cvxCompAddLockCons)
+CALL_PROFILE_NAME(377, cvxCompAddDistanceCons)
+CALL_PROFILE_NAME(378, cvxCompAddMiddleCons)
+CALL_PROFILE_NAME(379, cvxCompAddSymmetryCons)
+CALL_PROFILE_NAME(380, cvxCompAddFrameCons)
+CALL_PROFILE_NAME(381, cvxCompAddGearCons)
+CALL_PROFILE_NAME(382, cvxCompAddPathCons)
+CALL_PROFILE_NAME(383, cvxCompAddLinearCoupleCons)
+CALL_PROFILE_NAME(384, cvxCompAddRackPinionCons)
+CALL_PROFILE_NAME(385, cvxCompAddScrewCons)
+CALL_PROFILE_NAME(386, cvxCompAddSlotCons)
+CALL_PROFILE_NAME(387, cvxCompAddCamCons)
+CALL_PROFILE_NAME(388, cvxCompAddUniJointCons)
+CALL_PROFILE_NAME(389, cvxPartAlign)
+CALL_PROFILE_NAME(390, cvxPartAnchor)
+CALL_PROFILE_NAME(391, cvxCompPtnInit)
+CALL_PROFILE_NAME(392, cvxCompPtn)
+CALL_PROFILE_NAME(393, cvxCompMoveInit)
+CALL_PROFILE_NAME(394, cvxCompMove)
+CALL_PROFILE_NAME(395, cvxCompMirrorInit)
+CALL_PROFILE_NAME(396, cvxCompMirror)
+CALL_PROFILE_NAME(397, cvxAsmCutInit)
+CALL_PROFILE_NAME(398, cvxAsmCut)
+CALL_PROFILE_NAME(399, cvxAsmFilletInit)
+CALL_PROFILE_NAME(400, cvxAsmFillet)
+CALL_PROFILE_NAME(401, cvxAsmChamferInit)
+CALL_PROFILE_NAME(402, cvxAsmChamfer)
+CALL_PROFILE_NAME(403, cvxCompIsectShpChk)
+CALL_PROFILE_NAME(404, cvxCompIsectShpChk2)
+CALL_PROFILE_NAME(405, cvxCompIferCheck)
+CALL_PROFILE_NAME(406, cvxCompInterferenceCheck)
+CALL_PROFILE_NAME(407, cvxCompIfterDataFree)
+CALL_PROFILE_NAME(408, cvxCompClearCheck)
+CALL_PROFILE_NAME(409, cvxCompInsInit)
+CALL_PROFILE_NAME(410, cvxCompWithLayoutInsInit)
+CALL_PROFILE_NAME(411, cvxCompAutoHoleMatchInsInit)
+CALL_PROFILE_NAME(412, cvxPartRefGeom)
+CALL_PROFILE_NAME(413, cvxPartPublishSet)
+CALL_PROFILE_NAME(414, cvxPartAxisNew)
+CALL_PROFILE_NAME(415, cvxPartDatum)
+CALL_PROFILE_NAME(416, cvxPartDatum2)
+CALL_PROFILE_NAME(417, cvxPartNewDatum)
+CALL_PROFILE_NAME(418, cvxPartPlnCrv)
+CALL_PROFILE_NAME(419, cvxPartPlnCrv2)
+CALL_PROFILE_NAME(420, cvxPartPlnSrf)
+CALL_PROFILE_NAME(421, cvxPartPlnSrf2)
+CALL_PROFILE_NAME(422, cvxPartPlaneNew)
+CALL_PROFILE_NAME(423, cvxPartPlaneAddInit)
+CALL_PROFILE_NAME(424, cvxPartPlaneAdd)
+CALL_PROFILE_NAME(425, cvxPartCSYSNewInit)
+CALL_PROFILE_NAME(426, cvxPartCSYSNew)
+CALL_PROFILE_NAME(427, cvxPartActiveAsLCS)
+CALL_PROFILE_NAME(428, cvxPartDEMoveInit)
+CALL_PROFILE_NAME(429, cvxPartDEMove)
+CALL_PROFILE_NAME(430, cvxPartDEAlignMoveInit)
+CALL_PROFILE_NAME(431, cvxPartDEAlignMove)
+CALL_PROFILE_NAME(432, cvxPartDEDimMoveInit)
+CALL_PROFILE_NAME(433, cvxPartDEDimMove)
+CALL_PROFILE_NAME(434, cvxPartDEOffsetInit)
+CALL_PROFILE_NAME(435, cvxPartDEOffset)
+CALL_PROFILE_NAME(436, cvxPartDEDraftInit)
+CALL_PROFILE_NAME(437, cvxPartDEDraft)
+CALL_PROFILE_NAME(438, cvxPartDECopyInit)
+CALL_PROFILE_NAME(439, cvxPartDECopy)
+CALL_PROFILE_NAME(440, cvxPartDEMirrorInit)
+CALL_PROFILE_NAME(441, cvxPartDEMirror)
+CALL_PROFILE_NAME(442, cvxPartDEPtnInit)
+CALL_PROFILE_NAME(443, cvxPartDEPtn)
+CALL_PROFILE_NAME(444, cvxPartDEFlltInit)
+CALL_PROFILE_NAME(445, cvxPartDEFllt)
+CALL_PROFILE_NAME(446, cvxPartDERadInit)
+CALL_PROFILE_NAME(447, cvxPartDERad)
+CALL_PROFILE_NAME(448, cvxDwgAutoDimAdd)
+CALL_PROFILE_NAME(449, cvxDwgAutoDimAddInit)
+CALL_PROFILE_NAME(450, cvxDwgLineDimAdd)
+CALL_PROFILE_NAME(451, cvxDwgBaseLineDimAdd)
+CALL_PROFILE_NAME(452, cvxDwgContinuousDimAdd)
+CALL_PROFILE_NAME(453, cvxDwgOrdinateDimAdd)
+CALL_PROFILE_NAME(454, cvxDwgLineOffsetDimAdd)
+CALL_PROFILE_NAME(455, cvxDwgSymmetryDimAdd)
+CALL_PROFILE_NAME(456, cvxDwgLnrChmDimAddInit)
+CALL_PROFILE_NAME(457, cvxDwgLnrChmDimAdd)
+CALL_PROFILE_NAME(458, cvxDwgAngDimAdd)
+CALL_PROFILE_NAME(459, cvxDwgRadDimAdd)
+CALL_PROFILE_NAME(460, cvxDwgArcDimAdd)
+CALL_PROFILE_NAME(461, cvxDwgHoleCallOutDimAddinit)
+CALL_PROFILE_NAME(462, cvxDwgHoleCallOutDimAdd)
+CALL_PROFILE_NAME(463, cvxDwgLabelCoorDimAdd)
+CALL_PROFILE_NAME(464, cvxDwgLabelDimAdd)
+CALL_PROFILE_NAME(465, cvxDwgBalloonDimAdd)
+CALL_PROFILE_NAME(466, cvxDwgAutoBlnAddInit)
+CALL_PROFILE_NAME(467, cvxDwgAutoBlnAdd)
+CALL_PROFILE_NAME(468, cvxDwgStkBlnAddInit)
+CALL_PROFILE_NAME(469, cvxDwgStkBlnAdd)
+CALL_PROFILE_NAME(470, cvxDwgFtrCtrlDimAdd)
+CALL_PROFILE_NAME(471, cvxDwgDatumDimAdd)
+CALL_PROFILE_NAME(472, cvxDwgDatumTargDimAddInit)
+CALL_PROFILE_NAME(473, cvxDwgDatumTargDimAdd)
+CALL_PROFILE_NAME(474, cvxDwgCenterMarkDimAddInit)
+CALL_PROFILE_NAME(475, cvxDwgCenterMarkDimAdd)
+CALL_PROFILE_NAME(476, cvxDwgCenMarkCirDimAddInit)
+CALL_PROFILE_NAME(477, cvxDwgCenMarkCirDimAdd)
+CALL_PROFILE_NAME(478, cvxDwgCenterLineDimAddInit)
+CALL_PROFILE_NAME(479, cvxDwgCenterLineDimAdd)
+CALL_PROFILE_NAME(480, cvxDwgSymWeldNew)
+CALL_PROFILE_NAME(481, cvxDwgSymWeldNewInit)
+CALL_PROFILE_NAME(482, cvxDwgSymSurfNewInit)
+CALL_PROFILE_NAME(483, cvxDwgSymSurfNew)
+CALL_PROFILE_NAME(484, cvxDwgSymImgNew)
+CALL_PROFILE_NAME(485, cvxDwgSymImgNewInit)
+CALL_PROFILE_NAME(486, cvxDwgInsertSymbol)
+CALL_PROFILE_NAME(487, cvxDwgUserSymNew)
+CALL_PROFILE_NAME(488, cvxDwgIsectSym)
+CALL_PROFILE_NAME(489, cvxDwgHoleMarkInit)
+CALL_PROFILE_NAME(490, cvxDwgHoleMark)
+CALL_PROFILE_NAME(491, cvxDwgBalloonTextSet)
+CALL_PROFILE_NAME(492, cvxDwgBalloonTextGet)
+CALL_PROFILE_NAME(493, cvxDwgCrossHatchInit)
+CALL_PROFILE_NAME(494, cvxDwgCrossHatch)
+CALL_PROFILE_NAME(495, cvxDwgEntMovePntToPnt)
+CALL_PROFILE_NAME(496, cvxDwgEntMoveAlongDirection)
+CALL_PROFILE_NAME(497, cvxDwgViewLayoutInit)
+CALL_PROFILE_NAME(498, cvxDwgViewLayout)
+CALL_PROFILE_NAME(499, cvxDwgViewStandardInit)
+CALL_PROFILE_NAME(500, cvxDwgViewStandard)
+CALL_PROFILE_NAME(501, cvxDwgViewProjection)
+CALL_PROFILE_NAME(502, cvxDwgViewAuxiliaryInit)
+CALL_PROFILE_NAME(503, cvxDwgViewAuxiliary)
+CALL_PROFILE_NAME(504, cvxDwgViewFullSectionInit)
+CALL_PROFILE_NAME(505, cvxDwgViewFullSection)
+CALL_PROFILE_NAME(506, cvxDwgViewAlignedSectionInit)
+CALL_PROFILE_NAME(507, cvxDwgViewAlignedSection)
+CALL_PROFILE_NAME(508, cvxDwgViewBrokenSectionInit)
+CALL_PROFILE_NAME(509, cvxDwgViewBrokenSection)
+CALL_PROFILE_NAME(510, cvxDwgViewDetailInit)
+CALL_PROFILE_NAME(511, cvxDwgViewDetail)
+CALL_PROFILE_NAME(512, cvxDwgViewBrkLineInit)
+CALL_PROFILE_NAME(513, cvxDwgViewBrkLine)
+CALL_PROFILE_NAME(514, cvxDwgTableBomInit)
+CALL_PROFILE_NAME(515, cvxDwgTableBom)
+CALL_PROFILE_NAME(516, cvxDwgTableInsert)
+CALL_PROFILE_NAME(517, cvxDwgUserTableCreate)
+CALL_PROFILE_NAME(518, cvxDwgUserTableCreateByTemplate)
+CALL_PROFILE_NAME(519, cvxDwgRotateViewinit)
+CALL_PROFILE_NAME(520, cvxDwgRotateView)
+CALL_PROFILE_NAME(521, cvxDwgViewRotate)
+CALL_PROFILE_NAME(522, cvxPartEcadRgnSetInit)
+CALL_PROFILE_NAME(523, cvxPartEcadRgnSet)
+CALL_PROFILE_NAME(524, cvxPartEcadRgnCut)
+CALL_PROFILE_NAME(525, cvxPartFilletBlendInit)
+CALL_PROFILE_NAME(526, cvxPartFilletBlend)
+CALL_PROFILE_NAME(527, cvxPartNSidedInit)
+CALL_PROFILE_NAME(528, cvxPartNSided)
+CALL_PROFILE_NAME(529, cvxPartTrimmedPlaneInit)
+CALL_PROFILE_NAME(530, cvxPartTrimmedPlane)
+CALL_PROFILE_NAME(531, cvxPartRuledInit)
+CALL_PROFILE_NAME(532, cvxPartRuled)
+CALL_PROFILE_NAME(533, cvxPartCircularBiRailInit)
+CALL_PROFILE_NAME(534, cvxPartCircularBiRail)
+CALL_PROFILE_NAME(535, cvxPartConicBiRailInit)
+CALL_PROFILE_NAME(536, cvxPartConicBiRail)
+CALL_PROFILE_NAME(537, cvxPartFacesOffsetInit)
+CALL_PROFILE_NAME(538, cvxPartFacesOffset)
+CALL_PROFILE_NAME(539, cvxPartExtendFaceInit)
+CALL_PROFILE_NAME(540, cvxPartExtendFace)
+CALL_PROFILE_NAME(541, cvxPartTrimToFacesInit)
+CALL_PROFILE_NAME(542, cvxPartTrimToFaces)
+CALL_PROFILE_NAME(543, cvxPartTrimToCrvs)
+CALL_PROFILE_NAME(544, cvxPartSetFaceDir)
+CALL_PROFILE_NAME(545, cvxFaceReverse)
+CALL_PROFILE_NAME(546, cvxFaceReverseDir)
+CALL_PROFILE_NAME(547, cvxPartModifyIsolineNum)
+CALL_PROFILE_NAME(548, cvxPartExplodeInit)
+CALL_PROFILE_NAME(549, cvxPartExplode)
+CALL_PROFILE_NAME(550, cvxPartFacesetSewInit)
+CALL_PROFILE_NAME(551, cvxPartFacesetSew)
+CALL_PROFILE_NAME(552, cvxPartSewForce)
+CALL_PROFILE_NAME(553, cvxPartEnlargeFaceInit)
+CALL_PROFILE_NAME(554, cvxPartEnlargeFace)
+CALL_PROFILE_NAME(555, cvxPartExtendShapeInit)
+CALL_PROFILE_NAME(556, cvxPartExtendShape)
+CALL_PROFILE_NAME(557, cvxPartSplitWithCrvInit)
+CALL_PROFILE_NAME(558, cvxPartSplitWithCrv)
+CALL_PROFILE_NAME(559, cvxPartCurveMeshInit)
+CALL_PROFILE_NAME(560, cvxPartCurveMesh)
+CALL_PROFILE_NAME(561, cvxDataInit)
+CALL_PROFILE_NAME(562, cvxDataZero)
+CALL_PROFILE_NAME(563, cvxDataSet)
+CALL_PROFILE_NAME(564, cvxDataSetColor)
+CALL_PROFILE_NAME(565, cvxDataSetPath)
+CALL_PROFILE_NAME(566, cvxDataSetPromote)
+CALL_PROFILE_NAME(567, cvxDataSetPntOnCrv)
+CALL_PROFILE_NAME(568, cvxDataSetPntOnFace)
+CALL_PROFILE_NAME(569, cvxDataSetPntOnFace2)
+CALL_PROFILE_NAME(570, cvxDataSetPntByPath)
+CALL_PROFILE_NAME(571, cvxDataSetPntOnCrvPath)
+CALL_PROFILE_NAME(572, cvxDataSetPntOnEnt)
+CALL_PROFILE_NAME(573, cvxDataSetPntOnEntPath)
+CALL_PROFILE_NAME(574, cvxDataSetDirOnEntPath)
+CALL_PROFILE_NAME(575, cvxDataSetMatrix)
+CALL_PROFILE_NAME(576, cvxDataToFeature)
+CALL_PROFILE_NAME(577, cvxDataGet)
+CALL_PROFILE_NAME(578, cvxDataGetColor)
+CALL_PROFILE_NAME(579, cvxDataGetEnt)
+CALL_PROFILE_NAME(580, cvxDataGetEnts)
+CALL_PROFILE_NAME(581, cvxDataGetList)
+CALL_PROFILE_NAME(582, cvxDataGetNum)
+CALL_PROFILE_NAME(583, cvxDataGetOpt)
+CALL_PROFILE_NAME(584, cvxDataGetPath)
+CALL_PROFILE_NAME(585, cvxDataGetPaths)
+CALL_PROFILE_NAME(586, cvxDataGetPnt)
+CALL_PROFILE_NAME(587, cvxDataGetPnts)
+CALL_PROFILE_NAME(588, cvxDataGetPntOnEnt)
+CALL_PROFILE_NAME(589, cvxDataGetPntsOnEnts)
+CALL_PROFILE_NAME(590, cvxDataGetPromote)
+CALL_PROFILE_NAME(591, cvxDataGetText)
+CALL_PROFILE_NAME(592, cvxDataGetMatrix)
+CALL_PROFILE_NAME(593, cvxDataGetItemList)
+CALL_PROFILE_NAME(594, cvxDataGetItemData)
+CALL_PROFILE_NAME(595, cvxDataGetAll)
+CALL_PROFILE_NAME(596, cvxFldDataFree)
+CALL_PROFILE_NAME(597, cvxDataClear)
+CALL_PROFILE_NAME(598, cvxDataDel)
+CALL_PROFILE_NAME(599, cvxDataDelItem)
+CALL_PROFILE_NAME(600, cvxDataDelUnHi)
+CALL_PROFILE_NAME(601, cvxDataFree)
+CALL_PROFILE_NAME(602, cvxDataGrpRem)
+CALL_PROFILE_NAME(603, cvxDataInqActive)
+CALL_PROFILE_NAME(604, cvxDataInqParent)
+CALL_PROFILE_NAME(605, cvxDataName)
+CALL_PROFILE_NAME(606, cvxAuxFrameShow)
+CALL_PROFILE_NAME(607, cvxAuxFrameSetOrigin)
+CALL_PROFILE_NAME(608, cvxAuxFrameSetAxisVec)
+CALL_PROFILE_NAME(609, cvxAuxFrameSetDirXYZOrgBuddy)
+CALL_PROFILE_NAME(610, cvxMoveSetAuxFrameElem)
+CALL_PROFILE_NAME(611, cvxCmdEval)
+CALL_PROFILE_NAME(612, cvxCmdExec)
+CALL_PROFILE_NAME(613, cvxCmdExec2)
+CALL_PROFILE_NAME(614, cvxCmdExecWithOut)
+CALL_PROFILE_NAME(615, cvxCmdInput)
+CALL_PROFILE_NAME(616, cvxCmdInteract)
+CALL_PROFILE_NAME(617, cvxCmdInqActive)
+CALL_PROFILE_NAME(618, cvxCmdMarker)
+CALL_PROFILE_NAME(619, cvxCmdStateGet)
+CALL_PROFILE_NAME(620, cvxCmdStateSet)
+CALL_PROFILE_NAME(621, cvxCmdTemplate)
+CALL_PROFILE_NAME(622, cvxCmdTemplateUnload)
+CALL_PROFILE_NAME(623, cvxEchoColorGet)
+CALL_PROFILE_NAME(624, cvxEchoColorSet)
+CALL_PROFILE_NAME(625, cvxEchoColorAtSet)
+CALL_PROFILE_NAME(626, cvxEchoColorAtGet)
+CALL_PROFILE_NAME(627, cvxEchoCustomStart)
+CALL_PROFILE_NAME(628, cvxEchoCustomEnd)
+CALL_PROFILE_NAME(629, cvxEchoDraw)
+CALL_PROFILE_NAME(630, cvxEchoStart)
+CALL_PROFILE_NAME(631, cvxEchoEnd)
+CALL_PROFILE_NAME(632, cvxEchoEscDisable)
+CALL_PROFILE_NAME(633, cvxEchoEscRestore)
+CALL_PROFILE_NAME(634, cvxTplInqFnCust)
+CALL_PROFILE_NAME(635, cvxTplInqFnEcho)
+CALL_PROFILE_NAME(636, cvxTplInqFnInit)
+CALL_PROFILE_NAME(637, cvxTplInqFnTerm)
+CALL_PROFILE_NAME(638, cvxPartAddLineDim)
+CALL_PROFILE_NAME(639, cvxPartAddSymmetryDim)
+CALL_PROFILE_NAME(640, cvxPartAddAngleDim)
+CALL_PROFILE_NAME(641, cvxPartAddRadDim)
+CALL_PROFILE_NAME(642, cvxPartAddChamferDim)
+CALL_PROFILE_NAME(643, cvxPartAddArcDim)
+CALL_PROFILE_NAME(644, cvxPartAddCoorDim)
+CALL_PROFILE_NAME(645, cvxPartAddLabelDim)
+CALL_PROFILE_NAME(646, cvxPartAddDatumDim)
+CALL_PROFILE_NAME(647, cvxPartAddDatumTargetDim)
+CALL_PROFILE_NAME(648, cvxPartAddFcsDim)
+CALL_PROFILE_NAME(649, cvxPartAddSymSrfDim)
+CALL_PROFILE_NAME(650, cvxPartAddCenLinDim)
+CALL_PROFILE_NAME(651, cvxPartAddCenMarkDim)
+CALL_PROFILE_NAME(652, cvxPartAddPMIText)
+CALL_PROFILE_NAME(653, cvxPartAddBalloon)
+CALL_PROFILE_NAME(654, cvxPartBoxInit)
+CALL_PROFILE_NAME(655, cvxPartBox)
+CALL_PROFILE_NAME(656, cvxPartCylInit)
+CALL_PROFILE_NAME(657, cvxPartCyl)
+CALL_PROFILE_NAME(658, cvxPartConeInit)
+CALL_PROFILE_NAME(659, cvxPartCone)
+CALL_PROFILE_NAME(660, cvxPartSphereInit)
+CALL_PROFILE_NAME(661, cvxPartSphere)
+CALL_PROFILE_NAME(662, cvxPartEllipsoidInit)
+CALL_PROFILE_NAME(663, cvxPartEllipsoid)
+CALL_PROFILE_NAME(664, cvxPartExtrudeInit)
+CALL_PROFILE_NAME(665, cvxPartExtrude)
+CALL_PROFILE_NAME(666, cvxPartRevolveInit)
+CALL_PROFILE_NAME(667, cvxPartRevolve)
+CALL_PROFILE_NAME(668, cvxPartSweepInit)
+CALL_PROFILE_NAME(669, cvxPartSweep)
+CALL_PROFILE_NAME(670, cvxPartSpiralSweepInit)
+CALL_PROFILE_NAME(671, cvxPartSpiralSweep)
+CALL_PROFILE_NAME(672, cvxPartLoftInit)
+CALL_PROFILE_NAME(673, cvxPartLoft)
+CALL_PROFILE_NAME(674, cvxPartFillet)
+CALL_PROFILE_NAME(675, cvxPartFilletAllInit)
+CALL_PROFILE_NAME(676, cvxPartFilletAll)
+CALL_PROFILE_NAME(677, cvxPartFaceFilletInit)
+CALL_PROFILE_NAME(678, cvxPartFaceFillet)
+CALL_PROFILE_NAME(679, cvxPartChamConst)
+CALL_PROFILE_NAME(680, cvxPartChamAng)
+CALL_PROFILE_NAME(681, cvxPartChamAsym)
+CALL_PROFILE_NAME(682, cvxChamFlltSetDataInit)
+CALL_PROFILE_NAME(683, cvxPartChamferAllInit)
+CALL_PROFILE_NAME(684, cvxPartChamferAll)
+CALL_PROFILE_NAME(685, cvxPartDraftInit)
+CALL_PROFILE_NAME(686, cvxPartDraft)
+CALL_PROFILE_NAME(687, cvxPartHoleInit)
+CALL_PROFILE_NAME(688, cvxPartHole)
+CALL_PROFILE_NAME(689, cvxPartModifyHoleInit)
+CALL_PROFILE_NAME(690, cvxPartModifyHole)
+CALL_PROFILE_NAME(691, cvxPartFlagHolesInit)
+CALL_PROFILE_NAME(692, cvxPartFlagHoles)
+CALL_PROFILE_NAME(693, cvxPartRibInit)
+CALL_PROFILE_NAME(694, cvxPartRib)
+CALL_PROFILE_NAME(695, cvxPartFlagExtThreadInit)
+CALL_PROFILE_NAME(696, cvxPartFlagExtThread)
+CALL_PROFILE_NAME(697, cvxPartThreadAtInit)
+CALL_PROFILE_NAME(698, cvxPartThreadAt)
+CALL_PROFILE_NAME(699, cvxPartLipInit)
+CALL_PROFILE_NAME(700, cvxPartLip)
+CALL_PROFILE_NAME(701, cvxPartStockInit)
+CALL_PROFILE_NAME(702, cvxPartStock)
+CALL_PROFILE_NAME(703, cvxPartFaceOffset)
+CALL_PROFILE_NAME(704, cvxPartShapeFaceOffsetInit)
+CALL_PROFILE_NAME(705, cvxPartShapeFaceOffset)
+CALL_PROFILE_NAME(706, cvxPartShellInit)
+CALL_PROFILE_NAME(707, cvxPartShell)
+CALL_PROFILE_NAME(708, cvxPartThickenInit)
+CALL_PROFILE_NAME(709, cvxPartThicken)
+CALL_PROFILE_NAME(710, cvxPartBool)
+CALL_PROFILE_NAME(711, cvxPartBool2)
+CALL_PROFILE_NAME(712, cvxPartBool3)
+CALL_PROFILE_NAME(713, cvxPartDivideInit)
+CALL_PROFILE_NAME(714, cvxPartDivide)
+CALL_PROFILE_NAME(715, cvxPartTrimInit)
+CALL_PROFILE_NAME(716, cvxPartTrim)
+CALL_PROFILE_NAME(717, cvxPartSimplify)
+CALL_PROFILE_NAME(718, cvxPartReplaceInit)
+CALL_PROFILE_NAME(719, cvxPartReplace)
+CALL_PROFILE_NAME(720, cvxPartInlayInit)
+CALL_PROFILE_NAME(721, cvxPartInlay)
+CALL_PROFILE_NAME(722, cvxPartSelfXInit)
+CALL_PROFILE_NAME(723, cvxPartSelfX)
+CALL_PROFILE_NAME(724, cvxPartPunchInit)
+CALL_PROFILE_NAME(725, cvxPartPunch)
+CALL_PROFILE_NAME(726, cvxPartTwistInit)
+CALL_PROFILE_NAME(727, cvxPartTwist)
+CALL_PROFILE_NAME(728, cvxPartTaperInit)
+CALL_PROFILE_NAME(729, cvxPartTaper)
+CALL_PROFILE_NAME(730, cvxPartStretchInit)
+CALL_PROFILE_NAME(731, cvxPartStretch)
+CALL_PROFILE_NAME(732, cvxPartMorphToCrvInit)
+CALL_PROFILE_NAME(733, cvxPartMorphToCrv)
+CALL_PROFILE_NAME(734, cvxPtnDataInit)
+CALL_PROFILE_NAME(735, cvxPartPatternGeom)
+CALL_PROFILE_NAME(736, cvxPtnVarTblInit)
+CALL_PROFILE_NAME(737, cvxPartPatternFtr)
+CALL_PROFILE_NAME(738, cvxPartMirrorGeominit)
+CALL_PROFILE_NAME(739, cvxPartMirrorGeom)
+CALL_PROFILE_NAME(740, cvxPartMirrorFtrInit)
+CALL_PROFILE_NAME(741, cvxPartMirrorFtr)
+CALL_PROFILE_NAME(742, cvxPartMovePntToPnt)
+CALL_PROFILE_NAME(743, cvxPartMoveTransform)
+CALL_PROFILE_NAME(744, cvxPartMoveTransformList)
+CALL_PROFILE_NAME(745, cvxPartMove)
+CALL_PROFILE_NAME(746, cvxPartCopyDirDis)
+CALL_PROFILE_NAME(747, cvxPartCopyPntToPnt)
+CALL_PROFILE_NAME(748, cvxPartCopyTransform)
+CALL_PROFILE_NAME(749, cvxPartCopyTransformList)
+CALL_PROFILE_NAME(750, cvxPartCopyInit)
+CALL_PROFILE_NAME(751, cvxPartCopy)
+CALL_PROFILE_NAME(752, cvxPartScale)
+CALL_PROFILE_NAME(753, cvxPartScale2)
+CALL_PROFILE_NAME(754, cvxPtnSpacingTableVariableGet)
+CALL_PROFILE_NAME(755, cvxPtnSpacingTableVariableSet)
+CALL_PROFILE_NAME(756, cvxPtnParameterTableVariableGet)
+CALL_PROFILE_NAME(757, cvxPtnParameterTableVariableSet)
+CALL_PROFILE_NAME(758, cvxPtnVarTblMemFree)
+CALL_PROFILE_NAME(759, cvxPartSmdExtrudeTabInit)
+CALL_PROFILE_NAME(760, cvxPartSmdExtrudeTab)
+CALL_PROFILE_NAME(761, cvxPartSmdExtrudeFlangeinit)
+CALL_PROFILE_NAME(762, cvxPartSmdExtrudeFlange)
+CALL_PROFILE_NAME(763, cvxPartSmdReliefDataInit)
+CALL_PROFILE_NAME(764, cvxPartSmdFullFlangeInit)
+CALL_PROFILE_NAME(765, cvxPartSmdFullFlange)
+CALL_PROFILE_NAME(766, cvxPartSmdProfFlangeProfMatInit)
+CALL_PROFILE_NAME(767, cvxPartSmdProfFlangeInit)
+CALL_PROFILE_NAME(768, cvxPartSmdProfFlange)
+CALL_PROFILE_NAME(769, cvxPartSmdPartialFlangeInit)
+CALL_PROFILE_NAME(770, cvxPartSmdPartialFlange)
+CALL_PROFILE_NAME(771, cvxPartSmdHemFlangeInit)
+CALL_PROFILE_NAME(772, cvxPartSmdHemFlange)
+CALL_PROFILE_NAME(773, cvxPartSmdLftFlangeInit)
+CALL_PROFILE_NAME(774, cvxPartSmdLftFlange)
+CALL_PROFILE_NAME(775, cvxPartSmdSweptFlangeInit)
+CALL_PROFILE_NAME(776, cvxPartSmdSweptFlange)
+CALL_PROFILE_NAME(777, cvxPartSmdFoldByLineInit)
+CALL_PROFILE_NAME(778, cvxPartSmdFoldByLine)
+CALL_PROFILE_NAME(779, cvxPartSmdJogInit)
+CALL_PROFILE_NAME(780, cvxPartSmdJog)
+CALL_PROFILE_NAME(781, cvxPartSmdExtendFlangeInit)
+CALL_PROFILE_NAME(782, cvxPartSmdExtendFlange)
+CALL_PROFILE_NAME(783, cvxPartSmdFlangeInit)
+CALL_PROFILE_NAME(784, cvxPartSmdFlange)
+CALL_PROFILE_NAME(785, cvxPartSmdBendTaperDefDataInit)
+CALL_PROFILE_NAME(786, cvxPartSmdBendTaperInit)
+CALL_PROFILE_NAME(787, cvxPartSmdBendTaper)
+CALL_PROFILE_NAME(788, cvxPartSmdNormalCutinit)
+CALL_PROFILE_NAME(789, cvxPartSmdNormalCut)
+CALL_PROFILE_NAME(790, cvxPartSmdCloseCornerInit)
+CALL_PROFILE_NAME(791, cvxPartSmdCloseCorner)
+CALL_PROFILE_NAME(792, cvxPartSmdDimpleInit)
+CALL_PROFILE_NAME(793, cvxPartSmdDimple)
+CALL_PROFILE_NAME(794, cvxPartSmdLouverInit)
+CALL_PROFILE_NAME(795, cvxPartSmdLouver)
+CALL_PROFILE_NAME(796, cvxPartSmdPunchInit)
+CALL_PROFILE_NAME(797, cvxPartSmdPunch)
+CALL_PROFILE_NAME(798, cvxPartSmdFold)
+CALL_PROFILE_NAME(799, cvxPartSmdUnfold)
+CALL_PROFILE_NAME(800, cvxPartSmdFlattenInit)
+CALL_PROFILE_NAME(801, cvxPartSmdFlatten)
+CALL_PROFILE_NAME(802, cvxPartSmdLnUnfoldInit)
+CALL_PROFILE_NAME(803, cvxPartSmdLnUnfold)
+CALL_PROFILE_NAME(804, cvxPartSmdChangeBendInit)
+CALL_PROFILE_NAME(805, cvxPartSmdChangeBend)
+CALL_PROFILE_NAME(806, cvxPartSmdRipInit)
+CALL_PROFILE_NAME(807, cvxPartSmdRip)
+CALL_PROFILE_NAME(808, cvxPartSmdMarkBendInit)
+CALL_PROFILE_NAME(809, cvxPartSmdMarkBend)
+CALL_PROFILE_NAME(810, cvxSkNestingProfileDataInit)
+CALL_PROFILE_NAME(811, cvxSkNestingBlankDataInit)
+CALL_PROFILE_NAME(812, cvxSkNestingInit)
+CALL_PROFILE_NAME(813, cvxSkNesting)
+CALL_PROFILE_NAME(814, cvxSkLine2pt)
+CALL_PROFILE_NAME(815, cvxSkAddPolyline)
+CALL_PROFILE_NAME(816, cvxSkAxis)
+CALL_PROFILE_NAME(817, cvxSkCir3pt)
+CALL_PROFILE_NAME(818, cvxSkCirRad)
+CALL_PROFILE_NAME(819, cvxSkArc3pt)
+CALL_PROFILE_NAME(820, cvxSkArcRad)
+CALL_PROFILE_NAME(821, cvxSkEllipseInit)
+CALL_PROFILE_NAME(822, cvxSkEllipse)
+CALL_PROFILE_NAME(823, cvxSkPnt)
+CALL_PROFILE_NAME(824, cvxSkPntsOnCrv)
+CALL_PROFILE_NAME(825, cvxSkReadyTextInit)
+CALL_PROFILE_NAME(826, cvxSkReadyText)
+CALL_PROFILE_NAME(827, cvxEntTextNew)
+CALL_PROFILE_NAME(828, cvxSkNgonsInit)
+CALL_PROFILE_NAME(829, cvxSkNgons)
+CALL_PROFILE_NAME(830, cvxSkCrvIntInit)
+CALL_PROFILE_NAME(831, cvxSkCrvIntScaleInit)
+CALL_PROFILE_NAME(832, cvxSkCrvInt)
+CALL_PROFILE_NAME(833, cvxSkSplineInit)
+CALL_PROFILE_NAME(834, cvxSkSpline)
+CALL_PROFILE_NAME(835, cvxSkConic3pt)
+CALL_PROFILE_NAME(836, cvxSkConic3ptInit)
+CALL_PROFILE_NAME(837, cvxSkFilletInit)
+CALL_PROFILE_NAME(838, cvxSkFillet)
+CALL_PROFILE_NAME(839, cvxSkChamferInit)
+CALL_PROFILE_NAME(840, cvxSkChamfer)
+CALL_PROFILE_NAME(841, cvxSkPowerTrim)
+CALL_PROFILE_NAME(842, cvxSkOneTouchTrim)
+CALL_PROFILE_NAME(843, cvxSkTrimExtInit)
+CALL_PROFILE_NAME(844, cvxSkTrimExt)
+CALL_PROFILE_NAME(845, cvxSkTrimSplitInit)
+CALL_PROFILE_NAME(846, cvxSkTrimSplitCrv)
+CALL_PROFILE_NAME(847, cvxSkTrimSplitPnt)
+CALL_PROFILE_NAME(848, cvxSkTrimSplitCorInit)
+CALL_PROFILE_NAME(849, cvxSkTrimSplitCor)
+CALL_PROFILE_NAME(850, cvxSkDelBowties)
+CALL_PROFILE_NAME(851, cvxSkSplitIsectInit)
+CALL_PROFILE_NAME(852, cvxSkSplitIsect)
+CALL_PROFILE_NAME(853, cvxSkAutoCons)
+CALL_PROFILE_NAME(854, cvxSkAddGeomCons)
+CALL_PROFILE_NAME(855, cvxSkAutoAddCoinCons)
+CALL_PROFILE_NAME(856, cvxSkAutoAddCoinConsSkipRefGeom)
+CALL_PROFILE_NAME(857, cvxSkAddConsDim)
+CALL_PROFILE_NAME(858, cvxSkAddPerimeterDim)
+CALL_PROFILE_NAME(859, cvxSkReferenceInit)
+CALL_PROFILE_NAME(860, cvxSkReference)
+CALL_PROFILE_NAME(861, cvxSkMoveInit)
+CALL_PROFILE_NAME(862, cvxSkMove)
+CALL_PROFILE_NAME(863, cvxSkRotate)
+CALL_PROFILE_NAME(864, cvxSkRotateInit)
+CALL_PROFILE_NAME(865, cvxSkMirr)
+CALL_PROFILE_NAME(866, cvxSkMirrInit)
+CALL_PROFILE_NAME(867, cvxSkScale)
+CALL_PROFILE_NAME(868, cvxSkPtnDataInit)
+CALL_PROFILE_NAME(869, cvxSkPattern)
+CALL_PROFILE_NAME(870, cvxSkCopyInit)
+CALL_PROFILE_NAME(871, cvxSkCopy)
+CALL_PROFILE_NAME(872, cvxPartSkIns)
+CALL_PROFILE_NAME(873, cvxPartSkIns2)
+CALL_PROFILE_NAME(874, cvxPartSkNew)
+CALL_PROFILE_NAME(875, cvxPartSkPlane)
+CALL_PROFILE_NAME(876, cvxHatchPtnDataInit)
+CALL_PROFILE_NAME(877, cvxPartCosSkPlane)
+CALL_PROFILE_NAME(878, cvxPartPntByOffsetInit)
+CALL_PROFILE_NAME(879, cvxPartPntBy2LinesInit)
+CALL_PROFILE_NAME(880, cvxPartUDFInit)
+CALL_PROFILE_NAME(881, cvxPartUDFInqFlds)
+CALL_PROFILE_NAME(882, cvxPartUDFTerm)
+CALL_PROFILE_NAME(883, cvxPartUDFExplode)
+CALL_PROFILE_NAME(884, cvxPartUDFInqPath)
+CALL_PROFILE_NAME(885, cvxPartUDFInqLongPath)
+CALL_PROFILE_NAME(886, cvxPartUDFInqSubFtrs)
+CALL_PROFILE_NAME(887, cvxPartFtrIsUDF)
+CALL_PROFILE_NAME(888, cvxPartUDFReplace)
+CALL_PROFILE_NAME(889, cvxPartUDFWizardPathSet)
+CALL_PROFILE_NAME(890, cvxPartUDFInsPathSet)
+CALL_PROFILE_NAME(891, cvxPartUDFWizardPathGet)
+CALL_PROFILE_NAME(892, cvxPartUDFWizardPathGetByLongPath)
+CALL_PROFILE_NAME(893, cvxPartUDFInsPathGet)
+CALL_PROFILE_NAME(894, cvxPartUDFInsPathGetByLongPath)
+CALL_PROFILE_NAME(895, cvxPartPnt)
+CALL_PROFILE_NAME(896, cvxPartPntNew)
+CALL_PROFILE_NAME(897, cvxPartPnts)
+CALL_PROFILE_NAME(898, cvxPartPntsOnCrv)
+CALL_PROFILE_NAME(899, cvxPartLine2pt)
+CALL_PROFILE_NAME(900, cvxPartLineInit)
+CALL_PROFILE_NAME(901, cvxPartLine)
+CALL_PROFILE_NAME(902, cvxPartPolylineInit)
+CALL_PROFILE_NAME(903, cvxPartPolyLine)
+CALL_PROFILE_NAME(904, cvxPartArc3pt)
+CALL_PROFILE_NAME(905, cvxPartArcRad)
+CALL_PROFILE_NAME(906, cvxPartArcInit)
+CALL_PROFILE_NAME(907, cvxPartArc)
+CALL_PROFILE_NAME(908, cvxPartCircleInit)
+CALL_PROFILE_NAME(909, cvxPartCircle)
+CALL_PROFILE_NAME(910, cvxPartRectangleInit)
+CALL_PROFILE_NAME(911, cvxPartRectangle)
+CALL_PROFILE_NAME(912, cvxPartCir3pt)
+CALL_PROFILE_NAME(913, cvxPartCirRad)
+CALL_PROFILE_NAME(914, cvxPartEllipseInit)
+CALL_PROFILE_NAME(915, cvxPartEllipse)
+CALL_PROFILE_NAME(916, cvxPartCrvIntInit)
+CALL_PROFILE_NAME(917, cvxPartCrvIntScaleInit)
+CALL_PROFILE_NAME(918, cvxPartCrvInt)
+CALL_PROFILE_NAME(919, cvxPartSplineInit)
+CALL_PROFILE_NAME(920, cvxSplinePntInit)
+CALL_PROFILE_NAME(921, cvxPartSpline)
+CALL_PROFILE_NAME(922, cvxPartCrvProjToFaceInit)
+CALL_PROFILE_NAME(923, cvxPartCrvProjToFace)
+CALL_PROFILE_NAME(924, cvxPartInterXCurveInit)
+CALL_PROFILE_NAME(925, cvxPartInterXCurve)
+CALL_PROFILE_NAME(926, cvxPartCrvOnFaceThruPtsInit)
+CALL_PROFILE_NAME(927, cvxPartCrvOnFaceThruPts)
+CALL_PROFILE_NAME(928, cvxPartIsoCurveOnFaceInit)
+CALL_PROFILE_NAME(929, cvxPartIsoCurveOnFace)
+CALL_PROFILE_NAME(930, cvxPartIsoclineCurveInit)
+CALL_PROFILE_NAME(931, cvxPartIsoclineCurve)
+CALL_PROFILE_NAME(932, cvxPartFaceCurve)
+CALL_PROFILE_NAME(933, cvxPartCombinedProj)
+CALL_PROFILE_NAME(934, cvxPartExtractCenterlines)
+CALL_PROFILE_NAME(935, cvxPartBlendCrvsConsInit)
+CALL_PROFILE_NAME(936, cvxPartBlendCrvsInit)
+CALL_PROFILE_NAME(937, cvxPartBlendCrvs)
+CALL_PROFILE_NAME(938, cvxPartCurveOffset)
+CALL_PROFILE_NAME(939, cvxPartSpiralCurve)
+CALL_PROFILE_NAME(940, cvxPartCrvList)
+CALL_PROFILE_NAME(941, cvxPartCurve)
+CALL_PROFILE_NAME(942, cvxPartCurveSilh)
+CALL_PROFILE_NAME(943, cvxPartFittingCrv)
+CALL_PROFILE_NAME(944, cvxPartCrvFilletInit)
+CALL_PROFILE_NAME(945, cvxPartCrvFillet)
+CALL_PROFILE_NAME(946, cvxPartCrvFilletChainInit)
+CALL_PROFILE_NAME(947, cvxPartCrvFilletChain)
+CALL_PROFILE_NAME(948, cvxPartCrvChamferInit)
+CALL_PROFILE_NAME(949, cvxPartCrvChamfer)
+CALL_PROFILE_NAME(950, cvxPartCrvChamferChainInit)
+CALL_PROFILE_NAME(951, cvxPartCrvChamferChain)
+CALL_PROFILE_NAME(952, cvxPartCrvTrimToFaces)
+CALL_PROFILE_NAME(953, cvxPartCrvSplitAtPnts)
+CALL_PROFILE_NAME(954, cvxPartInqReversedCurve)
+CALL_PROFILE_NAME(955, cvxPartCrvTrimWithCrv)
+CALL_PROFILE_NAME(956, cvxPartConcentricArc)
+CALL_PROFILE_NAME(957, cvxPartCrvConvertToArcsInit)
+CALL_PROFILE_NAME(958, cvxPartCrvConvertToArcs)
+CALL_PROFILE_NAME(959, ZwCommandPost)
+CALL_PROFILE_NAME(960, ZwCommandPostExecuteAll)
+CALL_PROFILE_NAME(961, ZwCommandSend)
+CALL_PROFILE_NAME(962, ZwCommandLicenseCheck)
+CALL_PROFILE_NAME(963, ZwCommandReactorSet)
+CALL_PROFILE_NAME(964, ZwCommandFunctionLoad)
+CALL_PROFILE_NAME(965, ZwCommandCallbackLoad)
+CALL_PROFILE_NAME(966, ZwCommandFunctionUnload)
+CALL_PROFILE_NAME(967, ZwCommandVariableLoad)
+CALL_PROFILE_NAME(968, ZwCommandVariableUnload)
+CALL_PROFILE_NAME(969, ZwCommandMacroExecute)
+CALL_PROFILE_NAME(970, ZwCommandMacroPathGet)
+CALL_PROFILE_NAME(971, ZwComponentActivate)
+CALL_PROFILE_NAME(972, ZwComponentFileAndRootGet)
+CALL_PROFILE_NAME(973, ZwComponentListGet)
+CALL_PROFILE_NAME(974, ZwComponentFileLostCheck)
+CALL_PROFILE_NAME(975, ZwComponentUnplacedCheck)
+CALL_PROFILE_NAME(976, ZwComponentVisibilityGet)
+CALL_PROFILE_NAME(977, ZwComponentVisibilitySet)
+CALL_PROFILE_NAME(978, ZwComponentPackedGet)
+CALL_PROFILE_NAME(979, ZwComponentPackedSet)
+CALL_PROFILE_NAME(980, ZwComponentPathAndRootListGet)
+CALL_PROFILE_NAME(981, ZwComponentInsertInit)
+CALL_PROFILE_NAME(982, ZwComponentInsert)
+CALL_PROFILE_NAME(983, ZwComponentInsertNewInit)
+CALL_PROFILE_NAME(984, ZwComponentRelationDissolve)
+CALL_PROFILE_NAME(985, ZwComponentInsertNew)
+CALL_PROFILE_NAME(986, ZwComponentFileSet)
+CALL_PROFILE_NAME(987, ZwComponentFileSaveAs)
+CALL_PROFILE_NAME(988, ZwComponentFixSet)
+CALL_PROFILE_NAME(989, ZwComponentGetByMergeShape)
+CALL_PROFILE_NAME(990, ZwComponentShapeInterferenceCheck)
+CALL_PROFILE_NAME(991, ZwComponentInterferenceCheck)
+CALL_PROFILE_NAME(992, ZwComponentInterferenceFree)
+CALL_PROFILE_NAME(993, ZwComponentFolderCreate)
+CALL_PROFILE_NAME(994, ZwComponentFolderInsert)
+CALL_PROFILE_NAME(995, ZwComponentFolderListGet)
+CALL_PROFILE_NAME(996, ZwComponentFolderParentComponentGet)
+CALL_PROFILE_NAME(997, ZwComponentFolderDelete)
+CALL_PROFILE_NAME(998, cvxConfigGetColor)
+CALL_PROFILE_NAME(999, cvxConfigGetInteger)
+CALL_PROFILE_NAME(1000, cvxConfigGetNumber)
+CALL_PROFILE_NAME(1001, cvxConfigGetOption)
+CALL_PROFILE_NAME(1002, cvxConfigGetRgb)
+CALL_PROFILE_NAME(1003, cvxConfigGetString)
+CALL_PROFILE_NAME(1004, cvxConfigGetYesNo)
+CALL_PROFILE_NAME(1005, cvxConfigPathGet)
+CALL_PROFILE_NAME(1006, cvxConfigSetColor)
+CALL_PROFILE_NAME(1007, cvxConfigSetInteger)
+CALL_PROFILE_NAME(1008, cvxConfigSetNumber)
+CALL_PROFILE_NAME(1009, cvxConfigSetOption)
+CALL_PROFILE_NAME(1010, cvxConfigSetRgb)
+CALL_PROFILE_NAME(1011, cvxConfigSetString)
+CALL_PROFILE_NAME(1012, cvxConfigSetYesNo)
+CALL_PROFILE_NAME(1013, ZwConfigActiveGet)
+CALL_PROFILE_NAME(1014, ZwConfigListGet)
+CALL_PROFILE_NAME(1015, ZwComponentConfigListGet)
+CALL_PROFILE_NAME(1016, ZwComponentConfigGet)
+CALL_PROFILE_NAME(1017, ZwComponentConfigSet)
+CALL_PROFILE_NAME(1018, ZwConfigActivate)
+CALL_PROFILE_NAME(1019, ZwConfigTableRefresh)
+CALL_PROFILE_NAME(1020, ZwCurveDataTransform)
+CALL_PROFILE_NAME(1021, ZwCurveLineCheck)
+CALL_PROFILE_NAME(1022, ZwCurvePointGetByLengthFraction)
+CALL_PROFILE_NAME(1023, ZwCurveClosureCheck)
+CALL_PROFILE_NAME(1024, ZwCurveExtremePointGet)
+CALL_PROFILE_NAME(1025, ZwCurveLengthGet)
+CALL_PROFILE_NAME(1026, ZwCurveSegmentLengthGet)
+CALL_PROFILE_NAME(1027, ZwCurveRadiusRangeGet)
+CALL_PROFILE_NAME(1028, ZwCurveChainGet)
+CALL_PROFILE_NAME(1029, ZwCurveProjectionPointGet)
+CALL_PROFILE_NAME(1030, ZwCurveTParameterRangeGet)
+CALL_PROFILE_NAME(1031, ZwCurveContinuityGet)
+CALL_PROFILE_NAME(1032, ZwCurveContinuityToleranceListInit)
+CALL_PROFILE_NAME(1033, ZwCurvePointGetByDistance)
+CALL_PROFILE_NAME(1034, ZwCurveInflectionPointGet)
+CALL_PROFILE_NAME(1035, ZwCurveCuspsGet)
+CALL_PROFILE_NAME(1036, ZwCurveExtremePointAndBoundingBoxGet)
+CALL_PROFILE_NAME(1037, ZwCurveCurvatureGet)
+CALL_PROFILE_NAME(1038, ZwCurveDifferentiate)
+CALL_PROFILE_NAME(1039, ZwCurveEndPointGet)
+CALL_PROFILE_NAME(1040, ZwCurveCentroidPointGet)
+CALL_PROFILE_NAME(1041, ZwCurveTessellationPointListGet)
+CALL_PROFILE_NAME(1042, ZwCurveNURBSDataGet)
+CALL_PROFILE_NAME(1043, ZwCurveFree)
+CALL_PROFILE_NAME(1044, ZwCurveListGet)
+CALL_PROFILE_NAME(1045, ZwCurveModifyTypeConvert)
+CALL_PROFILE_NAME(1046, ZwExternalFeatureFileAndRootNameGet)
+CALL_PROFILE_NAME(1047, ZwExternalPartImport)
+CALL_PROFILE_NAME(1048, ZwReferenceCreate)
+CALL_PROFILE_NAME(1049, ZwDatumAxisCreateByTwoPoints)
+CALL_PROFILE_NAME(1050, ZwDatumAxisCreateByPointAndDirection)
+CALL_PROFILE_NAME(1051, ZwDatumAxisCreateByIntersectedFaces)
+CALL_PROFILE_NAME(1052, ZwDatumAxisCreateByCurve)
+CALL_PROFILE_NAME(1053, ZwDatumAxisCreateByCenter)
+CALL_PROFILE_NAME(1054, ZwDatumAxisLengthGet)
+CALL_PROFILE_NAME(1055, ZwDatumAxisLengthSet)
+CALL_PROFILE_NAME(1056, ZwDatumAxisListGet)
+CALL_PROFILE_NAME(1057, ZwDatumAxisDirectionGet)
+CALL_PROFILE_NAME(1058, ZwDatumPlaneCreateByOffsetPlane)
+CALL_PROFILE_NAME(1059, ZwDatumPlaneCreateByThreePoints)
+CALL_PROFILE_NAME(1060, ZwDatumPlaneCreateByAngelToFace)
+CALL_PROFILE_NAME(1061, ZwDatumPlaneCreateByCurve)
+CALL_PROFILE_NAME(1062, ZwDatumPlaneCreateByDynamic)
+CALL_PROFILE_NAME(1063, ZwDatumPlaneCreateByMatrix)
+CALL_PROFILE_NAME(1064, ZwCSYSCreateByThreePointsInit)
+CALL_PROFILE_NAME(1065, ZwCSYSCreateByThreePoints)
+CALL_PROFILE_NAME(1066, ZwCSYSCreateByPointAndDirectionInit)
+CALL_PROFILE_NAME(1067, ZwCSYSCreateByPointAndDirection)
+CALL_PROFILE_NAME(1068, ZwCSYSCreateByPlaneAndDirectionInit)
+CALL_PROFILE_NAME(1069, ZwCSYSCreateByPlaneAndDirection)
+CALL_PROFILE_NAME(1070, ZwCSYSAxisGet)
+CALL_PROFILE_NAME(1071, ZwCSYSPlaneGet)
+CALL_PROFILE_NAME(1072, ZwDefaultCSYSGet)
+CALL_PROFILE_NAME(1073, ZwDatumCSYSListGet)
+CALL_PROFILE_NAME(1074, ZwActiveLCSSet)
+CALL_PROFILE_NAME(1075, ZwActiveLCSGet)
+CALL_PROFILE_NAME(1076, ZwLCSMatrixGet)
+CALL_PROFILE_NAME(1077, cvxDimInqType)
+CALL_PROFILE_NAME(1078, cvxDimInqTypeEx)
+CALL_PROFILE_NAME(1079, cvxDimIsRadius)
+CALL_PROFILE_NAME(1080, cvxDimInqState)
+CALL_PROFILE_NAME(1081, cvxDimInqDimBundles)
+CALL_PROFILE_NAME(1082, cvxDimFCSDataGet)
+CALL_PROFILE_NAME(1083, cvxDimInqVar)
+CALL_PROFILE_NAME(1084, cvxDimValMod)
+CALL_PROFILE_NAME(1085, cvxDimValModNoUpdate)
+CALL_PROFILE_NAME(1086, cvxDimInqText)
+CALL_PROFILE_NAME(1087, cvxDimModTxt)
+CALL_PROFILE_NAME(1088, cvxDimInqTextType)
+CALL_PROFILE_NAME(1089, cvxDimModTextType)
+CALL_PROFILE_NAME(1090, cvxDimInqTxtPnt)
+CALL_PROFILE_NAME(1091, cvxDimModTxtPnt)
+CALL_PROFILE_NAME(1092, cvxDimInqPos)
+CALL_PROFILE_NAME(1093, cvxDimInqDimPnts)
+CALL_PROFILE_NAME(1094, cvxDimInqDimLines)
+CALL_PROFILE_NAME(1095, cvxDimInqExtLines)
+CALL_PROFILE_NAME(1096, cvxDimAtGetBySub)
+CALL_PROFILE_NAME(1097, cvxDimDispAtGet)
+CALL_PROFILE_NAME(1098, cvxDimDispAtSet)
+CALL_PROFILE_NAME(1099, cvxDimTolAtGet)
+CALL_PROFILE_NAME(1100, cvxDimTolAtSet)
+CALL_PROFILE_NAME(1101, cvxDimLineAtGet)
+CALL_PROFILE_NAME(1102, cvxDimLineAtSet)
+CALL_PROFILE_NAME(1103, cvxDimMiscAtGet)
+CALL_PROFILE_NAME(1104, cvxDimMiscAtSet)
+CALL_PROFILE_NAME(1105, cvxDimTextAtGet)
+CALL_PROFILE_NAME(1106, cvxDimTextAtSet)
+CALL_PROFILE_NAME(1107, cvxBalloonAtGet)
+CALL_PROFILE_NAME(1108, cvxBalloonAtSet)
+CALL_PROFILE_NAME(1109, ZwDimensionTextPointGet)
+CALL_PROFILE_NAME(1110, cvxDispRedraw)
+CALL_PROFILE_NAME(1111, cvxDispDataUpdate)
+CALL_PROFILE_NAME(1112, cvxDispModeGet)
+CALL_PROFILE_NAME(1113, cvxDispModeSet)
+CALL_PROFILE_NAME(1114, cvxDispRgbGet)
+CALL_PROFILE_NAME(1115, cvxDispRgbSet)
+CALL_PROFILE_NAME(1116, cvxDispColorGet)
+CALL_PROFILE_NAME(1117, cvxDispColorSet)
+CALL_PROFILE_NAME(1118, cvxDispSwitch)
+CALL_PROFILE_NAME(1119, cvxDispSwitchGet)
+CALL_PROFILE_NAME(1120, cvxDispState)
+CALL_PROFILE_NAME(1121, cvxVisDispStatusGet)
+CALL_PROFILE_NAME(1122, cvxDispSceneUpdate)
+CALL_PROFILE_NAME(1123, cvxDispWindowRectGet)
+CALL_PROFILE_NAME(1124, cvxDispGetLights)
+CALL_PROFILE_NAME(1125, cvxDispSetLightsInit)
+CALL_PROFILE_NAME(1126, cvxDispSetLights)
+CALL_PROFILE_NAME(1127, cvxShowOpen)
+CALL_PROFILE_NAME(1128, cvxShowDisp)
+CALL_PROFILE_NAME(1129, cvxDispZoomAll)
+CALL_PROFILE_NAME(1130, cvxDispZoomAllIncludeDim)
+CALL_PROFILE_NAME(1131, cvxDispZoomAt)
+CALL_PROFILE_NAME(1132, cvxDispZoomLimits)
+CALL_PROFILE_NAME(1133, cvxDispZoomIn)
+CALL_PROFILE_NAME(1134, cvxDatumLocalVis)
+CALL_PROFILE_NAME(1135, cvxDatumDispModeSet)
+CALL_PROFILE_NAME(1136, cvxDatumDispModeGet)
+CALL_PROFILE_NAME(1137, cvxDatumDispAttrGet)
+CALL_PROFILE_NAME(1138, cvxDatumDispAttrSet)
+CALL_PROFILE_NAME(1139, cvxAxisDispModeGet)
+CALL_PROFILE_NAME(1140, cvxAxisDispModeSet)
+CALL_PROFILE_NAME(1141, ZwDisplayState)
+CALL_PROFILE_NAME(1142, ZwDrawingDimensionEntityGet)
+CALL_PROFILE_NAME(1143, ZwDrawingDimensionReferenceStateGet)
+CALL_PROFILE_NAME(1144, ZwDrawingDimensionTextPositionPointsGet)
+CALL_PROFILE_NAME(1145, ZwDrawingDimensionReferenceStateSet)
+CALL_PROFILE_NAME(1146, ZwDrawingDimensionHoleCalloutInit)
+CALL_PROFILE_NAME(1147, ZwDrawingDimensionHoleCalloutCreate)
+CALL_PROFILE_NAME(1148, ZwDrawingDimensionDatumTargetCreate)
+CALL_PROFILE_NAME(1149, ZwDrawingDimensionFeatureControlCreate)
+CALL_PROFILE_NAME(1150, ZwDrawingDimensionIntersectionSymbolCreate)
+CALL_PROFILE_NAME(1151, ZwDrawingDimensionOrdinateInit)
+CALL_PROFILE_NAME(1152, ZwDrawingDimensionOrdinateCreate)
+CALL_PROFILE_NAME(1153, ZwDrawingDimensionSymmetryInit)
+CALL_PROFILE_NAME(1154, ZwDrawingDimensionSymmetryCreate)
+CALL_PROFILE_NAME(1155, ZwDrawingDimensionAutoInit)
+CALL_PROFILE_NAME(1156, ZwDrawingDimensionAutoCreate)
+CALL_PROFILE_NAME(1157, ZwDrawingDimensionCenterLineInit)
+CALL_PROFILE_NAME(1158, ZwDrawingDimensionCenterLineCreate)
+CALL_PROFILE_NAME(1159, ZwDrawingDimensionContinuousInit)
+CALL_PROFILE_NAME(1160, ZwDrawingDimensionContinuousCreate)
+CALL_PROFILE_NAME(1161, ZwDrawingDimensionCenterMarkInit)
+CALL_PROFILE_NAME(1162, ZwDrawingDimensionCenterMarkCreate)
+CALL_PROFILE_NAME(1163, ZwDrawingDimensionLabelInit)
+CALL_PROFILE_NAME(1164, ZwDrawingDimensionLabelCreate)
+CALL_PROFILE_NAME(1165, ZwDrawingAutoBalloonInit)
+CALL_PROFILE_NAME(1166, ZwDrawingAutoBalloonCreate)
+CALL_PROFILE_NAME(1167, ZwDrawingDimensionLinearChamferInit)
+CALL_PROFILE_NAME(1168, ZwDrawingDimensionLinearChamferCreate)
+CALL_PROFILE_NAME(1169, ZwDrawingDimensionLinearCreate)
+CALL_PROFILE_NAME(1170, ZwDrawingDimensionLinearOffsetCreate)
+CALL_PROFILE_NAME(1171, ZwDrawingDimensionRadialCreate)
+CALL_PROFILE_NAME(1172, ZwDrawingDimensionAngularCreate)
+CALL_PROFILE_NAME(1173, ZwDrawingDimensionArcCreate)
+CALL_PROFILE_NAME(1174, ZwDrawingDimensionBalloonCreate)
+CALL_PROFILE_NAME(1175, ZwDrawingDimensionLabelCoordinateCreate)
+CALL_PROFILE_NAME(1176, ZwDrawingDimensionDatumFeatureCreate)
+CALL_PROFILE_NAME(1177, ZwDrawingDimensionBaseLineCreate)
+CALL_PROFILE_NAME(1178, ZwDrawingDimensionCenterMarkCircleCreate)
+CALL_PROFILE_NAME(1179, ZwDrawingGeometryParentViewGet)
+CALL_PROFILE_NAME(1180, ZwDrawingHatchAssociateCurveListGet)
+CALL_PROFILE_NAME(1181, ZwDrawingHatchAttributeSet)
+CALL_PROFILE_NAME(1182, ZwDrawingHatchAttributeGet)
+CALL_PROFILE_NAME(1183, ZwDrawingBreakLineAttributeSet)
+CALL_PROFILE_NAME(1184, ZwDrawingBreakLineAttributeGet)
+CALL_PROFILE_NAME(1185, ZwDrawingEntityComponentGet)
+CALL_PROFILE_NAME(1186, ZwDrawingDiscreteEntityGet)
+CALL_PROFILE_NAME(1187, ZwDrawingRegen)
+CALL_PROFILE_NAME(1188, ZwDrawingSheetActivate)
+CALL_PROFILE_NAME(1189, ZwDrawingSheetActivateByHandle)
+CALL_PROFILE_NAME(1190, ZwDrawingSheetListGet)
+CALL_PROFILE_NAME(1191, ZwDrawingSheetDimensionListGet)
+CALL_PROFILE_NAME(1192, ZwDrawingSheetViewListGet)
+CALL_PROFILE_NAME(1193, ZwDrawingSheetModifiedStateCheck)
+CALL_PROFILE_NAME(1194, ZwDrawingSymbolHoleMarkInit)
+CALL_PROFILE_NAME(1195, ZwDrawingSymbolHoleMarkCreate)
+CALL_PROFILE_NAME(1196, ZwDrawingSymbolOLEObjectCreate)
+CALL_PROFILE_NAME(1197, ZwDrawingSymbolOLEObjectDataGet)
+CALL_PROFILE_NAME(1198, ZwDrawingSymbolOLEObjectExport)
+CALL_PROFILE_NAME(1199, ZwDrawingSymbolWeldInit)
+CALL_PROFILE_NAME(1200, ZwDrawingSymbolWeldCreate)
+CALL_PROFILE_NAME(1201, ZwDrawingSymbolWeldFree)
+CALL_PROFILE_NAME(1202, ZwDrawingSymbolSurfaceFinishInit)
+CALL_PROFILE_NAME(1203, ZwDrawingSymbolSurfaceFinishCreate)
+CALL_PROFILE_NAME(1204, ZwDrawingSymbolWeldDataGet)
+CALL_PROFILE_NAME(1205, ZwDrawingSymbolWeldDataSet)
+CALL_PROFILE_NAME(1206, ZwDrawingTableBOMInit)
+CALL_PROFILE_NAME(1207, ZwDrawingTableBOMCreate)
+CALL_PROFILE_NAME(1208, ZwDrawingTableAnnotationInit)
+CALL_PROFILE_NAME(1209, ZwDrawingTableAnnotationCreate)
+CALL_PROFILE_NAME(1210, ZwDrawingTableBOMReferenceViewGet)
+CALL_PROFILE_NAME(1211, ZwDrawingViewAlignedSectionCreateInit)
+CALL_PROFILE_NAME(1212, ZwDrawingViewAlignedSectionCreate)
+CALL_PROFILE_NAME(1213, ZwDrawingViewAuxiliaryCreateInit)
+CALL_PROFILE_NAME(1214, ZwDrawingViewAuxiliaryCreate)
+CALL_PROFILE_NAME(1215, ZwDrawingViewBreakLineCreateInit)
+CALL_PROFILE_NAME(1216, ZwDrawingViewBreakLineCreate)
+CALL_PROFILE_NAME(1217, ZwDrawingViewDetailCreateInit)
+CALL_PROFILE_NAME(1218, ZwDrawingViewDetailCreate)
+CALL_PROFILE_NAME(1219, ZwDrawingViewBrokenSectionCreateInit)
+CALL_PROFILE_NAME(1220, ZwDrawingViewBrokenSectionCreate)
+CALL_PROFILE_NAME(1221, ZwDrawingViewFullSectionCreateInit)
+CALL_PROFILE_NAME(1222, ZwDrawingViewFullSectionCreate)
+CALL_PROFILE_NAME(1223, ZwDrawingViewDottedBorderGet)
+CALL_PROFILE_NAME(1224, ZwDrawingViewGeometryReferenceEntityGet)
+CALL_PROFILE_NAME(1225, ZwDrawingViewGeometryListGet)
+CALL_PROFILE_NAME(1226, ZwDrawingViewEntityAssociate)
+CALL_PROFILE_NAME(1227, ZwDrawingViewChildViewListGet)
+CALL_PROFILE_NAME(1228, ZwDrawingViewAttributeGet)
+CALL_PROFILE_NAME(1229, ZwDrawingViewAttributeSet)
+CALL_PROFILE_NAME(1230, ZwDrawingViewProjectionInit)
+CALL_PROFILE_NAME(1231, ZwDrawingViewProjection)
+CALL_PROFILE_NAME(1232, ZwDrawingViewStandardDataInit)
+CALL_PROFILE_NAME(1233, ZwDrawingViewStandardCreate)
+CALL_PROFILE_NAME(1234, ZwDrawingViewReferenceBlankGet)
+CALL_PROFILE_NAME(1235, ZwDrawingViewReferenceBlankSet)
+CALL_PROFILE_NAME(1236, ZwDrawingViewReferenceAttributeGet)
+CALL_PROFILE_NAME(1237, ZwDrawingViewReferenceAttributeSet)
+CALL_PROFILE_NAME(1238, ZwDrawingRotateViewDataInit)
+CALL_PROFILE_NAME(1239, ZwDrawingViewRotate)
+CALL_PROFILE_NAME(1240, ZwDrawingViewParentViewGet)
+CALL_PROFILE_NAME(1241, ZwDrawingViewReferencePartGet)
+CALL_PROFILE_NAME(1242, ZwDrawingView3DOriginalPointGet)
+CALL_PROFILE_NAME(1243, ZwDrawingViewReferencePartConfigGet)
+CALL_PROFILE_NAME(1244, ZwDrawingViewMethodGet)
+CALL_PROFILE_NAME(1245, ZwDrawingViewReferenceGet)
+CALL_PROFILE_NAME(1246, ZwDrawingViewLocationPointGet)
+CALL_PROFILE_NAME(1247, ZwDrawingViewDimensionListGet)
+CALL_PROFILE_NAME(1248, ZwDrawingViewPoint2DTo3D)
+CALL_PROFILE_NAME(1249, ZwDrawingViewPoint3DTo2D)
+CALL_PROFILE_NAME(1250, ZwDrawingViewDiscreteProjectionWait)
+CALL_PROFILE_NAME(1251, ZwDrawingViewDiscreteProjectionGet)
+CALL_PROFILE_NAME(1252, ZwDrawingViewDiscreteProjectionSet)
+CALL_PROFILE_NAME(1253, ZwDrawingViewDiscreteProjectionQualityGet)
+CALL_PROFILE_NAME(1254, ZwDrawingViewDiscreteProjectionQualitySet)
+CALL_PROFILE_NAME(1255, ZwDrawingViewDiscreteProjectionStateGet)
+CALL_PROFILE_NAME(1256, ZwDrawingDiscreteProjectionStateCheck)
+CALL_PROFILE_NAME(1257, ZwDrawingViewAutoLoadGeometryGet)
+CALL_PROFILE_NAME(1258, ZwDrawingViewAutoLoadGeometrySet)
+CALL_PROFILE_NAME(1259, ZwDrawingViewOrientationFromParentGet)
+CALL_PROFILE_NAME(1260, ZwDrawingViewOrientationFromParentSet)
+CALL_PROFILE_NAME(1261, ZwDrawingViewTypeGet)
+CALL_PROFILE_NAME(1262, ZwDrawingViewLineAttributeGet)
+CALL_PROFILE_NAME(1263, ZwDrawingViewLineAttributeSet)
+CALL_PROFILE_NAME(1264, ZwDrawingViewLocationLockSet)
+CALL_PROFILE_NAME(1265, ZwDrawingViewLocationLockGet)
+CALL_PROFILE_NAME(1266, ZwDrawingViewEntityDisassociate)
+CALL_PROFILE_NAME(1267, ZwDrawingViewAlignmentStateGet)
+CALL_PROFILE_NAME(1268, ZwDrawingViewAlignmentStateSet)
+CALL_PROFILE_NAME(1269, ZwDrawingViewReferenceListBlankSet)
+CALL_PROFILE_NAME(1270, ZwDrawingViewProjectionTypeGet)
+CALL_PROFILE_NAME(1271, ZwDrawingCrossHatchInit)
+CALL_PROFILE_NAME(1272, ZwDrawingCrossHatchCreate)
+CALL_PROFILE_NAME(1273, cvxDwgAtGet)
+CALL_PROFILE_NAME(1274, cvxDwgAtSet)
+CALL_PROFILE_NAME(1275, cvxDwgAtItemGet)
+CALL_PROFILE_NAME(1276, cvxDwgInqDims)
+CALL_PROFILE_NAME(1277, cvxDwgInqDimEnts)
+CALL_PROFILE_NAME(1278, cvxDwgInqDimGripPnts)
+CALL_PROFILE_NAME(1279, cvxDwgGetDimTextBox)
+CALL_PROFILE_NAME(1280, cvxDwgInqDimByView)
+CALL_PROFILE_NAME(1281, cvxDwgInqDimByDrawing)
+CALL_PROFILE_NAME(1282, cvxDwgInqBundleDataByDim)
+CALL_PROFILE_NAME(1283, cvxDwgDimAtGet)
+CALL_PROFILE_NAME(1284, cvxDwgDimAtSet)
+CALL_PROFILE_NAME(1285, cvxDwgSheetAdd)
+CALL_PROFILE_NAME(1286, cvxDwgSheetDel)
+CALL_PROFILE_NAME(1287, cvxDwgSheetScaleGet)
+CALL_PROFILE_NAME(1288, cvxDwgSheetScaleSet)
+CALL_PROFILE_NAME(1289, cvxDwgInqList)
+CALL_PROFILE_NAME(1290, cvxDwgInqName)
+CALL_PROFILE_NAME(1291, cvxDwgFind)
+CALL_PROFILE_NAME(1292, cvxDwgInqBorderTitle)
+CALL_PROFILE_NAME(1293, cvxDwgInqPart)
+CALL_PROFILE_NAME(1294, cvxDwgSetRefPart)
+CALL_PROFILE_NAME(1295, cvxDwgActivate)
+CALL_PROFILE_NAME(1296, cvxDwgInqActive)
+CALL_PROFILE_NAME(1297, cvxDwgRegen)
+CALL_PROFILE_NAME(1298, cvxDwgStyleManagerWithTextAtGet)
+CALL_PROFILE_NAME(1299, cvxDwgInqGeom)
+CALL_PROFILE_NAME(1300, cvxDwgInqText)
+CALL_PROFILE_NAME(1301, cvxDwgInqHatchAttr)
+CALL_PROFILE_NAME(1302, cvxDwgHatchAttrSet)
+CALL_PROFILE_NAME(1303, cvxDwgHatchAssoCrvsGet)
+CALL_PROFILE_NAME(1304, cvxDwgInqHatchIdByView)
+CALL_PROFILE_NAME(1305, cvxDwgInqHatchIdByDrawing)
+CALL_PROFILE_NAME(1306, cvxDwgRefEntDataGet)
+CALL_PROFILE_NAME(1307, cvxDwgGeomGetView)
+CALL_PROFILE_NAME(1308, cvxDwgViewGeomInqList)
+CALL_PROFILE_NAME(1309, cvxDwgViewGeomGetShapeId)
+CALL_PROFILE_NAME(1310, cvxDwgViewRefCompVisSet)
+CALL_PROFILE_NAME(1311, cvxDwgViewInqRefEnts)
+CALL_PROFILE_NAME(1312, cvxDwgViewRefBlankGet)
+CALL_PROFILE_NAME(1313, cvxDwgViewRefBlankSet)
+CALL_PROFILE_NAME(1314, cvxDwgViewRefEntAtGet)
+CALL_PROFILE_NAME(1315, cvxDwgViewRefEntAtSet)
+CALL_PROFILE_NAME(1316, cvxDwgViewPnt2DTo3D)
+CALL_PROFILE_NAME(1317, cvxDwgViewPnt3DTo2D)
+CALL_PROFILE_NAME(1318, cvxShtInqSymbol)
+CALL_PROFILE_NAME(1319, cvxDwgInqSymObjList)
+CALL_PROFILE_NAME(1320, cvxDwgInqSymType)
+CALL_PROFILE_NAME(1321, cvxDwgInqSymEnts)
+CALL_PROFILE_NAME(1322, cvxDwgSymAtGet)
+CALL_PROFILE_NAME(1323, cvxDwgSymAtSet)
+CALL_PROFILE_NAME(1324, cvxDwgSymImgAtGet)
+CALL_PROFILE_NAME(1325, cvxDwgSymImgAtSet)
+CALL_PROFILE_NAME(1326, cvxDwgSymSurfDataGet)
+CALL_PROFILE_NAME(1327, cvxDwgSymSurfDataSet)
+CALL_PROFILE_NAME(1328, cvxDwgSymWeldDataGet)
+CALL_PROFILE_NAME(1329, cvxDwgSymWeldDataSet)
+CALL_PROFILE_NAME(1330, cvxSymWeldFree)
+CALL_PROFILE_NAME(1331, cvxDwgUserSymObjGet)
+CALL_PROFILE_NAME(1332, cvxDwgSymInsPointGet)
+CALL_PROFILE_NAME(1333, cvxDwgSymInsPointSet)
+CALL_PROFILE_NAME(1334, cvxDwgSymLinkGet)
+CALL_PROFILE_NAME(1335, cvxDwgSymLinkGetByLongPath)
+CALL_PROFILE_NAME(1336, cvxDwgSymLinkExport)
+CALL_PROFILE_NAME(1337, cvxDwgSymLinkExportByLongPath)
+CALL_PROFILE_NAME(1338, cvxDwgInqTables)
+CALL_PROFILE_NAME(1339, cvxDwgInqTableType)
+CALL_PROFILE_NAME(1340, cvxDwgTableAtGet)
+CALL_PROFILE_NAME(1341, cvxDwgTableAtSet)
+CALL_PROFILE_NAME(1342, cvxDwgGetTableSize)
+CALL_PROFILE_NAME(1343, cvxDwgTableAdjustSize)
+CALL_PROFILE_NAME(1344, cvxDwgTableInsPntSet)
+CALL_PROFILE_NAME(1345, cvxDwgTableInsPntGet)
+CALL_PROFILE_NAME(1346, cvxDwgTableExport)
+CALL_PROFILE_NAME(1347, cvxDwgTableLinkToExcel)
+CALL_PROFILE_NAME(1348, cvxDwgTableRowHeightGet)
+CALL_PROFILE_NAME(1349, cvxDwgTableRowHeightSet)
+CALL_PROFILE_NAME(1350, cvxDwgTableRowInsert)
+CALL_PROFILE_NAME(1351, cvxDwgTableRowDelete)
+CALL_PROFILE_NAME(1352, cvxDwgTableColWidthGet)
+CALL_PROFILE_NAME(1353, cvxDwgTableColWidthSet)
+CALL_PROFILE_NAME(1354, cvxDwgTableColInsert)
+CALL_PROFILE_NAME(1355, cvxDwgTableColDelete)
+CALL_PROFILE_NAME(1356, cvxDwgTableCellAtGet)
+CALL_PROFILE_NAME(1357, cvxDwgTableCellAtSet)
+CALL_PROFILE_NAME(1358, cvxDwgTableCellSet)
+CALL_PROFILE_NAME(1359, cvxDwgTableCellGet)
+CALL_PROFILE_NAME(1360, cvxDwgTableCellsMerge)
+CALL_PROFILE_NAME(1361, cvxDwgTableCellsUnMerge)
+CALL_PROFILE_NAME(1362, cvxDwgInqViews)
+CALL_PROFILE_NAME(1363, cvxDwgInqViewMod)
+CALL_PROFILE_NAME(1364, cvxDwgInqViewType)
+CALL_PROFILE_NAME(1365, cvxDwgInqViewTypeEx)
+CALL_PROFILE_NAME(1366, cvxDwgViewAtGet)
+CALL_PROFILE_NAME(1367, cvxDwgViewAtSet)
+CALL_PROFILE_NAME(1368, cvxDwgViewLockSet)
+CALL_PROFILE_NAME(1369, cvxDwgViewLockGet)
+CALL_PROFILE_NAME(1370, cvxDwgViewDottedBorderGet)
+CALL_PROFILE_NAME(1371, cvxDwgViewInqPart)
+CALL_PROFILE_NAME(1372, cvxDwgViewInqPartConfig)
+CALL_PROFILE_NAME(1373, cvxDwgViewInqPartConfigByLongName)
+CALL_PROFILE_NAME(1374, cvxDwgViewInqChildView)
+CALL_PROFILE_NAME(1375, cvxDwgViewInqParentView)
+CALL_PROFILE_NAME(1376, cvxDwgViewEntitiesAssociate)
+CALL_PROFILE_NAME(1377, cvxDwgViewInqProjection)
+CALL_PROFILE_NAME(1378, cvxDwgViewLocationGet)
+CALL_PROFILE_NAME(1379, cvxDwgAlignmentGet)
+CALL_PROFILE_NAME(1380, cvxDwgViewInqOrgPnt)
+CALL_PROFILE_NAME(1381, cvxDwgBrkLineAtSet)
+CALL_PROFILE_NAME(1382, cvxDwgBrkLineAtGet)
+CALL_PROFILE_NAME(1383, ZwEdgeTypeGet)
+CALL_PROFILE_NAME(1384, ZwEdgeFaceListGet)
+CALL_PROFILE_NAME(1385, ZwEdgeCurveGet)
+CALL_PROFILE_NAME(1386, ZwEdgeNURBSDataGet)
+CALL_PROFILE_NAME(1387, ZwEdgeDiscreteDataGet)
+CALL_PROFILE_NAME(1388, ZwEdgeDiscreteDataFree)
+CALL_PROFILE_NAME(1389, ZwEntityCreateGet)
+CALL_PROFILE_NAME(1390, ZwEntityCreateListGet)
+CALL_PROFILE_NAME(1391, ZwEntityCreateGetAll)
+CALL_PROFILE_NAME(1392, ZwEntityGetByPick)
+CALL_PROFILE_NAME(1393, ZwEntityGetByPickWithMultipleFilter)
+CALL_PROFILE_NAME(1394, ZwEntityListGetByPick)
+CALL_PROFILE_NAME(1395, ZwEntityListGetByPickWithMultipleFilter)
+CALL_PROFILE_NAME(1396, ZwEntityGetByPoint)
+CALL_PROFILE_NAME(1397, ZwEntityGetByNameAndType)
+CALL_PROFILE_NAME(1398, ZwEntityGetByCurrentView)
+CALL_PROFILE_NAME(1399, ZwEntityActiveGet)
+CALL_PROFILE_NAME(1400, ZwEntityActivate)
+CALL_PROFILE_NAME(1401, ZwEntityDelete)
+CALL_PROFILE_NAME(1402, ZwEntityErase)
+CALL_PROFILE_NAME(1403, ZwEntityListDelete)
+CALL_PROFILE_NAME(1404, ZwEntityListErase)
+CALL_PROFILE_NAME(1405, ZwEntityBlankSet)
+CALL_PROFILE_NAME(1406, ZwEntityBlankGet)
+CALL_PROFILE_NAME(1407, ZwEntityExistenceCheck)
+CALL_PROFILE_NAME(1408, ZwEntitySuppressGet)
+CALL_PROFILE_NAME(1409, ZwEntityFrontPickStateSet)
+CALL_PROFILE_NAME(1410, ZwEntityFrontPickStateGet)
+CALL_PROFILE_NAME(1411, ZwEntityPickListGet)
+CALL_PROFILE_NAME(1412, ZwEntityUnPickAll)
+CALL_PROFILE_NAME(1413, ZwEntityUnPickLast)
+CALL_PROFILE_NAME(1414, ZwEntityUnPick)
+CALL_PROFILE_NAME(1415, ZwEntityPickListAdd)
+CALL_PROFILE_NAME(1416, ZwEntityColorGet)
+CALL_PROFILE_NAME(1417, ZwEntityColorSet)
+CALL_PROFILE_NAME(1418, ZwEntityColorRgbGet)
+CALL_PROFILE_NAME(1419, ZwEntityColorRgbSet)
+CALL_PROFILE_NAME(1420, ZwEntityTemporaryColorRgbSet)
+CALL_PROFILE_NAME(1421, ZwEntityTransparencySet)
+CALL_PROFILE_NAME(1422, ZwEntityTransparencyGet)
+CALL_PROFILE_NAME(1423, ZwEntityHighlightWithColor)
+CALL_PROFILE_NAME(1424, ZwEntityUnhighlightAll)
+CALL_PROFILE_NAME(1425, ZwEntityHighlight)
+CALL_PROFILE_NAME(1426, ZwEntityUnHighlight)
+CALL_PROFILE_NAME(1427, ZwLineAttributeGet)
+CALL_PROFILE_NAME(1428, ZwLineAttributeSet)
+CALL_PROFILE_NAME(1429, ZwEntityCriticalPointCheck)
+CALL_PROFILE_NAME(1430, ZwEntityCurveCheck)
+CALL_PROFILE_NAME(1431, ZwEntityElectrodeCheck)
+CALL_PROFILE_NAME(1432, ZwEntityProjectionPointGet)
+CALL_PROFILE_NAME(1433, ZwEntityShapeGet)
+CALL_PROFILE_NAME(1434, ZwEntityPointMinDistanceGet)
+CALL_PROFILE_NAME(1435, ZwEntityReferenceFileNameGet)
+CALL_PROFILE_NAME(1436, ZwEntityTypeNameGet)
+CALL_PROFILE_NAME(1437, ZwEntityTypeNumberGet)
+CALL_PROFILE_NAME(1438, ZwEntityNameSet)
+CALL_PROFILE_NAME(1439, ZwEntityNameTagSet)
+CALL_PROFILE_NAME(1440, ZwEntityNameTagGet)
+CALL_PROFILE_NAME(1441, ZwEntityNameTagGetAll)
+CALL_PROFILE_NAME(1442, ZwEntityLayerGet)
+CALL_PROFILE_NAME(1443, ZwEntityMatrixGet)
+CALL_PROFILE_NAME(1444, ZwEntityTransformMatrixGet)
+CALL_PROFILE_NAME(1445, ZwEntityMatrixSet)
+CALL_PROFILE_NAME(1446, ZwEntityParentFeatureGet)
+CALL_PROFILE_NAME(1447, ZwEntityBoundingBoxGet)
+CALL_PROFILE_NAME(1448, ZwEntityCompactBoundingBoxGet)
+CALL_PROFILE_NAME(1449, ZwEntityCriticalPointInfoGet)
+CALL_PROFILE_NAME(1450, ZwEntityParentSketchGet)
+CALL_PROFILE_NAME(1451, ZwEntityParentGet)
+CALL_PROFILE_NAME(1452, ZwEntityReferenceGet)
+CALL_PROFILE_NAME(1453, ZwEntityNameGet)
+CALL_PROFILE_NAME(1454, ZwEntityIdTransfer)
+CALL_PROFILE_NAME(1455, ZwEntityPathTransfer)
+CALL_PROFILE_NAME(1456, ZwEntityHandleFree)
+CALL_PROFILE_NAME(1457, ZwEntityHandleListFree)
+CALL_PROFILE_NAME(1458, ZwEntityIdGet)
+CALL_PROFILE_NAME(1459, ZwEntityPathGet)
+CALL_PROFILE_NAME(1460, ZwEntityUniqueIdGet)
+CALL_PROFILE_NAME(1461, ZwEntityGetByUniqueId)
+CALL_PROFILE_NAME(1462, ZwEntityAutoRegen)
+CALL_PROFILE_NAME(1463, ZwEntityReferenceDrawingGeometryGetByView)
+CALL_PROFILE_NAME(1464, ZwEntityReferenceDrawingGeometryGetBySheet)
+CALL_PROFILE_NAME(1465, ZwEntityReferenceDrawingGeometryGetAll)
+CALL_PROFILE_NAME(1466, ZwEntityReferenceViewGeometryListFree)
+CALL_PROFILE_NAME(1467, ZwEntityReferenceSheetGeometryListFree)
+CALL_PROFILE_NAME(1468, ZwFaceShapeGet)
+CALL_PROFILE_NAME(1469, ZwFaceSurfaceDataGet)
+CALL_PROFILE_NAME(1470, ZwSurfaceDataFree)
+CALL_PROFILE_NAME(1471, ZwFaceEdgeListGet)
+CALL_PROFILE_NAME(1472, ZwFaceLoopListGet)
+CALL_PROFILE_NAME(1473, ZwFaceDataTransform)
+CALL_PROFILE_NAME(1474, ZwFacePoleCheck)
+CALL_PROFILE_NAME(1475, ZwFacePoleGet)
+CALL_PROFILE_NAME(1476, ZwFacePointGetByUVparameter)
+CALL_PROFILE_NAME(1477, ZwFaceDiameterGetByUVparameter)
+CALL_PROFILE_NAME(1478, ZwModelFaceSet)
+CALL_PROFILE_NAME(1479, ZwFaceConnectedFaceGet)
+CALL_PROFILE_NAME(1480, ZwFaceConnectedEdgeGet)
+CALL_PROFILE_NAME(1481, ZwModelFaceCreate)
+CALL_PROFILE_NAME(1482, ZwFaceDisplayAttributeGet)
+CALL_PROFILE_NAME(1483, ZwFaceDisplayAttributeSet)
+CALL_PROFILE_NAME(1484, ZwFaceDisplayAttributeSetInit)
+CALL_PROFILE_NAME(1485, ZwRotationalFaceAxisPointGet)
+CALL_PROFILE_NAME(1486, ZwFaceCenterCurveGet)
+CALL_PROFILE_NAME(1487, ZwFaceFacetsGet)
+CALL_PROFILE_NAME(1488, ZwFaceListFacetsGet)
+CALL_PROFILE_NAME(1489, ZwFaceFacetsDataFree)
+CALL_PROFILE_NAME(1490, ZwFaceTextureAttributeGet)
+CALL_PROFILE_NAME(1491, ZwFaceContinuityToleranceInit)
+CALL_PROFILE_NAME(1492, ZwFaceContinuityGet)
+CALL_PROFILE_NAME(1493, ZwFeatureExternalGeometryCopyInit)
+CALL_PROFILE_NAME(1494, ZwFeatureExternalGeometryCopyCreate)
+CALL_PROFILE_NAME(1495, ZwFeatureFaceOffset)
+CALL_PROFILE_NAME(1496, ZwAssemblyFeatureListGet)
+CALL_PROFILE_NAME(1497, ZwFeatureCopyWithMultiMatrix)
+CALL_PROFILE_NAME(1498, ZwFeatureListGet)
+CALL_PROFILE_NAME(1499, ZwFeatureChildEntityListGet)
+CALL_PROFILE_NAME(1500, ZwChildFeatureListGet)
+CALL_PROFILE_NAME(1501, ZwFeatureMoveDataInit)
+CALL_PROFILE_NAME(1502, ZwFeatureMoveCreate)
+CALL_PROFILE_NAME(1503, ZwFeatureMoveCreateByPointToPoint)
+CALL_PROFILE_NAME(1504, ZwFeatureMoveCreateByTransform)
+CALL_PROFILE_NAME(1505, ZwFeaturePatternParameterTableRefresh)
+CALL_PROFILE_NAME(1506, ZwFeatureExtrudeInit)
+CALL_PROFILE_NAME(1507, ZwFeatureExtrudeCreate)
+CALL_PROFILE_NAME(1508, ZwFeatureCenterBoxDataInit)
+CALL_PROFILE_NAME(1509, ZwFeatureBoxCreateByCenter)
+CALL_PROFILE_NAME(1510, ZwFeatureLoftDataInit)
+CALL_PROFILE_NAME(1511, ZwFeatureLoftCreate)
+CALL_PROFILE_NAME(1512, ZwFeatureSweptRodInit)
+CALL_PROFILE_NAME(1513, ZwFeatureSweptRodCreate)
+CALL_PROFILE_NAME(1514, ZwFeatureBoolDataInit)
+CALL_PROFILE_NAME(1515, ZwFeatureAddMultipleShapeCreate)
+CALL_PROFILE_NAME(1516, ZwFeatureAddShapeCreate)
+CALL_PROFILE_NAME(1517, ZwFeatureRemoveShapeCreate)
+CALL_PROFILE_NAME(1518, ZwFeatureIntersectShapeCreate)
+CALL_PROFILE_NAME(1519, ZwFeatureSphereDataInit)
+CALL_PROFILE_NAME(1520, ZwFeatureSphereCreate)
+CALL_PROFILE_NAME(1521, ZwFeatureStockDataInit)
+CALL_PROFILE_NAME(1522, ZwFeatureStockCreate)
+CALL_PROFILE_NAME(1523, ZwFeatureCurvelistCreate)
+CALL_PROFILE_NAME(1524, ZwFeatureSilhouetteCurves)
+CALL_PROFILE_NAME(1525, ZwFeatureLineDataInit)
+CALL_PROFILE_NAME(1526, ZwFeatureLineCreate)
+CALL_PROFILE_NAME(1527, ZwFeatureLineCreateBy2Point)
+CALL_PROFILE_NAME(1528, ZwFeaturePointsCreateByAbsolute)
+CALL_PROFILE_NAME(1529, ZwFeatureSpiralHelixCreateInit)
+CALL_PROFILE_NAME(1530, ZwFeatureSpiralHelixCreate)
+CALL_PROFILE_NAME(1531, ZwFeatureSpiralHelixFree)
+CALL_PROFILE_NAME(1532, cvxFileNameCheck)
+CALL_PROFILE_NAME(1533, cvxNameValidCheck)
+CALL_PROFILE_NAME(1534, cvxFileNew)
+CALL_PROFILE_NAME(1535, cvxFileNew2)
+CALL_PROFILE_NAME(1536, cvxFileNewSingle)
+CALL_PROFILE_NAME(1537, cvxFileKeep)
+CALL_PROFILE_NAME(1538, cvxFileOpen)
+CALL_PROFILE_NAME(1539, cvxFileReOpen)
+CALL_PROFILE_NAME(1540, cvxFileReplace)
+CALL_PROFILE_NAME(1541, cvxFileSave)
+CALL_PROFILE_NAME(1542, cvxFileSave2)
+CALL_PROFILE_NAME(1543, cvxFileSave3)
+CALL_PROFILE_NAME(1544, cvxFileSaveAll)
+CALL_PROFILE_NAME(1545, cvxFileSaveAs)
+CALL_PROFILE_NAME(1546, cvxFilesSaveTo)
+CALL_PROFILE_NAME(1547, cvxFilesSaveToByLongPath)
+CALL_PROFILE_NAME(1548, cvxCompFileSaveAs)
+CALL_PROFILE_NAME(1549, cvxFileClose)
+CALL_PROFILE_NAME(1550, cvxFileClose2)
+CALL_PROFILE_NAME(1551, cvxSessionClear)
+CALL_PROFILE_NAME(1552, cvxFileSessionClear)
+CALL_PROFILE_NAME(1553, cvxSessionSave)
+CALL_PROFILE_NAME(1554, cvxSessionRestore)
+CALL_PROFILE_NAME(1555, cvxFileImportInit)
+CALL_PROFILE_NAME(1556, cvxFileImport)
+CALL_PROFILE_NAME(1557, cvxFileImportMulti)
+CALL_PROFILE_NAME(1558, cvxFileImportMultiByLongPath)
+CALL_PROFILE_NAME(1559, cvxFileImportStl)
+CALL_PROFILE_NAME(1560, cvxFileExportInit)
+CALL_PROFILE_NAME(1561, cvxFileExport)
+CALL_PROFILE_NAME(1562, cvxFileExportMulti)
+CALL_PROFILE_NAME(1563, cvxFileExportMultiByLongPath)
+CALL_PROFILE_NAME(1564, cvxPartSmdFlatSolidExport)
+CALL_PROFILE_NAME(1565, cvxPartSmdFlatPatternExport)
+CALL_PROFILE_NAME(1566, cvxFileAction)
+CALL_PROFILE_NAME(1567, cvxFileActivate)
+CALL_PROFILE_NAME(1568, cvxFileDirectory)
+CALL_PROFILE_NAME(1569, cvxFileDirectoryByLongPath)
+CALL_PROFILE_NAME(1570, cvxFileInqActive)
+CALL_PROFILE_NAME(1571, cvxFileTypeGet)
+CALL_PROFILE_NAME(1572, cvxFileTypeSet)
+CALL_PROFILE_NAME(1573, cvxFileInqSubType)
+CALL_PROFILE_NAME(1574, cvxFileInqOpen)
+CALL_PROFILE_NAME(1575, cvxFileOpenList)
+CALL_PROFILE_NAME(1576, cvxFileOpenListByLongPath)
+CALL_PROFILE_NAME(1577, cvxFileLoadList)
+CALL_PROFILE_NAME(1578, cvxFileLoadListByLongPath)
+CALL_PROFILE_NAME(1579, cvxFileVersionGet)
+CALL_PROFILE_NAME(1580, cvxFileIsModified)
+CALL_PROFILE_NAME(1581, cvxFileInqAssociatedList)
+CALL_PROFILE_NAME(1582, cvxFileInqAssociatedListByLongPath)
+CALL_PROFILE_NAME(1583, cvxFileInqAssociatedListByName)
+CALL_PROFILE_NAME(1584, cvxFileInqAssociatedListByLongName)
+CALL_PROFILE_NAME(1585, cvxFilePreviewExtract)
+CALL_PROFILE_NAME(1586, cvxFileInqAsm)
+CALL_PROFILE_NAME(1587, cvxFileInqAssemMode)
+CALL_PROFILE_NAME(1588, cvxFilePrintInit)
+CALL_PROFILE_NAME(1589, cvxFilePrint)
+CALL_PROFILE_NAME(1590, cvxFileIsUDF)
+CALL_PROFILE_NAME(1591, cvxUDFFileInqAssociatedList)
+CALL_PROFILE_NAME(1592, cvxUDFFileInqAssociatedListByLongPath)
+CALL_PROFILE_NAME(1593, cvxFileDescriptionSet)
+CALL_PROFILE_NAME(1594, cvxFileDescriptionGet)
+CALL_PROFILE_NAME(1595, cvxFileCustomDataSet)
+CALL_PROFILE_NAME(1596, cvxFileCustomDataGet)
+CALL_PROFILE_NAME(1597, cvxFileCustomDataDel)
+CALL_PROFILE_NAME(1598, ZwFileParentActivate)
+CALL_PROFILE_NAME(1599, ZwFileReadOnlyStateGet)
+CALL_PROFILE_NAME(1600, ZwFileReadOnlyStateSet)
+CALL_PROFILE_NAME(1601, ZwFileVaildExtensionCheck)
+CALL_PROFILE_NAME(1602, ZwFileLinkInformationUpdate)
+CALL_PROFILE_NAME(1603, ZwFileLinkInformationUpdateWithoutModification)
+CALL_PROFILE_NAME(1604, ZwFileUnusedCloseAll)
+CALL_PROFILE_NAME(1605, ZwFileModifyFlagLock)
+CALL_PROFILE_NAME(1606, ZwFileDialogShow)
+CALL_PROFILE_NAME(1607, cvxPathAdd)
+CALL_PROFILE_NAME(1608, cvxPathSearchBeginAdd)
+CALL_PROFILE_NAME(1609, cvxPathAddApiPath)
+CALL_PROFILE_NAME(1610, cvxPathCompose)
+CALL_PROFILE_NAME(1611, cvxPathComposeByLongPath)
+CALL_PROFILE_NAME(1612, cvxPathCheck)
+CALL_PROFILE_NAME(1613, cvxPathSet)
+CALL_PROFILE_NAME(1614, cvxPathSearchFirst)
+CALL_PROFILE_NAME(1615, cvxPathDel)
+CALL_PROFILE_NAME(1616, cvxPathDelAll)
+CALL_PROFILE_NAME(1617, cvxPathDelim)
+CALL_PROFILE_NAME(1618, cvxPathDelimByLongPath)
+CALL_PROFILE_NAME(1619, cvxPathApiLib)
+CALL_PROFILE_NAME(1620, cvxPathApiLibByLongPath)
+CALL_PROFILE_NAME(1621, cvxPathDir)
+CALL_PROFILE_NAME(1622, cvxPathDirByLongPath)
+CALL_PROFILE_NAME(1623, cvxPathFile)
+CALL_PROFILE_NAME(1624, cvxPathFileByLongPath)
+CALL_PROFILE_NAME(1625, cvxPathFile2)
+CALL_PROFILE_NAME(1626, cvxPathFind)
+CALL_PROFILE_NAME(1627, cvxPathFindByLongPath)
+CALL_PROFILE_NAME(1628, cvxPathFindByFileName)
+CALL_PROFILE_NAME(1629, cvxPathInstall)
+CALL_PROFILE_NAME(1630, cvxPathInstallByLongPath)
+CALL_PROFILE_NAME(1631, cvxPathTemp)
+CALL_PROFILE_NAME(1632, cvxPathTempByLongPath)
+CALL_PROFILE_NAME(1633, cvxPathUserFolder)
+CALL_PROFILE_NAME(1634, cvxPathUserFolderByLongPath)
+CALL_PROFILE_NAME(1635, cvxPathIsDebug)
+CALL_PROFILE_NAME(1636, cvxPathSearchSet)
+CALL_PROFILE_NAME(1637, cvxPathSearchGet)
+CALL_PROFILE_NAME(1638, cvxPathCheckActiveOnlySet)
+CALL_PROFILE_NAME(1639, cvxPathCheckActiveOnlyGet)
+CALL_PROFILE_NAME(1640, cvxFileNameLenIsOverrange)
+CALL_PROFILE_NAME(1641, cvxFilePathLenIsOverrange)
+CALL_PROFILE_NAME(1642, ZwPathSeparatorCheck)
+CALL_PROFILE_NAME(1643, ZwPathFindByFileName)
+CALL_PROFILE_NAME(1644, ZwSearchPathAdd)
+CALL_PROFILE_NAME(1645, ZwSearchPathDelete)
+CALL_PROFILE_NAME(1646, ZwSearchPathListGet)
+CALL_PROFILE_NAME(1647, cvxEntNew)
+CALL_PROFILE_NAME(1648, cvxEntNewList)
+CALL_PROFILE_NAME(1649, cvxEntNewAll)
+CALL_PROFILE_NAME(1650, cvxPartInqTagNames)
+CALL_PROFILE_NAME(1651, cvxEntBlank)
+CALL_PROFILE_NAME(1652, cvxEntIsBlanked)
+CALL_PROFILE_NAME(1653, cvxEntHighlight)
+CALL_PROFILE_NAME(1654, cvxEntUnHighlight)
+CALL_PROFILE_NAME(1655, cvxEntHighlightByPath)
+CALL_PROFILE_NAME(1656, cvxEntUnHighlightByPath)
+CALL_PROFILE_NAME(1657, cvxEntUnhighlightAll)
+CALL_PROFILE_NAME(1658, cvxEntExists)
+CALL_PROFILE_NAME(1659, cvxEntInqSelected)
+CALL_PROFILE_NAME(1660, cvxEntInqPicked)
+CALL_PROFILE_NAME(1661, cvxEntInqPathSelected)
+CALL_PROFILE_NAME(1662, cvxEntInqPathPicked)
+CALL_PROFILE_NAME(1663, cvxEntUnPickAll)
+CALL_PROFILE_NAME(1664, cvxEntUnPickLast)
+CALL_PROFILE_NAME(1665, cvxEntUnPickByPath)
+CALL_PROFILE_NAME(1666, cvxEntAddPick)
+CALL_PROFILE_NAME(1667, cvxEntPathAddPick)
+CALL_PROFILE_NAME(1668, cvxPickDataClear)
+CALL_PROFILE_NAME(1669, cvxEntUserAtGet)
+CALL_PROFILE_NAME(1670, cvxEntUserAtSet)
+CALL_PROFILE_NAME(1671, cvxEntUserAtDel)
+CALL_PROFILE_NAME(1672, cvxEntColorGet)
+CALL_PROFILE_NAME(1673, cvxEntColorSet)
+CALL_PROFILE_NAME(1674, cvxEntRgbGet)
+CALL_PROFILE_NAME(1675, cvxEntRgbSet)
+CALL_PROFILE_NAME(1676, cvxEntRgbSetNoAt)
+CALL_PROFILE_NAME(1677, cvxEntTransSet)
+CALL_PROFILE_NAME(1678, cvxEntTransGet)
+CALL_PROFILE_NAME(1679, cvxEntLineAtGet)
+CALL_PROFILE_NAME(1680, cvxEntLineAtSet)
+CALL_PROFILE_NAME(1681, cvxEntUidGet)
+CALL_PROFILE_NAME(1682, cvxEntUidSet)
+CALL_PROFILE_NAME(1683, cvxPartInqEntLabel)
+CALL_PROFILE_NAME(1684, cvxEntLabelGet)
+CALL_PROFILE_NAME(1685, cvxEntLabelSet)
+CALL_PROFILE_NAME(1686, cvxEntName)
+CALL_PROFILE_NAME(1687, cvxEntNameSet)
+CALL_PROFILE_NAME(1688, cvxEntSetNameTag)
+CALL_PROFILE_NAME(1689, cvxEntLayer)
+CALL_PROFILE_NAME(1690, cvxEntLayerId)
+CALL_PROFILE_NAME(1691, cvxEntMatrix)
+CALL_PROFILE_NAME(1692, cvxEntMatrix2)
+CALL_PROFILE_NAME(1693, cvxEntMatrixSet)
+CALL_PROFILE_NAME(1694, cvxPartInqEntFtr)
+CALL_PROFILE_NAME(1695, cvxEntBndBox)
+CALL_PROFILE_NAME(1696, cvxEntBndBoxByPath)
+CALL_PROFILE_NAME(1697, cvxPartInqEntBox)
+CALL_PROFILE_NAME(1698, cvxEntByLabel)
+CALL_PROFILE_NAME(1699, cvxPartInqEntByLabel)
+CALL_PROFILE_NAME(1700, cvxEntByName)
+CALL_PROFILE_NAME(1701, cvxEntByName2)
+CALL_PROFILE_NAME(1702, cvxEntNameByPath)
+CALL_PROFILE_NAME(1703, cvxEntByUid)
+CALL_PROFILE_NAME(1704, cvxEntFind)
+CALL_PROFILE_NAME(1705, cvxEntFind2)
+CALL_PROFILE_NAME(1706, cvxEntClassName)
+CALL_PROFILE_NAME(1707, cvxEntClassNum)
+CALL_PROFILE_NAME(1708, cvxEntClassNumByPath)
+CALL_PROFILE_NAME(1709, cvxEntIsCurve)
+CALL_PROFILE_NAME(1710, cvxEntIsElectrode)
+CALL_PROFILE_NAME(1711, cvxEntPnt)
+CALL_PROFILE_NAME(1712, cvxEntEndPnt)
+CALL_PROFILE_NAME(1713, cvxEntSketch)
+CALL_PROFILE_NAME(1714, cvxEntParent)
+CALL_PROFILE_NAME(1715, cvxEntRefEnt)
+CALL_PROFILE_NAME(1716, cvxEntComp)
+CALL_PROFILE_NAME(1717, cvxEntErase)
+CALL_PROFILE_NAME(1718, cvxEntActivate)
+CALL_PROFILE_NAME(1719, cvxGlobalGet)
+CALL_PROFILE_NAME(1720, cvxGlobalSet)
+CALL_PROFILE_NAME(1721, cvxNoteGet)
+CALL_PROFILE_NAME(1722, cvxNoteSet)
+CALL_PROFILE_NAME(1723, cvxAutoRegenGet)
+CALL_PROFILE_NAME(1724, cvxAutoRegenSet)
+CALL_PROFILE_NAME(1725, cvxLangGet)
+CALL_PROFILE_NAME(1726, cvxFontMap)
+CALL_PROFILE_NAME(1727, cvxUnitGet)
+CALL_PROFILE_NAME(1728, cvxUnitTypeGet)
+CALL_PROFILE_NAME(1729, cvxUnitSet)
+CALL_PROFILE_NAME(1730, cvxUnitToSys)
+CALL_PROFILE_NAME(1731, cvxUnitToUser)
+CALL_PROFILE_NAME(1732, cvxUnitMassGet)
+CALL_PROFILE_NAME(1733, cvxUnitMassSet)
+CALL_PROFILE_NAME(1734, cvxSkGridSpacingGet)
+CALL_PROFILE_NAME(1735, cvxSkGridSpacingSet)
+CALL_PROFILE_NAME(1736, cvxColorfToColor)
+CALL_PROFILE_NAME(1737, cvxColorToColorf)
+CALL_PROFILE_NAME(1738, cvxColorRGB)
+CALL_PROFILE_NAME(1739, cvxColorNear)
+CALL_PROFILE_NAME(1740, cvxEscCheck)
+CALL_PROFILE_NAME(1741, cvxEscDisable)
+CALL_PROFILE_NAME(1742, cvxEscRestore)
+CALL_PROFILE_NAME(1743, cvxEscStart)
+CALL_PROFILE_NAME(1744, cvxEscEnd)
+CALL_PROFILE_NAME(1745, cvxVersion)
+CALL_PROFILE_NAME(1746, cvxVersionNum)
+CALL_PROFILE_NAME(1747, cvxFilterListGet)
+CALL_PROFILE_NAME(1748, cvxColorFilter)
+CALL_PROFILE_NAME(1749, cvxFilterActiveGet)
+CALL_PROFILE_NAME(1750, cvxLabelMatch)
+CALL_PROFILE_NAME(1751, cvxNameIsOkay)
+CALL_PROFILE_NAME(1752, cvxHostId)
+CALL_PROFILE_NAME(1753, cvxNotifyExit)
+CALL_PROFILE_NAME(1754, cvxSetMSMMoldInstalled)
+CALL_PROFILE_NAME(1755, cvxSetMSMPressInstalled)
+CALL_PROFILE_NAME(1756, cvxPluginRegPathGet)
+CALL_PROFILE_NAME(1757, cvxPluginRegPathGetByLongPath)
+CALL_PROFILE_NAME(1758, ZwPluginDataInit)
+CALL_PROFILE_NAME(1759, ZwPluginLoad)
+CALL_PROFILE_NAME(1760, ZwPluginUnload)
+CALL_PROFILE_NAME(1761, ZwPluginListGet)
+CALL_PROFILE_NAME(1762, ZwResourceFileRegister)
+CALL_PROFILE_NAME(1763, ZwResourceFileUnregister)
+CALL_PROFILE_NAME(1764, ZwResourcePathAdd)
+CALL_PROFILE_NAME(1765, ZwResourcePathDelete)
+CALL_PROFILE_NAME(1766, ZwResourcePathListGet)
+CALL_PROFILE_NAME(1767, ZwProfileModuleNameRegister)
+CALL_PROFILE_NAME(1768, cvxHelpDocLoad)
+CALL_PROFILE_NAME(1769, cvxAppAction)
+CALL_PROFILE_NAME(1770, ZwApplicationReactorSet)
+CALL_PROFILE_NAME(1771, ZwDocumentReactorSet)
+CALL_PROFILE_NAME(1772, ZwEnvironmentReactorSet)
+CALL_PROFILE_NAME(1773, ZwPreferenceToleranceGet)
+CALL_PROFILE_NAME(1774, ZwPreferenceToleranceSet)
+CALL_PROFILE_NAME(1775, ZwPreferenceFreeEdgeDisplayModeGet)
+CALL_PROFILE_NAME(1776, ZwPreferenceFreeEdgeDisplayModeSet)
+CALL_PROFILE_NAME(1777, ZwPreferenceComponentLightSourcesModeGet)
+CALL_PROFILE_NAME(1778, ZwPreferenceComponentLightSourcesModeSet)
+CALL_PROFILE_NAME(1779, ZwPreferenceUnitsSystemGet)
+CALL_PROFILE_NAME(1780, ZwPreferenceUnitsSystemSet)
+CALL_PROFILE_NAME(1781, ZwHarnessShapeListGet)
+CALL_PROFILE_NAME(1782, ZwHistoryOperationDelete)
+CALL_PROFILE_NAME(1783, ZwHistoryListGet)
+CALL_PROFILE_NAME(1784, ZwHistoryClip)
+CALL_PROFILE_NAME(1785, ZwHistoryPaste)
+CALL_PROFILE_NAME(1786, ZwHistoryEntitySuppressStatusGet)
+CALL_PROFILE_NAME(1787, ZwHistoryEntityTemplateNameGet)
+CALL_PROFILE_NAME(1788, ZwRayShapeIntersect)
+CALL_PROFILE_NAME(1789, ZwRayComponentIntersectWithRadius)
+CALL_PROFILE_NAME(1790, cvxLayerAdd)
+CALL_PROFILE_NAME(1791, cvxLayerAdd2)
+CALL_PROFILE_NAME(1792, cvxLayerDel)
+CALL_PROFILE_NAME(1793, cvxLayerDel2)
+CALL_PROFILE_NAME(1794, cvxLayerActivate)
+CALL_PROFILE_NAME(1795, cvxLayerSync)
+CALL_PROFILE_NAME(1796, cvxLayerShowAll)
+CALL_PROFILE_NAME(1797, cvxLayerIdModify)
+CALL_PROFILE_NAME(1798, cvxLayerInqActive)
+CALL_PROFILE_NAME(1799, cvxLayerExists)
+CALL_PROFILE_NAME(1800, cvxLayerExists2)
+CALL_PROFILE_NAME(1801, cvxLayerId)
+CALL_PROFILE_NAME(1802, cvxLayerInqEnts)
+CALL_PROFILE_NAME(1803, cvxLayerAssign)
+CALL_PROFILE_NAME(1804, cvxLayerList)
+CALL_PROFILE_NAME(1805, cvxLayerName)
+CALL_PROFILE_NAME(1806, cvxLayerNum)
+CALL_PROFILE_NAME(1807, cvxLayerGetAllCategory)
+CALL_PROFILE_NAME(1808, cvxActiveLayerNumGet)
+CALL_PROFILE_NAME(1809, cvxActiveLayerNumSet)
+CALL_PROFILE_NAME(1810, cvxLayerStateGet)
+CALL_PROFILE_NAME(1811, cvxLayerStateSet)
+CALL_PROFILE_NAME(1812, ZwLayerCategoryCreate)
+CALL_PROFILE_NAME(1813, ZwLayerCategoryNameSet)
+CALL_PROFILE_NAME(1814, ZwLayerCategoryDelete)
+CALL_PROFILE_NAME(1815, ZwLayerCategoryListGet)
+CALL_PROFILE_NAME(1816, ZwLayerCategoryActiveStateGet)
+CALL_PROFILE_NAME(1817, ZwLayerCategoryActiveStateSet)
+CALL_PROFILE_NAME(1818, ZwLayerVisibilitySetAll)
+CALL_PROFILE_NAME(1819, ZwLayerCategoryVisibilitySet)
+CALL_PROFILE_NAME(1820, ZwLayerFrozenStateSetAll)
+CALL_PROFILE_NAME(1821, ZwLayerCategoryFrozenStateSet)
+CALL_PROFILE_NAME(1822, ZwLayerVisibilityRefresh)
+CALL_PROFILE_NAME(1823, ZwLayerManagerRefresh)
+CALL_PROFILE_NAME(1824, cvxLayerInfoGet)
+CALL_PROFILE_NAME(1825, cvxLayerInfoSet)
+CALL_PROFILE_NAME(1826, cvxLayerInfoExport)
+CALL_PROFILE_NAME(1827, cvxLayerInfoImport)
+CALL_PROFILE_NAME(1828, cvxLayerRefresh)
+CALL_PROFILE_NAME(1829, ZwLayerRuleCreate)
+CALL_PROFILE_NAME(1830, ZwLayerRuleDelete)
+CALL_PROFILE_NAME(1831, ZwLayerRulesDeleteAll)
+CALL_PROFILE_NAME(1832, ZwLayerRuleDataSet)
+CALL_PROFILE_NAME(1833, ZwLayerRuleListGet)
+CALL_PROFILE_NAME(1834, ZwLayerRuleDataGet)
+CALL_PROFILE_NAME(1835, ZwLayerRuleActiveStateGet)
+CALL_PROFILE_NAME(1836, ZwLayerRuleActiveStateSet)
+CALL_PROFILE_NAME(1837, cvxLicModulesGet)
+CALL_PROFILE_NAME(1838, cvxLicIdentifierGet)
+CALL_PROFILE_NAME(1839, cvxLicEvaluationGet)
+CALL_PROFILE_NAME(1840, cvxLicStandaloneEvaluationGet)
+CALL_PROFILE_NAME(1841, cvxLicActivate)
+CALL_PROFILE_NAME(1842, cvxLicRemove)
+CALL_PROFILE_NAME(1843, cvxLicTypeCheck)
+CALL_PROFILE_NAME(1844, ZwLinkManagerFileListGet)
+CALL_PROFILE_NAME(1845, ZwLinkManagerAutoRegenSet)
+CALL_PROFILE_NAME(1846, ZwLinkManagerAutoRegenGet)
+CALL_PROFILE_NAME(1847, ZwLinkManagerInformationGet)
+CALL_PROFILE_NAME(1848, ZwLoopEdgeListGet)
+CALL_PROFILE_NAME(1849, ZwLoopPreEdgeListGet)
+CALL_PROFILE_NAME(1850, ZwLoopIsInner)
+CALL_PROFILE_NAME(1851, ZwMaterialListGet)
+CALL_PROFILE_NAME(1852, ZwMaterialLibraryCustomCreate)
+CALL_PROFILE_NAME(1853, ZwMaterialLibraryCustomDelete)
+CALL_PROFILE_NAME(1854, ZwMaterialLibraryListGet)
+CALL_PROFILE_NAME(1855, ZwMaterialLibraryCategoryCreate)
+CALL_PROFILE_NAME(1856, ZwMaterialLibraryCategoryDelete)
+CALL_PROFILE_NAME(1857, ZwMaterialLibraryCategoryListGet)
+CALL_PROFILE_NAME(1858, ZwMaterialLibraryMaterialCreate)
+CALL_PROFILE_NAME(1859, ZwMaterialLibraryMaterialDelete)
+CALL_PROFILE_NAME(1860, ZwMaterialLibraryMaterialListGet)
+CALL_PROFILE_NAME(1861, ZwMaterialGeneralPropertySet)
+CALL_PROFILE_NAME(1862, ZwMaterialGeneralPropertyGet)
+CALL_PROFILE_NAME(1863, ZwMaterialGeneralPropertyListSet)
+CALL_PROFILE_NAME(1864, ZwMaterialGeneralPropertyListGet)
+CALL_PROFILE_NAME(1865, ZwMaterialGeneralPropertyDelete)
+CALL_PROFILE_NAME(1866, cvxRoundNumber)
+CALL_PROFILE_NAME(1867, cvxCrvPlaneParallelChk)
+CALL_PROFILE_NAME(1868, cvxAxisDistance)
+CALL_PROFILE_NAME(1869, cvxAxisCrvDistance)
+CALL_PROFILE_NAME(1870, cvxPlaneDistance)
+CALL_PROFILE_NAME(1871, cvxEntGetDistance)
+CALL_PROFILE_NAME(1872, cvxEntGetDistanceByPath)
+CALL_PROFILE_NAME(1873, cvxEntGetAngle)
+CALL_PROFILE_NAME(1874, cvxPartInqEntsArea)
+CALL_PROFILE_NAME(1875, cvxPartInqEntsAreaByPath)
+CALL_PROFILE_NAME(1876, cvxBndBoxInit)
+CALL_PROFILE_NAME(1877, cvxBndBoxInit2)
+CALL_PROFILE_NAME(1878, cvxBndBoxPnts)
+CALL_PROFILE_NAME(1879, cvxBndBoxCenter)
+CALL_PROFILE_NAME(1880, cvxBndBoxPntLoc)
+CALL_PROFILE_NAME(1881, cvxBndBoxAdd)
+CALL_PROFILE_NAME(1882, cvxBndBoxMerge)
+CALL_PROFILE_NAME(1883, cvxBndBoxSize)
+CALL_PROFILE_NAME(1884, cvxBndBoxVolume)
+CALL_PROFILE_NAME(1885, cvxBndBoxContain)
+CALL_PROFILE_NAME(1886, cvxBndBoxPntDist)
+CALL_PROFILE_NAME(1887, cvxBndBoxDist)
+CALL_PROFILE_NAME(1888, cvxIsectCrvCrv)
+CALL_PROFILE_NAME(1889, cvxIsectCrvFace)
+CALL_PROFILE_NAME(1890, cvxIsectFaceFace)
+CALL_PROFILE_NAME(1891, cvxIsectRayCrv)
+CALL_PROFILE_NAME(1892, cvxIsectRayFace)
+CALL_PROFILE_NAME(1893, cvxIsectRayFaceInfinite)
+CALL_PROFILE_NAME(1894, cvxIsectRayPlane)
+CALL_PROFILE_NAME(1895, cvxIsectRayShape)
+CALL_PROFILE_NAME(1896, cvxIsectRayShapes)
+CALL_PROFILE_NAME(1897, cvxIsectRayPart)
+CALL_PROFILE_NAME(1898, cvxIsectRayPartVis)
+CALL_PROFILE_NAME(1899, cvxIsectRayComp)
+CALL_PROFILE_NAME(1900, cvxIsectRayComps)
+CALL_PROFILE_NAME(1901, cvxCompFind)
+CALL_PROFILE_NAME(1902, cvxIsectRayBndBox)
+CALL_PROFILE_NAME(1903, cvxPartIsectShpChk)
+CALL_PROFILE_NAME(1904, cvxPartIsectShpChk2)
+CALL_PROFILE_NAME(1905, cvxCompIsectShpShp)
+CALL_PROFILE_NAME(1906, cvxIsectBndBoxBndBox)
+CALL_PROFILE_NAME(1907, cvxIsectBndBoxPlane)
+CALL_PROFILE_NAME(1908, cvxIsectPlanePlane)
+CALL_PROFILE_NAME(1909, cvxMatEigen)
+CALL_PROFILE_NAME(1910, cvxMatInit)
+CALL_PROFILE_NAME(1911, cvxMatInvert)
+CALL_PROFILE_NAME(1912, cvxMatMult)
+CALL_PROFILE_NAME(1913, cvxMatPntVec)
+CALL_PROFILE_NAME(1914, cvxMatPntVecs)
+CALL_PROFILE_NAME(1915, cvxMatGetPntVecs)
+CALL_PROFILE_NAME(1916, cvxMatRotate)
+CALL_PROFILE_NAME(1917, cvxMatScale)
+CALL_PROFILE_NAME(1918, cvxMatSetIdentity)
+CALL_PROFILE_NAME(1919, cvxMatTransform)
+CALL_PROFILE_NAME(1920, cvxMatTranslate)
+CALL_PROFILE_NAME(1921, cvxMatView)
+CALL_PROFILE_NAME(1922, cvxMatToEuler)
+CALL_PROFILE_NAME(1923, cvxMatFromEuler)
+CALL_PROFILE_NAME(1924, cvxPntTransform)
+CALL_PROFILE_NAME(1925, cvxPntTransformList)
+CALL_PROFILE_NAME(1926, cvxAxisTransform)
+CALL_PROFILE_NAME(1927, cvxVecTransform)
+CALL_PROFILE_NAME(1928, cvxCrvTransform)
+CALL_PROFILE_NAME(1929, cvxSrfTransform)
+CALL_PROFILE_NAME(1930, cvxBndBoxTransform)
+CALL_PROFILE_NAME(1931, cvxCrvEval)
+CALL_PROFILE_NAME(1932, cvxCrvEval2)
+CALL_PROFILE_NAME(1933, cvxPreEdgeEval)
+CALL_PROFILE_NAME(1934, cvxCrvEvalCrvtr)
+CALL_PROFILE_NAME(1935, cvxCrvIsLine)
+CALL_PROFILE_NAME(1936, cvxCrvParam)
+CALL_PROFILE_NAME(1937, cvxCrvMinMaxRad)
+CALL_PROFILE_NAME(1938, cvxCrvInqContinuity)
+CALL_PROFILE_NAME(1939, cvxCrvContinuityTolListInit)
+CALL_PROFILE_NAME(1940, cvxCrvInqMultiContinuity)
+CALL_PROFILE_NAME(1941, cvxPartCurveChainFind)
+CALL_PROFILE_NAME(1942, cvxCrvGetPntAtLenFraction)
+CALL_PROFILE_NAME(1943, cvxCrvPntProj)
+CALL_PROFILE_NAME(1944, cvxCrvGetPntAtDist)
+CALL_PROFILE_NAME(1945, cvxCrvGetInflections)
+CALL_PROFILE_NAME(1946, cvxCrvInqExtreme)
+CALL_PROFILE_NAME(1947, cvxCrvExtremum)
+CALL_PROFILE_NAME(1948, cvxCrvGetCusps)
+CALL_PROFILE_NAME(1949, cvxCrvLen)
+CALL_PROFILE_NAME(1950, cvxCrvLen2)
+CALL_PROFILE_NAME(1951, cvxPartSew)
+CALL_PROFILE_NAME(1952, cvxPartFace)
+CALL_PROFILE_NAME(1953, cvxPartFaceMod)
+CALL_PROFILE_NAME(1954, cvxSrfEval)
+CALL_PROFILE_NAME(1955, cvxSrfDiameterEval)
+CALL_PROFILE_NAME(1956, cvxPartFaceFind)
+CALL_PROFILE_NAME(1957, cvxPartFaceEdgesFind)
+CALL_PROFILE_NAME(1958, cvxSrfAxis)
+CALL_PROFILE_NAME(1959, cvxSrfGetPole)
+CALL_PROFILE_NAME(1960, cvxSrfFindPoles)
+CALL_PROFILE_NAME(1961, cvxPntIsCritical)
+CALL_PROFILE_NAME(1962, cvxPntIsOn)
+CALL_PROFILE_NAME(1963, cvxPntOnCrv)
+CALL_PROFILE_NAME(1964, cvxPntOnFace)
+CALL_PROFILE_NAME(1965, cvxPntProject)
+CALL_PROFILE_NAME(1966, cvxPntEntLoc)
+CALL_PROFILE_NAME(1967, cvxAxisPntProject)
+CALL_PROFILE_NAME(1968, cvxPlanePntProject)
+CALL_PROFILE_NAME(1969, cvxPntTranslate)
+CALL_PROFILE_NAME(1970, cvxPntDist)
+CALL_PROFILE_NAME(1971, cvxPntEntDist)
+CALL_PROFILE_NAME(1972, cvxPntPreEdgeDist)
+CALL_PROFILE_NAME(1973, cvxAxisPntDistance)
+CALL_PROFILE_NAME(1974, cvxPlanePntDistance)
+CALL_PROFILE_NAME(1975, cvxAxisEvalPoint)
+CALL_PROFILE_NAME(1976, cvxPlaneEvalPoint)
+CALL_PROFILE_NAME(1977, cvxPlnThruPnts)
+CALL_PROFILE_NAME(1978, cvxPolyToTri)
+CALL_PROFILE_NAME(1979, cvxVecInit)
+CALL_PROFILE_NAME(1980, cvxVecNormalize)
+CALL_PROFILE_NAME(1981, cvxVecAngle)
+CALL_PROFILE_NAME(1982, cvxVecCross)
+CALL_PROFILE_NAME(1983, cvxVecPerp)
+CALL_PROFILE_NAME(1984, cvxVecReverse)
+CALL_PROFILE_NAME(1985, cvxVecParallelChk)
+CALL_PROFILE_NAME(1986, ZwMatrix3Eigen)
+CALL_PROFILE_NAME(1987, ZwMatrixInit)
+CALL_PROFILE_NAME(1988, ZwMatrixInvert)
+CALL_PROFILE_NAME(1989, ZwMatrixCrossProduct)
+CALL_PROFILE_NAME(1990, ZwMatrixGetByPointAndZAxis)
+CALL_PROFILE_NAME(1991, ZwMatrixGetByPointAndXYAxis)
+CALL_PROFILE_NAME(1992, ZwMatrixCoordinateSystemGet)
+CALL_PROFILE_NAME(1993, ZwMatrixInitByRotation)
+CALL_PROFILE_NAME(1994, ZwMatrixInitByPoint)
+CALL_PROFILE_NAME(1995, ZwMatrixIdentityFlagRefresh)
+CALL_PROFILE_NAME(1996, ZwMatrixTransform)
+CALL_PROFILE_NAME(1997, ZwMatrixInitByTranslation)
+CALL_PROFILE_NAME(1998, ZwMatrixInitByView)
+CALL_PROFILE_NAME(1999, ZwMatrixToEulerAngle)
+CALL_PROFILE_NAME(2000, ZwEulerAngleToMatrix)
+CALL_PROFILE_NAME(2001, ZwPointTransform)
+CALL_PROFILE_NAME(2002, ZwPointListTransform)
+CALL_PROFILE_NAME(2003, ZwMatrix2Determinant)
+CALL_PROFILE_NAME(2004, ZwMatrix3Determinant)
+CALL_PROFILE_NAME(2005, ZwMatrix2Transpose)
+CALL_PROFILE_NAME(2006, ZwMatrix3Transpose)
+CALL_PROFILE_NAME(2007, ZwMatrixTranspose)
+CALL_PROFILE_NAME(2008, ZwMatrixRotationGet)
+CALL_PROFILE_NAME(2009, ZwMatrixScaleGet)
+CALL_PROFILE_NAME(2010, ZwMatrixTranslationGet)
+CALL_PROFILE_NAME(2011, ZwMatrix3ToMatrix4)
+CALL_PROFILE_NAME(2012, ZwMatrixRotationSet)
+CALL_PROFILE_NAME(2013, ZwMatrixScaleSet)
+CALL_PROFILE_NAME(2014, ZwMatrixTranslationSet)
+CALL_PROFILE_NAME(2015, ZwMatrixNormalize)
+CALL_PROFILE_NAME(2016, ZwMatrixOrthogonalCheck)
+CALL_PROFILE_NAME(2017, ZwMatrixReflectionMatrixCreate)
+CALL_PROFILE_NAME(2018, ZwMatrixFullRankCheck)
+CALL_PROFILE_NAME(2019, cvxMemAlloc)
+CALL_PROFILE_NAME(2020, cvxMemResize)
+CALL_PROFILE_NAME(2021, ZwMemoryAlloc)
+CALL_PROFILE_NAME(2022, ZwMemoryResize)
+CALL_PROFILE_NAME(2023, cvxMemZero)
+CALL_PROFILE_NAME(2024, ZwMemoryZero)
+CALL_PROFILE_NAME(2025, cvxMemFree)
+CALL_PROFILE_NAME(2026, ZwMemoryFree)
+CALL_PROFILE_NAME(2027, cvxErrDisable)
+CALL_PROFILE_NAME(2028, cvxErrEnable)
+CALL_PROFILE_NAME(2029, cvxMsgDisable)
+CALL_PROFILE_NAME(2030, cvxMsgEnable)
+CALL_PROFILE_NAME(2031, cvxLastWarningMsgEnable)
+CALL_PROFILE_NAME(2032, cvxPromptDisable)
+CALL_PROFILE_NAME(2033, cvxPromptEnable)
+CALL_PROFILE_NAME(2034, cvxTranStatusDisable)
+CALL_PROFILE_NAME(2035, cvxTranStatusEnable)
+CALL_PROFILE_NAME(2036, cvxUserActionStatusGet)
+CALL_PROFILE_NAME(2037, cvxUserActionStatusSet)
+CALL_PROFILE_NAME(2038, cvxCrashPromptDisable)
+CALL_PROFILE_NAME(2039, cvxCrashPromptEnable)
+CALL_PROFILE_NAME(2040, cvxUserActionStatusSet2)
+CALL_PROFILE_NAME(2041, cvxMsgAreaClose)
+CALL_PROFILE_NAME(2042, cvxMsgAreaOpen)
+CALL_PROFILE_NAME(2043, cvxMsgAreaState)
+CALL_PROFILE_NAME(2044, cvxMsgAreaStateGet)
+CALL_PROFILE_NAME(2045, cvxMsgFileLoad)
+CALL_PROFILE_NAME(2046, cvxMsgPtr)
+CALL_PROFILE_NAME(2047, cvxMsgDisp)
+CALL_PROFILE_NAME(2048, cvxMsgDisp2)
+CALL_PROFILE_NAME(2049, cvxMessageBox)
+CALL_PROFILE_NAME(2050, cvxLastErrGet)
+CALL_PROFILE_NAME(2051, cvxLastErrSet)
+CALL_PROFILE_NAME(2052, cvxErrMsgGet)
+CALL_PROFILE_NAME(2053, ZwMotEntityListGet)
+CALL_PROFILE_NAME(2054, ZwMotEntityActiveGet)
+CALL_PROFILE_NAME(2055, ZwMotEntityActiveSet)
+CALL_PROFILE_NAME(2056, ZwMotEntityNameGet)
+CALL_PROFILE_NAME(2057, ZwMotEntityNameSet)
+CALL_PROFILE_NAME(2058, ZwMotEntityDelete)
+CALL_PROFILE_NAME(2059, ZwMotBodyGet)
+CALL_PROFILE_NAME(2060, ZwMotBodySet)
+CALL_PROFILE_NAME(2061, ZwMotBodyMatrixGet)
+CALL_PROFILE_NAME(2062, ZwMotBodyMatrixSet)
+CALL_PROFILE_NAME(2063, ZwMotJointTypeGetBySubClass)
+CALL_PROFILE_NAME(2064, ZwMotJointGet)
+CALL_PROFILE_NAME(2065, ZwMotJointFree)
+CALL_PROFILE_NAME(2066, ZwMotDriverGet)
+CALL_PROFILE_NAME(2067, ZwMotDriverSet)
+CALL_PROFILE_NAME(2068, ZwMotDriverValidJointCheck)
+CALL_PROFILE_NAME(2069, ZwMotDriverCreate)
+CALL_PROFILE_NAME(2070, ZwMotActiveSolutionGet)
+CALL_PROFILE_NAME(2071, ZwMotSolutionDegreeOfFreedomGet)
+CALL_PROFILE_NAME(2072, ZwMotSolutionGet)
+CALL_PROFILE_NAME(2073, ZwMotSolutionSet)
+CALL_PROFILE_NAME(2074, ZwMotSolutionActiveEntityListGet)
+CALL_PROFILE_NAME(2075, ZwMotSolutionDriverTimeListGet)
+CALL_PROFILE_NAME(2076, ZwMotSolutionDriverTimeListSet)
+CALL_PROFILE_NAME(2077, ZwMotSolutionCalculate)
+CALL_PROFILE_NAME(2078, ZwMotSolutionSolveResultGet)
+CALL_PROFILE_NAME(2079, ZwMotSolutionSolveResultFree)
+CALL_PROFILE_NAME(2080, cvxPartMassProp)
+CALL_PROFILE_NAME(2081, cvxPartCalcAttrGet)
+CALL_PROFILE_NAME(2082, cvxPartPhyAttrCalc)
+CALL_PROFILE_NAME(2083, cvxPartVolumAndMassGet)
+CALL_PROFILE_NAME(2084, cvxPartMaterialGet)
+CALL_PROFILE_NAME(2085, cvxPartMaterialSet)
+CALL_PROFILE_NAME(2086, cvxPartMaterialDel)
+CALL_PROFILE_NAME(2087, cvxPartAtGet)
+CALL_PROFILE_NAME(2088, cvxPartAtMod)
+CALL_PROFILE_NAME(2089, cvxPartAtSet)
+CALL_PROFILE_NAME(2090, cvxPartShowPartAt)
+CALL_PROFILE_NAME(2091, cvxPartClosePartAt)
+CALL_PROFILE_NAME(2092, cvxPartAtItemGet)
+CALL_PROFILE_NAME(2093, cvxPartAtItemSet)
+CALL_PROFILE_NAME(2094, cvxPartAtItemGetInFile)
+CALL_PROFILE_NAME(2095, cvxPartAtItemSetInFile)
+CALL_PROFILE_NAME(2096, cvxPartAtItemDel)
+CALL_PROFILE_NAME(2097, cvxPartAtItemDesGet)
+CALL_PROFILE_NAME(2098, cvxPartAtItemDesSet)
+CALL_PROFILE_NAME(2099, cvxPartAtItemLockGet)
+CALL_PROFILE_NAME(2100, cvxPartAtItemLockSet)
+CALL_PROFILE_NAME(2101, cvxPartAtItemLockGetInFile)
+CALL_PROFILE_NAME(2102, cvxPartAtItemLockSetInFile)
+CALL_PROFILE_NAME(2103, cvxPartUserAtGet)
+CALL_PROFILE_NAME(2104, cvxPartUserAtSet)
+CALL_PROFILE_NAME(2105, cvxPartUserAtExport)
+CALL_PROFILE_NAME(2106, cvxPartSetCustomStr)
+CALL_PROFILE_NAME(2107, cvxPartGetCustomStr)
+CALL_PROFILE_NAME(2108, cvxPartCfgTblAdd)
+CALL_PROFILE_NAME(2109, cvxPartCfgActivate)
+CALL_PROFILE_NAME(2110, cvxPartInqActiveCfg)
+CALL_PROFILE_NAME(2111, cvxPartInqActiveCfgByName)
+CALL_PROFILE_NAME(2112, cvxPartInqCfgList)
+CALL_PROFILE_NAME(2113, cvxPartInqCfgListByName)
+CALL_PROFILE_NAME(2114, cvxCfgTblInfosSet)
+CALL_PROFILE_NAME(2115, cvxPartInqCfgTblInfos)
+CALL_PROFILE_NAME(2116, cvxPartInqCfgTblInfosByName)
+CALL_PROFILE_NAME(2117, cvxPartFreeCfgTbl)
+CALL_PROFILE_NAME(2118, cvxPartCfgTblAttrSet)
+CALL_PROFILE_NAME(2119, cvxPartCfgTblColorSet)
+CALL_PROFILE_NAME(2120, cvxPartCfgTblInstNameSet)
+CALL_PROFILE_NAME(2121, cvxPartCfgTblVarsSet)
+CALL_PROFILE_NAME(2122, cvxPartInqAxis)
+CALL_PROFILE_NAME(2123, cvxAxisInqDir)
+CALL_PROFILE_NAME(2124, cvxAxisGetData)
+CALL_PROFILE_NAME(2125, cvxAxisLengthGet)
+CALL_PROFILE_NAME(2126, cvxAxisLengthSet)
+CALL_PROFILE_NAME(2127, cvxPlaneGetData)
+CALL_PROFILE_NAME(2128, cvxPartInqCsys)
+CALL_PROFILE_NAME(2129, cvxPartInqDefaultCSYS)
+CALL_PROFILE_NAME(2130, cvxPartInqCSYSAxis)
+CALL_PROFILE_NAME(2131, cvxPartInqCSYSPlane)
+CALL_PROFILE_NAME(2132, cvxCSYSGetData)
+CALL_PROFILE_NAME(2133, cvxCSYSSetData)
+CALL_PROFILE_NAME(2134, cvxPartInqLCSMat)
+CALL_PROFILE_NAME(2135, cvxPartInqDims)
+CALL_PROFILE_NAME(2136, cvxPartInqPMIDimEnts)
+CALL_PROFILE_NAME(2137, cvxPartInqDimIdxs)
+CALL_PROFILE_NAME(2138, cvxPartInqPMIs)
+CALL_PROFILE_NAME(2139, cvxPMIInqType)
+CALL_PROFILE_NAME(2140, cvxPMIInqBaseEnt)
+CALL_PROFILE_NAME(2141, cvxPMIInqAssoEnts)
+CALL_PROFILE_NAME(2142, cvxPMIInqValid)
+CALL_PROFILE_NAME(2143, cvxSymInqRefPnt)
+CALL_PROFILE_NAME(2144, cvxSymInqLeadLines)
+CALL_PROFILE_NAME(2145, cvxEdgeDiscreteDataFree)
+CALL_PROFILE_NAME(2146, cvxPartPntBlock)
+CALL_PROFILE_NAME(2147, cvxPartFacets)
+CALL_PROFILE_NAME(2148, cvxPartFacetsBySTL)
+CALL_PROFILE_NAME(2149, cvxPartInqBlocks)
+CALL_PROFILE_NAME(2150, cvxPartInqBlockPnts)
+CALL_PROFILE_NAME(2151, cvxPartInqBlockType)
+CALL_PROFILE_NAME(2152, cvxPartInqFacets)
+CALL_PROFILE_NAME(2153, cvxPartInqFacets2)
+CALL_PROFILE_NAME(2154, cvxPartInqFacetsTxFile)
+CALL_PROFILE_NAME(2155, cvxPartInqFacetsTxFileByLongPath)
+CALL_PROFILE_NAME(2156, cvxPartFacetsMod)
+CALL_PROFILE_NAME(2157, cvxPartFacetsSetAt)
+CALL_PROFILE_NAME(2158, cvxPartFacetsSetTx)
+CALL_PROFILE_NAME(2159, cvxPartProjStl)
+CALL_PROFILE_NAME(2160, cvxPartInqFaceFacets)
+CALL_PROFILE_NAME(2161, cvxPartInqFaceFacets2)
+CALL_PROFILE_NAME(2162, cvxPartInqFaceFacetsByChord)
+CALL_PROFILE_NAME(2163, cvxPartRefineFacetsInit)
+CALL_PROFILE_NAME(2164, cvxPartInqFaceFacets2ByTol)
+#if defined _WIN64
+CALL_PROFILE_NAME(2165, cvxPartFaceMesh)
+CALL_PROFILE_NAME(2166, cvxPartFaceMeshPnts)
+#endif
+CALL_PROFILE_NAME(2167, cvxPartFacetsConvertToSTL)
+CALL_PROFILE_NAME(2168, cvxPartSTLConvertToFacets)
+CALL_PROFILE_NAME(2169, cvxFacetsFree)
+CALL_PROFILE_NAME(2170, cvxStlFree)
+CALL_PROFILE_NAME(2171, cvxPartEdgeDispData)
+CALL_PROFILE_NAME(2172, cvxPartEdgeDispDataFree)
+CALL_PROFILE_NAME(2173, cvxPartRegenIsActive)
+CALL_PROFILE_NAME(2174, cvxPartRedefineIsActive)
+CALL_PROFILE_NAME(2175, cvxPartRegenFacets)
+CALL_PROFILE_NAME(2176, cvxPartPartialResults)
+CALL_PROFILE_NAME(2177, cvxPartHistList)
+CALL_PROFILE_NAME(2178, cvxPartInqFtrList)
+CALL_PROFILE_NAME(2179, cvxFtrIsSubPart)
+CALL_PROFILE_NAME(2180, cvxPartFtrIsMissRef)
+CALL_PROFILE_NAME(2181, cvxPartInqFtrAssoPart)
+CALL_PROFILE_NAME(2182, cvxPartInqFtrAssoPartByLongPath)
+CALL_PROFILE_NAME(2183, cvxPartInqFtrData)
+CALL_PROFILE_NAME(2184, cvxPartFtrInqAuxFtrs)
+CALL_PROFILE_NAME(2185, cvxPartInqFtrTemplate)
+CALL_PROFILE_NAME(2186, cvxPartInqFtrTol)
+CALL_PROFILE_NAME(2187, cvxPartInqFtrRegenStat)
+CALL_PROFILE_NAME(2188, cvxPartInqFtrRegenStatus)
+CALL_PROFILE_NAME(2189, cvxPartInqFtrVersion)
+CALL_PROFILE_NAME(2190, cvxPartInqFtrGroup)
+CALL_PROFILE_NAME(2191, cvxPartInqGroupFtrs)
+CALL_PROFILE_NAME(2192, cvxPartInqGroupList)
+CALL_PROFILE_NAME(2193, cvxPartInqFtrParentFtrs)
+CALL_PROFILE_NAME(2194, cvxPartInqFtrChildFtrs)
+CALL_PROFILE_NAME(2195, cvxPartFtrInqInpEnts)
+CALL_PROFILE_NAME(2196, cvxPartInqFtrEnts)
+CALL_PROFILE_NAME(2197, cvxPartFtrUserAtGet)
+CALL_PROFILE_NAME(2198, cvxPartFtrUserAtSet)
+CALL_PROFILE_NAME(2199, cvxPartFtrUserAtDel)
+CALL_PROFILE_NAME(2200, cvxPartInqHoles)
+CALL_PROFILE_NAME(2201, cvxPartFreeHoles)
+CALL_PROFILE_NAME(2202, cvxPartInqCurves)
+CALL_PROFILE_NAME(2203, cvxPartInqCrvLists)
+CALL_PROFILE_NAME(2204, cvxPartInqCrvList)
+CALL_PROFILE_NAME(2205, cvxPartInqCurve)
+CALL_PROFILE_NAME(2206, cvxCurveFree)
+CALL_PROFILE_NAME(2207, cvxPartInqPoints)
+CALL_PROFILE_NAME(2208, cvxPartInqAnnoTexts)
+CALL_PROFILE_NAME(2209, cvxPartInqTexts)
+CALL_PROFILE_NAME(2210, cvxPartInqConstraints)
+CALL_PROFILE_NAME(2211, cvxPartInqTempData)
+CALL_PROFILE_NAME(2212, cvxPartInqPublishSets)
+CALL_PROFILE_NAME(2213, cvxPartInqPublishSet)
+CALL_PROFILE_NAME(2214, cvxPartExit)
+CALL_PROFILE_NAME(2215, cvxPartBackup)
+CALL_PROFILE_NAME(2216, cvxHistBackup)
+CALL_PROFILE_NAME(2217, cvxPartEncapsulate)
+CALL_PROFILE_NAME(2218, cvxPartDefeature)
+CALL_PROFILE_NAME(2219, cvxPartHistStart)
+CALL_PROFILE_NAME(2220, cvxPartHistEnd)
+CALL_PROFILE_NAME(2221, cvxHistRedefine)
+CALL_PROFILE_NAME(2222, cvxHistSkipTo)
+CALL_PROFILE_NAME(2223, cvxPartFtrPlayTo)
+CALL_PROFILE_NAME(2224, cvxPartFtrSuppress)
+CALL_PROFILE_NAME(2225, cvxPartHistGroup)
+CALL_PROFILE_NAME(2226, cvxPartHistInqGroup)
+CALL_PROFILE_NAME(2227, cvxPartHistPaste)
+CALL_PROFILE_NAME(2228, cvxPartHistClip)
+CALL_PROFILE_NAME(2229, cvxPartHistClipbyPath)
+CALL_PROFILE_NAME(2230, cvxPartHistRename)
+CALL_PROFILE_NAME(2231, cvxPartHistDel)
+CALL_PROFILE_NAME(2232, cvxPartHistDelUtil)
+CALL_PROFILE_NAME(2233, cvxPartDelGrpFtr)
+CALL_PROFILE_NAME(2234, cvxPartMkEntExternal)
+CALL_PROFILE_NAME(2235, cvxHistDisable)
+CALL_PROFILE_NAME(2236, cvxHistEnable)
+CALL_PROFILE_NAME(2237, cvxPartHistAdd)
+CALL_PROFILE_NAME(2238, cvxPartErase)
+CALL_PROFILE_NAME(2239, cvxPartHistScrollTo)
+CALL_PROFILE_NAME(2240, cvxPartPublishSetDel)
+CALL_PROFILE_NAME(2241, cvxPartQuickDisplayEdit)
+CALL_PROFILE_NAME(2242, cvxPartQuickDisplayEditInit)
+CALL_PROFILE_NAME(2243, cvxPartSmdAtGet)
+CALL_PROFILE_NAME(2244, cvxPartSmdAtSet)
+CALL_PROFILE_NAME(2245, cvxPartInqSmdStatFcs)
+CALL_PROFILE_NAME(2246, cvxPartInqSmdStatFace)
+CALL_PROFILE_NAME(2247, cvxPartInqSmdPairFaces)
+CALL_PROFILE_NAME(2248, cvxPartInqSmdSrfType)
+CALL_PROFILE_NAME(2249, cvxPartInqShtMetalThick)
+CALL_PROFILE_NAME(2250, cvxPartSmdStatFaceSet)
+CALL_PROFILE_NAME(2251, cvxPartGetFlatSolids)
+CALL_PROFILE_NAME(2252, cvxPartInqFlattens)
+CALL_PROFILE_NAME(2253, cvxPartInqVars)
+CALL_PROFILE_NAME(2254, cvxPartInqEqnAllId)
+CALL_PROFILE_NAME(2255, cvxPartVarAdd)
+CALL_PROFILE_NAME(2256, cvxPartVarGet)
+CALL_PROFILE_NAME(2257, cvxPartVarGetById)
+CALL_PROFILE_NAME(2258, cvxPartVarSet)
+CALL_PROFILE_NAME(2259, cvxPartEqnMoveToEqnSet)
+CALL_PROFILE_NAME(2260, cvxPartVarAddToEqnSet)
+CALL_PROFILE_NAME(2261, cvxPartEqnSet)
+CALL_PROFILE_NAME(2262, cvxPartEqnSetWithName)
+CALL_PROFILE_NAME(2263, cvxPartInqView)
+CALL_PROFILE_NAME(2264, cvxPartInqViews)
+CALL_PROFILE_NAME(2265, cvxPartViewAddInit)
+CALL_PROFILE_NAME(2266, cvxPartViewAdd)
+CALL_PROFILE_NAME(2267, cvxPartViewRecord)
+CALL_PROFILE_NAME(2268, cvxPartShowAll)
+CALL_PROFILE_NAME(2269, cvxPartShowTarg)
+CALL_PROFILE_NAME(2270, cvxPartShowPreview)
+CALL_PROFILE_NAME(2271, cvxPartClosePreview)
+CALL_PROFILE_NAME(2272, ZwPicksetInformationGet)
+CALL_PROFILE_NAME(2273, ZwPicksetListGet)
+CALL_PROFILE_NAME(2274, ZwPicksetDelete)
+CALL_PROFILE_NAME(2275, ZwPicksetCreate)
+CALL_PROFILE_NAME(2276, ZwPicksetRename)
+CALL_PROFILE_NAME(2277, ZwPicksetEntityAdd)
+CALL_PROFILE_NAME(2278, ZwPicksetEntityDelete)
+CALL_PROFILE_NAME(2279, ZwPMIDimensionLabelCreate)
+CALL_PROFILE_NAME(2280, ZwPMIDimensionFeatureControlCreateByText)
+CALL_PROFILE_NAME(2281, ZwFeatureTextBalloonCreate)
+CALL_PROFILE_NAME(2282, ZwPMIDimensionDiscreteDataGet)
+CALL_PROFILE_NAME(2283, ZwPMIDimensionDiscreteDataFree)
+CALL_PROFILE_NAME(2284, ZwPMISymbolDiscreteDataGet)
+CALL_PROFILE_NAME(2285, ZwPMISymbolDiscreteDataFree)
+CALL_PROFILE_NAME(2286, ZwPMITableDiscreteDataGet)
+CALL_PROFILE_NAME(2287, ZwPMITableDiscreteDataFree)
+CALL_PROFILE_NAME(2288, ZwPMIAligmentPlaneGet)
+CALL_PROFILE_NAME(2289, ZwPMIAttachedViewListGet)
+CALL_PROFILE_NAME(2290, ZwPointListGet)
+CALL_PROFILE_NAME(2291, ZwPointGetByPick)
+CALL_PROFILE_NAME(2292, ZwCursorGet)
+CALL_PROFILE_NAME(2293, ZwPointTranslateByDistance)
+CALL_PROFILE_NAME(2294, ZwPointPolygonTriangulation)
+CALL_PROFILE_NAME(2295, ZwPointDistanceGet)
+CALL_PROFILE_NAME(2296, ZwMathPlanePointDistanceGet)
+CALL_PROFILE_NAME(2297, ZwAxisTransform)
+CALL_PROFILE_NAME(2298, ZwAxisProjectionPointGet)
+CALL_PROFILE_NAME(2299, ZwAxisPointDistanceGet)
+CALL_PROFILE_NAME(2300, ZwAxisPointGetByDistance)
+CALL_PROFILE_NAME(2301, ZwMathPlaneGetByPoint)
+CALL_PROFILE_NAME(2302, ZwPlaneProjectPointGetByDirection)
+CALL_PROFILE_NAME(2303, ZwFacePointGetByBoundingBoxCenter)
+CALL_PROFILE_NAME(2304, ZwPointOnEntityCheck)
+CALL_PROFILE_NAME(2305, ZwMathPlanePointGetByXYDistance)
+CALL_PROFILE_NAME(2306, ZwMathLinerSegmentPoint2Get)
+CALL_PROFILE_NAME(2307, ZwMathLinerSegmentPointGet)
+CALL_PROFILE_NAME(2308, ZwPreEdgePointDistanceGet)
+CALL_PROFILE_NAME(2309, ZwPreEdgeDifferentiate)
+CALL_PROFILE_NAME(2310, cvxRootActivate)
+CALL_PROFILE_NAME(2311, cvxRootActivate2)
+CALL_PROFILE_NAME(2312, cvxRootActivateLoadAsmCtx)
+CALL_PROFILE_NAME(2313, cvxRootAdd)
+CALL_PROFILE_NAME(2314, cvxRootAdd2)
+CALL_PROFILE_NAME(2315, cvxRootAdd2Bg)
+CALL_PROFILE_NAME(2316, cvxRootCopy)
+CALL_PROFILE_NAME(2317, cvxRootDel)
+CALL_PROFILE_NAME(2318, cvxRootExit)
+CALL_PROFILE_NAME(2319, cvxRootId)
+CALL_PROFILE_NAME(2320, cvxRootInqActive)
+CALL_PROFILE_NAME(2321, cvxRootInqAsm)
+CALL_PROFILE_NAME(2322, cvxRootInqMod)
+CALL_PROFILE_NAME(2323, cvxRootInqModByName)
+CALL_PROFILE_NAME(2324, cvxRootInqModSinceRegen)
+CALL_PROFILE_NAME(2325, cvxRootInqSymbol)
+CALL_PROFILE_NAME(2326, cvxRootIsAsm)
+CALL_PROFILE_NAME(2327, cvxRootList)
+CALL_PROFILE_NAME(2328, cvxRootPreviewGet)
+CALL_PROFILE_NAME(2329, cvxRootPreviewSet)
+CALL_PROFILE_NAME(2330, cvxRootTemplateFile)
+CALL_PROFILE_NAME(2331, cvxRootRename)
+CALL_PROFILE_NAME(2332, cvxRootRename2)
+CALL_PROFILE_NAME(2333, cvxRootRenameMulti)
+CALL_PROFILE_NAME(2334, cvxRootRenameMultiByLongPath)
+CALL_PROFILE_NAME(2335, cvxRootVarGet)
+CALL_PROFILE_NAME(2336, cvxRootVarSet)
+CALL_PROFILE_NAME(2337, cvxRootVisibility)
+CALL_PROFILE_NAME(2338, cvxRootInqSheetMetal)
+CALL_PROFILE_NAME(2339, cvxRootAtItemGet)
+CALL_PROFILE_NAME(2340, cvxRootAtItemSet)
+CALL_PROFILE_NAME(2341, cvxRootCustomDataSet)
+CALL_PROFILE_NAME(2342, cvxRootCustomDataGet)
+CALL_PROFILE_NAME(2343, cvxRootCustomDataDel)
+CALL_PROFILE_NAME(2344, cvxRootCustomDataAdd)
+CALL_PROFILE_NAME(2345, cvxRootInqCustomData)
+CALL_PROFILE_NAME(2346, cvxRootCustomDataGetAll)
+CALL_PROFILE_NAME(2347, cvxRootCustomDataGetById)
+CALL_PROFILE_NAME(2348, cvxRootCustomDataModById)
+CALL_PROFILE_NAME(2349, cvxRootCustomDataDelById)
+CALL_PROFILE_NAME(2350, cvxRootSeparate)
+CALL_PROFILE_NAME(2351, cvxRootSeparateInit)
+CALL_PROFILE_NAME(2352, ZwShapeListGet)
+CALL_PROFILE_NAME(2353, ZwShapeEdgeSewAll)
+CALL_PROFILE_NAME(2354, ZwShapeFaceListGet)
+CALL_PROFILE_NAME(2355, ZwShapeEdgeListGet)
+CALL_PROFILE_NAME(2356, ZwShapeThicknessGet)
+CALL_PROFILE_NAME(2357, ZwShapeOpenCheck)
+CALL_PROFILE_NAME(2358, ZwShapeInternalAreaGet)
+CALL_PROFILE_NAME(2359, ZwShapeInterferenceTypeGet)
+CALL_PROFILE_NAME(2360, ZwShapeInterferenceCheck)
+CALL_PROFILE_NAME(2361, ZwSheetMetalAttributeGet)
+CALL_PROFILE_NAME(2362, ZwSheetMetalAttributeSet)
+CALL_PROFILE_NAME(2363, ZwBendInformationGet)
+CALL_PROFILE_NAME(2364, ZwSheetMetalFlangeProfileCorrection)
+CALL_PROFILE_NAME(2365, ZwSheetMetalFaceSideAndThickFind)
+CALL_PROFILE_NAME(2366, ZwSheetMetalFaceSideAndThickFree)
+CALL_PROFILE_NAME(2367, ZwSheetMetalFlangeInterferenceCheck)
+CALL_PROFILE_NAME(2368, ZwSheetMetalFoldStateGet)
+CALL_PROFILE_NAME(2369, ZwSketch3DCurveListGet)
+CALL_PROFILE_NAME(2370, cvxSkInqDim)
+CALL_PROFILE_NAME(2371, cvxSkInqDimType)
+CALL_PROFILE_NAME(2372, cvxSkInqDimRefFlag)
+CALL_PROFILE_NAME(2373, cvxSkInqPlane)
+CALL_PROFILE_NAME(2374, cvxSkInqPlanes)
+CALL_PROFILE_NAME(2375, cvxSkIsCosmetic)
+CALL_PROFILE_NAME(2376, cvxSkIsExternal)
+CALL_PROFILE_NAME(2377, cvxSkInqExternalSk)
+CALL_PROFILE_NAME(2378, cvxSkInqExternalSkByLongPath)
+CALL_PROFILE_NAME(2379, cvxSkInqArea)
+CALL_PROFILE_NAME(2380, cvxSkInqOverlap)
+CALL_PROFILE_NAME(2381, cvxSkActivate)
+CALL_PROFILE_NAME(2382, cvxSkInqAxis)
+CALL_PROFILE_NAME(2383, cvxSkInqAllAxis)
+CALL_PROFILE_NAME(2384, cvxSkInqAllAxisById)
+CALL_PROFILE_NAME(2385, cvxSkInqAxisDir)
+CALL_PROFILE_NAME(2386, cvxSkInqGeom)
+CALL_PROFILE_NAME(2387, cvxSkInqGeomById)
+CALL_PROFILE_NAME(2388, cvxSkInqGeomX)
+CALL_PROFILE_NAME(2389, cvxSkInqGeomXById)
+CALL_PROFILE_NAME(2390, cvxSkInqPnt)
+CALL_PROFILE_NAME(2391, cvxSkInqPntById)
+CALL_PROFILE_NAME(2392, cvxSkInqRef)
+CALL_PROFILE_NAME(2393, cvxSkInqRefById)
+CALL_PROFILE_NAME(2394, cvxSkInqText)
+CALL_PROFILE_NAME(2395, cvxSkInqTextById)
+CALL_PROFILE_NAME(2396, cvxSkInqCns)
+CALL_PROFILE_NAME(2397, cvxSkInqCnsById)
+CALL_PROFILE_NAME(2398, cvxSkInqCrvConnect)
+CALL_PROFILE_NAME(2399, cvxSkEntWireType)
+CALL_PROFILE_NAME(2400, cvxSkSetWireType)
+CALL_PROFILE_NAME(2401, cvxSkInqReadyText)
+CALL_PROFILE_NAME(2402, cvxSkReadyTextInqCrvs)
+CALL_PROFILE_NAME(2403, cvxSkReadyTextInqText)
+CALL_PROFILE_NAME(2404, cvxSkReadyTextModText)
+CALL_PROFILE_NAME(2405, cvxReadyTextFree)
+CALL_PROFILE_NAME(2406, cvxSkInqBlockReferences)
+CALL_PROFILE_NAME(2407, cvxSkInqSketchBlocks)
+CALL_PROFILE_NAME(2408, cvxSkBlockActivate)
+CALL_PROFILE_NAME(2409, cvxSkBlockGetSketch)
+CALL_PROFILE_NAME(2410, cvxSkBlockRefGetDefinition)
+CALL_PROFILE_NAME(2411, cvxSkBlockInqGeom)
+CALL_PROFILE_NAME(2412, cvxSkBlockInqPnt)
+CALL_PROFILE_NAME(2413, cvxSkBlockInqDim)
+CALL_PROFILE_NAME(2414, cvxSkBlockInqGeomX)
+CALL_PROFILE_NAME(2415, cvxSkBlockInqRefs)
+CALL_PROFILE_NAME(2416, cvxSkInqCnsType)
+CALL_PROFILE_NAME(2417, cvxSkInqCnsGeoms)
+CALL_PROFILE_NAME(2418, cvxSkRegen)
+CALL_PROFILE_NAME(2419, cvxSkVarAdd)
+CALL_PROFILE_NAME(2420, cvxSkVarGet)
+CALL_PROFILE_NAME(2421, cvxSkVarSet)
+CALL_PROFILE_NAME(2422, cvxSkInqVars)
+CALL_PROFILE_NAME(2423, ZwSketchConstraintSolve)
+CALL_PROFILE_NAME(2424, ZwSketchConstraintStatusGet)
+CALL_PROFILE_NAME(2425, ZwSketchConstraintStatusDataFree)
+CALL_PROFILE_NAME(2426, ZwSketchGeometryConstraintListGet)
+CALL_PROFILE_NAME(2427, ZwSketchPatternConstraintDataGet)
+CALL_PROFILE_NAME(2428, ZwSketchLinearDimensionCreate)
+CALL_PROFILE_NAME(2429, ZwSketchLinearOffsetDimensionCreate)
+CALL_PROFILE_NAME(2430, ZwSketchAngularDimensionCreate)
+CALL_PROFILE_NAME(2431, ZwSketchRadialDimensionCreate)
+CALL_PROFILE_NAME(2432, ZwSketchArcLengthDimensionCreate)
+CALL_PROFILE_NAME(2433, ZwSketchSymmetryDimensionCreate)
+CALL_PROFILE_NAME(2434, ZwSketchPerimeterDimensionCreate)
+CALL_PROFILE_NAME(2435, ZwSketchDimensionListGet)
+CALL_PROFILE_NAME(2436, ZwSketchDimensionGeometryListGet)
+CALL_PROFILE_NAME(2437, ZwSketchGeometryDimensionListGet)
+CALL_PROFILE_NAME(2438, ZwSketchDimensionTypeGet)
+CALL_PROFILE_NAME(2439, ZwSketchDimensionPointGet)
+CALL_PROFILE_NAME(2440, ZwSketchDimensionWeakCheck)
+CALL_PROFILE_NAME(2441, ZwSketchDimensionReferenceStateGet)
+CALL_PROFILE_NAME(2442, ZwSketchDimensionReferenceStateSet)
+CALL_PROFILE_NAME(2443, ZwSketchSymbolImageCreate)
+CALL_PROFILE_NAME(2444, ZwSketchSymbolImageListGet)
+CALL_PROFILE_NAME(2445, ZwSketchSymbolImageInit)
+CALL_PROFILE_NAME(2446, ZwSketchListGet)
+CALL_PROFILE_NAME(2447, ZwSketchCreateByMatrix)
+CALL_PROFILE_NAME(2448, ZwSketchCreateByDataInit)
+CALL_PROFILE_NAME(2449, ZwSketchCreateByData)
+CALL_PROFILE_NAME(2450, ZwSketchActivate)
+CALL_PROFILE_NAME(2451, ZwSketchCancel)
+CALL_PROFILE_NAME(2452, ZwSketch2DCurveListGet)
+CALL_PROFILE_NAME(2453, ZwSketchTextListGet)
+CALL_PROFILE_NAME(2454, ZwSketchGeneralTableListGet)
+CALL_PROFILE_NAME(2455, ZwSketchArcCreateByThreePointsInit)
+CALL_PROFILE_NAME(2456, ZwSketchArcCreateByThreePoints)
+CALL_PROFILE_NAME(2457, ZwSketchCircleCreateByRadiusInit)
+CALL_PROFILE_NAME(2458, ZwSketchCircleCreateByRadius)
+CALL_PROFILE_NAME(2459, ZwSketchLineCreateBy2DPoints)
+CALL_PROFILE_NAME(2460, ZwSketchReadyTextCreateInit)
+CALL_PROFILE_NAME(2461, ZwSketchReadyTextCreate)
+CALL_PROFILE_NAME(2462, ZwReadyTextDataFree)
+CALL_PROFILE_NAME(2463, ZwSketchReadyTextDataGet)
+CALL_PROFILE_NAME(2464, ZwSketchReadyTextOutlineListGet)
+CALL_PROFILE_NAME(2465, ZwUserTableCreateByRowAndColumn)
+CALL_PROFILE_NAME(2466, ZwUserTableCreateByTemplate)
+CALL_PROFILE_NAME(2467, ZwTableInsert)
+CALL_PROFILE_NAME(2468, ZwTableRowCountGet)
+CALL_PROFILE_NAME(2469, ZwTableColumnCountGet)
+CALL_PROFILE_NAME(2470, ZwTableRowInsert)
+CALL_PROFILE_NAME(2471, ZwTableColumnInsert)
+CALL_PROFILE_NAME(2472, ZwTableRowDelete)
+CALL_PROFILE_NAME(2473, ZwTableColumnDelete)
+CALL_PROFILE_NAME(2474, ZwTableCellTextGet)
+CALL_PROFILE_NAME(2475, ZwTableCellTextSet)
+CALL_PROFILE_NAME(2476, ZwTableCellDataTypeGet)
+CALL_PROFILE_NAME(2477, ZwTableCellDataTypeSet)
+CALL_PROFILE_NAME(2478, ZwTableRowHeightGet)
+CALL_PROFILE_NAME(2479, ZwTableRowHeightSet)
+CALL_PROFILE_NAME(2480, ZwTableColumnWidthGet)
+CALL_PROFILE_NAME(2481, ZwTableColumnWidthSet)
+CALL_PROFILE_NAME(2482, ZwTableCellMerge)
+CALL_PROFILE_NAME(2483, ZwTableCellUnMerge)
+CALL_PROFILE_NAME(2484, ZwTableCellAttributeGet)
+CALL_PROFILE_NAME(2485, ZwTableCellAttributeSet)
+CALL_PROFILE_NAME(2486, ZwTableAttributeGet)
+CALL_PROFILE_NAME(2487, ZwTableAttributeSet)
+CALL_PROFILE_NAME(2488, ZwCommandParameterEntityAdd)
+CALL_PROFILE_NAME(2489, ZwCommandParameterDirectionSet)
+CALL_PROFILE_NAME(2490, ZwTemplateCommandOptionsGet)
+CALL_PROFILE_NAME(2491, ZwTemplateCommandOptionsSet)
+CALL_PROFILE_NAME(2492, ZwTemplateCommandListModeGet)
+CALL_PROFILE_NAME(2493, ZwTemplateCommandListModeSet)
+CALL_PROFILE_NAME(2494, cvxEntTextInq)
+CALL_PROFILE_NAME(2495, cvxEntTextMod)
+CALL_PROFILE_NAME(2496, cvxEntTextAtGet)
+CALL_PROFILE_NAME(2497, cvxEntTextAtSet)
+CALL_PROFILE_NAME(2498, cvxEntTextLocGet)
+CALL_PROFILE_NAME(2499, cvxEntPathInit)
+CALL_PROFILE_NAME(2500, cvxEntPathInqActive)
+CALL_PROFILE_NAME(2501, cvxEntPathAppendEnt)
+CALL_PROFILE_NAME(2502, cvxEntPathAppendPath)
+CALL_PROFILE_NAME(2503, cvxEntPathToRoot)
+CALL_PROFILE_NAME(2504, cvxEntPathCmp)
+CALL_PROFILE_NAME(2505, cvxEntPathGetParentComp)
+CALL_PROFILE_NAME(2506, cvxComboCurrentItem)
+CALL_PROFILE_NAME(2507, cvxComboSetCurrentItem)
+CALL_PROFILE_NAME(2508, cvxComboCurrentText)
+CALL_PROFILE_NAME(2509, cvxComboCurrentTextSet)
+CALL_PROFILE_NAME(2510, cvxComboItemCount)
+CALL_PROFILE_NAME(2511, ZwUiCommandTextGet)
+CALL_PROFILE_NAME(2512, ZwUiCommandTextSet)
+CALL_PROFILE_NAME(2513, ZwUiCommandIconGet)
+CALL_PROFILE_NAME(2514, ZwUiCommandIconSet)
+CALL_PROFILE_NAME(2515, ZwUiCommandStateGet)
+CALL_PROFILE_NAME(2516, ZwUiCommandStateSet)
+CALL_PROFILE_NAME(2517, ZwUiDrawbackBoxGroupFold)
+CALL_PROFILE_NAME(2518, ZwUiFileDialogHide)
+CALL_PROFILE_NAME(2519, ZwUiFileDialogUnHide)
+CALL_PROFILE_NAME(2520, cvxFormCreate)
+CALL_PROFILE_NAME(2521, cvxFormShow)
+CALL_PROFILE_NAME(2522, cvxFormHide)
+CALL_PROFILE_NAME(2523, cvxFormKill)
+CALL_PROFILE_NAME(2524, cvxFormLogKill)
+CALL_PROFILE_NAME(2525, cvxFormRefresh)
+CALL_PROFILE_NAME(2526, cvxFormWait)
+CALL_PROFILE_NAME(2527, cvxFormWaitExit)
+CALL_PROFILE_NAME(2528, cvxFormGetSize)
+CALL_PROFILE_NAME(2529, cvxFormResize)
+CALL_PROFILE_NAME(2530, cvxFormAdjustSize)
+CALL_PROFILE_NAME(2531, cvxFormAddTo)
+CALL_PROFILE_NAME(2532, cvxFormInsertTo)
+CALL_PROFILE_NAME(2533, cvxFormRemoveFrom)
+CALL_PROFILE_NAME(2534, cvxFormTitleGet)
+CALL_PROFILE_NAME(2535, cvxFormTitleSet)
+CALL_PROFILE_NAME(2536, cvxFormDataGet)
+CALL_PROFILE_NAME(2537, cvxFormDataSet)
+CALL_PROFILE_NAME(2538, cvxFormFunc)
+CALL_PROFILE_NAME(2539, cvxFormCallback)
+CALL_PROFILE_NAME(2540, cvxFormFieldGetCallback)
+CALL_PROFILE_NAME(2541, cvxFormActiveField)
+CALL_PROFILE_NAME(2542, cvxFormState)
+CALL_PROFILE_NAME(2543, cvxFormVisibleSet)
+CALL_PROFILE_NAME(2544, cvxFormFieldVisSet)
+CALL_PROFILE_NAME(2545, cvxFormInqFld)
+CALL_PROFILE_NAME(2546, cvxTplInqFields)
+CALL_PROFILE_NAME(2547, cvxTplInqFieldType)
+CALL_PROFILE_NAME(2548, cvxTplInqFieldOptions)
+CALL_PROFILE_NAME(2549, cvxFormUpdate)
+CALL_PROFILE_NAME(2550, cvxFieldFocusSet)
+CALL_PROFILE_NAME(2551, cvxFieldNumItems)
+CALL_PROFILE_NAME(2552, cvxFieldClear)
+CALL_PROFILE_NAME(2553, cvxFieldDisable)
+CALL_PROFILE_NAME(2554, cvxFieldEnable)
+CALL_PROFILE_NAME(2555, cvxFieldEnableGet)
+CALL_PROFILE_NAME(2556, cvxFilterItemApply)
+CALL_PROFILE_NAME(2557, cvxFieldImageSet)
+CALL_PROFILE_NAME(2558, cvxFieldCaretSet)
+CALL_PROFILE_NAME(2559, cvxFieldTipSet)
+CALL_PROFILE_NAME(2560, cvxFieldInitFont)
+CALL_PROFILE_NAME(2561, cvxItemAdd)
+CALL_PROFILE_NAME(2562, cvxItemGet)
+CALL_PROFILE_NAME(2563, cvxItemSet)
+CALL_PROFILE_NAME(2564, cvxItemModify)
+CALL_PROFILE_NAME(2565, cvxItemDel)
+CALL_PROFILE_NAME(2566, cvxItemFind)
+CALL_PROFILE_NAME(2567, cvxItemCbxSet)
+CALL_PROFILE_NAME(2568, cvxItemSelect)
+CALL_PROFILE_NAME(2569, cvxItemSelectText)
+CALL_PROFILE_NAME(2570, cvxItemSelected)
+CALL_PROFILE_NAME(2571, cvxItemStateGet)
+CALL_PROFILE_NAME(2572, cvxItemStateSet)
+CALL_PROFILE_NAME(2573, cvxItemGetCheckState)
+CALL_PROFILE_NAME(2574, cvxItemVisibleSet)
+CALL_PROFILE_NAME(2575, cvxItemVisibleGet)
+CALL_PROFILE_NAME(2576, ZwUiFormItemGet)
+CALL_PROFILE_NAME(2577, ZwUiFormItemSet)
+CALL_PROFILE_NAME(2578, ZwUiFormImageSet)
+CALL_PROFILE_NAME(2579, ZwUiFormFocusGet)
+CALL_PROFILE_NAME(2580, ZwUiFormFocusSet)
+CALL_PROFILE_NAME(2581, ZwUiFormPositionSet)
+CALL_PROFILE_NAME(2582, cvxUiSettingsCount)
+CALL_PROFILE_NAME(2583, cvxUiSettingsCreate)
+CALL_PROFILE_NAME(2584, cvxUiSettingsRename)
+CALL_PROFILE_NAME(2585, cvxUiSettingsRemove)
+CALL_PROFILE_NAME(2586, cvxUiSettingsImport)
+CALL_PROFILE_NAME(2587, cvxUiSettingsExport)
+CALL_PROFILE_NAME(2588, cvxUiSettingsExists)
+CALL_PROFILE_NAME(2589, cvxUiSettingsApply)
+CALL_PROFILE_NAME(2590, cvxUiSettingsReset)
+CALL_PROFILE_NAME(2591, cvxUiSettingsFetch)
+CALL_PROFILE_NAME(2592, cvxCursorSet)
+CALL_PROFILE_NAME(2593, cvxCursorRestore)
+CALL_PROFILE_NAME(2594, cvxProgress)
+CALL_PROFILE_NAME(2595, cvxListCallbackParamGet)
+CALL_PROFILE_NAME(2596, cvxListItemToolTipSet)
+CALL_PROFILE_NAME(2597, cvxListItemToolTipGet)
+CALL_PROFILE_NAME(2598, ZwUiListWidgetIconSet)
+CALL_PROFILE_NAME(2599, cvxPopupShow)
+CALL_PROFILE_NAME(2600, cvxPopupDefine)
+CALL_PROFILE_NAME(2601, cvxPopupUpdate)
+CALL_PROFILE_NAME(2602, cvxPopupSetVisible)
+CALL_PROFILE_NAME(2603, cvxPopupMenuCnt)
+CALL_PROFILE_NAME(2604, cvxPopupSubMenuCnt)
+CALL_PROFILE_NAME(2605, cvxPopupSubMenuItemInsert)
+CALL_PROFILE_NAME(2606, cvxPopupSubMenuItemRemove)
+CALL_PROFILE_NAME(2607, cvxPopupSubMenuActionsRemove)
+CALL_PROFILE_NAME(2608, cvxPopupSubMenuSeparatorInsert)
+CALL_PROFILE_NAME(2609, cvxPopupSubMenuSetVisible)
+CALL_PROFILE_NAME(2610, cvxPopupItemIsExist)
+CALL_PROFILE_NAME(2611, cvxPopupItemInsert)
+CALL_PROFILE_NAME(2612, cvxPopupItemRemove)
+CALL_PROFILE_NAME(2613, cvxPopupItemActionGet)
+CALL_PROFILE_NAME(2614, cvxPopupItemSetAction)
+CALL_PROFILE_NAME(2615, cvxPopupItemLabelGet)
+CALL_PROFILE_NAME(2616, cvxPopupItemCheckedGet)
+CALL_PROFILE_NAME(2617, cvxPopupItemVisibleGet)
+CALL_PROFILE_NAME(2618, cvxPopupItemSetVisibleByAction)
+CALL_PROFILE_NAME(2619, cvxPopupItemSetEnabledByAction)
+CALL_PROFILE_NAME(2620, cvxPopupItemSetCheckedByAction)
+CALL_PROFILE_NAME(2621, ZwUiPopupSubMenuItemInsert)
+CALL_PROFILE_NAME(2622, ZwUiPopupItemInsert)
+CALL_PROFILE_NAME(2623, cvxRibbonSetStatus)
+CALL_PROFILE_NAME(2624, cvxSetTitleAppend)
+CALL_PROFILE_NAME(2625, ZwUiRibbonPageVisibleSet)
+CALL_PROFILE_NAME(2626, ZwUiRibbonPageVisibleGet)
+CALL_PROFILE_NAME(2627, cvxSliderLimitGet)
+CALL_PROFILE_NAME(2628, cvxSliderLimitSet)
+CALL_PROFILE_NAME(2629, cvxTableAtSetInit)
+CALL_PROFILE_NAME(2630, cvxTableAtSet)
+CALL_PROFILE_NAME(2631, cvxTableSizeSet)
+CALL_PROFILE_NAME(2632, cvxTableSetSelRange)
+CALL_PROFILE_NAME(2633, cvxTableGetSelRange)
+CALL_PROFILE_NAME(2634, cvxTableUnselectAll)
+CALL_PROFILE_NAME(2635, cvxTableCallBackParamGet)
+CALL_PROFILE_NAME(2636, cvxTableCallBackParamFree)
+CALL_PROFILE_NAME(2637, cvxTableRowCnt)
+CALL_PROFILE_NAME(2638, cvxTableColCnt)
+CALL_PROFILE_NAME(2639, cvxTableRowInsert)
+CALL_PROFILE_NAME(2640, cvxTableRowRemove)
+CALL_PROFILE_NAME(2641, cvxTableColInsert)
+CALL_PROFILE_NAME(2642, cvxTableColRemove)
+CALL_PROFILE_NAME(2643, cvxTableComboSet)
+CALL_PROFILE_NAME(2644, cvxTableComboSet2)
+CALL_PROFILE_NAME(2645, cvxTableComboGet)
+CALL_PROFILE_NAME(2646, cvxTableIndexComboSet)
+CALL_PROFILE_NAME(2647, cvxTableInputComboSet)
+CALL_PROFILE_NAME(2648, cvxTableIndexComboSet2)
+CALL_PROFILE_NAME(2649, cvxTableInputComboSet2)
+CALL_PROFILE_NAME(2650, cvxTableComboSetOption)
+CALL_PROFILE_NAME(2651, cvxTableTypeGet)
+CALL_PROFILE_NAME(2652, cvxTableVisSet)
+CALL_PROFILE_NAME(2653, cvxTableIsCheck)
+CALL_PROFILE_NAME(2654, cvxTableCheckSet)
+CALL_PROFILE_NAME(2655, cvxTableCellTextGet)
+CALL_PROFILE_NAME(2656, cvxTableCellEnableSet)
+CALL_PROFILE_NAME(2657, cvxTableCellTipSet)
+CALL_PROFILE_NAME(2658, cvxTableCellTipGet)
+CALL_PROFILE_NAME(2659, cvxTableCellTextSet)
+CALL_PROFILE_NAME(2660, cvxTableCellTextSet2)
+CALL_PROFILE_NAME(2661, cvxTableDateSet)
+CALL_PROFILE_NAME(2662, cvxTableDateGet)
+CALL_PROFILE_NAME(2663, cvxTableColorSet)
+CALL_PROFILE_NAME(2664, cvxTableColorGet)
+CALL_PROFILE_NAME(2665, cvxTableNumSet)
+CALL_PROFILE_NAME(2666, cvxTableNumGet)
+CALL_PROFILE_NAME(2667, cvxTableGetText)
+CALL_PROFILE_NAME(2668, cvxTableHorHeaderVisibleSet)
+CALL_PROFILE_NAME(2669, cvxTableVerHeaderVisibleSet)
+CALL_PROFILE_NAME(2670, cvxTableSetHorHeaderList)
+CALL_PROFILE_NAME(2671, cvxTableSetVerHeaderList)
+CALL_PROFILE_NAME(2672, cvxTableSetHeaderAlignment)
+CALL_PROFILE_NAME(2673, cvxTableSetHeaderColResizeMode)
+CALL_PROFILE_NAME(2674, cvxTableSetHeaderSectionSize)
+CALL_PROFILE_NAME(2675, cvxTableHeaderCellCheck)
+CALL_PROFILE_NAME(2676, cvxTabWidgetItemVisibleSet)
+CALL_PROFILE_NAME(2677, cvxTreeSetHeaderIcon)
+CALL_PROFILE_NAME(2678, cvxTreeSetHeaderText)
+CALL_PROFILE_NAME(2679, cvxTreeHeaderGetSize)
+CALL_PROFILE_NAME(2680, cvxTreeSetHeaderTextAlignment)
+CALL_PROFILE_NAME(2681, cvxTreeSetColumnCount)
+CALL_PROFILE_NAME(2682, cvxTreeGetColumnCount)
+CALL_PROFILE_NAME(2683, cvxTreeSetColumnWidth)
+CALL_PROFILE_NAME(2684, cvxTreeGetColumnWidth)
+CALL_PROFILE_NAME(2685, cvxTreeSetColumnHidden)
+CALL_PROFILE_NAME(2686, cvxTreeIsColumnHidden)
+CALL_PROFILE_NAME(2687, cvxTreeAutoResizeColumn)
+CALL_PROFILE_NAME(2688, cvxTreeExpandAll)
+CALL_PROFILE_NAME(2689, cvxTreeCollapseAll)
+CALL_PROFILE_NAME(2690, cvxTreeUnselectAll)
+CALL_PROFILE_NAME(2691, cvxTreeSetSelectionMode)
+CALL_PROFILE_NAME(2692, cvxTreeSetSelectionBehavior)
+CALL_PROFILE_NAME(2693, cvxTreeGetCbParam)
+CALL_PROFILE_NAME(2694, cvxTreeItemsCount)
+CALL_PROFILE_NAME(2695, cvxTreeAddItem)
+CALL_PROFILE_NAME(2696, cvxTreeSetItemFlag)
+CALL_PROFILE_NAME(2697, cvxTreeGetItemFlag)
+CALL_PROFILE_NAME(2698, cvxTreeSetItemIconNameByColumn)
+CALL_PROFILE_NAME(2699, cvxTreeSetItemTextByColumn)
+CALL_PROFILE_NAME(2700, cvxTreeGetItemTextByColumn)
+CALL_PROFILE_NAME(2701, cvxTreeSetItemTextColor)
+CALL_PROFILE_NAME(2702, cvxTreeGetDBIdByItem)
+CALL_PROFILE_NAME(2703, cvxTreeDeleteItem)
+CALL_PROFILE_NAME(2704, cvxTreeDeleteSubItem)
+CALL_PROFILE_NAME(2705, cvxTreeEditItemByLineEdit)
+CALL_PROFILE_NAME(2706, cvxTreeEditItemByComboBox)
+CALL_PROFILE_NAME(2707, cvxTreeGetPrevSiblingItem)
+CALL_PROFILE_NAME(2708, cvxTreeGetNextSiblingItem)
+CALL_PROFILE_NAME(2709, cvxTreeGetChildItem)
+CALL_PROFILE_NAME(2710, cvxTreeGetChildrenCount)
+CALL_PROFILE_NAME(2711, cvxTreeGetParentItem)
+CALL_PROFILE_NAME(2712, cvxTreeMoveItems)
+CALL_PROFILE_NAME(2713, cvxTreeGetDescendants)
+CALL_PROFILE_NAME(2714, cvxTreeGetSelectedItems)
+CALL_PROFILE_NAME(2715, cvxTreeIsItemSelected)
+CALL_PROFILE_NAME(2716, cvxTreeSelectItem)
+CALL_PROFILE_NAME(2717, cvxTreeSetItemCheckable)
+CALL_PROFILE_NAME(2718, cvxTreeGetItemCheckState)
+CALL_PROFILE_NAME(2719, cvxTreeSetItemCheckState)
+CALL_PROFILE_NAME(2720, cvxTreeItemIsExpand)
+CALL_PROFILE_NAME(2721, cvxTreeExpandItem)
+CALL_PROFILE_NAME(2722, cvxGetAngle)
+CALL_PROFILE_NAME(2723, cvxGetDistance)
+CALL_PROFILE_NAME(2724, cvxGetNumber)
+CALL_PROFILE_NAME(2725, cvxGetEnt)
+CALL_PROFILE_NAME(2726, cvxGetEnts)
+CALL_PROFILE_NAME(2727, cvxGetEntPath)
+CALL_PROFILE_NAME(2728, cvxGetEntPaths)
+CALL_PROFILE_NAME(2729, cvxGetEntsMultiFilter)
+CALL_PROFILE_NAME(2730, cvxGetEntPathsMultiFilter)
+CALL_PROFILE_NAME(2731, cvxGetExternalPick)
+CALL_PROFILE_NAME(2732, cvxGetPoint)
+CALL_PROFILE_NAME(2733, cvxGetPoints)
+CALL_PROFILE_NAME(2734, cvxGetPointOnEnt)
+CALL_PROFILE_NAME(2735, cvxGetPointsOnEnts)
+CALL_PROFILE_NAME(2736, cvxGetFile)
+CALL_PROFILE_NAME(2737, cvxGetFileByLongPath)
+CALL_PROFILE_NAME(2738, cvxGetFileActiveField)
+CALL_PROFILE_NAME(2739, cvxGetFolder)
+CALL_PROFILE_NAME(2740, cvxGetFolderByLongPath)
+CALL_PROFILE_NAME(2741, cvxGetFolderActiveField)
+CALL_PROFILE_NAME(2742, cvxGetResponse)
+CALL_PROFILE_NAME(2743, cvxGetString)
+CALL_PROFILE_NAME(2744, ZwFolderGet)
+CALL_PROFILE_NAME(2745, ZwNumberGet)
+CALL_PROFILE_NAME(2746, cvxPartInqEqnSetMembers)
+CALL_PROFILE_NAME(2747, cvxPartInqEqnAssociatedSet)
+CALL_PROFILE_NAME(2748, cvxEqGetExpByName)
+CALL_PROFILE_NAME(2749, cvxEqGetDescById)
+CALL_PROFILE_NAME(2750, cvxEqSetDescById)
+CALL_PROFILE_NAME(2751, cvxPartVarSubstitute)
+CALL_PROFILE_NAME(2752, cvxPartVarSubstituteResize)
+CALL_PROFILE_NAME(2753, cvxEqLoadFile)
+CALL_PROFILE_NAME(2754, cvxEqRegen)
+CALL_PROFILE_NAME(2755, cvxPartEqnDelete)
+CALL_PROFILE_NAME(2756, ZwVariableListGet)
+CALL_PROFILE_NAME(2757, ZwVariableListSet)
+CALL_PROFILE_NAME(2758, ZwVariableCreate)
+CALL_PROFILE_NAME(2759, ZwVariableStandardAttributeItemGet)
+CALL_PROFILE_NAME(2760, ZwVariableTextRefresh)
+CALL_PROFILE_NAME(2761, ZwVector2IsPerpendicular)
+CALL_PROFILE_NAME(2762, ZwVectorIsPerpendicular)
+CALL_PROFILE_NAME(2763, ZwVectorTripleScaleProduct)
+CALL_PROFILE_NAME(2764, ZwVector2Scaling)
+CALL_PROFILE_NAME(2765, ZwVectorScaling)
+CALL_PROFILE_NAME(2766, ZwVector4Scaling)
+CALL_PROFILE_NAME(2767, ZwVector2Subtraction)
+CALL_PROFILE_NAME(2768, ZwVectorSubtraction)
+CALL_PROFILE_NAME(2769, ZwVector2Magnitude)
+CALL_PROFILE_NAME(2770, ZwVectorMagnitude)
+CALL_PROFILE_NAME(2771, ZwVector2Dot)
+CALL_PROFILE_NAME(2772, ZwVectorDot)
+CALL_PROFILE_NAME(2773, ZwVector2Negated)
+CALL_PROFILE_NAME(2774, ZwVectorNegated)
+CALL_PROFILE_NAME(2775, ZwVector2IsEqual)
+CALL_PROFILE_NAME(2776, ZwVectorIsEqual)
+CALL_PROFILE_NAME(2777, ZwVector4IsEqual)
+CALL_PROFILE_NAME(2778, ZwVector2IsZero)
+CALL_PROFILE_NAME(2779, ZwVectorIsZero)
+CALL_PROFILE_NAME(2780, ZwVector4IsZero)
+CALL_PROFILE_NAME(2781, ZwVector2Sum)
+CALL_PROFILE_NAME(2782, ZwVectorSum)
+CALL_PROFILE_NAME(2783, ZwVector2AffineCombine)
+CALL_PROFILE_NAME(2784, ZwVectorAffineCombine)
+CALL_PROFILE_NAME(2785, ZwVector2LinearCombine)
+CALL_PROFILE_NAME(2786, ZwVectorLinearCombine)
+CALL_PROFILE_NAME(2787, ZwVector2ToVector3)
+CALL_PROFILE_NAME(2788, ZwVector3ToVector2)
+CALL_PROFILE_NAME(2789, ZwVector3ToVector4)
+CALL_PROFILE_NAME(2790, ZwVector3ToVector4WithWeight)
+CALL_PROFILE_NAME(2791, ZwVector4ToVector3)
+CALL_PROFILE_NAME(2792, ZwVector4ToVector3WithWeight)
+CALL_PROFILE_NAME(2793, ZwVector2LinearComponents)
+CALL_PROFILE_NAME(2794, ZwVectorLinearComponents)
+CALL_PROFILE_NAME(2795, ZwVectorNormalize)
+CALL_PROFILE_NAME(2796, ZwVectorInit)
+CALL_PROFILE_NAME(2797, ZwVectorAngleGet)
+CALL_PROFILE_NAME(2798, ZwVectorCrossProduct)
+CALL_PROFILE_NAME(2799, ZwVectorPerpendicularGet)
+CALL_PROFILE_NAME(2800, ZwVectorReverse)
+CALL_PROFILE_NAME(2801, ZwVectorParallelCheck)
+CALL_PROFILE_NAME(2802, ZwVectorTransform)
+CALL_PROFILE_NAME(2803, cvxViewIsSection)
+CALL_PROFILE_NAME(2804, cvxViewIsStandard)
+CALL_PROFILE_NAME(2805, cvxViewInqStandardType)
+CALL_PROFILE_NAME(2806, cvxViewActivate)
+CALL_PROFILE_NAME(2807, cvxViewExtent)
+CALL_PROFILE_NAME(2808, cvxViewGet)
+CALL_PROFILE_NAME(2809, cvxViewSet)
+CALL_PROFILE_NAME(2810, cvxViewOrigin)
+CALL_PROFILE_NAME(2811, cvxViewStd)
+CALL_PROFILE_NAME(2812, cvxViewSetBndBox)
+CALL_PROFILE_NAME(2813, cvxGetViewRect)
+CALL_PROFILE_NAME(2814, cvxCustomViewAdd)
+CALL_PROFILE_NAME(2815, cvxCustomViewActivate)
+CALL_PROFILE_NAME(2816, cvxCustomViewDel)
+CALL_PROFILE_NAME(2817, cvxCustomViewId)
+CALL_PROFILE_NAME(2818, cvxCustomViewListGet)
+CALL_PROFILE_NAME(2819, ZwViewParameterGet)
+CALL_PROFILE_NAME(2820, ZwViewParameterSet)
+CALL_PROFILE_NAME(2821, ZwViewMatrixGet)
+CALL_PROFILE_NAME(2822, ZwViewTransformMatrixGet)
+CALL_PROFILE_NAME(2823, ZwCustomViewNameGet)
+CALL_PROFILE_NAME(2824, ZwCustomViewNameSet)
+CALL_PROFILE_NAME(2825, ZwCustomViewGetByName)
+CALL_PROFILE_NAME(2826, ZwSectionViewNameSet)
+CALL_PROFILE_NAME(2827, ZwSectionViewNameGet)
+CALL_PROFILE_NAME(2828, ZwSectionViewListGet)
+CALL_PROFILE_NAME(2829, ZwSectionViewDirectionReverse)
+CALL_PROFILE_NAME(2830, ZwSectionViewParameterGet)
+CALL_PROFILE_NAME(2831, ZwSectionViewParameterInit)
+CALL_PROFILE_NAME(2832, ZwSectionViewCreate)
+CALL_PROFILE_NAME(2833, ZwSectionViewOnStateGet)
+CALL_PROFILE_NAME(2834, ZwSectionViewOnStateSet)
+CALL_PROFILE_NAME(2835, ZwSectionViewDatumPlaneInsert)
+CALL_PROFILE_NAME(2836, ZwSectionViewParameterSet)
+CALL_PROFILE_NAME(2837, ZwSectionViewComponentGet)
+CALL_PROFILE_NAME(2838, ZwSectionViewComponentSet)
+CALL_PROFILE_NAME(2839, ZwSectionViewCheck)
+CALL_PROFILE_NAME(2840, ZwSectionViewLocalDisplayControlSet)
+CALL_PROFILE_NAME(2841, ZwSectionViewGlobalDisplayControlSet)
+CALL_PROFILE_NAME(2842, ZwSectionViewLocalDisplayControlGet)
+CALL_PROFILE_NAME(2843, ZwSectionViewGlobalDisplayControlGet)
+CALL_PROFILE_NAME(2844, ZwSectionViewCurveAttributeGet)
+CALL_PROFILE_NAME(2845, ZwSectionViewCurveAttributeSet)
+CALL_PROFILE_NAME(2846, ZwSectionViewUpdate)
+CALL_PROFILE_NAME(2847, ZwSectionViewDatumCurveListInsert)
+CALL_PROFILE_NAME(2848, cvxOpCount)
+CALL_PROFILE_NAME(2849, cvxXnUndoCount)
+CALL_PROFILE_NAME(2850, cvxUndoRedoMarker)
+CALL_PROFILE_NAME(2851, cvxUndoRedo)
+CALL_PROFILE_NAME(2852, cvxUndoRedoTo)
+CALL_PROFILE_NAME(2853, cvxPartNameLastOp)
+CALL_PROFILE_NAME(2854, cvxXnBundle)
+CALL_PROFILE_NAME(2855, cvxUndoBundleStart)
+CALL_PROFILE_NAME(2856, cvxUndoBundleEnd)
+/*******************************************************************/
+/* Redirections of the API functions to their profiling slots */
+#elif !defined CALL_PROFILE_REDIRECTS
+#define CALL_PROFILE_REDIRECTS
+#define cvxShellAtGet CALL_PROFILE_CALL(0, cvxShellAtGet)
+#define cvxShellAtItemGet CALL_PROFILE_CALL(1, cvxShellAtItemGet)
+#define cvxShellAtItemSet CALL_PROFILE_CALL(2, cvxShellAtItemSet)
+#define cvxPartInqShapeOpen CALL_PROFILE_CALL(3, cvxPartInqShapeOpen)
+#define cvxPartInqShapeBox CALL_PROFILE_CALL(4, cvxPartInqShapeBox)
+#define cvxPartInqShapeMass CALL_PROFILE_CALL(5, cvxPartInqShapeMass)
+#define cvxPartShapeStructGet CALL_PROFILE_CALL(6, cvxPartShapeStructGet)
+#define cvxPartInqShapes CALL_PROFILE_CALL(7, cvxPartInqShapes)
+#define cvxPartInqShapeComp CALL_PROFILE_CALL(8, cvxPartInqShapeComp)
+#define cvxPartInqShapeEdges CALL_PROFILE_CALL(9, cvxPartInqShapeEdges)
+#define cvxPartInqShapeFaces CALL_PROFILE_CALL(10, cvxPartInqShapeFaces)
+#define cvxPartInqShapeFtrs CALL_PROFILE_CALL(11, cvxPartInqShapeFtrs)
+#define cvxPartInqShapeExtreme CALL_PROFILE_CALL(12, cvxPartInqShapeExtreme)
+#define cvxInstShpGetMatrix CALL_PROFILE_CALL(13, cvxInstShpGetMatrix)
+#define cvxPartInqEntShape CALL_PROFILE_CALL(14, cvxPartInqEntShape)
+#define Zw3DBomDataGet CALL_PROFILE_CALL(15, Zw3DBomDataGet)
+#define Zw3DBomDataFree CALL_PROFILE_CALL(16, Zw3DBomDataFree)
+#define Zw3DBomDataExport CALL_PROFILE_CALL(17, Zw3DBomDataExport)
+#define Zw3DBomSettingGet CALL_PROFILE_CALL(18, Zw3DBomSettingGet)
+#define Zw3DBomSettingSet CALL_PROFILE_CALL(19, Zw3DBomSettingSet)
+#define Zw3DBomSettingDataFree CALL_PROFILE_CALL(20, Zw3DBomSettingDataFree)
+#define Zw3DBomFormatDataGet CALL_PROFILE_CALL(21, Zw3DBomFormatDataGet)
+#define Zw3DBomFormatDataSet CALL_PROFILE_CALL(22, Zw3DBomFormatDataSet)
+#define Zw3DBomExcludedStateSet CALL_PROFILE_CALL(23, Zw3DBomExcludedStateSet)
+#define Zw3DBomTemplateSet CALL_PROFILE_CALL(24, Zw3DBomTemplateSet)
+#define cvxPartInqAsmFolders CALL_PROFILE_CALL(25, cvxPartInqAsmFolders)
+#define cvxPartInqAsmFldChildEnts CALL_PROFILE_CALL(26, cvxPartInqAsmFldChildEnts)
+#define cvxPartInqAsmFtrList CALL_PROFILE_CALL(27, cvxPartInqAsmFtrList)
+#define cvxPartInqComps CALL_PROFILE_CALL(28, cvxPartInqComps)
+#define cvxPartInqComps2 CALL_PROFILE_CALL(29, cvxPartInqComps2)
+#define cvxPartInqCompsInfo CALL_PROFILE_CALL(30, cvxPartInqCompsInfo)
+#define cvxPartInqCompsInfoByLongPath CALL_PROFILE_CALL(31, cvxPartInqCompsInfoByLongPath)
+#define cvxCompInqPaths CALL_PROFILE_CALL(32, cvxCompInqPaths)
+#define cvxCompInqPart CALL_PROFILE_CALL(33, cvxCompInqPart)
+#define cvxCompInqPartByPath CALL_PROFILE_CALL(34, cvxCompInqPartByPath)
+#define cvxCompInqPartByPathByLongPath CALL_PROFILE_CALL(35, cvxCompInqPartByPathByLongPath)
+#define cvxCompGetRefPart CALL_PROFILE_CALL(36, cvxCompGetRefPart)
+#define cvxCompGetRefPartByLongPath CALL_PROFILE_CALL(37, cvxCompGetRefPartByLongPath)
+#define cvxPartInqAsmIsFlex CALL_PROFILE_CALL(38, cvxPartInqAsmIsFlex)
+#define cvxPartInqAsmIsFlexByPath CALL_PROFILE_CALL(39, cvxPartInqAsmIsFlexByPath)
+#define cvxCompSuppressGet CALL_PROFILE_CALL(40, cvxCompSuppressGet)
+#define cvxCompSuppressGetByPath CALL_PROFILE_CALL(41, cvxCompSuppressGetByPath)
+#define cvxAssemCompVisAll CALL_PROFILE_CALL(42, cvxAssemCompVisAll)
+#define cvxCompVisGet CALL_PROFILE_CALL(43, cvxCompVisGet)
+#define cvxCompHighlight CALL_PROFILE_CALL(44, cvxCompHighlight)
+#define cvxCompUnHighlight CALL_PROFILE_CALL(45, cvxCompUnHighlight)
+#define cvxCompMakeVirtual CALL_PROFILE_CALL(46, cvxCompMakeVirtual)
+#define cvxCompIsVirtual CALL_PROFILE_CALL(47, cvxCompIsVirtual)
+#define cvxCompIsEnvelope CALL_PROFILE_CALL(48, cvxCompIsEnvelope)
+#define cvxCompInqRenderMode CALL_PROFILE_CALL(49, cvxCompInqRenderMode)
+#define cvxCompIsUnplaced CALL_PROFILE_CALL(50, cvxCompIsUnplaced)
+#define cvxCompIsUnplacedByPath CALL_PROFILE_CALL(51, cvxCompIsUnplacedByPath)
+#define cvxCompIsFileLost CALL_PROFILE_CALL(52, cvxCompIsFileLost)
+#define cvxCompExpandStateGet CALL_PROFILE_CALL(53, cvxCompExpandStateGet)
+#define cvxCompExpandStateSet CALL_PROFILE_CALL(54, cvxCompExpandStateSet)
+#define cvxCompSelectedStateGet CALL_PROFILE_CALL(55, cvxCompSelectedStateGet)
+#define cvxCompSelectedStateSet CALL_PROFILE_CALL(56, cvxCompSelectedStateSet)
+#define cvxCompBomExcludedGet CALL_PROFILE_CALL(57, cvxCompBomExcludedGet)
+#define cvxCompBomSettingGet CALL_PROFILE_CALL(58, cvxCompBomSettingGet)
+#define cvxCompBomSettingSet CALL_PROFILE_CALL(59, cvxCompBomSettingSet)
+#define cvxCompBomDispDataGet CALL_PROFILE_CALL(60, cvxCompBomDispDataGet)
+#define cvxBomDataFree CALL_PROFILE_CALL(61, cvxBomDataFree)
+#define cvxCompBomPathByPart CALL_PROFILE_CALL(62, cvxCompBomPathByPart)
+#define cvxCompRegenSet CALL_PROFILE_CALL(63, cvxCompRegenSet)
+#define cvxPartInqFlexAsmMat CALL_PROFILE_CALL(64, cvxPartInqFlexAsmMat)
+#define cvxCompInqOpenShapes CALL_PROFILE_CALL(65, cvxCompInqOpenShapes)
+#define cvxCompShapeInqOpenEdges CALL_PROFILE_CALL(66, cvxCompShapeInqOpenEdges)
+#define cvxCompCfgIdGet CALL_PROFILE_CALL(67, cvxCompCfgIdGet)
+#define cvxCompFolderIns CALL_PROFILE_CALL(68, cvxCompFolderIns)
+#define cvxCompFromAsmFtr CALL_PROFILE_CALL(69, cvxCompFromAsmFtr)
+#define cvxAsmReorder CALL_PROFILE_CALL(70, cvxAsmReorder)
+#define cvxSubPartFlag CALL_PROFILE_CALL(71, cvxSubPartFlag)
+#define cvxCompNameWithOrderNumberGet CALL_PROFILE_CALL(72, cvxCompNameWithOrderNumberGet)
+#define cvxCompUserAtGet CALL_PROFILE_CALL(73, cvxCompUserAtGet)
+#define cvxCompUserAtSet CALL_PROFILE_CALL(74, cvxCompUserAtSet)
+#define cvxCompUserAtDel CALL_PROFILE_CALL(75, cvxCompUserAtDel)
+#define cvxCompFaceAtGet CALL_PROFILE_CALL(76, cvxCompFaceAtGet)
+#define cvxCompFaceAtSet CALL_PROFILE_CALL(77, cvxCompFaceAtSet)
+#define cvxConsInqType CALL_PROFILE_CALL(78, cvxConsInqType)
+#define cvxConsInqRefEnts CALL_PROFILE_CALL(79, cvxConsInqRefEnts)
+#define cvxConsInqConsData CALL_PROFILE_CALL(80, cvxConsInqConsData)
+#define cvxCompInqConsState CALL_PROFILE_CALL(81, cvxCompInqConsState)
+#define cvxCompInqConstraints CALL_PROFILE_CALL(82, cvxCompInqConstraints)
+#define cvxAsmDissolve CALL_PROFILE_CALL(83, cvxAsmDissolve)
+#define cvxAsmGrpComp CALL_PROFILE_CALL(84, cvxAsmGrpComp)
+#define cvxAsmAddToFavorites CALL_PROFILE_CALL(85, cvxAsmAddToFavorites)
+#define cvxAsmRemoveFromFavorites CALL_PROFILE_CALL(86, cvxAsmRemoveFromFavorites)
+#define cvxAsmFavoritesEnable CALL_PROFILE_CALL(87, cvxAsmFavoritesEnable)
+#define cvxAsmUpdateCompRef CALL_PROFILE_CALL(88, cvxAsmUpdateCompRef)
+#define cvxCompEditPart CALL_PROFILE_CALL(89, cvxCompEditPart)
+#define cvxCompEditPartByPath CALL_PROFILE_CALL(90, cvxCompEditPartByPath)
+#define cvxCompRegen CALL_PROFILE_CALL(91, cvxCompRegen)
+#define cvxCompSetPart CALL_PROFILE_CALL(92, cvxCompSetPart)
+#define cvxCompIsLightweightByPath CALL_PROFILE_CALL(93, cvxCompIsLightweightByPath)
+#define cvxCompLightweightSetByPath CALL_PROFILE_CALL(94, cvxCompLightweightSetByPath)
+#define cvxCompSetRenderMode CALL_PROFILE_CALL(95, cvxCompSetRenderMode)
+#define cvxCompShift CALL_PROFILE_CALL(96, cvxCompShift)
+#define cvxCompSuppress CALL_PROFILE_CALL(97, cvxCompSuppress)
+#define cvxCompSuppressByPath CALL_PROFILE_CALL(98, cvxCompSuppressByPath)
+#define cvxCompVisSet CALL_PROFILE_CALL(99, cvxCompVisSet)
+#define cvxCompCfgIdSet CALL_PROFILE_CALL(100, cvxCompCfgIdSet)
+#define cvxConsRedefine CALL_PROFILE_CALL(101, cvxConsRedefine)
+#define cvxConsEnable CALL_PROFILE_CALL(102, cvxConsEnable)
+#define cvxConsDel CALL_PROFILE_CALL(103, cvxConsDel)
+#define cvxSubPartIns CALL_PROFILE_CALL(104, cvxSubPartIns)
+#define cvxAsmTreeEcadRefDesSet CALL_PROFILE_CALL(105, cvxAsmTreeEcadRefDesSet)
+#define cvxAsmFlexibleAsmSet CALL_PROFILE_CALL(106, cvxAsmFlexibleAsmSet)
+#define cvxAsmFlexiblePartSet CALL_PROFILE_CALL(107, cvxAsmFlexiblePartSet)
+#define cvxAsmTreeEcadRefDesGet CALL_PROFILE_CALL(108, cvxAsmTreeEcadRefDesGet)
+#define cvxAssembleContextGet CALL_PROFILE_CALL(109, cvxAssembleContextGet)
+#define cvxAsmAutoRegenStateSetByPath CALL_PROFILE_CALL(110, cvxAsmAutoRegenStateSetByPath)
+#define cvxAsmAutoRegenStateGetByPath CALL_PROFILE_CALL(111, cvxAsmAutoRegenStateGetByPath)
+#define cvxAsmTreeRegen CALL_PROFILE_CALL(112, cvxAsmTreeRegen)
+#define cvxAsmFlexiblePartGet CALL_PROFILE_CALL(113, cvxAsmFlexiblePartGet)
+#define cvxAsmFlexiblePartDataFree CALL_PROFILE_CALL(114, cvxAsmFlexiblePartDataFree)
+#define cvxLibPartIns CALL_PROFILE_CALL(115, cvxLibPartIns)
+#define cvxInstPartAsShp CALL_PROFILE_CALL(116, cvxInstPartAsShp)
+#define cvxLibPartAdjust CALL_PROFILE_CALL(117, cvxLibPartAdjust)
+#define ZwConstraintCoincidentAdd CALL_PROFILE_CALL(118, ZwConstraintCoincidentAdd)
+#define ZwAssemblyConstraintDimensionGet CALL_PROFILE_CALL(119, ZwAssemblyConstraintDimensionGet)
+#define ZwAssemblyConstraintDataGet CALL_PROFILE_CALL(120, ZwAssemblyConstraintDataGet)
+#define ZwAssemblyConstraintDataSet CALL_PROFILE_CALL(121, ZwAssemblyConstraintDataSet)
+#define ZwAssemblyConstraintTypeGet CALL_PROFILE_CALL(122, ZwAssemblyConstraintTypeGet)
+#define ZwAssemblyConstraintReferenceListGet CALL_PROFILE_CALL(123, ZwAssemblyConstraintReferenceListGet)
+#define ZwAssemblyConstraintNodeNameGet CALL_PROFILE_CALL(124, ZwAssemblyConstraintNodeNameGet)
+#define ZwPhysicalAttributeGet CALL_PROFILE_CALL(125, ZwPhysicalAttributeGet)
+#define ZwPhysicalAttributeSet CALL_PROFILE_CALL(126, ZwPhysicalAttributeSet)
+#define ZwPhysicalAttributeCalculate CALL_PROFILE_CALL(127, ZwPhysicalAttributeCalculate)
+#define ZwStandardAttributeGet CALL_PROFILE_CALL(128, ZwStandardAttributeGet)
+#define ZwStandardAttributeSet CALL_PROFILE_CALL(129, ZwStandardAttributeSet)
+#define ZwStandardAttributeDateSet CALL_PROFILE_CALL(130, ZwStandardAttributeDateSet)
+#define ZwUserAttributeImport CALL_PROFILE_CALL(131, ZwUserAttributeImport)
+#define ZwUserAttributeExport CALL_PROFILE_CALL(132, ZwUserAttributeExport)
+#define ZwUserAttributeGet CALL_PROFILE_CALL(133, ZwUserAttributeGet)
+#define ZwUserAttributeSet CALL_PROFILE_CALL(134, ZwUserAttributeSet)
+#define ZwUserAttributeDelete CALL_PROFILE_CALL(135, ZwUserAttributeDelete)
+#define ZwUserAttributeLockSet CALL_PROFILE_CALL(136, ZwUserAttributeLockSet)
+#define ZwComponentUserAttributeGet CALL_PROFILE_CALL(137, ZwComponentUserAttributeGet)
+#define ZwComponentUserAttributeSet CALL_PROFILE_CALL(138, ZwComponentUserAttributeSet)
+#define ZwComponentUserAttributeDelete CALL_PROFILE_CALL(139, ZwComponentUserAttributeDelete)
+#define ZwEntityUserAttributeGet CALL_PROFILE_CALL(140, ZwEntityUserAttributeGet)
+#define ZwEntityUserAttributeSet CALL_PROFILE_CALL(141, ZwEntityUserAttributeSet)
+#define ZwEntityUserAttributeDelete CALL_PROFILE_CALL(142, ZwEntityUserAttributeDelete)
+#define ZwHistoryUserAttributeGet CALL_PROFILE_CALL(143, ZwHistoryUserAttributeGet)
+#define ZwHistoryUserAttributeSet CALL_PROFILE_CALL(144, ZwHistoryUserAttributeSet)
+#define ZwHistoryUserAttributeDelete CALL_PROFILE_CALL(145, ZwHistoryUserAttributeDelete)
+#define ZwUserAttributeDataFree CALL_PROFILE_CALL(146, ZwUserAttributeDataFree)
+#define ZwBoundingBoxTransform CALL_PROFILE_CALL(147, ZwBoundingBoxTransform)
+#define cvxPartInqEdgeOpen CALL_PROFILE_CALL(148, cvxPartInqEdgeOpen)
+#define cvxPartInqEdgeType CALL_PROFILE_CALL(149, cvxPartInqEdgeType)
+#define cvxPartInqEdgeFaces CALL_PROFILE_CALL(150, cvxPartInqEdgeFaces)
+#define cvxPartInqEdgePreEdges CALL_PROFILE_CALL(151, cvxPartInqEdgePreEdges)
+#define cvxPartInqEdgeLoop CALL_PROFILE_CALL(152, cvxPartInqEdgeLoop)
+#define cvxPartInqEdgeShape CALL_PROFILE_CALL(153, cvxPartInqEdgeShape)
+#define cvxPartInqEdgeCrv CALL_PROFILE_CALL(154, cvxPartInqEdgeCrv)
+#define cvxPartInqEdgeDiscreteData CALL_PROFILE_CALL(155, cvxPartInqEdgeDiscreteData)
+#define cvxPartInqFaceAt CALL_PROFILE_CALL(156, cvxPartInqFaceAt)
+#define cvxPartInqFaceSh CALL_PROFILE_CALL(157, cvxPartInqFaceSh)
+#define cvxPartInqFaceTx CALL_PROFILE_CALL(158, cvxPartInqFaceTx)
+#define cvxFaceGetArea CALL_PROFILE_CALL(159, cvxFaceGetArea)
+#define cvxFaceGetMaxCurvature CALL_PROFILE_CALL(160, cvxFaceGetMaxCurvature)
+#define cvxPartSetFaceAtInit CALL_PROFILE_CALL(161, cvxPartSetFaceAtInit)
+#define cvxPartSetFaceAt CALL_PROFILE_CALL(162, cvxPartSetFaceAt)
+#define cvxPartSetFaceTx CALL_PROFILE_CALL(163, cvxPartSetFaceTx)
+#define cvxPartDelFaceTx CALL_PROFILE_CALL(164, cvxPartDelFaceTx)
+#define cvxPartInqFaceTxFile CALL_PROFILE_CALL(165, cvxPartInqFaceTxFile)
+#define cvxPartInqFaceTxFileByLongPath CALL_PROFILE_CALL(166, cvxPartInqFaceTxFileByLongPath)
+#define cvxPartInqFaceBox CALL_PROFILE_CALL(167, cvxPartInqFaceBox)
+#define cvxPartInqFaceCrvs CALL_PROFILE_CALL(168, cvxPartInqFaceCrvs)
+#define cvxPartInqFaceEdges CALL_PROFILE_CALL(169, cvxPartInqFaceEdges)
+#define cvxPartInqFaceLoops CALL_PROFILE_CALL(170, cvxPartInqFaceLoops)
+#define cvxPartInqFaceSrf CALL_PROFILE_CALL(171, cvxPartInqFaceSrf)
+#define cvxSurfaceFree CALL_PROFILE_CALL(172, cvxSurfaceFree)
+#define cvxPartInqFaceSrfPrim CALL_PROFILE_CALL(173, cvxPartInqFaceSrfPrim)
+#define cvxSrfPrimFree CALL_PROFILE_CALL(174, cvxSrfPrimFree)
+#define cvxPartInqFaceShape CALL_PROFILE_CALL(175, cvxPartInqFaceShape)
+#define cvxPartInqFaceGeom CALL_PROFILE_CALL(176, cvxPartInqFaceGeom)
+#define cvxPartInqFaceFillet CALL_PROFILE_CALL(177, cvxPartInqFaceFillet)
+#define cvxFaceRadius CALL_PROFILE_CALL(178, cvxFaceRadius)
+#define cvxFaceInqBend CALL_PROFILE_CALL(179, cvxFaceInqBend)
+#define cvxFaceIsConcave CALL_PROFILE_CALL(180, cvxFaceIsConcave)
+#define cvxFaceIsPlanar CALL_PROFILE_CALL(181, cvxFaceIsPlanar)
+#define cvxFaceInqExtreme CALL_PROFILE_CALL(182, cvxFaceInqExtreme)
+#define cvxFaceEval CALL_PROFILE_CALL(183, cvxFaceEval)
+#define cvxFaceEval2 CALL_PROFILE_CALL(184, cvxFaceEval2)
+#define cvxFaceParam CALL_PROFILE_CALL(185, cvxFaceParam)
+#define cvxFacePntLoc CALL_PROFILE_CALL(186, cvxFacePntLoc)
+#define cvxFacePntProj CALL_PROFILE_CALL(187, cvxFacePntProj)
+#define cvxFaceRadialIntegrity CALL_PROFILE_CALL(188, cvxFaceRadialIntegrity)
+#define cvxFaceEvalGeom CALL_PROFILE_CALL(189, cvxFaceEvalGeom)
+#define cvxPartInqLoopEdges CALL_PROFILE_CALL(190, cvxPartInqLoopEdges)
+#define cvxPartInqLoopFace CALL_PROFILE_CALL(191, cvxPartInqLoopFace)
+#define cvxPartInqLoopPreEdges CALL_PROFILE_CALL(192, cvxPartInqLoopPreEdges)
+#define cvxPartInqLoopInner CALL_PROFILE_CALL(193, cvxPartInqLoopInner)
+#define cvxPartInqPreEdgeInfo CALL_PROFILE_CALL(194, cvxPartInqPreEdgeInfo)
+#define cvxPartInqPreEdgeStartPnt CALL_PROFILE_CALL(195, cvxPartInqPreEdgeStartPnt)
+#define cvxPartInqVertexEdges CALL_PROFILE_CALL(196, cvxPartInqVertexEdges)
+#define cvxCmCompInsert CALL_PROFILE_CALL(197, cvxCmCompInsert)
+#define cvxCmCompDelete CALL_PROFILE_CALL(198, cvxCmCompDelete)
+#define cvxCmCompGetAttr CALL_PROFILE_CALL(199, cvxCmCompGetAttr)
+#define cvxCmCompSetAttr CALL_PROFILE_CALL(200, cvxCmCompSetAttr)
+#define cvxCmCompInqInfo CALL_PROFILE_CALL(201, cvxCmCompInqInfo)
+#define cvxCmCompInqInfoByLongPath CALL_PROFILE_CALL(202, cvxCmCompInqInfoByLongPath)
+#define cvxCmPlanSkNew CALL_PROFILE_CALL(203, cvxCmPlanSkNew)
+#define cvxCmGeomUpdata CALL_PROFILE_CALL(204, cvxCmGeomUpdata)
+#define cvxCmFolderGetAttr CALL_PROFILE_CALL(205, cvxCmFolderGetAttr)
+#define cvxCmFolderInqOps CALL_PROFILE_CALL(206, cvxCmFolderInqOps)
+#define cvxCmOpInsFolder CALL_PROFILE_CALL(207, cvxCmOpInsFolder)
+#define cvxCmObjGetTreeId CALL_PROFILE_CALL(208, cvxCmObjGetTreeId)
+#define cvxCmObjGetUiPos CALL_PROFILE_CALL(209, cvxCmObjGetUiPos)
+#define cvxCmFldRename CALL_PROFILE_CALL(210, cvxCmFldRename)
+#define ZwCamFolderCreate CALL_PROFILE_CALL(211, ZwCamFolderCreate)
+#define ZwCamFolderNameSet CALL_PROFILE_CALL(212, ZwCamFolderNameSet)
+#define ZwCamFolderNameGet CALL_PROFILE_CALL(213, ZwCamFolderNameGet)
+#define cvxCmSetClearance CALL_PROFILE_CALL(214, cvxCmSetClearance)
+#define cvxCmGetClearance CALL_PROFILE_CALL(215, cvxCmGetClearance)
+#define cvxCmSetSAndF CALL_PROFILE_CALL(216, cvxCmSetSAndF)
+#define cvxCmOutputManhours CALL_PROFILE_CALL(217, cvxCmOutputManhours)
+#define cvxCmOutputInsNC CALL_PROFILE_CALL(218, cvxCmOutputInsNC)
+#define cvxCmOutputDelNC CALL_PROFILE_CALL(219, cvxCmOutputDelNC)
+#define cvxCmGetOutputNCSet CALL_PROFILE_CALL(220, cvxCmGetOutputNCSet)
+#define cvxCmSetOutputNCSet CALL_PROFILE_CALL(221, cvxCmSetOutputNCSet)
+#define cvxCmOutputInsOps CALL_PROFILE_CALL(222, cvxCmOutputInsOps)
+#define cvxCmOutputDelOps CALL_PROFILE_CALL(223, cvxCmOutputDelOps)
+#define cvxCmOutputNC CALL_PROFILE_CALL(224, cvxCmOutputNC)
+#define cvxCmOpsOutputNc CALL_PROFILE_CALL(225, cvxCmOpsOutputNc)
+#define cvxCmMsgClear CALL_PROFILE_CALL(226, cvxCmMsgClear)
+#define cvxCmFrameInsert CALL_PROFILE_CALL(227, cvxCmFrameInsert)
+#define cvxCmFrameDelete CALL_PROFILE_CALL(228, cvxCmFrameDelete)
+#define cvxCmFrameGetAttr CALL_PROFILE_CALL(229, cvxCmFrameGetAttr)
+#define cvxCmFrameInsert2 CALL_PROFILE_CALL(230, cvxCmFrameInsert2)
+#define cvxCmOpAddFrame CALL_PROFILE_CALL(231, cvxCmOpAddFrame)
+#define cvxCmFrameGetMatrix CALL_PROFILE_CALL(232, cvxCmFrameGetMatrix)
+#define cvxCmFrameGetActive CALL_PROFILE_CALL(233, cvxCmFrameGetActive)
+#define cvxCmFtrInsert CALL_PROFILE_CALL(234, cvxCmFtrInsert)
+#define cvxCmFtrInsertNew CALL_PROFILE_CALL(235, cvxCmFtrInsertNew)
+#define cvxCmFtrInsertWithoutHoles CALL_PROFILE_CALL(236, cvxCmFtrInsertWithoutHoles)
+#define cvxCmFtrInsertSK CALL_PROFILE_CALL(237, cvxCmFtrInsertSK)
+#define cvxCmFtrGetComp CALL_PROFILE_CALL(238, cvxCmFtrGetComp)
+#define cvxCmGetCrvId CALL_PROFILE_CALL(239, cvxCmGetCrvId)
+#define cvxCmFtrInsertHole CALL_PROFILE_CALL(240, cvxCmFtrInsertHole)
+#define cvxCmPlanDispSetMode CALL_PROFILE_CALL(241, cvxCmPlanDispSetMode)
+#define cvxCmPlanDispResetMode CALL_PROFILE_CALL(242, cvxCmPlanDispResetMode)
+#define cvxCmFtrDelete CALL_PROFILE_CALL(243, cvxCmFtrDelete)
+#define cvxCmFtrRename CALL_PROFILE_CALL(244, cvxCmFtrRename)
+#define cvxCmProfSetAttr CALL_PROFILE_CALL(245, cvxCmProfSetAttr)
+#define cvxCmFtrInqType CALL_PROFILE_CALL(246, cvxCmFtrInqType)
+#define ZwCamFtrGrpFeatListGet CALL_PROFILE_CALL(247, ZwCamFtrGrpFeatListGet)
+#define ZwCamFtrElementListGet CALL_PROFILE_CALL(248, ZwCamFtrElementListGet)
+#define ZwCamHoleFeatDataGet CALL_PROFILE_CALL(249, ZwCamHoleFeatDataGet)
+#define ZwCamHoleFeatDataSet CALL_PROFILE_CALL(250, ZwCamHoleFeatDataSet)
+#define ZwCamProfFeatDataGet CALL_PROFILE_CALL(251, ZwCamProfFeatDataGet)
+#define ZwCamProfFeatDataSet CALL_PROFILE_CALL(252, ZwCamProfFeatDataSet)
+#define ZwCamProfElementDataGet CALL_PROFILE_CALL(253, ZwCamProfElementDataGet)
+#define ZwCamProfElementDataSet CALL_PROFILE_CALL(254, ZwCamProfElementDataSet)
+#define ZwCamCroundFeatDataGet CALL_PROFILE_CALL(255, ZwCamCroundFeatDataGet)
+#define ZwCamCroundFeatDataSet CALL_PROFILE_CALL(256, ZwCamCroundFeatDataSet)
+#define ZwCamSlotFeatDataGet CALL_PROFILE_CALL(257, ZwCamSlotFeatDataGet)
+#define ZwCamSlotFeatDataSet CALL_PROFILE_CALL(258, ZwCamSlotFeatDataSet)
+#define ZwCamChamferFeatDataGet CALL_PROFILE_CALL(259, ZwCamChamferFeatDataGet)
+#define ZwCamChamferFeatDataSet CALL_PROFILE_CALL(260, ZwCamChamferFeatDataSet)
+#define ZwCamFtrGrpProfClassSet CALL_PROFILE_CALL(261, ZwCamFtrGrpProfClassSet)
+#define ZwCamFtrGrpProfClassGet CALL_PROFILE_CALL(262, ZwCamFtrGrpProfClassGet)
+#define cvxCmMachineInsert CALL_PROFILE_CALL(263, cvxCmMachineInsert)
+#define cvxCmMachineActive CALL_PROFILE_CALL(264, cvxCmMachineActive)
+#define cvxCmMachineDelete CALL_PROFILE_CALL(265, cvxCmMachineDelete)
+#define cvxCmMachineGetAttr CALL_PROFILE_CALL(266, cvxCmMachineGetAttr)
+#define cvxCmMachineSetAttr CALL_PROFILE_CALL(267, cvxCmMachineSetAttr)
+#define cvxCmToolChangerInsert CALL_PROFILE_CALL(268, cvxCmToolChangerInsert)
+#define cvxCmToolChangerDelete CALL_PROFILE_CALL(269, cvxCmToolChangerDelete)
+#define ZwCamMachineIntSet CALL_PROFILE_CALL(270, ZwCamMachineIntSet)
+#define ZwCamMachineIntGet CALL_PROFILE_CALL(271, ZwCamMachineIntGet)
+#define ZwCamMachineStrGet CALL_PROFILE_CALL(272, ZwCamMachineStrGet)
+#define ZwCamMachineStrSet CALL_PROFILE_CALL(273, ZwCamMachineStrSet)
+#define cvxCmOpInsert CALL_PROFILE_CALL(274, cvxCmOpInsert)
+#define cvxCmOpDelete CALL_PROFILE_CALL(275, cvxCmOpDelete)
+#define cvxCmOpDuplicate CALL_PROFILE_CALL(276, cvxCmOpDuplicate)
+#define cvxCmOpAddComp CALL_PROFILE_CALL(277, cvxCmOpAddComp)
+#define cvxCmOpRemoveComp CALL_PROFILE_CALL(278, cvxCmOpRemoveComp)
+#define cvxCmOpAddFtr CALL_PROFILE_CALL(279, cvxCmOpAddFtr)
+#define cvxCmOpRemoveFtr CALL_PROFILE_CALL(280, cvxCmOpRemoveFtr)
+#define cvxCmOpCalTPath CALL_PROFILE_CALL(281, cvxCmOpCalTPath)
+#define cvxCmOpAddTool CALL_PROFILE_CALL(282, cvxCmOpAddTool)
+#define cvxCmOpRemoveTool CALL_PROFILE_CALL(283, cvxCmOpRemoveTool)
+#define cvxCmOpSetSpeed CALL_PROFILE_CALL(284, cvxCmOpSetSpeed)
+#define cvxCmOpSetAttr2 CALL_PROFILE_CALL(285, cvxCmOpSetAttr2)
+#define cvxCmOpGetAttr2 CALL_PROFILE_CALL(286, cvxCmOpGetAttr2)
+#define cvxCmOpGetIdxFromName CALL_PROFILE_CALL(287, cvxCmOpGetIdxFromName)
+#define cvxCmSetOpPoint CALL_PROFILE_CALL(288, cvxCmSetOpPoint)
+#define cvxCmSetOpPoints CALL_PROFILE_CALL(289, cvxCmSetOpPoints)
+#define cvxCmOpRename CALL_PROFILE_CALL(290, cvxCmOpRename)
+#define cvxCmOpDrag CALL_PROFILE_CALL(291, cvxCmOpDrag)
+#define cvxCmOpSetBasicAttr CALL_PROFILE_CALL(292, cvxCmOpSetBasicAttr)
+#define cvxCmOpInqClass CALL_PROFILE_CALL(293, cvxCmOpInqClass)
+#define cvxCmOpSetClass CALL_PROFILE_CALL(294, cvxCmOpSetClass)
+#define cvxCmOpInqTypeS CALL_PROFILE_CALL(295, cvxCmOpInqTypeS)
+#define cvxCmOpSetSpindleSpd CALL_PROFILE_CALL(296, cvxCmOpSetSpindleSpd)
+#define cvxCmOpSetFeedRate CALL_PROFILE_CALL(297, cvxCmOpSetFeedRate)
+#define cvxCmOpGetSpindleSpd CALL_PROFILE_CALL(298, cvxCmOpGetSpindleSpd)
+#define cvxCmOpGetFeedRate CALL_PROFILE_CALL(299, cvxCmOpGetFeedRate)
+#define ZwCamOpSetFolder CALL_PROFILE_CALL(300, ZwCamOpSetFolder)
+#define ZwCamOpSaveToXml CALL_PROFILE_CALL(301, ZwCamOpSaveToXml)
+#define ZwCamOpDoubleSet CALL_PROFILE_CALL(302, ZwCamOpDoubleSet)
+#define ZwCamOpIntSet CALL_PROFILE_CALL(303, ZwCamOpIntSet)
+#define ZwCamOpStrSet CALL_PROFILE_CALL(304, ZwCamOpStrSet)
+#define ZwCamOpObjSet CALL_PROFILE_CALL(305, ZwCamOpObjSet)
+#define ZwCamOpDoubleGet CALL_PROFILE_CALL(306, ZwCamOpDoubleGet)
+#define ZwCamOpIntGet CALL_PROFILE_CALL(307, ZwCamOpIntGet)
+#define ZwCamOpStrGet CALL_PROFILE_CALL(308, ZwCamOpStrGet)
+#define ZwCamOpObjGet CALL_PROFILE_CALL(309, ZwCamOpObjGet)
+#define cvxCmInqAl CALL_PROFILE_CALL(310, cvxCmInqAl)
+#define cvxCmSolidVerify CALL_PROFILE_CALL(311, cvxCmSolidVerify)
+#define cvxCmClashDetect CALL_PROFILE_CALL(312, cvxCmClashDetect)
+#define cvxCmGougeDetect CALL_PROFILE_CALL(313, cvxCmGougeDetect)
+#define cvxCmConfigFileGetString CALL_PROFILE_CALL(314, cvxCmConfigFileGetString)
+#define cvxCmInqOpName CALL_PROFILE_CALL(315, cvxCmInqOpName)
+#define cvxCmInqIndexFromName CALL_PROFILE_CALL(316, cvxCmInqIndexFromName)
+#define cvxCmCompGetIdxFromName CALL_PROFILE_CALL(317, cvxCmCompGetIdxFromName)
+#define ZwCamTreeRefresh CALL_PROFILE_CALL(318, ZwCamTreeRefresh)
+#define ZwCamLicProductCheck CALL_PROFILE_CALL(319, ZwCamLicProductCheck)
+#define cvxCmToolInsert CALL_PROFILE_CALL(320, cvxCmToolInsert)
+#define cvxCmToolInsertAsTemplate CALL_PROFILE_CALL(321, cvxCmToolInsertAsTemplate)
+#define cvxCmToolDelete CALL_PROFILE_CALL(322, cvxCmToolDelete)
+#define cvxCmHolderInsertAsTemplate CALL_PROFILE_CALL(323, cvxCmHolderInsertAsTemplate)
+#define cvxCmSpeedInsertAsTemplate CALL_PROFILE_CALL(324, cvxCmSpeedInsertAsTemplate)
+#define cvxCmToolGetData CALL_PROFILE_CALL(325, cvxCmToolGetData)
+#define cvxCmToolGetRegister CALL_PROFILE_CALL(326, cvxCmToolGetRegister)
+#define cvxCmToolSetRegister CALL_PROFILE_CALL(327, cvxCmToolSetRegister)
+#define cvxCmToolSetCoolant CALL_PROFILE_CALL(328, cvxCmToolSetCoolant)
+#define cvxCmToolGetCoolant CALL_PROFILE_CALL(329, cvxCmToolGetCoolant)
+#define cvxCmToolAddHolderLayer CALL_PROFILE_CALL(330, cvxCmToolAddHolderLayer)
+#define cvxCmToolDelHolderLayer CALL_PROFILE_CALL(331, cvxCmToolDelHolderLayer)
+#define cvxCmToolGetHolderLayers CALL_PROFILE_CALL(332, cvxCmToolGetHolderLayers)
+#define cvxCmToolSetHolderLayer CALL_PROFILE_CALL(333, cvxCmToolSetHolderLayer)
+#define cvxCmToolSetSpindleSpd CALL_PROFILE_CALL(334, cvxCmToolSetSpindleSpd)
+#define cvxCmToolGetSpindleSpd CALL_PROFILE_CALL(335, cvxCmToolGetSpindleSpd)
+#define cvxCmToolSetFeedRate CALL_PROFILE_CALL(336, cvxCmToolSetFeedRate)
+#define cvxCmToolGetFeedRate CALL_PROFILE_CALL(337, cvxCmToolGetFeedRate)
+#define cvxCmToolGetSpdFdRowCnt CALL_PROFILE_CALL(338, cvxCmToolGetSpdFdRowCnt)
+#define cvxCmToolRenameHolder CALL_PROFILE_CALL(339, cvxCmToolRenameHolder)
+#define cvxCmToolGetHolderName CALL_PROFILE_CALL(340, cvxCmToolGetHolderName)
+#define cvxCmToolOpenMillForm CALL_PROFILE_CALL(341, cvxCmToolOpenMillForm)
+#define ZwCamToolInsertFromLibrary CALL_PROFILE_CALL(342, ZwCamToolInsertFromLibrary)
+#define ZwCamToolExportAllToLibrary CALL_PROFILE_CALL(343, ZwCamToolExportAllToLibrary)
+#define cvxNewCommand CALL_PROFILE_CALL(344, cvxNewCommand)
+#define cvxCmdBuffer CALL_PROFILE_CALL(345, cvxCmdBuffer)
+#define cvxCmdSend CALL_PROFILE_CALL(346, cvxCmdSend)
+#define cvxCmdChkLic CALL_PROFILE_CALL(347, cvxCmdChkLic)
+#define cvxCmdAction CALL_PROFILE_CALL(348, cvxCmdAction)
+#define cvxCmdFunc CALL_PROFILE_CALL(349, cvxCmdFunc)
+#define cvxCmdCallback CALL_PROFILE_CALL(350, cvxCmdCallback)
+#define cvxCmdFuncUnload CALL_PROFILE_CALL(351, cvxCmdFuncUnload)
+#define cvxCmdVariable CALL_PROFILE_CALL(352, cvxCmdVariable)
+#define cvxCmdVariableUnload CALL_PROFILE_CALL(353, cvxCmdVariableUnload)
+#define cvxCmdRegisterRcc CALL_PROFILE_CALL(354, cvxCmdRegisterRcc)
+#define cvxCmdUnRegisterRcc CALL_PROFILE_CALL(355, cvxCmdUnRegisterRcc)
+#define cvxCmdMacro CALL_PROFILE_CALL(356, cvxCmdMacro)
+#define cvxCmdMacro2 CALL_PROFILE_CALL(357, cvxCmdMacro2)
+#define cvxMacroInqPath CALL_PROFILE_CALL(358, cvxMacroInqPath)
+#define cvxMacroInqPathByLongPath CALL_PROFILE_CALL(359, cvxMacroInqPathByLongPath)
+#define cvxCompIns CALL_PROFILE_CALL(360, cvxCompIns)
+#define cvxCompAutoHoleMatchIns CALL_PROFILE_CALL(361, cvxCompAutoHoleMatchIns)
+#define cvxCompWithLayoutIns CALL_PROFILE_CALL(362, cvxCompWithLayoutIns)
+#define cvxCompInclude CALL_PROFILE_CALL(363, cvxCompInclude)
+#define cvxCompMerge CALL_PROFILE_CALL(364, cvxCompMerge)
+#define cvxCompMerge2 CALL_PROFILE_CALL(365, cvxCompMerge2)
+#define cvxCompExtract CALL_PROFILE_CALL(366, cvxCompExtract)
+#define cvxPartGeomExport CALL_PROFILE_CALL(367, cvxPartGeomExport)
+#define cvxPartGeomExportII CALL_PROFILE_CALL(368, cvxPartGeomExportII)
+#define cvxPartIns CALL_PROFILE_CALL(369, cvxPartIns)
+#define cvxCompAddCoincidentCons CALL_PROFILE_CALL(370, cvxCompAddCoincidentCons)
+#define cvxCompAddTangentCons CALL_PROFILE_CALL(371, cvxCompAddTangentCons)
+#define cvxCompAddConcentricCons CALL_PROFILE_CALL(372, cvxCompAddConcentricCons)
+#define cvxCompAddParallelCons CALL_PROFILE_CALL(373, cvxCompAddParallelCons)
+#define cvxCompAddPerpendicularCons CALL_PROFILE_CALL(374, cvxCompAddPerpendicularCons)
+#define cvxCompAddAngularCons CALL_PROFILE_CALL(375, cvxCompAddAngularCons)
+#define cvxCompAddLockCons CALL_PROFILE_CALL(376, cvxCompAddLockCons)
+#define cvxCompAddDistanceCons CALL_PROFILE_CALL(377, cvxCompAddDistanceCons)
+#define cvxCompAddMiddleCons CALL_PROFILE_CALL(378, cvxCompAddMiddleCons)
+#define cvxCompAddSymmetryCons CALL_PROFILE_CALL(379, cvxCompAddSymmetryCons)
+#define cvxCompAddFrameCons CALL_PROFILE_CALL(380, cvxCompAddFrameCons)
+#define cvxCompAddGearCons CALL_PROFILE_CALL(381, cvxCompAddGearCons)
+#define cvxCompAddPathCons CALL_PROFILE_CALL(382, cvxCompAddPathCons)
+#define cvxCompAddLinearCoupleCons CALL_PROFILE_CALL(383, cvxCompAddLinearCoupleCons)
+#define cvxCompAddRackPinionCons CALL_PROFILE_CALL(384, cvxCompAddRackPinionCons)
+#define cvxCompAddScrewCons CALL_PROFILE_CALL(385, cvxCompAddScrewCons)
+#define cvxCompAddSlotCons CALL_PROFILE_CALL(386, cvxCompAddSlotCons)
+#define cvxCompAddCamCons CALL_PROFILE_CALL(387, cvxCompAddCamCons)
+#define cvxCompAddUniJointCons CALL_PROFILE_CALL(388, cvxCompAddUniJointCons)
+#define cvxPartAlign CALL_PROFILE_CALL(389, cvxPartAlign)
+#define cvxPartAnchor CALL_PROFILE_CALL(390, cvxPartAnchor)
+#define cvxCompPtnInit CALL_PROFILE_CALL(391, cvxCompPtnInit)
+#define cvxCompPtn CALL_PROFILE_CALL(392, cvxCompPtn)
+#define cvxCompMoveInit CALL_PROFILE_CALL(393, cvxCompMoveInit)
+#define cvxCompMove CALL_PROFILE_CALL(394, cvxCompMove)
+#define cvxCompMirrorInit CALL_PROFILE_CALL(395, cvxCompMirrorInit)
+#define cvxCompMirror CALL_PROFILE_CALL(396, cvxCompMirror)
+#define cvxAsmCutInit CALL_PROFILE_CALL(397, cvxAsmCutInit)
+#define cvxAsmCut CALL_PROFILE_CALL(398, cvxAsmCut)
+#define cvxAsmFilletInit CALL_PROFILE_CALL(399, cvxAsmFilletInit)
+#define cvxAsmFillet CALL_PROFILE_CALL(400, cvxAsmFillet)
+#define cvxAsmChamferInit CALL_PROFILE_CALL(401, cvxAsmChamferInit)
+#define cvxAsmChamfer CALL_PROFILE_CALL(402, cvxAsmChamfer)
+#define cvxCompIsectShpChk CALL_PROFILE_CALL(403, cvxCompIsectShpChk)
+#define cvxCompIsectShpChk2 CALL_PROFILE_CALL(404, cvxCompIsectShpChk2)
+#define cvxCompIferCheck CALL_PROFILE_CALL(405, cvxCompIferCheck)
+#define cvxCompInterferenceCheck CALL_PROFILE_CALL(406, cvxCompInterferenceCheck)
+#define cvxCompIfterDataFree CALL_PROFILE_CALL(407, cvxCompIfterDataFree)
+#define cvxCompClearCheck CALL_PROFILE_CALL(408, cvxCompClearCheck)
+#define cvxCompInsInit CALL_PROFILE_CALL(409, cvxCompInsInit)
+#define cvxCompWithLayoutInsInit CALL_PROFILE_CALL(410, cvxCompWithLayoutInsInit)
+#define cvxCompAutoHoleMatchInsInit CALL_PROFILE_CALL(411, cvxCompAutoHoleMatchInsInit)
+#define cvxPartRefGeom CALL_PROFILE_CALL(412, cvxPartRefGeom)
+#define cvxPartPublishSet CALL_PROFILE_CALL(413, cvxPartPublishSet)
+#define cvxPartAxisNew CALL_PROFILE_CALL(414, cvxPartAxisNew)
+#define cvxPartDatum CALL_PROFILE_CALL(415, cvxPartDatum)
+#define cvxPartDatum2 CALL_PROFILE_CALL(416, cvxPartDatum2)
+#define cvxPartNewDatum CALL_PROFILE_CALL(417, cvxPartNewDatum)
+#define cvxPartPlnCrv CALL_PROFILE_CALL(418, cvxPartPlnCrv)
+#define cvxPartPlnCrv2 CALL_PROFILE_CALL(419, cvxPartPlnCrv2)
+#define cvxPartPlnSrf CALL_PROFILE_CALL(420, cvxPartPlnSrf)
+#define cvxPartPlnSrf2 CALL_PROFILE_CALL(421, cvxPartPlnSrf2)
+#define cvxPartPlaneNew CALL_PROFILE_CALL(422, cvxPartPlaneNew)
+#define cvxPartPlaneAddInit CALL_PROFILE_CALL(423, cvxPartPlaneAddInit)
+#define cvxPartPlaneAdd CALL_PROFILE_CALL(424, cvxPartPlaneAdd)
+#define cvxPartCSYSNewInit CALL_PROFILE_CALL(425, cvxPartCSYSNewInit)
+#define cvxPartCSYSNew CALL_PROFILE_CALL(426, cvxPartCSYSNew)
+#define cvxPartActiveAsLCS CALL_PROFILE_CALL(427, cvxPartActiveAsLCS)
+#define cvxPartDEMoveInit CALL_PROFILE_CALL(428, cvxPartDEMoveInit)
+#define cvxPartDEMove CALL_PROFILE_CALL(429, cvxPartDEMove)
+#define cvxPartDEAlignMoveInit CALL_PROFILE_CALL(430, cvxPartDEAlignMoveInit)
+#define cvxPartDEAlignMove CALL_PROFILE_CALL(431, cvxPartDEAlignMove)
+#define cvxPartDEDimMoveInit CALL_PROFILE_CALL(432, cvxPartDEDimMoveInit)
+#define cvxPartDEDimMove CALL_PROFILE_CALL(433, cvxPartDEDimMove)
+#define cvxPartDEOffsetInit CALL_PROFILE_CALL(434, cvxPartDEOffsetInit)
+#define cvxPartDEOffset CALL_PROFILE_CALL(435, cvxPartDEOffset)
+#define cvxPartDEDraftInit CALL_PROFILE_CALL(436, cvxPartDEDraftInit)
+#define cvxPartDEDraft CALL_PROFILE_CALL(437, cvxPartDEDraft)
+#define cvxPartDECopyInit CALL_PROFILE_CALL(438, cvxPartDECopyInit)
+#define cvxPartDECopy CALL_PROFILE_CALL(439, cvxPartDECopy)
+#define cvxPartDEMirrorInit CALL_PROFILE_CALL(440, cvxPartDEMirrorInit)
+#define cvxPartDEMirror CALL_PROFILE_CALL(441, cvxPartDEMirror)
+#define cvxPartDEPtnInit CALL_PROFILE_CALL(442, cvxPartDEPtnInit)
+#define cvxPartDEPtn CALL_PROFILE_CALL(443, cvxPartDEPtn)
+#define cvxPartDEFlltInit CALL_PROFILE_CALL(444, cvxPartDEFlltInit)
+#define cvxPartDEFllt CALL_PROFILE_CALL(445, cvxPartDEFllt)
+#define cvxPartDERadInit CALL_PROFILE_CALL(446, cvxPartDERadInit)
+#define cvxPartDERad CALL_PROFILE_CALL(447, cvxPartDERad)
+#define cvxDwgAutoDimAdd CALL_PROFILE_CALL(448, cvxDwgAutoDimAdd)
+#define cvxDwgAutoDimAddInit CALL_PROFILE_CALL(449, cvxDwgAutoDimAddInit)
+#define cvxDwgLineDimAdd CALL_PROFILE_CALL(450, cvxDwgLineDimAdd)
+#define cvxDwgBaseLineDimAdd CALL_PROFILE_CALL(451, cvxDwgBaseLineDimAdd)
+#define cvxDwgContinuousDimAdd CALL_PROFILE_CALL(452, cvxDwgContinuousDimAdd)
+#define cvxDwgOrdinateDimAdd CALL_PROFILE_CALL(453, cvxDwgOrdinateDimAdd)
+#define cvxDwgLineOffsetDimAdd CALL_PROFILE_CALL(454, cvxDwgLineOffsetDimAdd)
+#define cvxDwgSymmetryDimAdd CALL_PROFILE_CALL(455, cvxDwgSymmetryDimAdd)
+#define cvxDwgLnrChmDimAddInit CALL_PROFILE_CALL(456, cvxDwgLnrChmDimAddInit)
+#define cvxDwgLnrChmDimAdd CALL_PROFILE_CALL(457, cvxDwgLnrChmDimAdd)
+#define cvxDwgAngDimAdd CALL_PROFILE_CALL(458, cvxDwgAngDimAdd)
+#define cvxDwgRadDimAdd CALL_PROFILE_CALL(459, cvxDwgRadDimAdd)
+#define cvxDwgArcDimAdd CALL_PROFILE_CALL(460, cvxDwgArcDimAdd)
+#define cvxDwgHoleCallOutDimAddinit CALL_PROFILE_CALL(461, cvxDwgHoleCallOutDimAddinit)
+#define cvxDwgHoleCallOutDimAdd CALL_PROFILE_CALL(462, cvxDwgHoleCallOutDimAdd)
+#define cvxDwgLabelCoorDimAdd CALL_PROFILE_CALL(463, cvxDwgLabelCoorDimAdd)
+#define cvxDwgLabelDimAdd CALL_PROFILE_CALL(464, cvxDwgLabelDimAdd)
+#define cvxDwgBalloonDimAdd CALL_PROFILE_CALL(465, cvxDwgBalloonDimAdd)
+#define cvxDwgAutoBlnAddInit CALL_PROFILE_CALL(466, cvxDwgAutoBlnAddInit)
+#define cvxDwgAutoBlnAdd CALL_PROFILE_CALL(467, cvxDwgAutoBlnAdd)
+#define cvxDwgStkBlnAddInit CALL_PROFILE_CALL(468, cvxDwgStkBlnAddInit)
+#define cvxDwgStkBlnAdd CALL_PROFILE_CALL(469, cvxDwgStkBlnAdd)
+#define cvxDwgFtrCtrlDimAdd CALL_PROFILE_CALL(470, cvxDwgFtrCtrlDimAdd)
+#define cvxDwgDatumDimAdd CALL_PROFILE_CALL(471, cvxDwgDatumDimAdd)
+#define cvxDwgDatumTargDimAddInit CALL_PROFILE_CALL(472, cvxDwgDatumTargDimAddInit)
+#define cvxDwgDatumTargDimAdd CALL_PROFILE_CALL(473, cvxDwgDatumTargDimAdd)
+#define cvxDwgCenterMarkDimAddInit CALL_PROFILE_CALL(474, cvxDwgCenterMarkDimAddInit)
+#define cvxDwgCenterMarkDimAdd CALL_PROFILE_CALL(475, cvxDwgCenterMarkDimAdd)
+#define cvxDwgCenMarkCirDimAddInit CALL_PROFILE_CALL(476, cvxDwgCenMarkCirDimAddInit)
+#define cvxDwgCenMarkCirDimAdd CALL_PROFILE_CALL(477, cvxDwgCenMarkCirDimAdd)
+#define cvxDwgCenterLineDimAddInit CALL_PROFILE_CALL(478, cvxDwgCenterLineDimAddInit)
+#define cvxDwgCenterLineDimAdd CALL_PROFILE_CALL(479, cvxDwgCenterLineDimAdd)
+#define cvxDwgSymWeldNew CALL_PROFILE_CALL(480, cvxDwgSymWeldNew)
+#define cvxDwgSymWeldNewInit CALL_PROFILE_CALL(481, cvxDwgSymWeldNewInit)
+#define cvxDwgSymSurfNewInit CALL_PROFILE_CALL(482, cvxDwgSymSurfNewInit)
+#define cvxDwgSymSurfNew CALL_PROFILE_CALL(483, cvxDwgSymSurfNew)
+#define cvxDwgSymImgNew CALL_PROFILE_CALL(484, cvxDwgSymImgNew)
+#define cvxDwgSymImgNewInit CALL_PROFILE_CALL(485, cvxDwgSymImgNewInit)
+#define cvxDwgInsertSymbol CALL_PROFILE_CALL(486, cvxDwgInsertSymbol)
+#define cvxDwgUserSymNew CALL_PROFILE_CALL(487, cvxDwgUserSymNew)
+#define cvxDwgIsectSym CALL_PROFILE_CALL(488, cvxDwgIsectSym)
+#define cvxDwgHoleMarkInit CALL_PROFILE_CALL(489, cvxDwgHoleMarkInit)
+#define cvxDwgHoleMark CALL_PROFILE_CALL(490, cvxDwgHoleMark)
+#define cvxDwgBalloonTextSet CALL_PROFILE_CALL(491, cvxDwgBalloonTextSet)
+#define cvxDwgBalloonTextGet CALL_PROFILE_CALL(492, cvxDwgBalloonTextGet)
+#define cvxDwgCrossHatchInit CALL_PROFILE_CALL(493, cvxDwgCrossHatchInit)
+#define cvxDwgCrossHatch CALL_PROFILE_CALL(494, cvxDwgCrossHatch)
+#define cvxDwgEntMovePntToPnt CALL_PROFILE_CALL(495, cvxDwgEntMovePntToPnt)
+#define cvxDwgEntMoveAlongDirection CALL_PROFILE_CALL(496, cvxDwgEntMoveAlongDirection)
+#define cvxDwgViewLayoutInit CALL_PROFILE_CALL(497, cvxDwgViewLayoutInit)
+#define cvxDwgViewLayout CALL_PROFILE_CALL(498, cvxDwgViewLayout)
+#define cvxDwgViewStandardInit CALL_PROFILE_CALL(499, cvxDwgViewStandardInit)
+#define cvxDwgViewStandard CALL_PROFILE_CALL(500, cvxDwgViewStandard)
+#define cvxDwgViewProjection CALL_PROFILE_CALL(501, cvxDwgViewProjection)
+#define cvxDwgViewAuxiliaryInit CALL_PROFILE_CALL(502, cvxDwgViewAuxiliaryInit)
+#define cvxDwgViewAuxiliary CALL_PROFILE_CALL(503, cvxDwgViewAuxiliary)
+#define cvxDwgViewFullSectionInit CALL_PROFILE_CALL(504, cvxDwgViewFullSectionInit)
+#define cvxDwgViewFullSection CALL_PROFILE_CALL(505, cvxDwgViewFullSection)
+#define cvxDwgViewAlignedSectionInit CALL_PROFILE_CALL(506, cvxDwgViewAlignedSectionInit)
+#define cvxDwgViewAlignedSection CALL_PROFILE_CALL(507, cvxDwgViewAlignedSection)
+#define cvxDwgViewBrokenSectionInit CALL_PROFILE_CALL(508, cvxDwgViewBrokenSectionInit)
+#define cvxDwgViewBrokenSection CALL_PROFILE_CALL(509, cvxDwgViewBrokenSection)
+#define cvxDwgViewDetailInit CALL_PROFILE_CALL(510, cvxDwgViewDetailInit)
+#define cvxDwgViewDetail CALL_PROFILE_CALL(511, cvxDwgViewDetail)
+#define cvxDwgViewBrkLineInit CALL_PROFILE_CALL(512, cvxDwgViewBrkLineInit)
+#define cvxDwgViewBrkLine CALL_PROFILE_CALL(513, cvxDwgViewBrkLine)
+#define cvxDwgTableBomInit CALL_PROFILE_CALL(514, cvxDwgTableBomInit)
+#define cvxDwgTableBom CALL_PROFILE_CALL(515, cvxDwgTableBom)
+#define cvxDwgTableInsert CALL_PROFILE_CALL(516, cvxDwgTableInsert)
+#define cvxDwgUserTableCreate CALL_PROFILE_CALL(517, cvxDwgUserTableCreate)
+#define cvxDwgUserTableCreateByTemplate CALL_PROFILE_CALL(518, cvxDwgUserTableCreateByTemplate)
+#define cvxDwgRotateViewinit CALL_PROFILE_CALL(519, cvxDwgRotateViewinit)
+#define cvxDwgRotateView CALL_PROFILE_CALL(520, cvxDwgRotateView)
+#define cvxDwgViewRotate CALL_PROFILE_CALL(521, cvxDwgViewRotate)
+#define cvxPartEcadRgnSetInit CALL_PROFILE_CALL(522, cvxPartEcadRgnSetInit)
+#define cvxPartEcadRgnSet CALL_PROFILE_CALL(523, cvxPartEcadRgnSet)
+#define cvxPartEcadRgnCut CALL_PROFILE_CALL(524, cvxPartEcadRgnCut)
+#define cvxPartFilletBlendInit CALL_PROFILE_CALL(525, cvxPartFilletBlendInit)
+#define cvxPartFilletBlend CALL_PROFILE_CALL(526, cvxPartFilletBlend)
+#define cvxPartNSidedInit CALL_PROFILE_CALL(527, cvxPartNSidedInit)
+#define cvxPartNSided CALL_PROFILE_CALL(528, cvxPartNSided)
+#define cvxPartTrimmedPlaneInit CALL_PROFILE_CALL(529, cvxPartTrimmedPlaneInit)
+#define cvxPartTrimmedPlane CALL_PROFILE_CALL(530, cvxPartTrimmedPlane)
+#define cvxPartRuledInit CALL_PROFILE_CALL(531, cvxPartRuledInit)
+#define cvxPartRuled CALL_PROFILE_CALL(532, cvxPartRuled)
+#define cvxPartCircularBiRailInit CALL_PROFILE_CALL(533, cvxPartCircularBiRailInit)
+#define cvxPartCircularBiRail CALL_PROFILE_CALL(534, cvxPartCircularBiRail)
+#define cvxPartConicBiRailInit CALL_PROFILE_CALL(535, cvxPartConicBiRailInit)
+#define cvxPartConicBiRail CALL_PROFILE_CALL(536, cvxPartConicBiRail)
+#define cvxPartFacesOffsetInit CALL_PROFILE_CALL(537, cvxPartFacesOffsetInit)
+#define cvxPartFacesOffset CALL_PROFILE_CALL(538, cvxPartFacesOffset)
+#define cvxPartExtendFaceInit CALL_PROFILE_CALL(539, cvxPartExtendFaceInit)
+#define cvxPartExtendFace CALL_PROFILE_CALL(540, cvxPartExtendFace)
+#define cvxPartTrimToFacesInit CALL_PROFILE_CALL(541, cvxPartTrimToFacesInit)
+#define cvxPartTrimToFaces CALL_PROFILE_CALL(542, cvxPartTrimToFaces)
+#define cvxPartTrimToCrvs CALL_PROFILE_CALL(543, cvxPartTrimToCrvs)
+#define cvxPartSetFaceDir CALL_PROFILE_CALL(544, cvxPartSetFaceDir)
+#define cvxFaceReverse CALL_PROFILE_CALL(545, cvxFaceReverse)
+#define cvxFaceReverseDir CALL_PROFILE_CALL(546, cvxFaceReverseDir)
+#define cvxPartModifyIsolineNum CALL_PROFILE_CALL(547, cvxPartModifyIsolineNum)
+#define cvxPartExplodeInit CALL_PROFILE_CALL(548, cvxPartExplodeInit)
+#define cvxPartExplode CALL_PROFILE_CALL(549, cvxPartExplode)
+#define cvxPartFacesetSewInit CALL_PROFILE_CALL(550, cvxPartFacesetSewInit)
+#define cvxPartFacesetSew CALL_PROFILE_CALL(551, cvxPartFacesetSew)
+#define cvxPartSewForce CALL_PROFILE_CALL(552, cvxPartSewForce)
+#define cvxPartEnlargeFaceInit CALL_PROFILE_CALL(553, cvxPartEnlargeFaceInit)
+#define cvxPartEnlargeFace CALL_PROFILE_CALL(554, cvxPartEnlargeFace)
+#define cvxPartExtendShapeInit CALL_PROFILE_CALL(555, cvxPartExtendShapeInit)
+#define cvxPartExtendShape CALL_PROFILE_CALL(556, cvxPartExtendShape)
+#define cvxPartSplitWithCrvInit CALL_PROFILE_CALL(557, cvxPartSplitWithCrvInit)
+#define cvxPartSplitWithCrv CALL_PROFILE_CALL(558, cvxPartSplitWithCrv)
+#define cvxPartCurveMeshInit CALL_PROFILE_CALL(559, cvxPartCurveMeshInit)
+#define cvxPartCurveMesh CALL_PROFILE_CALL(560, cvxPartCurveMesh)
+#define cvxDataInit CALL_PROFILE_CALL(561, cvxDataInit)
+#define cvxDataZero CALL_PROFILE_CALL(562, cvxDataZero)
+#define cvxDataSet CALL_PROFILE_CALL(563, cvxDataSet)
+#define cvxDataSetColor CALL_PROFILE_CALL(564, cvxDataSetColor)
+#define cvxDataSetPath CALL_PROFILE_CALL(565, cvxDataSetPath)
+#define cvxDataSetPromote CALL_PROFILE_CALL(566, cvxDataSetPromote)
+#define cvxDataSetPntOnCrv CALL_PROFILE_CALL(567, cvxDataSetPntOnCrv)
+#define cvxDataSetPntOnFace CALL_PROFILE_CALL(568, cvxDataSetPntOnFace)
+#define cvxDataSetPntOnFace2 CALL_PROFILE_CALL(569, cvxDataSetPntOnFace2)
+#define cvxDataSetPntByPath CALL_PROFILE_CALL(570, cvxDataSetPntByPath)
+#define cvxDataSetPntOnCrvPath CALL_PROFILE_CALL(571, cvxDataSetPntOnCrvPath)
+#define cvxDataSetPntOnEnt CALL_PROFILE_CALL(572, cvxDataSetPntOnEnt)
+#define cvxDataSetPntOnEntPath CALL_PROFILE_CALL(573, cvxDataSetPntOnEntPath)
+#define cvxDataSetDirOnEntPath CALL_PROFILE_CALL(574, cvxDataSetDirOnEntPath)
+#define cvxDataSetMatrix CALL_PROFILE_CALL(575, cvxDataSetMatrix)
+#define cvxDataToFeature CALL_PROFILE_CALL(576, cvxDataToFeature)
+#define cvxDataGet CALL_PROFILE_CALL(577, cvxDataGet)
+#define cvxDataGetColor CALL_PROFILE_CALL(578, cvxDataGetColor)
+#define cvxDataGetEnt CALL_PROFILE_CALL(579, cvxDataGetEnt)
+#define cvxDataGetEnts CALL_PROFILE_CALL(580, cvxDataGetEnts)
+#define cvxDataGetList CALL_PROFILE_CALL(581, cvxDataGetList)
+#define cvxDataGetNum CALL_PROFILE_CALL(582, cvxDataGetNum)
+#define cvxDataGetOpt CALL_PROFILE_CALL(583, cvxDataGetOpt)
+#define cvxDataGetPath CALL_PROFILE_CALL(584, cvxDataGetPath)
+#define cvxDataGetPaths CALL_PROFILE_CALL(585, cvxDataGetPaths)
+#define cvxDataGetPnt CALL_PROFILE_CALL(586, cvxDataGetPnt)
+#define cvxDataGetPnts CALL_PROFILE_CALL(587, cvxDataGetPnts)
+#define cvxDataGetPntOnEnt CALL_PROFILE_CALL(588, cvxDataGetPntOnEnt)
+#define cvxDataGetPntsOnEnts CALL_PROFILE_CALL(589, cvxDataGetPntsOnEnts)
+#define cvxDataGetPromote CALL_PROFILE_CALL(590, cvxDataGetPromote)
+#define cvxDataGetText CALL_PROFILE_CALL(591, cvxDataGetText)
+#define cvxDataGetMatrix CALL_PROFILE_CALL(592, cvxDataGetMatrix)
+#define cvxDataGetItemList CALL_PROFILE_CALL(593, cvxDataGetItemList)
+#define cvxDataGetItemData CALL_PROFILE_CALL(594, cvxDataGetItemData)
+#define cvxDataGetAll CALL_PROFILE_CALL(595, cvxDataGetAll)
+#define cvxFldDataFree CALL_PROFILE_CALL(596, cvxFldDataFree)
+#define cvxDataClear CALL_PROFILE_CALL(597, cvxDataClear)
+#define cvxDataDel CALL_PROFILE_CALL(598, cvxDataDel)
+#define cvxDataDelItem CALL_PROFILE_CALL(599, cvxDataDelItem)
+#define cvxDataDelUnHi CALL_PROFILE_CALL(600, cvxDataDelUnHi)
+#define cvxDataFree CALL_PROFILE_CALL(601, cvxDataFree)
+#define cvxDataGrpRem CALL_PROFILE_CALL(602, cvxDataGrpRem)
+#define cvxDataInqActive CALL_PROFILE_CALL(603, cvxDataInqActive)
+#define cvxDataInqParent CALL_PROFILE_CALL(604, cvxDataInqParent)
+#define cvxDataName CALL_PROFILE_CALL(605, cvxDataName)
+#define cvxAuxFrameShow CALL_PROFILE_CALL(606, cvxAuxFrameShow)
+#define cvxAuxFrameSetOrigin CALL_PROFILE_CALL(607, cvxAuxFrameSetOrigin)
+#define cvxAuxFrameSetAxisVec CALL_PROFILE_CALL(608, cvxAuxFrameSetAxisVec)
+#define cvxAuxFrameSetDirXYZOrgBuddy CALL_PROFILE_CALL(609, cvxAuxFrameSetDirXYZOrgBuddy)
+#define cvxMoveSetAuxFrameElem CALL_PROFILE_CALL(610, cvxMoveSetAuxFrameElem)
+#define cvxCmdEval CALL_PROFILE_CALL(611, cvxCmdEval)
+#define cvxCmdExec CALL_PROFILE_CALL(612, cvxCmdExec)
+#define cvxCmdExec2 CALL_PROFILE_CALL(613, cvxCmdExec2)
+#define cvxCmdExecWithOut CALL_PROFILE_CALL(614, cvxCmdExecWithOut)
+#define cvxCmdInput CALL_PROFILE_CALL(615, cvxCmdInput)
+#define cvxCmdInteract CALL_PROFILE_CALL(616, cvxCmdInteract)
+#define cvxCmdInqActive CALL_PROFILE_CALL(617, cvxCmdInqActive)
+#define cvxCmdMarker CALL_PROFILE_CALL(618, cvxCmdMarker)
+#define cvxCmdStateGet CALL_PROFILE_CALL(619, cvxCmdStateGet)
+#define cvxCmdStateSet CALL_PROFILE_CALL(620, cvxCmdStateSet)
+#define cvxCmdTemplate CALL_PROFILE_CALL(621, cvxCmdTemplate)
+#define cvxCmdTemplateUnload CALL_PROFILE_CALL(622, cvxCmdTemplateUnload)
+#define cvxEchoColorGet CALL_PROFILE_CALL(623, cvxEchoColorGet)
+#define cvxEchoColorSet CALL_PROFILE_CALL(624, cvxEchoColorSet)
+#define cvxEchoColorAtSet CALL_PROFILE_CALL(625, cvxEchoColorAtSet)
+#define cvxEchoColorAtGet CALL_PROFILE_CALL(626, cvxEchoColorAtGet)
+#define cvxEchoCustomStart CALL_PROFILE_CALL(627, cvxEchoCustomStart)
+#define cvxEchoCustomEnd CALL_PROFILE_CALL(628, cvxEchoCustomEnd)
+#define cvxEchoDraw CALL_PROFILE_CALL(629, cvxEchoDraw)
+#define cvxEchoStart CALL_PROFILE_CALL(630, cvxEchoStart)
+#define cvxEchoEnd CALL_PROFILE_CALL(631, cvxEchoEnd)
+#define cvxEchoEscDisable CALL_PROFILE_CALL(632, cvxEchoEscDisable)
+#define cvxEchoEscRestore CALL_PROFILE_CALL(633, cvxEchoEscRestore)
+#define cvxTplInqFnCust CALL_PROFILE_CALL(634, cvxTplInqFnCust)
+#define cvxTplInqFnEcho CALL_PROFILE_CALL(635, cvxTplInqFnEcho)
+#define cvxTplInqFnInit CALL_PROFILE_CALL(636, cvxTplInqFnInit)
+#define cvxTplInqFnTerm CALL_PROFILE_CALL(637, cvxTplInqFnTerm)
+#define cvxPartAddLineDim CALL_PROFILE_CALL(638, cvxPartAddLineDim)
+#define cvxPartAddSymmetryDim CALL_PROFILE_CALL(639, cvxPartAddSymmetryDim)
+#define cvxPartAddAngleDim CALL_PROFILE_CALL(640, cvxPartAddAngleDim)
+#define cvxPartAddRadDim CALL_PROFILE_CALL(641, cvxPartAddRadDim)
+#define cvxPartAddChamferDim CALL_PROFILE_CALL(642, cvxPartAddChamferDim)
+#define cvxPartAddArcDim CALL_PROFILE_CALL(643, cvxPartAddArcDim)
+#define cvxPartAddCoorDim CALL_PROFILE_CALL(644, cvxPartAddCoorDim)
+#define cvxPartAddLabelDim CALL_PROFILE_CALL(645, cvxPartAddLabelDim)
+#define cvxPartAddDatumDim CALL_PROFILE_CALL(646, cvxPartAddDatumDim)
+#define cvxPartAddDatumTargetDim CALL_PROFILE_CALL(647, cvxPartAddDatumTargetDim)
+#define cvxPartAddFcsDim CALL_PROFILE_CALL(648, cvxPartAddFcsDim)
+#define cvxPartAddSymSrfDim CALL_PROFILE_CALL(649, cvxPartAddSymSrfDim)
+#define cvxPartAddCenLinDim CALL_PROFILE_CALL(650, cvxPartAddCenLinDim)
+#define cvxPartAddCenMarkDim CALL_PROFILE_CALL(651, cvxPartAddCenMarkDim)
+#define cvxPartAddPMIText CALL_PROFILE_CALL(652, cvxPartAddPMIText)
+#define cvxPartAddBalloon CALL_PROFILE_CALL(653, cvxPartAddBalloon)
+#define cvxPartBoxInit CALL_PROFILE_CALL(654, cvxPartBoxInit)
+#define cvxPartBox CALL_PROFILE_CALL(655, cvxPartBox)
+#define cvxPartCylInit CALL_PROFILE_CALL(656, cvxPartCylInit)
+#define cvxPartCyl CALL_PROFILE_CALL(657, cvxPartCyl)
+#define cvxPartConeInit CALL_PROFILE_CALL(658, cvxPartConeInit)
+#define cvxPartCone CALL_PROFILE_CALL(659, cvxPartCone)
+#define cvxPartSphereInit CALL_PROFILE_CALL(660, cvxPartSphereInit)
+#define cvxPartSphere CALL_PROFILE_CALL(661, cvxPartSphere)
+#define cvxPartEllipsoidInit CALL_PROFILE_CALL(662, cvxPartEllipsoidInit)
+#define cvxPartEllipsoid CALL_PROFILE_CALL(663, cvxPartEllipsoid)
+#define cvxPartExtrudeInit CALL_PROFILE_CALL(664, cvxPartExtrudeInit)
+#define cvxPartExtrude CALL_PROFILE_CALL(665, cvxPartExtrude)
+#define cvxPartRevolveInit CALL_PROFILE_CALL(666, cvxPartRevolveInit)
+#define cvxPartRevolve CALL_PROFILE_CALL(667, cvxPartRevolve)
+#define cvxPartSweepInit CALL_PROFILE_CALL(668, cvxPartSweepInit)
+#define cvxPartSweep CALL_PROFILE_CALL(669, cvxPartSweep)
+#define cvxPartSpiralSweepInit CALL_PROFILE_CALL(670, cvxPartSpiralSweepInit)
+#define cvxPartSpiralSweep CALL_PROFILE_CALL(671, cvxPartSpiralSweep)
+#define cvxPartLoftInit CALL_PROFILE_CALL(672, cvxPartLoftInit)
+#define cvxPartLoft CALL_PROFILE_CALL(673, cvxPartLoft)
+#define cvxPartFillet CALL_PROFILE_CALL(674, cvxPartFillet)
+#define cvxPartFilletAllInit CALL_PROFILE_CALL(675, cvxPartFilletAllInit)
+#define cvxPartFilletAll CALL_PROFILE_CALL(676, cvxPartFilletAll)
+#define cvxPartFaceFilletInit CALL_PROFILE_CALL(677, cvxPartFaceFilletInit)
+#define cvxPartFaceFillet CALL_PROFILE_CALL(678, cvxPartFaceFillet)
+#define cvxPartChamConst CALL_PROFILE_CALL(679, cvxPartChamConst)
+#define cvxPartChamAng CALL_PROFILE_CALL(680, cvxPartChamAng)
+#define cvxPartChamAsym CALL_PROFILE_CALL(681, cvxPartChamAsym)
+#define cvxChamFlltSetDataInit CALL_PROFILE_CALL(682, cvxChamFlltSetDataInit)
+#define cvxPartChamferAllInit CALL_PROFILE_CALL(683, cvxPartChamferAllInit)
+#define cvxPartChamferAll CALL_PROFILE_CALL(684, cvxPartChamferAll)
+#define cvxPartDraftInit CALL_PROFILE_CALL(685, cvxPartDraftInit)
+#define cvxPartDraft CALL_PROFILE_CALL(686, cvxPartDraft)
+#define cvxPartHoleInit CALL_PROFILE_CALL(687, cvxPartHoleInit)
+#define cvxPartHole CALL_PROFILE_CALL(688, cvxPartHole)
+#define cvxPartModifyHoleInit CALL_PROFILE_CALL(689, cvxPartModifyHoleInit)
+#define cvxPartModifyHole CALL_PROFILE_CALL(690, cvxPartModifyHole)
+#define cvxPartFlagHolesInit CALL_PROFILE_CALL(691, cvxPartFlagHolesInit)
+#define cvxPartFlagHoles CALL_PROFILE_CALL(692, cvxPartFlagHoles)
+#define cvxPartRibInit CALL_PROFILE_CALL(693, cvxPartRibInit)
+#define cvxPartRib CALL_PROFILE_CALL(694, cvxPartRib)
+#define cvxPartFlagExtThreadInit CALL_PROFILE_CALL(695, cvxPartFlagExtThreadInit)
+#define cvxPartFlagExtThread CALL_PROFILE_CALL(696, cvxPartFlagExtThread)
+#define cvxPartThreadAtInit CALL_PROFILE_CALL(697, cvxPartThreadAtInit)
+#define cvxPartThreadAt CALL_PROFILE_CALL(698, cvxPartThreadAt)
+#define cvxPartLipInit CALL_PROFILE_CALL(699, cvxPartLipInit)
+#define cvxPartLip CALL_PROFILE_CALL(700, cvxPartLip)
+#define cvxPartStockInit CALL_PROFILE_CALL(701, cvxPartStockInit)
+#define cvxPartStock CALL_PROFILE_CALL(702, cvxPartStock)
+#define cvxPartFaceOffset CALL_PROFILE_CALL(703, cvxPartFaceOffset)
+#define cvxPartShapeFaceOffsetInit CALL_PROFILE_CALL(704, cvxPartShapeFaceOffsetInit)
+#define cvxPartShapeFaceOffset CALL_PROFILE_CALL(705, cvxPartShapeFaceOffset)
+#define cvxPartShellInit CALL_PROFILE_CALL(706, cvxPartShellInit)
+#define cvxPartShell CALL_PROFILE_CALL(707, cvxPartShell)
+#define cvxPartThickenInit CALL_PROFILE_CALL(708, cvxPartThickenInit)
+#define cvxPartThicken CALL_PROFILE_CALL(709, cvxPartThicken)
+#define cvxPartBool CALL_PROFILE_CALL(710, cvxPartBool)
+#define cvxPartBool2 CALL_PROFILE_CALL(711, cvxPartBool2)
+#define cvxPartBool3 CALL_PROFILE_CALL(712, cvxPartBool3)
+#define cvxPartDivideInit CALL_PROFILE_CALL(713, cvxPartDivideInit)
+#define cvxPartDivide CALL_PROFILE_CALL(714, cvxPartDivide)
+#define cvxPartTrimInit CALL_PROFILE_CALL(715, cvxPartTrimInit)
+#define cvxPartTrim CALL_PROFILE_CALL(716, cvxPartTrim)
+#define cvxPartSimplify CALL_PROFILE_CALL(717, cvxPartSimplify)
+#define cvxPartReplaceInit CALL_PROFILE_CALL(718, cvxPartReplaceInit)
+#define cvxPartReplace CALL_PROFILE_CALL(719, cvxPartReplace)
+#define cvxPartInlayInit CALL_PROFILE_CALL(720, cvxPartInlayInit)
+#define cvxPartInlay CALL_PROFILE_CALL(721, cvxPartInlay)
+#define cvxPartSelfXInit CALL_PROFILE_CALL(722, cvxPartSelfXInit)
+#define cvxPartSelfX CALL_PROFILE_CALL(723, cvxPartSelfX)
+#define cvxPartPunchInit CALL_PROFILE_CALL(724, cvxPartPunchInit)
+#define cvxPartPunch CALL_PROFILE_CALL(725, cvxPartPunch)
+#define cvxPartTwistInit CALL_PROFILE_CALL(726, cvxPartTwistInit)
+#define cvxPartTwist CALL_PROFILE_CALL(727, cvxPartTwist)
+#define cvxPartTaperInit CALL_PROFILE_CALL(728, cvxPartTaperInit)
+#define cvxPartTaper CALL_PROFILE_CALL(729, cvxPartTaper)
+#define cvxPartStretchInit CALL_PROFILE_CALL(730, cvxPartStretchInit)
+#define cvxPartStretch CALL_PROFILE_CALL(731, cvxPartStretch)
+#define cvxPartMorphToCrvInit CALL_PROFILE_CALL(732, cvxPartMorphToCrvInit)
+#define cvxPartMorphToCrv CALL_PROFILE_CALL(733, cvxPartMorphToCrv)
+#define cvxPtnDataInit CALL_PROFILE_CALL(734, cvxPtnDataInit)
+#define cvxPartPatternGeom CALL_PROFILE_CALL(735, cvxPartPatternGeom)
+#define cvxPtnVarTblInit CALL_PROFILE_CALL(736, cvxPtnVarTblInit)
+#define cvxPartPatternFtr CALL_PROFILE_CALL(737, cvxPartPatternFtr)
+#define cvxPartMirrorGeominit CALL_PROFILE_CALL(738, cvxPartMirrorGeominit)
+#define cvxPartMirrorGeom CALL_PROFILE_CALL(739, cvxPartMirrorGeom)
+#define cvxPartMirrorFtrInit CALL_PROFILE_CALL(740, cvxPartMirrorFtrInit)
+#define cvxPartMirrorFtr CALL_PROFILE_CALL(741, cvxPartMirrorFtr)
+#define cvxPartMovePntToPnt CALL_PROFILE_CALL(742, cvxPartMovePntToPnt)
+#define cvxPartMoveTransform CALL_PROFILE_CALL(743, cvxPartMoveTransform)
+#define cvxPartMoveTransformList CALL_PROFILE_CALL(744, cvxPartMoveTransformList)
+#define cvxPartMove CALL_PROFILE_CALL(745, cvxPartMove)
+#define cvxPartCopyDirDis CALL_PROFILE_CALL(746, cvxPartCopyDirDis)
+#define cvxPartCopyPntToPnt CALL_PROFILE_CALL(747, cvxPartCopyPntToPnt)
+#define cvxPartCopyTransform CALL_PROFILE_CALL(748, cvxPartCopyTransform)
+#define cvxPartCopyTransformList CALL_PROFILE_CALL(749, cvxPartCopyTransformList)
+#define cvxPartCopyInit CALL_PROFILE_CALL(750, cvxPartCopyInit)
+#define cvxPartCopy CALL_PROFILE_CALL(751, cvxPartCopy)
+#define cvxPartScale CALL_PROFILE_CALL(752, cvxPartScale)
+#define cvxPartScale2 CALL_PROFILE_CALL(753, cvxPartScale2)
+#define cvxPtnSpacingTableVariableGet CALL_PROFILE_CALL(754, cvxPtnSpacingTableVariableGet)
+#define cvxPtnSpacingTableVariableSet CALL_PROFILE_CALL(755, cvxPtnSpacingTableVariableSet)
+#define cvxPtnParameterTableVariableGet CALL_PROFILE_CALL(756, cvxPtnParameterTableVariableGet)
+#define cvxPtnParameterTableVariableSet CALL_PROFILE_CALL(757, cvxPtnParameterTableVariableSet)
+#define cvxPtnVarTblMemFree CALL_PROFILE_CALL(758, cvxPtnVarTblMemFree)
+#define cvxPartSmdExtrudeTabInit CALL_PROFILE_CALL(759, cvxPartSmdExtrudeTabInit)
+#define cvxPartSmdExtrudeTab CALL_PROFILE_CALL(760, cvxPartSmdExtrudeTab)
+#define cvxPartSmdExtrudeFlangeinit CALL_PROFILE_CALL(761, cvxPartSmdExtrudeFlangeinit)
+#define cvxPartSmdExtrudeFlange CALL_PROFILE_CALL(762, cvxPartSmdExtrudeFlange)
+#define cvxPartSmdReliefDataInit CALL_PROFILE_CALL(763, cvxPartSmdReliefDataInit)
+#define cvxPartSmdFullFlangeInit CALL_PROFILE_CALL(764, cvxPartSmdFullFlangeInit)
+#define cvxPartSmdFullFlange CALL_PROFILE_CALL(765, cvxPartSmdFullFlange)
+#define cvxPartSmdProfFlangeProfMatInit CALL_PROFILE_CALL(766, cvxPartSmdProfFlangeProfMatInit)
+#define cvxPartSmdProfFlangeInit CALL_PROFILE_CALL(767, cvxPartSmdProfFlangeInit)
+#define cvxPartSmdProfFlange CALL_PROFILE_CALL(768, cvxPartSmdProfFlange)
+#define cvxPartSmdPartialFlangeInit CALL_PROFILE_CALL(769, cvxPartSmdPartialFlangeInit)
+#define cvxPartSmdPartialFlange CALL_PROFILE_CALL(770, cvxPartSmdPartialFlange)
+#define cvxPartSmdHemFlangeInit CALL_PROFILE_CALL(771, cvxPartSmdHemFlangeInit)
+#define cvxPartSmdHemFlange CALL_PROFILE_CALL(772, cvxPartSmdHemFlange)
+#define cvxPartSmdLftFlangeInit CALL_PROFILE_CALL(773, cvxPartSmdLftFlangeInit)
+#define cvxPartSmdLftFlange CALL_PROFILE_CALL(774, cvxPartSmdLftFlange)
+#define cvxPartSmdSweptFlangeInit CALL_PROFILE_CALL(775, cvxPartSmdSweptFlangeInit)
+#define cvxPartSmdSweptFlange CALL_PROFILE_CALL(776, cvxPartSmdSweptFlange)
+#define cvxPartSmdFoldByLineInit CALL_PROFILE_CALL(777, cvxPartSmdFoldByLineInit)
+#define cvxPartSmdFoldByLine CALL_PROFILE_CALL(778, cvxPartSmdFoldByLine)
+#define cvxPartSmdJogInit CALL_PROFILE_CALL(779, cvxPartSmdJogInit)
+#define cvxPartSmdJog CALL_PROFILE_CALL(780, cvxPartSmdJog)
+#define cvxPartSmdExtendFlangeInit CALL_PROFILE_CALL(781, cvxPartSmdExtendFlangeInit)
+#define cvxPartSmdExtendFlange CALL_PROFILE_CALL(782, cvxPartSmdExtendFlange)
+#define cvxPartSmdFlangeInit CALL_PROFILE_CALL(783, cvxPartSmdFlangeInit)
+#define cvxPartSmdFlange CALL_PROFILE_CALL(784, cvxPartSmdFlange)
+#define cvxPartSmdBendTaperDefDataInit CALL_PROFILE_CALL(785, cvxPartSmdBendTaperDefDataInit)
+#define cvxPartSmdBendTaperInit CALL_PROFILE_CALL(786, cvxPartSmdBendTaperInit)
+#define cvxPartSmdBendTaper CALL_PROFILE_CALL(787, cvxPartSmdBendTaper)
+#define cvxPartSmdNormalCutinit CALL_PROFILE_CALL(788, cvxPartSmdNormalCutinit)
+#define cvxPartSmdNormalCut CALL_PROFILE_CALL(789, cvxPartSmdNormalCut)
+#define cvxPartSmdCloseCornerInit CALL_PROFILE_CALL(790, cvxPartSmdCloseCornerInit)
+#define cvxPartSmdCloseCorner CALL_PROFILE_CALL(791, cvxPartSmdCloseCorner)
+#define cvxPartSmdDimpleInit CALL_PROFILE_CALL(792, cvxPartSmdDimpleInit)
+#define cvxPartSmdDimple CALL_PROFILE_CALL(793, cvxPartSmdDimple)
+#define cvxPartSmdLouverInit CALL_PROFILE_CALL(794, cvxPartSmdLouverInit)
+#define cvxPartSmdLouver CALL_PROFILE_CALL(795, cvxPartSmdLouver)
+#define cvxPartSmdPunchInit CALL_PROFILE_CALL(796, cvxPartSmdPunchInit)
+#define cvxPartSmdPunch CALL_PROFILE_CALL(797, cvxPartSmdPunch)
+#define cvxPartSmdFold CALL_PROFILE_CALL(798, cvxPartSmdFold)
+#define cvxPartSmdUnfold CALL_PROFILE_CALL(799, cvxPartSmdUnfold)
+#define cvxPartSmdFlattenInit CALL_PROFILE_CALL(800, cvxPartSmdFlattenInit)
+#define cvxPartSmdFlatten CALL_PROFILE_CALL(801, cvxPartSmdFlatten)
+#define cvxPartSmdLnUnfoldInit CALL_PROFILE_CALL(802, cvxPartSmdLnUnfoldInit)
+#define cvxPartSmdLnUnfold CALL_PROFILE_CALL(803, cvxPartSmdLnUnfold)
+#define cvxPartSmdChangeBendInit CALL_PROFILE_CALL(804, cvxPartSmdChangeBendInit)
+#define cvxPartSmdChangeBend CALL_PROFILE_CALL(805, cvxPartSmdChangeBend)
+#define cvxPartSmdRipInit CALL_PROFILE_CALL(806, cvxPartSmdRipInit)
+#define cvxPartSmdRip CALL_PROFILE_CALL(807, cvxPartSmdRip)
+#define cvxPartSmdMarkBendInit CALL_PROFILE_CALL(808, cvxPartSmdMarkBendInit)
+#define cvxPartSmdMarkBend CALL_PROFILE_CALL(809, cvxPartSmdMarkBend)
+#define cvxSkNestingProfileDataInit CALL_PROFILE_CALL(810, cvxSkNestingProfileDataInit)
+#define cvxSkNestingBlankDataInit CALL_PROFILE_CALL(811, cvxSkNestingBlankDataInit)
+#define cvxSkNestingInit CALL_PROFILE_CALL(812, cvxSkNestingInit)
+#define cvxSkNesting CALL_PROFILE_CALL(813, cvxSkNesting)
+#define cvxSkLine2pt CALL_PROFILE_CALL(814, cvxSkLine2pt)
+#define cvxSkAddPolyline CALL_PROFILE_CALL(815, cvxSkAddPolyline)
+#define cvxSkAxis CALL_PROFILE_CALL(816, cvxSkAxis)
+#define cvxSkCir3pt CALL_PROFILE_CALL(817, cvxSkCir3pt)
+#define cvxSkCirRad CALL_PROFILE_CALL(818, cvxSkCirRad)
+#define cvxSkArc3pt CALL_PROFILE_CALL(819, cvxSkArc3pt)
+#define cvxSkArcRad CALL_PROFILE_CALL(820, cvxSkArcRad)
+#define cvxSkEllipseInit CALL_PROFILE_CALL(821, cvxSkEllipseInit)
+#define cvxSkEllipse CALL_PROFILE_CALL(822, cvxSkEllipse)
+#define cvxSkPnt CALL_PROFILE_CALL(823, cvxSkPnt)
+#define cvxSkPntsOnCrv CALL_PROFILE_CALL(824, cvxSkPntsOnCrv)
+#define cvxSkReadyTextInit CALL_PROFILE_CALL(825, cvxSkReadyTextInit)
+#define cvxSkReadyText CALL_PROFILE_CALL(826, cvxSkReadyText)
+#define cvxEntTextNew CALL_PROFILE_CALL(827, cvxEntTextNew)
+#define cvxSkNgonsInit CALL_PROFILE_CALL(828, cvxSkNgonsInit)
+#define cvxSkNgons CALL_PROFILE_CALL(829, cvxSkNgons)
+#define cvxSkCrvIntInit CALL_PROFILE_CALL(830, cvxSkCrvIntInit)
+#define cvxSkCrvIntScaleInit CALL_PROFILE_CALL(831, cvxSkCrvIntScaleInit)
+#define cvxSkCrvInt CALL_PROFILE_CALL(832, cvxSkCrvInt)
+#define cvxSkSplineInit CALL_PROFILE_CALL(833, cvxSkSplineInit)
+#define cvxSkSpline CALL_PROFILE_CALL(834, cvxSkSpline)
+#define cvxSkConic3pt CALL_PROFILE_CALL(835, cvxSkConic3pt)
+#define cvxSkConic3ptInit CALL_PROFILE_CALL(836, cvxSkConic3ptInit)
+#define cvxSkFilletInit CALL_PROFILE_CALL(837, cvxSkFilletInit)
+#define cvxSkFillet CALL_PROFILE_CALL(838, cvxSkFillet)
+#define cvxSkChamferInit CALL_PROFILE_CALL(839, cvxSkChamferInit)
+#define cvxSkChamfer CALL_PROFILE_CALL(840, cvxSkChamfer)
+#define cvxSkPowerTrim CALL_PROFILE_CALL(841, cvxSkPowerTrim)
+#define cvxSkOneTouchTrim CALL_PROFILE_CALL(842, cvxSkOneTouchTrim)
+#define cvxSkTrimExtInit CALL_PROFILE_CALL(843, cvxSkTrimExtInit)
+#define cvxSkTrimExt CALL_PROFILE_CALL(844, cvxSkTrimExt)
+#define cvxSkTrimSplitInit CALL_PROFILE_CALL(845, cvxSkTrimSplitInit)
+#define cvxSkTrimSplitCrv CALL_PROFILE_CALL(846, cvxSkTrimSplitCrv)
+#define cvxSkTrimSplitPnt CALL_PROFILE_CALL(847, cvxSkTrimSplitPnt)
+#define cvxSkTrimSplitCorInit CALL_PROFILE_CALL(848, cvxSkTrimSplitCorInit)
+#define cvxSkTrimSplitCor CALL_PROFILE_CALL(849, cvxSkTrimSplitCor)
+#define cvxSkDelBowties CALL_PROFILE_CALL(850, cvxSkDelBowties)
+#define cvxSkSplitIsectInit CALL_PROFILE_CALL(851, cvxSkSplitIsectInit)
+#define cvxSkSplitIsect CALL_PROFILE_CALL(852, cvxSkSplitIsect)
+#define cvxSkAutoCons CALL_PROFILE_CALL(853, cvxSkAutoCons)
+#define cvxSkAddGeomCons CALL_PROFILE_CALL(854, cvxSkAddGeomCons)
+#define cvxSkAutoAddCoinCons CALL_PROFILE_CALL(855, cvxSkAutoAddCoinCons)
+#define cvxSkAutoAddCoinConsSkipRefGeom CALL_PROFILE_CALL(856, cvxSkAutoAddCoinConsSkipRefGeom)
+#define cvxSkAddConsDim CALL_PROFILE_CALL(857, cvxSkAddConsDim)
+#define cvxSkAddPerimeterDim CALL_PROFILE_CALL(858, cvxSkAddPerimeterDim)
+#define cvxSkReferenceInit CALL_PROFILE_CALL(859, cvxSkReferenceInit)
+#define cvxSkReference CALL_PROFILE_CALL(860, cvxSkReference)
+#define cvxSkMoveInit CALL_PROFILE_CALL(861, cvxSkMoveInit)
+#define cvxSkMove CALL_PROFILE_CALL(862, cvxSkMove)
+#define cvxSkRotate CALL_PROFILE_CALL(863, cvxSkRotate)
+#define cvxSkRotateInit CALL_PROFILE_CALL(864, cvxSkRotateInit)
+#define cvxSkMirr CALL_PROFILE_CALL(865, cvxSkMirr)
+#define cvxSkMirrInit CALL_PROFILE_CALL(866, cvxSkMirrInit)
+#define cvxSkScale CALL_PROFILE_CALL(867, cvxSkScale)
+#define cvxSkPtnDataInit CALL_PROFILE_CALL(868, cvxSkPtnDataInit)
+#define cvxSkPattern CALL_PROFILE_CALL(869, cvxSkPattern)
+#define cvxSkCopyInit CALL_PROFILE_CALL(870, cvxSkCopyInit)
+#define cvxSkCopy CALL_PROFILE_CALL(871, cvxSkCopy)
+#define cvxPartSkIns CALL_PROFILE_CALL(872, cvxPartSkIns)
+#define cvxPartSkIns2 CALL_PROFILE_CALL(873, cvxPartSkIns2)
+#define cvxPartSkNew CALL_PROFILE_CALL(874, cvxPartSkNew)
+#define cvxPartSkPlane CALL_PROFILE_CALL(875, cvxPartSkPlane)
+#define cvxHatchPtnDataInit CALL_PROFILE_CALL(876, cvxHatchPtnDataInit)
+#define cvxPartCosSkPlane CALL_PROFILE_CALL(877, cvxPartCosSkPlane)
+#define cvxPartPntByOffsetInit CALL_PROFILE_CALL(878, cvxPartPntByOffsetInit)
+#define cvxPartPntBy2LinesInit CALL_PROFILE_CALL(879, cvxPartPntBy2LinesInit)
+#define cvxPartUDFInit CALL_PROFILE_CALL(880, cvxPartUDFInit)
+#define cvxPartUDFInqFlds CALL_PROFILE_CALL(881, cvxPartUDFInqFlds)
+#define cvxPartUDFTerm CALL_PROFILE_CALL(882, cvxPartUDFTerm)
+#define cvxPartUDFExplode CALL_PROFILE_CALL(883, cvxPartUDFExplode)
+#define cvxPartUDFInqPath CALL_PROFILE_CALL(884, cvxPartUDFInqPath)
+#define cvxPartUDFInqLongPath CALL_PROFILE_CALL(885, cvxPartUDFInqLongPath)
+#define cvxPartUDFInqSubFtrs CALL_PROFILE_CALL(886, cvxPartUDFInqSubFtrs)
+#define cvxPartFtrIsUDF CALL_PROFILE_CALL(887, cvxPartFtrIsUDF)
+#define cvxPartUDFReplace CALL_PROFILE_CALL(888, cvxPartUDFReplace)
+#define cvxPartUDFWizardPathSet CALL_PROFILE_CALL(889, cvxPartUDFWizardPathSet)
+#define cvxPartUDFInsPathSet CALL_PROFILE_CALL(890, cvxPartUDFInsPathSet)
+#define cvxPartUDFWizardPathGet CALL_PROFILE_CALL(891, cvxPartUDFWizardPathGet)
+#define cvxPartUDFWizardPathGetByLongPath CALL_PROFILE_CALL(892, cvxPartUDFWizardPathGetByLongPath)
+#define cvxPartUDFInsPathGet CALL_PROFILE_CALL(893, cvxPartUDFInsPathGet)
+#define cvxPartUDFInsPathGetByLongPath CALL_PROFILE_CALL(894, cvxPartUDFInsPathGetByLongPath)
+#define cvxPartPnt CALL_PROFILE_CALL(895, cvxPartPnt)
+#define cvxPartPntNew CALL_PROFILE_CALL(896, cvxPartPntNew)
+#define cvxPartPnts CALL_PROFILE_CALL(897, cvxPartPnts)
+#define cvxPartPntsOnCrv CALL_PROFILE_CALL(898, cvxPartPntsOnCrv)
+#define cvxPartLine2pt CALL_PROFILE_CALL(899, cvxPartLine2pt)
+#define cvxPartLineInit CALL_PROFILE_CALL(900, cvxPartLineInit)
+#define cvxPartLine CALL_PROFILE_CALL(901, cvxPartLine)
+#define cvxPartPolylineInit CALL_PROFILE_CALL(902, cvxPartPolylineInit)
+#define cvxPartPolyLine CALL_PROFILE_CALL(903, cvxPartPolyLine)
+#define cvxPartArc3pt CALL_PROFILE_CALL(904, cvxPartArc3pt)
+#define cvxPartArcRad CALL_PROFILE_CALL(905, cvxPartArcRad)
+#define cvxPartArcInit CALL_PROFILE_CALL(906, cvxPartArcInit)
+#define cvxPartArc CALL_PROFILE_CALL(907, cvxPartArc)
+#define cvxPartCircleInit CALL_PROFILE_CALL(908, cvxPartCircleInit)
+#define cvxPartCircle CALL_PROFILE_CALL(909, cvxPartCircle)
+#define cvxPartRectangleInit CALL_PROFILE_CALL(910, cvxPartRectangleInit)
+#define cvxPartRectangle CALL_PROFILE_CALL(911, cvxPartRectangle)
+#define cvxPartCir3pt CALL_PROFILE_CALL(912, cvxPartCir3pt)
+#define cvxPartCirRad CALL_PROFILE_CALL(913, cvxPartCirRad)
+#define cvxPartEllipseInit CALL_PROFILE_CALL(914, cvxPartEllipseInit)
+#define cvxPartEllipse CALL_PROFILE_CALL(915, cvxPartEllipse)
+#define cvxPartCrvIntInit CALL_PROFILE_CALL(916, cvxPartCrvIntInit)
+#define cvxPartCrvIntScaleInit CALL_PROFILE_CALL(917, cvxPartCrvIntScaleInit)
+#define cvxPartCrvInt CALL_PROFILE_CALL(918, cvxPartCrvInt)
+#define cvxPartSplineInit CALL_PROFILE_CALL(919, cvxPartSplineInit)
+#define cvxSplinePntInit CALL_PROFILE_CALL(920, cvxSplinePntInit)
+#define cvxPartSpline CALL_PROFILE_CALL(921, cvxPartSpline)
+#define cvxPartCrvProjToFaceInit CALL_PROFILE_CALL(922, cvxPartCrvProjToFaceInit)
+#define cvxPartCrvProjToFace CALL_PROFILE_CALL(923, cvxPartCrvProjToFace)
+#define cvxPartInterXCurveInit CALL_PROFILE_CALL(924, cvxPartInterXCurveInit)
+#define cvxPartInterXCurve CALL_PROFILE_CALL(925, cvxPartInterXCurve)
+#define cvxPartCrvOnFaceThruPtsInit CALL_PROFILE_CALL(926, cvxPartCrvOnFaceThruPtsInit)
+#define cvxPartCrvOnFaceThruPts CALL_PROFILE_CALL(927, cvxPartCrvOnFaceThruPts)
+#define cvxPartIsoCurveOnFaceInit CALL_PROFILE_CALL(928, cvxPartIsoCurveOnFaceInit)
+#define cvxPartIsoCurveOnFace CALL_PROFILE_CALL(929, cvxPartIsoCurveOnFace)
+#define cvxPartIsoclineCurveInit CALL_PROFILE_CALL(930, cvxPartIsoclineCurveInit)
+#define cvxPartIsoclineCurve CALL_PROFILE_CALL(931, cvxPartIsoclineCurve)
+#define cvxPartFaceCurve CALL_PROFILE_CALL(932, cvxPartFaceCurve)
+#define cvxPartCombinedProj CALL_PROFILE_CALL(933, cvxPartCombinedProj)
+#define cvxPartExtractCenterlines CALL_PROFILE_CALL(934, cvxPartExtractCenterlines)
+#define cvxPartBlendCrvsConsInit CALL_PROFILE_CALL(935, cvxPartBlendCrvsConsInit)
+#define cvxPartBlendCrvsInit CALL_PROFILE_CALL(936, cvxPartBlendCrvsInit)
+#define cvxPartBlendCrvs CALL_PROFILE_CALL(937, cvxPartBlendCrvs)
+#define cvxPartCurveOffset CALL_PROFILE_CALL(938, cvxPartCurveOffset)
+#define cvxPartSpiralCurve CALL_PROFILE_CALL(939, cvxPartSpiralCurve)
+#define cvxPartCrvList CALL_PROFILE_CALL(940, cvxPartCrvList)
+#define cvxPartCurve CALL_PROFILE_CALL(941, cvxPartCurve)
+#define cvxPartCurveSilh CALL_PROFILE_CALL(942, cvxPartCurveSilh)
+#define cvxPartFittingCrv CALL_PROFILE_CALL(943, cvxPartFittingCrv)
+#define cvxPartCrvFilletInit CALL_PROFILE_CALL(944, cvxPartCrvFilletInit)
+#define cvxPartCrvFillet CALL_PROFILE_CALL(945, cvxPartCrvFillet)
+#define cvxPartCrvFilletChainInit CALL_PROFILE_CALL(946, cvxPartCrvFilletChainInit)
+#define cvxPartCrvFilletChain CALL_PROFILE_CALL(947, cvxPartCrvFilletChain)
+#define cvxPartCrvChamferInit CALL_PROFILE_CALL(948, cvxPartCrvChamferInit)
+#define cvxPartCrvChamfer CALL_PROFILE_CALL(949, cvxPartCrvChamfer)
+#define cvxPartCrvChamferChainInit CALL_PROFILE_CALL(950, cvxPartCrvChamferChainInit)
+#define cvxPartCrvChamferChain CALL_PROFILE_CALL(951, cvxPartCrvChamferChain)
+#define cvxPartCrvTrimToFaces CALL_PROFILE_CALL(952, cvxPartCrvTrimToFaces)
+#define cvxPartCrvSplitAtPnts CALL_PROFILE_CALL(953, cvxPartCrvSplitAtPnts)
+#define cvxPartInqReversedCurve CALL_PROFILE_CALL(954, cvxPartInqReversedCurve)
+#define cvxPartCrvTrimWithCrv CALL_PROFILE_CALL(955, cvxPartCrvTrimWithCrv)
+#define cvxPartConcentricArc CALL_PROFILE_CALL(956, cvxPartConcentricArc)
+#define cvxPartCrvConvertToArcsInit CALL_PROFILE_CALL(957, cvxPartCrvConvertToArcsInit)
+#define cvxPartCrvConvertToArcs CALL_PROFILE_CALL(958, cvxPartCrvConvertToArcs)
+#define ZwCommandPost CALL_PROFILE_CALL(959, ZwCommandPost)
+#define ZwCommandPostExecuteAll CALL_PROFILE_CALL(960, ZwCommandPostExecuteAll)
+#define ZwCommandSend CALL_PROFILE_CALL(961, ZwCommandSend)
+#define ZwCommandLicenseCheck CALL_PROFILE_CALL(962, ZwCommandLicenseCheck)
+#define ZwCommandReactorSet CALL_PROFILE_CALL(963, ZwCommandReactorSet)
+#define ZwCommandFunctionLoad CALL_PROFILE_CALL(964, ZwCommandFunctionLoad)
+#define ZwCommandCallbackLoad CALL_PROFILE_CALL(965, ZwCommandCallbackLoad)
+#define ZwCommandFunctionUnload CALL_PROFILE_CALL(966, ZwCommandFunctionUnload)
+#define ZwCommandVariableLoad CALL_PROFILE_CALL(967, ZwCommandVariableLoad)
+#define ZwCommandVariableUnload CALL_PROFILE_CALL(968, ZwCommandVariableUnload)
+#define ZwCommandMacroExecute CALL_PROFILE_CALL(969, ZwCommandMacroExecute)
+#define ZwCommandMacroPathGet CALL_PROFILE_CALL(970, ZwCommandMacroPathGet)
+#define ZwComponentActivate CALL_PROFILE_CALL(971, ZwComponentActivate)
+#define ZwComponentFileAndRootGet CALL_PROFILE_CALL(972, ZwComponentFileAndRootGet)
+#define ZwComponentListGet CALL_PROFILE_CALL(973, ZwComponentListGet)
+#define ZwComponentFileLostCheck CALL_PROFILE_CALL(974, ZwComponentFileLostCheck)
+#define ZwComponentUnplacedCheck CALL_PROFILE_CALL(975, ZwComponentUnplacedCheck)
+#define ZwComponentVisibilityGet CALL_PROFILE_CALL(976, ZwComponentVisibilityGet)
+#define ZwComponentVisibilitySet CALL_PROFILE_CALL(977, ZwComponentVisibilitySet)
+#define ZwComponentPackedGet CALL_PROFILE_CALL(978, ZwComponentPackedGet)
+#define ZwComponentPackedSet CALL_PROFILE_CALL(979, ZwComponentPackedSet)
+#define ZwComponentPathAndRootListGet CALL_PROFILE_CALL(980, ZwComponentPathAndRootListGet)
+#define ZwComponentInsertInit CALL_PROFILE_CALL(981, ZwComponentInsertInit)
+#define ZwComponentInsert CALL_PROFILE_CALL(982, ZwComponentInsert)
+#define ZwComponentInsertNewInit CALL_PROFILE_CALL(983, ZwComponentInsertNewInit)
+#define ZwComponentRelationDissolve CALL_PROFILE_CALL(984, ZwComponentRelationDissolve)
+#define ZwComponentInsertNew CALL_PROFILE_CALL(985, ZwComponentInsertNew)
+#define ZwComponentFileSet CALL_PROFILE_CALL(986, ZwComponentFileSet)
+#define ZwComponentFileSaveAs CALL_PROFILE_CALL(987, ZwComponentFileSaveAs)
+#define ZwComponentFixSet CALL_PROFILE_CALL(988, ZwComponentFixSet)
+#define ZwComponentGetByMergeShape CALL_PROFILE_CALL(989, ZwComponentGetByMergeShape)
+#define ZwComponentShapeInterferenceCheck CALL_PROFILE_CALL(990, ZwComponentShapeInterferenceCheck)
+#define ZwComponentInterferenceCheck CALL_PROFILE_CALL(991, ZwComponentInterferenceCheck)
+#define ZwComponentInterferenceFree CALL_PROFILE_CALL(992, ZwComponentInterferenceFree)
+#define ZwComponentFolderCreate CALL_PROFILE_CALL(993, ZwComponentFolderCreate)
+#define ZwComponentFolderInsert CALL_PROFILE_CALL(994, ZwComponentFolderInsert)
+#define ZwComponentFolderListGet CALL_PROFILE_CALL(995, ZwComponentFolderListGet)
+#define ZwComponentFolderParentComponentGet CALL_PROFILE_CALL(996, ZwComponentFolderParentComponentGet)
+#define ZwComponentFolderDelete CALL_PROFILE_CALL(997, ZwComponentFolderDelete)
+#define cvxConfigGetColor CALL_PROFILE_CALL(998, cvxConfigGetColor)
+#define cvxConfigGetInteger CALL_PROFILE_CALL(999, cvxConfigGetInteger)
+#define cvxConfigGetNumber CALL_PROFILE_CALL(1000, cvxConfigGetNumber)
+#define cvxConfigGetOption CALL_PROFILE_CALL(1001, cvxConfigGetOption)
+#define cvxConfigGetRgb CALL_PROFILE_CALL(1002, cvxConfigGetRgb)
+#define cvxConfigGetString CALL_PROFILE_CALL(1003, cvxConfigGetString)
+#define cvxConfigGetYesNo CALL_PROFILE_CALL(1004, cvxConfigGetYesNo)
+#define cvxConfigPathGet CALL_PROFILE_CALL(1005, cvxConfigPathGet)
+#define cvxConfigSetColor CALL_PROFILE_CALL(1006, cvxConfigSetColor)
+#define cvxConfigSetInteger CALL_PROFILE_CALL(1007, cvxConfigSetInteger)
+#define cvxConfigSetNumber CALL_PROFILE_CALL(1008, cvxConfigSetNumber)
+#define cvxConfigSetOption CALL_PROFILE_CALL(1009, cvxConfigSetOption)
+#define cvxConfigSetRgb CALL_PROFILE_CALL(1010, cvxConfigSetRgb)
+#define cvxConfigSetString CALL_PROFILE_CALL(1011, cvxConfigSetString)
+#define cvxConfigSetYesNo CALL_PROFILE_CALL(1012, cvxConfigSetYesNo)
+#define ZwConfigActiveGet CALL_PROFILE_CALL(1013, ZwConfigActiveGet)
+#define ZwConfigListGet CALL_PROFILE_CALL(1014, ZwConfigListGet)
+#define ZwComponentConfigListGet CALL_PROFILE_CALL(1015, ZwComponentConfigListGet)
+#define ZwComponentConfigGet CALL_PROFILE_CALL(1016, ZwComponentConfigGet)
+#define ZwComponentConfigSet CALL_PROFILE_CALL(1017, ZwComponentConfigSet)
+#define ZwConfigActivate CALL_PROFILE_CALL(1018, ZwConfigActivate)
+#define ZwConfigTableRefresh CALL_PROFILE_CALL(1019, ZwConfigTableRefresh)
+#define ZwCurveDataTransform CALL_PROFILE_CALL(1020, ZwCurveDataTransform)
+#define ZwCurveLineCheck CALL_PROFILE_CALL(1021, ZwCurveLineCheck)
+#define ZwCurvePointGetByLengthFraction CALL_PROFILE_CALL(1022, ZwCurvePointGetByLengthFraction)
+#define ZwCurveClosureCheck CALL_PROFILE_CALL(1023, ZwCurveClosureCheck)
+#define ZwCurveExtremePointGet CALL_PROFILE_CALL(1024, ZwCurveExtremePointGet)
+#define ZwCurveLengthGet CALL_PROFILE_CALL(1025, ZwCurveLengthGet)
+#define ZwCurveSegmentLengthGet CALL_PROFILE_CALL(1026, ZwCurveSegmentLengthGet)
+#define ZwCurveRadiusRangeGet CALL_PROFILE_CALL(1027, ZwCurveRadiusRangeGet)
+#define ZwCurveChainGet CALL_PROFILE_CALL(1028, ZwCurveChainGet)
+#define ZwCurveProjectionPointGet CALL_PROFILE_CALL(1029, ZwCurveProjectionPointGet)
+#define ZwCurveTParameterRangeGet CALL_PROFILE_CALL(1030, ZwCurveTParameterRangeGet)
+#define ZwCurveContinuityGet CALL_PROFILE_CALL(1031, ZwCurveContinuityGet)
+#define ZwCurveContinuityToleranceListInit CALL_PROFILE_CALL(1032, ZwCurveContinuityToleranceListInit)
+#define ZwCurvePointGetByDistance CALL_PROFILE_CALL(1033, ZwCurvePointGetByDistance)
+#define ZwCurveInflectionPointGet CALL_PROFILE_CALL(1034, ZwCurveInflectionPointGet)
+#define ZwCurveCuspsGet CALL_PROFILE_CALL(1035, ZwCurveCuspsGet)
+#define ZwCurveExtremePointAndBoundingBoxGet CALL_PROFILE_CALL(1036, ZwCurveExtremePointAndBoundingBoxGet)
+#define ZwCurveCurvatureGet CALL_PROFILE_CALL(1037, ZwCurveCurvatureGet)
+#define ZwCurveDifferentiate CALL_PROFILE_CALL(1038, ZwCurveDifferentiate)
+#define ZwCurveEndPointGet CALL_PROFILE_CALL(1039, ZwCurveEndPointGet)
+#define ZwCurveCentroidPointGet CALL_PROFILE_CALL(1040, ZwCurveCentroidPointGet)
+#define ZwCurveTessellationPointListGet CALL_PROFILE_CALL(1041, ZwCurveTessellationPointListGet)
+#define ZwCurveNURBSDataGet CALL_PROFILE_CALL(1042, ZwCurveNURBSDataGet)
+#define ZwCurveFree CALL_PROFILE_CALL(1043, ZwCurveFree)
+#define ZwCurveListGet CALL_PROFILE_CALL(1044, ZwCurveListGet)
+#define ZwCurveModifyTypeConvert CALL_PROFILE_CALL(1045, ZwCurveModifyTypeConvert)
+#define ZwExternalFeatureFileAndRootNameGet CALL_PROFILE_CALL(1046, ZwExternalFeatureFileAndRootNameGet)
+#define ZwExternalPartImport CALL_PROFILE_CALL(1047, ZwExternalPartImport)
+#define ZwReferenceCreate CALL_PROFILE_CALL(1048, ZwReferenceCreate)
+#define ZwDatumAxisCreateByTwoPoints CALL_PROFILE_CALL(1049, ZwDatumAxisCreateByTwoPoints)
+#define ZwDatumAxisCreateByPointAndDirection CALL_PROFILE_CALL(1050, ZwDatumAxisCreateByPointAndDirection)
+#define ZwDatumAxisCreateByIntersectedFaces CALL_PROFILE_CALL(1051, ZwDatumAxisCreateByIntersectedFaces)
+#define ZwDatumAxisCreateByCurve CALL_PROFILE_CALL(1052, ZwDatumAxisCreateByCurve)
+#define ZwDatumAxisCreateByCenter CALL_PROFILE_CALL(1053, ZwDatumAxisCreateByCenter)
+#define ZwDatumAxisLengthGet CALL_PROFILE_CALL(1054, ZwDatumAxisLengthGet)
+#define ZwDatumAxisLengthSet CALL_PROFILE_CALL(1055, ZwDatumAxisLengthSet)
+#define ZwDatumAxisListGet CALL_PROFILE_CALL(1056, ZwDatumAxisListGet)
+#define ZwDatumAxisDirectionGet CALL_PROFILE_CALL(1057, ZwDatumAxisDirectionGet)
+#define ZwDatumPlaneCreateByOffsetPlane CALL_PROFILE_CALL(1058, ZwDatumPlaneCreateByOffsetPlane)
+#define ZwDatumPlaneCreateByThreePoints CALL_PROFILE_CALL(1059, ZwDatumPlaneCreateByThreePoints)
+#define ZwDatumPlaneCreateByAngelToFace CALL_PROFILE_CALL(1060, ZwDatumPlaneCreateByAngelToFace)
+#define ZwDatumPlaneCreateByCurve CALL_PROFILE_CALL(1061, ZwDatumPlaneCreateByCurve)
+#define ZwDatumPlaneCreateByDynamic CALL_PROFILE_CALL(1062, ZwDatumPlaneCreateByDynamic)
+#define ZwDatumPlaneCreateByMatrix CALL_PROFILE_CALL(1063, ZwDatumPlaneCreateByMatrix)
+#define ZwCSYSCreateByThreePointsInit CALL_PROFILE_CALL(1064, ZwCSYSCreateByThreePointsInit)
+#define ZwCSYSCreateByThreePoints CALL_PROFILE_CALL(1065, ZwCSYSCreateByThreePoints)
+#define ZwCSYSCreateByPointAndDirectionInit CALL_PROFILE_CALL(1066, ZwCSYSCreateByPointAndDirectionInit)
+#define ZwCSYSCreateByPointAndDirection CALL_PROFILE_CALL(1067, ZwCSYSCreateByPointAndDirection)
+#define ZwCSYSCreateByPlaneAndDirectionInit CALL_PROFILE_CALL(1068, ZwCSYSCreateByPlaneAndDirectionInit)
+#define ZwCSYSCreateByPlaneAndDirection CALL_PROFILE_CALL(1069, ZwCSYSCreateByPlaneAndDirection)
+#define ZwCSYSAxisGet CALL_PROFILE_CALL(1070, ZwCSYSAxisGet)
+#define ZwCSYSPlaneGet CALL_PROFILE_CALL(1071, ZwCSYSPlaneGet)
+#define ZwDefaultCSYSGet CALL_PROFILE_CALL(1072, ZwDefaultCSYSGet)
+#define ZwDatumCSYSListGet CALL_PROFILE_CALL(1073, ZwDatumCSYSListGet)
+#define ZwActiveLCSSet CALL_PROFILE_CALL(1074, ZwActiveLCSSet)
+#define ZwActiveLCSGet CALL_PROFILE_CALL(1075, ZwActiveLCSGet)
+#define ZwLCSMatrixGet CALL_PROFILE_CALL(1076, ZwLCSMatrixGet)
+#define cvxDimInqType CALL_PROFILE_CALL(1077, cvxDimInqType)
+#define cvxDimInqTypeEx CALL_PROFILE_CALL(1078, cvxDimInqTypeEx)
+#define cvxDimIsRadius CALL_PROFILE_CALL(1079, cvxDimIsRadius)
+#define cvxDimInqState CALL_PROFILE_CALL(1080, cvxDimInqState)
+#define cvxDimInqDimBundles CALL_PROFILE_CALL(1081, cvxDimInqDimBundles)
+#define cvxDimFCSDataGet CALL_PROFILE_CALL(1082, cvxDimFCSDataGet)
+#define cvxDimInqVar CALL_PROFILE_CALL(1083, cvxDimInqVar)
+#define cvxDimValMod CALL_PROFILE_CALL(1084, cvxDimValMod)
+#define cvxDimValModNoUpdate CALL_PROFILE_CALL(1085, cvxDimValModNoUpdate)
+#define cvxDimInqText CALL_PROFILE_CALL(1086, cvxDimInqText)
+#define cvxDimModTxt CALL_PROFILE_CALL(1087, cvxDimModTxt)
+#define cvxDimInqTextType CALL_PROFILE_CALL(1088, cvxDimInqTextType)
+#define cvxDimModTextType CALL_PROFILE_CALL(1089, cvxDimModTextType)
+#define cvxDimInqTxtPnt CALL_PROFILE_CALL(1090, cvxDimInqTxtPnt)
+#define cvxDimModTxtPnt CALL_PROFILE_CALL(1091, cvxDimModTxtPnt)
+#define cvxDimInqPos CALL_PROFILE_CALL(1092, cvxDimInqPos)
+#define cvxDimInqDimPnts CALL_PROFILE_CALL(1093, cvxDimInqDimPnts)
+#define cvxDimInqDimLines CALL_PROFILE_CALL(1094, cvxDimInqDimLines)
+#define cvxDimInqExtLines CALL_PROFILE_CALL(1095, cvxDimInqExtLines)
+#define cvxDimAtGetBySub CALL_PROFILE_CALL(1096, cvxDimAtGetBySub)
+#define cvxDimDispAtGet CALL_PROFILE_CALL(1097, cvxDimDispAtGet)
+#define cvxDimDispAtSet CALL_PROFILE_CALL(1098, cvxDimDispAtSet)
+#define cvxDimTolAtGet CALL_PROFILE_CALL(1099, cvxDimTolAtGet)
+#define cvxDimTolAtSet CALL_PROFILE_CALL(1100, cvxDimTolAtSet)
+#define cvxDimLineAtGet CALL_PROFILE_CALL(1101, cvxDimLineAtGet)
+#define cvxDimLineAtSet CALL_PROFILE_CALL(1102, cvxDimLineAtSet)
+#define cvxDimMiscAtGet CALL_PROFILE_CALL(1103, cvxDimMiscAtGet)
+#define cvxDimMiscAtSet CALL_PROFILE_CALL(1104, cvxDimMiscAtSet)
+#define cvxDimTextAtGet CALL_PROFILE_CALL(1105, cvxDimTextAtGet)
+#define cvxDimTextAtSet CALL_PROFILE_CALL(1106, cvxDimTextAtSet)
+#define cvxBalloonAtGet CALL_PROFILE_CALL(1107, cvxBalloonAtGet)
+#define cvxBalloonAtSet CALL_PROFILE_CALL(1108, cvxBalloonAtSet)
+#define ZwDimensionTextPointGet CALL_PROFILE_CALL(1109, ZwDimensionTextPointGet)
+#define cvxDispRedraw CALL_PROFILE_CALL(1110, cvxDispRedraw)
+#define cvxDispDataUpdate CALL_PROFILE_CALL(1111, cvxDispDataUpdate)
+#define cvxDispModeGet CALL_PROFILE_CALL(1112, cvxDispModeGet)
+#define cvxDispModeSet CALL_PROFILE_CALL(1113, cvxDispModeSet)
+#define cvxDispRgbGet CALL_PROFILE_CALL(1114, cvxDispRgbGet)
+#define cvxDispRgbSet CALL_PROFILE_CALL(1115, cvxDispRgbSet)
+#define cvxDispColorGet CALL_PROFILE_CALL(1116, cvxDispColorGet)
+#define cvxDispColorSet CALL_PROFILE_CALL(1117, cvxDispColorSet)
+#define cvxDispSwitch CALL_PROFILE_CALL(1118, cvxDispSwitch)
+#define cvxDispSwitchGet CALL_PROFILE_CALL(1119, cvxDispSwitchGet)
+#define cvxDispState CALL_PROFILE_CALL(1120, cvxDispState)
+#define cvxVisDispStatusGet CALL_PROFILE_CALL(1121, cvxVisDispStatusGet)
+#define cvxDispSceneUpdate CALL_PROFILE_CALL(1122, cvxDispSceneUpdate)
+#define cvxDispWindowRectGet CALL_PROFILE_CALL(1123, cvxDispWindowRectGet)
+#define cvxDispGetLights CALL_PROFILE_CALL(1124, cvxDispGetLights)
+#define cvxDispSetLightsInit CALL_PROFILE_CALL(1125, cvxDispSetLightsInit)
+#define cvxDispSetLights CALL_PROFILE_CALL(1126, cvxDispSetLights)
+#define cvxShowOpen CALL_PROFILE_CALL(1127, cvxShowOpen)
+#define cvxShowDisp CALL_PROFILE_CALL(1128, cvxShowDisp)
+#define cvxDispZoomAll CALL_PROFILE_CALL(1129, cvxDispZoomAll)
+#define cvxDispZoomAllIncludeDim CALL_PROFILE_CALL(1130, cvxDispZoomAllIncludeDim)
+#define cvxDispZoomAt CALL_PROFILE_CALL(1131, cvxDispZoomAt)
+#define cvxDispZoomLimits CALL_PROFILE_CALL(1132, cvxDispZoomLimits)
+#define cvxDispZoomIn CALL_PROFILE_CALL(1133, cvxDispZoomIn)
+#define cvxDatumLocalVis CALL_PROFILE_CALL(1134, cvxDatumLocalVis)
+#define cvxDatumDispModeSet CALL_PROFILE_CALL(1135, cvxDatumDispModeSet)
+#define cvxDatumDispModeGet CALL_PROFILE_CALL(1136, cvxDatumDispModeGet)
+#define cvxDatumDispAttrGet CALL_PROFILE_CALL(1137, cvxDatumDispAttrGet)
+#define cvxDatumDispAttrSet CALL_PROFILE_CALL(1138, cvxDatumDispAttrSet)
+#define cvxAxisDispModeGet CALL_PROFILE_CALL(1139, cvxAxisDispModeGet)
+#define cvxAxisDispModeSet CALL_PROFILE_CALL(1140, cvxAxisDispModeSet)
+#define ZwDisplayState CALL_PROFILE_CALL(1141, ZwDisplayState)
+#define ZwDrawingDimensionEntityGet CALL_PROFILE_CALL(1142, ZwDrawingDimensionEntityGet)
+#define ZwDrawingDimensionReferenceStateGet CALL_PROFILE_CALL(1143, ZwDrawingDimensionReferenceStateGet)
+#define ZwDrawingDimensionTextPositionPointsGet CALL_PROFILE_CALL(1144, ZwDrawingDimensionTextPositionPointsGet)
+#define ZwDrawingDimensionReferenceStateSet CALL_PROFILE_CALL(1145, ZwDrawingDimensionReferenceStateSet)
+#define ZwDrawingDimensionHoleCalloutInit CALL_PROFILE_CALL(1146, ZwDrawingDimensionHoleCalloutInit)
+#define ZwDrawingDimensionHoleCalloutCreate CALL_PROFILE_CALL(1147, ZwDrawingDimensionHoleCalloutCreate)
+#define ZwDrawingDimensionDatumTargetCreate CALL_PROFILE_CALL(1148, ZwDrawingDimensionDatumTargetCreate)
+#define ZwDrawingDimensionFeatureControlCreate CALL_PROFILE_CALL(1149, ZwDrawingDimensionFeatureControlCreate)
+#define ZwDrawingDimensionIntersectionSymbolCreate CALL_PROFILE_CALL(1150, ZwDrawingDimensionIntersectionSymbolCreate)
+#define ZwDrawingDimensionOrdinateInit CALL_PROFILE_CALL(1151, ZwDrawingDimensionOrdinateInit)
+#define ZwDrawingDimensionOrdinateCreate CALL_PROFILE_CALL(1152, ZwDrawingDimensionOrdinateCreate)
+#define ZwDrawingDimensionSymmetryInit CALL_PROFILE_CALL(1153, ZwDrawingDimensionSymmetryInit)
+#define ZwDrawingDimensionSymmetryCreate CALL_PROFILE_CALL(1154, ZwDrawingDimensionSymmetryCreate)
+#define ZwDrawingDimensionAutoInit CALL_PROFILE_CALL(1155, ZwDrawingDimensionAutoInit)
+#define ZwDrawingDimensionAutoCreate CALL_PROFILE_CALL(1156, ZwDrawingDimensionAutoCreate)
+#define ZwDrawingDimensionCenterLineInit CALL_PROFILE_CALL(1157, ZwDrawingDimensionCenterLineInit)
+#define ZwDrawingDimensionCenterLineCreate CALL_PROFILE_CALL(1158, ZwDrawingDimensionCenterLineCreate)
+#define ZwDrawingDimensionContinuousInit CALL_PROFILE_CALL(1159, ZwDrawingDimensionContinuousInit)
+#define ZwDrawingDimensionContinuousCreate CALL_PROFILE_CALL(1160, ZwDrawingDimensionContinuousCreate)
+#define ZwDrawingDimensionCenterMarkInit CALL_PROFILE_CALL(1161, ZwDrawingDimensionCenterMarkInit)
+#define ZwDrawingDimensionCenterMarkCreate CALL_PROFILE_CALL(1162, ZwDrawingDimensionCenterMarkCreate)
+#define ZwDrawingDimensionLabelInit CALL_PROFILE_CALL(1163, ZwDrawingDimensionLabelInit)
+#define ZwDrawingDimensionLabelCreate CALL_PROFILE_CALL(1164, ZwDrawingDimensionLabelCreate)
+#define ZwDrawingAutoBalloonInit CALL_PROFILE_CALL(1165, ZwDrawingAutoBalloonInit)
+#define ZwDrawingAutoBalloonCreate CALL_PROFILE_CALL(1166, ZwDrawingAutoBalloonCreate)
+#define ZwDrawingDimensionLinearChamferInit CALL_PROFILE_CALL(1167, ZwDrawingDimensionLinearChamferInit)
+#define ZwDrawingDimensionLinearChamferCreate CALL_PROFILE_CALL(1168, ZwDrawingDimensionLinearChamferCreate)
+#define ZwDrawingDimensionLinearCreate CALL_PROFILE_CALL(1169, ZwDrawingDimensionLinearCreate)
+#define ZwDrawingDimensionLinearOffsetCreate CALL_PROFILE_CALL(1170, ZwDrawingDimensionLinearOffsetCreate)
+#define ZwDrawingDimensionRadialCreate CALL_PROFILE_CALL(1171, ZwDrawingDimensionRadialCreate)
+#define ZwDrawingDimensionAngularCreate CALL_PROFILE_CALL(1172, ZwDrawingDimensionAngularCreate)
+#define ZwDrawingDimensionArcCreate CALL_PROFILE_CALL(1173, ZwDrawingDimensionArcCreate)
+#define ZwDrawingDimensionBalloonCreate CALL_PROFILE_CALL(1174, ZwDrawingDimensionBalloonCreate)
+#define ZwDrawingDimensionLabelCoordinateCreate CALL_PROFILE_CALL(1175, ZwDrawingDimensionLabelCoordinateCreate)
+#define ZwDrawingDimensionDatumFeatureCreate CALL_PROFILE_CALL(1176, ZwDrawingDimensionDatumFeatureCreate)
+#define ZwDrawingDimensionBaseLineCreate CALL_PROFILE_CALL(1177, ZwDrawingDimensionBaseLineCreate)
+#define ZwDrawingDimensionCenterMarkCircleCreate CALL_PROFILE_CALL(1178, ZwDrawingDimensionCenterMarkCircleCreate)
+#define ZwDrawingGeometryParentViewGet CALL_PROFILE_CALL(1179, ZwDrawingGeometryParentViewGet)
+#define ZwDrawingHatchAssociateCurveListGet CALL_PROFILE_CALL(1180, ZwDrawingHatchAssociateCurveListGet)
+#define ZwDrawingHatchAttributeSet CALL_PROFILE_CALL(1181, ZwDrawingHatchAttributeSet)
+#define ZwDrawingHatchAttributeGet CALL_PROFILE_CALL(1182, ZwDrawingHatchAttributeGet)
+#define ZwDrawingBreakLineAttributeSet CALL_PROFILE_CALL(1183, ZwDrawingBreakLineAttributeSet)
+#define ZwDrawingBreakLineAttributeGet CALL_PROFILE_CALL(1184, ZwDrawingBreakLineAttributeGet)
+#define ZwDrawingEntityComponentGet CALL_PROFILE_CALL(1185, ZwDrawingEntityComponentGet)
+#define ZwDrawingDiscreteEntityGet CALL_PROFILE_CALL(1186, ZwDrawingDiscreteEntityGet)
+#define ZwDrawingRegen CALL_PROFILE_CALL(1187, ZwDrawingRegen)
+#define ZwDrawingSheetActivate CALL_PROFILE_CALL(1188, ZwDrawingSheetActivate)
+#define ZwDrawingSheetActivateByHandle CALL_PROFILE_CALL(1189, ZwDrawingSheetActivateByHandle)
+#define ZwDrawingSheetListGet CALL_PROFILE_CALL(1190, ZwDrawingSheetListGet)
+#define ZwDrawingSheetDimensionListGet CALL_PROFILE_CALL(1191, ZwDrawingSheetDimensionListGet)
+#define ZwDrawingSheetViewListGet CALL_PROFILE_CALL(1192, ZwDrawingSheetViewListGet)
+#define ZwDrawingSheetModifiedStateCheck CALL_PROFILE_CALL(1193, ZwDrawingSheetModifiedStateCheck)
+#define ZwDrawingSymbolHoleMarkInit CALL_PROFILE_CALL(1194, ZwDrawingSymbolHoleMarkInit)
+#define ZwDrawingSymbolHoleMarkCreate CALL_PROFILE_CALL(1195, ZwDrawingSymbolHoleMarkCreate)
+#define ZwDrawingSymbolOLEObjectCreate CALL_PROFILE_CALL(1196, ZwDrawingSymbolOLEObjectCreate)
+#define ZwDrawingSymbolOLEObjectDataGet CALL_PROFILE_CALL(1197, ZwDrawingSymbolOLEObjectDataGet)
+#define ZwDrawingSymbolOLEObjectExport CALL_PROFILE_CALL(1198, ZwDrawingSymbolOLEObjectExport)
+#define ZwDrawingSymbolWeldInit CALL_PROFILE_CALL(1199, ZwDrawingSymbolWeldInit)
+#define ZwDrawingSymbolWeldCreate CALL_PROFILE_CALL(1200, ZwDrawingSymbolWeldCreate)
+#define ZwDrawingSymbolWeldFree CALL_PROFILE_CALL(1201, ZwDrawingSymbolWeldFree)
+#define ZwDrawingSymbolSurfaceFinishInit CALL_PROFILE_CALL(1202, ZwDrawingSymbolSurfaceFinishInit)
+#define ZwDrawingSymbolSurfaceFinishCreate CALL_PROFILE_CALL(1203, ZwDrawingSymbolSurfaceFinishCreate)
+#define ZwDrawingSymbolWeldDataGet CALL_PROFILE_CALL(1204, ZwDrawingSymbolWeldDataGet)
+#define ZwDrawingSymbolWeldDataSet CALL_PROFILE_CALL(1205, ZwDrawingSymbolWeldDataSet)
+#define ZwDrawingTableBOMInit CALL_PROFILE_CALL(1206, ZwDrawingTableBOMInit)
+#define ZwDrawingTableBOMCreate CALL_PROFILE_CALL(1207, ZwDrawingTableBOMCreate)
+#define ZwDrawingTableAnnotationInit CALL_PROFILE_CALL(1208, ZwDrawingTableAnnotationInit)
+#define ZwDrawingTableAnnotationCreate CALL_PROFILE_CALL(1209, ZwDrawingTableAnnotationCreate)
+#define ZwDrawingTableBOMReferenceViewGet CALL_PROFILE_CALL(1210, ZwDrawingTableBOMReferenceViewGet)
+#define ZwDrawingViewAlignedSectionCreateInit CALL_PROFILE_CALL(1211, ZwDrawingViewAlignedSectionCreateInit)
+#define ZwDrawingViewAlignedSectionCreate CALL_PROFILE_CALL(1212, ZwDrawingViewAlignedSectionCreate)
+#define ZwDrawingViewAuxiliaryCreateInit CALL_PROFILE_CALL(1213, ZwDrawingViewAuxiliaryCreateInit)
+#define ZwDrawingViewAuxiliaryCreate CALL_PROFILE_CALL(1214, ZwDrawingViewAuxiliaryCreate)
+#define ZwDrawingViewBreakLineCreateInit CALL_PROFILE_CALL(1215, ZwDrawingViewBreakLineCreateInit)
+#define ZwDrawingViewBreakLineCreate CALL_PROFILE_CALL(1216, ZwDrawingViewBreakLineCreate)
+#define ZwDrawingViewDetailCreateInit CALL_PROFILE_CALL(1217, ZwDrawingViewDetailCreateInit)
+#define ZwDrawingViewDetailCreate CALL_PROFILE_CALL(1218, ZwDrawingViewDetailCreate)
+#define ZwDrawingViewBrokenSectionCreateInit CALL_PROFILE_CALL(1219, ZwDrawingViewBrokenSectionCreateInit)
+#define ZwDrawingViewBrokenSectionCreate CALL_PROFILE_CALL(1220, ZwDrawingViewBrokenSectionCreate)
+#define ZwDrawingViewFullSectionCreateInit CALL_PROFILE_CALL(1221, ZwDrawingViewFullSectionCreateInit)
+#define ZwDrawingViewFullSectionCreate CALL_PROFILE_CALL(1222, ZwDrawingViewFullSectionCreate)
+#define ZwDrawingViewDottedBorderGet CALL_PROFILE_CALL(1223, ZwDrawingViewDottedBorderGet)
+#define ZwDrawingViewGeometryReferenceEntityGet CALL_PROFILE_CALL(1224, ZwDrawingViewGeometryReferenceEntityGet)
+#define ZwDrawingViewGeometryListGet CALL_PROFILE_CALL(1225, ZwDrawingViewGeometryListGet)
+#define ZwDrawingViewEntityAssociate CALL_PROFILE_CALL(1226, ZwDrawingViewEntityAssociate)
+#define ZwDrawingViewChildViewListGet CALL_PROFILE_CALL(1227, ZwDrawingViewChildViewListGet)
+#define ZwDrawingViewAttributeGet CALL_PROFILE_CALL(1228, ZwDrawingViewAttributeGet)
+#define ZwDrawingViewAttributeSet CALL_PROFILE_CALL(1229, ZwDrawingViewAttributeSet)
+#define ZwDrawingViewProjectionInit CALL_PROFILE_CALL(1230, ZwDrawingViewProjectionInit)
+#define ZwDrawingViewProjection CALL_PROFILE_CALL(1231, ZwDrawingViewProjection)
+#define ZwDrawingViewStandardDataInit CALL_PROFILE_CALL(1232, ZwDrawingViewStandardDataInit)
+#define ZwDrawingViewStandardCreate CALL_PROFILE_CALL(1233, ZwDrawingViewStandardCreate)
+#define ZwDrawingViewReferenceBlankGet CALL_PROFILE_CALL(1234, ZwDrawingViewReferenceBlankGet)
+#define ZwDrawingViewReferenceBlankSet CALL_PROFILE_CALL(1235, ZwDrawingViewReferenceBlankSet)
+#define ZwDrawingViewReferenceAttributeGet CALL_PROFILE_CALL(1236, ZwDrawingViewReferenceAttributeGet)
+#define ZwDrawingViewReferenceAttributeSet CALL_PROFILE_CALL(1237, ZwDrawingViewReferenceAttributeSet)
+#define ZwDrawingRotateViewDataInit CALL_PROFILE_CALL(1238, ZwDrawingRotateViewDataInit)
+#define ZwDrawingViewRotate CALL_PROFILE_CALL(1239, ZwDrawingViewRotate)
+#define ZwDrawingViewParentViewGet CALL_PROFILE_CALL(1240, ZwDrawingViewParentViewGet)
+#define ZwDrawingViewReferencePartGet CALL_PROFILE_CALL(1241, ZwDrawingViewReferencePartGet)
+#define ZwDrawingView3DOriginalPointGet CALL_PROFILE_CALL(1242, ZwDrawingView3DOriginalPointGet)
+#define ZwDrawingViewReferencePartConfigGet CALL_PROFILE_CALL(1243, ZwDrawingViewReferencePartConfigGet)
+#define ZwDrawingViewMethodGet CALL_PROFILE_CALL(1244, ZwDrawingViewMethodGet)
+#define ZwDrawingViewReferenceGet CALL_PROFILE_CALL(1245, ZwDrawingViewReferenceGet)
+#define ZwDrawingViewLocationPointGet CALL_PROFILE_CALL(1246, ZwDrawingViewLocationPointGet)
+#define ZwDrawingViewDimensionListGet CALL_PROFILE_CALL(1247, ZwDrawingViewDimensionListGet)
+#define ZwDrawingViewPoint2DTo3D CALL_PROFILE_CALL(1248, ZwDrawingViewPoint2DTo3D)
+#define ZwDrawingViewPoint3DTo2D CALL_PROFILE_CALL(1249, ZwDrawingViewPoint3DTo2D)
+#define ZwDrawingViewDiscreteProjectionWait CALL_PROFILE_CALL(1250, ZwDrawingViewDiscreteProjectionWait)
+#define ZwDrawingViewDiscreteProjectionGet CALL_PROFILE_CALL(1251, ZwDrawingViewDiscreteProjectionGet)
+#define ZwDrawingViewDiscreteProjectionSet CALL_PROFILE_CALL(1252, ZwDrawingViewDiscreteProjectionSet)
+#define ZwDrawingViewDiscreteProjectionQualityGet CALL_PROFILE_CALL(1253, ZwDrawingViewDiscreteProjectionQualityGet)
+#define ZwDrawingViewDiscreteProjectionQualitySet CALL_PROFILE_CALL(1254, ZwDrawingViewDiscreteProjectionQualitySet)
+#define ZwDrawingViewDiscreteProjectionStateGet CALL_PROFILE_CALL(1255, ZwDrawingViewDiscreteProjectionStateGet)
+#define ZwDrawingDiscreteProjectionStateCheck CALL_PROFILE_CALL(1256, ZwDrawingDiscreteProjectionStateCheck)
+#define ZwDrawingViewAutoLoadGeometryGet CALL_PROFILE_CALL(1257, ZwDrawingViewAutoLoadGeometryGet)
+#define ZwDrawingViewAutoLoadGeometrySet CALL_PROFILE_CALL(1258, ZwDrawingViewAutoLoadGeometrySet)
+#define ZwDrawingViewOrientationFromParentGet CALL_PROFILE_CALL(1259, ZwDrawingViewOrientationFromParentGet)
+#define ZwDrawingViewOrientationFromParentSet CALL_PROFILE_CALL(1260, ZwDrawingViewOrientationFromParentSet)
+#define ZwDrawingViewTypeGet CALL_PROFILE_CALL(1261, ZwDrawingViewTypeGet)
+#define ZwDrawingViewLineAttributeGet CALL_PROFILE_CALL(1262, ZwDrawingViewLineAttributeGet)
+#define ZwDrawingViewLineAttributeSet CALL_PROFILE_CALL(1263, ZwDrawingViewLineAttributeSet)
+#define ZwDrawingViewLocationLockSet CALL_PROFILE_CALL(1264, ZwDrawingViewLocationLockSet)
+#define ZwDrawingViewLocationLockGet CALL_PROFILE_CALL(1265, ZwDrawingViewLocationLockGet)
+#define ZwDrawingViewEntityDisassociate CALL_PROFILE_CALL(1266, ZwDrawingViewEntityDisassociate)
+#define ZwDrawingViewAlignmentStateGet CALL_PROFILE_CALL(1267, ZwDrawingViewAlignmentStateGet)
+#define ZwDrawingViewAlignmentStateSet CALL_PROFILE_CALL(1268, ZwDrawingViewAlignmentStateSet)
+#define ZwDrawingViewReferenceListBlankSet CALL_PROFILE_CALL(1269, ZwDrawingViewReferenceListBlankSet)
+#define ZwDrawingViewProjectionTypeGet CALL_PROFILE_CALL(1270, ZwDrawingViewProjectionTypeGet)
+#define ZwDrawingCrossHatchInit CALL_PROFILE_CALL(1271, ZwDrawingCrossHatchInit)
+#define ZwDrawingCrossHatchCreate CALL_PROFILE_CALL(1272, ZwDrawingCrossHatchCreate)
+#define cvxDwgAtGet CALL_PROFILE_CALL(1273, cvxDwgAtGet)
+#define cvxDwgAtSet CALL_PROFILE_CALL(1274, cvxDwgAtSet)
+#define cvxDwgAtItemGet CALL_PROFILE_CALL(1275, cvxDwgAtItemGet)
+#define cvxDwgInqDims CALL_PROFILE_CALL(1276, cvxDwgInqDims)
+#define cvxDwgInqDimEnts CALL_PROFILE_CALL(1277, cvxDwgInqDimEnts)
+#define cvxDwgInqDimGripPnts CALL_PROFILE_CALL(1278, cvxDwgInqDimGripPnts)
+#define cvxDwgGetDimTextBox CALL_PROFILE_CALL(1279, cvxDwgGetDimTextBox)
+#define cvxDwgInqDimByView CALL_PROFILE_CALL(1280, cvxDwgInqDimByView)
+#define cvxDwgInqDimByDrawing CALL_PROFILE_CALL(1281, cvxDwgInqDimByDrawing)
+#define cvxDwgInqBundleDataByDim CALL_PROFILE_CALL(1282, cvxDwgInqBundleDataByDim)
+#define cvxDwgDimAtGet CALL_PROFILE_CALL(1283, cvxDwgDimAtGet)
+#define cvxDwgDimAtSet CALL_PROFILE_CALL(1284, cvxDwgDimAtSet)
+#define cvxDwgSheetAdd CALL_PROFILE_CALL(1285, cvxDwgSheetAdd)
+#define cvxDwgSheetDel CALL_PROFILE_CALL(1286, cvxDwgSheetDel)
+#define cvxDwgSheetScaleGet CALL_PROFILE_CALL(1287, cvxDwgSheetScaleGet)
+#define cvxDwgSheetScaleSet CALL_PROFILE_CALL(1288, cvxDwgSheetScaleSet)
+#define cvxDwgInqList CALL_PROFILE_CALL(1289, cvxDwgInqList)
+#define cvxDwgInqName CALL_PROFILE_CALL(1290, cvxDwgInqName)
+#define cvxDwgFind CALL_PROFILE_CALL(1291, cvxDwgFind)
+#define cvxDwgInqBorderTitle CALL_PROFILE_CALL(1292, cvxDwgInqBorderTitle)
+#define cvxDwgInqPart CALL_PROFILE_CALL(1293, cvxDwgInqPart)
+#define cvxDwgSetRefPart CALL_PROFILE_CALL(1294, cvxDwgSetRefPart)
+#define cvxDwgActivate CALL_PROFILE_CALL(1295, cvxDwgActivate)
+#define cvxDwgInqActive CALL_PROFILE_CALL(1296, cvxDwgInqActive)
+#define cvxDwgRegen CALL_PROFILE_CALL(1297, cvxDwgRegen)
+#define cvxDwgStyleManagerWithTextAtGet CALL_PROFILE_CALL(1298, cvxDwgStyleManagerWithTextAtGet)
+#define cvxDwgInqGeom CALL_PROFILE_CALL(1299, cvxDwgInqGeom)
+#define cvxDwgInqText CALL_PROFILE_CALL(1300, cvxDwgInqText)
+#define cvxDwgInqHatchAttr CALL_PROFILE_CALL(1301, cvxDwgInqHatchAttr)
+#define cvxDwgHatchAttrSet CALL_PROFILE_CALL(1302, cvxDwgHatchAttrSet)
+#define cvxDwgHatchAssoCrvsGet CALL_PROFILE_CALL(1303, cvxDwgHatchAssoCrvsGet)
+#define cvxDwgInqHatchIdByView CALL_PROFILE_CALL(1304, cvxDwgInqHatchIdByView)
+#define cvxDwgInqHatchIdByDrawing CALL_PROFILE_CALL(1305, cvxDwgInqHatchIdByDrawing)
+#define cvxDwgRefEntDataGet CALL_PROFILE_CALL(1306, cvxDwgRefEntDataGet)
+#define cvxDwgGeomGetView CALL_PROFILE_CALL(1307, cvxDwgGeomGetView)
+#define cvxDwgViewGeomInqList CALL_PROFILE_CALL(1308, cvxDwgViewGeomInqList)
+#define cvxDwgViewGeomGetShapeId CALL_PROFILE_CALL(1309, cvxDwgViewGeomGetShapeId)
+#define cvxDwgViewRefCompVisSet CALL_PROFILE_CALL(1310, cvxDwgViewRefCompVisSet)
+#define cvxDwgViewInqRefEnts CALL_PROFILE_CALL(1311, cvxDwgViewInqRefEnts)
+#define cvxDwgViewRefBlankGet CALL_PROFILE_CALL(1312, cvxDwgViewRefBlankGet)
+#define cvxDwgViewRefBlankSet CALL_PROFILE_CALL(1313, cvxDwgViewRefBlankSet)
+#define cvxDwgViewRefEntAtGet CALL_PROFILE_CALL(1314, cvxDwgViewRefEntAtGet)
+#define cvxDwgViewRefEntAtSet CALL_PROFILE_CALL(1315, cvxDwgViewRefEntAtSet)
+#define cvxDwgViewPnt2DTo3D CALL_PROFILE_CALL(1316, cvxDwgViewPnt2DTo3D)
+#define cvxDwgViewPnt3DTo2D CALL_PROFILE_CALL(1317, cvxDwgViewPnt3DTo2D)
+#define cvxShtInqSymbol CALL_PROFILE_CALL(1318, cvxShtInqSymbol)
+#define cvxDwgInqSymObjList CALL_PROFILE_CALL(1319, cvxDwgInqSymObjList)
+#define cvxDwgInqSymType CALL_PROFILE_CALL(1320, cvxDwgInqSymType)
+#define cvxDwgInqSymEnts CALL_PROFILE_CALL(1321, cvxDwgInqSymEnts)
+#define cvxDwgSymAtGet CALL_PROFILE_CALL(1322, cvxDwgSymAtGet)
+#define cvxDwgSymAtSet CALL_PROFILE_CALL(1323, cvxDwgSymAtSet)
+#define cvxDwgSymImgAtGet CALL_PROFILE_CALL(1324, cvxDwgSymImgAtGet)
+#define cvxDwgSymImgAtSet CALL_PROFILE_CALL(1325, cvxDwgSymImgAtSet)
+#define cvxDwgSymSurfDataGet CALL_PROFILE_CALL(1326, cvxDwgSymSurfDataGet)
+#define cvxDwgSymSurfDataSet CALL_PROFILE_CALL(1327, cvxDwgSymSurfDataSet)
+#define cvxDwgSymWeldDataGet CALL_PROFILE_CALL(1328, cvxDwgSymWeldDataGet)
+#define cvxDwgSymWeldDataSet CALL_PROFILE_CALL(1329, cvxDwgSymWeldDataSet)
+#define cvxSymWeldFree CALL_PROFILE_CALL(1330, cvxSymWeldFree)
+#define cvxDwgUserSymObjGet CALL_PROFILE_CALL(1331, cvxDwgUserSymObjGet)
+#define cvxDwgSymInsPointGet CALL_PROFILE_CALL(1332, cvxDwgSymInsPointGet)
+#define cvxDwgSymInsPointSet CALL_PROFILE_CALL(1333, cvxDwgSymInsPointSet)
+#define cvxDwgSymLinkGet CALL_PROFILE_CALL(1334, cvxDwgSymLinkGet)
+#define cvxDwgSymLinkGetByLongPath CALL_PROFILE_CALL(1335, cvxDwgSymLinkGetByLongPath)
+#define cvxDwgSymLinkExport CALL_PROFILE_CALL(1336, cvxDwgSymLinkExport)
+#define cvxDwgSymLinkExportByLongPath CALL_PROFILE_CALL(1337, cvxDwgSymLinkExportByLongPath)
+#define cvxDwgInqTables CALL_PROFILE_CALL(1338, cvxDwgInqTables)
+#define cvxDwgInqTableType CALL_PROFILE_CALL(1339, cvxDwgInqTableType)
+#define cvxDwgTableAtGet CALL_PROFILE_CALL(1340, cvxDwgTableAtGet)
+#define cvxDwgTableAtSet CALL_PROFILE_CALL(1341, cvxDwgTableAtSet)
+#define cvxDwgGetTableSize CALL_PROFILE_CALL(1342, cvxDwgGetTableSize)
+#define cvxDwgTableAdjustSize CALL_PROFILE_CALL(1343, cvxDwgTableAdjustSize)
+#define cvxDwgTableInsPntSet CALL_PROFILE_CALL(1344, cvxDwgTableInsPntSet)
+#define cvxDwgTableInsPntGet CALL_PROFILE_CALL(1345, cvxDwgTableInsPntGet)
+#define cvxDwgTableExport CALL_PROFILE_CALL(1346, cvxDwgTableExport)
+#define cvxDwgTableLinkToExcel CALL_PROFILE_CALL(1347, cvxDwgTableLinkToExcel)
+#define cvxDwgTableRowHeightGet CALL_PROFILE_CALL(1348, cvxDwgTableRowHeightGet)
+#define cvxDwgTableRowHeightSet CALL_PROFILE_CALL(1349, cvxDwgTableRowHeightSet)
+#define cvxDwgTableRowInsert CALL_PROFILE_CALL(1350, cvxDwgTableRowInsert)
+#define cvxDwgTableRowDelete CALL_PROFILE_CALL(1351, cvxDwgTableRowDelete)
+#define cvxDwgTableColWidthGet CALL_PROFILE_CALL(1352, cvxDwgTableColWidthGet)
+#define cvxDwgTableColWidthSet CALL_PROFILE_CALL(1353, cvxDwgTableColWidthSet)
+#define cvxDwgTableColInsert CALL_PROFILE_CALL(1354, cvxDwgTableColInsert)
+#define cvxDwgTableColDelete CALL_PROFILE_CALL(1355, cvxDwgTableColDelete)
+#define cvxDwgTableCellAtGet CALL_PROFILE_CALL(1356, cvxDwgTableCellAtGet)
+#define cvxDwgTableCellAtSet CALL_PROFILE_CALL(1357, cvxDwgTableCellAtSet)
+#define cvxDwgTableCellSet CALL_PROFILE_CALL(1358, cvxDwgTableCellSet)
+#define cvxDwgTableCellGet CALL_PROFILE_CALL(1359, cvxDwgTableCellGet)
+#define cvxDwgTableCellsMerge CALL_PROFILE_CALL(1360, cvxDwgTableCellsMerge)
+#define cvxDwgTableCellsUnMerge CALL_PROFILE_CALL(1361, cvxDwgTableCellsUnMerge)
+#define cvxDwgInqViews CALL_PROFILE_CALL(1362, cvxDwgInqViews)
+#define cvxDwgInqViewMod CALL_PROFILE_CALL(1363, cvxDwgInqViewMod)
+#define cvxDwgInqViewType CALL_PROFILE_CALL(1364, cvxDwgInqViewType)
+#define cvxDwgInqViewTypeEx CALL_PROFILE_CALL(1365, cvxDwgInqViewTypeEx)
+#define cvxDwgViewAtGet CALL_PROFILE_CALL(1366, cvxDwgViewAtGet)
+#define cvxDwgViewAtSet CALL_PROFILE_CALL(1367, cvxDwgViewAtSet)
+#define cvxDwgViewLockSet CALL_PROFILE_CALL(1368, cvxDwgViewLockSet)
+#define cvxDwgViewLockGet CALL_PROFILE_CALL(1369, cvxDwgViewLockGet)
+#define cvxDwgViewDottedBorderGet CALL_PROFILE_CALL(1370, cvxDwgViewDottedBorderGet)
+#define cvxDwgViewInqPart CALL_PROFILE_CALL(1371, cvxDwgViewInqPart)
+#define cvxDwgViewInqPartConfig CALL_PROFILE_CALL(1372, cvxDwgViewInqPartConfig)
+#define cvxDwgViewInqPartConfigByLongName CALL_PROFILE_CALL(1373, cvxDwgViewInqPartConfigByLongName)
+#define cvxDwgViewInqChildView CALL_PROFILE_CALL(1374, cvxDwgViewInqChildView)
+#define cvxDwgViewInqParentView CALL_PROFILE_CALL(1375, cvxDwgViewInqParentView)
+#define cvxDwgViewEntitiesAssociate CALL_PROFILE_CALL(1376, cvxDwgViewEntitiesAssociate)
+#define cvxDwgViewInqProjection CALL_PROFILE_CALL(1377, cvxDwgViewInqProjection)
+#define cvxDwgViewLocationGet CALL_PROFILE_CALL(1378, cvxDwgViewLocationGet)
+#define cvxDwgAlignmentGet CALL_PROFILE_CALL(1379, cvxDwgAlignmentGet)
+#define cvxDwgViewInqOrgPnt CALL_PROFILE_CALL(1380, cvxDwgViewInqOrgPnt)
+#define cvxDwgBrkLineAtSet CALL_PROFILE_CALL(1381, cvxDwgBrkLineAtSet)
+#define cvxDwgBrkLineAtGet CALL_PROFILE_CALL(1382, cvxDwgBrkLineAtGet)
+#define ZwEdgeTypeGet CALL_PROFILE_CALL(1383, ZwEdgeTypeGet)
+#define ZwEdgeFaceListGet CALL_PROFILE_CALL(1384, ZwEdgeFaceListGet)
+#define ZwEdgeCurveGet CALL_PROFILE_CALL(1385, ZwEdgeCurveGet)
+#define ZwEdgeNURBSDataGet CALL_PROFILE_CALL(1386, ZwEdgeNURBSDataGet)
+#define ZwEdgeDiscreteDataGet CALL_PROFILE_CALL(1387, ZwEdgeDiscreteDataGet)
+#define ZwEdgeDiscreteDataFree CALL_PROFILE_CALL(1388, ZwEdgeDiscreteDataFree)
+#define ZwEntityCreateGet CALL_PROFILE_CALL(1389, ZwEntityCreateGet)
+#define ZwEntityCreateListGet CALL_PROFILE_CALL(1390, ZwEntityCreateListGet)
+#define ZwEntityCreateGetAll CALL_PROFILE_CALL(1391, ZwEntityCreateGetAll)
+#define ZwEntityGetByPick CALL_PROFILE_CALL(1392, ZwEntityGetByPick)
+#define ZwEntityGetByPickWithMultipleFilter CALL_PROFILE_CALL(1393, ZwEntityGetByPickWithMultipleFilter)
+#define ZwEntityListGetByPick CALL_PROFILE_CALL(1394, ZwEntityListGetByPick)
+#define ZwEntityListGetByPickWithMultipleFilter CALL_PROFILE_CALL(1395, ZwEntityListGetByPickWithMultipleFilter)
+#define ZwEntityGetByPoint CALL_PROFILE_CALL(1396, ZwEntityGetByPoint)
+#define ZwEntityGetByNameAndType CALL_PROFILE_CALL(1397, ZwEntityGetByNameAndType)
+#define ZwEntityGetByCurrentView CALL_PROFILE_CALL(1398, ZwEntityGetByCurrentView)
+#define ZwEntityActiveGet CALL_PROFILE_CALL(1399, ZwEntityActiveGet)
+#define ZwEntityActivate CALL_PROFILE_CALL(1400, ZwEntityActivate)
+#define ZwEntityDelete CALL_PROFILE_CALL(1401, ZwEntityDelete)
+#define ZwEntityErase CALL_PROFILE_CALL(1402, ZwEntityErase)
+#define ZwEntityListDelete CALL_PROFILE_CALL(1403, ZwEntityListDelete)
+#define ZwEntityListErase CALL_PROFILE_CALL(1404, ZwEntityListErase)
+#define ZwEntityBlankSet CALL_PROFILE_CALL(1405, ZwEntityBlankSet)
+#define ZwEntityBlankGet CALL_PROFILE_CALL(1406, ZwEntityBlankGet)
+#define ZwEntityExistenceCheck CALL_PROFILE_CALL(1407, ZwEntityExistenceCheck)
+#define ZwEntitySuppressGet CALL_PROFILE_CALL(1408, ZwEntitySuppressGet)
+#define ZwEntityFrontPickStateSet CALL_PROFILE_CALL(1409, ZwEntityFrontPickStateSet)
+#define ZwEntityFrontPickStateGet CALL_PROFILE_CALL(1410, ZwEntityFrontPickStateGet)
+#define ZwEntityPickListGet CALL_PROFILE_CALL(1411, ZwEntityPickListGet)
+#define ZwEntityUnPickAll CALL_PROFILE_CALL(1412, ZwEntityUnPickAll)
+#define ZwEntityUnPickLast CALL_PROFILE_CALL(1413, ZwEntityUnPickLast)
+#define ZwEntityUnPick CALL_PROFILE_CALL(1414, ZwEntityUnPick)
+#define ZwEntityPickListAdd CALL_PROFILE_CALL(1415, ZwEntityPickListAdd)
+#define ZwEntityColorGet CALL_PROFILE_CALL(1416, ZwEntityColorGet)
+#define ZwEntityColorSet CALL_PROFILE_CALL(1417, ZwEntityColorSet)
+#define ZwEntityColorRgbGet CALL_PROFILE_CALL(1418, ZwEntityColorRgbGet)
+#define ZwEntityColorRgbSet CALL_PROFILE_CALL(1419, ZwEntityColorRgbSet)
+#define ZwEntityTemporaryColorRgbSet CALL_PROFILE_CALL(1420, ZwEntityTemporaryColorRgbSet)
+#define ZwEntityTransparencySet CALL_PROFILE_CALL(1421, ZwEntityTransparencySet)
+#define ZwEntityTransparencyGet CALL_PROFILE_CALL(1422, ZwEntityTransparencyGet)
+#define ZwEntityHighlightWithColor CALL_PROFILE_CALL(1423, ZwEntityHighlightWithColor)
+#define ZwEntityUnhighlightAll CALL_PROFILE_CALL(1424, ZwEntityUnhighlightAll)
+#define ZwEntityHighlight CALL_PROFILE_CALL(1425, ZwEntityHighlight)
+#define ZwEntityUnHighlight CALL_PROFILE_CALL(1426, ZwEntityUnHighlight)
+#define ZwLineAttributeGet CALL_PROFILE_CALL(1427, ZwLineAttributeGet)
+#define ZwLineAttributeSet CALL_PROFILE_CALL(1428, ZwLineAttributeSet)
+#define ZwEntityCriticalPointCheck CALL_PROFILE_CALL(1429, ZwEntityCriticalPointCheck)
+#define ZwEntityCurveCheck CALL_PROFILE_CALL(1430, ZwEntityCurveCheck)
+#define ZwEntityElectrodeCheck CALL_PROFILE_CALL(1431, ZwEntityElectrodeCheck)
+#define ZwEntityProjectionPointGet CALL_PROFILE_CALL(1432, ZwEntityProjectionPointGet)
+#define ZwEntityShapeGet CALL_PROFILE_CALL(1433, ZwEntityShapeGet)
+#define ZwEntityPointMinDistanceGet CALL_PROFILE_CALL(1434, ZwEntityPointMinDistanceGet)
+#define ZwEntityReferenceFileNameGet CALL_PROFILE_CALL(1435, ZwEntityReferenceFileNameGet)
+#define ZwEntityTypeNameGet CALL_PROFILE_CALL(1436, ZwEntityTypeNameGet)
+#define ZwEntityTypeNumberGet CALL_PROFILE_CALL(1437, ZwEntityTypeNumberGet)
+#define ZwEntityNameSet CALL_PROFILE_CALL(1438, ZwEntityNameSet)
+#define ZwEntityNameTagSet CALL_PROFILE_CALL(1439, ZwEntityNameTagSet)
+#define ZwEntityNameTagGet CALL_PROFILE_CALL(1440, ZwEntityNameTagGet)
+#define ZwEntityNameTagGetAll CALL_PROFILE_CALL(1441, ZwEntityNameTagGetAll)
+#define ZwEntityLayerGet CALL_PROFILE_CALL(1442, ZwEntityLayerGet)
+#define ZwEntityMatrixGet CALL_PROFILE_CALL(1443, ZwEntityMatrixGet)
+#define ZwEntityTransformMatrixGet CALL_PROFILE_CALL(1444, ZwEntityTransformMatrixGet)
+#define ZwEntityMatrixSet CALL_PROFILE_CALL(1445, ZwEntityMatrixSet)
+#define ZwEntityParentFeatureGet CALL_PROFILE_CALL(1446, ZwEntityParentFeatureGet)
+#define ZwEntityBoundingBoxGet CALL_PROFILE_CALL(1447, ZwEntityBoundingBoxGet)
+#define ZwEntityCompactBoundingBoxGet CALL_PROFILE_CALL(1448, ZwEntityCompactBoundingBoxGet)
+#define ZwEntityCriticalPointInfoGet CALL_PROFILE_CALL(1449, ZwEntityCriticalPointInfoGet)
+#define ZwEntityParentSketchGet CALL_PROFILE_CALL(1450, ZwEntityParentSketchGet)
+#define ZwEntityParentGet CALL_PROFILE_CALL(1451, ZwEntityParentGet)
+#define ZwEntityReferenceGet CALL_PROFILE_CALL(1452, ZwEntityReferenceGet)
+#define ZwEntityNameGet CALL_PROFILE_CALL(1453, ZwEntityNameGet)
+#define ZwEntityIdTransfer CALL_PROFILE_CALL(1454, ZwEntityIdTransfer)
+#define ZwEntityPathTransfer CALL_PROFILE_CALL(1455, ZwEntityPathTransfer)
+#define ZwEntityHandleFree CALL_PROFILE_CALL(1456, ZwEntityHandleFree)
+#define ZwEntityHandleListFree CALL_PROFILE_CALL(1457, ZwEntityHandleListFree)
+#define ZwEntityIdGet CALL_PROFILE_CALL(1458, ZwEntityIdGet)
+#define ZwEntityPathGet CALL_PROFILE_CALL(1459, ZwEntityPathGet)
+#define ZwEntityUniqueIdGet CALL_PROFILE_CALL(1460, ZwEntityUniqueIdGet)
+#define ZwEntityGetByUniqueId CALL_PROFILE_CALL(1461, ZwEntityGetByUniqueId)
+#define ZwEntityAutoRegen CALL_PROFILE_CALL(1462, ZwEntityAutoRegen)
+#define ZwEntityReferenceDrawingGeometryGetByView CALL_PROFILE_CALL(1463, ZwEntityReferenceDrawingGeometryGetByView)
+#define ZwEntityReferenceDrawingGeometryGetBySheet CALL_PROFILE_CALL(1464, ZwEntityReferenceDrawingGeometryGetBySheet)
+#define ZwEntityReferenceDrawingGeometryGetAll CALL_PROFILE_CALL(1465, ZwEntityReferenceDrawingGeometryGetAll)
+#define ZwEntityReferenceViewGeometryListFree CALL_PROFILE_CALL(1466, ZwEntityReferenceViewGeometryListFree)
+#define ZwEntityReferenceSheetGeometryListFree CALL_PROFILE_CALL(1467, ZwEntityReferenceSheetGeometryListFree)
+#define ZwFaceShapeGet CALL_PROFILE_CALL(1468, ZwFaceShapeGet)
+#define ZwFaceSurfaceDataGet CALL_PROFILE_CALL(1469, ZwFaceSurfaceDataGet)
+#define ZwSurfaceDataFree CALL_PROFILE_CALL(1470, ZwSurfaceDataFree)
+#define ZwFaceEdgeListGet CALL_PROFILE_CALL(1471, ZwFaceEdgeListGet)
+#define ZwFaceLoopListGet CALL_PROFILE_CALL(1472, ZwFaceLoopListGet)
+#define ZwFaceDataTransform CALL_PROFILE_CALL(1473, ZwFaceDataTransform)
+#define ZwFacePoleCheck CALL_PROFILE_CALL(1474, ZwFacePoleCheck)
+#define ZwFacePoleGet CALL_PROFILE_CALL(1475, ZwFacePoleGet)
+#define ZwFacePointGetByUVparameter CALL_PROFILE_CALL(1476, ZwFacePointGetByUVparameter)
+#define ZwFaceDiameterGetByUVparameter CALL_PROFILE_CALL(1477, ZwFaceDiameterGetByUVparameter)
+#define ZwModelFaceSet CALL_PROFILE_CALL(1478, ZwModelFaceSet)
+#define ZwFaceConnectedFaceGet CALL_PROFILE_CALL(1479, ZwFaceConnectedFaceGet)
+#define ZwFaceConnectedEdgeGet CALL_PROFILE_CALL(1480, ZwFaceConnectedEdgeGet)
+#define ZwModelFaceCreate CALL_PROFILE_CALL(1481, ZwModelFaceCreate)
+#define ZwFaceDisplayAttributeGet CALL_PROFILE_CALL(1482, ZwFaceDisplayAttributeGet)
+#define ZwFaceDisplayAttributeSet CALL_PROFILE_CALL(1483, ZwFaceDisplayAttributeSet)
+#define ZwFaceDisplayAttributeSetInit CALL_PROFILE_CALL(1484, ZwFaceDisplayAttributeSetInit)
+#define ZwRotationalFaceAxisPointGet CALL_PROFILE_CALL(1485, ZwRotationalFaceAxisPointGet)
+#define ZwFaceCenterCurveGet CALL_PROFILE_CALL(1486, ZwFaceCenterCurveGet)
+#define ZwFaceFacetsGet CALL_PROFILE_CALL(1487, ZwFaceFacetsGet)
+#define ZwFaceListFacetsGet CALL_PROFILE_CALL(1488, ZwFaceListFacetsGet)
+#define ZwFaceFacetsDataFree CALL_PROFILE_CALL(1489, ZwFaceFacetsDataFree)
+#define ZwFaceTextureAttributeGet CALL_PROFILE_CALL(1490, ZwFaceTextureAttributeGet)
+#define ZwFaceContinuityToleranceInit CALL_PROFILE_CALL(1491, ZwFaceContinuityToleranceInit)
+#define ZwFaceContinuityGet CALL_PROFILE_CALL(1492, ZwFaceContinuityGet)
+#define ZwFeatureExternalGeometryCopyInit CALL_PROFILE_CALL(1493, ZwFeatureExternalGeometryCopyInit)
+#define ZwFeatureExternalGeometryCopyCreate CALL_PROFILE_CALL(1494, ZwFeatureExternalGeometryCopyCreate)
+#define ZwFeatureFaceOffset CALL_PROFILE_CALL(1495, ZwFeatureFaceOffset)
+#define ZwAssemblyFeatureListGet CALL_PROFILE_CALL(1496, ZwAssemblyFeatureListGet)
+#define ZwFeatureCopyWithMultiMatrix CALL_PROFILE_CALL(1497, ZwFeatureCopyWithMultiMatrix)
+#define ZwFeatureListGet CALL_PROFILE_CALL(1498, ZwFeatureListGet)
+#define ZwFeatureChildEntityListGet CALL_PROFILE_CALL(1499, ZwFeatureChildEntityListGet)
+#define ZwChildFeatureListGet CALL_PROFILE_CALL(1500, ZwChildFeatureListGet)
+#define ZwFeatureMoveDataInit CALL_PROFILE_CALL(1501, ZwFeatureMoveDataInit)
+#define ZwFeatureMoveCreate CALL_PROFILE_CALL(1502, ZwFeatureMoveCreate)
+#define ZwFeatureMoveCreateByPointToPoint CALL_PROFILE_CALL(1503, ZwFeatureMoveCreateByPointToPoint)
+#define ZwFeatureMoveCreateByTransform CALL_PROFILE_CALL(1504, ZwFeatureMoveCreateByTransform)
+#define ZwFeaturePatternParameterTableRefresh CALL_PROFILE_CALL(1505, ZwFeaturePatternParameterTableRefresh)
+#define ZwFeatureExtrudeInit CALL_PROFILE_CALL(1506, ZwFeatureExtrudeInit)
+#define ZwFeatureExtrudeCreate CALL_PROFILE_CALL(1507, ZwFeatureExtrudeCreate)
+#define ZwFeatureCenterBoxDataInit CALL_PROFILE_CALL(1508, ZwFeatureCenterBoxDataInit)
+#define ZwFeatureBoxCreateByCenter CALL_PROFILE_CALL(1509, ZwFeatureBoxCreateByCenter)
+#define ZwFeatureLoftDataInit CALL_PROFILE_CALL(1510, ZwFeatureLoftDataInit)
+#define ZwFeatureLoftCreate CALL_PROFILE_CALL(1511, ZwFeatureLoftCreate)
+#define ZwFeatureSweptRodInit CALL_PROFILE_CALL(1512, ZwFeatureSweptRodInit)
+#define ZwFeatureSweptRodCreate CALL_PROFILE_CALL(1513, ZwFeatureSweptRodCreate)
+#define ZwFeatureBoolDataInit CALL_PROFILE_CALL(1514, ZwFeatureBoolDataInit)
+#define ZwFeatureAddMultipleShapeCreate CALL_PROFILE_CALL(1515, ZwFeatureAddMultipleShapeCreate)
+#define ZwFeatureAddShapeCreate CALL_PROFILE_CALL(1516, ZwFeatureAddShapeCreate)
+#define ZwFeatureRemoveShapeCreate CALL_PROFILE_CALL(1517, ZwFeatureRemoveShapeCreate)
+#define ZwFeatureIntersectShapeCreate CALL_PROFILE_CALL(1518, ZwFeatureIntersectShapeCreate)
+#define ZwFeatureSphereDataInit CALL_PROFILE_CALL(1519, ZwFeatureSphereDataInit)
+#define ZwFeatureSphereCreate CALL_PROFILE_CALL(1520, ZwFeatureSphereCreate)
+#define ZwFeatureStockDataInit CALL_PROFILE_CALL(1521, ZwFeatureStockDataInit)
+#define ZwFeatureStockCreate CALL_PROFILE_CALL(1522, ZwFeatureStockCreate)
+#define ZwFeatureCurvelistCreate CALL_PROFILE_CALL(1523, ZwFeatureCurvelistCreate)
+#define ZwFeatureSilhouetteCurves CALL_PROFILE_CALL(1524, ZwFeatureSilhouetteCurves)
+#define ZwFeatureLineDataInit CALL_PROFILE_CALL(1525, ZwFeatureLineDataInit)
+#define ZwFeatureLineCreate CALL_PROFILE_CALL(1526, ZwFeatureLineCreate)
+#define ZwFeatureLineCreateBy2Point CALL_PROFILE_CALL(1527, ZwFeatureLineCreateBy2Point)
+#define ZwFeaturePointsCreateByAbsolute CALL_PROFILE_CALL(1528, ZwFeaturePointsCreateByAbsolute)
+#define ZwFeatureSpiralHelixCreateInit CALL_PROFILE_CALL(1529, ZwFeatureSpiralHelixCreateInit)
+#define ZwFeatureSpiralHelixCreate CALL_PROFILE_CALL(1530, ZwFeatureSpiralHelixCreate)
+#define ZwFeatureSpiralHelixFree CALL_PROFILE_CALL(1531, ZwFeatureSpiralHelixFree)
+#define cvxFileNameCheck CALL_PROFILE_CALL(1532, cvxFileNameCheck)
+#define cvxNameValidCheck CALL_PROFILE_CALL(1533, cvxNameValidCheck)
+#define cvxFileNew CALL_PROFILE_CALL(1534, cvxFileNew)
+#define cvxFileNew2 CALL_PROFILE_CALL(1535, cvxFileNew2)
+#define cvxFileNewSingle CALL_PROFILE_CALL(1536, cvxFileNewSingle)
+#define cvxFileKeep CALL_PROFILE_CALL(1537, cvxFileKeep)
+#define cvxFileOpen CALL_PROFILE_CALL(1538, cvxFileOpen)
+#define cvxFileReOpen CALL_PROFILE_CALL(1539, cvxFileReOpen)
+#define cvxFileReplace CALL_PROFILE_CALL(1540, cvxFileReplace)
+#define cvxFileSave CALL_PROFILE_CALL(1541, cvxFileSave)
+#define cvxFileSave2 CALL_PROFILE_CALL(1542, cvxFileSave2)
+#define cvxFileSave3 CALL_PROFILE_CALL(1543, cvxFileSave3)
+#define cvxFileSaveAll CALL_PROFILE_CALL(1544, cvxFileSaveAll)
+#define cvxFileSaveAs CALL_PROFILE_CALL(1545, cvxFileSaveAs)
+#define cvxFilesSaveTo CALL_PROFILE_CALL(1546, cvxFilesSaveTo)
+#define cvxFilesSaveToByLongPath CALL_PROFILE_CALL(1547, cvxFilesSaveToByLongPath)
+#define cvxCompFileSaveAs CALL_PROFILE_CALL(1548, cvxCompFileSaveAs)
+#define cvxFileClose CALL_PROFILE_CALL(1549, cvxFileClose)
+#define cvxFileClose2 CALL_PROFILE_CALL(1550, cvxFileClose2)
+#define cvxSessionClear CALL_PROFILE_CALL(1551, cvxSessionClear)
+#define cvxFileSessionClear CALL_PROFILE_CALL(1552, cvxFileSessionClear)
+#define cvxSessionSave CALL_PROFILE_CALL(1553, cvxSessionSave)
+#define cvxSessionRestore CALL_PROFILE_CALL(1554, cvxSessionRestore)
+#define cvxFileImportInit CALL_PROFILE_CALL(1555, cvxFileImportInit)
+#define cvxFileImport CALL_PROFILE_CALL(1556, cvxFileImport)
+#define cvxFileImportMulti CALL_PROFILE_CALL(1557, cvxFileImportMulti)
+#define cvxFileImportMultiByLongPath CALL_PROFILE_CALL(1558, cvxFileImportMultiByLongPath)
+#define cvxFileImportStl CALL_PROFILE_CALL(1559, cvxFileImportStl)
+#define cvxFileExportInit CALL_PROFILE_CALL(1560, cvxFileExportInit)
+#define cvxFileExport CALL_PROFILE_CALL(1561, cvxFileExport)
+#define cvxFileExportMulti CALL_PROFILE_CALL(1562, cvxFileExportMulti)
+#define cvxFileExportMultiByLongPath CALL_PROFILE_CALL(1563, cvxFileExportMultiByLongPath)
+#define cvxPartSmdFlatSolidExport CALL_PROFILE_CALL(1564, cvxPartSmdFlatSolidExport)
+#define cvxPartSmdFlatPatternExport CALL_PROFILE_CALL(1565, cvxPartSmdFlatPatternExport)
+#define cvxFileAction CALL_PROFILE_CALL(1566, cvxFileAction)
+#define cvxFileActivate CALL_PROFILE_CALL(1567, cvxFileActivate)
+#define cvxFileDirectory CALL_PROFILE_CALL(1568, cvxFileDirectory)
+#define cvxFileDirectoryByLongPath CALL_PROFILE_CALL(1569, cvxFileDirectoryByLongPath)
+#define cvxFileInqActive CALL_PROFILE_CALL(1570, cvxFileInqActive)
+#define cvxFileTypeGet CALL_PROFILE_CALL(1571, cvxFileTypeGet)
+#define cvxFileTypeSet CALL_PROFILE_CALL(1572, cvxFileTypeSet)
+#define cvxFileInqSubType CALL_PROFILE_CALL(1573, cvxFileInqSubType)
+#define cvxFileInqOpen CALL_PROFILE_CALL(1574, cvxFileInqOpen)
+#define cvxFileOpenList CALL_PROFILE_CALL(1575, cvxFileOpenList)
+#define cvxFileOpenListByLongPath CALL_PROFILE_CALL(1576, cvxFileOpenListByLongPath)
+#define cvxFileLoadList CALL_PROFILE_CALL(1577, cvxFileLoadList)
+#define cvxFileLoadListByLongPath CALL_PROFILE_CALL(1578, cvxFileLoadListByLongPath)
+#define cvxFileVersionGet CALL_PROFILE_CALL(1579, cvxFileVersionGet)
+#define cvxFileIsModified CALL_PROFILE_CALL(1580, cvxFileIsModified)
+#define cvxFileInqAssociatedList CALL_PROFILE_CALL(1581, cvxFileInqAssociatedList)
+#define cvxFileInqAssociatedListByLongPath CALL_PROFILE_CALL(1582, cvxFileInqAssociatedListByLongPath)
+#define cvxFileInqAssociatedListByName CALL_PROFILE_CALL(1583, cvxFileInqAssociatedListByName)
+#define cvxFileInqAssociatedListByLongName CALL_PROFILE_CALL(1584, cvxFileInqAssociatedListByLongName)
+#define cvxFilePreviewExtract CALL_PROFILE_CALL(1585, cvxFilePreviewExtract)
+#define cvxFileInqAsm CALL_PROFILE_CALL(1586, cvxFileInqAsm)
+#define cvxFileInqAssemMode CALL_PROFILE_CALL(1587, cvxFileInqAssemMode)
+#define cvxFilePrintInit CALL_PROFILE_CALL(1588, cvxFilePrintInit)
+#define cvxFilePrint CALL_PROFILE_CALL(1589, cvxFilePrint)
+#define cvxFileIsUDF CALL_PROFILE_CALL(1590, cvxFileIsUDF)
+#define cvxUDFFileInqAssociatedList CALL_PROFILE_CALL(1591, cvxUDFFileInqAssociatedList)
+#define cvxUDFFileInqAssociatedListByLongPath CALL_PROFILE_CALL(1592, cvxUDFFileInqAssociatedListByLongPath)
+#define cvxFileDescriptionSet CALL_PROFILE_CALL(1593, cvxFileDescriptionSet)
+#define cvxFileDescriptionGet CALL_PROFILE_CALL(1594, cvxFileDescriptionGet)
+#define cvxFileCustomDataSet CALL_PROFILE_CALL(1595, cvxFileCustomDataSet)
+#define cvxFileCustomDataGet CALL_PROFILE_CALL(1596, cvxFileCustomDataGet)
+#define cvxFileCustomDataDel CALL_PROFILE_CALL(1597, cvxFileCustomDataDel)
+#define ZwFileParentActivate CALL_PROFILE_CALL(1598, ZwFileParentActivate)
+#define ZwFileReadOnlyStateGet CALL_PROFILE_CALL(1599, ZwFileReadOnlyStateGet)
+#define ZwFileReadOnlyStateSet CALL_PROFILE_CALL(1600, ZwFileReadOnlyStateSet)
+#define ZwFileVaildExtensionCheck CALL_PROFILE_CALL(1601, ZwFileVaildExtensionCheck)
+#define ZwFileLinkInformationUpdate CALL_PROFILE_CALL(1602, ZwFileLinkInformationUpdate)
+#define ZwFileLinkInformationUpdateWithoutModification CALL_PROFILE_CALL(1603, ZwFileLinkInformationUpdateWithoutModification)
+#define ZwFileUnusedCloseAll CALL_PROFILE_CALL(1604, ZwFileUnusedCloseAll)
+#define ZwFileModifyFlagLock CALL_PROFILE_CALL(1605, ZwFileModifyFlagLock)
+#define ZwFileDialogShow CALL_PROFILE_CALL(1606, ZwFileDialogShow)
+#define cvxPathAdd CALL_PROFILE_CALL(1607, cvxPathAdd)
+#define cvxPathSearchBeginAdd CALL_PROFILE_CALL(1608, cvxPathSearchBeginAdd)
+#define cvxPathAddApiPath CALL_PROFILE_CALL(1609, cvxPathAddApiPath)
+#define cvxPathCompose CALL_PROFILE_CALL(1610, cvxPathCompose)
+#define cvxPathComposeByLongPath CALL_PROFILE_CALL(1611, cvxPathComposeByLongPath)
+#define cvxPathCheck CALL_PROFILE_CALL(1612, cvxPathCheck)
+#define cvxPathSet CALL_PROFILE_CALL(1613, cvxPathSet)
+#define cvxPathSearchFirst CALL_PROFILE_CALL(1614, cvxPathSearchFirst)
+#define cvxPathDel CALL_PROFILE_CALL(1615, cvxPathDel)
+#define cvxPathDelAll CALL_PROFILE_CALL(1616, cvxPathDelAll)
+#define cvxPathDelim CALL_PROFILE_CALL(1617, cvxPathDelim)
+#define cvxPathDelimByLongPath CALL_PROFILE_CALL(1618, cvxPathDelimByLongPath)
+#define cvxPathApiLib CALL_PROFILE_CALL(1619, cvxPathApiLib)
+#define cvxPathApiLibByLongPath CALL_PROFILE_CALL(1620, cvxPathApiLibByLongPath)
+#define cvxPathDir CALL_PROFILE_CALL(1621, cvxPathDir)
+#define cvxPathDirByLongPath CALL_PROFILE_CALL(1622, cvxPathDirByLongPath)
+#define cvxPathFile CALL_PROFILE_CALL(1623, cvxPathFile)
+#define cvxPathFileByLongPath CALL_PROFILE_CALL(1624, cvxPathFileByLongPath)
+#define cvxPathFile2 CALL_PROFILE_CALL(1625, cvxPathFile2)
+#define cvxPathFind CALL_PROFILE_CALL(1626, cvxPathFind)
+#define cvxPathFindByLongPath CALL_PROFILE_CALL(1627, cvxPathFindByLongPath)
+#define cvxPathFindByFileName CALL_PROFILE_CALL(1628, cvxPathFindByFileName)
+#define cvxPathInstall CALL_PROFILE_CALL(1629, cvxPathInstall)
+#define cvxPathInstallByLongPath CALL_PROFILE_CALL(1630, cvxPathInstallByLongPath)
+#define cvxPathTemp CALL_PROFILE_CALL(1631, cvxPathTemp)
+#define cvxPathTempByLongPath CALL_PROFILE_CALL(1632, cvxPathTempByLongPath)
+#define cvxPathUserFolder CALL_PROFILE_CALL(1633, cvxPathUserFolder)
+#define cvxPathUserFolderByLongPath CALL_PROFILE_CALL(1634, cvxPathUserFolderByLongPath)
+#define cvxPathIsDebug CALL_PROFILE_CALL(1635, cvxPathIsDebug)
+#define cvxPathSearchSet CALL_PROFILE_CALL(1636, cvxPathSearchSet)
+#define cvxPathSearchGet CALL_PROFILE_CALL(1637, cvxPathSearchGet)
+#define cvxPathCheckActiveOnlySet CALL_PROFILE_CALL(1638, cvxPathCheckActiveOnlySet)
+#define cvxPathCheckActiveOnlyGet CALL_PROFILE_CALL(1639, cvxPathCheckActiveOnlyGet)
+#define cvxFileNameLenIsOverrange CALL_PROFILE_CALL(1640, cvxFileNameLenIsOverrange)
+#define cvxFilePathLenIsOverrange CALL_PROFILE_CALL(1641, cvxFilePathLenIsOverrange)
+#define ZwPathSeparatorCheck CALL_PROFILE_CALL(1642, ZwPathSeparatorCheck)
+#define ZwPathFindByFileName CALL_PROFILE_CALL(1643, ZwPathFindByFileName)
+#define ZwSearchPathAdd CALL_PROFILE_CALL(1644, ZwSearchPathAdd)
+#define ZwSearchPathDelete CALL_PROFILE_CALL(1645, ZwSearchPathDelete)
+#define ZwSearchPathListGet CALL_PROFILE_CALL(1646, ZwSearchPathListGet)
+#define cvxEntNew CALL_PROFILE_CALL(1647, cvxEntNew)
+#define cvxEntNewList CALL_PROFILE_CALL(1648, cvxEntNewList)
+#define cvxEntNewAll CALL_PROFILE_CALL(1649, cvxEntNewAll)
+#define cvxPartInqTagNames CALL_PROFILE_CALL(1650, cvxPartInqTagNames)
+#define cvxEntBlank CALL_PROFILE_CALL(1651, cvxEntBlank)
+#define cvxEntIsBlanked CALL_PROFILE_CALL(1652, cvxEntIsBlanked)
+#define cvxEntHighlight CALL_PROFILE_CALL(1653, cvxEntHighlight)
+#define cvxEntUnHighlight CALL_PROFILE_CALL(1654, cvxEntUnHighlight)
+#define cvxEntHighlightByPath CALL_PROFILE_CALL(1655, cvxEntHighlightByPath)
+#define cvxEntUnHighlightByPath CALL_PROFILE_CALL(1656, cvxEntUnHighlightByPath)
+#define cvxEntUnhighlightAll CALL_PROFILE_CALL(1657, cvxEntUnhighlightAll)
+#define cvxEntExists CALL_PROFILE_CALL(1658, cvxEntExists)
+#define cvxEntInqSelected CALL_PROFILE_CALL(1659, cvxEntInqSelected)
+#define cvxEntInqPicked CALL_PROFILE_CALL(1660, cvxEntInqPicked)
+#define cvxEntInqPathSelected CALL_PROFILE_CALL(1661, cvxEntInqPathSelected)
+#define cvxEntInqPathPicked CALL_PROFILE_CALL(1662, cvxEntInqPathPicked)
+#define cvxEntUnPickAll CALL_PROFILE_CALL(1663, cvxEntUnPickAll)
+#define cvxEntUnPickLast CALL_PROFILE_CALL(1664, cvxEntUnPickLast)
+#define cvxEntUnPickByPath CALL_PROFILE_CALL(1665, cvxEntUnPickByPath)
+#define cvxEntAddPick CALL_PROFILE_CALL(1666, cvxEntAddPick)
+#define cvxEntPathAddPick CALL_PROFILE_CALL(1667, cvxEntPathAddPick)
+#define cvxPickDataClear CALL_PROFILE_CALL(1668, cvxPickDataClear)
+#define cvxEntUserAtGet CALL_PROFILE_CALL(1669, cvxEntUserAtGet)
+#define cvxEntUserAtSet CALL_PROFILE_CALL(1670, cvxEntUserAtSet)
+#define cvxEntUserAtDel CALL_PROFILE_CALL(1671, cvxEntUserAtDel)
+#define cvxEntColorGet CALL_PROFILE_CALL(1672, cvxEntColorGet)
+#define cvxEntColorSet CALL_PROFILE_CALL(1673, cvxEntColorSet)
+#define cvxEntRgbGet CALL_PROFILE_CALL(1674, cvxEntRgbGet)
+#define cvxEntRgbSet CALL_PROFILE_CALL(1675, cvxEntRgbSet)
+#define cvxEntRgbSetNoAt CALL_PROFILE_CALL(1676, cvxEntRgbSetNoAt)
+#define cvxEntTransSet CALL_PROFILE_CALL(1677, cvxEntTransSet)
+#define cvxEntTransGet CALL_PROFILE_CALL(1678, cvxEntTransGet)
+#define cvxEntLineAtGet CALL_PROFILE_CALL(1679, cvxEntLineAtGet)
+#define cvxEntLineAtSet CALL_PROFILE_CALL(1680, cvxEntLineAtSet)
+#define cvxEntUidGet CALL_PROFILE_CALL(1681, cvxEntUidGet)
+#define cvxEntUidSet CALL_PROFILE_CALL(1682, cvxEntUidSet)
+#define cvxPartInqEntLabel CALL_PROFILE_CALL(1683, cvxPartInqEntLabel)
+#define cvxEntLabelGet CALL_PROFILE_CALL(1684, cvxEntLabelGet)
+#define cvxEntLabelSet CALL_PROFILE_CALL(1685, cvxEntLabelSet)
+#define cvxEntName CALL_PROFILE_CALL(1686, cvxEntName)
+#define cvxEntNameSet CALL_PROFILE_CALL(1687, cvxEntNameSet)
+#define cvxEntSetNameTag CALL_PROFILE_CALL(1688, cvxEntSetNameTag)
+#define cvxEntLayer CALL_PROFILE_CALL(1689, cvxEntLayer)
+#define cvxEntLayerId CALL_PROFILE_CALL(1690, cvxEntLayerId)
+#define cvxEntMatrix CALL_PROFILE_CALL(1691, cvxEntMatrix)
+#define cvxEntMatrix2 CALL_PROFILE_CALL(1692, cvxEntMatrix2)
+#define cvxEntMatrixSet CALL_PROFILE_CALL(1693, cvxEntMatrixSet)
+#define cvxPartInqEntFtr CALL_PROFILE_CALL(1694, cvxPartInqEntFtr)
+#define cvxEntBndBox CALL_PROFILE_CALL(1695, cvxEntBndBox)
+#define cvxEntBndBoxByPath CALL_PROFILE_CALL(1696, cvxEntBndBoxByPath)
+#define cvxPartInqEntBox CALL_PROFILE_CALL(1697, cvxPartInqEntBox)
+#define cvxEntByLabel CALL_PROFILE_CALL(1698, cvxEntByLabel)
+#define cvxPartInqEntByLabel CALL_PROFILE_CALL(1699, cvxPartInqEntByLabel)
+#define cvxEntByName CALL_PROFILE_CALL(1700, cvxEntByName)
+#define cvxEntByName2 CALL_PROFILE_CALL(1701, cvxEntByName2)
+#define cvxEntNameByPath CALL_PROFILE_CALL(1702, cvxEntNameByPath)
+#define cvxEntByUid CALL_PROFILE_CALL(1703, cvxEntByUid)
+#define cvxEntFind CALL_PROFILE_CALL(1704, cvxEntFind)
+#define cvxEntFind2 CALL_PROFILE_CALL(1705, cvxEntFind2)
+#define cvxEntClassName CALL_PROFILE_CALL(1706, cvxEntClassName)
+#define cvxEntClassNum CALL_PROFILE_CALL(1707, cvxEntClassNum)
+#define cvxEntClassNumByPath CALL_PROFILE_CALL(1708, cvxEntClassNumByPath)
+#define cvxEntIsCurve CALL_PROFILE_CALL(1709, cvxEntIsCurve)
+#define cvxEntIsElectrode CALL_PROFILE_CALL(1710, cvxEntIsElectrode)
+#define cvxEntPnt CALL_PROFILE_CALL(1711, cvxEntPnt)
+#define cvxEntEndPnt CALL_PROFILE_CALL(1712, cvxEntEndPnt)
+#define cvxEntSketch CALL_PROFILE_CALL(1713, cvxEntSketch)
+#define cvxEntParent CALL_PROFILE_CALL(1714, cvxEntParent)
+#define cvxEntRefEnt CALL_PROFILE_CALL(1715, cvxEntRefEnt)
+#define cvxEntComp CALL_PROFILE_CALL(1716, cvxEntComp)
+#define cvxEntErase CALL_PROFILE_CALL(1717, cvxEntErase)
+#define cvxEntActivate CALL_PROFILE_CALL(1718, cvxEntActivate)
+#define cvxGlobalGet CALL_PROFILE_CALL(1719, cvxGlobalGet)
+#define cvxGlobalSet CALL_PROFILE_CALL(1720, cvxGlobalSet)
+#define cvxNoteGet CALL_PROFILE_CALL(1721, cvxNoteGet)
+#define cvxNoteSet CALL_PROFILE_CALL(1722, cvxNoteSet)
+#define cvxAutoRegenGet CALL_PROFILE_CALL(1723, cvxAutoRegenGet)
+#define cvxAutoRegenSet CALL_PROFILE_CALL(1724, cvxAutoRegenSet)
+#define cvxLangGet CALL_PROFILE_CALL(1725, cvxLangGet)
+#define cvxFontMap CALL_PROFILE_CALL(1726, cvxFontMap)
+#define cvxUnitGet CALL_PROFILE_CALL(1727, cvxUnitGet)
+#define cvxUnitTypeGet CALL_PROFILE_CALL(1728, cvxUnitTypeGet)
+#define cvxUnitSet CALL_PROFILE_CALL(1729, cvxUnitSet)
+#define cvxUnitToSys CALL_PROFILE_CALL(1730, cvxUnitToSys)
+#define cvxUnitToUser CALL_PROFILE_CALL(1731, cvxUnitToUser)
+#define cvxUnitMassGet CALL_PROFILE_CALL(1732, cvxUnitMassGet)
+#define cvxUnitMassSet CALL_PROFILE_CALL(1733, cvxUnitMassSet)
+#define cvxSkGridSpacingGet CALL_PROFILE_CALL(1734, cvxSkGridSpacingGet)
+#define cvxSkGridSpacingSet CALL_PROFILE_CALL(1735, cvxSkGridSpacingSet)
+#define cvxColorfToColor CALL_PROFILE_CALL(1736, cvxColorfToColor)
+#define cvxColorToColorf CALL_PROFILE_CALL(1737, cvxColorToColorf)
+#define cvxColorRGB CALL_PROFILE_CALL(1738, cvxColorRGB)
+#define cvxColorNear CALL_PROFILE_CALL(1739, cvxColorNear)
+#define cvxEscCheck CALL_PROFILE_CALL(1740, cvxEscCheck)
+#define cvxEscDisable CALL_PROFILE_CALL(1741, cvxEscDisable)
+#define cvxEscRestore CALL_PROFILE_CALL(1742, cvxEscRestore)
+#define cvxEscStart CALL_PROFILE_CALL(1743, cvxEscStart)
+#define cvxEscEnd CALL_PROFILE_CALL(1744, cvxEscEnd)
+#define cvxVersion CALL_PROFILE_CALL(1745, cvxVersion)
+#define cvxVersionNum CALL_PROFILE_CALL(1746, cvxVersionNum)
+#define cvxFilterListGet CALL_PROFILE_CALL(1747, cvxFilterListGet)
+#define cvxColorFilter CALL_PROFILE_CALL(1748, cvxColorFilter)
+#define cvxFilterActiveGet CALL_PROFILE_CALL(1749, cvxFilterActiveGet)
+#define cvxLabelMatch CALL_PROFILE_CALL(1750, cvxLabelMatch)
+#define cvxNameIsOkay CALL_PROFILE_CALL(1751, cvxNameIsOkay)
+#define cvxHostId CALL_PROFILE_CALL(1752, cvxHostId)
+#define cvxNotifyExit CALL_PROFILE_CALL(1753, cvxNotifyExit)
+#define cvxSetMSMMoldInstalled CALL_PROFILE_CALL(1754, cvxSetMSMMoldInstalled)
+#define cvxSetMSMPressInstalled CALL_PROFILE_CALL(1755, cvxSetMSMPressInstalled)
+#define cvxPluginRegPathGet CALL_PROFILE_CALL(1756, cvxPluginRegPathGet)
+#define cvxPluginRegPathGetByLongPath CALL_PROFILE_CALL(1757, cvxPluginRegPathGetByLongPath)
+#define ZwPluginDataInit CALL_PROFILE_CALL(1758, ZwPluginDataInit)
+#define ZwPluginLoad CALL_PROFILE_CALL(1759, ZwPluginLoad)
+#define ZwPluginUnload CALL_PROFILE_CALL(1760, ZwPluginUnload)
+#define ZwPluginListGet CALL_PROFILE_CALL(1761, ZwPluginListGet)
+#define ZwResourceFileRegister CALL_PROFILE_CALL(1762, ZwResourceFileRegister)
+#define ZwResourceFileUnregister CALL_PROFILE_CALL(1763, ZwResourceFileUnregister)
+#define ZwResourcePathAdd CALL_PROFILE_CALL(1764, ZwResourcePathAdd)
+#define ZwResourcePathDelete CALL_PROFILE_CALL(1765, ZwResourcePathDelete)
+#define ZwResourcePathListGet CALL_PROFILE_CALL(1766, ZwResourcePathListGet)
+#define ZwProfileModuleNameRegister CALL_PROFILE_CALL(1767, ZwProfileModuleNameRegister)
+#define cvxHelpDocLoad CALL_PROFILE_CALL(1768, cvxHelpDocLoad)
+#define cvxAppAction CALL_PROFILE_CALL(1769, cvxAppAction)
+#define ZwApplicationReactorSet CALL_PROFILE_CALL(1770, ZwApplicationReactorSet)
+#define ZwDocumentReactorSet CALL_PROFILE_CALL(1771, ZwDocumentReactorSet)
+#define ZwEnvironmentReactorSet CALL_PROFILE_CALL(1772, ZwEnvironmentReactorSet)
+#define ZwPreferenceToleranceGet CALL_PROFILE_CALL(1773, ZwPreferenceToleranceGet)
+#define ZwPreferenceToleranceSet CALL_PROFILE_CALL(1774, ZwPreferenceToleranceSet)
+#define ZwPreferenceFreeEdgeDisplayModeGet CALL_PROFILE_CALL(1775, ZwPreferenceFreeEdgeDisplayModeGet)
+#define ZwPreferenceFreeEdgeDisplayModeSet CALL_PROFILE_CALL(1776, ZwPreferenceFreeEdgeDisplayModeSet)
+#define ZwPreferenceComponentLightSourcesModeGet CALL_PROFILE_CALL(1777, ZwPreferenceComponentLightSourcesModeGet)
+#define ZwPreferenceComponentLightSourcesModeSet CALL_PROFILE_CALL(1778, ZwPreferenceComponentLightSourcesModeSet)
+#define ZwPreferenceUnitsSystemGet CALL_PROFILE_CALL(1779, ZwPreferenceUnitsSystemGet)
+#define ZwPreferenceUnitsSystemSet CALL_PROFILE_CALL(1780, ZwPreferenceUnitsSystemSet)
+#define ZwHarnessShapeListGet CALL_PROFILE_CALL(1781, ZwHarnessShapeListGet)
+#define ZwHistoryOperationDelete CALL_PROFILE_CALL(1782, ZwHistoryOperationDelete)
+#define ZwHistoryListGet CALL_PROFILE_CALL(1783, ZwHistoryListGet)
+#define ZwHistoryClip CALL_PROFILE_CALL(1784, ZwHistoryClip)
+#define ZwHistoryPaste CALL_PROFILE_CALL(1785, ZwHistoryPaste)
+#define ZwHistoryEntitySuppressStatusGet CALL_PROFILE_CALL(1786, ZwHistoryEntitySuppressStatusGet)
+#define ZwHistoryEntityTemplateNameGet CALL_PROFILE_CALL(1787, ZwHistoryEntityTemplateNameGet)
+#define ZwRayShapeIntersect CALL_PROFILE_CALL(1788, ZwRayShapeIntersect)
+#define ZwRayComponentIntersectWithRadius CALL_PROFILE_CALL(1789, ZwRayComponentIntersectWithRadius)
+#define cvxLayerAdd CALL_PROFILE_CALL(1790, cvxLayerAdd)
+#define cvxLayerAdd2 CALL_PROFILE_CALL(1791, cvxLayerAdd2)
+#define cvxLayerDel CALL_PROFILE_CALL(1792, cvxLayerDel)
+#define cvxLayerDel2 CALL_PROFILE_CALL(1793, cvxLayerDel2)
+#define cvxLayerActivate CALL_PROFILE_CALL(1794, cvxLayerActivate)
+#define cvxLayerSync CALL_PROFILE_CALL(1795, cvxLayerSync)
+#define cvxLayerShowAll CALL_PROFILE_CALL(1796, cvxLayerShowAll)
+#define cvxLayerIdModify CALL_PROFILE_CALL(1797, cvxLayerIdModify)
+#define cvxLayerInqActive CALL_PROFILE_CALL(1798, cvxLayerInqActive)
+#define cvxLayerExists CALL_PROFILE_CALL(1799, cvxLayerExists)
+#define cvxLayerExists2 CALL_PROFILE_CALL(1800, cvxLayerExists2)
+#define cvxLayerId CALL_PROFILE_CALL(1801, cvxLayerId)
+#define cvxLayerInqEnts CALL_PROFILE_CALL(1802, cvxLayerInqEnts)
+#define cvxLayerAssign CALL_PROFILE_CALL(1803, cvxLayerAssign)
+#define cvxLayerList CALL_PROFILE_CALL(1804, cvxLayerList)
+#define cvxLayerName CALL_PROFILE_CALL(1805, cvxLayerName)
+#define cvxLayerNum CALL_PROFILE_CALL(1806, cvxLayerNum)
+#define cvxLayerGetAllCategory CALL_PROFILE_CALL(1807, cvxLayerGetAllCategory)
+#define cvxActiveLayerNumGet CALL_PROFILE_CALL(1808, cvxActiveLayerNumGet)
+#define cvxActiveLayerNumSet CALL_PROFILE_CALL(1809, cvxActiveLayerNumSet)
+#define cvxLayerStateGet CALL_PROFILE_CALL(1810, cvxLayerStateGet)
+#define cvxLayerStateSet CALL_PROFILE_CALL(1811, cvxLayerStateSet)
+#define ZwLayerCategoryCreate CALL_PROFILE_CALL(1812, ZwLayerCategoryCreate)
+#define ZwLayerCategoryNameSet CALL_PROFILE_CALL(1813, ZwLayerCategoryNameSet)
+#define ZwLayerCategoryDelete CALL_PROFILE_CALL(1814, ZwLayerCategoryDelete)
+#define ZwLayerCategoryListGet CALL_PROFILE_CALL(1815, ZwLayerCategoryListGet)
+#define ZwLayerCategoryActiveStateGet CALL_PROFILE_CALL(1816, ZwLayerCategoryActiveStateGet)
+#define ZwLayerCategoryActiveStateSet CALL_PROFILE_CALL(1817, ZwLayerCategoryActiveStateSet)
+#define ZwLayerVisibilitySetAll CALL_PROFILE_CALL(1818, ZwLayerVisibilitySetAll)
+#define ZwLayerCategoryVisibilitySet CALL_PROFILE_CALL(1819, ZwLayerCategoryVisibilitySet)
+#define ZwLayerFrozenStateSetAll CALL_PROFILE_CALL(1820, ZwLayerFrozenStateSetAll)
+#define ZwLayerCategoryFrozenStateSet CALL_PROFILE_CALL(1821, ZwLayerCategoryFrozenStateSet)
+#define ZwLayerVisibilityRefresh CALL_PROFILE_CALL(1822, ZwLayerVisibilityRefresh)
+#define ZwLayerManagerRefresh CALL_PROFILE_CALL(1823, ZwLayerManagerRefresh)
+#define cvxLayerInfoGet CALL_PROFILE_CALL(1824, cvxLayerInfoGet)
+#define cvxLayerInfoSet CALL_PROFILE_CALL(1825, cvxLayerInfoSet)
+#define cvxLayerInfoExport CALL_PROFILE_CALL(1826, cvxLayerInfoExport)
+#define cvxLayerInfoImport CALL_PROFILE_CALL(1827, cvxLayerInfoImport)
+#define cvxLayerRefresh CALL_PROFILE_CALL(1828, cvxLayerRefresh)
+#define ZwLayerRuleCreate CALL_PROFILE_CALL(1829, ZwLayerRuleCreate)
+#define ZwLayerRuleDelete CALL_PROFILE_CALL(1830, ZwLayerRuleDelete)
+#define ZwLayerRulesDeleteAll CALL_PROFILE_CALL(1831, ZwLayerRulesDeleteAll)
+#define ZwLayerRuleDataSet CALL_PROFILE_CALL(1832, ZwLayerRuleDataSet)
+#define ZwLayerRuleListGet CALL_PROFILE_CALL(1833, ZwLayerRuleListGet)
+#define ZwLayerRuleDataGet CALL_PROFILE_CALL(1834, ZwLayerRuleDataGet)
+#define ZwLayerRuleActiveStateGet CALL_PROFILE_CALL(1835, ZwLayerRuleActiveStateGet)
+#define ZwLayerRuleActiveStateSet CALL_PROFILE_CALL(1836, ZwLayerRuleActiveStateSet)
+#define cvxLicModulesGet CALL_PROFILE_CALL(1837, cvxLicModulesGet)
+#define cvxLicIdentifierGet CALL_PROFILE_CALL(1838, cvxLicIdentifierGet)
+#define cvxLicEvaluationGet CALL_PROFILE_CALL(1839, cvxLicEvaluationGet)
+#define cvxLicStandaloneEvaluationGet CALL_PROFILE_CALL(1840, cvxLicStandaloneEvaluationGet)
+#define cvxLicActivate CALL_PROFILE_CALL(1841, cvxLicActivate)
+#define cvxLicRemove CALL_PROFILE_CALL(1842, cvxLicRemove)
+#define cvxLicTypeCheck CALL_PROFILE_CALL(1843, cvxLicTypeCheck)
+#define ZwLinkManagerFileListGet CALL_PROFILE_CALL(1844, ZwLinkManagerFileListGet)
+#define ZwLinkManagerAutoRegenSet CALL_PROFILE_CALL(1845, ZwLinkManagerAutoRegenSet)
+#define ZwLinkManagerAutoRegenGet CALL_PROFILE_CALL(1846, ZwLinkManagerAutoRegenGet)
+#define ZwLinkManagerInformationGet CALL_PROFILE_CALL(1847, ZwLinkManagerInformationGet)
+#define ZwLoopEdgeListGet CALL_PROFILE_CALL(1848, ZwLoopEdgeListGet)
+#define ZwLoopPreEdgeListGet CALL_PROFILE_CALL(1849, ZwLoopPreEdgeListGet)
+#define ZwLoopIsInner CALL_PROFILE_CALL(1850, ZwLoopIsInner)
+#define ZwMaterialListGet CALL_PROFILE_CALL(1851, ZwMaterialListGet)
+#define ZwMaterialLibraryCustomCreate CALL_PROFILE_CALL(1852, ZwMaterialLibraryCustomCreate)
+#define ZwMaterialLibraryCustomDelete CALL_PROFILE_CALL(1853, ZwMaterialLibraryCustomDelete)
+#define ZwMaterialLibraryListGet CALL_PROFILE_CALL(1854, ZwMaterialLibraryListGet)
+#define ZwMaterialLibraryCategoryCreate CALL_PROFILE_CALL(1855, ZwMaterialLibraryCategoryCreate)
+#define ZwMaterialLibraryCategoryDelete CALL_PROFILE_CALL(1856, ZwMaterialLibraryCategoryDelete)
+#define ZwMaterialLibraryCategoryListGet CALL_PROFILE_CALL(1857, ZwMaterialLibraryCategoryListGet)
+#define ZwMaterialLibraryMaterialCreate CALL_PROFILE_CALL(1858, ZwMaterialLibraryMaterialCreate)
+#define ZwMaterialLibraryMaterialDelete CALL_PROFILE_CALL(1859, ZwMaterialLibraryMaterialDelete)
+#define ZwMaterialLibraryMaterialListGet CALL_PROFILE_CALL(1860, ZwMaterialLibraryMaterialListGet)
+#define ZwMaterialGeneralPropertySet CALL_PROFILE_CALL(1861, ZwMaterialGeneralPropertySet)
+#define ZwMaterialGeneralPropertyGet CALL_PROFILE_CALL(1862, ZwMaterialGeneralPropertyGet)
+#define ZwMaterialGeneralPropertyListSet CALL_PROFILE_CALL(1863, ZwMaterialGeneralPropertyListSet)
+#define ZwMaterialGeneralPropertyListGet CALL_PROFILE_CALL(1864, ZwMaterialGeneralPropertyListGet)
+#define ZwMaterialGeneralPropertyDelete CALL_PROFILE_CALL(1865, ZwMaterialGeneralPropertyDelete)
+#define cvxRoundNumber CALL_PROFILE_CALL(1866, cvxRoundNumber)
+#define cvxCrvPlaneParallelChk CALL_PROFILE_CALL(1867, cvxCrvPlaneParallelChk)
+#define cvxAxisDistance CALL_PROFILE_CALL(1868, cvxAxisDistance)
+#define cvxAxisCrvDistance CALL_PROFILE_CALL(1869, cvxAxisCrvDistance)
+#define cvxPlaneDistance CALL_PROFILE_CALL(1870, cvxPlaneDistance)
+#define cvxEntGetDistance CALL_PROFILE_CALL(1871, cvxEntGetDistance)
+#define cvxEntGetDistanceByPath CALL_PROFILE_CALL(1872, cvxEntGetDistanceByPath)
+#define cvxEntGetAngle CALL_PROFILE_CALL(1873, cvxEntGetAngle)
+#define cvxPartInqEntsArea CALL_PROFILE_CALL(1874, cvxPartInqEntsArea)
+#define cvxPartInqEntsAreaByPath CALL_PROFILE_CALL(1875, cvxPartInqEntsAreaByPath)
+#define cvxBndBoxInit CALL_PROFILE_CALL(1876, cvxBndBoxInit)
+#define cvxBndBoxInit2 CALL_PROFILE_CALL(1877, cvxBndBoxInit2)
+#define cvxBndBoxPnts CALL_PROFILE_CALL(1878, cvxBndBoxPnts)
+#define cvxBndBoxCenter CALL_PROFILE_CALL(1879, cvxBndBoxCenter)
+#define cvxBndBoxPntLoc CALL_PROFILE_CALL(1880, cvxBndBoxPntLoc)
+#define cvxBndBoxAdd CALL_PROFILE_CALL(1881, cvxBndBoxAdd)
+#define cvxBndBoxMerge CALL_PROFILE_CALL(1882, cvxBndBoxMerge)
+#define cvxBndBoxSize CALL_PROFILE_CALL(1883, cvxBndBoxSize)
+#define cvxBndBoxVolume CALL_PROFILE_CALL(1884, cvxBndBoxVolume)
+#define cvxBndBoxContain CALL_PROFILE_CALL(1885, cvxBndBoxContain)
+#define cvxBndBoxPntDist CALL_PROFILE_CALL(1886, cvxBndBoxPntDist)
+#define cvxBndBoxDist CALL_PROFILE_CALL(1887, cvxBndBoxDist)
+#define cvxIsectCrvCrv CALL_PROFILE_CALL(1888, cvxIsectCrvCrv)
+#define cvxIsectCrvFace CALL_PROFILE_CALL(1889, cvxIsectCrvFace)
+#define cvxIsectFaceFace CALL_PROFILE_CALL(1890, cvxIsectFaceFace)
+#define cvxIsectRayCrv CALL_PROFILE_CALL(1891, cvxIsectRayCrv)
+#define cvxIsectRayFace CALL_PROFILE_CALL(1892, cvxIsectRayFace)
+#define cvxIsectRayFaceInfinite CALL_PROFILE_CALL(1893, cvxIsectRayFaceInfinite)
+#define cvxIsectRayPlane CALL_PROFILE_CALL(1894, cvxIsectRayPlane)
+#define cvxIsectRayShape CALL_PROFILE_CALL(1895, cvxIsectRayShape)
+#define cvxIsectRayShapes CALL_PROFILE_CALL(1896, cvxIsectRayShapes)
+#define cvxIsectRayPart CALL_PROFILE_CALL(1897, cvxIsectRayPart)
+#define cvxIsectRayPartVis CALL_PROFILE_CALL(1898, cvxIsectRayPartVis)
+#define cvxIsectRayComp CALL_PROFILE_CALL(1899, cvxIsectRayComp)
+#define cvxIsectRayComps CALL_PROFILE_CALL(1900, cvxIsectRayComps)
+#define cvxCompFind CALL_PROFILE_CALL(1901, cvxCompFind)
+#define cvxIsectRayBndBox CALL_PROFILE_CALL(1902, cvxIsectRayBndBox)
+#define cvxPartIsectShpChk CALL_PROFILE_CALL(1903, cvxPartIsectShpChk)
+#define cvxPartIsectShpChk2 CALL_PROFILE_CALL(1904, cvxPartIsectShpChk2)
+#define cvxCompIsectShpShp CALL_PROFILE_CALL(1905, cvxCompIsectShpShp)
+#define cvxIsectBndBoxBndBox CALL_PROFILE_CALL(1906, cvxIsectBndBoxBndBox)
+#define cvxIsectBndBoxPlane CALL_PROFILE_CALL(1907, cvxIsectBndBoxPlane)
+#define cvxIsectPlanePlane CALL_PROFILE_CALL(1908, cvxIsectPlanePlane)
+#define cvxMatEigen CALL_PROFILE_CALL(1909, cvxMatEigen)
+#define cvxMatInit CALL_PROFILE_CALL(1910, cvxMatInit)
+#define cvxMatInvert CALL_PROFILE_CALL(1911, cvxMatInvert)
+#define cvxMatMult CALL_PROFILE_CALL(1912, cvxMatMult)
+#define cvxMatPntVec CALL_PROFILE_CALL(1913, cvxMatPntVec)
+#define cvxMatPntVecs CALL_PROFILE_CALL(1914, cvxMatPntVecs)
+#define cvxMatGetPntVecs CALL_PROFILE_CALL(1915, cvxMatGetPntVecs)
+#define cvxMatRotate CALL_PROFILE_CALL(1916, cvxMatRotate)
+#define cvxMatScale CALL_PROFILE_CALL(1917, cvxMatScale)
+#define cvxMatSetIdentity CALL_PROFILE_CALL(1918, cvxMatSetIdentity)
+#define cvxMatTransform CALL_PROFILE_CALL(1919, cvxMatTransform)
+#define cvxMatTranslate CALL_PROFILE_CALL(1920, cvxMatTranslate)
+#define cvxMatView CALL_PROFILE_CALL(1921, cvxMatView)
+#define cvxMatToEuler CALL_PROFILE_CALL(1922, cvxMatToEuler)
+#define cvxMatFromEuler CALL_PROFILE_CALL(1923, cvxMatFromEuler)
+#define cvxPntTransform CALL_PROFILE_CALL(1924, cvxPntTransform)
+#define cvxPntTransformList CALL_PROFILE_CALL(1925, cvxPntTransformList)
+#define cvxAxisTransform CALL_PROFILE_CALL(1926, cvxAxisTransform)
+#define cvxVecTransform CALL_PROFILE_CALL(1927, cvxVecTransform)
+#define cvxCrvTransform CALL_PROFILE_CALL(1928, cvxCrvTransform)
+#define cvxSrfTransform CALL_PROFILE_CALL(1929, cvxSrfTransform)
+#define cvxBndBoxTransform CALL_PROFILE_CALL(1930, cvxBndBoxTransform)
+#define cvxCrvEval CALL_PROFILE_CALL(1931, cvxCrvEval)
+#define cvxCrvEval2 CALL_PROFILE_CALL(1932, cvxCrvEval2)
+#define cvxPreEdgeEval CALL_PROFILE_CALL(1933, cvxPreEdgeEval)
+#define cvxCrvEvalCrvtr CALL_PROFILE_CALL(1934, cvxCrvEvalCrvtr)
+#define cvxCrvIsLine CALL_PROFILE_CALL(1935, cvxCrvIsLine)
+#define cvxCrvParam CALL_PROFILE_CALL(1936, cvxCrvParam)
+#define cvxCrvMinMaxRad CALL_PROFILE_CALL(1937, cvxCrvMinMaxRad)
+#define cvxCrvInqContinuity CALL_PROFILE_CALL(1938, cvxCrvInqContinuity)
+#define cvxCrvContinuityTolListInit CALL_PROFILE_CALL(1939, cvxCrvContinuityTolListInit)
+#define cvxCrvInqMultiContinuity CALL_PROFILE_CALL(1940, cvxCrvInqMultiContinuity)
+#define cvxPartCurveChainFind CALL_PROFILE_CALL(1941, cvxPartCurveChainFind)
+#define cvxCrvGetPntAtLenFraction CALL_PROFILE_CALL(1942, cvxCrvGetPntAtLenFraction)
+#define cvxCrvPntProj CALL_PROFILE_CALL(1943, cvxCrvPntProj)
+#define cvxCrvGetPntAtDist CALL_PROFILE_CALL(1944, cvxCrvGetPntAtDist)
+#define cvxCrvGetInflections CALL_PROFILE_CALL(1945, cvxCrvGetInflections)
+#define cvxCrvInqExtreme CALL_PROFILE_CALL(1946, cvxCrvInqExtreme)
+#define cvxCrvExtremum CALL_PROFILE_CALL(1947, cvxCrvExtremum)
+#define cvxCrvGetCusps CALL_PROFILE_CALL(1948, cvxCrvGetCusps)
+#define cvxCrvLen CALL_PROFILE_CALL(1949, cvxCrvLen)
+#define cvxCrvLen2 CALL_PROFILE_CALL(1950, cvxCrvLen2)
+#define cvxPartSew CALL_PROFILE_CALL(1951, cvxPartSew)
+#define cvxPartFace CALL_PROFILE_CALL(1952, cvxPartFace)
+#define cvxPartFaceMod CALL_PROFILE_CALL(1953, cvxPartFaceMod)
+#define cvxSrfEval CALL_PROFILE_CALL(1954, cvxSrfEval)
+#define cvxSrfDiameterEval CALL_PROFILE_CALL(1955, cvxSrfDiameterEval)
+#define cvxPartFaceFind CALL_PROFILE_CALL(1956, cvxPartFaceFind)
+#define cvxPartFaceEdgesFind CALL_PROFILE_CALL(1957, cvxPartFaceEdgesFind)
+#define cvxSrfAxis CALL_PROFILE_CALL(1958, cvxSrfAxis)
+#define cvxSrfGetPole CALL_PROFILE_CALL(1959, cvxSrfGetPole)
+#define cvxSrfFindPoles CALL_PROFILE_CALL(1960, cvxSrfFindPoles)
+#define cvxPntIsCritical CALL_PROFILE_CALL(1961, cvxPntIsCritical)
+#define cvxPntIsOn CALL_PROFILE_CALL(1962, cvxPntIsOn)
+#define cvxPntOnCrv CALL_PROFILE_CALL(1963, cvxPntOnCrv)
+#define cvxPntOnFace CALL_PROFILE_CALL(1964, cvxPntOnFace)
+#define cvxPntProject CALL_PROFILE_CALL(1965, cvxPntProject)
+#define cvxPntEntLoc CALL_PROFILE_CALL(1966, cvxPntEntLoc)
+#define cvxAxisPntProject CALL_PROFILE_CALL(1967, cvxAxisPntProject)
+#define cvxPlanePntProject CALL_PROFILE_CALL(1968, cvxPlanePntProject)
+#define cvxPntTranslate CALL_PROFILE_CALL(1969, cvxPntTranslate)
+#define cvxPntDist CALL_PROFILE_CALL(1970, cvxPntDist)
+#define cvxPntEntDist CALL_PROFILE_CALL(1971, cvxPntEntDist)
+#define cvxPntPreEdgeDist CALL_PROFILE_CALL(1972, cvxPntPreEdgeDist)
+#define cvxAxisPntDistance CALL_PROFILE_CALL(1973, cvxAxisPntDistance)
+#define cvxPlanePntDistance CALL_PROFILE_CALL(1974, cvxPlanePntDistance)
+#define cvxAxisEvalPoint CALL_PROFILE_CALL(1975, cvxAxisEvalPoint)
+#define cvxPlaneEvalPoint CALL_PROFILE_CALL(1976, cvxPlaneEvalPoint)
+#define cvxPlnThruPnts CALL_PROFILE_CALL(1977, cvxPlnThruPnts)
+#define cvxPolyToTri CALL_PROFILE_CALL(1978, cvxPolyToTri)
+#define cvxVecInit CALL_PROFILE_CALL(1979, cvxVecInit)
+#define cvxVecNormalize CALL_PROFILE_CALL(1980, cvxVecNormalize)
+#define cvxVecAngle CALL_PROFILE_CALL(1981, cvxVecAngle)
+#define cvxVecCross CALL_PROFILE_CALL(1982, cvxVecCross)
+#define cvxVecPerp CALL_PROFILE_CALL(1983, cvxVecPerp)
+#define cvxVecReverse CALL_PROFILE_CALL(1984, cvxVecReverse)
+#define cvxVecParallelChk CALL_PROFILE_CALL(1985, cvxVecParallelChk)
+#define ZwMatrix3Eigen CALL_PROFILE_CALL(1986, ZwMatrix3Eigen)
+#define ZwMatrixInit CALL_PROFILE_CALL(1987, ZwMatrixInit)
+#define ZwMatrixInvert CALL_PROFILE_CALL(1988, ZwMatrixInvert)
+#define ZwMatrixCrossProduct CALL_PROFILE_CALL(1989, ZwMatrixCrossProduct)
+#define ZwMatrixGetByPointAndZAxis CALL_PROFILE_CALL(1990, ZwMatrixGetByPointAndZAxis)
+#define ZwMatrixGetByPointAndXYAxis CALL_PROFILE_CALL(1991, ZwMatrixGetByPointAndXYAxis)
+#define ZwMatrixCoordinateSystemGet CALL_PROFILE_CALL(1992, ZwMatrixCoordinateSystemGet)
+#define ZwMatrixInitByRotation CALL_PROFILE_CALL(1993, ZwMatrixInitByRotation)
+#define ZwMatrixInitByPoint CALL_PROFILE_CALL(1994, ZwMatrixInitByPoint)
+#define ZwMatrixIdentityFlagRefresh CALL_PROFILE_CALL(1995, ZwMatrixIdentityFlagRefresh)
+#define ZwMatrixTransform CALL_PROFILE_CALL(1996, ZwMatrixTransform)
+#define ZwMatrixInitByTranslation CALL_PROFILE_CALL(1997, ZwMatrixInitByTranslation)
+#define ZwMatrixInitByView CALL_PROFILE_CALL(1998, ZwMatrixInitByView)
+#define ZwMatrixToEulerAngle CALL_PROFILE_CALL(1999, ZwMatrixToEulerAngle)
+#define ZwEulerAngleToMatrix CALL_PROFILE_CALL(2000, ZwEulerAngleToMatrix)
+#define ZwPointTransform CALL_PROFILE_CALL(2001, ZwPointTransform)
+#define ZwPointListTransform CALL_PROFILE_CALL(2002, ZwPointListTransform)
+#define ZwMatrix2Determinant CALL_PROFILE_CALL(2003, ZwMatrix2Determinant)
+#define ZwMatrix3Determinant CALL_PROFILE_CALL(2004, ZwMatrix3Determinant)
+#define ZwMatrix2Transpose CALL_PROFILE_CALL(2005, ZwMatrix2Transpose)
+#define ZwMatrix3Transpose CALL_PROFILE_CALL(2006, ZwMatrix3Transpose)
+#define ZwMatrixTranspose CALL_PROFILE_CALL(2007, ZwMatrixTranspose)
+#define ZwMatrixRotationGet CALL_PROFILE_CALL(2008, ZwMatrixRotationGet)
+#define ZwMatrixScaleGet CALL_PROFILE_CALL(2009, ZwMatrixScaleGet)
+#define ZwMatrixTranslationGet CALL_PROFILE_CALL(2010, ZwMatrixTranslationGet)
+#define ZwMatrix3ToMatrix4 CALL_PROFILE_CALL(2011, ZwMatrix3ToMatrix4)
+#define ZwMatrixRotationSet CALL_PROFILE_CALL(2012, ZwMatrixRotationSet)
+#define ZwMatrixScaleSet CALL_PROFILE_CALL(2013, ZwMatrixScaleSet)
+#define ZwMatrixTranslationSet CALL_PROFILE_CALL(2014, ZwMatrixTranslationSet)
+#define ZwMatrixNormalize CALL_PROFILE_CALL(2015, ZwMatrixNormalize)
+#define ZwMatrixOrthogonalCheck CALL_PROFILE_CALL(2016, ZwMatrixOrthogonalCheck)
+#define ZwMatrixReflectionMatrixCreate CALL_PROFILE_CALL(2017, ZwMatrixReflectionMatrixCreate)
+#define ZwMatrixFullRankCheck CALL_PROFILE_CALL(2018, ZwMatrixFullRankCheck)
+#define cvxMemAlloc CALL_PROFILE_CALL(2019, cvxMemAlloc)
+#define cvxMemResize CALL_PROFILE_CALL(2020, cvxMemResize)
+#define ZwMemoryAlloc CALL_PROFILE_CALL(2021, ZwMemoryAlloc)
+#define ZwMemoryResize CALL_PROFILE_CALL(2022, ZwMemoryResize)
+#define cvxMemZero CALL_PROFILE_CALL(2023, cvxMemZero)
+#define ZwMemoryZero CALL_PROFILE_CALL(2024, ZwMemoryZero)
+#define cvxMemFree CALL_PROFILE_CALL(2025, cvxMemFree)
+#define ZwMemoryFree CALL_PROFILE_CALL(2026, ZwMemoryFree)
+#define cvxErrDisable CALL_PROFILE_CALL(2027, cvxErrDisable)
+#define cvxErrEnable CALL_PROFILE_CALL(2028, cvxErrEnable)
+#define cvxMsgDisable CALL_PROFILE_CALL(2029, cvxMsgDisable)
+#define cvxMsgEnable CALL_PROFILE_CALL(2030, cvxMsgEnable)
+#define cvxLastWarningMsgEnable CALL_PROFILE_CALL(2031, cvxLastWarningMsgEnable)
+#define cvxPromptDisable CALL_PROFILE_CALL(2032, cvxPromptDisable)
+#define cvxPromptEnable CALL_PROFILE_CALL(2033, cvxPromptEnable)
+#define cvxTranStatusDisable CALL_PROFILE_CALL(2034, cvxTranStatusDisable)
+#define cvxTranStatusEnable CALL_PROFILE_CALL(2035, cvxTranStatusEnable)
+#define cvxUserActionStatusGet CALL_PROFILE_CALL(2036, cvxUserActionStatusGet)
+#define cvxUserActionStatusSet CALL_PROFILE_CALL(2037, cvxUserActionStatusSet)
+#define cvxCrashPromptDisable CALL_PROFILE_CALL(2038, cvxCrashPromptDisable)
+#define cvxCrashPromptEnable CALL_PROFILE_CALL(2039, cvxCrashPromptEnable)
+#define cvxUserActionStatusSet2 CALL_PROFILE_CALL(2040, cvxUserActionStatusSet2)
+#define cvxMsgAreaClose CALL_PROFILE_CALL(2041, cvxMsgAreaClose)
+#define cvxMsgAreaOpen CALL_PROFILE_CALL(2042, cvxMsgAreaOpen)
+#define cvxMsgAreaState CALL_PROFILE_CALL(2043, cvxMsgAreaState)
+#define cvxMsgAreaStateGet CALL_PROFILE_CALL(2044, cvxMsgAreaStateGet)
+#define cvxMsgFileLoad CALL_PROFILE_CALL(2045, cvxMsgFileLoad)
+#define cvxMsgPtr CALL_PROFILE_CALL(2046, cvxMsgPtr)
+#define cvxMsgDisp CALL_PROFILE_CALL(2047, cvxMsgDisp)
+#define cvxMsgDisp2 CALL_PROFILE_CALL(2048, cvxMsgDisp2)
+#define cvxMessageBox CALL_PROFILE_CALL(2049, cvxMessageBox)
+#define cvxLastErrGet CALL_PROFILE_CALL(2050, cvxLastErrGet)
+#define cvxLastErrSet CALL_PROFILE_CALL(2051, cvxLastErrSet)
+#define cvxErrMsgGet CALL_PROFILE_CALL(2052, cvxErrMsgGet)
+#define ZwMotEntityListGet CALL_PROFILE_CALL(2053, ZwMotEntityListGet)
+#define ZwMotEntityActiveGet CALL_PROFILE_CALL(2054, ZwMotEntityActiveGet)
+#define ZwMotEntityActiveSet CALL_PROFILE_CALL(2055, ZwMotEntityActiveSet)
+#define ZwMotEntityNameGet CALL_PROFILE_CALL(2056, ZwMotEntityNameGet)
+#define ZwMotEntityNameSet CALL_PROFILE_CALL(2057, ZwMotEntityNameSet)
+#define ZwMotEntityDelete CALL_PROFILE_CALL(2058, ZwMotEntityDelete)
+#define ZwMotBodyGet CALL_PROFILE_CALL(2059, ZwMotBodyGet)
+#define ZwMotBodySet CALL_PROFILE_CALL(2060, ZwMotBodySet)
+#define ZwMotBodyMatrixGet CALL_PROFILE_CALL(2061, ZwMotBodyMatrixGet)
+#define ZwMotBodyMatrixSet CALL_PROFILE_CALL(2062, ZwMotBodyMatrixSet)
+#define ZwMotJointTypeGetBySubClass CALL_PROFILE_CALL(2063, ZwMotJointTypeGetBySubClass)
+#define ZwMotJointGet CALL_PROFILE_CALL(2064, ZwMotJointGet)
+#define ZwMotJointFree CALL_PROFILE_CALL(2065, ZwMotJointFree)
+#define ZwMotDriverGet CALL_PROFILE_CALL(2066, ZwMotDriverGet)
+#define ZwMotDriverSet CALL_PROFILE_CALL(2067, ZwMotDriverSet)
+#define ZwMotDriverValidJointCheck CALL_PROFILE_CALL(2068, ZwMotDriverValidJointCheck)
+#define ZwMotDriverCreate CALL_PROFILE_CALL(2069, ZwMotDriverCreate)
+#define ZwMotActiveSolutionGet CALL_PROFILE_CALL(2070, ZwMotActiveSolutionGet)
+#define ZwMotSolutionDegreeOfFreedomGet CALL_PROFILE_CALL(2071, ZwMotSolutionDegreeOfFreedomGet)
+#define ZwMotSolutionGet CALL_PROFILE_CALL(2072, ZwMotSolutionGet)
+#define ZwMotSolutionSet CALL_PROFILE_CALL(2073, ZwMotSolutionSet)
+#define ZwMotSolutionActiveEntityListGet CALL_PROFILE_CALL(2074, ZwMotSolutionActiveEntityListGet)
+#define ZwMotSolutionDriverTimeListGet CALL_PROFILE_CALL(2075, ZwMotSolutionDriverTimeListGet)
+#define ZwMotSolutionDriverTimeListSet CALL_PROFILE_CALL(2076, ZwMotSolutionDriverTimeListSet)
+#define ZwMotSolutionCalculate CALL_PROFILE_CALL(2077, ZwMotSolutionCalculate)
+#define ZwMotSolutionSolveResultGet CALL_PROFILE_CALL(2078, ZwMotSolutionSolveResultGet)
+#define ZwMotSolutionSolveResultFree CALL_PROFILE_CALL(2079, ZwMotSolutionSolveResultFree)
+#define cvxPartMassProp CALL_PROFILE_CALL(2080, cvxPartMassProp)
+#define cvxPartCalcAttrGet CALL_PROFILE_CALL(2081, cvxPartCalcAttrGet)
+#define cvxPartPhyAttrCalc CALL_PROFILE_CALL(2082, cvxPartPhyAttrCalc)
+#define cvxPartVolumAndMassGet CALL_PROFILE_CALL(2083, cvxPartVolumAndMassGet)
+#define cvxPartMaterialGet CALL_PROFILE_CALL(2084, cvxPartMaterialGet)
+#define cvxPartMaterialSet CALL_PROFILE_CALL(2085, cvxPartMaterialSet)
+#define cvxPartMaterialDel CALL_PROFILE_CALL(2086, cvxPartMaterialDel)
+#define cvxPartAtGet CALL_PROFILE_CALL(2087, cvxPartAtGet)
+#define cvxPartAtMod CALL_PROFILE_CALL(2088, cvxPartAtMod)
+#define cvxPartAtSet CALL_PROFILE_CALL(2089, cvxPartAtSet)
+#define cvxPartShowPartAt CALL_PROFILE_CALL(2090, cvxPartShowPartAt)
+#define cvxPartClosePartAt CALL_PROFILE_CALL(2091, cvxPartClosePartAt)
+#define cvxPartAtItemGet CALL_PROFILE_CALL(2092, cvxPartAtItemGet)
+#define cvxPartAtItemSet CALL_PROFILE_CALL(2093, cvxPartAtItemSet)
+#define cvxPartAtItemGetInFile CALL_PROFILE_CALL(2094, cvxPartAtItemGetInFile)
+#define cvxPartAtItemSetInFile CALL_PROFILE_CALL(2095, cvxPartAtItemSetInFile)
+#define cvxPartAtItemDel CALL_PROFILE_CALL(2096, cvxPartAtItemDel)
+#define cvxPartAtItemDesGet CALL_PROFILE_CALL(2097, cvxPartAtItemDesGet)
+#define cvxPartAtItemDesSet CALL_PROFILE_CALL(2098, cvxPartAtItemDesSet)
+#define cvxPartAtItemLockGet CALL_PROFILE_CALL(2099, cvxPartAtItemLockGet)
+#define cvxPartAtItemLockSet CALL_PROFILE_CALL(2100, cvxPartAtItemLockSet)
+#define cvxPartAtItemLockGetInFile CALL_PROFILE_CALL(2101, cvxPartAtItemLockGetInFile)
+#define cvxPartAtItemLockSetInFile CALL_PROFILE_CALL(2102, cvxPartAtItemLockSetInFile)
+#define cvxPartUserAtGet CALL_PROFILE_CALL(2103, cvxPartUserAtGet)
+#define cvxPartUserAtSet CALL_PROFILE_CALL(2104, cvxPartUserAtSet)
+#define cvxPartUserAtExport CALL_PROFILE_CALL(2105, cvxPartUserAtExport)
+#define cvxPartSetCustomStr CALL_PROFILE_CALL(2106, cvxPartSetCustomStr)
+#define cvxPartGetCustomStr CALL_PROFILE_CALL(2107, cvxPartGetCustomStr)
+#define cvxPartCfgTblAdd CALL_PROFILE_CALL(2108, cvxPartCfgTblAdd)
+#define cvxPartCfgActivate CALL_PROFILE_CALL(2109, cvxPartCfgActivate)
+#define cvxPartInqActiveCfg CALL_PROFILE_CALL(2110, cvxPartInqActiveCfg)
+#define cvxPartInqActiveCfgByName CALL_PROFILE_CALL(2111, cvxPartInqActiveCfgByName)
+#define cvxPartInqCfgList CALL_PROFILE_CALL(2112, cvxPartInqCfgList)
+#define cvxPartInqCfgListByName CALL_PROFILE_CALL(2113, cvxPartInqCfgListByName)
+#define cvxCfgTblInfosSet CALL_PROFILE_CALL(2114, cvxCfgTblInfosSet)
+#define cvxPartInqCfgTblInfos CALL_PROFILE_CALL(2115, cvxPartInqCfgTblInfos)
+#define cvxPartInqCfgTblInfosByName CALL_PROFILE_CALL(2116, cvxPartInqCfgTblInfosByName)
+#define cvxPartFreeCfgTbl CALL_PROFILE_CALL(2117, cvxPartFreeCfgTbl)
+#define cvxPartCfgTblAttrSet CALL_PROFILE_CALL(2118, cvxPartCfgTblAttrSet)
+#define cvxPartCfgTblColorSet CALL_PROFILE_CALL(2119, cvxPartCfgTblColorSet)
+#define cvxPartCfgTblInstNameSet CALL_PROFILE_CALL(2120, cvxPartCfgTblInstNameSet)
+#define cvxPartCfgTblVarsSet CALL_PROFILE_CALL(2121, cvxPartCfgTblVarsSet)
+#define cvxPartInqAxis CALL_PROFILE_CALL(2122, cvxPartInqAxis)
+#define cvxAxisInqDir CALL_PROFILE_CALL(2123, cvxAxisInqDir)
+#define cvxAxisGetData CALL_PROFILE_CALL(2124, cvxAxisGetData)
+#define cvxAxisLengthGet CALL_PROFILE_CALL(2125, cvxAxisLengthGet)
+#define cvxAxisLengthSet CALL_PROFILE_CALL(2126, cvxAxisLengthSet)
+#define cvxPlaneGetData CALL_PROFILE_CALL(2127, cvxPlaneGetData)
+#define cvxPartInqCsys CALL_PROFILE_CALL(2128, cvxPartInqCsys)
+#define cvxPartInqDefaultCSYS CALL_PROFILE_CALL(2129, cvxPartInqDefaultCSYS)
+#define cvxPartInqCSYSAxis CALL_PROFILE_CALL(2130, cvxPartInqCSYSAxis)
+#define cvxPartInqCSYSPlane CALL_PROFILE_CALL(2131, cvxPartInqCSYSPlane)
+#define cvxCSYSGetData CALL_PROFILE_CALL(2132, cvxCSYSGetData)
+#define cvxCSYSSetData CALL_PROFILE_CALL(2133, cvxCSYSSetData)
+#define cvxPartInqLCSMat CALL_PROFILE_CALL(2134, cvxPartInqLCSMat)
+#define cvxPartInqDims CALL_PROFILE_CALL(2135, cvxPartInqDims)
+#define cvxPartInqPMIDimEnts CALL_PROFILE_CALL(2136, cvxPartInqPMIDimEnts)
+#define cvxPartInqDimIdxs CALL_PROFILE_CALL(2137, cvxPartInqDimIdxs)
+#define cvxPartInqPMIs CALL_PROFILE_CALL(2138, cvxPartInqPMIs)
+#define cvxPMIInqType CALL_PROFILE_CALL(2139, cvxPMIInqType)
+#define cvxPMIInqBaseEnt CALL_PROFILE_CALL(2140, cvxPMIInqBaseEnt)
+#define cvxPMIInqAssoEnts CALL_PROFILE_CALL(2141, cvxPMIInqAssoEnts)
+#define cvxPMIInqValid CALL_PROFILE_CALL(2142, cvxPMIInqValid)
+#define cvxSymInqRefPnt CALL_PROFILE_CALL(2143, cvxSymInqRefPnt)
+#define cvxSymInqLeadLines CALL_PROFILE_CALL(2144, cvxSymInqLeadLines)
+#define cvxEdgeDiscreteDataFree CALL_PROFILE_CALL(2145, cvxEdgeDiscreteDataFree)
+#define cvxPartPntBlock CALL_PROFILE_CALL(2146, cvxPartPntBlock)
+#define cvxPartFacets CALL_PROFILE_CALL(2147, cvxPartFacets)
+#define cvxPartFacetsBySTL CALL_PROFILE_CALL(2148, cvxPartFacetsBySTL)
+#define cvxPartInqBlocks CALL_PROFILE_CALL(2149, cvxPartInqBlocks)
+#define cvxPartInqBlockPnts CALL_PROFILE_CALL(2150, cvxPartInqBlockPnts)
+#define cvxPartInqBlockType CALL_PROFILE_CALL(2151, cvxPartInqBlockType)
+#define cvxPartInqFacets CALL_PROFILE_CALL(2152, cvxPartInqFacets)
+#define cvxPartInqFacets2 CALL_PROFILE_CALL(2153, cvxPartInqFacets2)
+#define cvxPartInqFacetsTxFile CALL_PROFILE_CALL(2154, cvxPartInqFacetsTxFile)
+#define cvxPartInqFacetsTxFileByLongPath CALL_PROFILE_CALL(2155, cvxPartInqFacetsTxFileByLongPath)
+#define cvxPartFacetsMod CALL_PROFILE_CALL(2156, cvxPartFacetsMod)
+#define cvxPartFacetsSetAt CALL_PROFILE_CALL(2157, cvxPartFacetsSetAt)
+#define cvxPartFacetsSetTx CALL_PROFILE_CALL(2158, cvxPartFacetsSetTx)
+#define cvxPartProjStl CALL_PROFILE_CALL(2159, cvxPartProjStl)
+#define cvxPartInqFaceFacets CALL_PROFILE_CALL(2160, cvxPartInqFaceFacets)
+#define cvxPartInqFaceFacets2 CALL_PROFILE_CALL(2161, cvxPartInqFaceFacets2)
+#define cvxPartInqFaceFacetsByChord CALL_PROFILE_CALL(2162, cvxPartInqFaceFacetsByChord)
+#define cvxPartRefineFacetsInit CALL_PROFILE_CALL(2163, cvxPartRefineFacetsInit)
+#define cvxPartInqFaceFacets2ByTol CALL_PROFILE_CALL(2164, cvxPartInqFaceFacets2ByTol)
+#if defined _WIN64
+#define cvxPartFaceMesh CALL_PROFILE_CALL(2165, cvxPartFaceMesh)
+#define cvxPartFaceMeshPnts CALL_PROFILE_CALL(2166, cvxPartFaceMeshPnts)
+#endif
+#define cvxPartFacetsConvertToSTL CALL_PROFILE_CALL(2167, cvxPartFacetsConvertToSTL)
+#define cvxPartSTLConvertToFacets CALL_PROFILE_CALL(2168, cvxPartSTLConvertToFacets)
+#define cvxFacetsFree CALL_PROFILE_CALL(2169, cvxFacetsFree)
+#define cvxStlFree CALL_PROFILE_CALL(2170, cvxStlFree)
+#define cvxPartEdgeDispData CALL_PROFILE_CALL(2171, cvxPartEdgeDispData)
+#define cvxPartEdgeDispDataFree CALL_PROFILE_CALL(2172, cvxPartEdgeDispDataFree)
+#define cvxPartRegenIsActive CALL_PROFILE_CALL(2173, cvxPartRegenIsActive)
+#define cvxPartRedefineIsActive CALL_PROFILE_CALL(2174, cvxPartRedefineIsActive)
+#define cvxPartRegenFacets CALL_PROFILE_CALL(2175, cvxPartRegenFacets)
+#define cvxPartPartialResults CALL_PROFILE_CALL(2176, cvxPartPartialResults)
+#define cvxPartHistList CALL_PROFILE_CALL(2177, cvxPartHistList)
+#define cvxPartInqFtrList CALL_PROFILE_CALL(2178, cvxPartInqFtrList)
+#define cvxFtrIsSubPart CALL_PROFILE_CALL(2179, cvxFtrIsSubPart)
+#define cvxPartFtrIsMissRef CALL_PROFILE_CALL(2180, cvxPartFtrIsMissRef)
+#define cvxPartInqFtrAssoPart CALL_PROFILE_CALL(2181, cvxPartInqFtrAssoPart)
+#define cvxPartInqFtrAssoPartByLongPath CALL_PROFILE_CALL(2182, cvxPartInqFtrAssoPartByLongPath)
+#define cvxPartInqFtrData CALL_PROFILE_CALL(2183, cvxPartInqFtrData)
+#define cvxPartFtrInqAuxFtrs CALL_PROFILE_CALL(2184, cvxPartFtrInqAuxFtrs)
+#define cvxPartInqFtrTemplate CALL_PROFILE_CALL(2185, cvxPartInqFtrTemplate)
+#define cvxPartInqFtrTol CALL_PROFILE_CALL(2186, cvxPartInqFtrTol)
+#define cvxPartInqFtrRegenStat CALL_PROFILE_CALL(2187, cvxPartInqFtrRegenStat)
+#define cvxPartInqFtrRegenStatus CALL_PROFILE_CALL(2188, cvxPartInqFtrRegenStatus)
+#define cvxPartInqFtrVersion CALL_PROFILE_CALL(2189, cvxPartInqFtrVersion)
+#define cvxPartInqFtrGroup CALL_PROFILE_CALL(2190, cvxPartInqFtrGroup)
+#define cvxPartInqGroupFtrs CALL_PROFILE_CALL(2191, cvxPartInqGroupFtrs)
+#define cvxPartInqGroupList CALL_PROFILE_CALL(2192, cvxPartInqGroupList)
+#define cvxPartInqFtrParentFtrs CALL_PROFILE_CALL(2193, cvxPartInqFtrParentFtrs)
+#define cvxPartInqFtrChildFtrs CALL_PROFILE_CALL(2194, cvxPartInqFtrChildFtrs)
+#define cvxPartFtrInqInpEnts CALL_PROFILE_CALL(2195, cvxPartFtrInqInpEnts)
+#define cvxPartInqFtrEnts CALL_PROFILE_CALL(2196, cvxPartInqFtrEnts)
+#define cvxPartFtrUserAtGet CALL_PROFILE_CALL(2197, cvxPartFtrUserAtGet)
+#define cvxPartFtrUserAtSet CALL_PROFILE_CALL(2198, cvxPartFtrUserAtSet)
+#define cvxPartFtrUserAtDel CALL_PROFILE_CALL(2199, cvxPartFtrUserAtDel)
+#define cvxPartInqHoles CALL_PROFILE_CALL(2200, cvxPartInqHoles)
+#define cvxPartFreeHoles CALL_PROFILE_CALL(2201, cvxPartFreeHoles)
+#define cvxPartInqCurves CALL_PROFILE_CALL(2202, cvxPartInqCurves)
+#define cvxPartInqCrvLists CALL_PROFILE_CALL(2203, cvxPartInqCrvLists)
+#define cvxPartInqCrvList CALL_PROFILE_CALL(2204, cvxPartInqCrvList)
+#define cvxPartInqCurve CALL_PROFILE_CALL(2205, cvxPartInqCurve)
+#define cvxCurveFree CALL_PROFILE_CALL(2206, cvxCurveFree)
+#define cvxPartInqPoints CALL_PROFILE_CALL(2207, cvxPartInqPoints)
+#define cvxPartInqAnnoTexts CALL_PROFILE_CALL(2208, cvxPartInqAnnoTexts)
+#define cvxPartInqTexts CALL_PROFILE_CALL(2209, cvxPartInqTexts)
+#define cvxPartInqConstraints CALL_PROFILE_CALL(2210, cvxPartInqConstraints)
+#define cvxPartInqTempData CALL_PROFILE_CALL(2211, cvxPartInqTempData)
+#define cvxPartInqPublishSets CALL_PROFILE_CALL(2212, cvxPartInqPublishSets)
+#define cvxPartInqPublishSet CALL_PROFILE_CALL(2213, cvxPartInqPublishSet)
+#define cvxPartExit CALL_PROFILE_CALL(2214, cvxPartExit)
+#define cvxPartBackup CALL_PROFILE_CALL(2215, cvxPartBackup)
+#define cvxHistBackup CALL_PROFILE_CALL(2216, cvxHistBackup)
+#define cvxPartEncapsulate CALL_PROFILE_CALL(2217, cvxPartEncapsulate)
+#define cvxPartDefeature CALL_PROFILE_CALL(2218, cvxPartDefeature)
+#define cvxPartHistStart CALL_PROFILE_CALL(2219, cvxPartHistStart)
+#define cvxPartHistEnd CALL_PROFILE_CALL(2220, cvxPartHistEnd)
+#define cvxHistRedefine CALL_PROFILE_CALL(2221, cvxHistRedefine)
+#define cvxHistSkipTo CALL_PROFILE_CALL(2222, cvxHistSkipTo)
+#define cvxPartFtrPlayTo CALL_PROFILE_CALL(2223, cvxPartFtrPlayTo)
+#define cvxPartFtrSuppress CALL_PROFILE_CALL(2224, cvxPartFtrSuppress)
+#define cvxPartHistGroup CALL_PROFILE_CALL(2225, cvxPartHistGroup)
+#define cvxPartHistInqGroup CALL_PROFILE_CALL(2226, cvxPartHistInqGroup)
+#define cvxPartHistPaste CALL_PROFILE_CALL(2227, cvxPartHistPaste)
+#define cvxPartHistClip CALL_PROFILE_CALL(2228, cvxPartHistClip)
+#define cvxPartHistClipbyPath CALL_PROFILE_CALL(2229, cvxPartHistClipbyPath)
+#define cvxPartHistRename CALL_PROFILE_CALL(2230, cvxPartHistRename)
+#define cvxPartHistDel CALL_PROFILE_CALL(2231, cvxPartHistDel)
+#define cvxPartHistDelUtil CALL_PROFILE_CALL(2232, cvxPartHistDelUtil)
+#define cvxPartDelGrpFtr CALL_PROFILE_CALL(2233, cvxPartDelGrpFtr)
+#define cvxPartMkEntExternal CALL_PROFILE_CALL(2234, cvxPartMkEntExternal)
+#define cvxHistDisable CALL_PROFILE_CALL(2235, cvxHistDisable)
+#define cvxHistEnable CALL_PROFILE_CALL(2236, cvxHistEnable)
+#define cvxPartHistAdd CALL_PROFILE_CALL(2237, cvxPartHistAdd)
+#define cvxPartErase CALL_PROFILE_CALL(2238, cvxPartErase)
+#define cvxPartHistScrollTo CALL_PROFILE_CALL(2239, cvxPartHistScrollTo)
+#define cvxPartPublishSetDel CALL_PROFILE_CALL(2240, cvxPartPublishSetDel)
+#define cvxPartQuickDisplayEdit CALL_PROFILE_CALL(2241, cvxPartQuickDisplayEdit)
+#define cvxPartQuickDisplayEditInit CALL_PROFILE_CALL(2242, cvxPartQuickDisplayEditInit)
+#define cvxPartSmdAtGet CALL_PROFILE_CALL(2243, cvxPartSmdAtGet)
+#define cvxPartSmdAtSet CALL_PROFILE_CALL(2244, cvxPartSmdAtSet)
+#define cvxPartInqSmdStatFcs CALL_PROFILE_CALL(2245, cvxPartInqSmdStatFcs)
+#define cvxPartInqSmdStatFace CALL_PROFILE_CALL(2246, cvxPartInqSmdStatFace)
+#define cvxPartInqSmdPairFaces CALL_PROFILE_CALL(2247, cvxPartInqSmdPairFaces)
+#define cvxPartInqSmdSrfType CALL_PROFILE_CALL(2248, cvxPartInqSmdSrfType)
+#define cvxPartInqShtMetalThick CALL_PROFILE_CALL(2249, cvxPartInqShtMetalThick)
+#define cvxPartSmdStatFaceSet CALL_PROFILE_CALL(2250, cvxPartSmdStatFaceSet)
+#define cvxPartGetFlatSolids CALL_PROFILE_CALL(2251, cvxPartGetFlatSolids)
+#define cvxPartInqFlattens CALL_PROFILE_CALL(2252, cvxPartInqFlattens)
+#define cvxPartInqVars CALL_PROFILE_CALL(2253, cvxPartInqVars)
+#define cvxPartInqEqnAllId CALL_PROFILE_CALL(2254, cvxPartInqEqnAllId)
+#define cvxPartVarAdd CALL_PROFILE_CALL(2255, cvxPartVarAdd)
+#define cvxPartVarGet CALL_PROFILE_CALL(2256, cvxPartVarGet)
+#define cvxPartVarGetById CALL_PROFILE_CALL(2257, cvxPartVarGetById)
+#define cvxPartVarSet CALL_PROFILE_CALL(2258, cvxPartVarSet)
+#define cvxPartEqnMoveToEqnSet CALL_PROFILE_CALL(2259, cvxPartEqnMoveToEqnSet)
+#define cvxPartVarAddToEqnSet CALL_PROFILE_CALL(2260, cvxPartVarAddToEqnSet)
+#define cvxPartEqnSet CALL_PROFILE_CALL(2261, cvxPartEqnSet)
+#define cvxPartEqnSetWithName CALL_PROFILE_CALL(2262, cvxPartEqnSetWithName)
+#define cvxPartInqView CALL_PROFILE_CALL(2263, cvxPartInqView)
+#define cvxPartInqViews CALL_PROFILE_CALL(2264, cvxPartInqViews)
+#define cvxPartViewAddInit CALL_PROFILE_CALL(2265, cvxPartViewAddInit)
+#define cvxPartViewAdd CALL_PROFILE_CALL(2266, cvxPartViewAdd)
+#define cvxPartViewRecord CALL_PROFILE_CALL(2267, cvxPartViewRecord)
+#define cvxPartShowAll CALL_PROFILE_CALL(2268, cvxPartShowAll)
+#define cvxPartShowTarg CALL_PROFILE_CALL(2269, cvxPartShowTarg)
+#define cvxPartShowPreview CALL_PROFILE_CALL(2270, cvxPartShowPreview)
+#define cvxPartClosePreview CALL_PROFILE_CALL(2271, cvxPartClosePreview)
+#define ZwPicksetInformationGet CALL_PROFILE_CALL(2272, ZwPicksetInformationGet)
+#define ZwPicksetListGet CALL_PROFILE_CALL(2273, ZwPicksetListGet)
+#define ZwPicksetDelete CALL_PROFILE_CALL(2274, ZwPicksetDelete)
+#define ZwPicksetCreate CALL_PROFILE_CALL(2275, ZwPicksetCreate)
+#define ZwPicksetRename CALL_PROFILE_CALL(2276, ZwPicksetRename)
+#define ZwPicksetEntityAdd CALL_PROFILE_CALL(2277, ZwPicksetEntityAdd)
+#define ZwPicksetEntityDelete CALL_PROFILE_CALL(2278, ZwPicksetEntityDelete)
+#define ZwPMIDimensionLabelCreate CALL_PROFILE_CALL(2279, ZwPMIDimensionLabelCreate)
+#define ZwPMIDimensionFeatureControlCreateByText CALL_PROFILE_CALL(2280, ZwPMIDimensionFeatureControlCreateByText)
+#define ZwFeatureTextBalloonCreate CALL_PROFILE_CALL(2281, ZwFeatureTextBalloonCreate)
+#define ZwPMIDimensionDiscreteDataGet CALL_PROFILE_CALL(2282, ZwPMIDimensionDiscreteDataGet)
+#define ZwPMIDimensionDiscreteDataFree CALL_PROFILE_CALL(2283, ZwPMIDimensionDiscreteDataFree)
+#define ZwPMISymbolDiscreteDataGet CALL_PROFILE_CALL(2284, ZwPMISymbolDiscreteDataGet)
+#define ZwPMISymbolDiscreteDataFree CALL_PROFILE_CALL(2285, ZwPMISymbolDiscreteDataFree)
+#define ZwPMITableDiscreteDataGet CALL_PROFILE_CALL(2286, ZwPMITableDiscreteDataGet)
+#define ZwPMITableDiscreteDataFree CALL_PROFILE_CALL(2287, ZwPMITableDiscreteDataFree)
+#define ZwPMIAligmentPlaneGet CALL_PROFILE_CALL(2288, ZwPMIAligmentPlaneGet)
+#define ZwPMIAttachedViewListGet CALL_PROFILE_CALL(2289, ZwPMIAttachedViewListGet)
+#define ZwPointListGet CALL_PROFILE_CALL(2290, ZwPointListGet)
+#define ZwPointGetByPick CALL_PROFILE_CALL(2291, ZwPointGetByPick)
+#define ZwCursorGet CALL_PROFILE_CALL(2292, ZwCursorGet)
+#define ZwPointTranslateByDistance CALL_PROFILE_CALL(2293, ZwPointTranslateByDistance)
+#define ZwPointPolygonTriangulation CALL_PROFILE_CALL(2294, ZwPointPolygonTriangulation)
+#define ZwPointDistanceGet CALL_PROFILE_CALL(2295, ZwPointDistanceGet)
+#define ZwMathPlanePointDistanceGet CALL_PROFILE_CALL(2296, ZwMathPlanePointDistanceGet)
+#define ZwAxisTransform CALL_PROFILE_CALL(2297, ZwAxisTransform)
+#define ZwAxisProjectionPointGet CALL_PROFILE_CALL(2298, ZwAxisProjectionPointGet)
+#define ZwAxisPointDistanceGet CALL_PROFILE_CALL(2299, ZwAxisPointDistanceGet)
+#define ZwAxisPointGetByDistance CALL_PROFILE_CALL(2300, ZwAxisPointGetByDistance)
+#define ZwMathPlaneGetByPoint CALL_PROFILE_CALL(2301, ZwMathPlaneGetByPoint)
+#define ZwPlaneProjectPointGetByDirection CALL_PROFILE_CALL(2302, ZwPlaneProjectPointGetByDirection)
+#define ZwFacePointGetByBoundingBoxCenter CALL_PROFILE_CALL(2303, ZwFacePointGetByBoundingBoxCenter)
+#define ZwPointOnEntityCheck CALL_PROFILE_CALL(2304, ZwPointOnEntityCheck)
+#define ZwMathPlanePointGetByXYDistance CALL_PROFILE_CALL(2305, ZwMathPlanePointGetByXYDistance)
+#define ZwMathLinerSegmentPoint2Get CALL_PROFILE_CALL(2306, ZwMathLinerSegmentPoint2Get)
+#define ZwMathLinerSegmentPointGet CALL_PROFILE_CALL(2307, ZwMathLinerSegmentPointGet)
+#define ZwPreEdgePointDistanceGet CALL_PROFILE_CALL(2308, ZwPreEdgePointDistanceGet)
+#define ZwPreEdgeDifferentiate CALL_PROFILE_CALL(2309, ZwPreEdgeDifferentiate)
+#define cvxRootActivate CALL_PROFILE_CALL(2310, cvxRootActivate)
+#define cvxRootActivate2 CALL_PROFILE_CALL(2311, cvxRootActivate2)
+#define cvxRootActivateLoadAsmCtx CALL_PROFILE_CALL(2312, cvxRootActivateLoadAsmCtx)
+#define cvxRootAdd CALL_PROFILE_CALL(2313, cvxRootAdd)
+#define cvxRootAdd2 CALL_PROFILE_CALL(2314, cvxRootAdd2)
+#define cvxRootAdd2Bg CALL_PROFILE_CALL(2315, cvxRootAdd2Bg)
+#define cvxRootCopy CALL_PROFILE_CALL(2316, cvxRootCopy)
+#define cvxRootDel CALL_PROFILE_CALL(2317, cvxRootDel)
+#define cvxRootExit CALL_PROFILE_CALL(2318, cvxRootExit)
+#define cvxRootId CALL_PROFILE_CALL(2319, cvxRootId)
+#define cvxRootInqActive CALL_PROFILE_CALL(2320, cvxRootInqActive)
+#define cvxRootInqAsm CALL_PROFILE_CALL(2321, cvxRootInqAsm)
+#define cvxRootInqMod CALL_PROFILE_CALL(2322, cvxRootInqMod)
+#define cvxRootInqModByName CALL_PROFILE_CALL(2323, cvxRootInqModByName)
+#define cvxRootInqModSinceRegen CALL_PROFILE_CALL(2324, cvxRootInqModSinceRegen)
+#define cvxRootInqSymbol CALL_PROFILE_CALL(2325, cvxRootInqSymbol)
+#define cvxRootIsAsm CALL_PROFILE_CALL(2326, cvxRootIsAsm)
+#define cvxRootList CALL_PROFILE_CALL(2327, cvxRootList)
+#define cvxRootPreviewGet CALL_PROFILE_CALL(2328, cvxRootPreviewGet)
+#define cvxRootPreviewSet CALL_PROFILE_CALL(2329, cvxRootPreviewSet)
+#define cvxRootTemplateFile CALL_PROFILE_CALL(2330, cvxRootTemplateFile)
+#define cvxRootRename CALL_PROFILE_CALL(2331, cvxRootRename)
+#define cvxRootRename2 CALL_PROFILE_CALL(2332, cvxRootRename2)
+#define cvxRootRenameMulti CALL_PROFILE_CALL(2333, cvxRootRenameMulti)
+#define cvxRootRenameMultiByLongPath CALL_PROFILE_CALL(2334, cvxRootRenameMultiByLongPath)
+#define cvxRootVarGet CALL_PROFILE_CALL(2335, cvxRootVarGet)
+#define cvxRootVarSet CALL_PROFILE_CALL(2336, cvxRootVarSet)
+#define cvxRootVisibility CALL_PROFILE_CALL(2337, cvxRootVisibility)
+#define cvxRootInqSheetMetal CALL_PROFILE_CALL(2338, cvxRootInqSheetMetal)
+#define cvxRootAtItemGet CALL_PROFILE_CALL(2339, cvxRootAtItemGet)
+#define cvxRootAtItemSet CALL_PROFILE_CALL(2340, cvxRootAtItemSet)
+#define cvxRootCustomDataSet CALL_PROFILE_CALL(2341, cvxRootCustomDataSet)
+#define cvxRootCustomDataGet CALL_PROFILE_CALL(2342, cvxRootCustomDataGet)
+#define cvxRootCustomDataDel CALL_PROFILE_CALL(2343, cvxRootCustomDataDel)
+#define cvxRootCustomDataAdd CALL_PROFILE_CALL(2344, cvxRootCustomDataAdd)
+#define cvxRootInqCustomData CALL_PROFILE_CALL(2345, cvxRootInqCustomData)
+#define cvxRootCustomDataGetAll CALL_PROFILE_CALL(2346, cvxRootCustomDataGetAll)
+#define cvxRootCustomDataGetById CALL_PROFILE_CALL(2347, cvxRootCustomDataGetById)
+#define cvxRootCustomDataModById CALL_PROFILE_CALL(2348, cvxRootCustomDataModById)
+#define cvxRootCustomDataDelById CALL_PROFILE_CALL(2349, cvxRootCustomDataDelById)
+#define cvxRootSeparate CALL_PROFILE_CALL(2350, cvxRootSeparate)
+#define cvxRootSeparateInit CALL_PROFILE_CALL(2351, cvxRootSeparateInit)
+#define ZwShapeListGet CALL_PROFILE_CALL(2352, ZwShapeListGet)
+#define ZwShapeEdgeSewAll CALL_PROFILE_CALL(2353, ZwShapeEdgeSewAll)
+#define ZwShapeFaceListGet CALL_PROFILE_CALL(2354, ZwShapeFaceListGet)
+#define ZwShapeEdgeListGet CALL_PROFILE_CALL(2355, ZwShapeEdgeListGet)
+#define ZwShapeThicknessGet CALL_PROFILE_CALL(2356, ZwShapeThicknessGet)
+#define ZwShapeOpenCheck CALL_PROFILE_CALL(2357, ZwShapeOpenCheck)
+#define ZwShapeInternalAreaGet CALL_PROFILE_CALL(2358, ZwShapeInternalAreaGet)
+#define ZwShapeInterferenceTypeGet CALL_PROFILE_CALL(2359, ZwShapeInterferenceTypeGet)
+#define ZwShapeInterferenceCheck CALL_PROFILE_CALL(2360, ZwShapeInterferenceCheck)
+#define ZwSheetMetalAttributeGet CALL_PROFILE_CALL(2361, ZwSheetMetalAttributeGet)
+#define ZwSheetMetalAttributeSet CALL_PROFILE_CALL(2362, ZwSheetMetalAttributeSet)
+#define ZwBendInformationGet CALL_PROFILE_CALL(2363, ZwBendInformationGet)
+#define ZwSheetMetalFlangeProfileCorrection CALL_PROFILE_CALL(2364, ZwSheetMetalFlangeProfileCorrection)
+#define ZwSheetMetalFaceSideAndThickFind CALL_PROFILE_CALL(2365, ZwSheetMetalFaceSideAndThickFind)
+#define ZwSheetMetalFaceSideAndThickFree CALL_PROFILE_CALL(2366, ZwSheetMetalFaceSideAndThickFree)
+#define ZwSheetMetalFlangeInterferenceCheck CALL_PROFILE_CALL(2367, ZwSheetMetalFlangeInterferenceCheck)
+#define ZwSheetMetalFoldStateGet CALL_PROFILE_CALL(2368, ZwSheetMetalFoldStateGet)
+#define ZwSketch3DCurveListGet CALL_PROFILE_CALL(2369, ZwSketch3DCurveListGet)
+#define cvxSkInqDim CALL_PROFILE_CALL(2370, cvxSkInqDim)
+#define cvxSkInqDimType CALL_PROFILE_CALL(2371, cvxSkInqDimType)
+#define cvxSkInqDimRefFlag CALL_PROFILE_CALL(2372, cvxSkInqDimRefFlag)
+#define cvxSkInqPlane CALL_PROFILE_CALL(2373, cvxSkInqPlane)
+#define cvxSkInqPlanes CALL_PROFILE_CALL(2374, cvxSkInqPlanes)
+#define cvxSkIsCosmetic CALL_PROFILE_CALL(2375, cvxSkIsCosmetic)
+#define cvxSkIsExternal CALL_PROFILE_CALL(2376, cvxSkIsExternal)
+#define cvxSkInqExternalSk CALL_PROFILE_CALL(2377, cvxSkInqExternalSk)
+#define cvxSkInqExternalSkByLongPath CALL_PROFILE_CALL(2378, cvxSkInqExternalSkByLongPath)
+#define cvxSkInqArea CALL_PROFILE_CALL(2379, cvxSkInqArea)
+#define cvxSkInqOverlap CALL_PROFILE_CALL(2380, cvxSkInqOverlap)
+#define cvxSkActivate CALL_PROFILE_CALL(2381, cvxSkActivate)
+#define cvxSkInqAxis CALL_PROFILE_CALL(2382, cvxSkInqAxis)
+#define cvxSkInqAllAxis CALL_PROFILE_CALL(2383, cvxSkInqAllAxis)
+#define cvxSkInqAllAxisById CALL_PROFILE_CALL(2384, cvxSkInqAllAxisById)
+#define cvxSkInqAxisDir CALL_PROFILE_CALL(2385, cvxSkInqAxisDir)
+#define cvxSkInqGeom CALL_PROFILE_CALL(2386, cvxSkInqGeom)
+#define cvxSkInqGeomById CALL_PROFILE_CALL(2387, cvxSkInqGeomById)
+#define cvxSkInqGeomX CALL_PROFILE_CALL(2388, cvxSkInqGeomX)
+#define cvxSkInqGeomXById CALL_PROFILE_CALL(2389, cvxSkInqGeomXById)
+#define cvxSkInqPnt CALL_PROFILE_CALL(2390, cvxSkInqPnt)
+#define cvxSkInqPntById CALL_PROFILE_CALL(2391, cvxSkInqPntById)
+#define cvxSkInqRef CALL_PROFILE_CALL(2392, cvxSkInqRef)
+#define cvxSkInqRefById CALL_PROFILE_CALL(2393, cvxSkInqRefById)
+#define cvxSkInqText CALL_PROFILE_CALL(2394, cvxSkInqText)
+#define cvxSkInqTextById CALL_PROFILE_CALL(2395, cvxSkInqTextById)
+#define cvxSkInqCns CALL_PROFILE_CALL(2396, cvxSkInqCns)
+#define cvxSkInqCnsById CALL_PROFILE_CALL(2397, cvxSkInqCnsById)
+#define cvxSkInqCrvConnect CALL_PROFILE_CALL(2398, cvxSkInqCrvConnect)
+#define cvxSkEntWireType CALL_PROFILE_CALL(2399, cvxSkEntWireType)
+#define cvxSkSetWireType CALL_PROFILE_CALL(2400, cvxSkSetWireType)
+#define cvxSkInqReadyText CALL_PROFILE_CALL(2401, cvxSkInqReadyText)
+#define cvxSkReadyTextInqCrvs CALL_PROFILE_CALL(2402, cvxSkReadyTextInqCrvs)
+#define cvxSkReadyTextInqText CALL_PROFILE_CALL(2403, cvxSkReadyTextInqText)
+#define cvxSkReadyTextModText CALL_PROFILE_CALL(2404, cvxSkReadyTextModText)
+#define cvxReadyTextFree CALL_PROFILE_CALL(2405, cvxReadyTextFree)
+#define cvxSkInqBlockReferences CALL_PROFILE_CALL(2406, cvxSkInqBlockReferences)
+#define cvxSkInqSketchBlocks CALL_PROFILE_CALL(2407, cvxSkInqSketchBlocks)
+#define cvxSkBlockActivate CALL_PROFILE_CALL(2408, cvxSkBlockActivate)
+#define cvxSkBlockGetSketch CALL_PROFILE_CALL(2409, cvxSkBlockGetSketch)
+#define cvxSkBlockRefGetDefinition CALL_PROFILE_CALL(2410, cvxSkBlockRefGetDefinition)
+#define cvxSkBlockInqGeom CALL_PROFILE_CALL(2411, cvxSkBlockInqGeom)
+#define cvxSkBlockInqPnt CALL_PROFILE_CALL(2412, cvxSkBlockInqPnt)
+#define cvxSkBlockInqDim CALL_PROFILE_CALL(2413, cvxSkBlockInqDim)
+#define cvxSkBlockInqGeomX CALL_PROFILE_CALL(2414, cvxSkBlockInqGeomX)
+#define cvxSkBlockInqRefs CALL_PROFILE_CALL(2415, cvxSkBlockInqRefs)
+#define cvxSkInqCnsType CALL_PROFILE_CALL(2416, cvxSkInqCnsType)
+#define cvxSkInqCnsGeoms CALL_PROFILE_CALL(2417, cvxSkInqCnsGeoms)
+#define cvxSkRegen CALL_PROFILE_CALL(2418, cvxSkRegen)
+#define cvxSkVarAdd CALL_PROFILE_CALL(2419, cvxSkVarAdd)
+#define cvxSkVarGet CALL_PROFILE_CALL(2420, cvxSkVarGet)
+#define cvxSkVarSet CALL_PROFILE_CALL(2421, cvxSkVarSet)
+#define cvxSkInqVars CALL_PROFILE_CALL(2422, cvxSkInqVars)
+#define ZwSketchConstraintSolve CALL_PROFILE_CALL(2423, ZwSketchConstraintSolve)
+#define ZwSketchConstraintStatusGet CALL_PROFILE_CALL(2424, ZwSketchConstraintStatusGet)
+#define ZwSketchConstraintStatusDataFree CALL_PROFILE_CALL(2425, ZwSketchConstraintStatusDataFree)
+#define ZwSketchGeometryConstraintListGet CALL_PROFILE_CALL(2426, ZwSketchGeometryConstraintListGet)
+#define ZwSketchPatternConstraintDataGet CALL_PROFILE_CALL(2427, ZwSketchPatternConstraintDataGet)
+#define ZwSketchLinearDimensionCreate CALL_PROFILE_CALL(2428, ZwSketchLinearDimensionCreate)
+#define ZwSketchLinearOffsetDimensionCreate CALL_PROFILE_CALL(2429, ZwSketchLinearOffsetDimensionCreate)
+#define ZwSketchAngularDimensionCreate CALL_PROFILE_CALL(2430, ZwSketchAngularDimensionCreate)
+#define ZwSketchRadialDimensionCreate CALL_PROFILE_CALL(2431, ZwSketchRadialDimensionCreate)
+#define ZwSketchArcLengthDimensionCreate CALL_PROFILE_CALL(2432, ZwSketchArcLengthDimensionCreate)
+#define ZwSketchSymmetryDimensionCreate CALL_PROFILE_CALL(2433, ZwSketchSymmetryDimensionCreate)
+#define ZwSketchPerimeterDimensionCreate CALL_PROFILE_CALL(2434, ZwSketchPerimeterDimensionCreate)
+#define ZwSketchDimensionListGet CALL_PROFILE_CALL(2435, ZwSketchDimensionListGet)
+#define ZwSketchDimensionGeometryListGet CALL_PROFILE_CALL(2436, ZwSketchDimensionGeometryListGet)
+#define ZwSketchGeometryDimensionListGet CALL_PROFILE_CALL(2437, ZwSketchGeometryDimensionListGet)
+#define ZwSketchDimensionTypeGet CALL_PROFILE_CALL(2438, ZwSketchDimensionTypeGet)
+#define ZwSketchDimensionPointGet CALL_PROFILE_CALL(2439, ZwSketchDimensionPointGet)
+#define ZwSketchDimensionWeakCheck CALL_PROFILE_CALL(2440, ZwSketchDimensionWeakCheck)
+#define ZwSketchDimensionReferenceStateGet CALL_PROFILE_CALL(2441, ZwSketchDimensionReferenceStateGet)
+#define ZwSketchDimensionReferenceStateSet CALL_PROFILE_CALL(2442, ZwSketchDimensionReferenceStateSet)
+#define ZwSketchSymbolImageCreate CALL_PROFILE_CALL(2443, ZwSketchSymbolImageCreate)
+#define ZwSketchSymbolImageListGet CALL_PROFILE_CALL(2444, ZwSketchSymbolImageListGet)
+#define ZwSketchSymbolImageInit CALL_PROFILE_CALL(2445, ZwSketchSymbolImageInit)
+#define ZwSketchListGet CALL_PROFILE_CALL(2446, ZwSketchListGet)
+#define ZwSketchCreateByMatrix CALL_PROFILE_CALL(2447, ZwSketchCreateByMatrix)
+#define ZwSketchCreateByDataInit CALL_PROFILE_CALL(2448, ZwSketchCreateByDataInit)
+#define ZwSketchCreateByData CALL_PROFILE_CALL(2449, ZwSketchCreateByData)
+#define ZwSketchActivate CALL_PROFILE_CALL(2450, ZwSketchActivate)
+#define ZwSketchCancel CALL_PROFILE_CALL(2451, ZwSketchCancel)
+#define ZwSketch2DCurveListGet CALL_PROFILE_CALL(2452, ZwSketch2DCurveListGet)
+#define ZwSketchTextListGet CALL_PROFILE_CALL(2453, ZwSketchTextListGet)
+#define ZwSketchGeneralTableListGet CALL_PROFILE_CALL(2454, ZwSketchGeneralTableListGet)
+#define ZwSketchArcCreateByThreePointsInit CALL_PROFILE_CALL(2455, ZwSketchArcCreateByThreePointsInit)
+#define ZwSketchArcCreateByThreePoints CALL_PROFILE_CALL(2456, ZwSketchArcCreateByThreePoints)
+#define ZwSketchCircleCreateByRadiusInit CALL_PROFILE_CALL(2457, ZwSketchCircleCreateByRadiusInit)
+#define ZwSketchCircleCreateByRadius CALL_PROFILE_CALL(2458, ZwSketchCircleCreateByRadius)
+#define ZwSketchLineCreateBy2DPoints CALL_PROFILE_CALL(2459, ZwSketchLineCreateBy2DPoints)
+#define ZwSketchReadyTextCreateInit CALL_PROFILE_CALL(2460, ZwSketchReadyTextCreateInit)
+#define ZwSketchReadyTextCreate CALL_PROFILE_CALL(2461, ZwSketchReadyTextCreate)
+#define ZwReadyTextDataFree CALL_PROFILE_CALL(2462, ZwReadyTextDataFree)
+#define ZwSketchReadyTextDataGet CALL_PROFILE_CALL(2463, ZwSketchReadyTextDataGet)
+#define ZwSketchReadyTextOutlineListGet CALL_PROFILE_CALL(2464, ZwSketchReadyTextOutlineListGet)
+#define ZwUserTableCreateByRowAndColumn CALL_PROFILE_CALL(2465, ZwUserTableCreateByRowAndColumn)
+#define ZwUserTableCreateByTemplate CALL_PROFILE_CALL(2466, ZwUserTableCreateByTemplate)
+#define ZwTableInsert CALL_PROFILE_CALL(2467, ZwTableInsert)
+#define ZwTableRowCountGet CALL_PROFILE_CALL(2468, ZwTableRowCountGet)
+#define ZwTableColumnCountGet CALL_PROFILE_CALL(2469, ZwTableColumnCountGet)
+#define ZwTableRowInsert CALL_PROFILE_CALL(2470, ZwTableRowInsert)
+#define ZwTableColumnInsert CALL_PROFILE_CALL(2471, ZwTableColumnInsert)
+#define ZwTableRowDelete CALL_PROFILE_CALL(2472, ZwTableRowDelete)
+#define ZwTableColumnDelete CALL_PROFILE_CALL(2473, ZwTableColumnDelete)
+#define ZwTableCellTextGet CALL_PROFILE_CALL(2474, ZwTableCellTextGet)
+#define ZwTableCellTextSet CALL_PROFILE_CALL(2475, ZwTableCellTextSet)
+#define ZwTableCellDataTypeGet CALL_PROFILE_CALL(2476, ZwTableCellDataTypeGet)
+#define ZwTableCellDataTypeSet CALL_PROFILE_CALL(2477, ZwTableCellDataTypeSet)
+#define ZwTableRowHeightGet CALL_PROFILE_CALL(2478, ZwTableRowHeightGet)
+#define ZwTableRowHeightSet CALL_PROFILE_CALL(2479, ZwTableRowHeightSet)
+#define ZwTableColumnWidthGet CALL_PROFILE_CALL(2480, ZwTableColumnWidthGet)
+#define ZwTableColumnWidthSet CALL_PROFILE_CALL(2481, ZwTableColumnWidthSet)
+#define ZwTableCellMerge CALL_PROFILE_CALL(2482, ZwTableCellMerge)
+#define ZwTableCellUnMerge CALL_PROFILE_CALL(2483, ZwTableCellUnMerge)
+#define ZwTableCellAttributeGet CALL_PROFILE_CALL(2484, ZwTableCellAttributeGet)
+#define ZwTableCellAttributeSet CALL_PROFILE_CALL(2485, ZwTableCellAttributeSet)
+#define ZwTableAttributeGet CALL_PROFILE_CALL(2486, ZwTableAttributeGet)
+#define ZwTableAttributeSet CALL_PROFILE_CALL(2487, ZwTableAttributeSet)
+#define ZwCommandParameterEntityAdd CALL_PROFILE_CALL(2488, ZwCommandParameterEntityAdd)
+#define ZwCommandParameterDirectionSet CALL_PROFILE_CALL(2489, ZwCommandParameterDirectionSet)
+#define ZwTemplateCommandOptionsGet CALL_PROFILE_CALL(2490, ZwTemplateCommandOptionsGet)
+#define ZwTemplateCommandOptionsSet CALL_PROFILE_CALL(2491, ZwTemplateCommandOptionsSet)
+#define ZwTemplateCommandListModeGet CALL_PROFILE_CALL(2492, ZwTemplateCommandListModeGet)
+#define ZwTemplateCommandListModeSet CALL_PROFILE_CALL(2493, ZwTemplateCommandListModeSet)
+#define cvxEntTextInq CALL_PROFILE_CALL(2494, cvxEntTextInq)
+#define cvxEntTextMod CALL_PROFILE_CALL(2495, cvxEntTextMod)
+#define cvxEntTextAtGet CALL_PROFILE_CALL(2496, cvxEntTextAtGet)
+#define cvxEntTextAtSet CALL_PROFILE_CALL(2497, cvxEntTextAtSet)
+#define cvxEntTextLocGet CALL_PROFILE_CALL(2498, cvxEntTextLocGet)
+#define cvxEntPathInit CALL_PROFILE_CALL(2499, cvxEntPathInit)
+#define cvxEntPathInqActive CALL_PROFILE_CALL(2500, cvxEntPathInqActive)
+#define cvxEntPathAppendEnt CALL_PROFILE_CALL(2501, cvxEntPathAppendEnt)
+#define cvxEntPathAppendPath CALL_PROFILE_CALL(2502, cvxEntPathAppendPath)
+#define cvxEntPathToRoot CALL_PROFILE_CALL(2503, cvxEntPathToRoot)
+#define cvxEntPathCmp CALL_PROFILE_CALL(2504, cvxEntPathCmp)
+#define cvxEntPathGetParentComp CALL_PROFILE_CALL(2505, cvxEntPathGetParentComp)
+#define cvxComboCurrentItem CALL_PROFILE_CALL(2506, cvxComboCurrentItem)
+#define cvxComboSetCurrentItem CALL_PROFILE_CALL(2507, cvxComboSetCurrentItem)
+#define cvxComboCurrentText CALL_PROFILE_CALL(2508, cvxComboCurrentText)
+#define cvxComboCurrentTextSet CALL_PROFILE_CALL(2509, cvxComboCurrentTextSet)
+#define cvxComboItemCount CALL_PROFILE_CALL(2510, cvxComboItemCount)
+#define ZwUiCommandTextGet CALL_PROFILE_CALL(2511, ZwUiCommandTextGet)
+#define ZwUiCommandTextSet CALL_PROFILE_CALL(2512, ZwUiCommandTextSet)
+#define ZwUiCommandIconGet CALL_PROFILE_CALL(2513, ZwUiCommandIconGet)
+#define ZwUiCommandIconSet CALL_PROFILE_CALL(2514, ZwUiCommandIconSet)
+#define ZwUiCommandStateGet CALL_PROFILE_CALL(2515, ZwUiCommandStateGet)
+#define ZwUiCommandStateSet CALL_PROFILE_CALL(2516, ZwUiCommandStateSet)
+#define ZwUiDrawbackBoxGroupFold CALL_PROFILE_CALL(2517, ZwUiDrawbackBoxGroupFold)
+#define ZwUiFileDialogHide CALL_PROFILE_CALL(2518, ZwUiFileDialogHide)
+#define ZwUiFileDialogUnHide CALL_PROFILE_CALL(2519, ZwUiFileDialogUnHide)
+#define cvxFormCreate CALL_PROFILE_CALL(2520, cvxFormCreate)
+#define cvxFormShow CALL_PROFILE_CALL(2521, cvxFormShow)
+#define cvxFormHide CALL_PROFILE_CALL(2522, cvxFormHide)
+#define cvxFormKill CALL_PROFILE_CALL(2523, cvxFormKill)
+#define cvxFormLogKill CALL_PROFILE_CALL(2524, cvxFormLogKill)
+#define cvxFormRefresh CALL_PROFILE_CALL(2525, cvxFormRefresh)
+#define cvxFormWait CALL_PROFILE_CALL(2526, cvxFormWait)
+#define cvxFormWaitExit CALL_PROFILE_CALL(2527, cvxFormWaitExit)
+#define cvxFormGetSize CALL_PROFILE_CALL(2528, cvxFormGetSize)
+#define cvxFormResize CALL_PROFILE_CALL(2529, cvxFormResize)
+#define cvxFormAdjustSize CALL_PROFILE_CALL(2530, cvxFormAdjustSize)
+#define cvxFormAddTo CALL_PROFILE_CALL(2531, cvxFormAddTo)
+#define cvxFormInsertTo CALL_PROFILE_CALL(2532, cvxFormInsertTo)
+#define cvxFormRemoveFrom CALL_PROFILE_CALL(2533, cvxFormRemoveFrom)
+#define cvxFormTitleGet CALL_PROFILE_CALL(2534, cvxFormTitleGet)
+#define cvxFormTitleSet CALL_PROFILE_CALL(2535, cvxFormTitleSet)
+#define cvxFormDataGet CALL_PROFILE_CALL(2536, cvxFormDataGet)
+#define cvxFormDataSet CALL_PROFILE_CALL(2537, cvxFormDataSet)
+#define cvxFormFunc CALL_PROFILE_CALL(2538, cvxFormFunc)
+#define cvxFormCallback CALL_PROFILE_CALL(2539, cvxFormCallback)
+#define cvxFormFieldGetCallback CALL_PROFILE_CALL(2540, cvxFormFieldGetCallback)
+#define cvxFormActiveField CALL_PROFILE_CALL(2541, cvxFormActiveField)
+#define cvxFormState CALL_PROFILE_CALL(2542, cvxFormState)
+#define cvxFormVisibleSet CALL_PROFILE_CALL(2543, cvxFormVisibleSet)
+#define cvxFormFieldVisSet CALL_PROFILE_CALL(2544, cvxFormFieldVisSet)
+#define cvxFormInqFld CALL_PROFILE_CALL(2545, cvxFormInqFld)
+#define cvxTplInqFields CALL_PROFILE_CALL(2546, cvxTplInqFields)
+#define cvxTplInqFieldType CALL_PROFILE_CALL(2547, cvxTplInqFieldType)
+#define cvxTplInqFieldOptions CALL_PROFILE_CALL(2548, cvxTplInqFieldOptions)
+#define cvxFormUpdate CALL_PROFILE_CALL(2549, cvxFormUpdate)
+#define cvxFieldFocusSet CALL_PROFILE_CALL(2550, cvxFieldFocusSet)
+#define cvxFieldNumItems CALL_PROFILE_CALL(2551, cvxFieldNumItems)
+#define cvxFieldClear CALL_PROFILE_CALL(2552, cvxFieldClear)
+#define cvxFieldDisable CALL_PROFILE_CALL(2553, cvxFieldDisable)
+#define cvxFieldEnable CALL_PROFILE_CALL(2554, cvxFieldEnable)
+#define cvxFieldEnableGet CALL_PROFILE_CALL(2555, cvxFieldEnableGet)
+#define cvxFilterItemApply CALL_PROFILE_CALL(2556, cvxFilterItemApply)
+#define cvxFieldImageSet CALL_PROFILE_CALL(2557, cvxFieldImageSet)
+#define cvxFieldCaretSet CALL_PROFILE_CALL(2558, cvxFieldCaretSet)
+#define cvxFieldTipSet CALL_PROFILE_CALL(2559, cvxFieldTipSet)
+#define cvxFieldInitFont CALL_PROFILE_CALL(2560, cvxFieldInitFont)
+#define cvxItemAdd CALL_PROFILE_CALL(2561, cvxItemAdd)
+#define cvxItemGet CALL_PROFILE_CALL(2562, cvxItemGet)
+#define cvxItemSet CALL_PROFILE_CALL(2563, cvxItemSet)
+#define cvxItemModify CALL_PROFILE_CALL(2564, cvxItemModify)
+#define cvxItemDel CALL_PROFILE_CALL(2565, cvxItemDel)
+#define cvxItemFind CALL_PROFILE_CALL(2566, cvxItemFind)
+#define cvxItemCbxSet CALL_PROFILE_CALL(2567, cvxItemCbxSet)
+#define cvxItemSelect CALL_PROFILE_CALL(2568, cvxItemSelect)
+#define cvxItemSelectText CALL_PROFILE_CALL(2569, cvxItemSelectText)
+#define cvxItemSelected CALL_PROFILE_CALL(2570, cvxItemSelected)
+#define cvxItemStateGet CALL_PROFILE_CALL(2571, cvxItemStateGet)
+#define cvxItemStateSet CALL_PROFILE_CALL(2572, cvxItemStateSet)
+#define cvxItemGetCheckState CALL_PROFILE_CALL(2573, cvxItemGetCheckState)
+#define cvxItemVisibleSet CALL_PROFILE_CALL(2574, cvxItemVisibleSet)
+#define cvxItemVisibleGet CALL_PROFILE_CALL(2575, cvxItemVisibleGet)
+#define ZwUiFormItemGet CALL_PROFILE_CALL(2576, ZwUiFormItemGet)
+#define ZwUiFormItemSet CALL_PROFILE_CALL(2577, ZwUiFormItemSet)
+#define ZwUiFormImageSet CALL_PROFILE_CALL(2578, ZwUiFormImageSet)
+#define ZwUiFormFocusGet CALL_PROFILE_CALL(2579, ZwUiFormFocusGet)
+#define ZwUiFormFocusSet CALL_PROFILE_CALL(2580, ZwUiFormFocusSet)
+#define ZwUiFormPositionSet CALL_PROFILE_CALL(2581, ZwUiFormPositionSet)
+#define cvxUiSettingsCount CALL_PROFILE_CALL(2582, cvxUiSettingsCount)
+#define cvxUiSettingsCreate CALL_PROFILE_CALL(2583, cvxUiSettingsCreate)
+#define cvxUiSettingsRename CALL_PROFILE_CALL(2584, cvxUiSettingsRename)
+#define cvxUiSettingsRemove CALL_PROFILE_CALL(2585, cvxUiSettingsRemove)
+#define cvxUiSettingsImport CALL_PROFILE_CALL(2586, cvxUiSettingsImport)
+#define cvxUiSettingsExport CALL_PROFILE_CALL(2587, cvxUiSettingsExport)
+#define cvxUiSettingsExists CALL_PROFILE_CALL(2588, cvxUiSettingsExists)
+#define cvxUiSettingsApply CALL_PROFILE_CALL(2589, cvxUiSettingsApply)
+#define cvxUiSettingsReset CALL_PROFILE_CALL(2590, cvxUiSettingsReset)
+#define cvxUiSettingsFetch CALL_PROFILE_CALL(2591, cvxUiSettingsFetch)
+#define cvxCursorSet CALL_PROFILE_CALL(2592, cvxCursorSet)
+#define cvxCursorRestore CALL_PROFILE_CALL(2593, cvxCursorRestore)
+#define cvxProgress CALL_PROFILE_CALL(2594, cvxProgress)
+#define cvxListCallbackParamGet CALL_PROFILE_CALL(2595, cvxListCallbackParamGet)
+#define cvxListItemToolTipSet CALL_PROFILE_CALL(2596, cvxListItemToolTipSet)
+#define cvxListItemToolTipGet CALL_PROFILE_CALL(2597, cvxListItemToolTipGet)
+#define ZwUiListWidgetIconSet CALL_PROFILE_CALL(2598, ZwUiListWidgetIconSet)
+#define cvxPopupShow CALL_PROFILE_CALL(2599, cvxPopupShow)
+#define cvxPopupDefine CALL_PROFILE_CALL(2600, cvxPopupDefine)
+#define cvxPopupUpdate CALL_PROFILE_CALL(2601, cvxPopupUpdate)
+#define cvxPopupSetVisible CALL_PROFILE_CALL(2602, cvxPopupSetVisible)
+#define cvxPopupMenuCnt CALL_PROFILE_CALL(2603, cvxPopupMenuCnt)
+#define cvxPopupSubMenuCnt CALL_PROFILE_CALL(2604, cvxPopupSubMenuCnt)
+#define cvxPopupSubMenuItemInsert CALL_PROFILE_CALL(2605, cvxPopupSubMenuItemInsert)
+#define cvxPopupSubMenuItemRemove CALL_PROFILE_CALL(2606, cvxPopupSubMenuItemRemove)
+#define cvxPopupSubMenuActionsRemove CALL_PROFILE_CALL(2607, cvxPopupSubMenuActionsRemove)
+#define cvxPopupSubMenuSeparatorInsert CALL_PROFILE_CALL(2608, cvxPopupSubMenuSeparatorInsert)
+#define cvxPopupSubMenuSetVisible CALL_PROFILE_CALL(2609, cvxPopupSubMenuSetVisible)
+#define cvxPopupItemIsExist CALL_PROFILE_CALL(2610, cvxPopupItemIsExist)
+#define cvxPopupItemInsert CALL_PROFILE_CALL(2611, cvxPopupItemInsert)
+#define cvxPopupItemRemove CALL_PROFILE_CALL(2612, cvxPopupItemRemove)
+#define cvxPopupItemActionGet CALL_PROFILE_CALL(2613, cvxPopupItemActionGet)
+#define cvxPopupItemSetAction CALL_PROFILE_CALL(2614, cvxPopupItemSetAction)
+#define cvxPopupItemLabelGet CALL_PROFILE_CALL(2615, cvxPopupItemLabelGet)
+#define cvxPopupItemCheckedGet CALL_PROFILE_CALL(2616, cvxPopupItemCheckedGet)
+#define cvxPopupItemVisibleGet CALL_PROFILE_CALL(2617, cvxPopupItemVisibleGet)
+#define cvxPopupItemSetVisibleByAction CALL_PROFILE_CALL(2618, cvxPopupItemSetVisibleByAction)
+#define cvxPopupItemSetEnabledByAction CALL_PROFILE_CALL(2619, cvxPopupItemSetEnabledByAction)
+#define cvxPopupItemSetCheckedByAction CALL_PROFILE_CALL(2620, cvxPopupItemSetCheckedByAction)
+#define ZwUiPopupSubMenuItemInsert CALL_PROFILE_CALL(2621, ZwUiPopupSubMenuItemInsert)
+#define ZwUiPopupItemInsert CALL_PROFILE_CALL(2622, ZwUiPopupItemInsert)
+#define cvxRibbonSetStatus CALL_PROFILE_CALL(2623, cvxRibbonSetStatus)
+#define cvxSetTitleAppend CALL_PROFILE_CALL(2624, cvxSetTitleAppend)
+#define ZwUiRibbonPageVisibleSet CALL_PROFILE_CALL(2625, ZwUiRibbonPageVisibleSet)
+#define ZwUiRibbonPageVisibleGet CALL_PROFILE_CALL(2626, ZwUiRibbonPageVisibleGet)
+#define cvxSliderLimitGet CALL_PROFILE_CALL(2627, cvxSliderLimitGet)
+#define cvxSliderLimitSet CALL_PROFILE_CALL(2628, cvxSliderLimitSet)
+#define cvxTableAtSetInit CALL_PROFILE_CALL(2629, cvxTableAtSetInit)
+#define cvxTableAtSet CALL_PROFILE_CALL(2630, cvxTableAtSet)
+#define cvxTableSizeSet CALL_PROFILE_CALL(2631, cvxTableSizeSet)
+#define cvxTableSetSelRange CALL_PROFILE_CALL(2632, cvxTableSetSelRange)
+#define cvxTableGetSelRange CALL_PROFILE_CALL(2633, cvxTableGetSelRange)
+#define cvxTableUnselectAll CALL_PROFILE_CALL(2634, cvxTableUnselectAll)
+#define cvxTableCallBackParamGet CALL_PROFILE_CALL(2635, cvxTableCallBackParamGet)
+#define cvxTableCallBackParamFree CALL_PROFILE_CALL(2636, cvxTableCallBackParamFree)
+#define cvxTableRowCnt CALL_PROFILE_CALL(2637, cvxTableRowCnt)
+#define cvxTableColCnt CALL_PROFILE_CALL(2638, cvxTableColCnt)
+#define cvxTableRowInsert CALL_PROFILE_CALL(2639, cvxTableRowInsert)
+#define cvxTableRowRemove CALL_PROFILE_CALL(2640, cvxTableRowRemove)
+#define cvxTableColInsert CALL_PROFILE_CALL(2641, cvxTableColInsert)
+#define cvxTableColRemove CALL_PROFILE_CALL(2642, cvxTableColRemove)
+#define cvxTableComboSet CALL_PROFILE_CALL(2643, cvxTableComboSet)
+#define cvxTableComboSet2 CALL_PROFILE_CALL(2644, cvxTableComboSet2)
+#define cvxTableComboGet CALL_PROFILE_CALL(2645, cvxTableComboGet)
+#define cvxTableIndexComboSet CALL_PROFILE_CALL(2646, cvxTableIndexComboSet)
+#define cvxTableInputComboSet CALL_PROFILE_CALL(2647, cvxTableInputComboSet)
+#define cvxTableIndexComboSet2 CALL_PROFILE_CALL(2648, cvxTableIndexComboSet2)
+#define cvxTableInputComboSet2 CALL_PROFILE_CALL(2649, cvxTableInputComboSet2)
+#define cvxTableComboSetOption CALL_PROFILE_CALL(2650, cvxTableComboSetOption)
+#define cvxTableTypeGet CALL_PROFILE_CALL(2651, cvxTableTypeGet)
+#define cvxTableVisSet CALL_PROFILE_CALL(2652, cvxTableVisSet)
+#define cvxTableIsCheck CALL_PROFILE_CALL(2653, cvxTableIsCheck)
+#define cvxTableCheckSet CALL_PROFILE_CALL(2654, cvxTableCheckSet)
+#define cvxTableCellTextGet CALL_PROFILE_CALL(2655, cvxTableCellTextGet)
+#define cvxTableCellEnableSet CALL_PROFILE_CALL(2656, cvxTableCellEnableSet)
+#define cvxTableCellTipSet CALL_PROFILE_CALL(2657, cvxTableCellTipSet)
+#define cvxTableCellTipGet CALL_PROFILE_CALL(2658, cvxTableCellTipGet)
+#define cvxTableCellTextSet CALL_PROFILE_CALL(2659, cvxTableCellTextSet)
+#define cvxTableCellTextSet2 CALL_PROFILE_CALL(2660, cvxTableCellTextSet2)
+#define cvxTableDateSet CALL_PROFILE_CALL(2661, cvxTableDateSet)
+#define cvxTableDateGet CALL_PROFILE_CALL(2662, cvxTableDateGet)
+#define cvxTableColorSet CALL_PROFILE_CALL(2663, cvxTableColorSet)
+#define cvxTableColorGet CALL_PROFILE_CALL(2664, cvxTableColorGet)
+#define cvxTableNumSet CALL_PROFILE_CALL(2665, cvxTableNumSet)
+#define cvxTableNumGet CALL_PROFILE_CALL(2666, cvxTableNumGet)
+#define cvxTableGetText CALL_PROFILE_CALL(2667, cvxTableGetText)
+#define cvxTableHorHeaderVisibleSet CALL_PROFILE_CALL(2668, cvxTableHorHeaderVisibleSet)
+#define cvxTableVerHeaderVisibleSet CALL_PROFILE_CALL(2669, cvxTableVerHeaderVisibleSet)
+#define cvxTableSetHorHeaderList CALL_PROFILE_CALL(2670, cvxTableSetHorHeaderList)
+#define cvxTableSetVerHeaderList CALL_PROFILE_CALL(2671, cvxTableSetVerHeaderList)
+#define cvxTableSetHeaderAlignment CALL_PROFILE_CALL(2672, cvxTableSetHeaderAlignment)
+#define cvxTableSetHeaderColResizeMode CALL_PROFILE_CALL(2673, cvxTableSetHeaderColResizeMode)
+#define cvxTableSetHeaderSectionSize CALL_PROFILE_CALL(2674, cvxTableSetHeaderSectionSize)
+#define cvxTableHeaderCellCheck CALL_PROFILE_CALL(2675, cvxTableHeaderCellCheck)
+#define cvxTabWidgetItemVisibleSet CALL_PROFILE_CALL(2676, cvxTabWidgetItemVisibleSet)
+#define cvxTreeSetHeaderIcon CALL_PROFILE_CALL(2677, cvxTreeSetHeaderIcon)
+#define cvxTreeSetHeaderText CALL_PROFILE_CALL(2678, cvxTreeSetHeaderText)
+#define cvxTreeHeaderGetSize CALL_PROFILE_CALL(2679, cvxTreeHeaderGetSize)
+#define cvxTreeSetHeaderTextAlignment CALL_PROFILE_CALL(2680, cvxTreeSetHeaderTextAlignment)
+#define cvxTreeSetColumnCount CALL_PROFILE_CALL(2681, cvxTreeSetColumnCount)
+#define cvxTreeGetColumnCount CALL_PROFILE_CALL(2682, cvxTreeGetColumnCount)
+#define cvxTreeSetColumnWidth CALL_PROFILE_CALL(2683, cvxTreeSetColumnWidth)
+#define cvxTreeGetColumnWidth CALL_PROFILE_CALL(2684, cvxTreeGetColumnWidth)
+#define cvxTreeSetColumnHidden CALL_PROFILE_CALL(2685, cvxTreeSetColumnHidden)
+#define cvxTreeIsColumnHidden CALL_PROFILE_CALL(2686, cvxTreeIsColumnHidden)
+#define cvxTreeAutoResizeColumn CALL_PROFILE_CALL(2687, cvxTreeAutoResizeColumn)
+#define cvxTreeExpandAll CALL_PROFILE_CALL(2688, cvxTreeExpandAll)
+#define cvxTreeCollapseAll CALL_PROFILE_CALL(2689, cvxTreeCollapseAll)
+#define cvxTreeUnselectAll CALL_PROFILE_CALL(2690, cvxTreeUnselectAll)
+#define cvxTreeSetSelectionMode CALL_PROFILE_CALL(2691, cvxTreeSetSelectionMode)
+#define cvxTreeSetSelectionBehavior CALL_PROFILE_CALL(2692, cvxTreeSetSelectionBehavior)
+#define cvxTreeGetCbParam CALL_PROFILE_CALL(2693, cvxTreeGetCbParam)
+#define cvxTreeItemsCount CALL_PROFILE_CALL(2694, cvxTreeItemsCount)
+#define cvxTreeAddItem CALL_PROFILE_CALL(2695, cvxTreeAddItem)
+#define cvxTreeSetItemFlag CALL_PROFILE_CALL(2696, cvxTreeSetItemFlag)
+#define cvxTreeGetItemFlag CALL_PROFILE_CALL(2697, cvxTreeGetItemFlag)
+#define cvxTreeSetItemIconNameByColumn CALL_PROFILE_CALL(2698, cvxTreeSetItemIconNameByColumn)
+#define cvxTreeSetItemTextByColumn CALL_PROFILE_CALL(2699, cvxTreeSetItemTextByColumn)
+#define cvxTreeGetItemTextByColumn CALL_PROFILE_CALL(2700, cvxTreeGetItemTextByColumn)
+#define cvxTreeSetItemTextColor CALL_PROFILE_CALL(2701, cvxTreeSetItemTextColor)
+#define cvxTreeGetDBIdByItem CALL_PROFILE_CALL(2702, cvxTreeGetDBIdByItem)
+#define cvxTreeDeleteItem CALL_PROFILE_CALL(2703, cvxTreeDeleteItem)
+#define cvxTreeDeleteSubItem CALL_PROFILE_CALL(2704, cvxTreeDeleteSubItem)
+#define cvxTreeEditItemByLineEdit CALL_PROFILE_CALL(2705, cvxTreeEditItemByLineEdit)
+#define cvxTreeEditItemByComboBox CALL_PROFILE_CALL(2706, cvxTreeEditItemByComboBox)
+#define cvxTreeGetPrevSiblingItem CALL_PROFILE_CALL(2707, cvxTreeGetPrevSiblingItem)
+#define cvxTreeGetNextSiblingItem CALL_PROFILE_CALL(2708, cvxTreeGetNextSiblingItem)
+#define cvxTreeGetChildItem CALL_PROFILE_CALL(2709, cvxTreeGetChildItem)
+#define cvxTreeGetChildrenCount CALL_PROFILE_CALL(2710, cvxTreeGetChildrenCount)
+#define cvxTreeGetParentItem CALL_PROFILE_CALL(2711, cvxTreeGetParentItem)
+#define cvxTreeMoveItems CALL_PROFILE_CALL(2712, cvxTreeMoveItems)
+#define cvxTreeGetDescendants CALL_PROFILE_CALL(2713, cvxTreeGetDescendants)
+#define cvxTreeGetSelectedItems CALL_PROFILE_CALL(2714, cvxTreeGetSelectedItems)
+#define cvxTreeIsItemSelected CALL_PROFILE_CALL(2715, cvxTreeIsItemSelected)
+#define cvxTreeSelectItem CALL_PROFILE_CALL(2716, cvxTreeSelectItem)
+#define cvxTreeSetItemCheckable CALL_PROFILE_CALL(2717, cvxTreeSetItemCheckable)
+#define cvxTreeGetItemCheckState CALL_PROFILE_CALL(2718, cvxTreeGetItemCheckState)
+#define cvxTreeSetItemCheckState CALL_PROFILE_CALL(2719, cvxTreeSetItemCheckState)
+#define cvxTreeItemIsExpand CALL_PROFILE_CALL(2720, cvxTreeItemIsExpand)
+#define cvxTreeExpandItem CALL_PROFILE_CALL(2721, cvxTreeExpandItem)
+#define cvxGetAngle CALL_PROFILE_CALL(2722, cvxGetAngle)
+#define cvxGetDistance CALL_PROFILE_CALL(2723, cvxGetDistance)
+#define cvxGetNumber CALL_PROFILE_CALL(2724, cvxGetNumber)
+#define cvxGetEnt CALL_PROFILE_CALL(2725, cvxGetEnt)
+#define cvxGetEnts CALL_PROFILE_CALL(2726, cvxGetEnts)
+#define cvxGetEntPath CALL_PROFILE_CALL(2727, cvxGetEntPath)
+#define cvxGetEntPaths CALL_PROFILE_CALL(2728, cvxGetEntPaths)
+#define cvxGetEntsMultiFilter CALL_PROFILE_CALL(2729, cvxGetEntsMultiFilter)
+#define cvxGetEntPathsMultiFilter CALL_PROFILE_CALL(2730, cvxGetEntPathsMultiFilter)
+#define cvxGetExternalPick CALL_PROFILE_CALL(2731, cvxGetExternalPick)
+#define cvxGetPoint CALL_PROFILE_CALL(2732, cvxGetPoint)
+#define cvxGetPoints CALL_PROFILE_CALL(2733, cvxGetPoints)
+#define cvxGetPointOnEnt CALL_PROFILE_CALL(2734, cvxGetPointOnEnt)
+#define cvxGetPointsOnEnts CALL_PROFILE_CALL(2735, cvxGetPointsOnEnts)
+#define cvxGetFile CALL_PROFILE_CALL(2736, cvxGetFile)
+#define cvxGetFileByLongPath CALL_PROFILE_CALL(2737, cvxGetFileByLongPath)
+#define cvxGetFileActiveField CALL_PROFILE_CALL(2738, cvxGetFileActiveField)
+#define cvxGetFolder CALL_PROFILE_CALL(2739, cvxGetFolder)
+#define cvxGetFolderByLongPath CALL_PROFILE_CALL(2740, cvxGetFolderByLongPath)
+#define cvxGetFolderActiveField CALL_PROFILE_CALL(2741, cvxGetFolderActiveField)
+#define cvxGetResponse CALL_PROFILE_CALL(2742, cvxGetResponse)
+#define cvxGetString CALL_PROFILE_CALL(2743, cvxGetString)
+#define ZwFolderGet CALL_PROFILE_CALL(2744, ZwFolderGet)
+#define ZwNumberGet CALL_PROFILE_CALL(2745, ZwNumberGet)
+#define cvxPartInqEqnSetMembers CALL_PROFILE_CALL(2746, cvxPartInqEqnSetMembers)
+#define cvxPartInqEqnAssociatedSet CALL_PROFILE_CALL(2747, cvxPartInqEqnAssociatedSet)
+#define cvxEqGetExpByName CALL_PROFILE_CALL(2748, cvxEqGetExpByName)
+#define cvxEqGetDescById CALL_PROFILE_CALL(2749, cvxEqGetDescById)
+#define cvxEqSetDescById CALL_PROFILE_CALL(2750, cvxEqSetDescById)
+#define cvxPartVarSubstitute CALL_PROFILE_CALL(2751, cvxPartVarSubstitute)
+#define cvxPartVarSubstituteResize CALL_PROFILE_CALL(2752, cvxPartVarSubstituteResize)
+#define cvxEqLoadFile CALL_PROFILE_CALL(2753, cvxEqLoadFile)
+#define cvxEqRegen CALL_PROFILE_CALL(2754, cvxEqRegen)
+#define cvxPartEqnDelete CALL_PROFILE_CALL(2755, cvxPartEqnDelete)
+#define ZwVariableListGet CALL_PROFILE_CALL(2756, ZwVariableListGet)
+#define ZwVariableListSet CALL_PROFILE_CALL(2757, ZwVariableListSet)
+#define ZwVariableCreate CALL_PROFILE_CALL(2758, ZwVariableCreate)
+#define ZwVariableStandardAttributeItemGet CALL_PROFILE_CALL(2759, ZwVariableStandardAttributeItemGet)
+#define ZwVariableTextRefresh CALL_PROFILE_CALL(2760, ZwVariableTextRefresh)
+#define ZwVector2IsPerpendicular CALL_PROFILE_CALL(2761, ZwVector2IsPerpendicular)
+#define ZwVectorIsPerpendicular CALL_PROFILE_CALL(2762, ZwVectorIsPerpendicular)
+#define ZwVectorTripleScaleProduct CALL_PROFILE_CALL(2763, ZwVectorTripleScaleProduct)
+#define ZwVector2Scaling CALL_PROFILE_CALL(2764, ZwVector2Scaling)
+#define ZwVectorScaling CALL_PROFILE_CALL(2765, ZwVectorScaling)
+#define ZwVector4Scaling CALL_PROFILE_CALL(2766, ZwVector4Scaling)
+#define ZwVector2Subtraction CALL_PROFILE_CALL(2767, ZwVector2Subtraction)
+#define ZwVectorSubtraction CALL_PROFILE_CALL(2768, ZwVectorSubtraction)
+#define ZwVector2Magnitude CALL_PROFILE_CALL(2769, ZwVector2Magnitude)
+#define ZwVectorMagnitude CALL_PROFILE_CALL(2770, ZwVectorMagnitude)
+#define ZwVector2Dot CALL_PROFILE_CALL(2771, ZwVector2Dot)
+#define ZwVectorDot CALL_PROFILE_CALL(2772, ZwVectorDot)
+#define ZwVector2Negated CALL_PROFILE_CALL(2773, ZwVector2Negated)
+#define ZwVectorNegated CALL_PROFILE_CALL(2774, ZwVectorNegated)
+#define ZwVector2IsEqual CALL_PROFILE_CALL(2775, ZwVector2IsEqual)
+#define ZwVectorIsEqual CALL_PROFILE_CALL(2776, ZwVectorIsEqual)
+#define ZwVector4IsEqual CALL_PROFILE_CALL(2777, ZwVector4IsEqual)
+#define ZwVector2IsZero CALL_PROFILE_CALL(2778, ZwVector2IsZero)
+#define ZwVectorIsZero CALL_PROFILE_CALL(2779, ZwVectorIsZero)
+#define ZwVector4IsZero CALL_PROFILE_CALL(2780, ZwVector4IsZero)
+#define ZwVector2Sum CALL_PROFILE_CALL(2781, ZwVector2Sum)
+#define ZwVectorSum CALL_PROFILE_CALL(2782, ZwVectorSum)
+#define ZwVector2AffineCombine CALL_PROFILE_CALL(2783, ZwVector2AffineCombine)
+#define ZwVectorAffineCombine CALL_PROFILE_CALL(2784, ZwVectorAffineCombine)
+#define ZwVector2LinearCombine CALL_PROFILE_CALL(2785, ZwVector2LinearCombine)
+#define ZwVectorLinearCombine CALL_PROFILE_CALL(2786, ZwVectorLinearCombine)
+#define ZwVector2ToVector3 CALL_PROFILE_CALL(2787, ZwVector2ToVector3)
+#define ZwVector3ToVector2 CALL_PROFILE_CALL(2788, ZwVector3ToVector2)
+#define ZwVector3ToVector4 CALL_PROFILE_CALL(2789, ZwVector3ToVector4)
+#define ZwVector3ToVector4WithWeight CALL_PROFILE_CALL(2790, ZwVector3ToVector4WithWeight)
+#define ZwVector4ToVector3 CALL_PROFILE_CALL(2791, ZwVector4ToVector3)
+#define ZwVector4ToVector3WithWeight CALL_PROFILE_CALL(2792, ZwVector4ToVector3WithWeight)
+#define ZwVector2LinearComponents CALL_PROFILE_CALL(2793, ZwVector2LinearComponents)
+#define ZwVectorLinearComponents CALL_PROFILE_CALL(2794, ZwVectorLinearComponents)
+#define ZwVectorNormalize CALL_PROFILE_CALL(2795, ZwVectorNormalize)
+#define ZwVectorInit CALL_PROFILE_CALL(2796, ZwVectorInit)
+#define ZwVectorAngleGet CALL_PROFILE_CALL(2797, ZwVectorAngleGet)
+#define ZwVectorCrossProduct CALL_PROFILE_CALL(2798, ZwVectorCrossProduct)
+#define ZwVectorPerpendicularGet CALL_PROFILE_CALL(2799, ZwVectorPerpendicularGet)
+#define ZwVectorReverse CALL_PROFILE_CALL(2800, ZwVectorReverse)
+#define ZwVectorParallelCheck CALL_PROFILE_CALL(2801, ZwVectorParallelCheck)
+#define ZwVectorTransform CALL_PROFILE_CALL(2802, ZwVectorTransform)
+#define cvxViewIsSection CALL_PROFILE_CALL(2803, cvxViewIsSection)
+#define cvxViewIsStandard CALL_PROFILE_CALL(2804, cvxViewIsStandard)
+#define cvxViewInqStandardType CALL_PROFILE_CALL(2805, cvxViewInqStandardType)
+#define cvxViewActivate CALL_PROFILE_CALL(2806, cvxViewActivate)
+#define cvxViewExtent CALL_PROFILE_CALL(2807, cvxViewExtent)
+#define cvxViewGet CALL_PROFILE_CALL(2808, cvxViewGet)
+#define cvxViewSet CALL_PROFILE_CALL(2809, cvxViewSet)
+#define cvxViewOrigin CALL_PROFILE_CALL(2810, cvxViewOrigin)
+#define cvxViewStd CALL_PROFILE_CALL(2811, cvxViewStd)
+#define cvxViewSetBndBox CALL_PROFILE_CALL(2812, cvxViewSetBndBox)
+#define cvxGetViewRect CALL_PROFILE_CALL(2813, cvxGetViewRect)
+#define cvxCustomViewAdd CALL_PROFILE_CALL(2814, cvxCustomViewAdd)
+#define cvxCustomViewActivate CALL_PROFILE_CALL(2815, cvxCustomViewActivate)
+#define cvxCustomViewDel CALL_PROFILE_CALL(2816, cvxCustomViewDel)
+#define cvxCustomViewId CALL_PROFILE_CALL(2817, cvxCustomViewId)
+#define cvxCustomViewListGet CALL_PROFILE_CALL(2818, cvxCustomViewListGet)
+#define ZwViewParameterGet CALL_PROFILE_CALL(2819, ZwViewParameterGet)
+#define ZwViewParameterSet CALL_PROFILE_CALL(2820, ZwViewParameterSet)
+#define ZwViewMatrixGet CALL_PROFILE_CALL(2821, ZwViewMatrixGet)
+#define ZwViewTransformMatrixGet CALL_PROFILE_CALL(2822, ZwViewTransformMatrixGet)
+#define ZwCustomViewNameGet CALL_PROFILE_CALL(2823, ZwCustomViewNameGet)
+#define ZwCustomViewNameSet CALL_PROFILE_CALL(2824, ZwCustomViewNameSet)
+#define ZwCustomViewGetByName CALL_PROFILE_CALL(2825, ZwCustomViewGetByName)
+#define ZwSectionViewNameSet CALL_PROFILE_CALL(2826, ZwSectionViewNameSet)
+#define ZwSectionViewNameGet CALL_PROFILE_CALL(2827, ZwSectionViewNameGet)
+#define ZwSectionViewListGet CALL_PROFILE_CALL(2828, ZwSectionViewListGet)
+#define ZwSectionViewDirectionReverse CALL_PROFILE_CALL(2829, ZwSectionViewDirectionReverse)
+#define ZwSectionViewParameterGet CALL_PROFILE_CALL(2830, ZwSectionViewParameterGet)
+#define ZwSectionViewParameterInit CALL_PROFILE_CALL(2831, ZwSectionViewParameterInit)
+#define ZwSectionViewCreate CALL_PROFILE_CALL(2832, ZwSectionViewCreate)
+#define ZwSectionViewOnStateGet CALL_PROFILE_CALL(2833, ZwSectionViewOnStateGet)
+#define ZwSectionViewOnStateSet CALL_PROFILE_CALL(2834, ZwSectionViewOnStateSet)
+#define ZwSectionViewDatumPlaneInsert CALL_PROFILE_CALL(2835, ZwSectionViewDatumPlaneInsert)
+#define ZwSectionViewParameterSet CALL_PROFILE_CALL(2836, ZwSectionViewParameterSet)
+#define ZwSectionViewComponentGet CALL_PROFILE_CALL(2837, ZwSectionViewComponentGet)
+#define ZwSectionViewComponentSet CALL_PROFILE_CALL(2838, ZwSectionViewComponentSet)
+#define ZwSectionViewCheck CALL_PROFILE_CALL(2839, ZwSectionViewCheck)
+#define ZwSectionViewLocalDisplayControlSet CALL_PROFILE_CALL(2840, ZwSectionViewLocalDisplayControlSet)
+#define ZwSectionViewGlobalDisplayControlSet CALL_PROFILE_CALL(2841, ZwSectionViewGlobalDisplayControlSet)
+#define ZwSectionViewLocalDisplayControlGet CALL_PROFILE_CALL(2842, ZwSectionViewLocalDisplayControlGet)
+#define ZwSectionViewGlobalDisplayControlGet CALL_PROFILE_CALL(2843, ZwSectionViewGlobalDisplayControlGet)
+#define ZwSectionViewCurveAttributeGet CALL_PROFILE_CALL(2844, ZwSectionViewCurveAttributeGet)
+#define ZwSectionViewCurveAttributeSet CALL_PROFILE_CALL(2845, ZwSectionViewCurveAttributeSet)
+#define ZwSectionViewUpdate CALL_PROFILE_CALL(2846, ZwSectionViewUpdate)
+#define ZwSectionViewDatumCurveListInsert CALL_PROFILE_CALL(2847, ZwSectionViewDatumCurveListInsert)
+#define cvxOpCount CALL_PROFILE_CALL(2848, cvxOpCount)
+#define cvxXnUndoCount CALL_PROFILE_CALL(2849, cvxXnUndoCount)
+#define cvxUndoRedoMarker CALL_PROFILE_CALL(2850, cvxUndoRedoMarker)
+#define cvxUndoRedo CALL_PROFILE_CALL(2851, cvxUndoRedo)
+#define cvxUndoRedoTo CALL_PROFILE_CALL(2852, cvxUndoRedoTo)
+#define cvxPartNameLastOp CALL_PROFILE_CALL(2853, cvxPartNameLastOp)
+#define cvxXnBundle CALL_PROFILE_CALL(2854, cvxXnBundle)
+#define cvxUndoBundleStart CALL_PROFILE_CALL(2855, cvxUndoBundleStart)
+#define cvxUndoBundleEnd CALL_PROFILE_CALL(2856, cvxUndoBundleEnd)
+#endif
@@ -0,0 +1,205 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* ZW3D API includes */
+#include "zwapi_brep_shape.h"   /* first, its include guard is the one of zwapi_shape.h */
+#include "zwapi_brep_edge.h"
+#include "zwapi_brep_face.h"
+#include "zwapi_brep_loop.h"
+#include "zwapi_file.h"
+#include "zwapi_file_path.h"
+#include "zwapi_math_matrix.h"
+#include "zwapi_part_facets.h"
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include "..\inc\ApiProfilePr.h"
+#include "..\inc\CallProfile.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define MESSAGE_SIZE 256
+#define PROFILE_NAME "ApiProfile"    /* files of the profile, next to the active file */
+#define LIST_CALLS 10                /* functions listed, at most */
+
+/*******************************************************************/
+/* Function declarations */
+static int ApiProfile(void);
+static int PartWalk(int *faceCount, int *edgeCount);
+static double Seconds(std::chrono::steady_clock::time_point start);
+
+/*******************************************************************/
+/* Function definition */
+int RegisterApiProfile
+(
+void
+)
+/*
+DESCRIPTION:
+   Register the commands of the API profile example.
+*/
+{
+    /* Profile the API calls of a walk of the active part by entering "~ApiProfile" */
+    ZwCommandFunctionLoad("ApiProfile", (void *)ApiProfile, ZW_LICENSE_CODE_GENERAL);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int UnloadApiProfile
+(
+void
+)
+/*
+DESCRIPTION:
+   Unload the commands of the API profile example.
+*/
+{
+    ZwCommandFunctionUnload("ApiProfile");
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+double Seconds
+(
+std::chrono::steady_clock::time_point start   /* I: start time */
+)
+/*
+DESCRIPTION:
+   Seconds elapsed since "start".
+*/
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*******************************************************************/
+/* Function definition */
+int PartWalk
+(
+int *faceCount,    /* O: faces walked */
+int *edgeCount     /* O: edges walked */
+)
+/*
+DESCRIPTION:
+   Walk the shapes of the active part as the TopoInquiry example does:
+the facets and the loops of each face, the edges of each loop, their
+faces and the curve of each edge on each of its faces.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    *faceCount = 0;
+    *edgeCount = 0;
+    int shapeCount = 0, *shapes = nullptr;
+    if (cvxPartInqShapes("", "", &shapeCount, &shapes))
+        return 1;
+    for (int s = 0; s < shapeCount; s++)
+    {
+        int count = 0, *faces = nullptr;
+        if (cvxPartInqShapeFaces(shapes[s], &count, &faces))
+            continue;
+        for (int f = 0; f < count; f++)
+        {
+            svxFacets facets;
+            cvxMemZero(&facets, sizeof(facets));
+            if (cvxPartInqFaceFacets2(faces[f], &facets) == ZW_API_NO_ERROR)
+                cvxFacetsFree(&facets);
+
+            int loopCount = 0, *loops = nullptr;
+            if (cvxPartInqFaceLoops(faces[f], 1, &loopCount, &loops))
+                continue;
+            (*faceCount)++;
+            for (int l = 0; l < loopCount; l++)
+            {
+                int edgeListCount = 0, *edges = nullptr;
+                if (cvxPartInqLoopEdges(loops[l], &edgeListCount, &edges))
+                    continue;
+                for (int e = 0; e < edgeListCount; e++)
+                {
+                    int edgeFaceCount = 0, *edgeFaces = nullptr;
+                    if (cvxPartInqEdgeFaces(edges[e], &edgeFaceCount, &edgeFaces))
+                        continue;
+                    (*edgeCount)++;
+                    for (int k = 0; k < edgeFaceCount; k++)
+                    {
+                        svxCurve curve;
+                        cvxMemZero(&curve, sizeof(curve));
+                        cvxMatInit(&curve.Frame);
+                        if (cvxPartInqEdgeCrv(edges[e], edgeFaces[k], &curve) == ZW_API_NO_ERROR)
+                            cvxCurveFree(&curve);
+                    }
+                    cvxMemFree((void **)&edgeFaces);
+                }
+                cvxMemFree((void **)&edges);
+            }
+            cvxMemFree((void **)&loops);
+        }
+        cvxMemFree((void **)&faces);
+    }
+    cvxMemFree((void **)&shapes);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int ApiProfile
+(
+void
+)
+/*
+DESCRIPTION:
+   Walk the active part with every API call profiled, list the functions
+of the longest total time and write the profile next to the active
+file. The calls are profiled only when ZW3D was started with the
+environment variable ZW_CALL_PROFILE set (see "Read Me.txt").
+
+   Return 1 if function fails, else 0.
+*/
+{
+    char message[MESSAGE_SIZE];
+    if (!CallProfileEnabled())
+        cvxMsgDisp("Profiling is off, set ZW_CALL_PROFILE before starting ZW3D");
+
+    CallProfileReset();
+    int faceCount = 0, edgeCount = 0;
+    const auto start = std::chrono::steady_clock::now();
+    if (PartWalk(&faceCount, &edgeCount))
+    {
+        cvxMsgDisp("No shapes in the active part");
+        return 1;
+    }
+    sprintf_s(message, MESSAGE_SIZE, "%d faces, %d edges walked in %.3f s", faceCount, edgeCount, Seconds(start));
+    cvxMsgDisp(message);
+    if (!CallProfileEnabled())
+        return 0;
+
+    CallProfileCall calls[LIST_CALLS];
+    const int count = CallProfileSummary(LIST_CALLS, calls);
+    for (int i = 0; i < count; i++)
+    {
+        sprintf_s(message, MESSAGE_SIZE, "%-24s %8lld calls, total %9.3f ms, mean %8.2f us, max %8.2f us",
+            calls[i].name, calls[i].count, calls[i].total * 1e3, calls[i].total * 1e6 / (double)calls[i].count,
+            calls[i].max * 1e6);
+        cvxMsgDisp(message);
+    }
+
+    vxPath path;
+    cvxFileDirectory(path);
+    if (!path[0] || cvxPathCompose(path, PROFILE_NAME))
+        return 0;
+    if (CallProfileFlush(path))
+    {
+        sprintf_s(message, MESSAGE_SIZE, "Cannot write %s.json", path);
+        cvxMsgDisp(message);
+        return 1;
+    }
+    sprintf_s(message, MESSAGE_SIZE, "Profile: %s.json, .folded and .csv", path);
+    cvxMsgDisp(message);
+    return 0;
+}
@@ -0,0 +1,578 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "CallProfile.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define CALIBRATION_SECONDS 0.01     /* shortest time measured for the tick rate */
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: a profiled call */
+struct ProfileEvent
+{
+    int id;
+    long long size;
+    long long bytes;             /* allocated or returned in lists */
+    unsigned long long start;
+    unsigned long long end;
+};
+
+/* DESCRIPTION: counters of a function in a thread */
+struct ProfileCounter
+{
+    long long count;
+    unsigned long long ticks;
+    unsigned long long maxTicks;
+    long long allocBytes;
+    long long sizes[CALL_PROFILE_BUCKETS];
+};
+
+/* DESCRIPTION: counters and last calls of a thread, written by the thread only */
+struct ProfileThread
+{
+    int index;                               /* 1, 2, ... in the order of the first call */
+    std::vector<ProfileEvent> ring;
+    unsigned long long written;              /* calls written to the ring */
+    std::vector<ProfileCounter> counters;    /* CALL_PROFILE_COUNT, by function id */
+};
+
+/* DESCRIPTION: state of the profiler */
+struct ProfileState
+{
+    std::mutex lock;
+    std::vector<std::unique_ptr<ProfileThread>> threads;
+    const char *names[CALL_PROFILE_COUNT];
+    std::vector<char> alloc;                 /* 1 for the allocation functions, by id */
+    size_t capacity;
+    std::string path;
+    unsigned long long ticks0;
+    std::chrono::steady_clock::time_point time0;
+};
+
+/* DESCRIPTION: writes the files of ZW_CALL_PROFILE at unload */
+struct ProfileUnload
+{
+    ~ProfileUnload();
+};
+
+/*******************************************************************/
+/* Function declarations */
+static ProfileState &State(void);
+static ProfileThread *Thread(void);
+static int Bucket(long long size);
+static double TicksPerMicro(const ProfileState &state);
+static FILE *FileOpen(const std::string &path);
+static int TraceWrite(const ProfileState &state, double rate, const std::string &path);
+static int FoldedWrite(const ProfileState &state, double rate, const std::string &path);
+static int CountersWrite(const std::vector<CallProfileCall> &calls, const std::string &path);
+static std::vector<CallProfileCall> Calls(const ProfileState &state, double rate);
+static std::vector<ProfileEvent> Events(const ProfileThread &thread);
+
+static ProfileUnload s_unload;
+
+/*******************************************************************/
+/* Function definition */
+ProfileState &State
+(
+void
+)
+/*
+DESCRIPTION:
+   State of the profiler, set up on the first use: the function names,
+the path and the ring size of the environment and the tick origin.
+*/
+{
+    static ProfileState *state = []()
+    {
+        ProfileState *created = new ProfileState;
+        for (int id = 0; id < CALL_PROFILE_COUNT; id++)
+            created->names[id] = "";
+#define CALL_PROFILE_NAME(id, name) created->names[id] = #name;
+#include "CallProfileApi.h"
+#undef CALL_PROFILE_NAME
+        created->alloc.assign(CALL_PROFILE_COUNT, 0);
+        static const char *allocators[] = { "cvxMemAlloc", "cvxMemResize", "ZwMemoryAlloc", "ZwMemoryResize" };
+        for (int id = 0; id < CALL_PROFILE_COUNT; id++)
+        {
+            for (const char *allocator : allocators)
+            {
+                if (strcmp(created->names[id], allocator) == 0)
+                    created->alloc[id] = 1;
+            }
+        }
+
+        char *path = nullptr, *events = nullptr;
+#ifdef _MSC_VER
+        size_t length = 0;
+        _dupenv_s(&path, &length, CALL_PROFILE_ENV);
+        _dupenv_s(&events, &length, CALL_PROFILE_EVENTS_ENV);
+#else
+        path = getenv(CALL_PROFILE_ENV) != nullptr ? strdup(getenv(CALL_PROFILE_ENV)) : nullptr;
+        events = getenv(CALL_PROFILE_EVENTS_ENV) != nullptr ? strdup(getenv(CALL_PROFILE_EVENTS_ENV)) : nullptr;
+#endif
+        created->path = path != nullptr ? path : "";
+        created->capacity = events != nullptr && atoi(events) > 0 ? (size_t)atoi(events) : CALL_PROFILE_EVENTS;
+        free(path);
+        free(events);
+        created->ticks0 = CallProfileTicks();
+        created->time0 = std::chrono::steady_clock::now();
+        return created;
+    }();
+    return *state;
+}
+
+/*******************************************************************/
+/* Function definition */
+ProfileThread *Thread
+(
+void
+)
+/*
+DESCRIPTION:
+   Counters and ring of the calling thread, added on its first call. They
+are kept by the state when the thread ends.
+*/
+{
+    thread_local ProfileThread *thread = nullptr;
+    if (thread == nullptr)
+    {
+        ProfileState &state = State();
+        std::unique_ptr<ProfileThread> created(new ProfileThread);
+        created->ring.resize(state.capacity);
+        created->written = 0;
+        created->counters.assign(CALL_PROFILE_COUNT, ProfileCounter());
+        std::lock_guard<std::mutex> guard(state.lock);
+        created->index = (int)state.threads.size() + 1;
+        thread = created.get();
+        state.threads.push_back(std::move(created));
+    }
+    return thread;
+}
+
+/*******************************************************************/
+/* Function definition */
+int Bucket
+(
+long long size   /* I: largest integer argument */
+)
+/*
+DESCRIPTION:
+   Histogram bucket of a size: 0 for 0, else k for [2^(k-1), 2^k).
+*/
+{
+    int bucket = 0;
+    while (size > 0 && bucket < CALL_PROFILE_BUCKETS - 1)
+    {
+        size >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+/*******************************************************************/
+/* Function definition */
+double TicksPerMicro
+(
+const ProfileState &state   /* I: tick origin */
+)
+/*
+DESCRIPTION:
+   Ticks per microsecond since the origin, waiting for CALIBRATION_SECONDS
+if the origin is too close.
+*/
+{
+    std::chrono::steady_clock::time_point now;
+    unsigned long long ticks = 0;
+    do
+    {
+        ticks = CallProfileTicks();
+        now = std::chrono::steady_clock::now();
+    }
+    while (std::chrono::duration<double>(now - state.time0).count() < CALIBRATION_SECONDS);
+    const double micros = std::chrono::duration<double, std::micro>(now - state.time0).count();
+    return (double)(ticks - state.ticks0) / micros;
+}
+
+/*******************************************************************/
+/* Function definition */
+FILE *FileOpen
+(
+const std::string &path   /* I: file path */
+)
+/*
+DESCRIPTION:
+   Open a file for writing, NULL if it fails.
+*/
+{
+#ifdef _MSC_VER
+    FILE *file = nullptr;
+    return fopen_s(&file, path.c_str(), "wb") ? nullptr : file;
+#else
+    return fopen(path.c_str(), "wb");
+#endif
+}
+
+/*******************************************************************/
+/* Function definition */
+std::vector<ProfileEvent> Events
+(
+const ProfileThread &thread   /* I: thread */
+)
+/*
+DESCRIPTION:
+   Calls of the ring of a thread, by start time and outer calls first.
+*/
+{
+    const size_t capacity = thread.ring.size();
+    const size_t count = thread.written < capacity ? (size_t)thread.written : capacity;
+    std::vector<ProfileEvent> events(thread.ring.begin(), thread.ring.begin() + count);
+    std::sort(events.begin(), events.end(), [](const ProfileEvent &a, const ProfileEvent &b)
+              { return a.start != b.start ? a.start < b.start : a.end > b.end; });
+    return events;
+}
+
+/*******************************************************************/
+/* Function definition */
+int TraceWrite
+(
+const ProfileState &state,   /* I: threads */
+double rate,                 /* I: ticks per microsecond */
+const std::string &path      /* I: output file */
+)
+/*
+DESCRIPTION:
+   Write the calls of the rings as complete events of the Chrome trace
+format, with the size as argument, and the bytes allocated or returned
+in lists by each thread as a counter.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    FILE *file = FileOpen(path);
+    if (file == nullptr)
+        return 1;
+    fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    const char *separator = "";
+    for (const std::unique_ptr<ProfileThread> &thread : state.threads)
+    {
+        fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"thread %d\"}}",
+                separator, thread->index, thread->index);
+        separator = ",\n";
+        long long allocBytes = 0;
+        for (const ProfileEvent &event : Events(*thread))
+        {
+            const double start = (double)(event.start - state.ticks0) / rate;
+            const double duration = (double)(event.end - event.start) / rate;
+            fprintf(file, "%s{\"name\":\"%s\",\"cat\":\"zwapi\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,"
+                    "\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"size\":%lld}}",
+                    separator, state.names[event.id], thread->index, start, duration, event.size);
+            if (event.bytes > 0)
+            {
+                allocBytes += event.bytes;
+                fprintf(file, ",\n{\"name\":\"alloc bytes\",\"ph\":\"C\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,"
+                        "\"args\":{\"thread %d\":%lld}}", thread->index, start, thread->index, allocBytes);
+            }
+        }
+    }
+    fprintf(file, "\n]}\n");
+    return fclose(file) ? 1 : 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int FoldedWrite
+(
+const ProfileState &state,   /* I: threads */
+double rate,                 /* I: ticks per microsecond */
+const std::string &path      /* I: output file */
+)
+/*
+DESCRIPTION:
+   Write the self time of the calls of the rings in microseconds by stack,
+"thread 1;outer call;inner call 123". A call is inside another one of
+its thread when it runs within its time, as when an add-on callback
+called by ZW3D calls the API.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    std::map<std::string, double> stacks;
+    for (const std::unique_ptr<ProfileThread> &thread : state.threads)
+    {
+        const std::vector<ProfileEvent> events = Events(*thread);
+        std::vector<size_t> open;                 /* events of the current stack */
+        std::vector<std::string> keys;            /* their stacks */
+        std::vector<double> self(events.size());
+        for (size_t i = 0; i < events.size(); i++)
+        {
+            while (!open.empty() && events[open.back()].end <= events[i].start)
+            {
+                open.pop_back();
+                keys.pop_back();
+            }
+            self[i] = (double)(events[i].end - events[i].start) / rate;
+            if (!open.empty())
+                self[open.back()] -= self[i];
+            const std::string parent = keys.empty() ? "thread " + std::to_string(thread->index) : keys.back();
+            open.push_back(i);
+            keys.push_back(parent + ";" + state.names[events[i].id]);
+        }
+        /* the stacks again, now that the children are subtracted */
+        open.clear();
+        keys.clear();
+        for (size_t i = 0; i < events.size(); i++)
+        {
+            while (!open.empty() && events[open.back()].end <= events[i].start)
+            {
+                open.pop_back();
+                keys.pop_back();
+            }
+            const std::string parent = keys.empty() ? "thread " + std::to_string(thread->index) : keys.back();
+            open.push_back(i);
+            keys.push_back(parent + ";" + state.names[events[i].id]);
+            stacks[keys.back()] += self[i] > 0.0 ? self[i] : 0.0;
+        }
+    }
+
+    FILE *file = FileOpen(path);
+    if (file == nullptr)
+        return 1;
+    for (const auto &stack : stacks)
+        fprintf(file, "%s %lld\n", stack.first.c_str(), (long long)(stack.second + 0.5));
+    return fclose(file) ? 1 : 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+std::vector<CallProfileCall> Calls
+(
+const ProfileState &state,   /* I: threads */
+double rate                  /* I: ticks per microsecond */
+)
+/*
+DESCRIPTION:
+   Counters of the called functions over all threads, the longest total
+time first.
+*/
+{
+    std::vector<CallProfileCall> calls;
+    for (int id = 0; id < CALL_PROFILE_COUNT; id++)
+    {
+        CallProfileCall call;
+        memset(&call, 0, sizeof(call));
+        call.name = state.names[id];
+        for (const std::unique_ptr<ProfileThread> &thread : state.threads)
+        {
+            const ProfileCounter &counter = thread->counters[id];
+            call.count += counter.count;
+            call.total += (double)counter.ticks / rate * 1e-6;
+            call.max = std::max(call.max, (double)counter.maxTicks / rate * 1e-6);
+            call.allocBytes += counter.allocBytes;
+            for (int k = 0; k < CALL_PROFILE_BUCKETS; k++)
+                call.sizes[k] += counter.sizes[k];
+        }
+        if (call.count > 0)
+            calls.push_back(call);
+    }
+    std::sort(calls.begin(), calls.end(), [](const CallProfileCall &a, const CallProfileCall &b)
+              { return a.total > b.total; });
+    return calls;
+}
+
+/*******************************************************************/
+/* Function definition */
+int CountersWrite
+(
+const std::vector<CallProfileCall> &calls,   /* I: counters */
+const std::string &path                      /* I: output file */
+)
+/*
+DESCRIPTION:
+   Write the counters, one line per called function. The histogram lists
+the non-empty buckets as "upper bound:count".
+
+   Return 1 if function fails, else 0.
+*/
+{
+    FILE *file = FileOpen(path);
+    if (file == nullptr)
+        return 1;
+    fprintf(file, "call,count,total_us,mean_us,max_us,alloc_bytes,size_histogram\n");
+    for (const CallProfileCall &call : calls)
+    {
+        fprintf(file, "%s,%lld,%.3f,%.3f,%.3f,%lld,", call.name, call.count, call.total * 1e6,
+                call.total * 1e6 / (double)call.count, call.max * 1e6, call.allocBytes);
+        const char *separator = "";
+        for (int k = 0; k < CALL_PROFILE_BUCKETS; k++)
+        {
+            if (call.sizes[k] > 0)
+            {
+                fprintf(file, "%s%lld:%lld", separator, k == 0 ? 0LL : (1LL << k) - 1, call.sizes[k]);
+                separator = " ";
+            }
+        }
+        fprintf(file, "\n");
+    }
+    return fclose(file) ? 1 : 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int CallProfileEnabled
+(
+void
+)
+/*
+DESCRIPTION:
+   1 if ZW_CALL_PROFILE is set, read once.
+*/
+{
+    static const int enabled = State().path.empty() ? 0 : 1;
+    return enabled;
+}
+
+/*******************************************************************/
+/* Function definition */
+void CallProfileRecord
+(
+int id,                        /* I: function id */
+long long size,                /* I: largest integer argument */
+long long bytes,               /* I: bytes of the returned lists */
+unsigned long long start,      /* I: ticks at the call */
+unsigned long long end         /* I: ticks at the return */
+)
+/*
+DESCRIPTION:
+   Add a call to the counters and the ring of the calling thread. The
+size of an allocation function is added to the allocated bytes.
+*/
+{
+    ProfileThread *thread = Thread();
+    ProfileCounter &counter = thread->counters[id];
+    const unsigned long long ticks = end - start;
+    counter.count++;
+    counter.ticks += ticks;
+    if (ticks > counter.maxTicks)
+        counter.maxTicks = ticks;
+    counter.sizes[Bucket(size)]++;
+    if (State().alloc[id] && size > 0)
+        bytes += size;
+    counter.allocBytes += bytes;
+    if (!thread->ring.empty())
+    {
+        ProfileEvent &event = thread->ring[thread->written % thread->ring.size()];
+        event.id = id;
+        event.size = size;
+        event.bytes = bytes;
+        event.start = start;
+        event.end = end;
+    }
+    thread->written++;
+}
+
+/*******************************************************************/
+/* Function definition */
+int CallProfileSummary
+(
+int max,                    /* I: size of "calls" */
+CallProfileCall *calls      /* O: counters, the longest total time first */
+)
+/*
+DESCRIPTION:
+   Counters of the called functions over all threads.
+
+   Return the number of counters written to "calls".
+*/
+{
+    ProfileState &state = State();
+    const double rate = TicksPerMicro(state);
+    std::lock_guard<std::mutex> guard(state.lock);
+    const std::vector<CallProfileCall> all = Calls(state, rate);
+    const int count = std::min(max, (int)all.size());
+    for (int i = 0; i < count; i++)
+        calls[i] = all[i];
+    return count;
+}
+
+/*******************************************************************/
+/* Function definition */
+int CallProfileFlush
+(
+const char *path   /* I: output path without extension */
+)
+/*
+DESCRIPTION:
+   Write "path.json", "path.folded" and "path.csv".
+
+   Return 1 if function fails, else 0.
+*/
+{
+    if (path == nullptr || !path[0])
+        return 1;
+    ProfileState &state = State();
+    const double rate = TicksPerMicro(state);
+    std::lock_guard<std::mutex> guard(state.lock);
+    const std::string base = path;
+    int failed = TraceWrite(state, rate, base + ".json");
+    failed |= FoldedWrite(state, rate, base + ".folded");
+    failed |= CountersWrite(Calls(state, rate), base + ".csv");
+    return failed;
+}
+
+/*******************************************************************/
+/* Function definition */
+void CallProfileReset
+(
+void
+)
+/*
+DESCRIPTION:
+   Clear the counters and the rings of all threads.
+*/
+{
+    ProfileState &state = State();
+    std::lock_guard<std::mutex> guard(state.lock);
+    for (const std::unique_ptr<ProfileThread> &thread : state.threads)
+    {
+        thread->written = 0;
+        thread->counters.assign(CALL_PROFILE_COUNT, ProfileCounter());
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+ProfileUnload::~ProfileUnload
+(
+)
+/*
+DESCRIPTION:
+   Write the files of ZW_CALL_PROFILE if calls were profiled.
+*/
+{
+    if (!CallProfileEnabled())
+        return;
+    const ProfileState &state = State();
+    for (const std::unique_ptr<ProfileThread> &thread : state.threads)
+    {
+        if (thread->written > 0)
+        {
+            CallProfileFlush(state.path.c_str());
+            return;
+        }
+    }
+}
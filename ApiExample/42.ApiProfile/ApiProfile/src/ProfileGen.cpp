@@ -0,0 +1,412 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* Application includes */
+#include <ctype.h>
+#include <stdio.h>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/*
+DESCRIPTION:
+   Generator of CallProfileApi.h, the "ProfileGen" tool:
+
+   ProfileGen <headers directory> <output header>
+
+   It reads the ZW_API_C declarations of all API headers and writes the
+include of every header, then one redirect macro for each function and
+the list of the function names, both with the conditions (for example
+#ifdef _WIN64) the declarations are under. The output only depends on
+the headers, so it is kept in the tree and regenerated when they change.
+*/
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: an API function */
+struct GenFunction
+{
+    std::string name;
+    std::string condition;   /* preprocessor condition, empty for none */
+};
+
+/* DESCRIPTION: an API header */
+struct GenHeader
+{
+    std::string name;
+    std::string guardCheck;      /* macro tested by the include guard */
+    std::string guardDefine;     /* macro defined by the include guard */
+    std::vector<GenFunction> functions;
+};
+
+/* DESCRIPTION: an open conditional of a header */
+struct GenCondition
+{
+    std::string text;
+    int ignored;             /* include guard or __cplusplus */
+};
+
+/*******************************************************************/
+/* Function declarations */
+static std::string CommentsStrip(const std::string &text);
+static std::string Trim(const std::string &text);
+static std::string Word(const std::string &text, size_t start);
+static std::string Condition(const std::vector<GenCondition> &stack);
+static int HeaderRead(const std::filesystem::path &path, GenHeader *header);
+static void Conditional(std::ostream &out, const std::string &condition, std::string *open);
+
+/*******************************************************************/
+/* Function definition */
+std::string CommentsStrip
+(
+const std::string &text   /* I: header text */
+)
+/*
+DESCRIPTION:
+   Replace the comments by a space, keeping the line breaks so the
+preprocessor lines stay on their own lines.
+*/
+{
+    std::string out;
+    out.reserve(text.size());
+    for (size_t i = 0; i < text.size(); i++)
+    {
+        if (text[i] == '"' || text[i] == '\'')
+        {
+            const char quote = text[i];
+            out += text[i++];
+            while (i < text.size() && text[i] != quote && text[i] != '\n')
+            {
+                if (text[i] == '\\' && i + 1 < text.size())
+                    out += text[i++];
+                out += text[i++];
+            }
+            if (i < text.size())
+                out += text[i];
+        }
+        else if (text.compare(i, 2, "//") == 0)
+        {
+            while (i < text.size() && text[i] != '\n')
+                i++;
+            out += '\n';
+        }
+        else if (text.compare(i, 2, "/*") == 0)
+        {
+            const size_t end = text.find("*/", i + 2);
+            const size_t stop = end == std::string::npos ? text.size() : end + 2;
+            out += ' ';
+            for (; i < stop; i++)
+            {
+                if (text[i] == '\n')
+                    out += '\n';
+            }
+            i = stop - 1;
+        }
+        else
+        {
+            out += text[i];
+        }
+    }
+    return out;
+}
+
+/*******************************************************************/
+/* Function definition */
+std::string Trim
+(
+const std::string &text   /* I: text */
+)
+/*
+DESCRIPTION:
+   Text without the leading and trailing blanks.
+*/
+{
+    size_t start = 0, end = text.size();
+    while (start < end && isspace((unsigned char)text[start]))
+        start++;
+    while (end > start && isspace((unsigned char)text[end - 1]))
+        end--;
+    return text.substr(start, end - start);
+}
+
+/*******************************************************************/
+/* Function definition */
+std::string Word
+(
+const std::string &text,   /* I: text */
+size_t start               /* I: start of the search */
+)
+/*
+DESCRIPTION:
+   First identifier from "start".
+*/
+{
+    while (start < text.size() && !(isalnum((unsigned char)text[start]) || text[start] == '_'))
+        start++;
+    size_t end = start;
+    while (end < text.size() && (isalnum((unsigned char)text[end]) || text[end] == '_'))
+        end++;
+    return text.substr(start, end - start);
+}
+
+/*******************************************************************/
+/* Function definition */
+std::string Condition
+(
+const std::vector<GenCondition> &stack   /* I: open conditionals */
+)
+/*
+DESCRIPTION:
+   Condition of the current line, the conditionals joined with "&&".
+*/
+{
+    std::string condition;
+    for (const GenCondition &open : stack)
+    {
+        if (open.ignored)
+            continue;
+        if (!condition.empty())
+            condition += " && ";
+        condition += open.text;
+    }
+    return condition;
+}
+
+/*******************************************************************/
+/* Function definition */
+int HeaderRead
+(
+const std::filesystem::path &path,   /* I: header */
+GenHeader *header                    /* O: include guard and functions */
+)
+/*
+DESCRIPTION:
+   Read the include guard and the ZW_API_C declarations of a header. The
+first conditional of the header is its include guard; it and the
+__cplusplus conditionals do not make conditions.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+        return 1;
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    const std::string text = CommentsStrip(buffer.str());
+
+    header->name = path.filename().string();
+    std::vector<GenCondition> stack;
+    std::string declaration;
+    int guardPending = 0, first = 1;
+    std::istringstream lines(text);
+    std::string line;
+    while (std::getline(lines, line))
+    {
+        const std::string trimmed = Trim(line);
+        if (!trimmed.empty() && trimmed[0] == '#')
+        {
+            const std::string directive = Word(trimmed, 1);
+            const size_t rest = trimmed.find(directive) + directive.size();
+            const std::string argument = Trim(trimmed.substr(rest));
+            if (directive == "define" && guardPending)
+                header->guardDefine = Word(argument, 0);
+            guardPending = 0;
+            if (directive == "ifdef" || directive == "ifndef" || directive == "if")
+            {
+                GenCondition open;
+                const std::string macro = Word(argument, 0);
+                open.ignored = first || macro == "__cplusplus";
+                if (directive == "ifdef")
+                    open.text = "defined " + macro;
+                else if (directive == "ifndef")
+                    open.text = "!defined " + macro;
+                else
+                    open.text = "(" + argument + ")";
+                if (first && directive == "ifndef")
+                {
+                    header->guardCheck = macro;
+                    guardPending = 1;
+                }
+                first = 0;
+                stack.push_back(open);
+            }
+            else if ((directive == "else" || directive == "elif") && !stack.empty())
+            {
+                GenCondition &open = stack.back();
+                open.text = "!(" + open.text + ")";
+                if (directive == "elif")
+                    open.text += " && (" + argument + ")";
+            }
+            else if (directive == "endif" && !stack.empty())
+            {
+                stack.pop_back();
+            }
+            continue;
+        }
+
+        /* a declaration runs from ZW_API_C to its ";" */
+        size_t at = 0;
+        if (declaration.empty())
+        {
+            at = line.find("ZW_API_C");
+            if (at == std::string::npos || Word(line, at) != "ZW_API_C")
+                continue;
+        }
+        declaration += line.substr(at) + " ";
+        if (declaration.find(';') == std::string::npos)
+            continue;
+        const size_t paren = declaration.find('(');
+        if (paren != std::string::npos)
+        {
+            size_t end = paren;
+            while (end > 0 && isspace((unsigned char)declaration[end - 1]))
+                end--;
+            size_t start = end;
+            while (start > 0 && (isalnum((unsigned char)declaration[start - 1]) || declaration[start - 1] == '_'))
+                start--;
+            GenFunction function;
+            function.name = declaration.substr(start, end - start);
+            function.condition = Condition(stack);
+            if (!function.name.empty() && declaration.find("...") == std::string::npos)
+                header->functions.push_back(function);
+        }
+        declaration.clear();
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void Conditional
+(
+std::ostream &out,               /* I/O: output */
+const std::string &condition,    /* I: condition of the next line */
+std::string *open                /* I/O: condition of the open #if */
+)
+/*
+DESCRIPTION:
+   Close the open #if and open the one of "condition" when they differ.
+*/
+{
+    if (condition == *open)
+        return;
+    if (!open->empty())
+        out << "#endif\n";
+    if (!condition.empty())
+        out << "#if " << condition << "\n";
+    *open = condition;
+}
+
+/*******************************************************************/
+/* Function definition */
+int main
+(
+int argc,        /* I: number of arguments */
+char **argv      /* I: arguments */
+)
+/*
+DESCRIPTION:
+   Write CallProfileApi.h from the API headers.
+*/
+{
+    if (argc < 3)
+    {
+        fprintf(stderr, "usage: ProfileGen <headers directory> <output header>\n");
+        return 2;
+    }
+
+    std::vector<std::filesystem::path> paths;
+    std::error_code error;
+    for (auto it = std::filesystem::recursive_directory_iterator(argv[1], error);
+         it != std::filesystem::recursive_directory_iterator(); it.increment(error))
+    {
+        if (it->is_regular_file() && it->path().extension() == ".h")
+            paths.push_back(it->path());
+    }
+    if (error || paths.empty())
+    {
+        fprintf(stderr, "ProfileGen: no headers in %s\n", argv[1]);
+        return 1;
+    }
+    std::sort(paths.begin(), paths.end(), [](const std::filesystem::path &a, const std::filesystem::path &b)
+              { return a.filename().string() < b.filename().string(); });
+
+    std::vector<GenHeader> headers(paths.size());
+    std::set<std::string> defined;
+    for (size_t i = 0; i < paths.size(); i++)
+    {
+        if (HeaderRead(paths[i], &headers[i]))
+        {
+            fprintf(stderr, "ProfileGen: cannot read %s\n", paths[i].string().c_str());
+            return 1;
+        }
+        defined.insert(headers[i].guardDefine);
+    }
+
+    /* a header testing the guard macro of another one must be included first */
+    std::stable_partition(headers.begin(), headers.end(), [&defined](const GenHeader &header)
+                          { return header.guardCheck != header.guardDefine && defined.count(header.guardCheck); });
+
+    std::ostringstream out;
+    out << "/*\n * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.\n*/\n\n";
+    out << "/* Generated by ProfileGen from the ZW_API_C declarations of headers\\, do not edit. */\n\n";
+    out << "/*******************************************************************/\n";
+    out << "/* ZW3D API includes */\n";
+    out << "#ifndef CALL_PROFILE_API_INCLUDES\n#define CALL_PROFILE_API_INCLUDES\n";
+    int count = 0;
+    for (const GenHeader &header : headers)
+    {
+        out << "#include \"" << header.name << "\"";
+        if (header.guardCheck != header.guardDefine && defined.count(header.guardCheck))
+            out << "   /* first, its include guard is the one of another header */";
+        out << "\n";
+        count += (int)header.functions.size();
+    }
+    out << "#endif\n\n";
+    out << "/*******************************************************************/\n";
+    out << "/* Constant definitions */\n";
+    out << "#define CALL_PROFILE_COUNT " << count << "   /* API functions */\n\n";
+
+    for (int pass = 0; pass < 2; pass++)
+    {
+        out << "/*******************************************************************/\n";
+        if (pass == 0)
+            out << "/* Function names, for CALL_PROFILE_NAME(id, name) */\n#if defined CALL_PROFILE_NAME\n";
+        else
+            out << "/* Redirections of the API functions to their profiling slots */\n"
+                   "#elif !defined CALL_PROFILE_REDIRECTS\n#define CALL_PROFILE_REDIRECTS\n";
+        int id = 0;
+        std::string open;
+        for (const GenHeader &header : headers)
+        {
+            for (const GenFunction &function : header.functions)
+            {
+                Conditional(out, function.condition, &open);
+                if (pass == 0)
+                    out << "CALL_PROFILE_NAME(" << id << ", " << function.name << ")\n";
+                else
+                    out << "#define " << function.name << " CALL_PROFILE_CALL(" << id << ", " << function.name << ")\n";
+                id++;
+            }
+        }
+        Conditional(out, "", &open);
+    }
+    out << "#endif\n";
+
+    std::ofstream file(argv[2], std::ios::binary);
+    file << out.str();
+    if (!file)
+    {
+        fprintf(stderr, "ProfileGen: cannot write %s\n", argv[2]);
+        return 1;
+    }
+    printf("%d functions of %d headers: %s\n", count, (int)headers.size(), argv[2]);
+    return 0;
+}
@@ -0,0 +1,175 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+#pragma once
+
+/* ZW3D API includes */
+#include "zwapi_command_data.h"
+
+/* Application includes */
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*******************************************************************/
+/* Constant definitions */
+#define COMMAND_BATCH_SIZE 64        /* default of the commands posted before an execution */
+
+/*******************************************************************/
+/* Data type definitions */
+/*
+DESCRIPTION:
+   Executor of command strings, ZwCommandPost() and
+ZwCommandPostExecuteAll() in ZW3D (see CommandBatch.cpp), or the
+CommandRecorder stand-in.
+*/
+class CommandExecutor
+{
+public:
+    virtual ~CommandExecutor() {}
+    virtual ezwErrors Post(const char *command, ezwCommandPostPriority priority) = 0;
+    virtual ezwErrors ExecuteAll(void) = 0;
+};
+
+/*
+DESCRIPTION:
+   Stand-in executor. It keeps the posted commands as ZW3D does, the high
+priority ones before the low priority ones and each in the order they
+were posted, and executes them in that order, appending them to the
+executed stream. Each execution waits "roundTrip" microseconds, the
+return to the event loop, and each command "command" microseconds.
+
+   If names are registered, posting a command of another name answers
+ZW_API_INVALID_NAME; the name of "~Name(text)" is "~Name".
+*/
+class CommandRecorder : public CommandExecutor
+{
+public:
+    CommandRecorder(double roundTrip = 0.0, double command = 0.0);
+
+    ezwErrors Post(const char *command, ezwCommandPostPriority priority) override;
+    ezwErrors ExecuteAll(void) override;
+
+    void Register(const char *name);
+    void Clear(void);
+
+    const std::vector<std::string> &Executed(void) const { return m_executed; }
+    int Executions(void) const { return m_executions; }
+    int Posts(void) const { return m_posts; }
+
+private:
+    double m_roundTrip;                 /* microsecond */
+    double m_command;                   /* microsecond */
+    std::vector<std::string> m_names;
+    std::vector<std::string> m_high;
+    std::vector<std::string> m_low;
+    std::vector<std::string> m_executed;
+    int m_executions;
+    int m_posts;
+};
+
+/* DESCRIPTION: a batch of a flush, as posted and executed */
+struct CommandBatchReport
+{
+    int commands;                       /* posted */
+    int failed;                         /* refused by the executor */
+    int skipped;                        /* not posted, a dependency failed */
+    double post;                        /* second, posting the commands */
+    double execute;                     /* second, executing them */
+};
+
+/* DESCRIPTION: counters of a pipeline since its creation */
+struct CommandPipelineStats
+{
+    long long added;
+    long long coalesced;                /* merged into a later identical command */
+    long long posted;
+    long long failed;
+    long long skipped;
+    long long batches;
+    double seconds;                     /* posting and executing */
+};
+
+/*
+DESCRIPTION:
+   Pipeline of command strings. Add() queues a command with a priority
+and the ids of the commands it must run after; Flush() orders the queued
+commands, the ready ones of highest priority first and in the order
+they were added otherwise, and posts them in batches of at most
+"batchSize" commands, each batch executed by one ExecuteAll(), one
+round-trip instead of one per command.
+
+   A command of priority above 0 is posted with
+ZW_COMMAND_POST_PRIORITY_HIGH. ZW3D runs the high priority commands of
+an execution first, so a batch is closed before a high priority command
+that follows a low priority one, which keeps the order of the flush.
+
+   Coalesced commands (redraws, regenerations) only need to run once
+after the commands queued before them: adding one while an identical
+one is queued, with no queued command depending on it, removes the
+queued one. The later one takes its dependencies and answers its id.
+
+   A command refused by the executor fails, and the commands depending
+on it, directly or not, are skipped. Dependencies on commands of earlier
+flushes only wait for their result.
+*/
+class CommandPipeline
+{
+public:
+    CommandPipeline(CommandExecutor *executor, int batchSize = COMMAND_BATCH_SIZE);
+
+    void Coalesce(const char *command);
+    int Add(const char *command, int priority = 0, const int *depends = nullptr, int dependCount = 0);
+    int Flush(std::vector<CommandBatchReport> *reports = nullptr);
+
+    int Pending(void) const { return m_pending; }
+    const CommandPipelineStats &Stats(void) const { return m_stats; }
+
+private:
+    /* DESCRIPTION: a queued command */
+    struct Entry
+    {
+        std::string command;
+        int id;
+        int priority;
+        int coalesced;                  /* removed by a later identical command */
+        int dependents;                 /* queued commands depending on it */
+        std::vector<int> depends;       /* ids of queued or done commands */
+    };
+
+    /* DESCRIPTION: state of a command id, indexed by id */
+    enum State
+    {
+        State_Queued = 0,
+        State_Done,
+        State_Failed                    /* refused, or skipped */
+    };
+
+    int Resolve(int id) const;
+
+    CommandExecutor *m_executor;
+    int m_batchSize;
+    std::vector<std::string> m_coalesce;
+    std::vector<Entry> m_queue;
+    std::unordered_map<std::string, int> m_queuedCoalesce;   /* command -> index in m_queue */
+    std::vector<int> m_alias;           /* id -> id of the command answering it */
+    std::vector<char> m_state;          /* id -> State */
+    std::vector<int> m_index;           /* id -> index in m_queue while queued */
+    int m_pending;
+    CommandPipelineStats m_stats;
+};
+
+/*******************************************************************/
+/* Function declarations */
+/*
+DESCRIPTION:
+   Queue the commands of a command file: one command a line, optionally
+followed by a tab, its priority and a tab, and the line numbers of the
+commands it runs after, separated by commas. A line "#coalesce command"
+coalesces the command, other lines starting with "#" and empty lines are
+ignored; lines listed as dependencies must be commands of earlier lines.
+
+   Return the number of commands queued, -1 if the file fails.
+*/
+int CommandFileLoad(const char *path, CommandPipeline *pipeline, int *errorLine);
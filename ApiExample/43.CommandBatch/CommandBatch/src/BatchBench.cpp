@@ -0,0 +1,408 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+#include "CommandPipeline.h"
+
+/*
+DESCRIPTION:
+   Benchmark and check of the command pipeline against the stand-in
+executor, the "BatchBench" tool of the Linux build:
+
+   BatchBench [commands] [round trip us] [command us] [batch size]
+   BatchBench -f <command file> [batch size]
+
+   It posts a chain of steps, each followed by a redraw, one at a time
+(one execution per command), then through the pipeline, and a job of
+random dependencies, priorities, regenerations and unknown commands
+through the pipeline. It prints the times and the batches and checks the
+executed streams: every command after the commands it depends on, the
+failed and skipped commands not executed, a redraw after every step.
+It exits with 1 if a check fails. With a command file, it prints the
+executed stream of the file.
+*/
+
+/*******************************************************************/
+/* Constant definitions */
+#define DEFAULT_COMMANDS 1000
+#define DEFAULT_ROUND_TRIP 200.0     /* microsecond, an event loop round-trip of ZW3D */
+#define DEFAULT_COMMAND 2.0          /* microsecond */
+#define REDRAW "~BenchRedraw"
+#define REGEN "~BenchRegen"
+#define COMMAND_SIZE 64
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: a command of a job, as the bench expects it to run */
+struct BenchCommand
+{
+    std::string command;
+    int id;                          /* id of the pipeline */
+    int unknown;                     /* refused by the executor */
+    std::vector<int> depends;        /* indexes of the job */
+};
+
+/*******************************************************************/
+/* Function declarations */
+static double Seconds(std::chrono::steady_clock::time_point start);
+static unsigned int Random(unsigned int *seed);
+static void ReportPrint(const char *name, double time, const CommandRecorder &recorder,
+                        const std::vector<CommandBatchReport> &reports, const CommandPipelineStats &stats);
+static int StreamCheck(const char *name, const std::vector<BenchCommand> &job, const std::vector<std::string> &executed);
+static int ChainBench(int commands, double roundTrip, double command, int batchSize);
+static int JobBench(int commands, double roundTrip, double command, int batchSize);
+static int FileRun(const char *path, int batchSize);
+
+/*******************************************************************/
+/* Function definition */
+double Seconds
+(
+std::chrono::steady_clock::time_point start   /* I: start time */
+)
+/*
+DESCRIPTION:
+   Seconds elapsed since "start".
+*/
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*******************************************************************/
+/* Function definition */
+unsigned int Random
+(
+unsigned int *seed   /* I/O: state */
+)
+/*
+DESCRIPTION:
+   Linear congruential generator, the same job on every platform.
+*/
+{
+    *seed = *seed * 1664525u + 1013904223u;
+    return *seed >> 8;
+}
+
+/*******************************************************************/
+/* Function definition */
+void ReportPrint
+(
+const char *name,                                 /* I: name of the run */
+double time,                                      /* I: seconds of the run */
+const CommandRecorder &recorder,                  /* I: executor of the run */
+const std::vector<CommandBatchReport> &reports,   /* I: batches of the flush */
+const CommandPipelineStats &stats                 /* I: counters of the pipeline */
+)
+/*
+DESCRIPTION:
+   Print the time and the batches of a run of the pipeline.
+*/
+{
+    printf("%-10s %9.3f ms, %6d executions, %6lld added, %5lld coalesced, %6lld posted, %4lld failed, %4lld skipped\n",
+           name, time * 1e3, recorder.Executions(), stats.added, stats.coalesced, stats.posted, stats.failed,
+           stats.skipped);
+    double worst = 0.0, total = 0.0;
+    for (const CommandBatchReport &report : reports)
+    {
+        const double latency = report.post + report.execute;
+        total += latency;
+        if (latency > worst)
+            worst = latency;
+    }
+    if (!reports.empty())
+        printf("           %zu batches, latency mean %.3f ms, max %.3f ms\n", reports.size(),
+               total * 1e3 / (double)reports.size(), worst * 1e3);
+}
+
+/*******************************************************************/
+/* Function definition */
+int StreamCheck
+(
+const char *name,                           /* I: name of the run */
+const std::vector<BenchCommand> &job,       /* I: commands of the job, unique but the redraws and regenerations */
+const std::vector<std::string> &executed    /* I: executed stream */
+)
+/*
+DESCRIPTION:
+   Check an executed stream against its job: each unique command runs
+once, after the commands it depends on, unless it or a dependency is
+unknown; a redraw runs after the last step.
+
+   Return 1 if a check fails, else 0.
+*/
+{
+    std::map<std::string, int> position;
+    int lastRedraw = -1, lastStep = -1;
+    for (int i = 0; i < (int)executed.size(); i++)
+    {
+        if (executed[i] == REDRAW)
+            lastRedraw = i;
+        else if (executed[i] != REGEN)
+        {
+            if (!position.emplace(executed[i], i).second)
+            {
+                printf("%s: %s executed twice\n", name, executed[i].c_str());
+                return 1;
+            }
+            lastStep = i;
+        }
+    }
+
+    std::vector<int> runs(job.size(), 0);
+    for (size_t i = 0; i < job.size(); i++)
+    {
+        const BenchCommand &command = job[i];
+        int expected = !command.unknown;
+        for (int depend : command.depends)
+            expected &= runs[depend];
+        runs[i] = expected;
+        if (command.command == REDRAW || command.command == REGEN)
+            continue;
+
+        auto found = position.find(command.command);
+        if ((found != position.end()) != (expected != 0))
+        {
+            printf("%s: %s %s\n", name, command.command.c_str(), expected ? "not executed" : "executed");
+            return 1;
+        }
+        if (found == position.end())
+            continue;
+        for (int depend : command.depends)
+        {
+            auto before = position.find(job[depend].command);
+            if (before != position.end() && before->second > found->second)
+            {
+                printf("%s: %s before %s\n", name, command.command.c_str(), job[depend].command.c_str());
+                return 1;
+            }
+        }
+    }
+    if (lastStep >= 0 && lastRedraw < lastStep)
+    {
+        printf("%s: no redraw after %s\n", name, executed[lastStep].c_str());
+        return 1;
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int ChainBench
+(
+int commands,        /* I: steps */
+double roundTrip,    /* I: wait of an execution (microsecond) */
+double command,      /* I: wait of a command (microsecond) */
+int batchSize        /* I: most commands of a batch */
+)
+/*
+DESCRIPTION:
+   Post a chain of steps, each followed by a redraw, one at a time, then
+through the pipeline, and check the stream of the pipeline.
+
+   Return 1 if a check fails, else 0.
+*/
+{
+    char text[COMMAND_SIZE];
+    std::vector<BenchCommand> job;
+    for (int i = 0; i < commands; i++)
+    {
+        snprintf(text, COMMAND_SIZE, "~BenchStep(%d)", i + 1);
+        BenchCommand step = { text, 0, 0, {} };
+        if (i > 0)
+            step.depends.push_back((int)job.size() - 2);
+        job.push_back(step);
+        BenchCommand redraw = { REDRAW, 0, 0, { (int)job.size() - 1 } };
+        job.push_back(redraw);
+    }
+
+    /* one at a time */
+    CommandRecorder single(roundTrip, command);
+    auto start = std::chrono::steady_clock::now();
+    for (const BenchCommand &step : job)
+    {
+        single.Post(step.command.c_str(), ZW_COMMAND_POST_PRIORITY_LOW);
+        single.ExecuteAll();
+    }
+    const double singleTime = Seconds(start);
+    printf("%-10s %9.3f ms, %6d executions, %6zu posted\n", "single", singleTime * 1e3, single.Executions(),
+           job.size());
+
+    /* pipeline */
+    CommandRecorder recorder(roundTrip, command);
+    start = std::chrono::steady_clock::now();
+    CommandPipeline pipeline(&recorder, batchSize);
+    pipeline.Coalesce(REDRAW);
+    for (BenchCommand &step : job)
+    {
+        std::vector<int> depends;
+        for (int depend : step.depends)
+            depends.push_back(job[depend].id);
+        step.id = pipeline.Add(step.command.c_str(), 0, depends.data(), (int)depends.size());
+    }
+    std::vector<CommandBatchReport> reports;
+    const int failed = pipeline.Flush(&reports);
+    const double time = Seconds(start);
+    ReportPrint("chain", time, recorder, reports, pipeline.Stats());
+    printf("           %.1fx faster than one at a time\n", time > 0.0 ? singleTime / time : 0.0);
+    return failed || StreamCheck("chain", job, recorder.Executed());
+}
+
+/*******************************************************************/
+/* Function definition */
+int JobBench
+(
+int commands,        /* I: commands of the job */
+double roundTrip,    /* I: wait of an execution (microsecond) */
+double command,      /* I: wait of a command (microsecond) */
+int batchSize        /* I: most commands of a batch */
+)
+/*
+DESCRIPTION:
+   Run a job of random dependencies on earlier commands, random
+priorities, a redraw or a regeneration after some commands and a few
+commands of an unknown name through the pipeline, flushed every quarter
+of the job, and check the stream.
+
+   Return 1 if a check fails, else 0.
+*/
+{
+    char text[COMMAND_SIZE];
+    unsigned int seed = 12345;
+    std::vector<BenchCommand> job;
+    CommandRecorder recorder(roundTrip, command);
+    recorder.Register("~BenchStep");
+    recorder.Register(REDRAW);
+    recorder.Register(REGEN);
+    CommandPipeline pipeline(&recorder, batchSize);
+    pipeline.Coalesce(REDRAW);
+    pipeline.Coalesce(REGEN);
+
+    std::vector<CommandBatchReport> reports, flushReports;
+    const auto start = std::chrono::steady_clock::now();
+    const int flushEvery = commands / 4 > 0 ? commands / 4 : 1;
+    for (int i = 0; i < commands; i++)
+    {
+        BenchCommand step = { "", 0, 0, {} };
+        step.unknown = Random(&seed) % 100 == 0;
+        snprintf(text, COMMAND_SIZE, "%s(%d)", step.unknown ? "~BenchUnknown" : "~BenchStep", i + 1);
+        step.command = text;
+        const int dependCount = (int)(Random(&seed) % 3);
+        for (int d = 0; d < dependCount && !job.empty(); d++)
+        {
+            const int depend = (int)job.size() - 1 - (int)(Random(&seed) % (job.size() < 50 ? job.size() : 50));
+            if (job[depend].command != REDRAW && job[depend].command != REGEN)
+                step.depends.push_back(depend);
+        }
+        const int priority = Random(&seed) % 10 == 0 ? 1 : (int)(Random(&seed) % 3) - 1;
+        std::vector<int> depends;
+        for (int depend : step.depends)
+            depends.push_back(job[depend].id);
+        step.id = pipeline.Add(step.command.c_str(), priority, depends.data(), (int)depends.size());
+        job.push_back(step);
+
+        const unsigned int after = Random(&seed) % 4;
+        if (after < 2)
+        {
+            /* redraw or regeneration after the step, at its priority */
+            const int last = (int)job.size() - 1;
+            BenchCommand follow = { after == 0 ? REDRAW : REGEN, 0, 0, { last } };
+            follow.id = pipeline.Add(follow.command.c_str(), priority, &job[last].id, 1);
+            job.push_back(follow);
+        }
+        if ((i + 1) % flushEvery == 0 || i + 1 == commands)
+        {
+            pipeline.Flush(&flushReports);
+            reports.insert(reports.end(), flushReports.begin(), flushReports.end());
+        }
+    }
+    if (pipeline.Flush(&flushReports) || !flushReports.empty())
+    {
+        printf("job: commands left after the last flush\n");
+        return 1;
+    }
+    BenchCommand redraw = { REDRAW, 0, 0, {} };
+    job.push_back(redraw);
+    pipeline.Add(REDRAW);
+    pipeline.Flush(&flushReports);
+    reports.insert(reports.end(), flushReports.begin(), flushReports.end());
+    ReportPrint("job", Seconds(start), recorder, reports, pipeline.Stats());
+    return StreamCheck("job", job, recorder.Executed());
+}
+
+/*******************************************************************/
+/* Function definition */
+int FileRun
+(
+const char *path,    /* I: command file */
+int batchSize        /* I: most commands of a batch */
+)
+/*
+DESCRIPTION:
+   Run a command file through the pipeline and print the executed
+stream.
+
+   Return 1 if the file fails, else 0.
+*/
+{
+    CommandRecorder recorder;
+    CommandPipeline pipeline(&recorder, batchSize);
+    int errorLine = 0;
+    if (CommandFileLoad(path, &pipeline, &errorLine) < 0)
+    {
+        if (errorLine > 0)
+            fprintf(stderr, "BatchBench: %s, line %d: bad command or dependency\n", path, errorLine);
+        else
+            fprintf(stderr, "BatchBench: cannot read %s\n", path);
+        return 1;
+    }
+    std::vector<CommandBatchReport> reports;
+    const auto start = std::chrono::steady_clock::now();
+    pipeline.Flush(&reports);
+    ReportPrint("file", Seconds(start), recorder, reports, pipeline.Stats());
+    for (const std::string &command : recorder.Executed())
+        printf("%s\n", command.c_str());
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int main
+(
+int argc,        /* I: number of arguments */
+char **argv      /* I: arguments */
+)
+/*
+DESCRIPTION:
+   Run the benchmarks, or a command file.
+*/
+{
+    if (argc > 1 && strcmp(argv[1], "-f") == 0)
+    {
+        if (argc < 3)
+        {
+            fprintf(stderr, "usage: BatchBench -f <command file> [batch size]\n");
+            return 2;
+        }
+        return FileRun(argv[2], argc > 3 ? atoi(argv[3]) : COMMAND_BATCH_SIZE);
+    }
+    const int commands = argc > 1 ? atoi(argv[1]) : DEFAULT_COMMANDS;
+    const double roundTrip = argc > 2 ? atof(argv[2]) : DEFAULT_ROUND_TRIP;
+    const double command = argc > 3 ? atof(argv[3]) : DEFAULT_COMMAND;
+    const int batchSize = argc > 4 ? atoi(argv[4]) : COMMAND_BATCH_SIZE;
+    if (commands <= 0)
+    {
+        fprintf(stderr, "usage: BatchBench [commands] [round trip us] [command us] [batch size]\n");
+        return 2;
+    }
+    int failed = ChainBench(commands, roundTrip, command, batchSize);
+    failed |= JobBench(commands, roundTrip, command, batchSize);
+    return failed ? 1 : 0;
+}
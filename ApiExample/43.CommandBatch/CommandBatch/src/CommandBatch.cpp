@@ -0,0 +1,257 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* ZW3D API includes */
+#include "zwapi_display.h"
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+#include "..\inc\CommandBatchPr.h"
+#include "..\inc\CommandPipeline.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define MESSAGE_SIZE 256
+#define COMMAND_SIZE 64
+#define STEP_COUNT 40                /* steps of the "~CommandBatch" demonstration */
+#define REDRAW_COMMAND "~CommandBatchRedraw"
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: executor of ZW3D, ZwCommandPost() and ZwCommandPostExecuteAll() */
+class ZwCommandExecutor : public CommandExecutor
+{
+public:
+    ezwErrors Post(const char *command, ezwCommandPostPriority priority) override
+    {
+        return ZwCommandPost(command, priority);
+    }
+
+    ezwErrors ExecuteAll(void) override
+    {
+        return ZwCommandPostExecuteAll();
+    }
+};
+
+/*******************************************************************/
+/* Variable definitions */
+static int s_steps = 0;              /* steps run by "~CommandBatchStep" */
+static int s_redraws = 0;            /* redraws run by "~CommandBatchRedraw" */
+
+/*******************************************************************/
+/* Function declarations */
+static void CommandBatch(void);
+static void CommandBatchFile(char *path);
+static void CommandBatchStep(char *text);
+static void CommandBatchRedraw(void);
+static void ReportDisplay(const std::vector<CommandBatchReport> &reports, const CommandPipelineStats &stats);
+static double Seconds(std::chrono::steady_clock::time_point start);
+
+/*******************************************************************/
+/* Function definition */
+int RegisterCommandBatch
+(
+void
+)
+/*
+DESCRIPTION:
+   Register the commands of the command batch example.
+*/
+{
+    /* Compare posting commands one at a time and in batches by entering "~CommandBatch" */
+    ZwCommandFunctionLoad("CommandBatch", (void *)CommandBatch, ZW_LICENSE_CODE_GENERAL);
+
+    /* Run a command file in batches by entering "~CommandBatchFile(path)", for zw3dremote */
+    ZwCommandFunctionLoad("CommandBatchFile", (void *)CommandBatchFile, ZW_LICENSE_CODE_GENERAL);
+
+    /* the commands queued by "~CommandBatch" */
+    ZwCommandFunctionLoad("CommandBatchStep", (void *)CommandBatchStep, ZW_LICENSE_CODE_GENERAL);
+    ZwCommandFunctionLoad("CommandBatchRedraw", (void *)CommandBatchRedraw, ZW_LICENSE_CODE_GENERAL);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int UnloadCommandBatch
+(
+void
+)
+/*
+DESCRIPTION:
+   Unload the commands of the command batch example.
+*/
+{
+    ZwCommandFunctionUnload("CommandBatch");
+    ZwCommandFunctionUnload("CommandBatchFile");
+    ZwCommandFunctionUnload("CommandBatchStep");
+    ZwCommandFunctionUnload("CommandBatchRedraw");
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+double Seconds
+(
+std::chrono::steady_clock::time_point start   /* I: start time */
+)
+/*
+DESCRIPTION:
+   Seconds elapsed since "start".
+*/
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*******************************************************************/
+/* Function definition */
+void CommandBatchStep
+(
+char * /* text */   /* I: text of "~CommandBatchStep(text)", not used */
+)
+/*
+DESCRIPTION:
+   A step of the demonstration, counted.
+*/
+{
+    s_steps++;
+}
+
+/*******************************************************************/
+/* Function definition */
+void CommandBatchRedraw
+(
+void
+)
+/*
+DESCRIPTION:
+   Redraw the active window, counted.
+*/
+{
+    cvxDispRedraw();
+    s_redraws++;
+}
+
+/*******************************************************************/
+/* Function definition */
+void ReportDisplay
+(
+const std::vector<CommandBatchReport> &reports,   /* I: batches of a flush */
+const CommandPipelineStats &stats                 /* I: counters of the pipeline */
+)
+/*
+DESCRIPTION:
+   Display the latency of each batch and the counters.
+*/
+{
+    char message[MESSAGE_SIZE];
+    for (size_t i = 0; i < reports.size(); i++)
+    {
+        const CommandBatchReport &report = reports[i];
+        sprintf_s(message, MESSAGE_SIZE, "batch %d: %d commands, post %.3f ms, execute %.3f ms, failed %d, skipped %d",
+                  (int)i + 1, report.commands, report.post * 1e3, report.execute * 1e3, report.failed, report.skipped);
+        cvxMsgDisp(message);
+    }
+    sprintf_s(message, MESSAGE_SIZE, "%lld added, %lld coalesced, %lld posted in %lld batches, %.3f ms",
+              stats.added, stats.coalesced, stats.posted, stats.batches, stats.seconds * 1e3);
+    cvxMsgDisp(message);
+}
+
+/*******************************************************************/
+/* Function definition */
+void CommandBatch
+(
+void
+)
+/*
+DESCRIPTION:
+   Run a chain of steps, each followed by a redraw, posted and executed
+one at a time as an automation sending command strings does, then
+through the pipeline, which coalesces the redraws and executes the
+chain in batches.
+*/
+{
+    char message[MESSAGE_SIZE], command[COMMAND_SIZE];
+    ZwCommandExecutor executor;
+
+    /* one at a time, one execution per command */
+    s_steps = s_redraws = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < STEP_COUNT; i++)
+    {
+        sprintf_s(command, COMMAND_SIZE, "~CommandBatchStep(%d)", i + 1);
+        executor.Post(command, ZW_COMMAND_POST_PRIORITY_LOW);
+        executor.ExecuteAll();
+        executor.Post(REDRAW_COMMAND, ZW_COMMAND_POST_PRIORITY_LOW);
+        executor.ExecuteAll();
+    }
+    sprintf_s(message, MESSAGE_SIZE, "One at a time: %d steps, %d redraws, %.3f ms", s_steps, s_redraws,
+              Seconds(start) * 1e3);
+    cvxMsgDisp(message);
+
+    /* pipeline */
+    s_steps = s_redraws = 0;
+    start = std::chrono::steady_clock::now();
+    CommandPipeline pipeline(&executor);
+    pipeline.Coalesce(REDRAW_COMMAND);
+    int previous = 0;
+    for (int i = 0; i < STEP_COUNT; i++)
+    {
+        sprintf_s(command, COMMAND_SIZE, "~CommandBatchStep(%d)", i + 1);
+        previous = pipeline.Add(command, 0, previous ? &previous : nullptr, previous ? 1 : 0);
+        pipeline.Add(REDRAW_COMMAND, 0, &previous, 1);
+    }
+    std::vector<CommandBatchReport> reports;
+    pipeline.Flush(&reports);
+    sprintf_s(message, MESSAGE_SIZE, "Pipeline: %d steps, %d redraws, %.3f ms", s_steps, s_redraws,
+              Seconds(start) * 1e3);
+    cvxMsgDisp(message);
+    ReportDisplay(reports, pipeline.Stats());
+}
+
+/*******************************************************************/
+/* Function definition */
+void CommandBatchFile
+(
+char *path   /* I: command file of "~CommandBatchFile(path)" */
+)
+/*
+DESCRIPTION:
+   Queue the commands of a command file (see CommandFileLoad()) and run
+them in batches, so a remote automation sends one command string for a
+whole job.
+*/
+{
+    char message[MESSAGE_SIZE];
+    if (!path || !path[0])
+    {
+        cvxMsgDisp("Usage: ~CommandBatchFile(path of a command file)");
+        return;
+    }
+    std::string file = path;
+    if (file.size() >= 2 && file.front() == '"' && file.back() == '"')
+        file = file.substr(1, file.size() - 2);
+
+    ZwCommandExecutor executor;
+    CommandPipeline pipeline(&executor);
+    int errorLine = 0;
+    const int count = CommandFileLoad(file.c_str(), &pipeline, &errorLine);
+    if (count < 0)
+    {
+        if (errorLine > 0)
+            sprintf_s(message, MESSAGE_SIZE, "%s, line %d: bad command or dependency", file.c_str(), errorLine);
+        else
+            sprintf_s(message, MESSAGE_SIZE, "Cannot read %s", file.c_str());
+        cvxMsgDisp(message);
+        return;
+    }
+    std::vector<CommandBatchReport> reports;
+    if (pipeline.Flush(&reports))
+        cvxMsgDisp("Some commands failed or were skipped");
+    ReportDisplay(reports, pipeline.Stats());
+}
@@ -0,0 +1,521 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <queue>
+#include "CommandPipeline.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define LINE_SIZE 4096               /* longest line of a command file */
+#define COALESCE_DIRECTIVE "#coalesce "
+
+/*******************************************************************/
+/* Function declarations */
+static double Seconds(std::chrono::steady_clock::time_point start);
+static void Wait(double micros);
+static std::string CommandName(const char *command);
+static FILE *FileOpen(const char *path, const char *mode);
+
+/*******************************************************************/
+/* Function definition */
+double Seconds
+(
+std::chrono::steady_clock::time_point start   /* I: start time */
+)
+/*
+DESCRIPTION:
+   Seconds elapsed since "start".
+*/
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*******************************************************************/
+/* Function definition */
+void Wait
+(
+double micros   /* I: time to wait (microsecond) */
+)
+/*
+DESCRIPTION:
+   Busy-wait "micros" microseconds. Sleeping would round short waits up
+to the scheduler tick.
+*/
+{
+    if (micros <= 0.0)
+        return;
+    const auto end = std::chrono::steady_clock::now() +
+                     std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                         std::chrono::duration<double, std::micro>(micros));
+    while (std::chrono::steady_clock::now() < end)
+    {
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+std::string CommandName
+(
+const char *command   /* I: command string */
+)
+/*
+DESCRIPTION:
+   Name of a command, the string before its "(" argument.
+*/
+{
+    const char *paren = strchr(command, '(');
+    return paren ? std::string(command, paren - command) : std::string(command);
+}
+
+/*******************************************************************/
+/* Function definition */
+FILE *FileOpen
+(
+const char *path,   /* I: file path */
+const char *mode    /* I: fopen() mode */
+)
+/*
+DESCRIPTION:
+   Open a file, NULL if it fails.
+*/
+{
+#ifdef _MSC_VER
+    FILE *file = nullptr;
+    return fopen_s(&file, path, mode) ? nullptr : file;
+#else
+    return fopen(path, mode);
+#endif
+}
+
+/*******************************************************************/
+/* Function definition */
+CommandRecorder::CommandRecorder
+(
+double roundTrip,   /* I: wait of an execution (microsecond) */
+double command      /* I: wait of a command (microsecond) */
+)
+/*
+DESCRIPTION:
+   Stand-in executor with no registered name and nothing executed.
+*/
+    : m_roundTrip(roundTrip), m_command(command), m_executions(0), m_posts(0)
+{
+}
+
+/*******************************************************************/
+/* Function definition */
+ezwErrors CommandRecorder::Post
+(
+const char *command,               /* I: command string */
+ezwCommandPostPriority priority    /* I: priority of execution */
+)
+/*
+DESCRIPTION:
+   Keep a command for the next execution, as ZwCommandPost() does.
+*/
+{
+    if (!command || !command[0])
+        return ZW_API_INVALID_INPUT;
+    if (!m_names.empty() && std::find(m_names.begin(), m_names.end(), CommandName(command)) == m_names.end())
+        return ZW_API_INVALID_NAME;
+    (priority == ZW_COMMAND_POST_PRIORITY_HIGH ? m_high : m_low).push_back(command);
+    m_posts++;
+    return ZW_API_NO_ERROR;
+}
+
+/*******************************************************************/
+/* Function definition */
+ezwErrors CommandRecorder::ExecuteAll
+(
+void
+)
+/*
+DESCRIPTION:
+   Execute the kept commands, the high priority ones first, as
+ZwCommandPostExecuteAll() does.
+*/
+{
+    Wait(m_roundTrip);
+    for (std::vector<std::string> *posted : { &m_high, &m_low })
+    {
+        for (const std::string &command : *posted)
+        {
+            Wait(m_command);
+            m_executed.push_back(command);
+        }
+        posted->clear();
+    }
+    m_executions++;
+    return ZW_API_NO_ERROR;
+}
+
+/*******************************************************************/
+/* Function definition */
+void CommandRecorder::Register
+(
+const char *name   /* I: command name, "~Name" or "!Template" */
+)
+/*
+DESCRIPTION:
+   Accept the commands of a name; once a name is registered, the others
+are refused.
+*/
+{
+    m_names.push_back(name);
+}
+
+/*******************************************************************/
+/* Function definition */
+void CommandRecorder::Clear
+(
+void
+)
+/*
+DESCRIPTION:
+   Forget the kept and the executed commands and the counters; the
+registered names stay.
+*/
+{
+    m_high.clear();
+    m_low.clear();
+    m_executed.clear();
+    m_executions = 0;
+    m_posts = 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+CommandPipeline::CommandPipeline
+(
+CommandExecutor *executor,   /* I: executor of the batches */
+int batchSize                /* I: most commands of a batch */
+)
+/*
+DESCRIPTION:
+   Empty pipeline. Id 0 is never given, so it is reserved in the tables
+indexed by id.
+*/
+    : m_executor(executor), m_batchSize(batchSize > 0 ? batchSize : 1), m_alias(1, 0), m_state(1, State_Failed),
+      m_index(1, -1), m_pending(0)
+{
+    memset(&m_stats, 0, sizeof(m_stats));
+}
+
+/*******************************************************************/
+/* Function definition */
+void CommandPipeline::Coalesce
+(
+const char *command   /* I: command string */
+)
+/*
+DESCRIPTION:
+   Coalesce the queued copies of a command, as a redraw or a
+regeneration.
+*/
+{
+    if (command && command[0])
+        m_coalesce.push_back(command);
+}
+
+/*******************************************************************/
+/* Function definition */
+int CommandPipeline::Resolve
+(
+int id   /* I: command id */
+) const
+/*
+DESCRIPTION:
+   Id of the command answering "id", itself unless it was coalesced.
+*/
+{
+    while (m_alias[id] != id)
+        id = m_alias[id];
+    return id;
+}
+
+/*******************************************************************/
+/* Function definition */
+int CommandPipeline::Add
+(
+const char *command,   /* I: command string */
+int priority,          /* I: priority, the higher the earlier; above 0 posted as high priority */
+const int *depends,    /* I: ids of the commands to run after */
+int dependCount        /* I: number of ids */
+)
+/*
+DESCRIPTION:
+   Queue a command until the next flush.
+
+   Return the id of the command, 0 if the command is empty or an id is
+not one of this pipeline.
+*/
+{
+    if (!command || !command[0] || dependCount < 0 || (dependCount > 0 && !depends))
+        return 0;
+    for (int i = 0; i < dependCount; i++)
+    {
+        if (depends[i] <= 0 || depends[i] >= (int)m_alias.size())
+            return 0;
+    }
+
+    const int id = (int)m_alias.size();
+    Entry entry;
+    entry.command = command;
+    entry.id = id;
+    entry.priority = priority;
+    entry.coalesced = 0;
+    entry.dependents = 0;
+    for (int i = 0; i < dependCount; i++)
+    {
+        const int depend = Resolve(depends[i]);
+        if (std::find(entry.depends.begin(), entry.depends.end(), depend) != entry.depends.end())
+            continue;
+        entry.depends.push_back(depend);
+        if (m_state[depend] == State_Queued)
+            m_queue[m_index[depend]].dependents++;
+    }
+
+    const int index = (int)m_queue.size();
+    m_alias.push_back(id);
+    m_state.push_back(State_Queued);
+    m_index.push_back(index);
+    m_stats.added++;
+    m_pending++;
+
+    if (std::find(m_coalesce.begin(), m_coalesce.end(), entry.command) != m_coalesce.end())
+    {
+        auto found = m_queuedCoalesce.find(entry.command);
+        if (found != m_queuedCoalesce.end() && m_queue[found->second].dependents == 0)
+        {
+            /* the earlier copy leaves the queue, its dependencies move to this one; a
+               dependency listed twice is only waited for twice, so they are not merged */
+            Entry &earlier = m_queue[found->second];
+            earlier.coalesced = 1;
+            earlier.depends.insert(earlier.depends.end(), entry.depends.begin(), entry.depends.end());
+            entry.depends.swap(earlier.depends);
+            m_alias[earlier.id] = id;
+            m_pending--;
+            m_stats.coalesced++;
+        }
+        m_queuedCoalesce[entry.command] = index;
+    }
+    m_queue.push_back(entry);
+    return id;
+}
+
+/*******************************************************************/
+/* Function definition */
+int CommandPipeline::Flush
+(
+std::vector<CommandBatchReport> *reports   /* O: batches of the flush (optional) */
+)
+/*
+DESCRIPTION:
+   Post and execute the queued commands in batches, as described in
+CommandPipeline.h. The commands posted to ZW3D by others before the
+flush are executed with the first batch.
+
+   Return 1 if a command failed or was skipped, else 0.
+*/
+{
+    if (reports)
+        reports->clear();
+
+    /* order: ready commands by priority, then by id (Kahn's algorithm) */
+    const int count = (int)m_queue.size();
+    std::vector<int> waiting(count, 0);
+    std::vector<std::vector<int>> next(count);
+    for (int i = 0; i < count; i++)
+    {
+        if (m_queue[i].coalesced)
+            continue;
+        for (int depend : m_queue[i].depends)
+        {
+            if (m_state[depend] == State_Queued)
+            {
+                waiting[i]++;
+                next[m_index[depend]].push_back(i);
+            }
+        }
+    }
+    auto later = [this](int a, int b)
+    {
+        if (m_queue[a].priority != m_queue[b].priority)
+            return m_queue[a].priority < m_queue[b].priority;
+        return m_queue[a].id > m_queue[b].id;
+    };
+    std::priority_queue<int, std::vector<int>, decltype(later)> ready(later);
+    for (int i = 0; i < count; i++)
+    {
+        if (!m_queue[i].coalesced && waiting[i] == 0)
+            ready.push(i);
+    }
+    std::vector<int> order;
+    order.reserve(m_pending);
+    while (!ready.empty())
+    {
+        const int i = ready.top();
+        ready.pop();
+        order.push_back(i);
+        for (int j : next[i])
+        {
+            if (--waiting[j] == 0)
+                ready.push(j);
+        }
+    }
+
+    /* post, executing a batch when it is full or before a high priority command following a low one */
+    int failed = 0, lowPosted = 0;
+    std::vector<int> batch;
+    CommandBatchReport report = {};
+    auto execute = [&]()
+    {
+        if (!batch.empty())
+        {
+            const auto start = std::chrono::steady_clock::now();
+            const int error = m_executor->ExecuteAll() != ZW_API_NO_ERROR;
+            report.execute = Seconds(start);
+            for (int i : batch)
+                m_state[m_queue[i].id] = error ? State_Failed : State_Done;
+            if (error)
+            {
+                report.failed += (int)batch.size();
+                failed = 1;
+            }
+        }
+        if (report.commands > 0 || report.failed > 0 || report.skipped > 0)
+        {
+            m_stats.posted += report.commands;
+            m_stats.failed += report.failed;
+            m_stats.skipped += report.skipped;
+            m_stats.batches++;
+            m_stats.seconds += report.post + report.execute;
+            if (reports)
+                reports->push_back(report);
+        }
+        batch.clear();
+        report = CommandBatchReport();
+        lowPosted = 0;
+    };
+
+    for (int i : order)
+    {
+        const Entry &entry = m_queue[i];
+        int dependFailed = 0;
+        for (int depend : entry.depends)
+            dependFailed |= m_state[depend] == State_Failed;
+        if (dependFailed)
+        {
+            m_state[entry.id] = State_Failed;
+            report.skipped++;
+            failed = 1;
+            continue;
+        }
+
+        const int high = entry.priority > 0;
+        if ((int)batch.size() >= m_batchSize || (high && lowPosted))
+            execute();
+        const auto start = std::chrono::steady_clock::now();
+        const ezwErrors error = m_executor->Post(entry.command.c_str(),
+                                                 high ? ZW_COMMAND_POST_PRIORITY_HIGH : ZW_COMMAND_POST_PRIORITY_LOW);
+        report.post += Seconds(start);
+        if (error != ZW_API_NO_ERROR)
+        {
+            m_state[entry.id] = State_Failed;
+            report.failed++;
+            failed = 1;
+            continue;
+        }
+        batch.push_back(i);
+        report.commands++;
+        lowPosted |= !high;
+    }
+    execute();
+
+    m_queue.clear();
+    m_queuedCoalesce.clear();
+    m_pending = 0;
+    return failed;
+}
+
+/*******************************************************************/
+/* Function definition */
+int CommandFileLoad
+(
+const char *path,              /* I: command file */
+CommandPipeline *pipeline,     /* I/O: pipeline */
+int *errorLine                 /* O: line of the error, 0 if none (optional) */
+)
+/*
+DESCRIPTION:
+   Queue the commands of a command file, as described in
+CommandPipeline.h.
+
+   Return the number of commands queued, -1 if the file fails.
+*/
+{
+    if (errorLine)
+        *errorLine = 0;
+    FILE *file = FileOpen(path, "r");
+    if (!file)
+        return -1;
+
+    std::vector<int> lineIds(1, 0);    /* line number -> id, 0 for no command */
+    char line[LINE_SIZE];
+    int count = 0, failed = 0;
+    while (fgets(line, LINE_SIZE, file))
+    {
+        size_t length = strlen(line);
+        while (length > 0 && (line[length - 1] == '\n' || line[length - 1] == '\r'))
+            line[--length] = '\0';
+        lineIds.push_back(0);
+        if (strncmp(line, COALESCE_DIRECTIVE, strlen(COALESCE_DIRECTIVE)) == 0)
+        {
+            pipeline->Coalesce(line + strlen(COALESCE_DIRECTIVE));
+            continue;
+        }
+        if (!line[0] || line[0] == '#')
+            continue;
+
+        int priority = 0;
+        std::vector<int> depends;
+        char *field = strchr(line, '\t');
+        if (field)
+        {
+            *field++ = '\0';
+            priority = atoi(field);
+            char *list = strchr(field, '\t');
+            while (list && *list)
+            {
+                const int number = atoi(++list);
+                if (number <= 0 || number >= (int)lineIds.size() || lineIds[number] == 0)
+                {
+                    failed = 1;
+                    break;
+                }
+                depends.push_back(lineIds[number]);
+                list = strchr(list, ',');
+            }
+        }
+        const int id = failed ? 0 : pipeline->Add(line, priority, depends.data(), (int)depends.size());
+        if (id == 0)
+        {
+            failed = 1;
+            break;
+        }
+        lineIds.back() = id;
+        count++;
+    }
+    fclose(file);
+    if (failed && errorLine)
+        *errorLine = (int)lineIds.size() - 1;
+    return failed ? -1 : count;
+}
@@ -0,0 +1,136 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+#pragma once
+
+/* Application includes */
+#include <stddef.h>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: type of the values of a macro variable */
+enum MacroType
+{
+    Macro_Number = 0,                /* all values are numbers */
+    Macro_Text                       /* a value at least is a quoted string; numbers are kept as their text */
+};
+
+/* DESCRIPTION: a variable of a macro output, its values are in MacroOutput */
+struct MacroVariable
+{
+    std::string_view name;
+    int type;                        /* MacroType */
+    int count;                       /* number of values */
+    int first;                       /* index of the first value in the numbers or the texts */
+};
+
+/* DESCRIPTION: values of a variable, pointing into MacroOutput */
+template <class T>
+struct MacroSpan
+{
+    const T *data;
+    int count;
+
+    const T *begin(void) const { return data; }
+    const T *end(void) const { return data + count; }
+    const T &operator[](int i) const { return data[i]; }
+    int size(void) const { return count; }
+};
+
+/*
+DESCRIPTION:
+   Parser of the variables output by cvxCmdMacro() and
+ZwCommandMacroExecute(): the number of variables, then for each
+variable its name, its number of values and the values, numbers or
+strings in double quotes, all separated by commas:
+
+   3,Num,1,25,Strings,2,"hello dolly","hello world",Array,3,100,125,150
+
+   Parse() reads the string in one pass. The commas and quotes are
+found 16 bytes at a time with SSE2 where available, and the numbers are
+converted without the locale (a decimal comma locale breaks atof()
+and sscanf()), exactly as strtod() does in the "C" locale. The names and
+strings are views into the parsed string, so the string must be kept
+until the variables are no longer used. The tables of the parser keep
+their memory, so parsing with the same MacroOutput again allocates
+nothing once it has seen an output as large.
+*/
+class MacroOutput
+{
+public:
+    MacroOutput() : m_errorOffset(0) {}
+
+    int Parse(const char *data, size_t size);
+    int Parse(const char *text);
+
+    int Count(void) const { return (int)m_variables.size(); }
+    const MacroVariable &Variable(int i) const { return m_variables[i]; }
+    const MacroVariable *Find(std::string_view name) const;
+
+    MacroSpan<double> Numbers(const MacroVariable &variable) const;
+    MacroSpan<std::string_view> Texts(const MacroVariable &variable) const;
+
+    size_t ErrorOffset(void) const { return m_errorOffset; }
+
+private:
+    std::vector<MacroVariable> m_variables;
+    std::vector<double> m_numbers;
+    std::vector<std::string_view> m_texts;
+    size_t m_errorOffset;            /* of the last Parse() that failed */
+};
+
+/*
+DESCRIPTION:
+   Builder of the input of cvxCmdMacro() and ZwCommandMacroExecute(),
+newline-delimited macro statements:
+
+   [vxSend,"!CdFileSaveAs2","E:\test.igs"]
+   Array = {100,125,150}
+
+   Call() and Assign() open a statement, Text(), Number() and Integer()
+add its values and End() closes it. Numbers are written in the shortest
+form that reads back to the same double. A string cannot hold a double
+quote or a line break: such a value, or a value outside a statement,
+sets Failed(). Clear() keeps the memory for the next input.
+*/
+class MacroInput
+{
+public:
+    MacroInput();
+
+    MacroInput &Call(const char *function);
+    MacroInput &Assign(const char *name);
+    MacroInput &Text(std::string_view text);
+    MacroInput &Number(double value);
+    MacroInput &Integer(long long value);
+    MacroInput &End(void);
+    MacroInput &Statement(std::string_view statement);
+
+    void Clear(void);
+    int Failed(void) const { return m_failed; }
+    char *Data(void) { return &m_text[0]; }
+    const std::string &Input(void) const { return m_text; }
+
+private:
+    int Value(void);
+
+    std::string m_text;
+    int m_open;                      /* 0 none, 1 call, 2 assignment */
+    int m_values;                    /* values of the open statement */
+    size_t m_valuesStart;            /* offset of the values of an assignment */
+    int m_failed;
+};
+
+/*******************************************************************/
+/* Function declarations */
+/*
+DESCRIPTION:
+   Number of "begin" to "end", all of it, as strtod() in the "C" locale.
+Return 1 if it is not a number or is out of the range of a double, else
+0.
+*/
+int MacroNumberParse(const char *begin, const char *end, double *value);
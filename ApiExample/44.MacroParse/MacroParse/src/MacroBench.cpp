@@ -0,0 +1,610 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* Application includes */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <new>
+#include <string>
+#include <vector>
+#include "MacroOutput.h"
+
+/*
+DESCRIPTION:
+   Check and benchmark of the macro output parser, the "MacroBench" tool
+of the Linux build:
+
+   MacroBench [outputs] [repeat]
+
+   It checks MacroNumberParse() against strtod() on random numbers in
+the forms of printf(), MacroOutput against random outputs and malformed
+ones, and MacroInput against the parser. It then parses "outputs"
+outputs of a design automation loop "repeat" times with MacroOutput and
+with the strtok()/atof() copies of the usual caller, and prints the
+time and the allocations of each. It exits with 1 if a check fails or if
+MacroOutput allocates once warmed up.
+*/
+
+/*******************************************************************/
+/* Constant definitions */
+#define DEFAULT_OUTPUTS 1000
+#define DEFAULT_REPEAT 20
+#define NUMBER_CHECKS 1000000
+#define OUTPUT_CHECKS 20000
+#define TEXT_SIZE 256
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: a variable of a generated output */
+struct BenchVariable
+{
+    std::string name;
+    int text;                        /* values are strings */
+    std::vector<double> numbers;
+    std::vector<std::string> texts;
+};
+
+/* DESCRIPTION: a variable as the usual caller copies it */
+struct LegacyVariable
+{
+    char name[64];
+    std::vector<double> numbers;
+    std::vector<std::string> texts;
+};
+
+/*******************************************************************/
+/* Variable definitions */
+static long long s_allocations = 0;  /* operator new calls of the process */
+
+/*******************************************************************/
+/* Function declarations */
+static double Seconds(std::chrono::steady_clock::time_point start);
+static uint64_t Random(uint64_t *seed);
+static std::string Encode(const std::vector<BenchVariable> &variables);
+static std::vector<BenchVariable> Generate(uint64_t *seed, int maxVariables, int commaTexts);
+static int NumbersCheck(void);
+static int OutputsCheck(void);
+static int MalformedCheck(void);
+static int InputCheck(void);
+static int LegacyParse(const char *output, std::vector<LegacyVariable> *variables);
+
+/*******************************************************************/
+/* Function definition */
+void *operator new
+(
+size_t size   /* I: bytes */
+)
+/*
+DESCRIPTION:
+   Count the allocations of the process.
+*/
+{
+    s_allocations++;
+    void *memory = malloc(size ? size : 1);
+    if (!memory)
+        throw std::bad_alloc();
+    return memory;
+}
+
+/*******************************************************************/
+/* Function definition */
+void operator delete
+(
+void *memory   /* I: memory of operator new */
+) noexcept
+/*
+DESCRIPTION:
+   Free the memory of the counting operator new.
+*/
+{
+    free(memory);
+}
+
+/*******************************************************************/
+/* Function definition */
+void operator delete
+(
+void *memory,   /* I: memory of operator new */
+size_t          /* I: bytes, not needed by free() */
+) noexcept
+/*
+DESCRIPTION:
+   Free the memory of the counting operator new.
+*/
+{
+    free(memory);
+}
+
+/*******************************************************************/
+/* Function definition */
+double Seconds
+(
+std::chrono::steady_clock::time_point start   /* I: start time */
+)
+/*
+DESCRIPTION:
+   Seconds elapsed since "start".
+*/
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*******************************************************************/
+/* Function definition */
+uint64_t Random
+(
+uint64_t *seed   /* I/O: state */
+)
+/*
+DESCRIPTION:
+   xorshift64* generator, the same checks on every platform.
+*/
+{
+    *seed ^= *seed >> 12;
+    *seed ^= *seed << 25;
+    *seed ^= *seed >> 27;
+    return *seed * 2685821657736338717ULL;
+}
+
+/*******************************************************************/
+/* Function definition */
+std::string Encode
+(
+const std::vector<BenchVariable> &variables   /* I: variables */
+)
+/*
+DESCRIPTION:
+   Output of cvxCmdMacro() for the variables, numbers in the %.17g form
+that reads back exactly.
+*/
+{
+    char number[32];
+    std::string output = std::to_string(variables.size());
+    for (const BenchVariable &variable : variables)
+    {
+        output += "," + variable.name + ",";
+        output += std::to_string(variable.text ? variable.texts.size() : variable.numbers.size());
+        for (double value : variable.numbers)
+        {
+            snprintf(number, sizeof(number), "%.17g", value);
+            output += ",";
+            output += number;
+        }
+        for (const std::string &text : variable.texts)
+            output += ",\"" + text + "\"";
+    }
+    return output;
+}
+
+/*******************************************************************/
+/* Function definition */
+std::vector<BenchVariable> Generate
+(
+uint64_t *seed,       /* I/O: random state */
+int maxVariables,     /* I: most variables */
+int commaTexts        /* I: 1 to put commas and quotes in the strings */
+)
+/*
+DESCRIPTION:
+   Random variables of an output: coordinates, counts and strings.
+*/
+{
+    static const char *s_words[] = { "hello dolly", "Part1", "E:\\jobs\\a.Z3PRT", "", " x ", "a,b", "say \"hi\" now" };
+    const int wordCount = commaTexts ? 7 : 5;
+    std::vector<BenchVariable> variables((size_t)(Random(seed) % (maxVariables + 1)));
+    for (size_t v = 0; v < variables.size(); v++)
+    {
+        BenchVariable &variable = variables[v];
+        variable.name = "Var" + std::to_string(v);
+        variable.text = Random(seed) % 4 == 0;
+        const int count = (int)(Random(seed) % 7);
+        for (int i = 0; i < count; i++)
+        {
+            if (variable.text)
+                variable.texts.push_back(s_words[Random(seed) % wordCount]);
+            else if (Random(seed) % 2)
+                variable.numbers.push_back((double)(int64_t)(Random(seed) % 2001) - 1000.0);
+            else
+                variable.numbers.push_back(((double)(Random(seed) >> 11) / 9007199254740992.0 - 0.5) * 2000.0);
+        }
+    }
+    return variables;
+}
+
+/*******************************************************************/
+/* Function definition */
+int NumbersCheck
+(
+void
+)
+/*
+DESCRIPTION:
+   Compare MacroNumberParse() with strtod() on random doubles in the
+forms of printf() and on special texts.
+
+   Return 1 if a check fails, else 0.
+*/
+{
+    static const char *s_formats[] = { "%.17g", "%.15g", "%g", "%.3f", "%.0f", "%e", "%.10e", "%+.6f" };
+    static const char *s_texts[] = { "0", "-0", "1", "25", "100", "0.1", ".5", "5.", "1e22", "1e23", "9007199254740993",
+                                     "123456789012345678901234567890", "1e-320", "2.2250738585072014e-308",
+                                     "179769313486231570000000000000000000000000000000000000000000000000000000000000"
+                                     "000000000000000000000000000000000000000000000000000000000000000000000000000000"
+                                     "000000000000000000000000000000000000000000000000000000000000000000000000000000"
+                                     "000000000000000000000000000000000000000000000000000000000000000000000000000000",
+                                     "0.000000000000000000000000000001", "+3.5", "inf", "nan" };
+    static const char *s_bad[] = { "", "-", "+", ".", "e5", "1e", "1e+", "1.2.3", "1,5", "--1", "+-1", "0x10", "1 2",
+                                   "abc", "1e400" };
+    uint64_t seed = 88172645463325252ULL;
+    char text[64];
+    for (int i = 0; i < NUMBER_CHECKS + (int)(sizeof(s_texts) / sizeof(s_texts[0])); i++)
+    {
+        if (i < NUMBER_CHECKS)
+        {
+            double value;
+            const uint64_t bits = Random(&seed);
+            if (i % 3 == 0)
+                memcpy(&value, &bits, sizeof(value));
+            else
+                value = (double)(int64_t)(bits % 2000001) / (double)(1 + (Random(&seed) % 10000)) - 100.0;
+            if (value != value || value - value != 0.0)
+                continue;
+            snprintf(text, sizeof(text), s_formats[i % 8], value);
+        }
+        else
+        {
+            snprintf(text, sizeof(text), "%s", s_texts[i - NUMBER_CHECKS]);
+        }
+        char *end = nullptr;
+        const double expected = strtod(text, &end);
+        double parsed = 0.0;
+        const int failed = MacroNumberParse(text, text + strlen(text), &parsed);
+        if (failed || (memcmp(&parsed, &expected, sizeof(double)) != 0 && !(parsed != parsed && expected != expected)))
+        {
+            printf("number: \"%s\" read as %.17g, strtod() %.17g\n", text, failed ? 0.0 : parsed, expected);
+            return 1;
+        }
+    }
+    for (const char *bad : s_bad)
+    {
+        double parsed;
+        if (!MacroNumberParse(bad, bad + strlen(bad), &parsed))
+        {
+            printf("number: \"%s\" read as %.17g\n", bad, parsed);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int OutputsCheck
+(
+void
+)
+/*
+DESCRIPTION:
+   Parse random outputs, with commas and quotes in their strings, and
+compare the variables with the generated ones.
+
+   Return 1 if a check fails, else 0.
+*/
+{
+    uint64_t seed = 1234567;
+    MacroOutput output;
+    for (int i = 0; i < OUTPUT_CHECKS; i++)
+    {
+        const std::vector<BenchVariable> variables = Generate(&seed, 12, 1);
+        const std::string text = Encode(variables);
+        if (output.Parse(text.c_str()) || output.Count() != (int)variables.size())
+        {
+            printf("output: %s not read (offset %zu)\n", text.c_str(), output.ErrorOffset());
+            return 1;
+        }
+        for (int v = 0; v < output.Count(); v++)
+        {
+            const MacroVariable &variable = output.Variable(v);
+            const BenchVariable &expected = variables[v];
+            int same = variable.name == expected.name && output.Find(expected.name) == &variable;
+            if (same && expected.text)
+            {
+                const MacroSpan<std::string_view> texts = output.Texts(variable);
+                same = variable.count == 0 ? variable.count == (int)expected.texts.size()
+                                           : variable.type == Macro_Text && texts.size() == (int)expected.texts.size();
+                for (int k = 0; same && k < texts.size(); k++)
+                    same = texts[k] == expected.texts[k];
+            }
+            else if (same)
+            {
+                const MacroSpan<double> numbers = output.Numbers(variable);
+                same = variable.type == Macro_Number && variable.count == (int)expected.numbers.size() &&
+                       numbers.size() == variable.count;
+                for (int k = 0; same && k < numbers.size(); k++)
+                    same = numbers[k] == expected.numbers[k];
+            }
+            if (!same)
+            {
+                printf("output: %s, variable %d read wrong\n", text.c_str(), v);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int MalformedCheck
+(
+void
+)
+/*
+DESCRIPTION:
+   Check the outputs that read and the ones that fail.
+
+   Return 1 if a check fails, else 0.
+*/
+{
+    static const struct
+    {
+        const char *text;
+        int failed;
+        int count;
+    } s_cases[] = {
+        { "", 0, 0 },
+        { "0", 0, 0 },
+        { "ERROR", 1, 0 },
+        { "1,A,1,25", 0, 1 },
+        { " 1 , A , 1 , 25 \n", 0, 1 },
+        { "1,A,0", 0, 1 },
+        { "1,A,2,1", 1, 0 },
+        { "1,A,1,1,", 1, 0 },
+        { "2,A,1,1", 1, 0 },
+        { "1,A,1,\"x", 1, 0 },
+        { "1,A,1,\"a,b\"", 0, 1 },
+        { "1,A,2,1,\"s\"", 0, 1 },
+        { "1,A,1,1e400", 0, 1 },
+        { "1,,1,1", 1, 0 },
+        { "1,A,-1", 1, 0 },
+        { "1,A,1,x\"y", 1, 0 },
+        { "0,", 1, 0 },
+        { "3,Num,1,25,Strings,2,\"hello dolly\",\"hello world\",Array,3,100,125,150", 0, 3 },
+    };
+    MacroOutput output;
+    if (output.Parse(nullptr) || output.Count() != 0)
+    {
+        printf("malformed: NULL output not empty\n");
+        return 1;
+    }
+    for (const auto &test : s_cases)
+    {
+        const int failed = output.Parse(test.text);
+        if (failed != test.failed || output.Count() != test.count)
+        {
+            printf("malformed: \"%s\" %s, %d variables\n", test.text, failed ? "failed" : "read", output.Count());
+            return 1;
+        }
+    }
+
+    /* a mixed variable keeps its numbers as text */
+    output.Parse("1,A,2,1.50,\"s\"");
+    const MacroSpan<std::string_view> texts = output.Texts(output.Variable(0));
+    if (texts.size() != 2 || texts[0] != "1.50" || texts[1] != "s" || output.Numbers(output.Variable(0)).size() != 0)
+    {
+        printf("malformed: mixed variable read wrong\n");
+        return 1;
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int InputCheck
+(
+void
+)
+/*
+DESCRIPTION:
+   Build the statements of the example of cvxCmdMacro() and check the
+text, the shortest numbers and the refused values.
+
+   Return 1 if a check fails, else 0.
+*/
+{
+    MacroInput input;
+    input.Assign("Num").Integer(25).End();
+    input.Assign("Strings").Text("hello dolly").Text("hello world").End();
+    input.Assign("Array").Number(100).Number(125.5).Number(0.1).End();
+    input.Call("vxSend").Text("!CdFileSaveAs2").Text("E:\\test.igs").End();
+    input.Statement("BUFFER");
+    const char *expected = "Num = 25\n"
+                           "Strings = {\"hello dolly\",\"hello world\"}\n"
+                           "Array = {100,125.5,0.1}\n"
+                           "[vxSend,\"!CdFileSaveAs2\",\"E:\\test.igs\"]\n"
+                           "BUFFER\n";
+    if (input.Failed() || input.Input() != expected)
+    {
+        printf("input: %s", input.Input().c_str());
+        return 1;
+    }
+
+    /* shortest numbers read back exactly */
+    uint64_t seed = 42;
+    MacroInput number;
+    for (int i = 0; i < OUTPUT_CHECKS; i++)
+    {
+        double value;
+        const uint64_t bits = Random(&seed);
+        memcpy(&value, &bits, sizeof(value));
+        if (value != value || value - value != 0.0)
+            continue;
+        number.Clear();
+        number.Assign("V").Number(value).End();
+        const std::string &text = number.Input();
+        double parsed;
+        if (MacroNumberParse(text.c_str() + 4, text.c_str() + text.size() - 1, &parsed) || parsed != value)
+        {
+            printf("input: %s", text.c_str());
+            return 1;
+        }
+    }
+
+    MacroInput bad;
+    bad.Number(1.0);
+    MacroInput quote;
+    quote.Call("vxSend").Text("a\"b").End();
+    MacroInput open;
+    open.Call("vxSend").Call("vxSend");
+    if (!bad.Failed() || !quote.Failed() || !open.Failed())
+    {
+        printf("input: a bad value is accepted\n");
+        return 1;
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int LegacyParse
+(
+const char *output,                          /* I: output of cvxCmdMacro() */
+std::vector<LegacyVariable> *variables       /* O: variables */
+)
+/*
+DESCRIPTION:
+   Parser of the usual caller: a copy of the output cut by strtok(),
+atof() of the numbers and copies of the names and the strings. It
+breaks on strings holding commas.
+
+   Return 1 if it fails, else 0.
+*/
+{
+    variables->clear();
+    char *copy = strdup(output);
+    char *token = strtok(copy, ",");
+    const int count = token ? atoi(token) : 0;
+    for (int v = 0; v < count; v++)
+    {
+        LegacyVariable variable;
+        token = strtok(nullptr, ",");
+        if (!token)
+            break;
+        snprintf(variable.name, sizeof(variable.name), "%s", token);
+        token = strtok(nullptr, ",");
+        const int values = token ? atoi(token) : 0;
+        for (int i = 0; i < values && (token = strtok(nullptr, ",")); i++)
+        {
+            if (token[0] == '"')
+            {
+                char text[TEXT_SIZE];
+                snprintf(text, sizeof(text), "%s", token + 1);
+                text[strcspn(text, "\"")] = '\0';
+                variable.texts.push_back(text);
+            }
+            else
+            {
+                variable.numbers.push_back(atof(token));
+            }
+        }
+        variables->push_back(variable);
+    }
+    free(copy);
+    return (int)variables->size() != count;
+}
+
+/*******************************************************************/
+/* Function definition */
+int main
+(
+int argc,        /* I: number of arguments */
+char **argv      /* I: arguments */
+)
+/*
+DESCRIPTION:
+   Run the checks, then the benchmark.
+*/
+{
+    const int outputCount = argc > 1 ? atoi(argv[1]) : DEFAULT_OUTPUTS;
+    const int repeat = argc > 2 ? atoi(argv[2]) : DEFAULT_REPEAT;
+    if (outputCount <= 0 || repeat <= 0)
+    {
+        fprintf(stderr, "usage: MacroBench [outputs] [repeat]\n");
+        return 2;
+    }
+
+    int failed = NumbersCheck();
+    failed |= OutputsCheck();
+    failed |= MalformedCheck();
+    failed |= InputCheck();
+    printf("checks: %s\n", failed ? "FAILED" : "passed");
+
+    /* outputs of a design automation loop: points, counts and names, no commas in strings */
+    uint64_t seed = 987654321;
+    std::vector<std::string> outputs;
+    size_t bytes = 0;
+    for (int i = 0; i < outputCount; i++)
+    {
+        outputs.push_back(Encode(Generate(&seed, 24, 0)));
+        bytes += outputs.back().size();
+    }
+
+    std::vector<LegacyVariable> legacy;
+    double legacyDigest = 0.0;
+    long long allocations = s_allocations;
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeat; r++)
+    {
+        for (const std::string &text : outputs)
+        {
+            LegacyParse(text.c_str(), &legacy);
+            for (const LegacyVariable &variable : legacy)
+                legacyDigest += variable.numbers.empty() ? (double)variable.texts.size() : variable.numbers[0];
+        }
+    }
+    const double legacyTime = Seconds(start);
+    const long long legacyAllocations = s_allocations - allocations;
+
+    MacroOutput output;
+    for (const std::string &text : outputs)
+        output.Parse(text.data(), text.size());
+    double digest = 0.0;
+    allocations = s_allocations;
+    start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeat; r++)
+    {
+        for (const std::string &text : outputs)
+        {
+            if (output.Parse(text.data(), text.size()))
+                failed = 1;
+            for (int v = 0; v < output.Count(); v++)
+            {
+                const MacroVariable &variable = output.Variable(v);
+                digest += variable.type == Macro_Text || variable.count == 0 ? (double)variable.count
+                                                                              : output.Numbers(variable)[0];
+            }
+        }
+    }
+    const double time = Seconds(start);
+    const long long parseAllocations = s_allocations - allocations;
+
+    const double parses = (double)outputCount * repeat;
+    printf("%d outputs, %.1f bytes each, %d times\n", outputCount, (double)bytes / outputCount, repeat);
+    printf("strtok/atof  %8.1f ns/output, %7.1f MB/s, %6.2f allocations/output, digest %.6g\n",
+           legacyTime * 1e9 / parses, (double)bytes * repeat / legacyTime / 1e6, (double)legacyAllocations / parses,
+           legacyDigest / repeat);
+    printf("MacroOutput  %8.1f ns/output, %7.1f MB/s, %6.2f allocations/output, digest %.6g\n",
+           time * 1e9 / parses, (double)bytes * repeat / time / 1e6, (double)parseAllocations / parses, digest / repeat);
+    printf("             %.1fx faster\n", time > 0.0 ? legacyTime / time : 0.0);
+    if (parseAllocations != 0)
+    {
+        printf("MacroOutput allocated %lld times once warmed up\n", parseAllocations);
+        failed = 1;
+    }
+    return failed ? 1 : 0;
+}
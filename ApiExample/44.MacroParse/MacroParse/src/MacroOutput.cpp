@@ -0,0 +1,719 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* Application includes */
+#include <stdint.h>
+#include <string.h>
+#include <charconv>
+#include <cmath>
+#include "MacroOutput.h"
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__)
+#define MACRO_SSE2
+#include <emmintrin.h>
+#endif
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+/*******************************************************************/
+/* Constant definitions */
+#define SCAN_BLOCK 16                /* bytes of a delimiter mask */
+#define FAST_DIGITS 19               /* significant digits held by the mantissa */
+#define FAST_MANTISSA (1ULL << 53)   /* largest mantissa exact in a double */
+#define FAST_EXPONENT 22             /* largest power of ten exact in a double */
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: exact powers of ten */
+static const double s_powers[FAST_EXPONENT + 1] =
+{
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+/*
+DESCRIPTION:
+   Finder of the commas and the double quotes of a string. The string is
+read in blocks of SCAN_BLOCK bytes; the delimiters of the current block
+are the bits of a mask, so the next one is a count of trailing zeros
+instead of a test of each byte.
+*/
+class DelimiterScanner
+{
+public:
+    DelimiterScanner(const char *data, size_t size) : m_data(data), m_size(size), m_block(0), m_mask(0)
+    {
+        Load();
+    }
+
+    /* DESCRIPTION: position of the first delimiter at or after "from", the size if none */
+    size_t Next(size_t from)
+    {
+        if (from >= m_block + SCAN_BLOCK)
+        {
+            m_block = from - from % SCAN_BLOCK;
+            Load();
+        }
+        uint32_t mask = from > m_block ? m_mask & (~0u << (from - m_block)) : m_mask;
+        while (!mask)
+        {
+            m_block += SCAN_BLOCK;
+            if (m_block >= m_size)
+                return m_size;
+            Load();
+            mask = m_mask;
+        }
+        return m_block + TrailingZeros(mask);
+    }
+
+private:
+    void Load(void)
+    {
+        m_mask = 0;
+        if (m_block >= m_size)
+            return;
+#ifdef MACRO_SSE2
+        if (m_block + SCAN_BLOCK <= m_size)
+        {
+            const __m128i bytes = _mm_loadu_si128((const __m128i *)(m_data + m_block));
+            const __m128i delimiters = _mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(',')),
+                                                    _mm_cmpeq_epi8(bytes, _mm_set1_epi8('"')));
+            m_mask = (uint32_t)_mm_movemask_epi8(delimiters);
+            return;
+        }
+#endif
+        const size_t end = m_block + SCAN_BLOCK < m_size ? m_block + SCAN_BLOCK : m_size;
+        for (size_t i = m_block; i < end; i++)
+        {
+            if (m_data[i] == ',' || m_data[i] == '"')
+                m_mask |= 1u << (i - m_block);
+        }
+    }
+
+    static int TrailingZeros(uint32_t mask)
+    {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return (int)index;
+#else
+        return __builtin_ctz(mask);
+#endif
+    }
+
+    const char *m_data;
+    size_t m_size;
+    size_t m_block;                  /* start of the block of the mask */
+    uint32_t m_mask;                 /* delimiters of the block, bit i for byte m_block + i */
+};
+
+/*******************************************************************/
+/* Function declarations */
+static int IsBlank(char c);
+static void Trim(const char *data, size_t *begin, size_t *end);
+static int CountParse(const char *begin, const char *end, int *count);
+
+/*******************************************************************/
+/* Function definition */
+int IsBlank
+(
+char c   /* I: character */
+)
+/*
+DESCRIPTION:
+   Return 1 if "c" is a space, a tab or a line break, else 0.
+*/
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+/*******************************************************************/
+/* Function definition */
+void Trim
+(
+const char *data,   /* I: string */
+size_t *begin,      /* I/O: start of a token */
+size_t *end         /* I/O: end of the token */
+)
+/*
+DESCRIPTION:
+   Remove the blanks around a token.
+*/
+{
+    while (*begin < *end && IsBlank(data[*begin]))
+        (*begin)++;
+    while (*end > *begin && IsBlank(data[*end - 1]))
+        (*end)--;
+}
+
+/*******************************************************************/
+/* Function definition */
+int CountParse
+(
+const char *begin,   /* I: token */
+const char *end,     /* I: end of the token */
+int *count           /* O: count */
+)
+/*
+DESCRIPTION:
+   Non-negative integer of a token. A count written as "3.0" is accepted.
+
+   Return 1 if the token is not a count, else 0.
+*/
+{
+    long long value = 0;
+    const char *p = begin;
+    for (; p < end && *p >= '0' && *p <= '9'; p++)
+    {
+        value = value * 10 + (*p - '0');
+        if (value > 0x7fffffff)
+            return 1;
+    }
+    if (p == begin)
+        return 1;
+    if (p < end)
+    {
+        double number;
+        if (MacroNumberParse(begin, end, &number) || number != (double)value)
+            return 1;
+    }
+    *count = (int)value;
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int MacroNumberParse
+(
+const char *begin,   /* I: text */
+const char *end,     /* I: end of the text */
+double *value        /* O: number */
+)
+/*
+DESCRIPTION:
+   Number of a text, as strtod() in the "C" locale. A decimal number of
+at most 19 significant digits and an exponent in [-22, 22] is a
+mantissa exact in a double times or divided by an exact power of ten,
+so one rounding gives the correctly rounded result (Clinger's fast
+path); the other numbers are converted by std::from_chars().
+
+   Return 1 if the text is not a number or is out of range, else 0.
+*/
+{
+    const char *p = begin;
+    const int negative = p < end && *p == '-';
+    if (p < end && (*p == '-' || *p == '+'))
+        p++;
+    const char *number = p;
+
+    uint64_t mantissa = 0;
+    int digits = 0, exponent = 0, exact = 1, any = 0;
+    for (; p < end && *p >= '0' && *p <= '9'; p++, any = 1)
+    {
+        if (digits < FAST_DIGITS)
+        {
+            mantissa = mantissa * 10 + (uint64_t)(*p - '0');
+            digits += mantissa != 0;
+        }
+        else
+        {
+            exponent++;
+            exact &= *p == '0';
+        }
+    }
+    if (p < end && *p == '.')
+    {
+        for (p++; p < end && *p >= '0' && *p <= '9'; p++, any = 1)
+        {
+            if (digits < FAST_DIGITS)
+            {
+                mantissa = mantissa * 10 + (uint64_t)(*p - '0');
+                digits += mantissa != 0;
+                exponent--;
+            }
+            else
+            {
+                exact &= *p == '0';
+            }
+        }
+    }
+    if (any && p < end && (*p == 'e' || *p == 'E'))
+    {
+        const char *e = p + 1;
+        const int negativeExponent = e < end && *e == '-';
+        if (e < end && (*e == '-' || *e == '+'))
+            e++;
+        int power = 0;
+        const char *powerStart = e;
+        for (; e < end && *e >= '0' && *e <= '9'; e++)
+        {
+            if (power < 10000)
+                power = power * 10 + (*e - '0');
+        }
+        if (e == powerStart)
+            exact = 0;
+        exponent += negativeExponent ? -power : power;
+        p = e;
+    }
+
+    if (any && exact && p == end)
+    {
+        if (mantissa == 0)
+        {
+            *value = negative ? -0.0 : 0.0;
+            return 0;
+        }
+        if (mantissa <= FAST_MANTISSA && exponent >= -FAST_EXPONENT && exponent <= FAST_EXPONENT)
+        {
+            const double result = exponent < 0 ? (double)mantissa / s_powers[-exponent]
+                                               : (double)mantissa * s_powers[exponent];
+            *value = negative ? -result : result;
+            return 0;
+        }
+    }
+
+    /* from_chars() takes no "+" and no sign before the digits, strtod() does */
+    double result;
+    const std::from_chars_result read = std::from_chars(number, end, result);
+    if (read.ec != std::errc() || read.ptr != end || number == end || *number == '-')
+        return 1;
+    *value = negative ? -result : result;
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int MacroOutput::Parse
+(
+const char *data,   /* I: output of cvxCmdMacro(), NULL if none */
+size_t size         /* I: length of the output */
+)
+/*
+DESCRIPTION:
+   Read the variables of a macro output. A NULL or empty output has no
+variables; "ERROR", the output of a failed macro, fails.
+
+   Return 1 if the output is not well formed, with ErrorOffset() set to
+the offset of the error and no variables, else 0.
+*/
+{
+    m_variables.clear();
+    m_numbers.clear();
+    m_texts.clear();
+    m_errorOffset = 0;
+    if (!data || size == 0)
+        return 0;
+
+    DelimiterScanner scanner(data, size);
+    size_t position = 0;
+    int done = 0;
+
+    /* next unquoted token, between "position" and the next comma */
+    auto token = [&](size_t *begin, size_t *end)
+    {
+        if (done)
+            return 1;
+        const size_t delimiter = scanner.Next(position);
+        if (delimiter < size && data[delimiter] == '"')
+            return 1;
+        *begin = position;
+        *end = delimiter;
+        Trim(data, begin, end);
+        done = delimiter >= size;
+        position = delimiter + 1;
+        return *begin == *end ? 1 : 0;
+    };
+
+    size_t begin = 0, end = 0;
+    int variableCount = 0;
+    int failed = token(&begin, &end) || CountParse(data + begin, data + end, &variableCount);
+    for (int v = 0; v < variableCount && !failed; v++)
+    {
+        MacroVariable variable;
+        if (token(&begin, &end))
+        {
+            failed = 1;
+            break;
+        }
+        variable.name = std::string_view(data + begin, end - begin);
+        if (token(&begin, &end) || CountParse(data + begin, data + end, &variable.count))
+        {
+            failed = 1;
+            break;
+        }
+
+        /* values go to both tables until the type of the variable is known */
+        const size_t firstNumber = m_numbers.size(), firstText = m_texts.size();
+        int numbers = 1;
+        for (int i = 0; i < variable.count; i++)
+        {
+            while (!done && position < size && IsBlank(data[position]))
+                position++;
+            if (!done && position < size && data[position] == '"')
+            {
+                /* a string ends at a quote followed by a comma or the end */
+                size_t quote = scanner.Next(position + 1);
+                for (;;)
+                {
+                    while (quote < size && data[quote] != '"')
+                        quote = scanner.Next(quote + 1);
+                    if (quote >= size)
+                        break;
+                    size_t after = quote + 1;
+                    while (after < size && IsBlank(data[after]))
+                        after++;
+                    if (after >= size || data[after] == ',')
+                    {
+                        m_texts.push_back(std::string_view(data + position + 1, quote - position - 1));
+                        done = after >= size;
+                        position = after + 1;
+                        break;
+                    }
+                    quote = scanner.Next(quote + 1);
+                }
+                if (quote >= size)
+                {
+                    failed = 1;
+                    break;
+                }
+                numbers = 0;
+                continue;
+            }
+            if (token(&begin, &end))
+            {
+                failed = 1;
+                break;
+            }
+            m_texts.push_back(std::string_view(data + begin, end - begin));
+            if (numbers)
+            {
+                double number;
+                if (MacroNumberParse(data + begin, data + end, &number))
+                    numbers = 0;
+                else
+                    m_numbers.push_back(number);
+            }
+        }
+        if (failed)
+            break;
+        variable.type = numbers ? Macro_Number : Macro_Text;
+        if (numbers)
+        {
+            m_texts.resize(firstText);
+            variable.first = (int)firstNumber;
+        }
+        else
+        {
+            m_numbers.resize(firstNumber);
+            variable.first = (int)firstText;
+        }
+        m_variables.push_back(variable);
+    }
+
+    /* a comma after the last value is a value too many */
+    failed |= !done;
+    if (failed)
+    {
+        m_errorOffset = position < size ? position : size;
+        m_variables.clear();
+        m_numbers.clear();
+        m_texts.clear();
+        return 1;
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int MacroOutput::Parse
+(
+const char *text   /* I: null-terminated output of cvxCmdMacro(), NULL if none */
+)
+/*
+DESCRIPTION:
+   Read the variables of a null-terminated macro output.
+
+   Return 1 if the output is not well formed, else 0.
+*/
+{
+    return Parse(text, text ? strlen(text) : 0);
+}
+
+/*******************************************************************/
+/* Function definition */
+const MacroVariable *MacroOutput::Find
+(
+std::string_view name   /* I: variable name */
+) const
+/*
+DESCRIPTION:
+   Variable of a name, NULL if none. Macro outputs hold a few variables,
+so they are searched in order.
+*/
+{
+    for (const MacroVariable &variable : m_variables)
+    {
+        if (variable.name == name)
+            return &variable;
+    }
+    return nullptr;
+}
+
+/*******************************************************************/
+/* Function definition */
+MacroSpan<double> MacroOutput::Numbers
+(
+const MacroVariable &variable   /* I: variable of this output */
+) const
+/*
+DESCRIPTION:
+   Values of a number variable, none for a text variable.
+*/
+{
+    if (variable.type != Macro_Number || variable.count == 0)
+        return MacroSpan<double>{ nullptr, 0 };
+    return MacroSpan<double>{ m_numbers.data() + variable.first, variable.count };
+}
+
+/*******************************************************************/
+/* Function definition */
+MacroSpan<std::string_view> MacroOutput::Texts
+(
+const MacroVariable &variable   /* I: variable of this output */
+) const
+/*
+DESCRIPTION:
+   Values of a text variable, without their quotes, none for a number
+variable.
+*/
+{
+    if (variable.type != Macro_Text || variable.count == 0)
+        return MacroSpan<std::string_view>{ nullptr, 0 };
+    return MacroSpan<std::string_view>{ m_texts.data() + variable.first, variable.count };
+}
+
+/*******************************************************************/
+/* Function definition */
+MacroInput::MacroInput
+(
+void
+)
+/*
+DESCRIPTION:
+   Empty input.
+*/
+    : m_open(0), m_values(0), m_valuesStart(0), m_failed(0)
+{
+}
+
+/*******************************************************************/
+/* Function definition */
+void MacroInput::Clear
+(
+void
+)
+/*
+DESCRIPTION:
+   Empty the input, keeping its memory.
+*/
+{
+    m_text.clear();
+    m_open = 0;
+    m_values = 0;
+    m_failed = 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int MacroInput::Value
+(
+void
+)
+/*
+DESCRIPTION:
+   Start a value of the open statement.
+
+   Return 1 if no statement is open, else 0.
+*/
+{
+    if (!m_open)
+    {
+        m_failed = 1;
+        return 1;
+    }
+    if (m_open == 1 || m_values > 0)
+        m_text.push_back(',');
+    m_values++;
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+MacroInput &MacroInput::Call
+(
+const char *function   /* I: macro function, as vxSend */
+)
+/*
+DESCRIPTION:
+   Open a call statement, "[function,values]".
+*/
+{
+    if (m_open || !function || !function[0])
+    {
+        m_failed = 1;
+        return *this;
+    }
+    m_text.push_back('[');
+    m_text.append(function);
+    m_open = 1;
+    m_values = 0;
+    return *this;
+}
+
+/*******************************************************************/
+/* Function definition */
+MacroInput &MacroInput::Assign
+(
+const char *name   /* I: variable name */
+)
+/*
+DESCRIPTION:
+   Open an assignment, "name = value" or "name = {values}".
+*/
+{
+    if (m_open || !name || !name[0])
+    {
+        m_failed = 1;
+        return *this;
+    }
+    m_text.append(name);
+    m_text.append(" = ");
+    m_valuesStart = m_text.size();
+    m_open = 2;
+    m_values = 0;
+    return *this;
+}
+
+/*******************************************************************/
+/* Function definition */
+MacroInput &MacroInput::Text
+(
+std::string_view text   /* I: string value */
+)
+/*
+DESCRIPTION:
+   Add a string value, in double quotes.
+*/
+{
+    if (text.find_first_of("\"\r\n") != std::string_view::npos)
+    {
+        m_failed = 1;
+        return *this;
+    }
+    if (Value())
+        return *this;
+    m_text.push_back('"');
+    m_text.append(text.data(), text.size());
+    m_text.push_back('"');
+    return *this;
+}
+
+/*******************************************************************/
+/* Function definition */
+MacroInput &MacroInput::Number
+(
+double value   /* I: number value */
+)
+/*
+DESCRIPTION:
+   Add a number value, in the shortest form that reads back to "value".
+*/
+{
+    if (!std::isfinite(value))
+    {
+        m_failed = 1;
+        return *this;
+    }
+    if (Value())
+        return *this;
+    char buffer[32];
+    const std::to_chars_result written = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    m_text.append(buffer, written.ptr - buffer);
+    return *this;
+}
+
+/*******************************************************************/
+/* Function definition */
+MacroInput &MacroInput::Integer
+(
+long long value   /* I: integer value */
+)
+/*
+DESCRIPTION:
+   Add an integer value.
+*/
+{
+    if (Value())
+        return *this;
+    char buffer[24];
+    const std::to_chars_result written = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    m_text.append(buffer, written.ptr - buffer);
+    return *this;
+}
+
+/*******************************************************************/
+/* Function definition */
+MacroInput &MacroInput::End
+(
+void
+)
+/*
+DESCRIPTION:
+   Close the open statement and its line. An assignment of one value is
+written without braces.
+*/
+{
+    if (m_open == 1)
+    {
+        m_text.push_back(']');
+    }
+    else if (m_open == 2)
+    {
+        if (m_values != 1)
+        {
+            m_text.insert(m_valuesStart, 1, '{');
+            m_text.push_back('}');
+        }
+    }
+    else
+    {
+        m_failed = 1;
+        return *this;
+    }
+    m_text.push_back('\n');
+    m_open = 0;
+    return *this;
+}
+
+/*******************************************************************/
+/* Function definition */
+MacroInput &MacroInput::Statement
+(
+std::string_view statement   /* I: macro statement, as "BUFFER" */
+)
+/*
+DESCRIPTION:
+   Add a statement written by the caller, on its own line.
+*/
+{
+    if (m_open)
+    {
+        m_failed = 1;
+        return *this;
+    }
+    m_text.append(statement.data(), statement.size());
+    m_text.push_back('\n');
+    return *this;
+}
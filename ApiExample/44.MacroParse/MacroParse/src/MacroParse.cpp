@@ -0,0 +1,168 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <chrono>
+#include <string>
+#include "..\inc\MacroParsePr.h"
+#include "..\inc\MacroOutput.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define MESSAGE_SIZE 256
+#define MACRO_RUNS 1000              /* macros run by "~MacroParse" */
+#define LIST_VALUES 8                /* values displayed of a variable, at most */
+
+/*******************************************************************/
+/* Function declarations */
+static int MacroParse(void);
+static void VariableDisplay(const MacroOutput &output, const MacroVariable &variable);
+static double Seconds(std::chrono::steady_clock::time_point start);
+
+/*******************************************************************/
+/* Function definition */
+int RegisterMacroParse
+(
+void
+)
+/*
+DESCRIPTION:
+   Register the commands of the macro parse example.
+*/
+{
+    /* Run macros and read their variables by entering "~MacroParse" */
+    ZwCommandFunctionLoad("MacroParse", (void *)MacroParse, ZW_LICENSE_CODE_GENERAL);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int UnloadMacroParse
+(
+void
+)
+/*
+DESCRIPTION:
+   Unload the commands of the macro parse example.
+*/
+{
+    ZwCommandFunctionUnload("MacroParse");
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+double Seconds
+(
+std::chrono::steady_clock::time_point start   /* I: start time */
+)
+/*
+DESCRIPTION:
+   Seconds elapsed since "start".
+*/
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*******************************************************************/
+/* Function definition */
+void VariableDisplay
+(
+const MacroOutput &output,       /* I: parsed output */
+const MacroVariable &variable    /* I: variable of the output */
+)
+/*
+DESCRIPTION:
+   Display a variable and its first values.
+*/
+{
+    char message[MESSAGE_SIZE];
+    std::string text(variable.name);
+    text += variable.type == Macro_Number ? " (numbers) =" : " (texts) =";
+    for (int i = 0; i < variable.count && i < LIST_VALUES; i++)
+    {
+        if (variable.type == Macro_Number)
+        {
+            sprintf_s(message, MESSAGE_SIZE, " %g", output.Numbers(variable)[i]);
+            text += message;
+        }
+        else
+        {
+            const std::string_view value = output.Texts(variable)[i];
+            text += " \"";
+            text.append(value.data(), value.size());
+            text += "\"";
+        }
+    }
+    if (variable.count > LIST_VALUES)
+        text += " ...";
+    cvxMsgDisp((char *)text.c_str());
+}
+
+/*******************************************************************/
+/* Function definition */
+int MacroParse
+(
+void
+)
+/*
+DESCRIPTION:
+   Build the statements of the example of cvxCmdMacro() with MacroInput,
+run them MACRO_RUNS times as a design automation loop does, read the
+variables of each output with MacroOutput and display the variables and
+the time of the macros and of the parsing.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    char message[MESSAGE_SIZE];
+    MacroInput input;
+    input.Assign("Num").Integer(25).End();
+    input.Assign("Strings").Text("hello dolly").Text("hello world").End();
+    input.Assign("Array").Number(100).Number(125).Number(150).End();
+    input.Assign("Point").Number(12.5).Number(-3.25).Number(0.1).End();
+    if (input.Failed())
+        return 1;
+
+    MacroOutput output;
+    double runTime = 0.0, parseTime = 0.0;
+    for (int run = 0; run < MACRO_RUNS; run++)
+    {
+        char *text = nullptr;
+        auto start = std::chrono::steady_clock::now();
+        const ezwErrors error = ZwCommandMacroExecute(ZW_MACRO_STATEMENTS, input.Data(), &text);
+        runTime += Seconds(start);
+        if (error != ZW_API_NO_ERROR)
+        {
+            ZwMemoryFree((void **)&text);
+            cvxMsgDisp("The macro failed");
+            return 1;
+        }
+
+        start = std::chrono::steady_clock::now();
+        const int failed = output.Parse(text);
+        parseTime += Seconds(start);
+        if (failed)
+        {
+            sprintf_s(message, MESSAGE_SIZE, "Bad macro output at offset %d", (int)output.ErrorOffset());
+            cvxMsgDisp(message);
+            ZwMemoryFree((void **)&text);
+            return 1;
+        }
+
+        /* the views of the output are used before it is freed */
+        if (run == MACRO_RUNS - 1)
+        {
+            for (int v = 0; v < output.Count(); v++)
+                VariableDisplay(output, output.Variable(v));
+        }
+        ZwMemoryFree((void **)&text);
+    }
+    sprintf_s(message, MESSAGE_SIZE, "%d macros: run %.3f ms, output parsed in %.3f ms", MACRO_RUNS, runTime * 1e3,
+              parseTime * 1e3);
+    cvxMsgDisp(message);
+    return 0;
+}
@@ -0,0 +1,79 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+#pragma once
+
+/* ZW3D API includes */
+#include "zwapi_util.h"
+
+/* Application includes */
+#include <string>
+#include <vector>
+#include "RemoteProtocol.h"
+
+/*******************************************************************/
+/* Data type definitions */
+/* DESCRIPTION: result of an item of a batch */
+struct RemoteResult
+{
+    int index;                       /* of the item in its batch */
+    ezwErrors status;
+    std::string output;              /* of a macro */
+};
+
+/* DESCRIPTION: called for each result of a batch as soon as it is received */
+typedef void (*RemoteResultCallback)(void *data, const RemoteResult &result);
+
+/*
+DESCRIPTION:
+   Client of a remote session, the replacement of:
+
+   system("zw3dremote -r local cmd=\"~Function\"");
+
+   Connect() once, then add the items of a batch with Command() and
+Macro() and send them with Execute(), which waits for the result of
+every item, passing each one to "callback" as it arrives. Ping() measures
+the round-trip of the connection without executing anything.
+
+   A client is used by one thread at a time; several clients may share
+a server.
+*/
+class RemoteClient
+{
+public:
+    RemoteClient();
+    ~RemoteClient();
+
+    int Connect(const char *path = nullptr);
+    void Close(void);
+    int Connected(void) const { return m_socket != REMOTE_SOCKET_NONE; }
+
+    void Command(const char *command);
+    void Macro(const char *statements);
+    int Pending(void) const { return m_count; }
+    void Discard(void);
+
+    int Execute(std::vector<RemoteResult> *results, int flags = 0, RemoteResultCallback callback = nullptr,
+                void *data = nullptr);
+    int Ping(double *seconds);
+
+    int Executed(void) const { return m_executed; }
+    int Failed(void) const { return m_failed; }
+    double ServerTime(void) const { return m_serverTime; }
+    const std::string &Error(void) const { return m_error; }
+
+private:
+    void Add(int kind, const char *text);
+
+    RemoteSocket m_socket;
+    uint32_t m_sequence;
+    RemotePayload m_batch;
+    int m_count;
+    RemotePayload m_frame;           /* frames received */
+    RemoteResult m_result;
+    int m_executed;                  /* of the last batch */
+    int m_failed;
+    double m_serverTime;             /* second, executing the last batch */
+    std::string m_error;
+};
@@ -0,0 +1,122 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+#pragma once
+
+/* Application includes */
+#include <stdint.h>
+#include <string>
+#ifdef _WIN32
+#include <winsock2.h>
+#endif
+
+/*******************************************************************/
+/* Constant definitions */
+#define REMOTE_SOCKET_ENV "ZW_REMOTE_SOCKET"     /* path of the socket, else REMOTE_SOCKET_NAME in the temporary directory */
+#define REMOTE_SOCKET_NAME "zw3d_remote.sock"
+#define REMOTE_PATH_SIZE 108                     /* sun_path of a local socket */
+#define REMOTE_HEADER_BYTES 12
+#define REMOTE_FRAME_MAX (64 * 1024 * 1024)      /* largest payload accepted */
+
+/*******************************************************************/
+/* Data type definitions */
+#ifdef _WIN32
+typedef SOCKET RemoteSocket;
+#define REMOTE_SOCKET_NONE INVALID_SOCKET
+#else
+typedef int RemoteSocket;
+#define REMOTE_SOCKET_NONE (-1)
+#endif
+
+/*
+DESCRIPTION:
+   Frame types. A client sends batches and pings; the server answers a
+batch with one result per item, streamed as each item is executed, then
+a done frame, and a ping with a pong. The numbers are on the wire:
+append new types and never renumber.
+*/
+enum RemoteFrameType
+{
+    Remote_Batch = 1,                /* client: flags, count, then items of kind, text */
+    Remote_Ping,                     /* client: any payload, answered as is */
+    Remote_Result,                   /* server: index, status, output */
+    Remote_Done,                     /* server: count, failed, execution time (microsecond) */
+    Remote_Pong,                     /* server: the payload of the ping */
+    Remote_Error                     /* server: text, the request was not understood */
+};
+
+/* DESCRIPTION: kinds of the items of a batch */
+enum RemoteKind
+{
+    Remote_Command = 1,              /* "~Function(text)" or "!Template", ZwCommandSend() */
+    Remote_Macro                     /* macro statements, ZwCommandMacroExecute() with its output */
+};
+
+/* DESCRIPTION: flags of a batch */
+enum RemoteBatchFlag
+{
+    Remote_StopOnError = 1           /* items after a failed one are not executed */
+};
+
+/*
+DESCRIPTION:
+   Header of a frame, little-endian on the wire: payload length, sequence
+number of the batch (or ping) it belongs to, type and flags.
+*/
+struct RemoteHeader
+{
+    uint32_t length;
+    uint32_t sequence;
+    uint16_t type;                   /* RemoteFrameType */
+    uint16_t flags;                  /* RemoteBatchFlag of a batch */
+};
+
+/*
+DESCRIPTION:
+   Payload of a frame. Integers are 32-bit little-endian, texts their
+length, their bytes and a null, so a text is used in place as a C
+string. Every read checks the end; past it, or on a text without its
+null, the reads answer zero or NULL and Failed() is set.
+*/
+class RemotePayload
+{
+public:
+    RemotePayload() : m_offset(0), m_failed(0) {}
+
+    void Clear(void);
+    void PutInt(uint32_t value);
+    void PutText(const char *text, size_t bytes);
+    void SetInt(size_t offset, uint32_t value);
+
+    uint32_t GetInt(void);
+    const char *GetText(uint32_t *bytes);
+    void Rewind(void);
+
+    std::string &Data(void) { return m_data; }
+    int Failed(void) const { return m_failed; }
+    int End(void) const { return m_offset == m_data.size(); }
+
+private:
+    std::string m_data;
+    size_t m_offset;
+    int m_failed;
+};
+
+/*******************************************************************/
+/* Function declarations */
+/*
+DESCRIPTION:
+   Local stream sockets (AF_UNIX, on Windows 10 1803 and later too) and
+the frames over them. The functions return 1 if they fail, else 0;
+FrameReceive() fails too when the peer closed the connection.
+*/
+int RemoteSocketPath(char *path, int size);
+int RemoteSocketListen(const char *path, RemoteSocket *listener);
+int RemoteSocketAccept(RemoteSocket listener, RemoteSocket *connection);
+int RemoteSocketConnect(const char *path, RemoteSocket *connection);
+void RemoteSocketShutdown(RemoteSocket socket);
+void RemoteSocketClose(RemoteSocket socket);
+
+int RemoteFrameSend(RemoteSocket socket, const RemoteHeader &header, const std::string &payload);
+int RemoteFrameReceive(RemoteSocket socket, RemoteHeader *header, RemotePayload *payload);
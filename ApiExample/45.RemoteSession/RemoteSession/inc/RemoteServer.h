@@ -0,0 +1,160 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+#pragma once
+
+/* ZW3D API includes */
+#include "zwapi_util.h"
+
+/* Application includes */
+#include <deque>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "RemoteProtocol.h"
+
+/*******************************************************************/
+/* Data type definitions */
+/*
+DESCRIPTION:
+   Executor of the items of a batch, ZwCommandSend() and
+ZwCommandMacroExecute() in ZW3D (see RemoteSession.cpp), or the
+RemoteRecorder stand-in. It is called on the thread calling
+RemoteServer::Pump() only.
+*/
+class RemoteExecutor
+{
+public:
+    virtual ~RemoteExecutor() {}
+    virtual ezwErrors Execute(int kind, const char *text, std::string *output) = 0;
+};
+
+/*
+DESCRIPTION:
+   Stand-in executor. It appends the items it executes to the executed
+stream, "~" or "!" commands as they are and macros prefixed with "macro:",
+and waits "item" microseconds for each of them. The output of a macro is
+the output of ZwCommandMacroExecute() for one variable, its statements:
+
+   1,Input,1,"statements"
+
+   If names are registered, a command of another name answers
+ZW_API_INVALID_NAME; the name of "~Name(text)" is "~Name". A command not
+starting with "~" or "!" answers ZW_API_INVALID_STRING and a macro
+containing "ERROR" answers ZW_API_GENERAL_ERROR with the output "ERROR",
+as ZW3D does.
+*/
+class RemoteRecorder : public RemoteExecutor
+{
+public:
+    RemoteRecorder(double item = 0.0);
+
+    ezwErrors Execute(int kind, const char *text, std::string *output) override;
+
+    void Register(const char *name);
+    void Clear(void);
+
+    const std::vector<std::string> &Executed(void) const { return m_executed; }
+
+private:
+    double m_item;                   /* microsecond */
+    std::vector<std::string> m_names;
+    std::vector<std::string> m_executed;
+};
+
+/* DESCRIPTION: called from an I/O thread of the server when batches are waiting for RemoteServer::Pump() */
+typedef void (*RemoteWake)(void *data);
+
+/* DESCRIPTION: counters of a server since its start */
+struct RemoteServerStats
+{
+    long long connections;
+    long long batches;
+    long long items;                 /* executed */
+    long long failed;                /* executed with an error */
+    long long skipped;               /* not executed, Remote_StopOnError */
+    long long pings;
+    long long rejected;              /* malformed requests */
+    double execute;                  /* second, executing items */
+};
+
+/*
+DESCRIPTION:
+   Server of a persistent remote session: a client connects once to the
+local socket and sends batches of commands and macros, instead of
+starting a zw3dremote process for each command.
+
+   An accept thread takes the connections and a thread per connection
+reads its frames. Pings are answered by that thread. A batch is checked
+as a whole, a malformed one is answered with a Remote_Error frame and
+none of its items are executed, then queued and "wake" is called, once
+until the queue is emptied, so that the thread owning ZW3D calls Pump().
+Pump() executes the queued batches in the order they arrived, sending a
+Remote_Result frame after each item, so the client reads the results as
+they are made, and a Remote_Done frame at the end of each batch. A batch
+is executed in full even if its client has gone.
+
+   Start(), Stop() and Pump() are called on the same thread, Stop() not
+from inside Pump(). Batches not pumped when the server stops are
+dropped.
+*/
+class RemoteServer
+{
+public:
+    RemoteServer(RemoteExecutor *executor, RemoteWake wake = nullptr, void *data = nullptr);
+    ~RemoteServer();
+
+    int Start(const char *path);
+    void Stop(void);
+    int Pump(void);
+
+    int Running(void) const { return m_listener != REMOTE_SOCKET_NONE; }
+    const char *Path(void) const { return m_path.c_str(); }
+    RemoteServerStats Stats(void);
+
+private:
+    /* DESCRIPTION: a client connection, closed when its thread ended and its batches are executed */
+    struct Connection
+    {
+        RemoteSocket socket;
+        std::mutex write;            /* frames of the pump and of the reading thread */
+        std::thread thread;
+        int ended;                   /* the reading thread ended, it may be joined */
+
+        Connection(RemoteSocket s) : socket(s), ended(0) {}
+        ~Connection() { RemoteSocketClose(socket); }
+        int Send(const RemoteHeader &header, const std::string &payload);
+    };
+
+    /* DESCRIPTION: a checked batch waiting for Pump() */
+    struct Batch
+    {
+        std::shared_ptr<Connection> connection;
+        RemoteHeader header;
+        RemotePayload payload;       /* read again by Pump() */
+    };
+
+    void AcceptLoop(void);
+    void ReadLoop(std::shared_ptr<Connection> connection);
+    static int BatchCheck(RemotePayload *payload);
+    int BatchExecute(Batch *batch);
+
+    RemoteExecutor *m_executor;
+    RemoteWake m_wake;
+    void *m_data;
+    std::string m_path;
+    RemoteSocket m_listener;
+    std::thread m_accept;
+    int m_stopping;                  /* under m_mutex */
+    std::mutex m_mutex;              /* the connections, the queue and the stats */
+    std::list<std::shared_ptr<Connection>> m_connections;
+    std::deque<std::unique_ptr<Batch>> m_queue;
+    std::deque<std::unique_ptr<Batch>> m_pumped;    /* emptied batches kept for their memory */
+    RemoteServerStats m_stats;
+    RemotePayload m_result;          /* payload of a result, used by Pump() only */
+    std::string m_output;            /* output of an item, used by Pump() only */
+};
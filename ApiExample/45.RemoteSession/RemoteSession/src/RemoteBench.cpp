@@ -0,0 +1,459 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "RemoteClient.h"
+#include "RemoteServer.h"
+
+extern char **environ;
+
+/*******************************************************************/
+/* Constant definitions */
+#define BENCH_ITEMS 20000            /* default of the commands of each measure */
+#define BATCH_ITEMS 100              /* commands of a batch */
+#define SPAWN_RUNS 200               /* processes started to measure a spawn */
+#define SPAWN_PROGRAM "/bin/true"    /* stand-in of zw3dremote, which does more than this */
+#define CLIENT_BATCHES 200           /* batches of each client of the concurrency check */
+
+/*******************************************************************/
+/* Data type definitions */
+/*
+DESCRIPTION:
+   Stand-in of the main thread of ZW3D: it waits for the wake of the
+server and pumps the queued batches. The executor is read by the checks
+under "pump".
+*/
+struct PumpThread
+{
+    RemoteServer *server;
+    std::mutex mutex;
+    std::condition_variable condition;
+    int woken;
+    int stop;
+    std::mutex pump;                 /* held while pumping */
+    std::thread thread;
+};
+
+/*******************************************************************/
+/* Function declarations */
+static void PumpWake(void *data);
+static void PumpLoop(PumpThread *pump);
+static void ResultCount(void *data, const RemoteResult &result);
+static double Seconds(std::chrono::steady_clock::time_point start);
+static int Check(int ok, const char *what);
+static int ChecksRun(const char *path, RemoteRecorder *recorder, PumpThread *pump, RemoteServer *server);
+static void ClientRun(const char *path, int client, int *failed);
+static double SpawnTime(int runs);
+static void BenchRun(const char *path, int items);
+static int ClientMode(const char *path, int count, char **items);
+
+/*******************************************************************/
+/* Function definition */
+double Seconds
+(
+std::chrono::steady_clock::time_point start   /* I: start time */
+)
+/*
+DESCRIPTION:
+   Seconds elapsed since "start".
+*/
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*******************************************************************/
+/* Function definition */
+void PumpWake
+(
+void *data   /* I: PumpThread */
+)
+/*
+DESCRIPTION:
+   Wake of the server, called from its reading threads.
+*/
+{
+    PumpThread *pump = (PumpThread *)data;
+    {
+        std::lock_guard<std::mutex> lock(pump->mutex);
+        pump->woken = 1;
+    }
+    pump->condition.notify_one();
+}
+
+/*******************************************************************/
+/* Function definition */
+void PumpLoop
+(
+PumpThread *pump   /* I/O: pump thread */
+)
+/*
+DESCRIPTION:
+   Pump the server each time it wakes the thread, until it is stopped.
+*/
+{
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(pump->mutex);
+            pump->condition.wait(lock, [pump]() { return pump->woken || pump->stop; });
+            if (pump->stop)
+                return;
+            pump->woken = 0;
+        }
+        std::lock_guard<std::mutex> lock(pump->pump);
+        pump->server->Pump();
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+void ResultCount
+(
+void *data,                  /* I/O: int counter */
+const RemoteResult &result   /* I: result received */
+)
+/*
+DESCRIPTION:
+   Result callback counting the results streamed.
+*/
+{
+    (void)result;
+    (*(int *)data)++;
+}
+
+/*******************************************************************/
+/* Function definition */
+int Check
+(
+int ok,             /* I: condition checked */
+const char *what    /* I: what is checked */
+)
+/*
+DESCRIPTION:
+   Print a failed check.
+
+   Return 1 if the check failed, else 0.
+*/
+{
+    if (!ok)
+        printf("check failed: %s\n", what);
+    return ok ? 0 : 1;
+}
+
+/*******************************************************************/
+/* Function definition */
+void ClientRun
+(
+const char *path,   /* I: socket path */
+int client,         /* I: number of the client */
+int *failed         /* O: 1 if a batch failed */
+)
+/*
+DESCRIPTION:
+   Client of the concurrency check: CLIENT_BATCHES batches of numbered
+commands "~Client<client>(<n>)".
+*/
+{
+    RemoteClient remote;
+    *failed = remote.Connect(path);
+    char command[64];
+    for (int b = 0; b < CLIENT_BATCHES && !*failed; b++)
+    {
+        for (int i = 0; i < 5; i++)
+        {
+            snprintf(command, sizeof(command), "~Client%d(%d)", client, b * 5 + i);
+            remote.Command(command);
+        }
+        *failed = remote.Execute(nullptr) || remote.Executed() != 5 || remote.Failed() != 0;
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+int ChecksRun
+(
+const char *path,            /* I: socket path */
+RemoteRecorder *recorder,    /* I/O: executor of the server */
+PumpThread *pump,            /* I: pump thread of the server */
+RemoteServer *server         /* I: server */
+)
+/*
+DESCRIPTION:
+   Check the results, their streaming and their order, the stop on error,
+the rejection of a malformed batch and two concurrent clients.
+
+   Return the number of failed checks.
+*/
+{
+    int failures = 0;
+    RemoteClient client;
+    failures += Check(!client.Connect(path), "connect");
+
+    /* results in order, statuses of refused commands, macro output */
+    client.Command("~Part(1)");
+    client.Macro("Num = 25");
+    client.Command("Part");
+    client.Command("~Unknown");
+    client.Command("!CdFileSaveAs");
+    client.Macro("ERROR here");
+    std::vector<RemoteResult> results;
+    int streamed = 0;
+    failures += Check(!client.Execute(&results, 0, ResultCount, &streamed), "execute");
+    failures += Check(results.size() == 6 && streamed == 6, "a result for each item, streamed");
+    const ezwErrors statuses[6] = { ZW_API_NO_ERROR, ZW_API_NO_ERROR, ZW_API_INVALID_STRING,
+                                    ZW_API_INVALID_NAME, ZW_API_NO_ERROR, ZW_API_GENERAL_ERROR };
+    for (size_t i = 0; i < results.size() && i < 6; i++)
+        failures += Check(results[i].index == (int)i && results[i].status == statuses[i], "result status and order");
+    failures += Check(results.size() > 1 && results[1].output == "1,Input,1,\"Num = 25\"", "macro output");
+    failures += Check(client.Executed() == 6 && client.Failed() == 3, "done counts");
+    {
+        std::lock_guard<std::mutex> lock(pump->pump);
+        const std::vector<std::string> expected = { "~Part(1)", "macro:Num = 25", "!CdFileSaveAs" };
+        failures += Check(recorder->Executed() == expected, "executed stream");
+        recorder->Clear();
+    }
+
+    /* the items after a failure are skipped */
+    client.Command("~Part(1)");
+    client.Command("~Unknown");
+    client.Command("~Part(2)");
+    failures += Check(!client.Execute(&results, Remote_StopOnError), "execute, stop on error");
+    failures += Check(results.size() == 2 && client.Executed() == 2 && client.Failed() == 1, "stop on error");
+
+    /* a batch with an unknown kind is rejected whole */
+    RemoteSocket raw = REMOTE_SOCKET_NONE;
+    failures += Check(!RemoteSocketConnect(path, &raw), "raw connect");
+    RemotePayload payload;
+    payload.PutInt(2);
+    payload.PutInt(Remote_Command);
+    payload.PutText("~Part(3)", 8);
+    payload.PutInt(7);
+    payload.PutText("~Part(4)", 8);
+    RemoteHeader header = { 0, 9, Remote_Batch, 0 };
+    failures += Check(!RemoteFrameSend(raw, header, payload.Data()), "raw send");
+    failures += Check(!RemoteFrameReceive(raw, &header, &payload) && header.type == Remote_Error && header.sequence == 9,
+                      "malformed batch rejected");
+    RemoteSocketClose(raw);
+
+    double seconds = 0.0;
+    failures += Check(!client.Ping(&seconds), "ping");
+
+    /* two clients at once, each in its order */
+    {
+        std::lock_guard<std::mutex> lock(pump->pump);
+        recorder->Clear();
+    }
+    int failed[2] = { 0, 0 };
+    std::thread first(ClientRun, path, 0, &failed[0]);
+    std::thread second(ClientRun, path, 1, &failed[1]);
+    first.join();
+    second.join();
+    failures += Check(!failed[0] && !failed[1], "concurrent clients");
+    {
+        std::lock_guard<std::mutex> lock(pump->pump);
+        const std::vector<std::string> &executed = recorder->Executed();
+        int next[2] = { 0, 0 }, order = executed.size() == 2 * 5 * CLIENT_BATCHES ? 1 : 0;
+        for (size_t i = 0; i < executed.size(); i++)
+        {
+            int c = -1, n = -1;
+            if (sscanf(executed[i].c_str(), "~Client%d(%d)", &c, &n) != 2 || c < 0 || c > 1 || n != next[c]++)
+                order = 0;
+        }
+        failures += Check(order, "concurrent clients in their order");
+        recorder->Clear();
+    }
+
+    const RemoteServerStats stats = server->Stats();
+    failures += Check(stats.rejected == 1 && stats.pings == 1 && stats.skipped == 1 && stats.connections == 4,
+                      "server counters");
+    return failures;
+}
+
+/*******************************************************************/
+/* Function definition */
+double SpawnTime
+(
+int runs   /* I: processes started */
+)
+/*
+DESCRIPTION:
+   Mean seconds to start a process and wait for it, the least that a
+zw3dremote launch costs a command.
+*/
+{
+    char program[] = SPAWN_PROGRAM;
+    char *argv[] = { program, nullptr };
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < runs; i++)
+    {
+        pid_t pid = 0;
+        int status = 0;
+        if (posix_spawn(&pid, SPAWN_PROGRAM, nullptr, nullptr, argv, environ) != 0)
+            return 0.0;
+        waitpid(pid, &status, 0);
+    }
+    return Seconds(start) / runs;
+}
+
+/*******************************************************************/
+/* Function definition */
+void BenchRun
+(
+const char *path,   /* I: socket path */
+int items           /* I: commands of each measure */
+)
+/*
+DESCRIPTION:
+   Measure the round-trip of a ping, a command a batch, and batches of
+BATCH_ITEMS commands, against starting a process for each command.
+*/
+{
+    RemoteClient client;
+    if (client.Connect(path))
+        return;
+
+    double seconds = 0.0, ping = 0.0;
+    for (int i = 0; i < items; i++)
+    {
+        client.Ping(&seconds);
+        ping += seconds;
+    }
+    ping /= items;
+
+    std::vector<RemoteResult> results;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < items; i++)
+    {
+        client.Command("~Part(1)");
+        client.Execute(&results);
+    }
+    const double single = Seconds(start) / items;
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < items; i += BATCH_ITEMS)
+    {
+        for (int j = 0; j < BATCH_ITEMS; j++)
+            client.Command("~Part(1)");
+        client.Execute(&results);
+    }
+    const double batched = Seconds(start) / items;
+
+    const double spawn = SpawnTime(SPAWN_RUNS);
+    printf("ping round-trip          %8.2f us\n", ping * 1e6);
+    printf("a command a batch        %8.2f us/command\n", single * 1e6);
+    printf("batches of %-4d          %8.2f us/command\n", BATCH_ITEMS, batched * 1e6);
+    printf("process per command      %8.2f us/command (%s, %d runs)\n", spawn * 1e6, SPAWN_PROGRAM, SPAWN_RUNS);
+    if (single > 0.0 && batched > 0.0)
+        printf("session vs spawn: %.0fx a command a batch, %.0fx batched\n", spawn / single, spawn / batched);
+}
+
+/*******************************************************************/
+/* Function definition */
+int ClientMode
+(
+const char *path,   /* I: socket path, of the ZW3D session */
+int count,          /* I: number of items */
+char **items        /* I: commands, macros prefixed with "macro:" */
+)
+/*
+DESCRIPTION:
+   Execute items in a running session and print their results.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    RemoteClient client;
+    if (client.Connect(path))
+    {
+        printf("%s\n", client.Error().c_str());
+        return 1;
+    }
+    for (int i = 0; i < count; i++)
+    {
+        if (strncmp(items[i], "macro:", 6) == 0)
+            client.Macro(items[i] + 6);
+        else
+            client.Command(items[i]);
+    }
+    std::vector<RemoteResult> results;
+    if (client.Execute(&results))
+    {
+        printf("%s\n", client.Error().c_str());
+        return 1;
+    }
+    for (const RemoteResult &result : results)
+        printf("%d: status %d %s\n", result.index, (int)result.status, result.output.c_str());
+    printf("%d executed, %d failed, %.1f us in the session\n", client.Executed(), client.Failed(),
+           client.ServerTime() * 1e6);
+    return client.Failed() ? 1 : 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int main
+(
+int argc,      /* I: number of arguments */
+char **argv    /* I: [-n items] | -s socket item... */
+)
+/*
+DESCRIPTION:
+   Check the session server against the stand-in executor and measure
+it, or with "-s", send items to a running session.
+
+   Return 1 if a check fails, else 0.
+*/
+{
+    int items = BENCH_ITEMS;
+    if (argc > 2 && strcmp(argv[1], "-s") == 0)
+        return ClientMode(argv[2], argc - 3, argv + 3);
+    if (argc > 2 && strcmp(argv[1], "-n") == 0)
+        items = atoi(argv[2]) > 0 ? atoi(argv[2]) : BENCH_ITEMS;
+
+    char path[REMOTE_PATH_SIZE];
+    snprintf(path, sizeof(path), "/tmp/remote_bench_%d.sock", (int)getpid());
+
+    RemoteRecorder recorder;
+    recorder.Register("~Part");
+    recorder.Register("!CdFileSaveAs");
+    recorder.Register("~Client0");
+    recorder.Register("~Client1");
+    PumpThread pump;
+    pump.woken = 0;
+    pump.stop = 0;
+    RemoteServer server(&recorder, PumpWake, &pump);
+    pump.server = &server;
+    if (server.Start(path))
+    {
+        printf("cannot listen on %s\n", path);
+        return 1;
+    }
+    pump.thread = std::thread(PumpLoop, &pump);
+
+    const int failures = ChecksRun(path, &recorder, &pump, &server);
+    printf("checks: %s\n", failures ? "FAILED" : "passed");
+    if (!failures)
+        BenchRun(path, items);
+
+    {
+        std::lock_guard<std::mutex> lock(pump.mutex);
+        pump.stop = 1;
+    }
+    pump.condition.notify_one();
+    pump.thread.join();
+    server.Stop();
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,297 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* Application includes */
+#include <string.h>
+#include <chrono>
+#include "RemoteClient.h"
+
+/*******************************************************************/
+/* Function definition */
+RemoteClient::RemoteClient
+(
+)
+/*
+DESCRIPTION:
+   Client not connected, with an empty batch.
+*/
+    : m_socket(REMOTE_SOCKET_NONE), m_sequence(0), m_count(0), m_result(), m_executed(0), m_failed(0),
+      m_serverTime(0.0)
+{
+}
+
+/*******************************************************************/
+/* Function definition */
+RemoteClient::~RemoteClient
+(
+)
+/*
+DESCRIPTION:
+   Close the connection.
+*/
+{
+    Close();
+}
+
+/*******************************************************************/
+/* Function definition */
+int RemoteClient::Connect
+(
+const char *path   /* I: socket path, NULL for RemoteSocketPath() */
+)
+/*
+DESCRIPTION:
+   Connect to the server of a session, closing the connection open
+before.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    Close();
+    char defaultPath[REMOTE_PATH_SIZE];
+    if (!path)
+    {
+        if (RemoteSocketPath(defaultPath, REMOTE_PATH_SIZE))
+        {
+            m_error = "socket path too long";
+            return 1;
+        }
+        path = defaultPath;
+    }
+    if (RemoteSocketConnect(path, &m_socket))
+    {
+        m_error = "no session listening on ";
+        m_error += path;
+        return 1;
+    }
+    m_error.clear();
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void RemoteClient::Close
+(
+void
+)
+/*
+DESCRIPTION:
+   Close the connection. The items added stay for the next connection.
+*/
+{
+    RemoteSocketClose(m_socket);
+    m_socket = REMOTE_SOCKET_NONE;
+}
+
+/*******************************************************************/
+/* Function definition */
+void RemoteClient::Add
+(
+int kind,           /* I: RemoteKind */
+const char *text    /* I: command or macro statements */
+)
+/*
+DESCRIPTION:
+   Add an item to the batch, after the place of its count.
+*/
+{
+    if (m_count == 0)
+    {
+        m_batch.Clear();
+        m_batch.PutInt(0);
+    }
+    m_batch.PutInt((uint32_t)kind);
+    m_batch.PutText(text, strlen(text));
+    m_count++;
+}
+
+/*******************************************************************/
+/* Function definition */
+void RemoteClient::Command
+(
+const char *command   /* I: "~Function(text)" or "!Template" command */
+)
+/*
+DESCRIPTION:
+   Add a command to the batch, executed by ZwCommandSend().
+*/
+{
+    Add(Remote_Command, command);
+}
+
+/*******************************************************************/
+/* Function definition */
+void RemoteClient::Macro
+(
+const char *statements   /* I: macro statements, separated by new lines */
+)
+/*
+DESCRIPTION:
+   Add macro statements to the batch, executed by ZwCommandMacroExecute();
+their output is the output of the result.
+*/
+{
+    Add(Remote_Macro, statements);
+}
+
+/*******************************************************************/
+/* Function definition */
+void RemoteClient::Discard
+(
+void
+)
+/*
+DESCRIPTION:
+   Empty the batch without sending it.
+*/
+{
+    m_batch.Clear();
+    m_count = 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int RemoteClient::Execute
+(
+std::vector<RemoteResult> *results,   /* O: results in the order of the items, NULL to ignore */
+int flags,                            /* I: RemoteBatchFlag */
+RemoteResultCallback callback,        /* I: called for each result, NULL to ignore */
+void *data                            /* I: data of "callback" */
+)
+/*
+DESCRIPTION:
+   Send the batch and wait until it is executed. The batch is emptied
+even if it fails. Failed() items are not a failure of Execute(); with
+Remote_StopOnError the items after the first failed one have no result.
+The strings of "results" are reused from one call to the next.
+
+   Return 1 if the connection fails or the server rejects the batch (see
+Error()), else 0.
+*/
+{
+    m_executed = 0;
+    m_failed = 0;
+    m_serverTime = 0.0;
+    if (!Connected())
+    {
+        m_error = "not connected";
+        Discard();
+        return 1;
+    }
+    size_t used = 0;
+    if (m_count == 0)
+    {
+        if (results)
+            results->clear();
+        return 0;
+    }
+
+    m_batch.SetInt(0, (uint32_t)m_count);
+    RemoteHeader header = { 0, ++m_sequence, Remote_Batch, (uint16_t)flags };
+    const int failed = RemoteFrameSend(m_socket, header, m_batch.Data());
+    Discard();
+    if (failed)
+    {
+        m_error = "connection lost";
+        Close();
+        return 1;
+    }
+
+    for (;;)
+    {
+        if (RemoteFrameReceive(m_socket, &header, &m_frame))
+        {
+            m_error = "connection lost";
+            Close();
+            return 1;
+        }
+        if (header.sequence != m_sequence)
+            continue;
+
+        uint32_t bytes = 0;
+        if (header.type == Remote_Result)
+        {
+            m_result.index = (int)m_frame.GetInt();
+            m_result.status = (ezwErrors)(int32_t)m_frame.GetInt();
+            const char *text = m_frame.GetText(&bytes);
+            m_result.output.assign(text ? text : "", bytes);
+            if (callback)
+                callback(data, m_result);
+            if (results)
+            {
+                if (used < results->size())
+                {
+                    RemoteResult &result = (*results)[used];
+                    result.index = m_result.index;
+                    result.status = m_result.status;
+                    result.output.assign(m_result.output);
+                }
+                else
+                    results->push_back(m_result);
+                used++;
+            }
+        }
+        else if (header.type == Remote_Done)
+        {
+            m_frame.GetInt();
+            m_executed = (int)m_frame.GetInt();
+            m_failed = (int)m_frame.GetInt();
+            m_serverTime = m_frame.GetInt() * 1e-6;
+            if (results)
+                results->resize(used);
+            return 0;
+        }
+        else if (header.type == Remote_Error)
+        {
+            const char *text = m_frame.GetText(&bytes);
+            m_error.assign(text ? text : "", bytes);
+            if (results)
+                results->resize(used);
+            return 1;
+        }
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+int RemoteClient::Ping
+(
+double *seconds   /* O: round-trip (second) */
+)
+/*
+DESCRIPTION:
+   Send an empty ping and wait for its pong, the cost of a request
+without executing anything.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    *seconds = 0.0;
+    if (!Connected())
+    {
+        m_error = "not connected";
+        return 1;
+    }
+    const auto start = std::chrono::steady_clock::now();
+    RemoteHeader header = { 0, ++m_sequence, Remote_Ping, 0 };
+    static const std::string empty;
+    if (RemoteFrameSend(m_socket, header, empty))
+    {
+        m_error = "connection lost";
+        Close();
+        return 1;
+    }
+    do
+    {
+        if (RemoteFrameReceive(m_socket, &header, &m_frame))
+        {
+            m_error = "connection lost";
+            Close();
+            return 1;
+        }
+    } while (header.sequence != m_sequence || header.type != Remote_Pong);
+    *seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return 0;
+}
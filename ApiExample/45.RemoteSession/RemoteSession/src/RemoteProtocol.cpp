@@ -0,0 +1,532 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "RemoteProtocol.h"
+#ifdef _WIN32
+#include <afunix.h>
+#ifdef _MSC_VER
+#pragma comment(lib, "Ws2_32.lib")
+#endif
+#else
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+/*******************************************************************/
+/* Constant definitions */
+#define LISTEN_BACKLOG 16
+#define FRAME_STACK 4096             /* frames up to this size are sent with one call */
+#ifdef _WIN32
+#define SEND_FLAGS 0
+#define SHUTDOWN_BOTH SD_BOTH
+#else
+#define SEND_FLAGS MSG_NOSIGNAL      /* a closed peer fails the call instead of raising SIGPIPE */
+#define SHUTDOWN_BOTH SHUT_RDWR
+#endif
+
+/*******************************************************************/
+/* Function declarations */
+static int SocketStartup(void);
+static int SocketAddress(const char *path, struct sockaddr_un *address);
+static int SendAll(RemoteSocket socket, const char *data, size_t bytes);
+static int ReceiveAll(RemoteSocket socket, char *data, size_t bytes);
+static void IntWrite(char *bytes, uint32_t value);
+static uint32_t IntRead(const char *bytes);
+
+/*******************************************************************/
+/* Function definition */
+int SocketStartup
+(
+void
+)
+/*
+DESCRIPTION:
+   Start Winsock once for the process. Nothing to do on other systems.
+
+   Return 1 if function fails, else 0.
+*/
+{
+#ifdef _WIN32
+    static const int failed = []()
+    {
+        WSADATA data;
+        return WSAStartup(MAKEWORD(2, 2), &data) != 0 ? 1 : 0;
+    }();
+    return failed;
+#else
+    return 0;
+#endif
+}
+
+/*******************************************************************/
+/* Function definition */
+int SocketAddress
+(
+const char *path,               /* I: socket path */
+struct sockaddr_un *address     /* O: address of the path */
+)
+/*
+DESCRIPTION:
+   Local socket address of "path".
+
+   Return 1 if the path is too long, else 0.
+*/
+{
+    memset(address, 0, sizeof(*address));
+    address->sun_family = AF_UNIX;
+    const size_t length = strlen(path);
+    if (length == 0 || length >= sizeof(address->sun_path))
+        return 1;
+    memcpy(address->sun_path, path, length);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int SendAll
+(
+RemoteSocket socket,   /* I: connected socket */
+const char *data,      /* I: bytes to send */
+size_t bytes           /* I: number of bytes */
+)
+/*
+DESCRIPTION:
+   Send all the bytes, the call sends part of them when the buffer of
+the socket is full.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    while (bytes > 0)
+    {
+        const int chunk = bytes > 0x40000000 ? 0x40000000 : (int)bytes;
+        const int sent = (int)send(socket, data, chunk, SEND_FLAGS);
+        if (sent <= 0)
+            return 1;
+        data += sent;
+        bytes -= sent;
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int ReceiveAll
+(
+RemoteSocket socket,   /* I: connected socket */
+char *data,            /* O: bytes received */
+size_t bytes           /* I: number of bytes */
+)
+/*
+DESCRIPTION:
+   Receive exactly "bytes" bytes.
+
+   Return 1 if function fails or the peer closed the connection, else 0.
+*/
+{
+    while (bytes > 0)
+    {
+        const int chunk = bytes > 0x40000000 ? 0x40000000 : (int)bytes;
+        const int received = (int)recv(socket, data, chunk, 0);
+        if (received <= 0)
+            return 1;
+        data += received;
+        bytes -= received;
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void IntWrite
+(
+char *bytes,      /* O: 4 bytes */
+uint32_t value    /* I: value */
+)
+/*
+DESCRIPTION:
+   Write a 32-bit integer little-endian.
+*/
+{
+    bytes[0] = (char)(value & 0xff);
+    bytes[1] = (char)((value >> 8) & 0xff);
+    bytes[2] = (char)((value >> 16) & 0xff);
+    bytes[3] = (char)((value >> 24) & 0xff);
+}
+
+/*******************************************************************/
+/* Function definition */
+uint32_t IntRead
+(
+const char *bytes   /* I: 4 bytes */
+)
+/*
+DESCRIPTION:
+   Read a 32-bit little-endian integer.
+*/
+{
+    const unsigned char *b = (const unsigned char *)bytes;
+    return (uint32_t)b[0] | ((uint32_t)b[1] << 8) | ((uint32_t)b[2] << 16) | ((uint32_t)b[3] << 24);
+}
+
+/*******************************************************************/
+/* Function definition */
+void RemotePayload::Clear
+(
+void
+)
+/*
+DESCRIPTION:
+   Empty the payload, keeping its memory.
+*/
+{
+    m_data.clear();
+    m_offset = 0;
+    m_failed = 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void RemotePayload::PutInt
+(
+uint32_t value   /* I: value */
+)
+/*
+DESCRIPTION:
+   Append a 32-bit integer.
+*/
+{
+    char bytes[4];
+    IntWrite(bytes, value);
+    m_data.append(bytes, 4);
+}
+
+/*******************************************************************/
+/* Function definition */
+void RemotePayload::SetInt
+(
+size_t offset,    /* I: offset of an integer put before */
+uint32_t value    /* I: value */
+)
+/*
+DESCRIPTION:
+   Overwrite an integer, the count of a batch known at its end.
+*/
+{
+    if (offset + 4 <= m_data.size())
+        IntWrite(&m_data[offset], value);
+}
+
+/*******************************************************************/
+/* Function definition */
+void RemotePayload::PutText
+(
+const char *text,   /* I: text, not null-terminated */
+size_t bytes        /* I: length of the text */
+)
+/*
+DESCRIPTION:
+   Append a text, its length, its bytes and a null.
+*/
+{
+    PutInt((uint32_t)bytes);
+    m_data.append(text, bytes);
+    m_data.push_back('\0');
+}
+
+/*******************************************************************/
+/* Function definition */
+uint32_t RemotePayload::GetInt
+(
+void
+)
+/*
+DESCRIPTION:
+   Read the next integer, 0 and Failed() at the end.
+*/
+{
+    if (m_failed || m_data.size() - m_offset < 4)
+    {
+        m_failed = 1;
+        return 0;
+    }
+    const uint32_t value = IntRead(m_data.data() + m_offset);
+    m_offset += 4;
+    return value;
+}
+
+/*******************************************************************/
+/* Function definition */
+const char *RemotePayload::GetText
+(
+uint32_t *bytes   /* O: length of the text */
+)
+/*
+DESCRIPTION:
+   Read the next text. The text points into the payload and is
+null-terminated; NULL and Failed() if the payload is too short or the
+null is missing.
+*/
+{
+    const uint32_t length = GetInt();
+    *bytes = 0;
+    if (m_failed || m_data.size() - m_offset < (size_t)length + 1 || m_data[m_offset + length] != '\0')
+    {
+        m_failed = 1;
+        return nullptr;
+    }
+    const char *text = m_data.data() + m_offset;
+    m_offset += (size_t)length + 1;
+    *bytes = length;
+    return text;
+}
+
+/*******************************************************************/
+/* Function definition */
+void RemotePayload::Rewind
+(
+void
+)
+/*
+DESCRIPTION:
+   Read the payload again from its start.
+*/
+{
+    m_offset = 0;
+    m_failed = 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int RemoteSocketPath
+(
+char *path,   /* O: socket path */
+int size      /* I: size of "path" */
+)
+/*
+DESCRIPTION:
+   Path of the socket of the session: the REMOTE_SOCKET_ENV environment
+variable if it is set, else REMOTE_SOCKET_NAME in the temporary
+directory.
+
+   Return 1 if the path does not fit, else 0.
+*/
+{
+    std::string text;
+#ifdef _MSC_VER
+    char *value = nullptr;
+    size_t length = 0;
+    if (_dupenv_s(&value, &length, REMOTE_SOCKET_ENV) == 0 && value)
+    {
+        text = value;
+        free(value);
+    }
+#else
+    const char *value = getenv(REMOTE_SOCKET_ENV);
+    if (value)
+        text = value;
+#endif
+    if (text.empty())
+    {
+#ifdef _WIN32
+        char directory[MAX_PATH + 1];
+        const DWORD length = GetTempPathA(MAX_PATH + 1, directory);
+        if (length == 0 || length > MAX_PATH)
+            return 1;
+        text = directory;
+#else
+        text = "/tmp/";
+#endif
+        text += REMOTE_SOCKET_NAME;
+    }
+    if ((int)text.size() >= size || (int)text.size() >= REMOTE_PATH_SIZE)
+        return 1;
+    memcpy(path, text.c_str(), text.size() + 1);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int RemoteSocketListen
+(
+const char *path,           /* I: socket path */
+RemoteSocket *listener      /* O: listening socket */
+)
+/*
+DESCRIPTION:
+   Listen on "path". A file left at the path by a session that ended
+without closing its socket is removed first.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    *listener = REMOTE_SOCKET_NONE;
+    struct sockaddr_un address;
+    if (SocketStartup() || SocketAddress(path, &address))
+        return 1;
+
+    const RemoteSocket socket_ = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (socket_ == REMOTE_SOCKET_NONE)
+        return 1;
+    remove(path);
+    if (bind(socket_, (struct sockaddr *)&address, sizeof(address)) != 0 || listen(socket_, LISTEN_BACKLOG) != 0)
+    {
+        RemoteSocketClose(socket_);
+        return 1;
+    }
+    *listener = socket_;
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int RemoteSocketAccept
+(
+RemoteSocket listener,      /* I: listening socket */
+RemoteSocket *connection    /* O: connection of a client */
+)
+/*
+DESCRIPTION:
+   Wait for a client and accept its connection.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    *connection = accept(listener, nullptr, nullptr);
+    return *connection == REMOTE_SOCKET_NONE ? 1 : 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int RemoteSocketConnect
+(
+const char *path,           /* I: socket path */
+RemoteSocket *connection    /* O: connected socket */
+)
+/*
+DESCRIPTION:
+   Connect to the server listening on "path".
+
+   Return 1 if function fails, else 0.
+*/
+{
+    *connection = REMOTE_SOCKET_NONE;
+    struct sockaddr_un address;
+    if (SocketStartup() || SocketAddress(path, &address))
+        return 1;
+
+    const RemoteSocket socket_ = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (socket_ == REMOTE_SOCKET_NONE)
+        return 1;
+    if (connect(socket_, (struct sockaddr *)&address, sizeof(address)) != 0)
+    {
+        RemoteSocketClose(socket_);
+        return 1;
+    }
+    *connection = socket_;
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void RemoteSocketShutdown
+(
+RemoteSocket socket   /* I: connected socket */
+)
+/*
+DESCRIPTION:
+   End both directions of a connection, which wakes a thread waiting to
+receive on it. The socket is still to be closed.
+*/
+{
+    if (socket != REMOTE_SOCKET_NONE)
+        shutdown(socket, SHUTDOWN_BOTH);
+}
+
+/*******************************************************************/
+/* Function definition */
+void RemoteSocketClose
+(
+RemoteSocket socket   /* I: socket */
+)
+/*
+DESCRIPTION:
+   Close a socket.
+*/
+{
+    if (socket == REMOTE_SOCKET_NONE)
+        return;
+#ifdef _WIN32
+    closesocket(socket);
+#else
+    close(socket);
+#endif
+}
+
+/*******************************************************************/
+/* Function definition */
+int RemoteFrameSend
+(
+RemoteSocket socket,          /* I: connected socket */
+const RemoteHeader &header,   /* I: header, its length is the size of "payload" */
+const std::string &payload    /* I: payload */
+)
+/*
+DESCRIPTION:
+   Send a frame. A small frame is sent with one call, the results of a
+batch are streamed one frame each.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    char bytes[FRAME_STACK];
+    IntWrite(bytes, (uint32_t)payload.size());
+    IntWrite(bytes + 4, header.sequence);
+    IntWrite(bytes + 8, (uint32_t)header.type | ((uint32_t)header.flags << 16));
+    if (payload.size() <= FRAME_STACK - REMOTE_HEADER_BYTES)
+    {
+        memcpy(bytes + REMOTE_HEADER_BYTES, payload.data(), payload.size());
+        return SendAll(socket, bytes, REMOTE_HEADER_BYTES + payload.size());
+    }
+    return SendAll(socket, bytes, REMOTE_HEADER_BYTES) || SendAll(socket, payload.data(), payload.size()) ? 1 : 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int RemoteFrameReceive
+(
+RemoteSocket socket,       /* I: connected socket */
+RemoteHeader *header,      /* O: header */
+RemotePayload *payload     /* O: payload, rewound */
+)
+/*
+DESCRIPTION:
+   Receive a frame. A payload over REMOTE_FRAME_MAX fails, the
+connection is then out of step and must be closed.
+
+   Return 1 if function fails or the peer closed the connection, else 0.
+*/
+{
+    char bytes[REMOTE_HEADER_BYTES];
+    if (ReceiveAll(socket, bytes, REMOTE_HEADER_BYTES))
+        return 1;
+    header->length = IntRead(bytes);
+    header->sequence = IntRead(bytes + 4);
+    const uint32_t type = IntRead(bytes + 8);
+    header->type = (uint16_t)(type & 0xffff);
+    header->flags = (uint16_t)(type >> 16);
+    if (header->length > REMOTE_FRAME_MAX)
+        return 1;
+
+    payload->Clear();
+    std::string &data = payload->Data();
+    data.resize(header->length);
+    return header->length > 0 && ReceiveAll(socket, &data[0], header->length) ? 1 : 0;
+}
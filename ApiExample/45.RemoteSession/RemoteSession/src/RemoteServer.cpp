@@ -0,0 +1,523 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include "RemoteServer.h"
+
+/*******************************************************************/
+/* Constant definitions */
+#define BATCH_POOL 64                /* emptied batches kept for the next ones */
+#define ACCEPT_RETRY 10              /* millisecond, wait after a failed accept */
+
+/*******************************************************************/
+/* Function declarations */
+static double Seconds(std::chrono::steady_clock::time_point start);
+static void Wait(double micros);
+static std::string CommandName(const char *command);
+
+/*******************************************************************/
+/* Function definition */
+double Seconds
+(
+std::chrono::steady_clock::time_point start   /* I: start time */
+)
+/*
+DESCRIPTION:
+   Seconds elapsed since "start".
+*/
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*******************************************************************/
+/* Function definition */
+void Wait
+(
+double micros   /* I: time to wait (microsecond) */
+)
+/*
+DESCRIPTION:
+   Busy-wait "micros" microseconds. Sleeping would round short waits up
+to the scheduler tick.
+*/
+{
+    if (micros <= 0.0)
+        return;
+    const auto end = std::chrono::steady_clock::now() +
+                     std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                         std::chrono::duration<double, std::micro>(micros));
+    while (std::chrono::steady_clock::now() < end)
+    {
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+std::string CommandName
+(
+const char *command   /* I: command string */
+)
+/*
+DESCRIPTION:
+   Name of a command, the string before its "(" argument.
+*/
+{
+    const char *paren = strchr(command, '(');
+    return paren ? std::string(command, paren - command) : std::string(command);
+}
+
+/*******************************************************************/
+/* Function definition */
+RemoteRecorder::RemoteRecorder
+(
+double item   /* I: wait of an item (microsecond) */
+)
+/*
+DESCRIPTION:
+   Stand-in executor with no registered name and nothing executed.
+*/
+    : m_item(item)
+{
+}
+
+/*******************************************************************/
+/* Function definition */
+ezwErrors RemoteRecorder::Execute
+(
+int kind,              /* I: RemoteKind */
+const char *text,      /* I: command or macro statements */
+std::string *output    /* O: output of a macro, empty for a command */
+)
+/*
+DESCRIPTION:
+   Execute an item as ZwCommandSend() or ZwCommandMacroExecute() would
+and record it.
+*/
+{
+    Wait(m_item);
+    output->clear();
+    if (kind == Remote_Command)
+    {
+        if (text[0] != '~' && text[0] != '!')
+            return ZW_API_INVALID_STRING;
+        if (!m_names.empty() && std::find(m_names.begin(), m_names.end(), CommandName(text)) == m_names.end())
+            return ZW_API_INVALID_NAME;
+        m_executed.push_back(text);
+        return ZW_API_NO_ERROR;
+    }
+    if (kind == Remote_Macro)
+    {
+        if (strstr(text, "ERROR"))
+        {
+            *output = "ERROR";
+            return ZW_API_GENERAL_ERROR;
+        }
+        m_executed.push_back(std::string("macro:") + text);
+        *output = "1,Input,1,\"";
+        *output += text;
+        *output += "\"";
+        return ZW_API_NO_ERROR;
+    }
+    return ZW_API_INVALID_INPUT;
+}
+
+/*******************************************************************/
+/* Function definition */
+void RemoteRecorder::Register
+(
+const char *name   /* I: command name, "~Name" or "!Template" */
+)
+/*
+DESCRIPTION:
+   Accept the commands of a name; once a name is registered, the others
+are refused.
+*/
+{
+    m_names.push_back(name);
+}
+
+/*******************************************************************/
+/* Function definition */
+void RemoteRecorder::Clear
+(
+void
+)
+/*
+DESCRIPTION:
+   Forget the executed items; the registered names stay.
+*/
+{
+    m_executed.clear();
+}
+
+/*******************************************************************/
+/* Function definition */
+int RemoteServer::Connection::Send
+(
+const RemoteHeader &header,   /* I: header */
+const std::string &payload    /* I: payload */
+)
+/*
+DESCRIPTION:
+   Send a frame to the client, one thread at a time.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    std::lock_guard<std::mutex> lock(write);
+    return RemoteFrameSend(socket, header, payload);
+}
+
+/*******************************************************************/
+/* Function definition */
+RemoteServer::RemoteServer
+(
+RemoteExecutor *executor,   /* I: executor of the items */
+RemoteWake wake,            /* I: called when batches wait for Pump(), NULL if Pump() is polled */
+void *data                  /* I: data of "wake" */
+)
+/*
+DESCRIPTION:
+   Server not started.
+*/
+    : m_executor(executor), m_wake(wake), m_data(data), m_listener(REMOTE_SOCKET_NONE), m_stopping(0), m_stats()
+{
+}
+
+/*******************************************************************/
+/* Function definition */
+RemoteServer::~RemoteServer
+(
+)
+/*
+DESCRIPTION:
+   Stop the server.
+*/
+{
+    Stop();
+}
+
+/*******************************************************************/
+/* Function definition */
+int RemoteServer::Start
+(
+const char *path   /* I: socket path */
+)
+/*
+DESCRIPTION:
+   Listen on "path" and accept the clients.
+
+   Return 1 if function fails or the server is running, else 0.
+*/
+{
+    if (Running() || RemoteSocketListen(path, &m_listener))
+        return 1;
+    m_path = path;
+    m_stopping = 0;
+    m_stats = RemoteServerStats();
+    m_accept = std::thread(&RemoteServer::AcceptLoop, this);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void RemoteServer::Stop
+(
+void
+)
+/*
+DESCRIPTION:
+   Close the socket and the connections and wait for the threads. The
+accept thread is woken by a connection of the server itself.
+*/
+{
+    if (!Running())
+        return;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = 1;
+    }
+    RemoteSocket self = REMOTE_SOCKET_NONE;
+    RemoteSocketConnect(m_path.c_str(), &self);
+    RemoteSocketShutdown(m_listener);
+    m_accept.join();
+    RemoteSocketClose(self);
+    RemoteSocketClose(m_listener);
+    m_listener = REMOTE_SOCKET_NONE;
+    remove(m_path.c_str());
+
+    std::list<std::shared_ptr<Connection>> connections;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        connections.swap(m_connections);
+    }
+    for (const std::shared_ptr<Connection> &connection : connections)
+        RemoteSocketShutdown(connection->socket);
+    for (const std::shared_ptr<Connection> &connection : connections)
+        connection->thread.join();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_queue.clear();
+}
+
+/*******************************************************************/
+/* Function definition */
+RemoteServerStats RemoteServer::Stats
+(
+void
+)
+/*
+DESCRIPTION:
+   Counters of the server since it started.
+*/
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+/*******************************************************************/
+/* Function definition */
+void RemoteServer::AcceptLoop
+(
+void
+)
+/*
+DESCRIPTION:
+   Accept thread: start a reading thread for each client, and join the
+threads of the clients that left.
+*/
+{
+    for (;;)
+    {
+        RemoteSocket socket = REMOTE_SOCKET_NONE;
+        const int failed = RemoteSocketAccept(m_listener, &socket);
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (m_stopping)
+        {
+            RemoteSocketClose(socket);
+            return;
+        }
+        if (failed)
+        {
+            lock.unlock();
+            std::this_thread::sleep_for(std::chrono::milliseconds(ACCEPT_RETRY));
+            continue;
+        }
+
+        for (auto it = m_connections.begin(); it != m_connections.end();)
+        {
+            if ((*it)->ended)
+            {
+                (*it)->thread.join();
+                it = m_connections.erase(it);
+            }
+            else
+                ++it;
+        }
+        std::shared_ptr<Connection> connection = std::make_shared<Connection>(socket);
+        connection->thread = std::thread(&RemoteServer::ReadLoop, this, connection);
+        m_connections.push_back(connection);
+        m_stats.connections++;
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+void RemoteServer::ReadLoop
+(
+std::shared_ptr<Connection> connection   /* I: client connection */
+)
+/*
+DESCRIPTION:
+   Reading thread of a client: answer its pings, check its batches and
+queue them for Pump(), until the client closes the connection or sends a
+frame too large. The connection is closed when its queued batches are
+executed.
+*/
+{
+    RemoteHeader header;
+    RemotePayload payload, answer;
+    while (!RemoteFrameReceive(connection->socket, &header, &payload))
+    {
+        if (header.type == Remote_Ping)
+        {
+            header.type = Remote_Pong;
+            header.flags = 0;
+            connection->Send(header, payload.Data());
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stats.pings++;
+            continue;
+        }
+        if (header.type != Remote_Batch || BatchCheck(&payload))
+        {
+            static const char message[] = "malformed request";
+            answer.Clear();
+            answer.PutText(message, sizeof(message) - 1);
+            header.type = Remote_Error;
+            header.flags = 0;
+            connection->Send(header, answer.Data());
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stats.rejected++;
+            continue;
+        }
+
+        int wake = 0;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            std::unique_ptr<Batch> batch;
+            if (!m_pumped.empty())
+            {
+                batch = std::move(m_pumped.back());
+                m_pumped.pop_back();
+            }
+            else
+                batch.reset(new Batch);
+            batch->connection = connection;
+            batch->header = header;
+            batch->payload.Data().swap(payload.Data());
+            wake = m_queue.empty() ? 1 : 0;
+            m_queue.push_back(std::move(batch));
+        }
+        if (wake && m_wake)
+            m_wake(m_data);
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    connection->ended = 1;
+}
+
+/*******************************************************************/
+/* Function definition */
+int RemoteServer::BatchCheck
+(
+RemotePayload *payload   /* I: payload of a batch */
+)
+/*
+DESCRIPTION:
+   Check a batch: its count, then as many items of a known kind and a
+text, and nothing after them.
+
+   Return 1 if the batch is malformed, else 0.
+*/
+{
+    payload->Rewind();
+    const uint32_t count = payload->GetInt();
+    for (uint32_t i = 0; i < count && !payload->Failed(); i++)
+    {
+        const uint32_t kind = payload->GetInt();
+        uint32_t bytes = 0;
+        payload->GetText(&bytes);
+        if (kind != Remote_Command && kind != Remote_Macro)
+            return 1;
+    }
+    return payload->Failed() || !payload->End() ? 1 : 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int RemoteServer::BatchExecute
+(
+Batch *batch   /* I: checked batch */
+)
+/*
+DESCRIPTION:
+   Execute the items of a batch, sending the result of each item as soon
+as it is executed, then the done frame. With Remote_StopOnError the items
+after a failed one are skipped and have no result.
+
+   Return the number of items executed.
+*/
+{
+    RemotePayload &payload = batch->payload;
+    payload.Rewind();
+    const uint32_t count = payload.GetInt();
+    const int stopOnError = (batch->header.flags & Remote_StopOnError) ? 1 : 0;
+    RemoteHeader header = batch->header;
+    header.flags = 0;
+
+    int executed = 0, failed = 0, skipped = 0;
+    double seconds = 0.0;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        const uint32_t kind = payload.GetInt();
+        uint32_t bytes = 0;
+        const char *text = payload.GetText(&bytes);
+        if (stopOnError && failed)
+        {
+            skipped++;
+            continue;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        const ezwErrors status = m_executor->Execute((int)kind, text, &m_output);
+        seconds += Seconds(start);
+        executed++;
+        if (status != ZW_API_NO_ERROR)
+            failed++;
+
+        /* a client that has gone fails the sends, the batch goes on */
+        m_result.Clear();
+        m_result.PutInt(i);
+        m_result.PutInt((uint32_t)status);
+        m_result.PutText(m_output.data(), m_output.size());
+        header.type = Remote_Result;
+        batch->connection->Send(header, m_result.Data());
+    }
+
+    m_result.Clear();
+    m_result.PutInt(count);
+    m_result.PutInt((uint32_t)executed);
+    m_result.PutInt((uint32_t)failed);
+    m_result.PutInt(seconds * 1e6 < 4294967295.0 ? (uint32_t)(seconds * 1e6) : 0xffffffffu);
+    header.type = Remote_Done;
+    batch->connection->Send(header, m_result.Data());
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stats.batches++;
+    m_stats.items += executed;
+    m_stats.failed += failed;
+    m_stats.skipped += skipped;
+    m_stats.execute += seconds;
+    return executed;
+}
+
+/*******************************************************************/
+/* Function definition */
+int RemoteServer::Pump
+(
+void
+)
+/*
+DESCRIPTION:
+   Execute the queued batches, in the order they arrived. Call it on the
+thread owning ZW3D, when "wake" was called or from time to time.
+
+   Return the number of items executed.
+*/
+{
+    std::deque<std::unique_ptr<Batch>> batches;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        batches.swap(m_queue);
+    }
+    int executed = 0;
+    for (std::unique_ptr<Batch> &batch : batches)
+    {
+        executed += BatchExecute(batch.get());
+        batch->connection.reset();
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    while (!batches.empty() && m_pumped.size() < BATCH_POOL)
+    {
+        m_pumped.push_back(std::move(batches.back()));
+        batches.pop_back();
+    }
+    return executed;
+}
@@ -0,0 +1,310 @@
+/*
+ * (C) Copyright 2024, ZWSOFT Co., LTD. (Guangzhou) All Rights Reserved.
+*/
+
+/*******************************************************************/
+/* Application includes */
+#include <stdio.h>
+#include <string>
+#include "..\inc\RemoteSessionPr.h"
+#include "..\inc\RemoteServer.h"
+#include <windows.h>
+
+/*******************************************************************/
+/* Constant definitions */
+#define MESSAGE_SIZE 256
+#define WAKE_MESSAGE (WM_APP + 1)
+#define WAKE_CLASS "ZwRemoteSessionWake"
+
+/*******************************************************************/
+/* Data type definitions */
+/*
+DESCRIPTION:
+   Executor of the session: "~" and "!" commands by ZwCommandSend() and
+macro statements by ZwCommandMacroExecute(), on the main thread.
+*/
+class ZwRemoteExecutor : public RemoteExecutor
+{
+public:
+    ezwErrors Execute(int kind, const char *text, std::string *output) override;
+};
+
+/*******************************************************************/
+/* Function declarations */
+static int RemoteSessionStart(void);
+static int RemoteSessionStop(void);
+static int RemoteSessionStatus(void);
+static void SessionStop(void);
+static void SessionWake(void *data);
+static LRESULT CALLBACK WakeProc(HWND window, UINT message, WPARAM wParam, LPARAM lParam);
+
+/*******************************************************************/
+/* Variable definitions */
+static ZwRemoteExecutor g_executor;
+static RemoteServer *g_server = nullptr;
+static HWND g_window = nullptr;       /* message-only window of the main thread, woken by the server */
+static int g_pumping = 0;             /* batches are being executed */
+static int g_rewake = 0;              /* woken while pumping, by a command pumping the messages */
+static int g_stopPending = 0;         /* stop asked by a command of a batch */
+
+/*******************************************************************/
+/* Function definition */
+int RegisterRemoteSession
+(
+void
+)
+/*
+DESCRIPTION:
+   Register the commands of the remote session example.
+*/
+{
+    /* Serve the remote session by entering "~RemoteSessionStart" */
+    ZwCommandFunctionLoad("RemoteSessionStart", (void *)RemoteSessionStart, ZW_LICENSE_CODE_GENERAL);
+    /* Stop serving it by entering "~RemoteSessionStop" */
+    ZwCommandFunctionLoad("RemoteSessionStop", (void *)RemoteSessionStop, ZW_LICENSE_CODE_GENERAL);
+    /* Display its counters by entering "~RemoteSessionStatus" */
+    ZwCommandFunctionLoad("RemoteSessionStatus", (void *)RemoteSessionStatus, ZW_LICENSE_CODE_GENERAL);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int UnloadRemoteSession
+(
+void
+)
+/*
+DESCRIPTION:
+   Stop the session and unload the commands of the remote session example.
+*/
+{
+    SessionStop();
+    ZwCommandFunctionUnload("RemoteSessionStart");
+    ZwCommandFunctionUnload("RemoteSessionStop");
+    ZwCommandFunctionUnload("RemoteSessionStatus");
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+ezwErrors ZwRemoteExecutor::Execute
+(
+int kind,              /* I: RemoteKind */
+const char *text,      /* I: command or macro statements */
+std::string *output    /* O: output of a macro, empty for a command */
+)
+/*
+DESCRIPTION:
+   Execute an item of a batch.
+*/
+{
+    output->clear();
+    if (kind == Remote_Command)
+        return ZwCommandSend(text);
+
+    char *macroOutput = nullptr;
+    const ezwErrors error = ZwCommandMacroExecute(ZW_MACRO_STATEMENTS, text, &macroOutput);
+    if (macroOutput)
+        *output = macroOutput;
+    ZwMemoryFree((void **)&macroOutput);
+    return error;
+}
+
+/*******************************************************************/
+/* Function definition */
+void SessionWake
+(
+void *data   /* I: message-only window */
+)
+/*
+DESCRIPTION:
+   Wake of the server, called from its reading threads: post a message
+to the window of the main thread, where the batches are executed.
+*/
+{
+    PostMessageA((HWND)data, WAKE_MESSAGE, 0, 0);
+}
+
+/*******************************************************************/
+/* Function definition */
+LRESULT CALLBACK WakeProc
+(
+HWND window,       /* I: message-only window */
+UINT message,      /* I: message */
+WPARAM wParam,     /* I: message parameter */
+LPARAM lParam      /* I: message parameter */
+)
+/*
+DESCRIPTION:
+   Window procedure of the main thread: execute the queued batches. A
+command of a batch may pump the messages, the wake is then kept for the
+end of the batches, which are never executed inside one another.
+*/
+{
+    if (message != WAKE_MESSAGE)
+        return DefWindowProcA(window, message, wParam, lParam);
+    if (g_pumping)
+    {
+        g_rewake = 1;
+        return 0;
+    }
+
+    g_pumping = 1;
+    do
+    {
+        g_rewake = 0;
+        if (g_server)
+            g_server->Pump();
+    } while (g_rewake);
+    g_pumping = 0;
+
+    if (g_stopPending)
+    {
+        g_stopPending = 0;
+        SessionStop();
+        cvxMsgDisp("Remote session stopped");
+    }
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+void SessionStop
+(
+void
+)
+/*
+DESCRIPTION:
+   Stop the server and destroy the window of the session.
+*/
+{
+    if (g_server)
+    {
+        g_server->Stop();
+        delete g_server;
+        g_server = nullptr;
+    }
+    if (g_window)
+    {
+        DestroyWindow(g_window);
+        g_window = nullptr;
+    }
+}
+
+/*******************************************************************/
+/* Function definition */
+int RemoteSessionStart
+(
+void
+)
+/*
+DESCRIPTION:
+   Serve the remote session on the socket of RemoteSocketPath(): the
+clients connect once and send batches of commands and macros, executed
+here on the main thread, instead of starting zw3dremote for each
+command.
+
+   Return 1 if function fails, else 0.
+*/
+{
+    char message[MESSAGE_SIZE];
+    char path[REMOTE_PATH_SIZE];
+    if (g_server)
+    {
+        sprintf_s(message, MESSAGE_SIZE, "Remote session already listening on %s", g_server->Path());
+        cvxMsgDisp(message);
+        return 0;
+    }
+    if (RemoteSocketPath(path, REMOTE_PATH_SIZE))
+    {
+        cvxMsgDisp("The path of the remote session socket is too long");
+        return 1;
+    }
+
+    static ATOM windowClass = 0;
+    if (!windowClass)
+    {
+        WNDCLASSA description = {};
+        description.lpfnWndProc = WakeProc;
+        description.hInstance = GetModuleHandleA(nullptr);
+        description.lpszClassName = WAKE_CLASS;
+        windowClass = RegisterClassA(&description);
+    }
+    g_window = CreateWindowExA(0, WAKE_CLASS, "", 0, 0, 0, 0, 0, HWND_MESSAGE, nullptr, GetModuleHandleA(nullptr),
+                               nullptr);
+    if (!g_window)
+    {
+        cvxMsgDisp("The window of the remote session cannot be created");
+        return 1;
+    }
+
+    g_server = new RemoteServer(&g_executor, SessionWake, g_window);
+    if (g_server->Start(path))
+    {
+        SessionStop();
+        sprintf_s(message, MESSAGE_SIZE, "The remote session cannot listen on %s", path);
+        cvxMsgDisp(message);
+        return 1;
+    }
+    sprintf_s(message, MESSAGE_SIZE, "Remote session listening on %s", path);
+    cvxMsgDisp(message);
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int RemoteSessionStop
+(
+void
+)
+/*
+DESCRIPTION:
+   Stop serving the remote session. Sent by a client, the session stops
+at the end of the batches being executed.
+
+   Return 0.
+*/
+{
+    if (!g_server)
+    {
+        cvxMsgDisp("No remote session");
+        return 0;
+    }
+    if (g_pumping)
+    {
+        g_stopPending = 1;
+        return 0;
+    }
+    SessionStop();
+    cvxMsgDisp("Remote session stopped");
+    return 0;
+}
+
+/*******************************************************************/
+/* Function definition */
+int RemoteSessionStatus
+(
+void
+)
+/*
+DESCRIPTION:
+   Display the counters of the remote session.
+
+   Return 0.
+*/
+{
+    char message[MESSAGE_SIZE];
+    if (!g_server)
+    {
+        cvxMsgDisp("No remote session");
+        return 0;
+    }
+    const RemoteServerStats stats = g_server->Stats();
+    sprintf_s(message, MESSAGE_SIZE, "Remote session on %s: %lld connections, %lld batches, %lld pings",
+              g_server->Path(), stats.connections, stats.batches, stats.pings);
+    cvxMsgDisp(message);
+    sprintf_s(message, MESSAGE_SIZE, "%lld items executed in %.3f ms, %lld failed, %lld skipped, %lld rejected requests",
+              stats.items, stats.execute * 1e3, stats.failed, stats.skipped, stats.rejected);
+    cvxMsgDisp(message);
+    return 0;
+}